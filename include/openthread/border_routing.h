@@ -775,6 +775,43 @@ void otBorderRoutingDhcp6PdSetRequestCallback(otInstance
                                               otBorderRoutingRequestDhcp6PdCallback aCallback,
                                               void                                 *aContext);
 
+#define OT_BORDER_ROUTING_PREFIX_COUNTERS_ITERATOR_INIT 0 ///< Initializer for `otBorderRoutingPrefixCountersIterator`.
+
+typedef uint8_t otBorderRoutingPrefixCountersIterator; ///< Used to iterate through the per-prefix counter table.
+
+/**
+ * Represents the per-prefix counters of packets forwarded via Border Routing.
+ */
+typedef struct otBorderRoutingPrefixCounters
+{
+    otIp6Prefix       mPrefix;   ///< The mesh-side /64 prefix the traffic is attributed to.
+    otPacketsAndBytes mInbound;  ///< The counters for inbound traffic (destined to `mPrefix`).
+    otPacketsAndBytes mOutbound; ///< The counters for outbound traffic (originated from `mPrefix`).
+} otBorderRoutingPrefixCounters;
+
+/**
+ * Gets the next entry from the per-prefix Border Routing counter table.
+ *
+ * Requires `OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE`.
+ *
+ * Forwarded messages are attributed to the /64 prefix of their mesh-side address (the destination for inbound
+ * messages, the source for outbound messages), which corresponds to the OMR prefix of the mesh subnet sending or
+ * receiving the traffic. The table is bounded: once it is full, traffic not matching any tracked prefix is counted
+ * only in the aggregate counters (see `otIp6GetBorderRoutingCounters()`). The table is cleared along with the
+ * aggregate counters by `otIp6ResetBorderRoutingCounters()`.
+ *
+ * @param[in]     aInstance  A pointer to an OpenThread instance.
+ * @param[in,out] aIterator  A pointer to the iterator. To get the first entry, it should be set to
+ *                           `OT_BORDER_ROUTING_PREFIX_COUNTERS_ITERATOR_INIT`. MUST NOT be NULL.
+ * @param[out]    aCounters  A pointer to where the entry is copied. MUST NOT be NULL.
+ *
+ * @retval OT_ERROR_NONE       Successfully retrieved the next entry.
+ * @retval OT_ERROR_NOT_FOUND  No more entries in the table.
+ */
+otError otBorderRoutingGetPrefixCounters(otInstance                            *aInstance,
+                                         otBorderRoutingPrefixCountersIterator *aIterator,
+                                         otBorderRoutingPrefixCounters         *aCounters);
+
 /**
  * Sets the local on-link prefix.
  *
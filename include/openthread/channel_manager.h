@@ -76,6 +76,24 @@ extern "C" {
  */
 void otChannelManagerRequestChannelChange(otInstance *aInstance, uint8_t aChannel);
 
+/**
+ * Requests a fast Thread network channel change (e.g., to escape a jammed channel).
+ *
+ * This behaves like `otChannelManagerRequestChannelChange()` except that the Pending Operational Dataset is staged
+ * with a short Delay Timer (`OPENTHREAD_CONFIG_CHANNEL_MANAGER_FAST_MIGRATION_DELAY`) instead of the delay from
+ * `otChannelManagerSetDelay()`, cutting the channel-escape time from minutes to seconds. An ongoing regular channel
+ * change (even to the same channel) is canceled and re-staged with the fast delay.
+ *
+ * Since the fast delay may be shorter than the data poll interval of sleepy end devices in the network, such devices
+ * may miss the pending dataset and need to re-attach on the new channel.
+ *
+ * Only available on FTDs.
+ *
+ * @param[in]  aInstance          A pointer to an OpenThread instance.
+ * @param[in]  aChannel           The new channel for the Thread network.
+ */
+void otChannelManagerRequestFastChannelChange(otInstance *aInstance, uint8_t aChannel);
+
 /**
  * Gets the channel from the last successful call to `otChannelManagerRequestChannelChange()`
  *
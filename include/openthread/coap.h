@@ -738,6 +738,45 @@ otError otCoapSendRequest(otInstance           *aInstance,
                           const otMessageInfo  *aMessageInfo,
                           otCoapResponseHandler aHandler,
                           void                 *aContext);
+
+/**
+ * Sends a copy of a prepared CoAP request, optionally rewriting its token.
+ *
+ * This function clones @p aMessage (which is left unchanged and owned by the caller) and sends the copy to the
+ * destination given in @p aMessageInfo, assigning it a fresh Message ID. It is intended for fanning a single
+ * prepared payload out to multiple destinations, e.g., Observe notifications, without re-serializing the message
+ * per destination.
+ *
+ * If @p aToken is not NULL, the token in the copy is replaced with @p aToken, which MUST have the same length as
+ * the token in @p aMessage.
+ *
+ * @param[in]  aInstance     A pointer to an OpenThread instance.
+ * @param[in]  aMessage      A pointer to the prepared message to copy and send.
+ * @param[in]  aMessageInfo  A pointer to the message info specifying the destination of the copy.
+ * @param[in]  aToken        A pointer to the token to use in the copy, or NULL to keep the token of @p aMessage.
+ * @param[in]  aHandler      A function pointer that shall be called on response reception or timeout.
+ * @param[in]  aContext      A pointer to arbitrary context information. May be NULL if not used.
+ *
+ * @retval OT_ERROR_NONE          Successfully sent a copy of the CoAP message.
+ * @retval OT_ERROR_INVALID_ARGS  The length of @p aToken differs from the token length in @p aMessage.
+ * @retval OT_ERROR_NO_BUFS       Insufficient message buffers available to copy or send the message.
+ */
+otError otCoapSendCopy(otInstance           *aInstance,
+                       const otMessage      *aMessage,
+                       const otMessageInfo  *aMessageInfo,
+                       const otCoapToken    *aToken,
+                       otCoapResponseHandler aHandler,
+                       void                 *aContext);
+
+/**
+ * Gets the number of CoAP requests awaiting a response, acknowledgment, or retransmission.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns The number of pending CoAP requests.
+ */
+uint16_t otCoapGetPendingRequestCount(otInstance *aInstance);
+
 /**
  * Starts the CoAP server.
  *
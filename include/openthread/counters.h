@@ -0,0 +1,123 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the OpenThread API for the counter registry feature.
+ */
+
+#ifndef OPENTHREAD_COUNTERS_H_
+#define OPENTHREAD_COUNTERS_H_
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/link.h>
+#include <openthread/thread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup api-counters
+ *
+ * @brief
+ *   This module includes functions to retrieve a consistent snapshot of all counter groups and optional
+ *   on-device counter rates.
+ *
+ *   The functions in this module are available when the counter registry feature
+ *   (`OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE`) is enabled.
+ *
+ * @{
+ */
+
+/**
+ * Represents a snapshot of all counter groups captured at a single point in time.
+ */
+typedef struct otCounterSnapshot
+{
+    uint64_t      mTimestamp;   ///< Uptime (in msec) at which the snapshot was captured.
+    otMacCounters mMacCounters; ///< The MAC layer counters.
+    otIpCounters  mIpCounters;  ///< The IP level counters.
+    otMleCounters mMleCounters; ///< The Thread MLE counters.
+} otCounterSnapshot;
+
+/**
+ * Represents windowed rates of key counters (in events per minute).
+ *
+ * Each rate is an exponentially weighted moving average updated once per minute, where the most recent
+ * one-minute window contributes one eighth of the new value.
+ */
+typedef struct otCounterRates
+{
+    uint32_t mTxTotal;  ///< Rate of `otMacCounters::mTxTotal` (transmissions per minute).
+    uint32_t mRxTotal;  ///< Rate of `otMacCounters::mRxTotal` (receptions per minute).
+    uint32_t mTxRetry;  ///< Rate of `otMacCounters::mTxRetry` (retransmissions per minute).
+    uint32_t mTxErrCca; ///< Rate of `otMacCounters::mTxErrCca` (CCA failures per minute).
+    uint32_t mRxErrFcs; ///< Rate of `otMacCounters::mRxErrFcs` (FCS errors per minute).
+} otCounterRates;
+
+/**
+ * Captures a snapshot of all counter groups with a single uptime stamp.
+ *
+ * All counter groups are read within this call (with no message or event processing interleaved), so the
+ * values in @p aSnapshot are mutually consistent and can be diffed safely against a previous snapshot.
+ *
+ * When `OPENTHREAD_CONFIG_UPTIME_ENABLE` is disabled, `mTimestamp` is the raw monotonic millisecond clock
+ * instead of the uptime (it then wraps after approximately 49 days).
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[out] aSnapshot  A pointer to where the snapshot is copied. MUST NOT be NULL.
+ */
+void otCountersGetSnapshot(otInstance *aInstance, otCounterSnapshot *aSnapshot);
+
+/**
+ * Gets the current windowed counter rates.
+ *
+ * Requires `OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE`.
+ *
+ * All rates read zero until the first one-minute window elapses. A counter reset is detected and treated
+ * as if the counter restarted from zero (the window delta is the post-reset value).
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the current counter rates.
+ */
+const otCounterRates *otCountersGetRates(otInstance *aInstance);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_COUNTERS_H_
@@ -163,6 +163,25 @@ const otDnsQueryConfig *otDnsClientGetDefaultConfig(otInstance *aInstance);
  */
 void otDnsClientSetDefaultConfig(otInstance *aInstance, const otDnsQueryConfig *aConfig);
 
+/**
+ * Represents the DNS client counters.
+ */
+typedef struct otDnsClientCounters
+{
+    uint32_t mQueries;          ///< Number of queries started by the DNS client.
+    uint32_t mCoalescedQueries; ///< Number of queries answered from another in-flight query's response.
+    uint32_t mCacheHits;        ///< Number of queries answered from the response cache.
+} otDnsClientCounters;
+
+/**
+ * Returns the counters of the DNS client.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns  A pointer to the counters of the DNS client.
+ */
+const otDnsClientCounters *otDnsClientGetCounters(otInstance *aInstance);
+
 /**
  * An opaque representation of a response to an address resolution DNS query.
  *
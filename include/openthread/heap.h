@@ -36,6 +36,9 @@
 #define OPENTHREAD_HEAP_H_
 
 #include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/error.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -64,6 +67,41 @@ void *otHeapCAlloc(size_t aCount, size_t aSize);
  */
 void otHeapFree(void *aPointer);
 
+/**
+ * The number of free-block size bins reported in `otHeapStats`.
+ *
+ * Bin `n` holds the number of free blocks with size in `[16 << (n - 1), 16 << n)` bytes, with the first bin holding
+ * blocks smaller than 16 bytes and the last bin holding all larger blocks.
+ */
+#define OT_HEAP_NUM_SIZE_BINS 8
+
+/**
+ * Represents statistics of the OpenThread internal heap.
+ */
+typedef struct otHeapStats
+{
+    uint16_t mCapacity;                              ///< Total number of usable bytes in the heap.
+    uint16_t mFreeSize;                              ///< Current number of free bytes.
+    uint16_t mLargestFreeBlockSize;                  ///< Size of the largest free block in bytes.
+    uint16_t mNumFreeBlocks;                         ///< Current number of free blocks.
+    uint16_t mNumFreeBlocksInBin[OT_HEAP_NUM_SIZE_BINS]; ///< Number of free blocks per size bin.
+    uint32_t mNumAllocations;                        ///< Total number of successful allocations.
+    uint32_t mNumFrees;                              ///< Total number of frees.
+    uint32_t mNumFailedAllocations;                  ///< Total number of failed allocations.
+} otHeapStats;
+
+/**
+ * Gets statistics of the OpenThread internal heap.
+ *
+ * The free-block information allows heap fragmentation to be monitored over time.
+ *
+ * @param[out]  aStats   A pointer to an `otHeapStats` to populate.
+ *
+ * @retval OT_ERROR_NONE             Successfully retrieved the heap statistics.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The build uses an external heap (`OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE`).
+ */
+otError otHeapGetStats(otHeapStats *aStats);
+
 /**
  * @}
  */
@@ -135,6 +135,11 @@ enum
     OT_HISTORY_TRACKER_MSG_PRIORITY_NET    = OT_MESSAGE_PRIORITY_HIGH + 1, ///< Network Control priority level.
 };
 
+/**
+ * Untracked duration - For `mQueueTimeMsec` and `mTxTimeMsec` in `otHistoryTrackerMessageInfo`.
+ */
+#define OT_HISTORY_TRACKER_MSG_DURATION_UNTRACKED 0xffff
+
 /**
  * Represents a RX/TX IPv6 message info.
  *
@@ -156,8 +161,24 @@ typedef struct otHistoryTrackerMessageInfo
     uint8_t    mPriority : 2;        ///< Message priority (`OT_HISTORY_TRACKER_MSG_PRIORITY_*` enumeration).
     bool       mRadioIeee802154 : 1; ///< Indicates whether msg was sent/received over a 15.4 radio link.
     bool       mRadioTrelUdp6 : 1;   ///< Indicates whether msg was sent/received over a TREL radio link.
+    uint16_t   mQueueTimeMsec;       ///< Msec from IPv6 enqueue to first frame prep (TX msg, untracked if `0xffff`).
+    uint16_t   mTxTimeMsec;          ///< Msec from first frame prep to TX done (TX msg, untracked if `0xffff`).
 } otHistoryTrackerMessageInfo;
 
+/**
+ * Represents a message buffer pressure event.
+ *
+ * An entry is recorded when a message buffer allocation fails, capturing the buffer pool state at that time. Entries
+ * are rate limited so that at most one event is recorded per time bucket (sustained exhaustion within the same bucket
+ * does not add new entries).
+ */
+typedef struct otHistoryTrackerBufferPressureInfo
+{
+    uint16_t mFreeBuffers;       ///< Number of free buffers in the message pool when the event was recorded.
+    uint16_t mMaxUsedBuffers;    ///< Max number of used buffers at the same time (see `otBufferInfo`).
+    uint16_t mSendQueueMessages; ///< Number of messages in the 6LoWPAN send queue when the event was recorded.
+} otHistoryTrackerBufferPressureInfo;
+
 /**
  * Defines the events in a neighbor info (i.e. whether neighbor is added, removed, or changed).
  *
@@ -465,6 +486,67 @@ const otHistoryTrackerMessageInfo *otHistoryTrackerIterateTxHistory(otInstance
                                                                     otHistoryTrackerIterator *aIterator,
                                                                     uint32_t                 *aEntryAge);
 
+/**
+ * Exports multiple entries from the RX message history list in a single call.
+ *
+ * Entries are copied into @p aEntries (and their ages into @p aEntryAges) starting from the current iterator
+ * position, until either @p aMaxEntries entries are copied or the end of the list is reached. The iterator is
+ * advanced past the copied entries, so repeated calls drain the full list.
+ *
+ * @param[in]     aInstance    A pointer to the OpenThread instance.
+ * @param[in,out] aIterator    A pointer to an iterator. MUST be initialized or the behavior is undefined.
+ * @param[out]    aEntries     A pointer to an array of `otHistoryTrackerMessageInfo` to populate. MUST NOT be NULL.
+ * @param[out]    aEntryAges   A pointer to an array to output the entries' ages (one per copied entry). MUST NOT be
+ *                             NULL. Age is provided as the duration (in milliseconds) from when entry was recorded
+ *                             to @p aIterator initialization time. It is set to `OT_HISTORY_TRACKER_MAX_AGE` for
+ *                             entries older than max age.
+ * @param[in]     aMaxEntries  The maximum number of entries to copy (size of @p aEntries and @p aEntryAges arrays).
+ *
+ * @returns The number of entries copied into @p aEntries.
+ */
+uint16_t otHistoryTrackerExportRxHistory(otInstance                  *aInstance,
+                                         otHistoryTrackerIterator    *aIterator,
+                                         otHistoryTrackerMessageInfo *aEntries,
+                                         uint32_t                    *aEntryAges,
+                                         uint16_t                     aMaxEntries);
+
+/**
+ * Exports multiple entries from the TX message history list in a single call.
+ *
+ * Behaves the same as `otHistoryTrackerExportRxHistory()` but for the TX message history list.
+ *
+ * @param[in]     aInstance    A pointer to the OpenThread instance.
+ * @param[in,out] aIterator    A pointer to an iterator. MUST be initialized or the behavior is undefined.
+ * @param[out]    aEntries     A pointer to an array of `otHistoryTrackerMessageInfo` to populate. MUST NOT be NULL.
+ * @param[out]    aEntryAges   A pointer to an array to output the entries' ages (one per copied entry). MUST NOT be
+ *                             NULL.
+ * @param[in]     aMaxEntries  The maximum number of entries to copy (size of @p aEntries and @p aEntryAges arrays).
+ *
+ * @returns The number of entries copied into @p aEntries.
+ */
+uint16_t otHistoryTrackerExportTxHistory(otInstance                  *aInstance,
+                                         otHistoryTrackerIterator    *aIterator,
+                                         otHistoryTrackerMessageInfo *aEntries,
+                                         uint32_t                    *aEntryAges,
+                                         uint16_t                     aMaxEntries);
+
+/**
+ * Iterates over the entries in the message buffer pressure history list.
+ *
+ * @param[in]     aInstance  A pointer to the OpenThread instance.
+ * @param[in,out] aIterator  A pointer to an iterator. MUST be initialized or the behavior is undefined.
+ * @param[out]    aEntryAge  A pointer to a variable to output the entry's age. MUST NOT be NULL.
+ *                           Age is provided as the duration (in milliseconds) from when entry was recorded to
+ *                           @p aIterator initialization time. It is set to `OT_HISTORY_TRACKER_MAX_AGE` for entries
+ *                           older than max age.
+ *
+ * @returns The `otHistoryTrackerBufferPressureInfo` entry or `NULL` if no more entries in the list.
+ */
+const otHistoryTrackerBufferPressureInfo *otHistoryTrackerIterateBufferPressureHistory(
+    otInstance               *aInstance,
+    otHistoryTrackerIterator *aIterator,
+    uint32_t                 *aEntryAge);
+
 /**
  * Iterates over the entries in the neighbor history list.
  *
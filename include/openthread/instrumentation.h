@@ -0,0 +1,109 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the OpenThread API for the hot-path instrumentation feature.
+ */
+
+#ifndef OPENTHREAD_INSTRUMENTATION_H_
+#define OPENTHREAD_INSTRUMENTATION_H_
+
+#include <stdint.h>
+
+#include <openthread/error.h>
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup api-instrumentation
+ *
+ * @brief
+ *   This module includes functions to retrieve on-device hot-path execution time histograms.
+ *
+ *   The functions in this module are available when the instrumentation feature
+ *   (`OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE`) is enabled.
+ *
+ * @{
+ */
+
+/**
+ * The number of histogram bins per instrumented site.
+ *
+ * Bin `n` counts invocations whose duration (in microseconds) `d` satisfies `2^(n-1) <= d < 2^n` (bin 0 counts
+ * durations of zero microseconds, and the last bin additionally counts all longer durations).
+ */
+#define OT_INSTRUMENTATION_NUM_HISTOGRAM_BINS 16
+
+/**
+ * Represents the accumulated execution time statistics of one instrumented site.
+ */
+typedef struct otInstrumentationSiteInfo
+{
+    const char *mName;                                             ///< The site name (e.g., "tasklet").
+    uint32_t    mNumInvocations;                                   ///< Number of recorded invocations.
+    uint64_t    mTotalTimeUs;                                      ///< Total accumulated time (in microseconds).
+    uint32_t    mMaxTimeUs;                                        ///< Longest single invocation (in microseconds).
+    uint32_t    mHistogram[OT_INSTRUMENTATION_NUM_HISTOGRAM_BINS]; ///< Log2 duration histogram (see bin definition).
+} otInstrumentationSiteInfo;
+
+/**
+ * Gets the accumulated statistics of an instrumented site.
+ *
+ * Site indices start from zero. To iterate over all sites, increment @p aSiteIndex until this function returns
+ * `OT_ERROR_NOT_FOUND`.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ * @param[in]  aSiteIndex  The index of the site to retrieve.
+ * @param[out] aInfo       A pointer to where the site statistics are copied. MUST NOT be NULL.
+ *
+ * @retval OT_ERROR_NONE       Successfully retrieved the site statistics.
+ * @retval OT_ERROR_NOT_FOUND  @p aSiteIndex is beyond the last instrumented site.
+ */
+otError otInstrumentationGetSiteInfo(otInstance *aInstance, uint16_t aSiteIndex, otInstrumentationSiteInfo *aInfo);
+
+/**
+ * Resets the accumulated statistics of all instrumented sites.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ */
+void otInstrumentationReset(otInstance *aInstance);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_INSTRUMENTATION_H_
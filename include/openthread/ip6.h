@@ -184,6 +184,7 @@ typedef struct otNetifAddress
     bool         mRloc : 1;               ///< TRUE if the address is an RLOC, FALSE otherwise.
     bool         mMeshLocal : 1;          ///< TRUE if the address is mesh-local, FALSE otherwise.
     bool         mSrpRegistered : 1;      ///< Used by OT core only (indicates whether registered by SRP Client).
+    uint32_t     mRxCounter;              ///< Number of received IPv6 datagrams destined to this address (set by core).
     const struct otNetifAddress *mNext;   ///< A pointer to the next network interface address.
 } otNetifAddress;
 
@@ -1027,6 +1027,33 @@ otError otLinkSetCslTimeout(otInstance *aInstance, uint32_t aTimeout);
  */
 uint16_t otLinkGetCcaFailureRate(otInstance *aInstance);
 
+/**
+ * Represents the adaptive CCA backoff state for a channel.
+ */
+typedef struct otLinkAdaptiveCcaState
+{
+    uint8_t  mCsmaMinBe;      ///< Current minimum backoff exponent (macMinBE) used on the channel.
+    uint8_t  mCsmaMaxBe;      ///< Current maximum backoff exponent (macMaxBE) used on the channel.
+    uint16_t mCcaFailureRate; ///< Recent CCA failure rate on the channel (`0xffff` corresponds to 100%).
+} otLinkAdaptiveCcaState;
+
+/**
+ * Gets the adaptive CCA backoff state for a given channel.
+ *
+ * Requires `OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE`.
+ *
+ * When adaptive CCA backoff is enabled, the MAC layer tracks the recent CCA failure rate per channel and adjusts
+ * the CSMA backoff exponents used for software CSMA-CA on that channel (within the bounds allowed by IEEE 802.15.4).
+ *
+ * @param[in]   aInstance   A pointer to an OpenThread instance.
+ * @param[in]   aChannel    The radio channel to query.
+ * @param[out]  aState      A pointer to an `otLinkAdaptiveCcaState` to populate.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved the adaptive CCA state.
+ * @retval OT_ERROR_INVALID_ARGS  @p aChannel is not a valid radio channel.
+ */
+otError otLinkGetAdaptiveCcaState(otInstance *aInstance, uint8_t aChannel, otLinkAdaptiveCcaState *aState);
+
 /**
  * Enables or disables the link layer.
  *
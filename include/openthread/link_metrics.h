@@ -272,6 +272,25 @@ otError otLinkMetricsManagerGetMetricsValueByExtAddr(otInstance          *aInsta
                                                      const otExtAddress  *aExtAddress,
                                                      otLinkMetricsValues *aLinkMetricsValues);
 
+/**
+ * Get the Link Metrics data of all neighbors, one neighbor per call (aggregate snapshot iteration).
+ *
+ * To start the iteration set @p aIterator to zero. Neighbors without valid Link Metrics data are skipped.
+ *
+ * @param[in]     aInstance           A pointer to an OpenThread instance.
+ * @param[in,out] aIterator           A pointer to the iterator. MUST be set to zero to begin.
+ * @param[out]    aExtAddress         A pointer to output the Mac extended address of the neighbor.
+ * @param[out]    aLinkMetricsValues  A pointer to output the Link Metrics values of the neighbor.
+ *
+ * @retval OT_ERROR_NONE          Successfully got the next Link Metrics data.
+ * @retval OT_ERROR_INVALID_ARGS  The arguments are invalid.
+ * @retval OT_ERROR_NOT_FOUND     No more neighbors with valid Link Metrics data.
+ */
+otError otLinkMetricsManagerGetNextMetricsValue(otInstance          *aInstance,
+                                                uint16_t            *aIterator,
+                                                otExtAddress        *aExtAddress,
+                                                otLinkMetricsValues *aLinkMetricsValues);
+
 /**
  * @}
  */
@@ -334,6 +334,22 @@ otError otLinkRawSrcMatchClearShortEntries(otInstance *aInstance);
  */
 otError otLinkRawSrcMatchClearExtEntries(otInstance *aInstance);
 
+/**
+ * Setting the source match pending filter of the radio.
+ *
+ * The pending filter is a compact bitmap the radio consults while source matching is disabled (see
+ * `otPlatRadioSetSrcMatchPendingFilter()`).
+ *
+ * @param[in]  aInstance    A pointer to an OpenThread instance.
+ * @param[in]  aFilter      A pointer to the filter bitmap.
+ * @param[in]  aLength      The filter length in bytes, or zero to remove the filter.
+ *
+ * @retval OT_ERROR_NONE             Successfully set the source match pending filter.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The radio does not support the source match pending filter.
+ * @retval OT_ERROR_INVALID_STATE    If the raw link-layer isn't enabled.
+ */
+otError otLinkRawSrcMatchSetPendingFilter(otInstance *aInstance, const uint8_t *aFilter, uint16_t aLength);
+
 /**
  * Update MAC keys and key index.
  *
@@ -252,6 +252,18 @@ bool otMdnsIsQuestionUnicastAllowed(otInstance *aInstance);
  */
 void otMdnsSetConflictCallback(otInstance *aInstance, otMdnsConflictCallback aCallback);
 
+/**
+ * Gets the number of name conflicts detected while probing.
+ *
+ * The counter covers host, service, and key entries and is tracked since OpenThread instance initialization. Conflicts
+ * detected after a name has been successfully registered (post-probe) are not counted.
+ *
+ * @param[in] aInstance     The OpenThread instance.
+ *
+ * @returns The number of probe-stage name conflicts detected.
+ */
+uint32_t otMdnsGetProbeConflictCount(otInstance *aInstance);
+
 /**
  * Gets the local host name.
  *
@@ -273,13 +273,17 @@ typedef void (*otMeshDiagQueryChildTableCallback)(otError                     aE
 /**
  * Starts query for child table for a given router.
  *
+ * Up to `OPENTHREAD_CONFIG_MESH_DIAG_MAX_CONCURRENT_QUERIES` queries can be outstanding concurrently, with at most
+ * one outstanding query towards a given destination.
+ *
  * @param[in] aInstance        The OpenThread instance.
  * @param[in] aRloc16          The RLOC16 of router to query.
  * @param[in] aCallback        The callback to report the queried child table.
  * @param[in] aContext         A context to pass in @p aCallback.
  *
  * @retval OT_ERROR_NONE           The query started successfully.
- * @retval OT_ERROR_BUSY           A previous discovery or query request is still ongoing.
+ * @retval OT_ERROR_BUSY           A discovery is ongoing, a query towards @p aRloc16 is still outstanding, or no
+ *                                 more concurrent queries can be accepted.
  * @retval OT_ERROR_INVALID_ARGS   The @p aRloc16 is not a valid router RLOC16.
  * @retval OT_ERROR_INVALID_STATE  Device is not attached.
  * @retval OT_ERROR_NO_BUFS        Could not allocate buffer to send query messages.
@@ -312,13 +316,17 @@ typedef void (*otMeshDiagChildIp6AddrsCallback)(otError                    aErro
 /**
  * Sends a query to a parent to retrieve the IPv6 addresses of all its MTD children.
  *
+ * Up to `OPENTHREAD_CONFIG_MESH_DIAG_MAX_CONCURRENT_QUERIES` queries can be outstanding concurrently, with at most
+ * one outstanding query towards a given destination.
+ *
  * @param[in] aInstance        The OpenThread instance.
  * @param[in] aRloc16          The RLOC16 of parent to query.
  * @param[in] aCallback        The callback to report the queried child IPv6 address list.
  * @param[in] aContext         A context to pass in @p aCallback.
  *
  * @retval OT_ERROR_NONE           The query started successfully.
- * @retval OT_ERROR_BUSY           A previous discovery or query request is still ongoing.
+ * @retval OT_ERROR_BUSY           A discovery is ongoing, a query towards @p aRloc16 is still outstanding, or no
+ *                                 more concurrent queries can be accepted.
  * @retval OT_ERROR_INVALID_ARGS   The @p aRloc16 is not a valid  RLOC16.
  * @retval OT_ERROR_INVALID_STATE  Device is not attached.
  * @retval OT_ERROR_NO_BUFS        Could not allocate buffer to send query messages.
@@ -371,13 +379,17 @@ typedef void (*otMeshDiagQueryRouterNeighborTableCallback)(otError
 /**
  * Starts query for router neighbor table for a given router.
  *
+ * Up to `OPENTHREAD_CONFIG_MESH_DIAG_MAX_CONCURRENT_QUERIES` queries can be outstanding concurrently, with at most
+ * one outstanding query towards a given destination.
+ *
  * @param[in] aInstance        The OpenThread instance.
  * @param[in] aRloc16          The RLOC16 of router to query.
  * @param[in] aCallback        The callback to report the queried table.
  * @param[in] aContext         A context to pass in @p aCallback.
  *
  * @retval OT_ERROR_NONE           The query started successfully.
- * @retval OT_ERROR_BUSY           A previous discovery or query request is still ongoing.
+ * @retval OT_ERROR_BUSY           A discovery is ongoing, a query towards @p aRloc16 is still outstanding, or no
+ *                                 more concurrent queries can be accepted.
  * @retval OT_ERROR_INVALID_ARGS   The @p aRloc16 is not a valid router RLOC16.
  * @retval OT_ERROR_INVALID_STATE  Device is not attached.
  * @retval OT_ERROR_NO_BUFS        Could not allocate buffer to send query messages.
@@ -387,6 +399,30 @@ otError otMeshDiagQueryRouterNeighborTable(otInstance
                                            otMeshDiagQueryRouterNeighborTableCallback aCallback,
                                            void                                      *aContext);
 
+/**
+ * Represents the callback used to notify that all outstanding mesh diagnostic queries have finished.
+ *
+ * @param[in] aContext  Application-specific context.
+ */
+typedef void (*otMeshDiagQueriesDoneCallback)(void *aContext);
+
+/**
+ * Sets the callback to notify when all outstanding mesh diagnostic queries have finished.
+ *
+ * The callback is invoked when the last outstanding query completes or times out (after the per-query callback is
+ * invoked). It is not invoked when queries are stopped by `otMeshDiagCancel()`. This can be used to aggregate the
+ * results of a batch of concurrent queries (e.g., a full-mesh topology snapshot).
+ *
+ * A subsequent call to this function replaces any previously set callback.
+ *
+ * @param[in] aInstance  The OpenThread instance.
+ * @param[in] aCallback  The callback to notify that no more queries are outstanding. Can be NULL to disable.
+ * @param[in] aContext   A context to pass in @p aCallback.
+ */
+void otMeshDiagSetQueriesDoneCallback(otInstance                   *aInstance,
+                                      otMeshDiagQueriesDoneCallback aCallback,
+                                      void                         *aContext);
+
 /**
  * Sets the response timeout value to use for any future mesh diagnostic queries.
  *
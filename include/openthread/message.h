@@ -106,6 +106,9 @@ typedef struct otThreadLinkInfo
 
     // Applicable only when OPENTHREAD_CONFIG_MULTI_RADIO feature is enabled.
     uint8_t mRadioType; ///< Radio link type.
+
+    // Applicable only when `OPENTHREAD_CONFIG_RADIO_RX_TIMESTAMP_ENABLE` is enabled.
+    uint64_t mRadioRxTimestamp; ///< Radio receive timestamp (microseconds, `otPlatRadioGetNow()` time base).
 } otThreadLinkInfo;
 
 /**
@@ -427,6 +430,15 @@ typedef struct otMessageQueueInfo
     uint16_t mNumMessages; ///< Number of messages in the queue.
     uint16_t mNumBuffers;  ///< Number of data buffers used by messages in the queue.
     uint32_t mTotalBytes;  ///< Total number of bytes used by all messages in the queue.
+
+    /**
+     * The maximum number of messages in the queue at the same time (queue-depth watermark).
+     *
+     * The watermark is tracked since OT stack initialization or the last call to `otMessageResetBufferInfo()`. It is
+     * maintained for priority-based send queues (e.g., the 6LoWPAN send queue). For queues that do not track a
+     * watermark, this equals the current number of messages in the queue.
+     */
+    uint16_t mMaxNumMessages;
 } otMessageQueueInfo;
 
 /**
@@ -525,6 +537,55 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
  */
 void otMessageResetBufferInfo(otInstance *aInstance);
 
+/**
+ * Represents the module owning an allocation in the per-owner memory accounting table.
+ *
+ * The first entries match the message types (message allocations are attributed to the module implied by their type).
+ * The remaining entries are used for heap allocations. Heap allocations from modules without their own entry are
+ * attributed to `OT_MEM_OWNER_OTHER`.
+ */
+typedef enum otMemOwner
+{
+    OT_MEM_OWNER_IP6            = 0,  ///< IPv6 messages.
+    OT_MEM_OWNER_6LOWPAN        = 1,  ///< 6LoWPAN messages.
+    OT_MEM_OWNER_SUPERVISION    = 2,  ///< Child supervision messages.
+    OT_MEM_OWNER_MAC            = 3,  ///< MAC empty data messages.
+    OT_MEM_OWNER_IP4            = 4,  ///< IPv4 messages (NAT64).
+    OT_MEM_OWNER_BLE            = 5,  ///< BLE messages.
+    OT_MEM_OWNER_OTHER          = 6,  ///< Other messages and untagged heap allocations.
+    OT_MEM_OWNER_DNS            = 7,  ///< DNS modules (heap allocations).
+    OT_MEM_OWNER_SRP            = 8,  ///< SRP server modules (heap allocations).
+    OT_MEM_OWNER_MESHCOP        = 9,  ///< MeshCoP modules (heap allocations).
+    OT_MEM_OWNER_TREL           = 10, ///< TREL radio link module (heap allocations).
+    OT_MEM_OWNER_BORDER_ROUTING = 11, ///< Border routing modules (heap allocations).
+} otMemOwner;
+
+#define OT_NUM_MEM_OWNERS 12 ///< Number of entries in the per-owner memory accounting table.
+
+/**
+ * Represents the per-owner memory accounting stats for a single owner module.
+ */
+typedef struct otMemOwnerStats
+{
+    uint16_t mNumMessages;    ///< Number of live messages owned by the module.
+    uint32_t mMessageBytes;   ///< Total payload bytes across the live messages.
+    uint16_t mNumHeapObjects; ///< Number of live heap-allocated objects owned by the module.
+    uint32_t mHeapBytes;      ///< Total heap bytes directly held by the live objects.
+} otMemOwnerStats;
+
+/**
+ * Gets the per-owner memory accounting table.
+ *
+ * Requires `OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE`.
+ *
+ * The heap byte counts cover the objects themselves and do not include nested heap buffers (e.g., heap strings) that
+ * the objects may own.
+ *
+ * @param[in]   aInstance   A pointer to the OpenThread instance.
+ * @param[out]  aStats      A pointer to an array of `OT_NUM_MEM_OWNERS` entries to populate, indexed by `otMemOwner`.
+ */
+void otMessageGetMemOwnerStats(otInstance *aInstance, otMemOwnerStats *aStats);
+
 /**
  * @}
  */
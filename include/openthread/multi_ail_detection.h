@@ -36,7 +36,9 @@
 #define OPENTHREAD_MULTI_AIL_DETECTION_H_
 
 #include <stdbool.h>
+#include <stdint.h>
 
+#include <openthread/error.h>
 #include <openthread/instance.h>
 
 #ifdef __cplusplus
@@ -146,6 +148,28 @@ void otBorderRoutingSetMultiAilCallback(otInstance                     *aInstanc
                                         otBorderRoutingMultiAilCallback aCallback,
                                         void                           *aContext);
 
+/**
+ * Gets an entry from the reachable peer BR fingerprint history.
+ *
+ * The detector tracks a fingerprint (an order-independent hash) of the set of reachable peer BRs discovered from
+ * received Router Advertisement (RA) messages. Whenever the set membership changes, the new fingerprint is recorded
+ * along with the device uptime, keeping a short history of the most recent changes. The history can be used to
+ * correlate multi-AIL detection state changes with infrastructure events (e.g., switch maintenance windows).
+ *
+ * @param[in]  aInstance     A pointer to the OpenThread instance.
+ * @param[in]  aIndex        The index of the entry to get (zero being the most recent change).
+ * @param[out] aFingerprint  A pointer to return the recorded fingerprint value. MUST NOT be NULL.
+ * @param[out] aUptime       A pointer to return the uptime (in seconds) when the change was recorded. MUST NOT be
+ *                           NULL.
+ *
+ * @retval OT_ERROR_NONE       Successfully retrieved the entry at @p aIndex.
+ * @retval OT_ERROR_NOT_FOUND  No entry at @p aIndex.
+ */
+otError otBorderRoutingGetMultiAilFingerprintHistoryEntry(otInstance *aInstance,
+                                                          uint16_t    aIndex,
+                                                          uint32_t   *aFingerprint,
+                                                          uint32_t   *aUptime);
+
 /**
  * @}
  */
@@ -99,6 +99,7 @@ typedef struct otNat64Counters
     uint64_t m4To6Bytes;   ///< Sum of size of packets translated from IPv4 to IPv6.
     uint64_t m6To4Packets; ///< Number of packets translated from IPv6 to IPv4.
     uint64_t m6To4Bytes;   ///< Sum of size of packets translated from IPv6 to IPv4.
+    uint32_t mSessions;    ///< Number of active sessions (populated by `otNat64GetCounters()` only).
 } otNat64Counters;
 
 /**
@@ -137,7 +138,8 @@ typedef struct otNat64ErrorCounters
 /**
  * Gets NAT64 translator counters.
  *
- * The counter is counted since the instance initialized.
+ * The counter is counted since the instance initialized. The `mSessions` fields are determined from the active
+ * mapping table when the counters are read, counting the mappings that carried traffic for each protocol.
  *
  * Available when `OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE` is enabled.
  *
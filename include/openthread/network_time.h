@@ -83,6 +83,26 @@ typedef void (*otNetworkTimeSyncCallbackFn)(void *aCallbackContext);
  */
 otNetworkTimeStatus otNetworkTimeGet(otInstance *aInstance, uint64_t *aNetworkTime);
 
+/**
+ * Converts a local radio (monotonic) time to the Thread network time, along with a bound on the conversion error.
+ *
+ * The error bound covers the base synchronization uncertainty plus the worst-case residual oscillator drift
+ * accumulated since the last received time sync, enabling cross-node correlation of locally timestamped events.
+ *
+ * Is only available when `OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance     The OpenThread instance structure.
+ * @param[in]  aRadioTime    The local radio time (in microseconds) to convert.
+ * @param[out] aNetworkTime  The Thread network time (in microseconds) corresponding to @p aRadioTime.
+ * @param[out] aMaxError     The maximum conversion error (in microseconds).
+ *
+ * @returns The time synchronization status.
+ */
+otNetworkTimeStatus otNetworkTimeConvertRadioTime(otInstance *aInstance,
+                                                  uint64_t    aRadioTime,
+                                                  uint64_t   *aNetworkTime,
+                                                  uint64_t   *aMaxError);
+
 /**
  * Set the time synchronization period.
  *
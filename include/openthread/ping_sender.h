@@ -67,6 +67,8 @@ typedef struct otPingSenderReply
     uint8_t      mHopLimit;       ///< Hop limit.
 } otPingSenderReply;
 
+#define OT_PING_SENDER_RTT_HISTOGRAM_NUM_BINS 16 ///< Number of bins in the round-trip time histogram.
+
 /**
  * Represents statistics of a ping request.
  */
@@ -78,6 +80,13 @@ typedef struct otPingSenderStatistics
     uint16_t mMinRoundTripTime;   ///< The min round trip time among ping requests.
     uint16_t mMaxRoundTripTime;   ///< The max round trip time among ping requests.
     bool     mIsMulticast;        ///< Whether this is a multicast ping request.
+
+    /**
+     * Histogram of round trip times with exponentially growing bins. Bin `i` counts the replies with round trip
+     * time (in msec) in `[2^i, 2^(i+1))`, with times of zero or one msec counted in bin zero. The bins cover the
+     * full `uint16_t` round trip time range, allowing percentiles to be derived from long-running measurements.
+     */
+    uint16_t mRttHistogram[OT_PING_SENDER_RTT_HISTOGRAM_NUM_BINS];
 } otPingSenderStatistics;
 
 /**
@@ -132,7 +141,25 @@ typedef struct otPingSenderConfig
 otError otPingSenderPing(otInstance *aInstance, const otPingSenderConfig *aConfig);
 
 /**
- * Stops an ongoing ping.
+ * Starts background probing, sending probe trains of pings periodically.
+ *
+ * Each probe train sends pings as configured in @p aConfig. After a train finishes (all replies are received or the
+ * timeout expires), the next train starts @p aProbePeriod milliseconds later, until `otPingSenderStop()` is called.
+ * Statistics (including the round trip time histogram) accumulate across trains and are reported through the
+ * statistics callback in @p aConfig at the end of every train.
+ *
+ * @param[in] aInstance            A pointer to an OpenThread instance.
+ * @param[in] aConfig              The ping config to use for every probe train.
+ * @param[in] aProbePeriod         Time in milliseconds between the end of a probe train and the start of the next.
+ *
+ * @retval OT_ERROR_NONE           The probing started successfully.
+ * @retval OT_ERROR_BUSY           Could not start since busy with a previous ongoing ping request.
+ * @retval OT_ERROR_INVALID_ARGS   @p aConfig or @p aProbePeriod contains invalid parameters.
+ */
+otError otPingSenderStartProbing(otInstance *aInstance, const otPingSenderConfig *aConfig, uint32_t aProbePeriod);
+
+/**
+ * Stops an ongoing ping or background probing.
  *
  * @param[in] aInstance            A pointer to an OpenThread instance.
  */
@@ -428,6 +428,27 @@ otError otPlatCryptoAesSetKey(otCryptoContext *aContext, const otCryptoKey *aKey
  */
 otError otPlatCryptoAesEncrypt(otCryptoContext *aContext, const uint8_t *aInput, uint8_t *aOutput);
 
+/**
+ * Encrypt a sequence of independent data blocks (AES ECB).
+ *
+ * Behaves as if `otPlatCryptoAesEncrypt()` was called once per 16-byte block, but allows the platform to submit all
+ * the blocks to the crypto engine in a single operation (e.g., using multi-block DMA), avoiding the per-block call
+ * overhead. In-place operation (@p aInput equal to @p aOutput) MUST be supported.
+ *
+ * @param[in]  aContext           Context for AES operation.
+ * @param[in]  aInput             Pointer to the input buffer (containing @p aNumBlocks blocks of 16 bytes).
+ * @param[out] aOutput            Pointer to the output buffer (to receive @p aNumBlocks blocks of 16 bytes).
+ * @param[in]  aNumBlocks         Number of 16-byte blocks to encrypt.
+ *
+ * @retval OT_ERROR_NONE          Successfully encrypted @p aInput.
+ * @retval OT_ERROR_FAILED        Failed to encrypt @p aInput.
+ * @retval OT_ERROR_INVALID_ARGS  @p aContext, @p aInput, or @p aOutput were NULL.
+ */
+otError otPlatCryptoAesEncryptBlocks(otCryptoContext *aContext,
+                                     const uint8_t   *aInput,
+                                     uint8_t         *aOutput,
+                                     uint16_t         aNumBlocks);
+
 /**
  * Free the AES context.
  *
@@ -650,6 +671,46 @@ otError otPlatCryptoEcdsaVerify(const otPlatCryptoEcdsaPublicKey *aPublicKey,
                                 const otPlatCryptoSha256Hash     *aHash,
                                 const otPlatCryptoEcdsaSignature *aSignature);
 
+/**
+ * Pointer to callback function used to report the result of an asynchronous ECDSA verification.
+ *
+ * @param[in] aError    The verification result: OT_ERROR_NONE if the signature was verified successfully,
+ *                      OT_ERROR_SECURITY if the signature is invalid, or any error from `otPlatCryptoEcdsaVerify()`.
+ * @param[in] aContext  A pointer to arbitrary context information.
+ */
+typedef void (*otPlatCryptoEcdsaVerifyCallback)(otError aError, void *aContext);
+
+/**
+ * Use the key from the input context to verify the ECDSA signature of a hashed message, asynchronously.
+ *
+ * This function allows platforms with an asynchronous crypto accelerator (e.g., a PKA engine) to perform the
+ * verification without blocking the caller. On success (OT_ERROR_NONE), @p aCallback MUST be invoked exactly once
+ * with the verification result. The callback MAY be invoked before this function returns (e.g., when the platform
+ * performs the verification synchronously, which is the default behavior of the weak implementation provided by
+ * OpenThread). The callback MUST be invoked from the same execution context as other OpenThread API calls.
+ *
+ * The memory pointed to by @p aPublicKey, @p aHash, and @p aSignature is only guaranteed to remain valid for the
+ * duration of this call; the platform must copy any data it needs for a deferred verification.
+ *
+ * @param[in] aPublicKey          A pointer to an ECDSA public key structure where the public key for signature
+ *                                verification is stored.
+ * @param[in] aHash               A pointer to a SHA-256 hash structure where the hash value for signature verification
+ *                                is stored.
+ * @param[in] aSignature          A pointer to an ECDSA signature structure where the signature value to be verified is
+ *                                stored.
+ * @param[in] aCallback           A function pointer that is called with the verification result.
+ * @param[in] aContext            A pointer to arbitrary context information passed to @p aCallback.
+ *
+ * @retval OT_ERROR_NONE          The verification was started successfully (@p aCallback will report the result).
+ * @retval OT_ERROR_INVALID_ARGS  The key or hash is invalid.
+ * @retval OT_ERROR_NO_BUFS       Failed to allocate buffer for signature verification.
+ */
+otError otPlatCryptoEcdsaVerifyAsync(const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                                     const otPlatCryptoSha256Hash     *aHash,
+                                     const otPlatCryptoEcdsaSignature *aSignature,
+                                     otPlatCryptoEcdsaVerifyCallback   aCallback,
+                                     void                             *aContext);
+
 /**
  * Calculate the ECDSA signature for a hashed message using the Key reference passed.
  *
@@ -172,6 +172,33 @@ void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat
  */
 void otPlatLogOutput(otInstance *aInstance, otLogLevel aLogLevel, const char *aLogLine);
 
+/**
+ * Outputs a binary structured log record.
+ *
+ * This platform API is used to output logs when `OPENTHREAD_CONFIG_LOG_OUTPUT` is set to
+ * `OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY`. The OT core then skips all string formatting and instead emits each log as a
+ * compact binary record intended to be stored or streamed as-is and rendered off-device.
+ *
+ * The record layout is (all multi-byte fields little-endian):
+ *
+ * - `uint32_t` timestamp in msec (from `otPlatAlarmMilliGetNow()`).
+ * - `uint8_t` log level.
+ * - `uint8_t` error code (`otError` value associated with the log, `OT_ERROR_NONE` if none).
+ * - `uint32_t` module id: the address of the log module name string, usable both to filter per module and to recover
+ *   the name from the image file.
+ * - `uint32_t` event id: the address of the format string, usable to recover the format from the image file. Zero
+ *   indicates a hex dump record.
+ * - For a log record, the format arguments serialized in order as directed by the format string: 32 bits for
+ *   (possibly `h`/`hh` prefixed) integer and `%p` conversions, 64 bits for `l`/`ll` prefixed ones, and `%s` as a
+ *   one-byte length followed by the string bytes. For a hex dump record, a `uint32_t` title id (the address of the
+ *   dump title string), a `uint16_t` data length, followed by the (possibly truncated) data bytes.
+ *
+ * @param[in]  aLogLevel  The log level.
+ * @param[in]  aData      A pointer to the binary record.
+ * @param[in]  aLength    The length (number of bytes) of the binary record.
+ */
+void otPlatLogBinary(otLogLevel aLogLevel, const uint8_t *aData, uint16_t aLength);
+
 /**
  * Handles OpenThread log level changes.
  *
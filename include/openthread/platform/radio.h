@@ -40,6 +40,7 @@
 
 #include <openthread/error.h>
 #include <openthread/instance.h>
+#include <openthread/radio_stats.h>
 #include <openthread/platform/crypto.h>
 #include <openthread/platform/toolchain.h>
 
@@ -137,6 +138,7 @@ enum
     OT_RADIO_CAPS_RX_ON_WHEN_IDLE      = 1 << 8,  ///< Radio supports RxOnWhenIdle handling.
     OT_RADIO_CAPS_TRANSMIT_FRAME_POWER = 1 << 9,  ///< Radio supports setting per-frame transmit power.
     OT_RADIO_CAPS_ALT_SHORT_ADDR       = 1 << 10, ///< Radio supports setting alternate short address.
+    OT_RADIO_CAPS_RETX_IE_UPDATE       = 1 << 11, ///< Radio updates time-dependent header IEs (CSL IE) on each retry.
 };
 
 #define OT_PANID_BROADCAST 0xffff ///< IEEE 802.15.4 Broadcast PAN ID
@@ -946,6 +948,13 @@ otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *aInstance);
  *    - Sleep if RX is off when the device is idle and OT_RADIO_CAPS_SLEEP_TO_TX is supported.
  * 2. Transmits the psdu on the given channel and at the given transmit power.
  *
+ * When the platform provides both `OT_RADIO_CAPS_TRANSMIT_RETRIES` and `OT_RADIO_CAPS_RETX_IE_UPDATE` capabilities,
+ * OpenThread may request a non-zero `mMaxFrameRetries` for frames containing time-dependent header IEs (e.g., frames
+ * with the CSL IE present, indicated by `mCslPresent`). The platform is then expected to refresh the content of such
+ * IEs (and redo security processing when it provides `OT_RADIO_CAPS_TRANSMIT_SEC`) before each retransmission attempt,
+ * keeping the retry loop entirely within the radio. Platforms that cannot update the IEs per attempt must not claim
+ * `OT_RADIO_CAPS_RETX_IE_UPDATE`; such frames are then requested with zero retries.
+ *
  * @param[in] aInstance  The OpenThread instance structure.
  * @param[in] aFrame     A pointer to the frame to be transmitted.
  *
@@ -1042,6 +1051,22 @@ extern void otPlatRadioEnergyScanDone(otInstance *aInstance, int8_t aEnergyScanM
  */
 extern void otPlatRadioBusLatencyChanged(otInstance *aInstance);
 
+/**
+ * The radio driver calls this function to report the durations spent in each radio state, as measured by the radio
+ * hardware or co-processor.
+ *
+ * Each call reports the durations accumulated since the previous call. Once the first report is received, OpenThread
+ * stops inferring the radio state durations from host-side state transitions and accounts radio time exclusively
+ * from the reported samples. This allows accurate duty-cycle accounting when the radio performs offloaded retries or
+ * CSL sampling that the host cannot observe.
+ *
+ * Is only used when `OPENTHREAD_CONFIG_RADIO_STATS_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance   The OpenThread instance structure.
+ * @param[in]  aDurations  The durations (in microseconds) spent in each radio state since the previous report.
+ */
+extern void otPlatRadioTimeStatsSample(otInstance *aInstance, const otRadioTimeStats *aDurations);
+
 /**
  * Enable/Disable source address match feature.
  *
@@ -1119,6 +1144,64 @@ void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance);
  */
 void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance);
 
+/**
+ * Set the short addresses in the source address match table, replacing all existing short address entries.
+ *
+ * This is a batched alternative to `otPlatRadioAddSrcMatchShortEntry()`, allowing the full table to be reconciled in
+ * a single platform call (e.g., one transaction towards an RCP). A default (weak) implementation which clears the
+ * table and adds the entries one by one is provided; platforms where per-call overhead is significant can override it.
+ *
+ * @param[in]  aInstance        The OpenThread instance structure.
+ * @param[in]  aShortAddresses  A pointer to an array of short addresses (MUST NOT be NULL if @p aNumEntries is
+ *                              non-zero).
+ * @param[in]  aNumEntries      Number of entries in @p aShortAddresses.
+ *
+ * @retval OT_ERROR_NONE      Successfully set the short address entries in the source match table.
+ * @retval OT_ERROR_NO_BUFS   Not enough entries available in the source match table.
+ */
+otError otPlatRadioSetSrcMatchShortEntries(otInstance           *aInstance,
+                                           const otShortAddress *aShortAddresses,
+                                           uint16_t              aNumEntries);
+
+/**
+ * Set the extended addresses in the source address match table, replacing all existing extended address entries.
+ *
+ * This is a batched alternative to `otPlatRadioAddSrcMatchExtEntry()`, allowing the full table to be reconciled in
+ * a single platform call (e.g., one transaction towards an RCP). A default (weak) implementation which clears the
+ * table and adds the entries one by one is provided; platforms where per-call overhead is significant can override it.
+ *
+ * @param[in]  aInstance      The OpenThread instance structure.
+ * @param[in]  aExtAddresses  A pointer to an array of extended addresses stored in little-endian byte order (MUST NOT
+ *                            be NULL if @p aNumEntries is non-zero).
+ * @param[in]  aNumEntries    Number of entries in @p aExtAddresses.
+ *
+ * @retval OT_ERROR_NONE      Successfully set the extended address entries in the source match table.
+ * @retval OT_ERROR_NO_BUFS   Not enough entries available in the source match table.
+ */
+otError otPlatRadioSetSrcMatchExtEntries(otInstance *aInstance, const otExtAddress *aExtAddresses, uint16_t aNumEntries);
+
+/**
+ * Set the source match pending filter, a compact bitmap the radio consults while source matching is disabled.
+ *
+ * While source matching is disabled (typically because the source match table overflowed), the radio normally sets
+ * the "frame pending" bit on acks to all data poll frames, waking every sleepy child. The pending filter narrows
+ * this down: the radio computes a bit index for the data poll's source address as the sum of the address bytes
+ * modulo the number of bits in the filter (`8 * aLength`) and sets the "frame pending" bit only when that bit is set
+ * in the filter. Hash collisions can produce false positives (an unnecessary wake-up) but never false negatives.
+ * The byte-sum hash is insensitive to byte order and applies equally to short and extended source addresses.
+ *
+ * A zero @p aLength removes the filter, restoring the default behavior of setting the "frame pending" bit on all
+ * acks while source matching is disabled. The filter has no effect while source matching is enabled.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ * @param[in]  aFilter    A pointer to the filter bitmap (MUST NOT be NULL if @p aLength is non-zero).
+ * @param[in]  aLength    The filter length in bytes, or zero to remove the filter.
+ *
+ * @retval OT_ERROR_NONE             Successfully set the source match pending filter.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The radio does not support the source match pending filter.
+ */
+otError otPlatRadioSetSrcMatchPendingFilter(otInstance *aInstance, const uint8_t *aFilter, uint16_t aLength);
+
 /**
  * Get the radio supported channel mask that the device is allowed to be on.
  *
@@ -1374,6 +1457,41 @@ otError otPlatRadioAddCalibratedPower(otInstance    *aInstance,
                                       const uint8_t *aRawPowerSetting,
                                       uint16_t       aRawPowerSettingLength);
 
+/**
+ * Represents a calibrated power entry for bulk loading of the power calibration table.
+ */
+typedef struct otCalibratedPowerEntry
+{
+    const uint8_t *mRawPowerSetting;       ///< A pointer to the raw power setting byte array.
+    uint16_t       mRawPowerSettingLength; ///< The length of the raw power setting byte array.
+    int16_t        mActualPower;           ///< The actual power in 0.01dBm.
+} otCalibratedPowerEntry;
+
+/**
+ * Set all calibrated powers of the specified channel in the power calibration table.
+ *
+ * @note This API is an optional radio platform API. It's up to the platform layer to implement it.
+ *
+ * This function replaces all calibrated powers previously added for @p aChannel in a single call, which avoids the
+ * repeated per-entry processing of `otPlatRadioAddCalibratedPower()` when loading a factory calibration table.
+ * See `otPlatRadioAddCalibratedPower()` for the definition of the actual power and the raw power setting.
+ *
+ * @param[in] aInstance     The OpenThread instance structure.
+ * @param[in] aChannel      The radio channel.
+ * @param[in] aEntries      A pointer to an array of calibrated power entries.
+ * @param[in] aNumEntries   The number of entries in @p aEntries.
+ *
+ * @retval OT_ERROR_NONE             Successfully set the calibrated powers of the channel.
+ * @retval OT_ERROR_NO_BUFS          @p aNumEntries exceeds the size of the power calibration table.
+ * @retval OT_ERROR_INVALID_ARGS     The @p aChannel or an entry in @p aEntries is invalid, or two entries share the
+ *                                   same actual power.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  This feature is not implemented.
+ */
+otError otPlatRadioSetCalibratedPowers(otInstance                   *aInstance,
+                                       uint8_t                       aChannel,
+                                       const otCalibratedPowerEntry *aEntries,
+                                       uint16_t                      aNumEntries);
+
 /**
  * Clear all calibrated powers from the power calibration table.
  *
@@ -1415,7 +1533,8 @@ otError otPlatRadioSetChannelTargetPower(otInstance *aInstance, uint8_t aChannel
  * Get the raw power setting for the given channel.
  *
  * @note OpenThread `src/core/utils` implements a default implementation of the API `otPlatRadioAddCalibratedPower()`,
- *       `otPlatRadioClearCalibratedPowers()` and `otPlatRadioSetChannelTargetPower()`. This API is provided by
+ *       `otPlatRadioSetCalibratedPowers()`, `otPlatRadioClearCalibratedPowers()` and
+ *       `otPlatRadioSetChannelTargetPower()`. This API is provided by
  *       the default implementation to get the raw power setting for the given channel. If the platform doesn't
  *       use the default implementation, it can ignore this API.
  *
@@ -0,0 +1,76 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the abstraction for the platform telemetry stream.
+ */
+
+#ifndef OPENTHREAD_PLATFORM_TELEMETRY_H_
+#define OPENTHREAD_PLATFORM_TELEMETRY_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup plat-telemetry
+ *
+ * @brief
+ *   This module includes the platform abstraction for the telemetry stream.
+ *
+ * @{
+ */
+
+/**
+ * Emits a telemetry event to the platform stream.
+ *
+ * This platform API is used when the telemetry emitter (`OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE`) is enabled.
+ * Events are compact binary records intended to be stored or streamed as-is and decoded off-device. Each record
+ * starts with a one-byte event type followed by a four-byte little-endian millisecond timestamp and an event
+ * specific payload.
+ *
+ * The platform can drop events (e.g., when the stream back-pressures); the emitter makes no delivery guarantee.
+ *
+ * @param[in]  aData    A pointer to the binary event record.
+ * @param[in]  aLength  The length (number of bytes) of the event record.
+ */
+void otPlatTelemetryEmit(const uint8_t *aData, uint16_t aLength);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_PLATFORM_TELEMETRY_H_
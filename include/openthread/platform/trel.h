@@ -195,6 +195,41 @@ void otPlatTrelSend(otInstance       *aInstance,
                     uint16_t          aUdpPayloadLen,
                     const otSockAddr *aDestSockAddr);
 
+/**
+ * Represents one TREL UDP packet in a batch send request (`otPlatTrelSendBatch()`).
+ *
+ * The UDP payload of the packet is given as two segments, header and payload. This allows OpenThread core to share
+ * a common payload buffer among all packets in a batch (e.g., during broadcast fan-out to multiple peers where only
+ * the header bytes differ per destination). The platform implementation can map the two segments directly to
+ * scatter/gather I/O (e.g., `iovec` entries with `sendmmsg()`) without merging them into one buffer.
+ */
+typedef struct otPlatTrelPacketInfo
+{
+    const uint8_t    *mHeader;        ///< Pointer to the header segment bytes.
+    uint16_t          mHeaderLength;  ///< The header segment length (number of bytes).
+    const uint8_t    *mPayload;       ///< Pointer to the payload segment bytes (can be NULL when length is zero).
+    uint16_t          mPayloadLength; ///< The payload segment length (number of bytes).
+    const otSockAddr *mDestSockAddr;  ///< The destination socket address.
+} otPlatTrelPacketInfo;
+
+/**
+ * Requests a batch of TREL UDP packets to be sent, each to its own given destination.
+ *
+ * This function is used for TREL fan-out and forwarding bursts, allowing the platform to map the entire batch to a
+ * single syscall (e.g., `sendmmsg()` on Linux) instead of one send operation per packet.
+ *
+ * This function is optional. OpenThread core provides a weak default implementation which sends the packets one by
+ * one using `otPlatTrelSend()`. Platforms capable of batched send can override it.
+ *
+ * The @p aPackets array and all the buffers referenced by its entries are not persisted after the return from this
+ * function. The platform layer MUST NOT keep the pointers and instead copy the content if needed.
+ *
+ * @param[in] aInstance     The OpenThread instance structure.
+ * @param[in] aPackets      A pointer to an array of packets to send.
+ * @param[in] aNumPackets   The number of entries in the @p aPackets array.
+ */
+void otPlatTrelSendBatch(otInstance *aInstance, const otPlatTrelPacketInfo *aPackets, uint16_t aNumPackets);
+
 /**
  * Is a callback from platform to notify of a received TREL UDP packet.
  *
@@ -142,6 +142,20 @@ typedef struct otSrpServerResponseCounters
     uint32_t mOther;         ///< The number of other responses.
 } otSrpServerResponseCounters;
 
+/**
+ * Includes the statistics of SRP server lease churn.
+ *
+ * The counters track how many registrations have been removed due to lease or key lease expiry,
+ * which can be used to estimate the registration turnover rate on the server.
+ */
+typedef struct otSrpServerLeaseCounters
+{
+    uint32_t mHostLeaseExpirations;       ///< Number of host lease expirations (host removed, name retained).
+    uint32_t mHostKeyLeaseExpirations;    ///< Number of host key lease expirations (host fully removed).
+    uint32_t mServiceLeaseExpirations;    ///< Number of service lease expirations (service removed, name retained).
+    uint32_t mServiceKeyLeaseExpirations; ///< Number of service key lease expirations (service fully removed).
+} otSrpServerLeaseCounters;
+
 /**
  * Returns the domain authorized to the SRP server.
  *
@@ -456,6 +470,15 @@ const otSrpServerHost *otSrpServerGetNextHost(otInstance *aInstance, const otSrp
  */
 const otSrpServerResponseCounters *otSrpServerGetResponseCounters(otInstance *aInstance);
 
+/**
+ * Returns the lease counters of the SRP server.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns  A pointer to the lease counters of the SRP server.
+ */
+const otSrpServerLeaseCounters *otSrpServerGetLeaseCounters(otInstance *aInstance);
+
 /**
  * Tells if the SRP service host has been deleted.
  *
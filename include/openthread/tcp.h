@@ -222,8 +222,8 @@ typedef void (*otTcpDisconnected)(otTcpEndpoint *aEndpoint, otTcpDisconnectedRea
  * opaque in its declaration, is treated as struct tcpcb in the TCP
  * implementation.
  */
-#define OT_TCP_ENDPOINT_TCB_SIZE_BASE 392
-#define OT_TCP_ENDPOINT_TCB_NUM_PTR 36
+#define OT_TCP_ENDPOINT_TCB_SIZE_BASE 408
+#define OT_TCP_ENDPOINT_TCB_NUM_PTR 38
 
 /**
  * Represents a TCP endpoint.
@@ -276,6 +276,17 @@ typedef struct otTcpEndpointInitializeArgs
 
     void  *mReceiveBuffer;     ///< Pointer to memory provided to the system for the TCP receive buffer
     size_t mReceiveBufferSize; ///< Size of memory provided to the system for the TCP receive buffer
+
+    /**
+     * Whether to use the zero-copy receive mode for this endpoint.
+     *
+     * In this mode, in-order received segments are retained in their original
+     * message buffers instead of being copied into the receive buffer, and the
+     * application reads them in place using otTcpReceiveChunksByReference().
+     * Requires `OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE`; ignored
+     * otherwise.
+     */
+    bool mReceiveZeroCopy;
 } otTcpEndpointInitializeArgs;
 
 /**
@@ -467,8 +478,9 @@ otError otTcpSendByExtension(otTcpEndpoint *aEndpoint, size_t aNumBytes, uint32_
  *                         data.
  * @param[out]  aBuffer    A pointer to the linked buffer chain referencing data currently in the receive buffer.
  *
- * @retval OT_ERROR_NONE    Successfully completed the operation.
- * @retval OT_ERROR_FAILED  Failed to complete the operation.
+ * @retval OT_ERROR_NONE           Successfully completed the operation.
+ * @retval OT_ERROR_FAILED         Failed to complete the operation.
+ * @retval OT_ERROR_INVALID_STATE  The endpoint uses the zero-copy receive mode.
  */
 otError otTcpReceiveByReference(otTcpEndpoint *aEndpoint, const otLinkedBuffer **aBuffer);
 
@@ -483,8 +495,9 @@ otError otTcpReceiveByReference(otTcpEndpoint *aEndpoint, const otLinkedBuffer *
  *
  * @param[in]   aEndpoint  A pointer to the TCP endpoint whose receive buffer to reorganize.
  *
- * @retval OT_ERROR_NONE    Successfully completed the operation.
- * @retval OT_ERROR_FAILED  Failed to complete the operation.
+ * @retval OT_ERROR_NONE           Successfully completed the operation.
+ * @retval OT_ERROR_FAILED         Failed to complete the operation.
+ * @retval OT_ERROR_INVALID_STATE  The endpoint uses the zero-copy receive mode.
  */
 otError otTcpReceiveContiguify(otTcpEndpoint *aEndpoint);
 
@@ -503,6 +516,30 @@ otError otTcpReceiveContiguify(otTcpEndpoint *aEndpoint);
  */
 otError otTcpCommitReceive(otTcpEndpoint *aEndpoint, size_t aNumBytes, uint32_t aFlags);
 
+/**
+ * Provides the application with linked buffers referencing received data in
+ * place, for an endpoint using the zero-copy receive mode.
+ *
+ * Fills at most @p aNumLinks entries of @p aLinks, chained together via their
+ * mNext fields, each referencing one contiguous chunk of received data in the
+ * retained message buffers. The references are valid until the "receive ready"
+ * callback is next invoked, or until the next call to otTcpCommitReceive().
+ *
+ * Requires `OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE` and an endpoint
+ * initialized with `mReceiveZeroCopy` set; for other endpoints, data should be
+ * read using otTcpReceiveByReference() instead.
+ *
+ * @param[in]   aEndpoint  A pointer to the TCP endpoint structure representing the TCP endpoint on which to receive
+ *                         data.
+ * @param[in]   aLinks     A pointer to an array of linked buffers to fill.
+ * @param[in]   aNumLinks  The number of entries in the @p aLinks array.
+ * @param[out]  aNumUsed   A pointer to where to store the number of entries that were filled.
+ *
+ * @retval OT_ERROR_NONE           Successfully completed the operation.
+ * @retval OT_ERROR_INVALID_STATE  The endpoint does not use the zero-copy receive mode.
+ */
+otError otTcpReceiveChunksByReference(otTcpEndpoint *aEndpoint, otLinkedBuffer *aLinks, size_t aNumLinks, size_t *aNumUsed);
+
 /**
  * Informs the connection peer that this TCP endpoint will not send more data.
  *
@@ -559,6 +596,33 @@ otError otTcpAbort(otTcpEndpoint *aEndpoint);
  */
 otError otTcpEndpointDeinitialize(otTcpEndpoint *aEndpoint);
 
+/**
+ * Contains a snapshot of a TCP endpoint's transport-level state, for
+ * instrumentation and diagnostics.
+ */
+typedef struct otTcpEndpointInfo
+{
+    uint32_t mCongestionWindow;   ///< Congestion window (bytes).
+    uint32_t mSlowStartThreshold; ///< Slow-start threshold (bytes).
+    uint32_t mSmoothedRtt;        ///< Smoothed round-trip time estimate (milliseconds).
+    uint32_t mRttVariance;        ///< Round-trip time variance (milliseconds).
+    uint32_t mRetransmitCount;    ///< Number of retransmission events (timeouts and fast retransmits).
+    uint32_t mZeroWindowEvents;   ///< Number of times the peer's receive window closed to zero.
+} otTcpEndpointInfo;
+
+/**
+ * Obtains a snapshot of a TCP endpoint's transport-level state.
+ *
+ * The counters accumulate over the lifetime of the TCP endpoint; they are
+ * reset when the TCP endpoint is initialized.
+ *
+ * @param[in]   aEndpoint  A pointer to the TCP endpoint structure whose state to obtain.
+ * @param[out]  aInfo      A pointer to the structure to populate.
+ *
+ * @retval OT_ERROR_NONE  Successfully obtained the TCP endpoint info.
+ */
+otError otTcpGetInfo(otTcpEndpoint *aEndpoint, otTcpEndpointInfo *aInfo);
+
 typedef struct otTcpListener otTcpListener;
 
 /**
@@ -163,10 +163,11 @@ typedef struct
  */
 typedef struct otIpCounters
 {
-    uint32_t mTxSuccess; ///< The number of IPv6 packets successfully transmitted.
-    uint32_t mRxSuccess; ///< The number of IPv6 packets successfully received.
-    uint32_t mTxFailure; ///< The number of IPv6 packets failed to transmit.
-    uint32_t mRxFailure; ///< The number of IPv6 packets failed to receive.
+    uint32_t mTxSuccess;           ///< The number of IPv6 packets successfully transmitted.
+    uint32_t mRxSuccess;           ///< The number of IPv6 packets successfully received.
+    uint32_t mTxFailure;           ///< The number of IPv6 packets failed to transmit.
+    uint32_t mRxFailure;           ///< The number of IPv6 packets failed to receive.
+    uint32_t mRxReassemblyFailure; ///< The number of IPv6 packets dropped during 6LoWPAN reassembly.
 } otIpCounters;
 
 /**
@@ -199,6 +200,18 @@ typedef struct otMleCounters
      * OPENTHREAD_CONFIG_PARENT_SEARCH_ENABLE).
      */
     uint16_t mParentChanges;
+
+    /**
+     * Number of received MLE Advertisements whose route digestion was deferred past the per-slice processing
+     * budget (used only on FTDs acting as router or leader).
+     */
+    uint16_t mDeferredAdvertisements;
+
+    /**
+     * Number of deferred MLE Advertisements superseded by a newer advertisement from the same router before
+     * being digested (used only on FTDs acting as router or leader).
+     */
+    uint16_t mCoalescedAdvertisements;
 } otMleCounters;
 
 /**
@@ -869,6 +882,34 @@ const otIpCounters *otThreadGetIp6Counters(otInstance *aInstance);
  */
 void otThreadResetIp6Counters(otInstance *aInstance);
 
+/**
+ * Gets the maximum transmit burst length used by the fairness scheduling of direct transmissions.
+ *
+ * Requires `OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE`.
+ *
+ * See `otThreadSetTxFairnessMaxBurst()` for how the value is used.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns The maximum burst length (number of frames). Zero indicates fairness scheduling is disabled.
+ */
+uint8_t otThreadGetTxFairnessMaxBurst(otInstance *aInstance);
+
+/**
+ * Sets the maximum transmit burst length used by the fairness scheduling of direct transmissions.
+ *
+ * Requires `OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE`.
+ *
+ * After @p aMaxBurst consecutive frames to the same MAC destination, the device prefers a queued message of the same
+ * priority for a different destination (when one exists) before continuing with the current destination. This
+ * prevents one busy destination (e.g., a chatty child) from monopolizing airtime within a priority level. Higher
+ * priority messages (e.g., MLE and TMF traffic) are always served first, independent of this setting.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aMaxBurst  The maximum burst length (number of frames). Zero disables fairness scheduling.
+ */
+void otThreadSetTxFairnessMaxBurst(otInstance *aInstance, uint8_t aMaxBurst);
+
 /**
  * Gets the time-in-queue histogram for messages in the TX queue.
  *
@@ -923,6 +964,55 @@ uint32_t otThreadGetMaxTimeInQueue(otInstance *aInstance);
  */
 void otThreadResetTimeInQueueStat(otInstance *aInstance);
 
+/**
+ * Gets the histogram of observed gaps between successive 6LoWPAN fragment arrivals.
+ *
+ * Requires `OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE`.
+ *
+ * For every datagram under 6LoWPAN reassembly, the gap between successive fragment arrivals is measured. The
+ * collected gaps drive the adaptive reassembly timeout and are aggregated into a histogram.
+ *
+ * The histogram is returned as an array of `uint32_t` values with `aNumBins` entries. The first entry in the array
+ * (at index 0) represents the number of gaps shorter than `aBinInterval`. The second entry represents the number of
+ * gaps greater than or equal to `aBinInterval`, but less than `2 * aBinInterval`. And so on. The last entry
+ * represents the number of gaps greater than or equal to `(aNumBins - 1) * aBinInterval`.
+ *
+ * The collected statistics can be reset by calling `otThreadResetReassemblyGapStat()`. The histogram information is
+ * collected since the OpenThread instance was initialized or since the last time statistics collection was reset by
+ * calling the `otThreadResetReassemblyGapStat()`.
+ *
+ * Pointers @p aNumBins and @p aBinInterval MUST NOT be NULL.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[out] aNumBins       Pointer to return the number of bins in histogram (array length).
+ * @param[out] aBinInterval   Pointer to return the histogram bin interval length in milliseconds.
+ *
+ * @returns A pointer to an array of @p aNumBins entries representing the collected histogram info.
+ */
+const uint32_t *otThreadGetReassemblyGapHistogram(otInstance *aInstance, uint16_t *aNumBins, uint32_t *aBinInterval);
+
+/**
+ * Gets the maximum observed gap between successive 6LoWPAN fragment arrivals.
+ *
+ * Requires `OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE`.
+ *
+ * The collected statistics can be reset by calling `otThreadResetReassemblyGapStat()`.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ *
+ * @returns The maximum observed inter-fragment gap in milliseconds (so far).
+ */
+uint32_t otThreadGetMaxReassemblyGap(otInstance *aInstance);
+
+/**
+ * Resets the 6LoWPAN reassembly inter-fragment gap statistics.
+ *
+ * Requires `OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE`.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ */
+void otThreadResetReassemblyGapStat(otInstance *aInstance);
+
 /**
  * Gets the Thread MLE counters.
  *
@@ -1030,7 +1120,12 @@ typedef void (*otThreadAnycastLocatorCallback)(void               *aContext,
  *
  * Is only available when `OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_ENABLE` is enabled.
  *
- * If a previous request is ongoing, a subsequent call to this function will cancel and replace the earlier request.
+ * Up to `OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_MAX_QUERIES` requests (for distinct anycast addresses) can be in
+ * progress in parallel. If a previous request for the same anycast address is ongoing, or if all query entries are
+ * in use, a subsequent call to this function will cancel and replace an earlier request.
+ *
+ * A result learned from an earlier response may be reported from a cached ALOC to RLOC16 binding (without sending a
+ * new query) as long as the Network Data version has not changed since the binding was learned.
  *
  * @param[in] aInstance         A pointer to an OpenThread instance.
  * @param[in] aAnycastAddress   The anycast address to locate. MUST NOT be NULL.
@@ -1159,6 +1254,11 @@ uint32_t otThreadGetStoreFrameCounterAhead(otInstance *aInstance);
  * During the wake-up sequence, and for a short time after the last wake-up frame is sent, the Wake-up Coordinator keeps
  * its receiver on to be able to receive an initial mesh link establishment message from the WED.
  *
+ * When `OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MULTI_TARGET_ENABLE` is enabled, this function may be called again while
+ * a wake-up is already in progress to add another Wake-up End Device to the ongoing wake-up sequence. Wake-up frames
+ * for all targets are then interleaved within the same sequence window, and the wake-up interval and duration of the
+ * ongoing sequence are retained.
+ *
  * @warning The functionality implemented by this function is still in the design phase.
  *          Consequently, the prototype and semantics of this function are subject to change.
  *
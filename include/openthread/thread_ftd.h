@@ -125,6 +125,17 @@ typedef struct otCacheEntryIterator
     const void *mData[2]; ///< Opaque data used by the core implementation. Should not be changed by user.
 } otCacheEntryIterator;
 
+/**
+ * Represents the number of EID cache table entries in each state.
+ */
+typedef struct otCacheEntryStats
+{
+    uint16_t mNumCachedEntries;     ///< Number of entries in cached (in-use) state.
+    uint16_t mNumSnoopedEntries;    ///< Number of entries created by snoop optimization.
+    uint16_t mNumQueryEntries;      ///< Number of entries with an ongoing address query.
+    uint16_t mNumRetryQueryEntries; ///< Number of entries in query retry wait mode.
+} otCacheEntryStats;
+
 /**
  * Gets the maximum number of children currently allowed.
  *
@@ -627,6 +638,14 @@ otError otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRouterId, otRoute
  */
 otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntryInfo, otCacheEntryIterator *aIterator);
 
+/**
+ * Gets the number of EID cache table entries in each state.
+ *
+ * @param[in]   aInstance   A pointer to an OpenThread instance.
+ * @param[out]  aStats      A pointer to an `otCacheEntryStats` to populate with the per-state entry counts.
+ */
+void otThreadGetEidCacheStats(otInstance *aInstance, otCacheEntryStats *aStats);
+
 /**
  * Get the Thread PSKc
  *
@@ -794,6 +813,41 @@ typedef void (*otNeighborTableCallback)(otNeighborTableEvent aEvent, const otNei
  */
 void otThreadRegisterNeighborTableCallback(otInstance *aInstance, otNeighborTableCallback aCallback);
 
+/**
+ * Number of last-heard age buckets in `otNeighborTableStats`.
+ */
+#define OT_NEIGHBOR_TABLE_AGE_BUCKETS 8
+
+/**
+ * Width of each last-heard age bucket in `otNeighborTableStats` (in seconds).
+ */
+#define OT_NEIGHBOR_TABLE_AGE_BUCKET_WIDTH 16
+
+/**
+ * Represents statistics about the neighbor table (children and router neighbors).
+ */
+typedef struct otNeighborTableStats
+{
+    uint16_t mNumChildren;        ///< Number of children (in valid or restoring states).
+    uint16_t mNumRouterNeighbors; ///< Number of neighboring routers (in valid state).
+
+    /**
+     * Distribution of neighbors by last-heard age.
+     *
+     * Bucket `i` counts neighbors last heard between `i * OT_NEIGHBOR_TABLE_AGE_BUCKET_WIDTH` (inclusive) and
+     * `(i + 1) * OT_NEIGHBOR_TABLE_AGE_BUCKET_WIDTH` (exclusive) seconds ago. The last bucket is open-ended.
+     */
+    uint16_t mAgeBuckets[OT_NEIGHBOR_TABLE_AGE_BUCKETS];
+} otNeighborTableStats;
+
+/**
+ * Gets statistics about the neighbor table, including the distribution of neighbors by last-heard age.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[out]  aStats     A pointer to an `otNeighborTableStats` to populate.
+ */
+void otThreadGetNeighborTableStats(otInstance *aInstance, otNeighborTableStats *aStats);
+
 /**
  * Sets whether the device was commissioned using CCM.
  *
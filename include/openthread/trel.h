@@ -59,14 +59,26 @@ extern "C" {
  * @{
  */
 
+/**
+ * Represents a group of per-peer TREL counters.
+ */
+typedef struct otTrelPeerCounters
+{
+    uint64_t mTxPackets; ///< Number of packets sent to the peer.
+    uint64_t mTxBytes;   ///< Sum of size (number of bytes) of all packets sent to the peer.
+    uint64_t mRxPackets; ///< Number of packets received from the peer.
+    uint64_t mRxBytes;   ///< Sum of size (number of bytes) of all packets received from the peer.
+} otTrelPeerCounters;
+
 /**
  * Represents a TREL peer.
  */
 typedef struct otTrelPeer
 {
-    otExtAddress    mExtAddress; ///< The Extended MAC Address of TREL peer.
-    otExtendedPanId mExtPanId;   ///< The Extended PAN Identifier of TREL peer.
-    otSockAddr      mSockAddr;   ///< The IPv6 socket address of TREL peer.
+    otExtAddress       mExtAddress; ///< The Extended MAC Address of TREL peer.
+    otExtendedPanId    mExtPanId;   ///< The Extended PAN Identifier of TREL peer.
+    otSockAddr         mSockAddr;   ///< The IPv6 socket address of TREL peer.
+    otTrelPeerCounters mCounters;   ///< The per-peer TX/RX counters.
 } otTrelPeer;
 
 /**
@@ -146,13 +146,15 @@ typedef enum otNetifIdentifier
  */
 typedef struct otUdpSocket
 {
-    otSockAddr          mSockName; ///< The local IPv6 socket address.
-    otSockAddr          mPeerName; ///< The peer IPv6 socket address.
-    otUdpReceive        mHandler;  ///< A function pointer to the application callback.
-    void               *mContext;  ///< A pointer to application-specific context.
-    void               *mHandle;   ///< A handle to platform's UDP.
-    struct otUdpSocket *mNext;     ///< A pointer to the next UDP socket (internal use only).
-    otNetifIdentifier   mNetifId;  ///< The network interface identifier.
+    otSockAddr          mSockName;    ///< The local IPv6 socket address.
+    otSockAddr          mPeerName;    ///< The peer IPv6 socket address.
+    otUdpReceive        mHandler;     ///< A function pointer to the application callback.
+    void               *mContext;     ///< A pointer to application-specific context.
+    void               *mHandle;      ///< A handle to platform's UDP.
+    struct otUdpSocket *mNext;        ///< A pointer to the next UDP socket (internal use only).
+    otNetifIdentifier   mNetifId;     ///< The network interface identifier.
+    uint32_t            mRxCount;     ///< Number of received datagrams delivered to this socket.
+    uint32_t            mRxDropCount; ///< Number of datagrams matching this socket's port but not delivered to it.
 } otUdpSocket;
 
 /**
@@ -192,6 +192,12 @@ void Interpreter::OutputResult(otError aError)
     mTimer.Stop();
     OutputPrompt();
 
+    // The prompt has no trailing newline, so when the command completed
+    // asynchronously (outside `ProcessLine()`) it would otherwise stay
+    // in the output buffer.
+
+    Flush();
+
 exit:
     return;
 }
@@ -307,6 +313,13 @@ void Interpreter::ProcessLine(char *aLine)
 
     OT_ASSERT(aLine != nullptr);
 
+    // Hold any buffered output while the command is being processed so
+    // that the full command output (including the result line) can be
+    // delivered to the output callback in a single chunk (under
+    // `OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE`).
+
+    SetHoldingOutput(true);
+
     args[0].Clear();
 
     // Validate and parse the input command line. The `error` is
@@ -374,6 +387,9 @@ exit:
     {
         OutputResult(error);
     }
+
+    Flush();
+    SetHoldingOutput(false);
 }
 
 otError Interpreter::ProcessUserCommands(Arg aArgs[])
@@ -1171,14 +1187,14 @@ exit:
  * total: 40
  * free: 40
  * max-used: 5
- * 6lo send: 0 0 0
- * 6lo reas: 0 0 0
- * ip6: 0 0 0
- * mpl: 0 0 0
- * mle: 0 0 0
- * coap: 0 0 0
- * coap secure: 0 0 0
- * application coap: 0 0 0
+ * 6lo send: 0 0 0 0
+ * 6lo reas: 0 0 0 0
+ * ip6: 0 0 0 0
+ * mpl: 0 0 0 0
+ * mle: 0 0 0 0
+ * coap: 0 0 0 0
+ * coap secure: 0 0 0 0
+ * application coap: 0 0 0 0
  * Done
  * @endcode
  * @par
@@ -1193,6 +1209,8 @@ exit:
  * *   The first number shows number messages in the queue.
  * *   The second number shows number of buffers used by all messages in the queue.
  * *   The third number shows total number of bytes of all messages in the queue.
+ * *   The fourth number shows the queue-depth watermark (max number of messages in the
+ *     queue at the same time since OT stack initialization or last `bufferinfo reset`).
  * @sa otMessageGetBufferInfo
  */
 template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
@@ -1228,8 +1246,9 @@ template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
 
         for (const BufferInfoName &info : kBufferInfoNames)
         {
-            OutputLine("%s: %u %u %lu", info.mName, (bufferInfo.*info.mQueuePtr).mNumMessages,
-                       (bufferInfo.*info.mQueuePtr).mNumBuffers, ToUlong((bufferInfo.*info.mQueuePtr).mTotalBytes));
+            OutputLine("%s: %u %u %lu %u", info.mName, (bufferInfo.*info.mQueuePtr).mNumMessages,
+                       (bufferInfo.*info.mQueuePtr).mNumBuffers, ToUlong((bufferInfo.*info.mQueuePtr).mTotalBytes),
+                       (bufferInfo.*info.mQueuePtr).mMaxNumMessages);
         }
     }
     /**
@@ -2528,6 +2547,7 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
      * TxFailed: 0
      * RxSuccess: 5
      * RxFailed: 0
+     * RxReassemblyFailed: 0
      * Done
      * @endcode
      * @cparam counters @ca{ip}
@@ -2549,6 +2569,7 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
                 {&otIpCounters::mTxFailure, "TxFailed"},
                 {&otIpCounters::mRxSuccess, "RxSuccess"},
                 {&otIpCounters::mRxFailure, "RxFailed"},
+                {&otIpCounters::mRxReassemblyFailure, "RxReassemblyFailed"},
             };
 
             const otIpCounters *ipCounters = otThreadGetIp6Counters(GetInstancePtr());
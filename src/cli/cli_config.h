@@ -164,6 +164,21 @@
 #define OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_LOG_STRING_SIZE OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE
+ *
+ * The CLI output buffer size (in bytes). Define as zero to disable output buffering.
+ *
+ * When non-zero, the CLI accumulates its output in a buffer and delivers it to the output callback in larger chunks
+ * instead of invoking the callback once per `OutputFormat()` call. Output emitted while a command is being processed
+ * is flushed when the command completes (after the result line). Output emitted outside of command processing (e.g.,
+ * asynchronous command responses or logs) is flushed at the end of every completed line. The buffer is also flushed
+ * whenever it fills up.
+ */
+#ifndef OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_CLI_PROMPT_ENABLE
  *
@@ -39,6 +39,8 @@
 
 #include "cli/cli.hpp"
 #include "common/encoding.hpp"
+#include "common/num_utils.hpp"
+#include "common/numeric_limits.hpp"
 
 namespace ot {
 namespace Cli {
@@ -46,8 +48,24 @@ namespace Cli {
 UdpExample::UdpExample(otInstance *aInstance, OutputImplementer &aOutputImplementer)
     : Utils(aInstance, aOutputImplementer)
     , mLinkSecurityEnabled(true)
+    , mBenchState(kBenchIdle)
+    , mBenchSize(0)
+    , mBenchInterval(0)
+    , mBenchNumProbes(0)
+    , mBenchTxCount(0)
+    , mBenchRxCount(0)
+    , mBenchHighestSeq(0)
+    , mBenchOutOfOrder(0)
+    , mBenchRttSum(0)
+    , mBenchRttMin(0)
+    , mBenchRttMax(0)
+    , mBenchJitter(0)
+    , mBenchLastRtt(0)
+    , mBenchHasLastRtt(false)
+    , mBenchTimer(AsCoreType(aInstance), HandleBenchTimer, this)
 {
     ClearAllBytes(mSocket);
+    ClearAllBytes(mBenchPeer);
 }
 
 /**
@@ -174,6 +192,12 @@ template <> otError UdpExample::Process<Cmd("close")>(Arg aArgs[])
 {
     OT_UNUSED_VARIABLE(aArgs);
 
+    if ((mBenchState == kBenchSending) || (mBenchState == kBenchWaiting))
+    {
+        mBenchTimer.Stop();
+        mBenchState = kBenchDone;
+    }
+
     return otUdpClose(GetInstancePtr(), &mSocket);
 }
 
@@ -377,6 +401,351 @@ template <> otError UdpExample::Process<Cmd("linksecurity")>(Arg aArgs[])
     return error;
 }
 
+template <> otError UdpExample::Process<Cmd("bench")>(Arg aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+
+    /**
+     * @cli udp bench start
+     * @code
+     * udp bench start fdde:ad00:beef:0:bb1:ebd6:ad10:f33 1234 50 64 10
+     * Done
+     * @endcode
+     * @cparam udp bench start @ca{ip} @ca{port} @ca{rate} @ca{size} @ca{duration}
+     * - `ip`: Destination IPv6 address of the peer device.
+     * - `port`: UDP destination port. The peer must have its UDP socket open (`udp open`) and bound
+     *   (`udp bind`) to this port; any such device echoes the probes automatically.
+     * - `rate`: Probe packet rate in packets per second (1-1000).
+     * - `size`: Probe packet size in bytes (16-1024).
+     * - `duration`: Session duration in seconds (1-3600).
+     * @par
+     * Starts an on-device UDP benchmark session. Probe packets carrying a sequence number and
+     * timestamp are generated in-stack at the given rate and echoed back by the peer. Loss, RTT,
+     * and jitter statistics are collected and printed when the session completes.
+     * @csa{udp bench stop}
+     * @csa{udp bench result}
+     */
+    if (aArgs[0] == "start")
+    {
+        error = ProcessBenchStart(aArgs + 1);
+    }
+    /**
+     * @cli udp bench stop
+     * @code
+     * udp bench stop
+     * UDP Bench: sent 120, received 118, lost 2 (1.6%), out-of-order 0
+     * UDP Bench: RTT min/avg/max 14/27/89 ms, jitter 6 ms
+     * Done
+     * @endcode
+     * @par
+     * Stops an ongoing benchmark session and prints the results collected so far.
+     */
+    else if (aArgs[0] == "stop")
+    {
+        VerifyOrExit((mBenchState == kBenchSending) || (mBenchState == kBenchWaiting),
+                     error = OT_ERROR_INVALID_STATE);
+        FinishBench();
+    }
+    /**
+     * @cli udp bench result
+     * @code
+     * udp bench result
+     * UDP Bench Status: Completed
+     * UDP Bench: sent 500, received 500, lost 0 (0.0%), out-of-order 1
+     * UDP Bench: RTT min/avg/max 12/24/102 ms, jitter 5 ms
+     * Done
+     * @endcode
+     * @par
+     * Shows the status and latest results of the UDP benchmark. Possible status values are
+     * `Ongoing`, `Completed`, and `Untested`.
+     */
+    else if (aArgs[0] == "result")
+    {
+        OutputFormat("UDP Bench Status: ");
+
+        switch (mBenchState)
+        {
+        case kBenchSending:
+        case kBenchWaiting:
+            OutputLine("Ongoing");
+            break;
+        case kBenchDone:
+            OutputLine("Completed");
+            OutputBenchResults();
+            break;
+        case kBenchIdle:
+            OutputLine("Untested");
+            break;
+        }
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    return error;
+}
+
+otError UdpExample::ProcessBenchStart(Arg aArgs[])
+{
+    otError  error;
+    uint16_t rate;
+    uint16_t size;
+    uint16_t duration;
+    bool     nat64Synth;
+
+    VerifyOrExit(otUdpIsOpen(GetInstancePtr(), &mSocket), error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit((mBenchState != kBenchSending) && (mBenchState != kBenchWaiting), error = OT_ERROR_BUSY);
+
+    ClearAllBytes(mBenchPeer);
+
+    SuccessOrExit(error = ParseToIp6Address(GetInstancePtr(), aArgs[0], mBenchPeer.mPeerAddr, nat64Synth));
+
+    if (nat64Synth)
+    {
+        OutputFormat("Sending to synthesized IPv6 address: ");
+        OutputIp6AddressLine(mBenchPeer.mPeerAddr);
+    }
+
+    SuccessOrExit(error = aArgs[1].ParseAsUint16(mBenchPeer.mPeerPort));
+    SuccessOrExit(error = aArgs[2].ParseAsUint16(rate));
+    SuccessOrExit(error = aArgs[3].ParseAsUint16(size));
+    SuccessOrExit(error = aArgs[4].ParseAsUint16(duration));
+    VerifyOrExit(aArgs[5].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+
+    VerifyOrExit((rate >= 1) && (rate <= kBenchMaxRate), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit((size >= kBenchHeaderSize) && (size <= kBenchMaxSize), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit((duration >= 1) && (duration <= kBenchMaxDuration), error = OT_ERROR_INVALID_ARGS);
+
+    mBenchSize       = size;
+    mBenchInterval   = 1000 / rate;
+    mBenchNumProbes  = static_cast<uint32_t>(rate) * duration;
+    mBenchTxCount    = 0;
+    mBenchRxCount    = 0;
+    mBenchHighestSeq = 0;
+    mBenchOutOfOrder = 0;
+    mBenchRttSum     = 0;
+    mBenchRttMin     = NumericLimits<uint32_t>::kMax;
+    mBenchRttMax     = 0;
+    mBenchJitter     = 0;
+    mBenchLastRtt    = 0;
+    mBenchHasLastRtt = false;
+
+    mBenchState        = kBenchSending;
+    mBenchNextSendTime = TimerMilli::GetNow();
+
+    BenchSendProbes();
+
+exit:
+    return error;
+}
+
+void UdpExample::BenchSendProbes(void)
+{
+    TimeMilli now = TimerMilli::GetNow();
+
+    while ((mBenchState == kBenchSending) && (now >= mBenchNextSendTime))
+    {
+        // A probe that fails to send locally (e.g., out of buffers) is
+        // still counted as sent, so it shows up as lost in the results.
+
+        IgnoreError(SendBenchProbe());
+        mBenchTxCount++;
+        mBenchNextSendTime += mBenchInterval;
+
+        if (mBenchTxCount == mBenchNumProbes)
+        {
+            mBenchState = kBenchWaiting;
+            mBenchTimer.Start(kBenchWaitTimeout);
+            ExitNow();
+        }
+    }
+
+    mBenchTimer.FireAt(mBenchNextSendTime);
+
+exit:
+    return;
+}
+
+otError UdpExample::SendBenchProbe(void)
+{
+    otError           error;
+    otMessage        *message     = nullptr;
+    otMessageInfo     messageInfo = mBenchPeer;
+    otMessageSettings messageSettings = {mLinkSecurityEnabled, OT_MESSAGE_PRIORITY_NORMAL};
+    uint8_t           header[kBenchHeaderSize];
+
+    message = otUdpNewMessage(GetInstancePtr(), &messageSettings);
+    VerifyOrExit(message != nullptr, error = OT_ERROR_NO_BUFS);
+
+    ClearAllBytes(header);
+    BigEndian::WriteUint32(kBenchMagic, &header[0]);
+    header[kBenchTypeOffset] = kBenchTypeProbe;
+    BigEndian::WriteUint32(mBenchTxCount, &header[kBenchSeqOffset]);
+    BigEndian::WriteUint32(TimerMilli::GetNow().GetValue(), &header[kBenchTimestampOffset]);
+
+    SuccessOrExit(error = otMessageAppend(message, header, sizeof(header)));
+    SuccessOrExit(error = PrepareAutoGeneratedPayload(*message, mBenchSize - kBenchHeaderSize));
+    SuccessOrExit(error = otUdpSend(GetInstancePtr(), &mSocket, message, &messageInfo));
+
+    message = nullptr;
+
+exit:
+    if (message != nullptr)
+    {
+        otMessageFree(message);
+    }
+
+    return error;
+}
+
+bool UdpExample::HandleBenchPacket(const uint8_t *aBuf, uint16_t aLength, const otMessageInfo *aMessageInfo)
+{
+    bool handled = false;
+
+    VerifyOrExit(aLength >= kBenchHeaderSize);
+    VerifyOrExit(BigEndian::ReadUint32(&aBuf[0]) == kBenchMagic);
+
+    handled = true;
+
+    switch (aBuf[kBenchTypeOffset])
+    {
+    case kBenchTypeProbe:
+        SendBenchReply(aBuf, aLength, aMessageInfo);
+        break;
+    case kBenchTypeReply:
+        RecordBenchReply(aBuf);
+        break;
+    default:
+        break;
+    }
+
+exit:
+    return handled;
+}
+
+void UdpExample::SendBenchReply(const uint8_t *aBuf, uint16_t aLength, const otMessageInfo *aMessageInfo)
+{
+    otError           error;
+    otMessage        *message = nullptr;
+    otMessageInfo     messageInfo;
+    otMessageSettings messageSettings = {mLinkSecurityEnabled, OT_MESSAGE_PRIORITY_NORMAL};
+    uint8_t           header[kBenchHeaderSize];
+
+    ClearAllBytes(messageInfo);
+    messageInfo.mPeerAddr = aMessageInfo->mPeerAddr;
+    messageInfo.mPeerPort = aMessageInfo->mPeerPort;
+
+    // Echo the probe back unchanged except for the type byte, so the
+    // initiator can derive the RTT from its own timestamp.
+
+    memcpy(header, aBuf, kBenchHeaderSize);
+    header[kBenchTypeOffset] = kBenchTypeReply;
+
+    message = otUdpNewMessage(GetInstancePtr(), &messageSettings);
+    VerifyOrExit(message != nullptr, error = OT_ERROR_NO_BUFS);
+
+    SuccessOrExit(error = otMessageAppend(message, header, kBenchHeaderSize));
+    SuccessOrExit(error = otMessageAppend(message, aBuf + kBenchHeaderSize, aLength - kBenchHeaderSize));
+    SuccessOrExit(error = otUdpSend(GetInstancePtr(), &mSocket, message, &messageInfo));
+
+    message = nullptr;
+
+exit:
+    if (message != nullptr)
+    {
+        otMessageFree(message);
+    }
+}
+
+void UdpExample::RecordBenchReply(const uint8_t *aBuf)
+{
+    uint32_t seq;
+    uint32_t rtt;
+
+    VerifyOrExit((mBenchState == kBenchSending) || (mBenchState == kBenchWaiting));
+
+    seq = BigEndian::ReadUint32(&aBuf[kBenchSeqOffset]);
+    rtt = TimerMilli::GetNow().GetValue() - BigEndian::ReadUint32(&aBuf[kBenchTimestampOffset]);
+
+    if ((mBenchRxCount != 0) && (seq <= mBenchHighestSeq))
+    {
+        mBenchOutOfOrder++;
+    }
+
+    mBenchHighestSeq = Max(mBenchHighestSeq, seq);
+
+    mBenchRxCount++;
+    mBenchRttSum += rtt;
+    mBenchRttMin = Min(mBenchRttMin, rtt);
+    mBenchRttMax = Max(mBenchRttMax, rtt);
+
+    if (mBenchHasLastRtt)
+    {
+        uint32_t delta = (rtt > mBenchLastRtt) ? (rtt - mBenchLastRtt) : (mBenchLastRtt - rtt);
+
+        // RFC 3550 inter-arrival jitter estimator (`mBenchJitter` is
+        // kept scaled by 16 to retain precision).
+
+        mBenchJitter += delta - ((mBenchJitter + 8) >> 4);
+    }
+
+    mBenchLastRtt    = rtt;
+    mBenchHasLastRtt = true;
+
+    if ((mBenchState == kBenchWaiting) && (mBenchRxCount >= mBenchTxCount))
+    {
+        FinishBench();
+    }
+
+exit:
+    return;
+}
+
+void UdpExample::FinishBench(void)
+{
+    mBenchTimer.Stop();
+    mBenchState = kBenchDone;
+    OutputBenchResults();
+}
+
+void UdpExample::OutputBenchResults(void)
+{
+    uint32_t lost        = mBenchTxCount - mBenchRxCount;
+    uint32_t lossPermill = (mBenchTxCount != 0) ? (lost * 1000 / mBenchTxCount) : 0;
+
+    OutputLine("UDP Bench: sent %lu, received %lu, lost %lu (%u.%u%%), out-of-order %lu", ToUlong(mBenchTxCount),
+               ToUlong(mBenchRxCount), ToUlong(lost), static_cast<uint16_t>(lossPermill / 10),
+               static_cast<uint16_t>(lossPermill % 10), ToUlong(mBenchOutOfOrder));
+
+    if (mBenchRxCount != 0)
+    {
+        OutputLine("UDP Bench: RTT min/avg/max %lu/%lu/%lu ms, jitter %lu ms", ToUlong(mBenchRttMin),
+                   ToUlong(mBenchRttSum / mBenchRxCount), ToUlong(mBenchRttMax), ToUlong(mBenchJitter >> 4));
+    }
+}
+
+void UdpExample::HandleBenchTimer(Timer &aTimer)
+{
+    static_cast<UdpExample *>(static_cast<TimerMilliContext &>(aTimer).GetContext())->HandleBenchTimer();
+}
+
+void UdpExample::HandleBenchTimer(void)
+{
+    switch (mBenchState)
+    {
+    case kBenchSending:
+        BenchSendProbes();
+        break;
+    case kBenchWaiting:
+        FinishBench();
+        break;
+    default:
+        break;
+    }
+}
+
 otError UdpExample::PrepareAutoGeneratedPayload(otMessage &aMessage, uint16_t aPayloadLength)
 {
     otError error     = OT_ERROR_NONE;
@@ -436,8 +805,9 @@ otError UdpExample::Process(Arg aArgs[])
 #define CmdEntry(aCommandString) {aCommandString, &UdpExample::Process<Cmd(aCommandString)>}
 
     static constexpr Command kCommands[] = {
-        CmdEntry("bind"),         CmdEntry("close"), CmdEntry("connect"),
-        CmdEntry("linksecurity"), CmdEntry("open"),  CmdEntry("send"),
+        CmdEntry("bench"),   CmdEntry("bind"),         CmdEntry("close"),
+        CmdEntry("connect"), CmdEntry("linksecurity"), CmdEntry("open"),
+        CmdEntry("send"),
     };
 
     static_assert(BinarySearch::IsSorted(kCommands), "kCommands is not sorted");
@@ -470,14 +840,23 @@ void UdpExample::HandleUdpReceive(otMessage *aMessage, const otMessageInfo *aMes
     char buf[1500];
     int  length;
 
+    length      = otMessageRead(aMessage, otMessageGetOffset(aMessage), buf, sizeof(buf) - 1);
+    buf[length] = '\0';
+
+    // Benchmark packets are echoed or recorded silently (printing each
+    // one would throttle the CLI at benchmark rates).
+
+    VerifyOrExit(
+        !HandleBenchPacket(reinterpret_cast<const uint8_t *>(buf), static_cast<uint16_t>(length), aMessageInfo));
+
     OutputFormat("%d bytes from ", otMessageGetLength(aMessage) - otMessageGetOffset(aMessage));
     OutputIp6Address(aMessageInfo->mPeerAddr);
     OutputFormat(" %d ", aMessageInfo->mPeerPort);
 
-    length      = otMessageRead(aMessage, otMessageGetOffset(aMessage), buf, sizeof(buf) - 1);
-    buf[length] = '\0';
-
     OutputLine("%s", buf);
+
+exit:
+    return;
 }
 
 } // namespace Cli
@@ -39,6 +39,8 @@
 #include <openthread/udp.h>
 
 #include "cli/cli_utils.hpp"
+#include "common/time.hpp"
+#include "common/timer.hpp"
 
 namespace ot {
 namespace Cli {
@@ -73,6 +75,39 @@ public:
 private:
     using Command = CommandEntry<UdpExample>;
 
+    // Benchmark probe packet wire format (big-endian):
+    //
+    //   Bytes 0-3  : Magic (`kBenchMagic`).
+    //   Byte  4    : Type (probe or reply).
+    //   Bytes 5-7  : Reserved (zero).
+    //   Bytes 8-11 : Sequence number.
+    //   Bytes 12-15: Sender timestamp (msec, truncated to 32-bit).
+    //
+    // A responder echoes a probe back unchanged except for the type
+    // byte, so the initiator can derive RTT from its own timestamp.
+
+    static constexpr uint16_t kBenchHeaderSize      = 16;
+    static constexpr uint16_t kBenchTypeOffset      = 4;
+    static constexpr uint16_t kBenchSeqOffset       = 8;
+    static constexpr uint16_t kBenchTimestampOffset = 12;
+
+    static constexpr uint8_t kBenchTypeProbe = 0;
+    static constexpr uint8_t kBenchTypeReply = 1;
+
+    static constexpr uint32_t kBenchMagic       = 0x6f745542; // "otUB"
+    static constexpr uint16_t kBenchMaxSize     = 1024;       // Max probe packet size (bytes).
+    static constexpr uint16_t kBenchMaxRate     = 1000;       // Max probe rate (packets per second).
+    static constexpr uint16_t kBenchMaxDuration = 3600;       // Max session duration (seconds).
+    static constexpr uint32_t kBenchWaitTimeout = 2000;       // Wait for trailing replies (msec).
+
+    enum BenchState : uint8_t
+    {
+        kBenchIdle,    // No benchmark session was run.
+        kBenchSending, // Actively generating probe packets.
+        kBenchWaiting, // All probes sent, waiting for trailing replies.
+        kBenchDone,    // Results from the last session are available.
+    };
+
     template <CommandId kCommandId> otError Process(Arg aArgs[]);
 
     static otError PrepareAutoGeneratedPayload(otMessage &aMessage, uint16_t aPayloadLength);
@@ -81,8 +116,39 @@ private:
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleUdpReceive(otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+    otError ProcessBenchStart(Arg aArgs[]);
+    void    BenchSendProbes(void);
+    otError SendBenchProbe(void);
+    bool    HandleBenchPacket(const uint8_t *aBuf, uint16_t aLength, const otMessageInfo *aMessageInfo);
+    void    SendBenchReply(const uint8_t *aBuf, uint16_t aLength, const otMessageInfo *aMessageInfo);
+    void    RecordBenchReply(const uint8_t *aBuf);
+    void    FinishBench(void);
+    void    OutputBenchResults(void);
+
+    static void HandleBenchTimer(Timer &aTimer);
+    void        HandleBenchTimer(void);
+
     bool        mLinkSecurityEnabled;
     otUdpSocket mSocket;
+
+    BenchState    mBenchState;
+    otMessageInfo mBenchPeer;
+    uint16_t      mBenchSize;       // Probe packet size (bytes).
+    uint32_t      mBenchInterval;   // Time between probes (msec).
+    uint32_t      mBenchNumProbes;  // Total number of probes to send.
+    uint32_t      mBenchTxCount;
+    uint32_t      mBenchRxCount;
+    uint32_t      mBenchHighestSeq; // Highest reply sequence number seen.
+    uint32_t      mBenchOutOfOrder; // Replies received out of order (or duplicated).
+    uint32_t      mBenchRttSum;     // Sum of reply RTTs (msec).
+    uint32_t      mBenchRttMin;
+    uint32_t      mBenchRttMax;
+    uint32_t      mBenchJitter; // RFC 3550 inter-arrival jitter estimate, scaled by 16 (msec).
+    uint32_t      mBenchLastRtt;
+    bool          mBenchHasLastRtt;
+    TimeMilli     mBenchNextSendTime;
+
+    TimerMilliContext mBenchTimer;
 };
 
 } // namespace Cli
@@ -53,6 +53,10 @@ const char Utils::kUnknownString[] = "unknown";
 OutputImplementer::OutputImplementer(otCliOutputCallback aCallback, void *aCallbackContext)
     : mCallback(aCallback)
     , mCallbackContext(aCallbackContext)
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    , mTxLength(0)
+    , mHoldingOutput(false)
+#endif
 #if OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_ENABLE
     , mOutputLength(0)
     , mEmittingCommandOutput(true)
@@ -319,29 +323,34 @@ void OutputImplementer::OutputV(const char *aFormat, va_list aArguments)
 {
 #if OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_ENABLE
     va_list args;
-    int     charsWritten;
     bool    truncated = false;
 
     va_copy(args, aArguments);
 #endif
 
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    BufferV(aFormat, aArguments);
+#else
     mCallback(mCallbackContext, aFormat, aArguments);
+#endif
 
 #if OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_ENABLE
     VerifyOrExit(mEmittingCommandOutput);
 
-    charsWritten = vsnprintf(&mOutputString[mOutputLength], sizeof(mOutputString) - mOutputLength, aFormat, args);
+    {
+        StringWriter writer(&mOutputString[mOutputLength], sizeof(mOutputString) - mOutputLength);
 
-    VerifyOrExit(charsWritten >= 0, mOutputLength = 0);
+        writer.AppendVarArgs(aFormat, args);
 
-    if (static_cast<uint32_t>(charsWritten) >= sizeof(mOutputString) - mOutputLength)
-    {
-        truncated     = true;
-        mOutputLength = sizeof(mOutputString) - 1;
-    }
-    else
-    {
-        mOutputLength += charsWritten;
+        if (writer.IsTruncated())
+        {
+            truncated     = true;
+            mOutputLength = sizeof(mOutputString) - 1;
+        }
+        else
+        {
+            mOutputLength += writer.GetLength();
+        }
     }
 
     while (true)
@@ -407,6 +416,81 @@ exit:
 #endif // OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_ENABLE
 }
 
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+
+void OutputImplementer::BufferV(const char *aFormat, va_list aArguments)
+{
+    va_list  args;
+    uint16_t charsWritten;
+    bool     truncated;
+
+    va_copy(args, aArguments);
+
+    {
+        StringWriter writer(&mTxBuffer[mTxLength], static_cast<uint16_t>(sizeof(mTxBuffer) - mTxLength));
+
+        writer.AppendVarArgs(aFormat, args);
+        charsWritten = writer.GetLength();
+        truncated    = writer.IsTruncated();
+    }
+
+    va_end(args);
+
+    if (truncated)
+    {
+        // The new output does not fit in the remaining buffer space.
+        // Deliver what is already buffered (which discards the
+        // truncated partial write above) and retry. An output larger
+        // than the entire buffer is passed through directly.
+
+        Flush();
+
+        if (charsWritten >= sizeof(mTxBuffer))
+        {
+            mCallback(mCallbackContext, aFormat, aArguments);
+            ExitNow();
+        }
+
+        StringWriter writer(mTxBuffer, sizeof(mTxBuffer));
+
+        writer.AppendVarArgs(aFormat, aArguments);
+        charsWritten = writer.GetLength();
+    }
+
+    mTxLength += charsWritten;
+
+    if (!mHoldingOutput && (mTxLength > 0) && (mTxBuffer[mTxLength - 1] == '\n'))
+    {
+        Flush();
+    }
+
+exit:
+    return;
+}
+
+void OutputImplementer::Flush(void)
+{
+    VerifyOrExit(mTxLength > 0);
+
+    mTxBuffer[mTxLength] = '\0';
+    mTxLength            = 0;
+    Deliver("%s", mTxBuffer);
+
+exit:
+    return;
+}
+
+void OutputImplementer::Deliver(const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    mCallback(mCallbackContext, aFormat, args);
+    va_end(args);
+}
+
+#endif // OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+
 #if OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_ENABLE
 void Utils::LogInput(const Arg *aArgs)
 {
@@ -96,13 +96,42 @@ public:
     void SetEmittingCommandOutput(bool) {}
 #endif
 
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    /**
+     * Delivers any buffered output to the output callback.
+     */
+    void Flush(void);
+
+    /**
+     * Sets whether the buffered output is held until `Flush()` is called (or the buffer fills up).
+     *
+     * When not holding, the buffer is flushed whenever the buffered output ends with a newline.
+     *
+     * @param[in] aHold  TRUE to hold the buffered output, FALSE otherwise.
+     */
+    void SetHoldingOutput(bool aHold) { mHoldingOutput = aHold; }
+#else
+    void Flush(void) {}
+    void SetHoldingOutput(bool) {}
+#endif
+
 private:
     static constexpr uint16_t kInputOutputLogStringSize = OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_LOG_STRING_SIZE;
 
     void OutputV(const char *aFormat, va_list aArguments) OT_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(2, 0);
 
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    void BufferV(const char *aFormat, va_list aArguments) OT_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(2, 0);
+    void Deliver(const char *aFormat, ...) OT_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(2, 3);
+#endif
+
     otCliOutputCallback mCallback;
     void               *mCallbackContext;
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    char     mTxBuffer[OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE];
+    uint16_t mTxLength;
+    bool     mHoldingOutput;
+#endif
 #if OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_ENABLE
     char     mOutputString[kInputOutputLogStringSize];
     uint16_t mOutputLength;
@@ -326,6 +326,20 @@ void otBorderRoutingDhcp6PdSetRequestCallback(otInstance
 
 #endif
 
+#if OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE
+
+otError otBorderRoutingGetPrefixCounters(otInstance                            *aInstance,
+                                         otBorderRoutingPrefixCountersIterator *aIterator,
+                                         otBorderRoutingPrefixCounters         *aCounters)
+{
+    AssertPointerIsNotNull(aIterator);
+    AssertPointerIsNotNull(aCounters);
+
+    return AsCoreType(aInstance).Get<Ip6::Ip6>().GetNextBrPrefixCounters(*aIterator, *aCounters);
+}
+
+#endif
+
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_TESTING_API_ENABLE
 
 void otBorderRoutingSetOnLinkPrefix(otInstance *aInstance, const otIp6Prefix *aPrefix)
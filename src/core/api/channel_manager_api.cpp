@@ -45,6 +45,11 @@ void otChannelManagerRequestChannelChange(otInstance *aInstance, uint8_t aChanne
 {
     AsCoreType(aInstance).Get<Utils::ChannelManager>().RequestNetworkChannelChange(aChannel);
 }
+
+void otChannelManagerRequestFastChannelChange(otInstance *aInstance, uint8_t aChannel)
+{
+    AsCoreType(aInstance).Get<Utils::ChannelManager>().RequestFastNetworkChannelChange(aChannel);
+}
 #endif
 
 uint8_t otChannelManagerGetRequestedChannel(otInstance *aInstance)
@@ -275,6 +275,22 @@ otError otCoapSendRequest(otInstance           *aInstance,
     return otCoapSendRequestWithParameters(aInstance, aMessage, aMessageInfo, aHandler, aContext, nullptr);
 }
 
+otError otCoapSendCopy(otInstance           *aInstance,
+                       const otMessage      *aMessage,
+                       const otMessageInfo  *aMessageInfo,
+                       const otCoapToken    *aToken,
+                       otCoapResponseHandler aHandler,
+                       void                 *aContext)
+{
+    return AsCoreType(aInstance).Get<Coap::ApplicationCoap>().SendCopyWithResponseHandlerSeparateParams(
+        AsCoapMessage(aMessage), AsCoreType(aMessageInfo), AsCoreTypePtr(aToken), aHandler, aContext);
+}
+
+uint16_t otCoapGetPendingRequestCount(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Coap::ApplicationCoap>().GetPendingRequestCount();
+}
+
 otError otCoapStart(otInstance *aInstance, uint16_t aPort)
 {
     return AsCoreType(aInstance).Get<Coap::ApplicationCoap>().Start(aPort);
@@ -87,6 +87,11 @@ const otDnsQueryConfig *otDnsClientGetDefaultConfig(otInstance *aInstance)
     return &AsCoreType(aInstance).Get<Dns::Client>().GetDefaultConfig();
 }
 
+const otDnsClientCounters *otDnsClientGetCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<Dns::Client>().GetCounters();
+}
+
 void otDnsClientSetDefaultConfig(otInstance *aInstance, const otDnsQueryConfig *aConfig)
 {
     if (aConfig != nullptr)
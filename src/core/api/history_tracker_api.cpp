@@ -90,6 +90,43 @@ const otHistoryTrackerMessageInfo *otHistoryTrackerIterateTxHistory(otInstance
     return AsCoreType(aInstance).Get<HistoryTracker::Local>().IterateTxHistory(AsCoreType(aIterator), *aEntryAge);
 }
 
+uint16_t otHistoryTrackerExportRxHistory(otInstance                  *aInstance,
+                                         otHistoryTrackerIterator    *aIterator,
+                                         otHistoryTrackerMessageInfo *aEntries,
+                                         uint32_t                    *aEntryAges,
+                                         uint16_t                     aMaxEntries)
+{
+    AssertPointerIsNotNull(aEntries);
+    AssertPointerIsNotNull(aEntryAges);
+
+    return AsCoreType(aInstance).Get<HistoryTracker::Local>().ExportRxHistory(AsCoreType(aIterator), aEntries,
+                                                                              aEntryAges, aMaxEntries);
+}
+
+uint16_t otHistoryTrackerExportTxHistory(otInstance                  *aInstance,
+                                         otHistoryTrackerIterator    *aIterator,
+                                         otHistoryTrackerMessageInfo *aEntries,
+                                         uint32_t                    *aEntryAges,
+                                         uint16_t                     aMaxEntries)
+{
+    AssertPointerIsNotNull(aEntries);
+    AssertPointerIsNotNull(aEntryAges);
+
+    return AsCoreType(aInstance).Get<HistoryTracker::Local>().ExportTxHistory(AsCoreType(aIterator), aEntries,
+                                                                              aEntryAges, aMaxEntries);
+}
+
+const otHistoryTrackerBufferPressureInfo *otHistoryTrackerIterateBufferPressureHistory(
+    otInstance               *aInstance,
+    otHistoryTrackerIterator *aIterator,
+    uint32_t                 *aEntryAge)
+{
+    AssertPointerIsNotNull(aEntryAge);
+
+    return AsCoreType(aInstance).Get<HistoryTracker::Local>().IterateBufferPressureHistory(AsCoreType(aIterator),
+                                                                                           *aEntryAge);
+}
+
 const otHistoryTrackerNeighborInfo *otHistoryTrackerIterateNeighborHistory(otInstance               *aInstance,
                                                                            otHistoryTrackerIterator *aIterator,
                                                                            uint32_t                 *aEntryAge)
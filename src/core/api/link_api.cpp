@@ -418,6 +418,15 @@ uint16_t otLinkGetCcaFailureRate(otInstance *aInstance)
     return AsCoreType(aInstance).Get<Mac::Mac>().GetCcaFailureRate();
 }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+otError otLinkGetAdaptiveCcaState(otInstance *aInstance, uint8_t aChannel, otLinkAdaptiveCcaState *aState)
+{
+    AssertPointerIsNotNull(aState);
+
+    return AsCoreType(aInstance).Get<Mac::SubMac>().GetAdaptiveCcaState(aChannel, *aState);
+}
+#endif
+
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
 bool otLinkIsCslEnabled(otInstance *aInstance) { return AsCoreType(aInstance).Get<Mac::Mac>().IsCslEnabled(); }
 
@@ -120,6 +120,22 @@ otError otLinkMetricsManagerGetMetricsValueByExtAddr(otInstance          *aInsta
 exit:
     return error;
 }
+
+otError otLinkMetricsManagerGetNextMetricsValue(otInstance          *aInstance,
+                                                uint16_t            *aIterator,
+                                                otExtAddress        *aExtAddress,
+                                                otLinkMetricsValues *aLinkMetricsValues)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aIterator != nullptr && aExtAddress != nullptr && aLinkMetricsValues != nullptr,
+                 error = OT_ERROR_INVALID_ARGS);
+
+    error = AsCoreType(aInstance).Get<Utils::LinkMetricsManager>().GetNextMetricsValue(
+        *aIterator, AsCoreType(aExtAddress), AsCoreType(aLinkMetricsValues));
+exit:
+    return error;
+}
 #endif
 
 #endif // OPENTHREAD_CONFIG_MLE_LINK_METRICS_INITIATOR_ENABLE
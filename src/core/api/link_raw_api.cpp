@@ -199,6 +199,19 @@ exit:
     return error;
 }
 
+otError otLinkRawSrcMatchSetPendingFilter(otInstance *aInstance, const uint8_t *aFilter, uint16_t aLength)
+{
+    Error     error    = kErrorNone;
+    Instance &instance = AsCoreType(aInstance);
+
+    VerifyOrExit(instance.Get<Mac::LinkRaw>().IsEnabled(), error = kErrorInvalidState);
+
+    error = instance.Get<Radio>().SetSrcMatchPendingFilter(aFilter, aLength);
+
+exit:
+    return error;
+}
+
 otError otLinkRawSetMacKey(otInstance     *aInstance,
                            uint8_t         aKeyIdMode,
                            uint8_t         aKeyId,
@@ -73,6 +73,11 @@ void otMdnsSetConflictCallback(otInstance *aInstance, otMdnsConflictCallback aCa
     AsCoreType(aInstance).Get<Dns::Multicast::Core>().SetConflictCallback(aCallback);
 }
 
+uint32_t otMdnsGetProbeConflictCount(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Dns::Multicast::Core>().GetProbeConflictCount();
+}
+
 const char *otMdnsGetLocalHostName(otInstance *aInstance)
 {
     return AsCoreType(aInstance).Get<Dns::Multicast::Core>().GetLocalHostName();
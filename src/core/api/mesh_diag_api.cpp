@@ -84,6 +84,13 @@ otError otMeshDiagQueryRouterNeighborTable(otInstance
     return AsCoreType(aInstance).Get<Utils::MeshDiag>().QueryRouterNeighborTable(aRloc16, aCallback, aContext);
 }
 
+void otMeshDiagSetQueriesDoneCallback(otInstance                   *aInstance,
+                                      otMeshDiagQueriesDoneCallback aCallback,
+                                      void                         *aContext)
+{
+    AsCoreType(aInstance).Get<Utils::MeshDiag>().SetQueriesDoneCallback(aCallback, aContext);
+}
+
 void otMeshDiagSetResponseTimeout(otInstance *aInstance, uint32_t aTimeout)
 {
     AsCoreType(aInstance).Get<Utils::MeshDiag>().SetResponseTimeout(aTimeout);
@@ -163,4 +163,76 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
 }
 
 void otMessageResetBufferInfo(otInstance *aInstance) { AsCoreType(aInstance).ResetBufferInfo(); }
+
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+
+void otMessageGetMemOwnerStats(otInstance *aInstance, otMemOwnerStats *aStats)
+{
+    // The first `otMemOwner` entries MUST align with `Message::Type`
+    // (message allocations are attributed based on their type).
+
+    struct MemOwnerChecker
+    {
+        InitEnumValidatorCounter();
+        ValidateNextEnum(OT_MEM_OWNER_IP6);
+        ValidateNextEnum(OT_MEM_OWNER_6LOWPAN);
+        ValidateNextEnum(OT_MEM_OWNER_SUPERVISION);
+        ValidateNextEnum(OT_MEM_OWNER_MAC);
+        ValidateNextEnum(OT_MEM_OWNER_IP4);
+        ValidateNextEnum(OT_MEM_OWNER_BLE);
+        ValidateNextEnum(OT_MEM_OWNER_OTHER);
+        ValidateNextEnum(OT_MEM_OWNER_DNS);
+        ValidateNextEnum(OT_MEM_OWNER_SRP);
+        ValidateNextEnum(OT_MEM_OWNER_MESHCOP);
+        ValidateNextEnum(OT_MEM_OWNER_TREL);
+        ValidateNextEnum(OT_MEM_OWNER_BORDER_ROUTING);
+    };
+
+    static_assert(OT_MEM_OWNER_IP6 == static_cast<int>(Message::kTypeIp6), "OT_MEM_OWNER_IP6 value is incorrect");
+    static_assert(OT_MEM_OWNER_6LOWPAN == static_cast<int>(Message::kType6lowpan),
+                  "OT_MEM_OWNER_6LOWPAN value is incorrect");
+    static_assert(OT_MEM_OWNER_SUPERVISION == static_cast<int>(Message::kTypeSupervision),
+                  "OT_MEM_OWNER_SUPERVISION value is incorrect");
+    static_assert(OT_MEM_OWNER_MAC == static_cast<int>(Message::kTypeMacEmptyData),
+                  "OT_MEM_OWNER_MAC value is incorrect");
+    static_assert(OT_MEM_OWNER_IP4 == static_cast<int>(Message::kTypeIp4), "OT_MEM_OWNER_IP4 value is incorrect");
+    static_assert(OT_MEM_OWNER_BLE == static_cast<int>(Message::kTypeBle), "OT_MEM_OWNER_BLE value is incorrect");
+    static_assert(OT_MEM_OWNER_OTHER == static_cast<int>(Message::kTypeOther),
+                  "OT_MEM_OWNER_OTHER value is incorrect");
+
+    struct HeapOwnerEntry
+    {
+        Heap::Owner mOwner;
+        otMemOwner  mMemOwner;
+    };
+
+    static const HeapOwnerEntry kHeapOwnerTable[] = {
+        {Heap::kOwnerOther, OT_MEM_OWNER_OTHER},     {Heap::kOwnerDns, OT_MEM_OWNER_DNS},
+        {Heap::kOwnerSrp, OT_MEM_OWNER_SRP},         {Heap::kOwnerMeshCoP, OT_MEM_OWNER_MESHCOP},
+        {Heap::kOwnerTrel, OT_MEM_OWNER_TREL},       {Heap::kOwnerBorderRouting, OT_MEM_OWNER_BORDER_ROUTING},
+    };
+
+    static_assert(OT_ARRAY_LENGTH(kHeapOwnerTable) == Heap::kNumOwners, "kHeapOwnerTable is incomplete");
+
+    MessagePool &pool = AsCoreType(aInstance).Get<MessagePool>();
+
+    memset(aStats, 0, sizeof(otMemOwnerStats) * OT_NUM_MEM_OWNERS);
+
+    for (uint8_t type = 0; type < MessagePool::kNumTypes; type++)
+    {
+        const MessagePool::TypeStats &stats = pool.GetTypeStats(static_cast<Message::Type>(type));
+
+        aStats[type].mNumMessages  = stats.mNumMessages;
+        aStats[type].mMessageBytes = stats.mNumBytes;
+    }
+
+    for (const HeapOwnerEntry &entry : kHeapOwnerTable)
+    {
+        Heap::GetOwnerStats(entry.mOwner, aStats[entry.mMemOwner].mNumHeapObjects,
+                            aStats[entry.mMemOwner].mHeapBytes);
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
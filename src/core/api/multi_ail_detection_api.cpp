@@ -67,4 +67,16 @@ void otBorderRoutingSetMultiAilCallback(otInstance                     *aInstanc
     AsCoreType(aInstance).Get<BorderRouter::MultiAilDetector>().SetCallback(aCallback, aContext);
 }
 
+otError otBorderRoutingGetMultiAilFingerprintHistoryEntry(otInstance *aInstance,
+                                                          uint16_t    aIndex,
+                                                          uint32_t   *aFingerprint,
+                                                          uint32_t   *aUptime)
+{
+    AssertPointerIsNotNull(aFingerprint);
+    AssertPointerIsNotNull(aUptime);
+
+    return AsCoreType(aInstance).Get<BorderRouter::MultiAilDetector>().GetFingerprintHistoryEntry(aIndex, *aFingerprint,
+                                                                                                  *aUptime);
+}
+
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE && OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
@@ -85,7 +85,7 @@ void otNat64GetCounters(otInstance *aInstance, otNat64ProtocolCounters *aCounter
 {
     AssertPointerIsNotNull(aCounters);
 
-    *aCounters = AsCoreType(aInstance).Get<Nat64::Translator>().GetCounters();
+    AsCoreType(aInstance).Get<Nat64::Translator>().GetCounters(AsCoreType(aCounters));
 }
 
 void otNat64GetErrorCounters(otInstance *aInstance, otNat64ErrorCounters *aCounters)
@@ -48,6 +48,19 @@ otNetworkTimeStatus otNetworkTimeGet(otInstance *aInstance, uint64_t *aNetworkTi
     return MapEnum(AsCoreType(aInstance).Get<TimeSync>().GetTime(*aNetworkTime));
 }
 
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+otNetworkTimeStatus otNetworkTimeConvertRadioTime(otInstance *aInstance,
+                                                  uint64_t    aRadioTime,
+                                                  uint64_t   *aNetworkTime,
+                                                  uint64_t   *aMaxError)
+{
+    AssertPointerIsNotNull(aNetworkTime);
+    AssertPointerIsNotNull(aMaxError);
+
+    return MapEnum(AsCoreType(aInstance).Get<TimeSync>().ConvertRadioTime(aRadioTime, *aNetworkTime, *aMaxError));
+}
+#endif
+
 otError otNetworkTimeSetSyncPeriod(otInstance *aInstance, uint16_t aTimeSyncPeriod)
 {
     Error error = kErrorNone;
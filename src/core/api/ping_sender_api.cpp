@@ -44,6 +44,11 @@ otError otPingSenderPing(otInstance *aInstance, const otPingSenderConfig *aConfi
     return AsCoreType(aInstance).Get<Utils::PingSender>().Ping(AsCoreType(aConfig));
 }
 
+otError otPingSenderStartProbing(otInstance *aInstance, const otPingSenderConfig *aConfig, uint32_t aProbePeriod)
+{
+    return AsCoreType(aInstance).Get<Utils::PingSender>().StartProbing(AsCoreType(aConfig), aProbePeriod);
+}
+
 void otPingSenderStop(otInstance *aInstance) { AsCoreType(aInstance).Get<Utils::PingSender>().Stop(); }
 
 #endif // OPENTHREAD_CONFIG_PING_SENDER_ENABLE
@@ -92,12 +92,24 @@ otError otTcpCommitReceive(otTcpEndpoint *aEndpoint, size_t aNumBytes, uint32_t
     return AsCoreType(aEndpoint).CommitReceive(aNumBytes, aFlags);
 }
 
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+otError otTcpReceiveChunksByReference(otTcpEndpoint *aEndpoint, otLinkedBuffer *aLinks, size_t aNumLinks, size_t *aNumUsed)
+{
+    return AsCoreType(aEndpoint).ReceiveChunksByReference(aLinks, aNumLinks, *aNumUsed);
+}
+#endif
+
 otError otTcpSendEndOfStream(otTcpEndpoint *aEndpoint) { return AsCoreType(aEndpoint).SendEndOfStream(); }
 
 otError otTcpAbort(otTcpEndpoint *aEndpoint) { return AsCoreType(aEndpoint).Abort(); }
 
 otError otTcpEndpointDeinitialize(otTcpEndpoint *aEndpoint) { return AsCoreType(aEndpoint).Deinitialize(); }
 
+otError otTcpGetInfo(otTcpEndpoint *aEndpoint, otTcpEndpointInfo *aInfo)
+{
+    return AsCoreType(aEndpoint).GetInfo(*aInfo);
+}
+
 otError otTcpListenerInitialize(otInstance                        *aInstance,
                                 otTcpListener                     *aListener,
                                 const otTcpListenerInitializeArgs *aArgs)
@@ -441,6 +441,18 @@ const otIpCounters *otThreadGetIp6Counters(otInstance *aInstance)
 
 void otThreadResetIp6Counters(otInstance *aInstance) { AsCoreType(aInstance).Get<MeshForwarder>().ResetCounters(); }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+uint8_t otThreadGetTxFairnessMaxBurst(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<MeshForwarder>().GetTxFairnessMaxBurst();
+}
+
+void otThreadSetTxFairnessMaxBurst(otInstance *aInstance, uint8_t aMaxBurst)
+{
+    AsCoreType(aInstance).Get<MeshForwarder>().SetTxFairnessMaxBurst(aMaxBurst);
+}
+#endif
+
 #if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
 const uint32_t *otThreadGetTimeInQueueHistogram(otInstance *aInstance, uint16_t *aNumBins, uint32_t *aBinInterval)
 {
@@ -461,6 +473,26 @@ void otThreadResetTimeInQueueStat(otInstance *aInstance)
 }
 #endif
 
+#if OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+const uint32_t *otThreadGetReassemblyGapHistogram(otInstance *aInstance, uint16_t *aNumBins, uint32_t *aBinInterval)
+{
+    AssertPointerIsNotNull(aNumBins);
+    AssertPointerIsNotNull(aBinInterval);
+
+    return AsCoreType(aInstance).Get<MeshForwarder>().GetReassemblyGapHistogram(*aNumBins, *aBinInterval);
+}
+
+uint32_t otThreadGetMaxReassemblyGap(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<MeshForwarder>().GetMaxReassemblyGap();
+}
+
+void otThreadResetReassemblyGapStat(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<MeshForwarder>().ResetReassemblyGapStat();
+}
+#endif
+
 const otMleCounters *otThreadGetMleCounters(otInstance *aInstance)
 {
     return &AsCoreType(aInstance).Get<Mle::Mle>().GetCounters();
@@ -257,6 +257,13 @@ otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntr
                                                                           AsCoreType(aIterator));
 }
 
+void otThreadGetEidCacheStats(otInstance *aInstance, otCacheEntryStats *aStats)
+{
+    AssertPointerIsNotNull(aStats);
+
+    AsCoreType(aInstance).Get<AddressResolver>().GetCacheEntryStats(*aStats);
+}
+
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
 void otThreadSetSteeringData(otInstance *aInstance, const otExtAddress *aExtAddress)
 {
@@ -320,6 +327,13 @@ void otThreadRegisterNeighborTableCallback(otInstance *aInstance, otNeighborTabl
     AsCoreType(aInstance).Get<NeighborTable>().RegisterCallback(aCallback);
 }
 
+void otThreadGetNeighborTableStats(otInstance *aInstance, otNeighborTableStats *aStats)
+{
+    AssertPointerIsNotNull(aStats);
+
+    AsCoreType(aInstance).Get<NeighborTable>().GetStats(*aStats);
+}
+
 #if OPENTHREAD_CONFIG_MLE_DISCOVERY_SCAN_REQUEST_CALLBACK_ENABLE
 void otThreadSetDiscoveryRequestCallback(otInstance                      *aInstance,
                                          otThreadDiscoveryRequestCallback aCallback,
@@ -175,6 +175,8 @@ public:
     bool IsDomainUnicast(const Ip6::Address &aAddress) const;
 
 private:
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged | kEventThreadRoleChanged;
+
     void HandleNotifierEvents(Events aEvents);
     void UpdateBackboneRouterPrimary(void);
     void UpdateDomainPrefixConfig(void);
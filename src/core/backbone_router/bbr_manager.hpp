@@ -201,6 +201,8 @@ private:
                                               uint32_t                        aTimeSinceLastTransaction);
     void  SendDuaRegistrationResponse(const Coap::Msg &aMsg, const Ip6::Address &aTarget, DuaStatus aStatus);
 #endif
+    static constexpr Events::Flags kNotifierEvents = kEventThreadBackboneRouterStateChanged;
+
     void HandleNotifierEvents(Events aEvents);
 
     void HandleTimer(void);
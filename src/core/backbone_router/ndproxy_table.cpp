@@ -140,6 +140,8 @@ void NdProxyTable::Clear(void)
         proxy.Clear();
     }
 
+    ClearBuckets();
+
     mCallback.InvokeIfSet(MapEnum(NdProxy::kCleared), nullptr);
 
     LogInfo("NdProxyTable::Clear!");
@@ -173,11 +175,23 @@ Error NdProxyTable::Register(const Ip6::InterfaceIdentifier &aAddressIid,
     {
         proxy = FindInvalid();
 
-        // TODO: evict stale DUA entries to have room for this new DUA.
-        VerifyOrExit(proxy != nullptr, error = kErrorNoBufs);
+        if (proxy == nullptr)
+        {
+            // Table is full: evict the stalest valid entry (the one
+            // with the largest time since its last transaction) to
+            // have room for this new DUA.
+
+            proxy = FindStalest();
+            VerifyOrExit(proxy != nullptr, error = kErrorNoBufs);
+
+            TriggerCallback(NdProxy::kRemoved, proxy->mAddressIid);
+            Erase(*proxy);
+        }
     }
 
+    RemoveFromBucket(*proxy);
     proxy->Init(aAddressIid, aMeshLocalIid, aRloc16, timeSinceLastTransaction);
+    AddToBucket(*proxy);
     mIsAnyDadInProcess = true;
 
 exit:
@@ -190,9 +204,11 @@ NdProxyTable::NdProxy *NdProxyTable::FindByAddressIid(const Ip6::InterfaceIdenti
 {
     NdProxy *found = nullptr;
 
-    for (NdProxy &proxy : Iterate(kFilterValid))
+    for (uint16_t index = mBuckets[BucketFor(aAddressIid)]; index != kNullIndex; index = mProxies[index].mNextInBucket)
     {
-        if (proxy.mAddressIid == aAddressIid)
+        NdProxy &proxy = mProxies[index];
+
+        if (proxy.mValid && proxy.mAddressIid == aAddressIid)
         {
             ExitNow(found = &proxy);
         }
@@ -204,6 +220,60 @@ exit:
     return found;
 }
 
+uint16_t NdProxyTable::BucketFor(const Ip6::InterfaceIdentifier &aAddressIid)
+{
+    uint8_t hash = 0;
+
+    for (uint8_t index = 0; index < Ip6::InterfaceIdentifier::kSize; index++)
+    {
+        hash ^= aAddressIid.GetBytes()[index];
+    }
+
+    return (hash & (kNumBuckets - 1));
+}
+
+void NdProxyTable::ClearBuckets(void)
+{
+    for (uint16_t &bucket : mBuckets)
+    {
+        bucket = kNullIndex;
+    }
+}
+
+void NdProxyTable::AddToBucket(NdProxy &aNdProxy)
+{
+    uint16_t bucket = BucketFor(aNdProxy.mAddressIid);
+
+    aNdProxy.mNextInBucket = mBuckets[bucket];
+    aNdProxy.mInChain      = true;
+    mBuckets[bucket]       = static_cast<uint16_t>(&aNdProxy - &mProxies[0]);
+}
+
+void NdProxyTable::RemoveFromBucket(NdProxy &aNdProxy)
+{
+    uint16_t *next;
+
+    VerifyOrExit(aNdProxy.mInChain);
+
+    next = &mBuckets[BucketFor(aNdProxy.mAddressIid)];
+
+    while (*next != kNullIndex)
+    {
+        if (&mProxies[*next] == &aNdProxy)
+        {
+            *next = aNdProxy.mNextInBucket;
+            break;
+        }
+
+        next = &mProxies[*next].mNextInBucket;
+    }
+
+    aNdProxy.mInChain = false;
+
+exit:
+    return;
+}
+
 NdProxyTable::NdProxy *NdProxyTable::FindByMeshLocalIid(const Ip6::InterfaceIdentifier &aMeshLocalIid)
 {
     NdProxy *found = nullptr;
@@ -236,6 +306,21 @@ exit:
     return found;
 }
 
+NdProxyTable::NdProxy *NdProxyTable::FindStalest(void)
+{
+    NdProxy *stalest = nullptr;
+
+    for (NdProxy &proxy : Iterate(kFilterValid))
+    {
+        if ((stalest == nullptr) || (proxy.GetTimeSinceLastTransaction() > stalest->GetTimeSinceLastTransaction()))
+        {
+            stalest = &proxy;
+        }
+    }
+
+    return stalest;
+}
+
 void NdProxyTable::HandleTimer(void)
 {
     VerifyOrExit(mIsAnyDadInProcess);
@@ -329,16 +414,16 @@ Error NdProxyTable::GetInfo(const Ip6::Address &aDua, otBackboneRouterNdProxyInf
 
     VerifyOrExit(Get<Leader>().IsDomainUnicast(aDua), error = kErrorInvalidArgs);
 
-    for (NdProxy &proxy : Iterate(kFilterValid))
     {
-        if (proxy.mAddressIid == aDua.GetIid())
-        {
-            aNdProxyInfo.mMeshLocalIid             = &proxy.mMeshLocalIid;
-            aNdProxyInfo.mTimeSinceLastTransaction = proxy.GetTimeSinceLastTransaction();
-            aNdProxyInfo.mRloc16                   = proxy.mRloc16;
+        NdProxy *proxy = FindByAddressIid(aDua.GetIid());
 
-            ExitNow(error = kErrorNone);
-        }
+        VerifyOrExit(proxy != nullptr);
+
+        aNdProxyInfo.mMeshLocalIid             = &proxy->mMeshLocalIid;
+        aNdProxyInfo.mTimeSinceLastTransaction = proxy->GetTimeSinceLastTransaction();
+        aNdProxyInfo.mRloc16                   = proxy->mRloc16;
+
+        error = kErrorNone;
     }
 
 exit:
@@ -132,9 +132,11 @@ public:
         Ip6::InterfaceIdentifier mMeshLocalIid;
         TimeMilli                mLastRegistrationTime; ///< in milliseconds
         uint16_t                 mRloc16;
+        uint16_t                 mNextInBucket; ///< Index of next proxy in the same hash bucket chain.
         uint8_t                  mDadAttempts : 2;
         bool                     mDadFlag : 1;
         bool                     mValid : 1;
+        bool                     mInChain : 1;
 
         static_assert(kDuaDadRepeats < 4, "kDuaDadRepeats does not fit in mDadAttempts field as 2-bit value");
     };
@@ -148,6 +150,7 @@ public:
         : InstanceLocator(aInstance)
         , mIsAnyDadInProcess(false)
     {
+        ClearBuckets();
     }
 
     /**
@@ -234,6 +237,8 @@ public:
 
 private:
     static constexpr uint16_t kMaxNdProxyNum = OPENTHREAD_CONFIG_NDPROXY_TABLE_ENTRY_NUM;
+    static constexpr uint16_t kNumBuckets    = 64; // MUST be a power of two.
+    static constexpr uint16_t kNullIndex     = 0xffff;
 
     enum Filter : uint8_t
     {
@@ -285,14 +290,28 @@ private:
     IteratorBuilder Iterate(Filter aFilter) { return IteratorBuilder(GetInstance(), aFilter); }
     void            Clear(void);
     static bool     MatchesFilter(const NdProxy &aProxy, Filter aFilter);
+    static uint16_t BucketFor(const Ip6::InterfaceIdentifier &aAddressIid);
+    void            ClearBuckets(void);
+    void            AddToBucket(NdProxy &aNdProxy);
+    void            RemoveFromBucket(NdProxy &aNdProxy);
     NdProxy        *FindByAddressIid(const Ip6::InterfaceIdentifier &aAddressIid);
     NdProxy        *FindByMeshLocalIid(const Ip6::InterfaceIdentifier &aMeshLocalIid);
     NdProxy        *FindInvalid(void);
+    NdProxy        *FindStalest(void);
     Ip6::Address    GetDua(NdProxy &aNdProxy);
     void            NotifyDuaRegistrationOnBackboneLink(NdProxy &aNdProxy, bool aIsRenew);
     void            TriggerCallback(NdProxy::Event aEvent, const Ip6::InterfaceIdentifier &aAddressIid) const;
 
+    // The proxies are additionally indexed by a hash of the DUA's
+    // address IID for constant-time resolution on the backbone
+    // packet path. Each bucket holds a chain of proxy slots linked
+    // through `mNextInBucket`. A slot joins its chain when it is
+    // registered and leaves it when the slot is reused for another
+    // DUA, so erased (invalid) slots may linger in a chain and are
+    // skipped during lookup.
+
     NdProxy                     mProxies[kMaxNdProxyNum];
+    uint16_t                    mBuckets[kNumBuckets];
     Callback<NdProxy::Callback> mCallback;
     bool                        mIsAnyDadInProcess : 1;
 };
@@ -108,7 +108,7 @@ public:
     Error GetNext(Filter aFilter, TableIterator &aIterator, BorderRouterEntry &aEntry) const;
 
 private:
-    struct BorderRouter : LinkedListEntry<BorderRouter>, Heap::Allocatable<BorderRouter>
+    struct BorderRouter : LinkedListEntry<BorderRouter>, Heap::Allocatable<BorderRouter, Heap::kOwnerBorderRouting>
     {
         struct RlocFilter
         {
@@ -130,6 +130,8 @@ private:
     };
 
     bool BrMatchesFilter(const BorderRouter &aEntry, Filter aFilter) const;
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged | kEventThreadRoleChanged;
+
     void HandleNotifierEvents(Events aEvents);
 
     OwningList<BorderRouter> mBorderRouters;
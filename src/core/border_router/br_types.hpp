@@ -144,20 +144,6 @@ public:
      */
     bool Matches(const ExpirationChecker &aChecker) const { return aChecker.IsExpired(GetExpireTime()); }
 
-    /**
-     * Sets the flag indicating whether the stale time for this prefix has been calculated.
-     *
-     * @param[in] aFlag  `true` to indicate that stale time has been calculated, `false` otherwise.
-     */
-    void SetStaleTimeCalculated(bool aFlag) { mStaleTimeCalculated = aFlag; }
-
-    /**
-     * Indicates whether the stale time for this prefix has been calculated.
-     *
-     * @returns `true` if the stale time has been calculated, `false` otherwise.
-     */
-    bool IsStaleTimeCalculated(void) const { return mStaleTimeCalculated; }
-
     /**
      * Sets the flag indicating that this prefix entry should be disregarded.
      *
@@ -192,7 +178,6 @@ protected:
 
     Ip6::Prefix mPrefix;
     bool        mDisregard : 1;
-    bool        mStaleTimeCalculated : 1;
     uint32_t    mValidLifetime;
     TimeMilli   mLastUpdateTime;
 };
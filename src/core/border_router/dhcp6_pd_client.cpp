@@ -119,13 +119,15 @@ void Dhcp6PdClient::EnterState(State aState)
 
     case kStateToSolicit:
         ClearServerDuid();
-        ClearPdPrefix();
+        mAdvertisedPdPrefix.Clear();
+        ClearPdPrefixIfExpired();
         mTimer.Start(Random::NonCrypto::GetUint32InRange(0, kMaxDelayFirstSolicit));
         break;
 
     case kStateSoliciting:
         ClearServerDuid();
-        ClearPdPrefix();
+        mAdvertisedPdPrefix.Clear();
+        ClearPdPrefixIfExpired();
         // Per RFC 8415 section 18.2.1, the first timeout for Solicit message
         // must be selected to be strictly greater than the initial timeout
         // value, therefore `kPositiveJitter` is used.
@@ -149,7 +151,11 @@ void Dhcp6PdClient::EnterState(State aState)
     case kStateRebinding:
         ClearServerDuid();
         mRetxTracker.Start(kInitialRebindTimeout, kMaxRebindTimeout, kFullJitter);
-        mRetxTracker.SetRetxEndTime(mPdPrefix.DeterminePreferredTime());
+        // Rebind retransmissions end `kSolicitOverlapBeforePreferredExpiry`
+        // before the preferred lifetime expires, so that a new
+        // solicitation starts while the current prefix is still
+        // preferred (and retained, see `ClearPdPrefixIfExpired()`).
+        mRetxTracker.SetRetxEndTime(mPdPrefix.DeterminePreferredTime() - kSolicitOverlapBeforePreferredExpiry);
         break;
 
     case kStateReleasing:
@@ -177,7 +183,9 @@ void Dhcp6PdClient::HandleTimer(void)
         break;
 
     case kStateSoliciting:
-        if (mPdPrefix.IsValid())
+        ClearPdPrefixIfExpired();
+
+        if (mAdvertisedPdPrefix.IsValid())
         {
             EnterState(kStateRequesting);
             break;
@@ -266,6 +274,18 @@ void Dhcp6PdClient::SendMessage(void)
     SuccessOrExit(
         Option::AppendOption(*message, Option::kOptionRequest, &kRequestedOptions, sizeof(kRequestedOptions)));
 
+    if (msgType == kMsgTypeSolicit)
+    {
+        // Per RFC 8415 Section 18.2.1, include a Rapid Commit option
+        // in the Solicit to indicate willingness to accept an
+        // immediately committing Reply from a server supporting the
+        // two-message exchange. The first server whose Reply delegates
+        // a usable prefix wins (see `HandleReply()`), shortening the
+        // handover time when soliciting a new server.
+
+        SuccessOrExit(RapidCommitOption::AppendTo(*message));
+    }
+
     SuccessOrExit(AppendIaPdOption(*message));
 
     LogInfo("Sending %s %s%s", MsgTypeToString(msgType),
@@ -345,8 +365,19 @@ Error Dhcp6PdClient::AppendIaPdOption(Message &aMessage)
     optionOffset = aMessage.GetLength();
     SuccessOrExit(error = aMessage.Append(iaPdOption));
 
-    if (mPdPrefix.IsValid())
+    if (mAdvertisedPdPrefix.IsValid())
+    {
+        // While soliciting/requesting, include the prefix from the
+        // favored received Advertise.
+
+        SuccessOrExit(error = AppendIaPrefixOption(aMessage, mAdvertisedPdPrefix.mPrefix));
+    }
+    else if (mPdPrefix.IsValid())
     {
+        // Include the current (or retained previously committed)
+        // prefix, e.g., when renewing/rebinding or as a hint in a new
+        // Solicit to request delegation of the same prefix.
+
         SuccessOrExit(error = AppendIaPrefixOption(aMessage, mPdPrefix.mPrefix));
     }
     else
@@ -413,7 +444,14 @@ void Dhcp6PdClient::HandleReceived(Message &aMessage)
         break;
 
     case kMsgTypeReply:
-        VerifyOrExit(mState != kStateSoliciting);
+        if (mState == kStateSoliciting)
+        {
+            // While soliciting, accept a Reply only when it carries a
+            // Rapid Commit option, matching the rapid commit request
+            // included in our Solicit.
+
+            VerifyOrExit(RapidCommitOption::FindIn(aMessage) == kErrorNone);
+        }
         break;
 
     default:
@@ -531,10 +569,10 @@ void Dhcp6PdClient::HandleAdvertise(const Message &aMessage)
 
     if (mRetxTracker.IsFirstAttempt() && !mServerDuid.IsEmpty())
     {
-        VerifyOrExit(favoredPdPrefix->mAdjustedPrefix < mPdPrefix.mAdjustedPrefix);
+        VerifyOrExit(favoredPdPrefix->mAdjustedPrefix < mAdvertisedPdPrefix.mAdjustedPrefix);
     }
 
-    mPdPrefix = *favoredPdPrefix;
+    mAdvertisedPdPrefix = *favoredPdPrefix;
 
     SaveServerDuidAndAddress(aMessage);
 
@@ -590,6 +628,25 @@ void Dhcp6PdClient::HandleReply(const Message &aMessage)
 
     SuccessOrExit(ProcessIaPd(aMessage, pdPrefixes, status));
 
+    if (mState == kStateSoliciting)
+    {
+        // A Reply while soliciting carries a Rapid Commit option
+        // (already validated in `HandleReceived()`). The first server
+        // whose Reply delegates a usable prefix wins. A Reply with no
+        // usable prefix is ignored, continuing to process Advertise
+        // (or rapid-commit Reply) messages from other servers.
+
+        favoredPdPrefix = SelectFavoredPrefix(pdPrefixes);
+
+        VerifyOrExit(status != StatusCodeOption::kNoPrefixAvail);
+        VerifyOrExit(favoredPdPrefix != nullptr);
+
+        SaveServerDuidAndAddress(aMessage);
+        CommitPdPrefix(*favoredPdPrefix);
+
+        ExitNow();
+    }
+
     if (mState == kStateRequesting)
     {
         favoredPdPrefix = SelectFavoredPrefix(pdPrefixes);
@@ -728,6 +785,24 @@ void Dhcp6PdClient::ClearPdPrefix(void)
     mPdPrefixCommited = false;
 }
 
+void Dhcp6PdClient::ClearPdPrefixIfExpired(void)
+{
+    // A previously committed prefix that is still within its preferred
+    // lifetime is intentionally retained while a new solicitation is
+    // in progress. This provides handover overlap on PD server
+    // failover: the old prefix remains published by `RoutingManager`
+    // (and routable) until it expires or a newly delegated prefix
+    // replaces it in `CommitPdPrefix()`.
+
+    VerifyOrExit(mPdPrefix.IsValid());
+    VerifyOrExit(mPdPrefix.DeterminePreferredTime() <= TimerMilli::GetNow());
+
+    ClearPdPrefix();
+
+exit:
+    return;
+}
+
 void Dhcp6PdClient::CommitPdPrefix(const PdPrefix &aPdPrefix)
 {
     if (!mPdPrefix.Matches(aPdPrefix))
@@ -740,6 +815,7 @@ void Dhcp6PdClient::CommitPdPrefix(const PdPrefix &aPdPrefix)
     mPdPrefix = aPdPrefix;
     mPdPrefix.AdjustLifetimesT1AndT2();
     mPdPrefixCommited = true;
+    mAdvertisedPdPrefix.Clear();
 
     EnterState(kStateToRenew);
     ReportPdPrefixToRoutingManager();
@@ -148,6 +148,12 @@ private:
     static constexpr uint32_t kMinT1MarginBeforePreferredLifetime   = 15 * Time::kOneMinuteInSec;
     static constexpr uint32_t kMinT2MarginBeforePreferredLifetime   = 6 * Time::kOneMinuteInSec;
 
+    // Rebind retransmissions end this long (in msec) before the
+    // preferred lifetime of the delegated prefix expires, so that a
+    // new solicitation overlaps with the remaining lifetime of the
+    // prefix (see `ClearPdPrefixIfExpired()`).
+    static constexpr uint32_t kSolicitOverlapBeforePreferredExpiry = 5 * Time::kOneMinuteInMsec;
+
     static_assert(kMaxPreferredLifetime > kMinPreferredLifetime, "invalid min/max values for preferred lifetime");
 
     // Default T1 and T2 as 0.5 and 0.8 times the preferred lifetime
@@ -251,6 +257,7 @@ private:
     void      SaveServerDuidAndAddress(const Message &aMessage);
     void      ClearServerDuid(void);
     void      ClearPdPrefix(void);
+    void      ClearPdPrefixIfExpired(void);
     void      CommitPdPrefix(const PdPrefix &aPdPrefix);
     void      ReportPdPrefixToRoutingManager(void);
 
@@ -264,6 +271,7 @@ private:
     RetxTracker  mRetxTracker;
     uint32_t     mMaxSolicitTimeout;
     PdPrefix     mPdPrefix;
+    PdPrefix     mAdvertisedPdPrefix;
     ServerDuid   mServerDuid;
     Ip6::Address mServerAddress;
     DelayTimer   mTimer;
@@ -51,8 +51,11 @@ MultiAilDetector::MultiAilDetector(Instance &aInstance)
     , mDetected(false)
     , mNetDataPeerBrCount(0)
     , mReachablePeerBrCount(0)
+    , mReachablePeerBrFingerprint(0)
+    , mFingerprintHistoryLength(0)
     , mTimer(aInstance)
 {
+    ClearAllBytes(mFingerprintHistory);
 }
 
 void MultiAilDetector::SetEnabled(bool aEnable)
@@ -128,11 +131,16 @@ void MultiAilDetector::Stop(void)
     VerifyOrExit(mState == kStateRunning);
 
     mTimer.Stop();
-    mDetected             = false;
-    mNetDataPeerBrCount   = 0;
-    mReachablePeerBrCount = 0;
+    mDetected                   = false;
+    mNetDataPeerBrCount         = 0;
+    mReachablePeerBrCount       = 0;
+    mReachablePeerBrFingerprint = 0;
     Get<RxRaTracker>().SetEnabled(false, RxRaTracker::kRequesterMultiAilDetector);
 
+    // `mFingerprintHistory` is intentionally retained so past
+    // fingerprint changes remain available for correlation after the
+    // detector is stopped or restarted.
+
     SetState(kStateStopped);
 
 exit:
@@ -152,6 +160,7 @@ void MultiAilDetector::Evaluate(void)
 {
     uint16_t count;
     uint32_t minAge;
+    uint32_t fingerprint;
     bool     detected;
 
     VerifyOrExit(mState == kStateRunning);
@@ -172,6 +181,16 @@ void MultiAilDetector::Evaluate(void)
         mReachablePeerBrCount = count;
     }
 
+    fingerprint = Get<RxRaTracker>().GetReachablePeerBrFingerprint();
+
+    if (fingerprint != mReachablePeerBrFingerprint)
+    {
+        LogInfo("Reachable Peer BR fingerprint: 0x%08lx -> 0x%08lx", ToUlong(mReachablePeerBrFingerprint),
+                ToUlong(fingerprint));
+        mReachablePeerBrFingerprint = fingerprint;
+        RecordFingerprint(fingerprint);
+    }
+
     detected = (mNetDataPeerBrCount > mReachablePeerBrCount);
 
     if (detected == mDetected)
@@ -187,6 +206,37 @@ exit:
     return;
 }
 
+void MultiAilDetector::RecordFingerprint(uint32_t aFingerprint)
+{
+    // Shift the existing entries, dropping the oldest one if the
+    // history is full, and insert the new fingerprint at index zero.
+
+    uint16_t length = Min(mFingerprintHistoryLength, static_cast<uint16_t>(kFingerprintHistorySize - 1));
+
+    for (uint16_t index = length; index > 0; index--)
+    {
+        mFingerprintHistory[index] = mFingerprintHistory[index - 1];
+    }
+
+    mFingerprintHistory[0].mFingerprint = aFingerprint;
+    mFingerprintHistory[0].mUptime      = Get<UptimeTracker>().GetUptimeInSeconds();
+
+    mFingerprintHistoryLength = static_cast<uint16_t>(length + 1);
+}
+
+Error MultiAilDetector::GetFingerprintHistoryEntry(uint16_t aIndex, uint32_t &aFingerprint, UptimeSec &aUptime) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aIndex < mFingerprintHistoryLength, error = kErrorNotFound);
+
+    aFingerprint = mFingerprintHistory[aIndex].mFingerprint;
+    aUptime      = mFingerprintHistory[aIndex].mUptime;
+
+exit:
+    return error;
+}
+
 void MultiAilDetector::HandleTimer(void)
 {
     if (!mDetected)
@@ -51,6 +51,7 @@
 #include "common/locator.hpp"
 #include "common/notifier.hpp"
 #include "common/timer.hpp"
+#include "common/uptime.hpp"
 
 namespace ot {
 namespace BorderRouter {
@@ -142,12 +143,30 @@ public:
      */
     void SetCallback(MultiAilCallback aCallback, void *aContext) { mCallback.Set(aCallback, aContext); }
 
+    /**
+     * Gets an entry from the reachable peer BR fingerprint history.
+     *
+     * The detector records the `RxRaTracker` reachable peer BR set fingerprint, along with the device uptime,
+     * whenever the fingerprint changes, keeping the most recent `kFingerprintHistorySize` changes. Entry zero is the
+     * most recent change.
+     *
+     * @param[in]  aIndex        The index of the entry to get (zero being the most recent change).
+     * @param[out] aFingerprint  A reference to return the recorded fingerprint value.
+     * @param[out] aUptime       A reference to return the uptime (in seconds) when the change was recorded.
+     *
+     * @retval kErrorNone      Successfully retrieved the entry at @p aIndex.
+     * @retval kErrorNotFound  No entry at @p aIndex.
+     */
+    Error GetFingerprintHistoryEntry(uint16_t aIndex, uint32_t &aFingerprint, UptimeSec &aUptime) const;
+
 private:
     static constexpr uint32_t kDetectTime = 10 * Time::kOneMinuteInMsec;
     static constexpr uint32_t kClearTime  = 1 * Time::kOneMinuteInMsec;
 
     static constexpr bool kAutoEnableMode = OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_AUTO_ENABLE_MODE;
 
+    static constexpr uint16_t kFingerprintHistorySize = 8;
+
     enum State : uint8_t
     {
         kStateDisabled, // Disabled.
@@ -155,14 +174,23 @@ private:
         kStateRunning,  // Enabled and running.
     };
 
+    struct FingerprintHistoryEntry
+    {
+        uint32_t  mFingerprint; // The recorded fingerprint value.
+        UptimeSec mUptime;      // Uptime (in seconds) when the change was recorded.
+    };
+
     void SetState(State aState);
     void UpdateState(void);
     void Start(void);
     void Stop(void);
     void Evaluate(void);
+    void RecordFingerprint(uint32_t aFingerprint);
     void HandleTimer(void);
 
     // Callback from `Notifier`
+    static constexpr ot::Events::Flags kNotifierEvents = ot::kEventThreadRoleChanged;
+
     void HandleNotifierEvents(ot::Events aEvents);
 
     // Callback from `InfraIf`
@@ -176,12 +204,15 @@ private:
     using DetectCallback = Callback<MultiAilCallback>;
     using DetectTimer    = TimerMilliIn<MultiAilDetector, &MultiAilDetector::HandleTimer>;
 
-    State          mState;
-    bool           mDetected;
-    uint16_t       mNetDataPeerBrCount;
-    uint16_t       mReachablePeerBrCount;
-    DetectTimer    mTimer;
-    DetectCallback mCallback;
+    State                   mState;
+    bool                    mDetected;
+    uint16_t                mNetDataPeerBrCount;
+    uint16_t                mReachablePeerBrCount;
+    uint32_t                mReachablePeerBrFingerprint;
+    uint16_t                mFingerprintHistoryLength;
+    FingerprintHistoryEntry mFingerprintHistory[kFingerprintHistorySize];
+    DetectTimer             mTimer;
+    DetectCallback          mCallback;
 };
 
 } // namespace BorderRouter
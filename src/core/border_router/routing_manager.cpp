@@ -65,6 +65,7 @@ RoutingManager::RoutingManager(Instance &aInstance)
     , mPdPrefixManager(aInstance)
 #endif
     , mRoutingPolicyTimer(aInstance)
+    , mPendingEvalScopes(kScopeNone)
 {
     mBrUlaPrefix.Clear();
 }
@@ -289,6 +290,7 @@ void RoutingManager::Stop(void)
     mTxRaInfo.mTxCount = 0;
 
     mRoutingPolicyTimer.Stop();
+    mPendingEvalScopes = kScopeNone;
 
     mRoutePublisher.Stop();
 
@@ -362,7 +364,7 @@ void RoutingManager::HandleNotifierEvents(Events aEvents)
     {
         mOmrPrefixManager.HandleNetDataChange();
         mOnLinkPrefixManager.HandleNetDataChange();
-        ScheduleRoutingPolicyEvaluation(kAfterRandomDelay);
+        ScheduleRoutingPolicyEvaluation(kAfterRandomDelay, kScopeOmrPrefix | kScopeOnLinkPrefix);
     }
 
     if (aEvents.Contains(kEventThreadExtPanIdChanged))
@@ -376,18 +378,47 @@ exit:
 
 void RoutingManager::EvaluateRoutingPolicy(void)
 {
+    EvaluationScopes scopes = mPendingEvalScopes;
+
     OT_ASSERT(mIsRunning);
 
-    LogInfo("Evaluating routing policy");
+    mPendingEvalScopes = kScopeNone;
+
+    LogInfo("Evaluating routing policy (scopes:0x%02x)", scopes);
+
+    // Evaluation is change-scoped: triggers classify which
+    // sub-decisions their change can affect (accumulated in
+    // `mPendingEvalScopes`) and only those are re-run. Triggers
+    // that merely require a new RA transmission (e.g., replying
+    // to a received RS or the periodic RA beacon) re-advertise
+    // the memoized decisions without re-computing them.
+
+    if (scopes & kScopeOnLinkPrefix)
+    {
+        mOnLinkPrefixManager.Evaluate();
+    }
+
+    if (scopes & kScopeOmrPrefix)
+    {
+        mOmrPrefixManager.Evaluate();
+    }
+
+    if (scopes & kScopeRoutes)
+    {
+        mRoutePublisher.Evaluate();
+    }
 
-    mOnLinkPrefixManager.Evaluate();
-    mOmrPrefixManager.Evaluate();
-    mRoutePublisher.Evaluate();
 #if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
-    mNat64PrefixManager.Evaluate();
+    if (scopes & kScopeNat64Prefix)
+    {
+        mNat64PrefixManager.Evaluate();
+    }
 #endif
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE
-    mPdPrefixManager.Evaluate();
+    if (scopes & kScopePdPrefix)
+    {
+        mPdPrefixManager.Evaluate();
+    }
 #endif
 
     if (IsInitialPolicyEvaluationDone())
@@ -407,7 +438,7 @@ void RoutingManager::EvaluateRoutingPolicy(void)
     }
 #endif
 
-    ScheduleRoutingPolicyEvaluation(kForNextRa);
+    ScheduleRoutingPolicyEvaluation(kForNextRa, kScopeNone);
 }
 
 bool RoutingManager::IsInitialPolicyEvaluationDone(void) const
@@ -421,7 +452,7 @@ bool RoutingManager::IsInitialPolicyEvaluationDone(void) const
     return mIsRunning && mOmrPrefixManager.IsInitialEvaluationDone() && mOnLinkPrefixManager.IsInitialEvaluationDone();
 }
 
-void RoutingManager::ScheduleRoutingPolicyEvaluation(ScheduleMode aMode)
+void RoutingManager::ScheduleRoutingPolicyEvaluation(ScheduleMode aMode, EvaluationScopes aScopes)
 {
     TimeMilli now      = TimerMilli::GetNow();
     uint32_t  delay    = 0;
@@ -431,6 +462,29 @@ void RoutingManager::ScheduleRoutingPolicyEvaluation(ScheduleMode aMode)
 
     VerifyOrExit(mIsRunning);
 
+    // Include the sub-decisions that depend on the outcome of the
+    // requested ones: the published route depends on both the favored
+    // OMR and on-link prefixes, and the NAT64 and DHCPv6-PD prefix
+    // decisions depend on the favored OMR prefix.
+
+    if (aScopes & kScopeOmrPrefix)
+    {
+        aScopes |= kScopeRoutes;
+#if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
+        aScopes |= kScopeNat64Prefix;
+#endif
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE
+        aScopes |= kScopePdPrefix;
+#endif
+    }
+
+    if (aScopes & kScopeOnLinkPrefix)
+    {
+        aScopes |= kScopeRoutes;
+    }
+
+    mPendingEvalScopes |= aScopes;
+
     switch (aMode)
     {
     case kImmediately:
@@ -511,6 +565,19 @@ void RoutingManager::SendRouterAdvertisement(RouterAdvTxMode aRaTxMode)
     Get<RxRaTracker>().SetHeaderFlagsOn(header);
     header.SetSnacRouterFlag();
 
+    // Pre-reserve the expected RA size so the header and all options
+    // are assembled directly into their final buffer, which is then
+    // handed as-is to the platform layer, avoiding intermediate
+    // reallocations (and copies of the partially prepared message)
+    // while appending. The RIO count from the last advertisement is
+    // used as an estimate; if it is exceeded, the message buffer
+    // grows as before.
+
+    IgnoreError(raMsg.ReserveCapacity(
+        sizeof(RouterAdvert::Header) + mOnLinkPrefixManager.GetPioCountEstimate() * sizeof(PrefixInfoOption) +
+        mRioAdvertiser.GetAdvertisedRioCount() * RouteInfoOption::OptionSizeForPrefix(Ip6::Prefix::kMaxLength) +
+        2 * Option::kLengthUnit + mExtraRaOptions.GetLength()));
+
     SuccessOrExit(error = raMsg.Append(header));
 
     LogRaHeader(header);
@@ -586,7 +653,7 @@ void RoutingManager::HandleRouterSolicit(const InfraIf::Icmp6Packet &aPacket, co
 
     VerifyOrExit(Get<RxRaTracker>().IsInitialRouterDiscoveryFinished());
 
-    ScheduleRoutingPolicyEvaluation(kToReplyToRs);
+    ScheduleRoutingPolicyEvaluation(kToReplyToRs, kScopeNone);
 
 exit:
     return;
@@ -609,12 +676,12 @@ void RoutingManager::HandleRxRaTrackerEvents(const RxRaTracker::Events &aEvents)
 
     if (aEvents.mLocalRaHeaderChanged)
     {
-        ScheduleRoutingPolicyEvaluation(kAfterRandomDelay);
+        ScheduleRoutingPolicyEvaluation(kAfterRandomDelay, kScopeNone);
     }
 
     if (aEvents.mInitialDiscoveryFinished)
     {
-        ScheduleRoutingPolicyEvaluation(kImmediately);
+        ScheduleRoutingPolicyEvaluation(kImmediately, kScopeAll);
     }
 
 exit:
@@ -631,7 +698,7 @@ void RoutingManager::HandleLocalOnLinkPrefixChanged(void)
 
     mRoutePublisher.Evaluate();
     Get<RxRaTracker>().HandleLocalOnLinkPrefixChanged();
-    ScheduleRoutingPolicyEvaluation(kAfterRandomDelay);
+    ScheduleRoutingPolicyEvaluation(kAfterRandomDelay, kScopeOnLinkPrefix);
 
 exit:
     return;
@@ -1470,7 +1537,7 @@ void RoutingManager::OnLinkPrefixManager::HandleRxRaTrackerChanged(void)
 
     if (Get<RxRaTracker>().GetFavoredOnLinkPrefix() != mAilPrefix)
     {
-        Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kAfterRandomDelay);
+        Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kAfterRandomDelay, kScopeOnLinkPrefix);
     }
 }
 
@@ -1640,7 +1707,7 @@ void RoutingManager::OnLinkPrefixManager::HandleNetDataChange(void)
     if (Get<RoutingManager>().NetworkDataContainsUlaRoute())
     {
         SetState(kAdvertising);
-        Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kAfterRandomDelay);
+        Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kAfterRandomDelay, kScopeOnLinkPrefix);
     }
 
 exit:
@@ -1849,7 +1916,7 @@ void RoutingManager::RioAdvertiser::UpdatePreference(RoutePreference aPreference
             RoutePreferenceToString(aPreference));
     mPreference = aPreference;
 
-    Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kAfterRandomDelay);
+    Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kAfterRandomDelay, kScopeNone);
 
 exit:
     return;
@@ -2024,7 +2091,7 @@ exit:
 
 void RoutingManager::RioAdvertiser::HandleTimer(void)
 {
-    Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kImmediately);
+    Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kImmediately, kScopeNone);
 }
 
 void RoutingManager::RioAdvertiser::RioPrefixArray::Add(const Ip6::Prefix &aPrefix)
@@ -2504,7 +2571,7 @@ void RoutingManager::Nat64PrefixManager::Discover(void)
             LogWarnOnError(error, "discover infraif NAT64 prefix");
         }
 
-        Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kAfterRandomDelay);
+        Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kAfterRandomDelay, kScopeNat64Prefix);
     }
 }
 
@@ -2514,7 +2581,7 @@ void RoutingManager::Nat64PrefixManager::HandlePlatformDiscoveredPrefix(const Ip
 
     LogInfo("Platform Discovered NAT64 prefix: %s",
             mPlatformPrefix.IsValidNat64() ? mPlatformPrefix.ToString().AsCString() : "none");
-    Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kAfterRandomDelay);
+    Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kAfterRandomDelay, kScopeNat64Prefix);
 }
 
 void RoutingManager::Nat64PrefixManager::HandleRxRaTrackerChanged(void)
@@ -2526,7 +2593,7 @@ void RoutingManager::Nat64PrefixManager::HandleRxRaTrackerChanged(void)
         mRaTrackerPrefix = favoredPrefix;
         LogInfo("RA discovered NAT64 prefix: %s",
                 mRaTrackerPrefix.IsValidNat64() ? mRaTrackerPrefix.ToString().AsCString() : "none");
-        Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kAfterRandomDelay);
+        Get<RoutingManager>().ScheduleRoutingPolicyEvaluation(kAfterRandomDelay, kScopeNat64Prefix);
     }
 }
 
@@ -614,6 +614,27 @@ private:
         kToReplyToRs,
     };
 
+    // Identifies which sub-decisions a trigger affects. Used in
+    // `ScheduleRoutingPolicyEvaluation()` to scope the next policy
+    // evaluation to the sub-decisions whose inputs may have changed.
+    // Scopes accumulate until the evaluation runs. `kScopeNone` can
+    // be used by triggers that only require a new RA transmission
+    // (e.g., replying to a received RS) with no decision change.
+
+    typedef uint8_t EvaluationScopes;
+
+    static constexpr uint8_t kScopeNone         = 0;
+    static constexpr uint8_t kScopeOmrPrefix    = (1 << 0);
+    static constexpr uint8_t kScopeOnLinkPrefix = (1 << 1);
+    static constexpr uint8_t kScopeRoutes       = (1 << 2);
+#if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
+    static constexpr uint8_t kScopeNat64Prefix = (1 << 3);
+#endif
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE
+    static constexpr uint8_t kScopePdPrefix = (1 << 4);
+#endif
+    static constexpr uint8_t kScopeAll = 0xff;
+
     //------------------------------------------------------------------------------------------------------------------
     // Nested types
 
@@ -718,6 +739,7 @@ private:
         void               HandleRxRaTrackerChanged(void);
         bool               ShouldPublishUlaRoute(void) const;
         Error              AppendAsPiosTo(RouterAdvert::TxMessage &aRaMessage);
+        uint16_t           GetPioCountEstimate(void) const { return 1 + mOldLocalPrefixes.GetLength(); }
         void               HandleNetDataChange(void);
         void               HandleExtPanIdChange(void);
         void               HandleTimer(void);
@@ -1069,13 +1091,16 @@ private:
     void EvaluateState(void);
     void Start(void);
     void Stop(void);
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadNetdataChanged |
+        kEventThreadExtPanIdChanged | kEventParentLinkQualityChanged;
+
     void HandleNotifierEvents(Events aEvents);
     bool IsEnabled(void) const { return mIsEnabled; }
     void LoadOrGenerateRandomBrUlaPrefix(void);
 
     void EvaluateRoutingPolicy(void);
     bool IsInitialPolicyEvaluationDone(void) const;
-    void ScheduleRoutingPolicyEvaluation(ScheduleMode aMode);
+    void ScheduleRoutingPolicyEvaluation(ScheduleMode aMode, EvaluationScopes aScopes);
     void SendRouterAdvertisement(RouterAdvTxMode aRaTxMode);
 
     bool NetworkDataContainsUlaRoute(void) const;
@@ -1125,6 +1150,10 @@ private:
     Heap::Data mExtraRaOptions;
 
     RoutingPolicyTimer mRoutingPolicyTimer;
+
+    // Accumulated scopes for the next policy evaluation, consumed
+    // (and cleared) when `EvaluateRoutingPolicy()` runs.
+    EvaluationScopes mPendingEvalScopes;
 };
 
 } // namespace BorderRouter
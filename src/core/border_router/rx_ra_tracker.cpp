@@ -36,6 +36,7 @@
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
 #include "border_router/br_log.hpp"
+#include "common/crc.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -133,6 +134,7 @@ void RxRaTracker::Stop(void)
     mIfAddresses.Free();
     mLocalRaHeader.Clear();
     mDecisionFactors.Clear();
+    mPrefixIndex.Clear();
 
     mExpirationTimer.Stop();
     mStaleTimer.Stop();
@@ -219,6 +221,9 @@ void RxRaTracker::HandleRouterAdvertisement(const InfraIf::Icmp6Packet &aPacket,
         router->Clear();
         router->mDiscoverTime = Get<UptimeTracker>().GetUptimeInSeconds();
         router->mAddress      = aSrcAddress;
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
+        router->mFingerprint = CalculateRouterFingerprint(aSrcAddress);
+#endif
 
         mRouters.Push(*newEntry);
     }
@@ -812,9 +817,12 @@ void RxRaTracker::Evaluate(void)
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Determine decision factors (favored on-link prefix, has any
-    // ULA/non-ULA on-link/route prefix, M/O flags).
+    // ULA/non-ULA on-link/route prefix, M/O flags). The sorted
+    // prefix index is rebuilt in the same pass, aggregating the
+    // stale time of each unique prefix across all routers.
 
     mDecisionFactors.Clear();
+    mPrefixIndex.Clear();
 
     for (Router &router : mRouters)
     {
@@ -822,10 +830,18 @@ void RxRaTracker::Evaluate(void)
 
         mDecisionFactors.UpdateFlagsFrom(router);
 
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
+        if (!router.mIsLocalDevice && router.IsPeerBr() && router.IsReachable())
+        {
+            mDecisionFactors.mReachablePeerBrCount++;
+            mDecisionFactors.mReachablePeerBrFingerprint ^= router.mFingerprint;
+        }
+#endif
+
         for (OnLinkPrefix &entry : router.mOnLinkPrefixes)
         {
             mDecisionFactors.UpdateFrom(entry);
-            entry.SetStaleTimeCalculated(false);
+            AddToPrefixIndex(entry, staleTime);
 
             router.mAllEntriesDisregarded &= entry.ShouldDisregard();
         }
@@ -833,7 +849,7 @@ void RxRaTracker::Evaluate(void)
         for (RoutePrefix &entry : router.mRoutePrefixes)
         {
             mDecisionFactors.UpdateFrom(entry);
-            entry.SetStaleTimeCalculated(false);
+            AddToPrefixIndex(entry, staleTime);
 
             router.mAllEntriesDisregarded &= entry.ShouldDisregard();
         }
@@ -846,10 +862,6 @@ void RxRaTracker::Evaluate(void)
 #endif
     }
 
-#if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
-    mDecisionFactors.mReachablePeerBrCount = CountReachablePeerBrs();
-#endif
-
     if (oldFactors != mDecisionFactors)
     {
         mPendingEvents.mDecisionFactorChanged = true;
@@ -871,13 +883,18 @@ void RxRaTracker::Evaluate(void)
 
     // If multiple routers advertise the same on-link or route prefix,
     // the stale time for the prefix is determined by the latest stale
-    // time among all corresponding entries.
-    //
-    // The "StaleTimeCalculated" flag is used to ensure stale time is
-    // calculated only once for each unique prefix. Initially, this
-    // flag is cleared on all entries. As we iterate over routers and
-    // their entries, `DetermineStaleTimeFor()` will consider all
-    // matching entries and mark "StaleTimeCalculated" flag on them.
+    // time among all corresponding entries. This is already
+    // aggregated per unique prefix in `mPrefixIndex` (rebuilt in the
+    // earlier pass), so a single iteration over the index entries
+    // determines the next stale time.
+
+    for (const PrefixIndex::IndexEntry &indexEntry : mPrefixIndex)
+    {
+        if (indexEntry.mHasStaleTime)
+        {
+            staleTime.UpdateIfEarlier(indexEntry.mStaleTime);
+        }
+    }
 
     for (Router &router : mRouters)
     {
@@ -890,21 +907,11 @@ void RxRaTracker::Evaluate(void)
         for (const OnLinkPrefix &entry : router.mOnLinkPrefixes)
         {
             entryExpireTime.UpdateIfEarlier(entry.GetExpireTime());
-
-            if (!entry.IsStaleTimeCalculated())
-            {
-                DetermineStaleTimeFor(entry, staleTime);
-            }
         }
 
         for (const RoutePrefix &entry : router.mRoutePrefixes)
         {
             entryExpireTime.UpdateIfEarlier(entry.GetExpireTime());
-
-            if (!entry.IsStaleTimeCalculated())
-            {
-                DetermineStaleTimeFor(entry, staleTime);
-            }
         }
 
 #if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
@@ -949,62 +956,45 @@ void RxRaTracker::Evaluate(void)
 #endif
 }
 
-void RxRaTracker::DetermineStaleTimeFor(const OnLinkPrefix &aPrefix, NextFireTime &aStaleTime)
+void RxRaTracker::AddToPrefixIndex(const OnLinkPrefix &aPrefix, NextFireTime &aStaleTime)
 {
-    TimeMilli prefixStaleTime = aStaleTime.GetNow();
-    bool      found           = false;
-
-    for (Router &router : mRouters)
-    {
-        for (OnLinkPrefix &entry : router.mOnLinkPrefixes)
-        {
-            if (!entry.Matches(aPrefix.GetPrefix()))
-            {
-                continue;
-            }
+    PrefixIndex::IndexEntry *indexEntry = mPrefixIndex.FindOrAdd(aPrefix.GetPrefix(), /* aIsOnLink */ true);
 
-            entry.SetStaleTimeCalculated(true);
+    // Deprecated on-link prefix entries do not contribute to the
+    // aggregated stale time of the prefix.
 
-            if (entry.IsDeprecated())
-            {
-                continue;
-            }
+    VerifyOrExit(!aPrefix.IsDeprecated());
 
-            prefixStaleTime = Max(prefixStaleTime, Max(aStaleTime.GetNow(), entry.GetStaleTime()));
-            found           = true;
-        }
+    if (indexEntry != nullptr)
+    {
+        indexEntry->UpdateStaleTime(Max(aStaleTime.GetNow(), aPrefix.GetStaleTime()));
     }
-
-    if (found)
+    else
     {
-        aStaleTime.UpdateIfEarlier(prefixStaleTime);
+        // The index entry could not be allocated (possible only in
+        // heap-based builds when out of memory). Fold the entry's
+        // stale time in directly. This may schedule the stale timer
+        // earlier than strictly needed (triggering an extra RS tx
+        // cycle) but keeps the behavior safe.
+
+        aStaleTime.UpdateIfEarlier(aPrefix.GetStaleTime());
     }
+
+exit:
+    return;
 }
 
-void RxRaTracker::DetermineStaleTimeFor(const RoutePrefix &aPrefix, NextFireTime &aStaleTime)
+void RxRaTracker::AddToPrefixIndex(const RoutePrefix &aPrefix, NextFireTime &aStaleTime)
 {
-    TimeMilli prefixStaleTime = aStaleTime.GetNow();
-    bool      found           = false;
+    PrefixIndex::IndexEntry *indexEntry = mPrefixIndex.FindOrAdd(aPrefix.GetPrefix(), /* aIsOnLink */ false);
 
-    for (Router &router : mRouters)
+    if (indexEntry != nullptr)
     {
-        for (RoutePrefix &entry : router.mRoutePrefixes)
-        {
-            if (!entry.Matches(aPrefix.GetPrefix()))
-            {
-                continue;
-            }
-
-            entry.SetStaleTimeCalculated(true);
-
-            prefixStaleTime = Max(prefixStaleTime, Max(aStaleTime.GetNow(), entry.GetStaleTime()));
-            found           = true;
-        }
+        indexEntry->UpdateStaleTime(Max(aStaleTime.GetNow(), aPrefix.GetStaleTime()));
     }
-
-    if (found)
+    else
     {
-        aStaleTime.UpdateIfEarlier(prefixStaleTime);
+        aStaleTime.UpdateIfEarlier(aPrefix.GetStaleTime());
     }
 }
 
@@ -1169,10 +1159,28 @@ void RxRaTracker::SetHeaderFlagsOn(RouterAdvert::Header &aHeader) const
 
 bool RxRaTracker::IsAddressOnLink(const Ip6::Address &aAddress) const
 {
+    // Address matching is a prefix match (not an exact lookup), so
+    // the sorted index is iterated rather than binary searched. It
+    // still holds unique prefixes only, avoiding re-checking the
+    // same prefix advertised by multiple routers.
+
     bool isOnLink = Get<RoutingManager>().mOnLinkPrefixManager.AddressMatchesLocalPrefix(aAddress);
 
     VerifyOrExit(!isOnLink);
 
+    for (const PrefixIndex::IndexEntry &indexEntry : mPrefixIndex)
+    {
+        if (!indexEntry.mIsOnLink)
+        {
+            continue;
+        }
+
+        isOnLink = aAddress.MatchesPrefix(indexEntry.mPrefix);
+        VerifyOrExit(!isOnLink);
+    }
+
+    VerifyOrExit(!mPrefixIndex.IsComplete());
+
     for (const Router &router : mRouters)
     {
         for (const OnLinkPrefix &onLinkPrefix : router.mOnLinkPrefixes)
@@ -1188,17 +1196,16 @@ exit:
 
 bool RxRaTracker::IsPrefixOnLink(const Ip6::Prefix &aPrefix) const
 {
-    bool isOnLink = false;
+    bool isOnLink = (mPrefixIndex.Find(aPrefix, /* aIsOnLink */ true) != nullptr);
+
+    VerifyOrExit(!isOnLink && !mPrefixIndex.IsComplete());
 
     for (const Router &router : mRouters)
     {
-        for (const OnLinkPrefix &onLinkPrefix : router.mOnLinkPrefixes)
+        if (router.mOnLinkPrefixes.ContainsMatching(aPrefix))
         {
-            if (aPrefix == onLinkPrefix.GetPrefix())
-            {
-                isOnLink = true;
-                ExitNow();
-            }
+            isOnLink = true;
+            break;
         }
     }
 
@@ -1208,7 +1215,9 @@ exit:
 
 bool RxRaTracker::ContainsRoutePrefix(const Ip6::Prefix &aPrefix) const
 {
-    bool contains = false;
+    bool contains = (mPrefixIndex.Find(aPrefix, /* aIsOnLink */ false) != nullptr);
+
+    VerifyOrExit(!contains && !mPrefixIndex.IsComplete());
 
     for (const Router &router : mRouters)
     {
@@ -1219,6 +1228,7 @@ bool RxRaTracker::ContainsRoutePrefix(const Ip6::Prefix &aPrefix) const
         }
     }
 
+exit:
     return contains;
 }
 
@@ -1229,6 +1239,19 @@ bool RxRaTracker::IsAddressReachableThroughExplicitRoute(const Ip6::Address &aAd
 
     bool isReachable = false;
 
+    for (const PrefixIndex::IndexEntry &indexEntry : mPrefixIndex)
+    {
+        if (indexEntry.mIsOnLink || (indexEntry.mPrefix.GetLength() == 0))
+        {
+            continue;
+        }
+
+        isReachable = aAddress.MatchesPrefix(indexEntry.mPrefix);
+        VerifyOrExit(!isReachable);
+    }
+
+    VerifyOrExit(!mPrefixIndex.IsComplete());
+
     for (const Router &router : mRouters)
     {
         for (const RoutePrefix &routePrefix : router.mRoutePrefixes)
@@ -1341,19 +1364,18 @@ exit:
 }
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
-uint16_t RxRaTracker::CountReachablePeerBrs(void) const
+uint32_t RxRaTracker::CalculateRouterFingerprint(const Ip6::Address &aAddress)
 {
-    uint16_t count = 0;
+    // The per-router fingerprint is the CRC32 of the router's
+    // address, calculated once when the router is first discovered.
+    // `Evaluate()` XOR-folds the fingerprints of all reachable peer
+    // BRs, so the resulting set fingerprint is order-independent,
+    // and a router joining or leaving the set changes it by exactly
+    // that router's contribution.
 
-    for (const Router &router : mRouters)
-    {
-        if (!router.mIsLocalDevice && router.IsPeerBr() && router.IsReachable())
-        {
-            count++;
-        }
-    }
+    CrcCalculator<uint32_t> calculator(kCrc32AnsiPolynomial);
 
-    return count;
+    return calculator.Feed(aAddress);
 }
 #endif
 
@@ -1429,6 +1451,100 @@ const char *RxRaTracker::RouterAdvOriginToString(RouterAdvOrigin aRaOrigin)
 
 #endif // OT_SHOULD_LOG_AT(OT_LOG_LEVEL_INFO)
 
+//---------------------------------------------------------------------------------------------------------------------
+// RxRaTracker::PrefixIndex
+
+void RxRaTracker::PrefixIndex::Clear(void)
+{
+    mEntries.Clear();
+    mIsComplete = true;
+}
+
+const RxRaTracker::PrefixIndex::IndexEntry *RxRaTracker::PrefixIndex::Find(const Ip6::Prefix &aPrefix,
+                                                                           bool               aIsOnLink) const
+{
+    Key key;
+
+    key.mPrefix   = &aPrefix;
+    key.mIsOnLink = aIsOnLink;
+
+    return BinarySearch::Find(key, mEntries.begin(), mEntries.GetLength());
+}
+
+RxRaTracker::PrefixIndex::IndexEntry *RxRaTracker::PrefixIndex::FindOrAdd(const Ip6::Prefix &aPrefix, bool aIsOnLink)
+{
+    IndexEntry *entry = AsNonConst(Find(aPrefix, aIsOnLink));
+    IndexEntry  newEntry;
+    Key         key;
+    uint16_t    index;
+
+    VerifyOrExit(entry == nullptr);
+
+    newEntry.mPrefix       = aPrefix;
+    newEntry.mStaleTime    = TimeMilli(0);
+    newEntry.mIsOnLink     = aIsOnLink;
+    newEntry.mHasStaleTime = false;
+
+    if (mEntries.PushBack(newEntry) != kErrorNone)
+    {
+        mIsComplete = false;
+        ExitNow();
+    }
+
+    // Restore the sorted order of the array by shifting larger
+    // entries up and placing the new entry at its proper position.
+
+    key.mPrefix   = &aPrefix;
+    key.mIsOnLink = aIsOnLink;
+
+    index = mEntries.GetLength() - 1;
+
+    while ((index > 0) && (mEntries[index - 1].Compare(key) < 0))
+    {
+        mEntries[index] = mEntries[index - 1];
+        index--;
+    }
+
+    mEntries[index] = newEntry;
+    entry           = &mEntries[index];
+
+exit:
+    return entry;
+}
+
+int RxRaTracker::PrefixIndex::IndexEntry::Compare(const Key &aKey) const
+{
+    // Returns zero on a match, a positive value if @p aKey is larger
+    // than this entry, and a negative value if it is smaller. Entries
+    // are ordered by on-link/route type first and then by prefix.
+
+    int result;
+
+    if (aKey.mIsOnLink != mIsOnLink)
+    {
+        result = aKey.mIsOnLink ? -1 : 1;
+        ExitNow();
+    }
+
+    if (*aKey.mPrefix == mPrefix)
+    {
+        result = 0;
+    }
+    else
+    {
+        result = (mPrefix < *aKey.mPrefix) ? 1 : -1;
+    }
+
+exit:
+    return result;
+}
+
+void RxRaTracker::PrefixIndex::IndexEntry::UpdateStaleTime(TimeMilli aStaleTime)
+{
+    mStaleTime    = mHasStaleTime ? Max(mStaleTime, aStaleTime) : aStaleTime;
+    mHasStaleTime = true;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // RxRaTracker::Iterator
 
@@ -42,11 +42,14 @@
 
 #include "border_router/br_types.hpp"
 #include "border_router/infra_if.hpp"
+#include "common/array.hpp"
+#include "common/binary_search.hpp"
 #include "common/callback.hpp"
 #include "common/clearable.hpp"
 #include "common/equatable.hpp"
 #include "common/error.hpp"
 #include "common/heap_allocatable.hpp"
+#include "common/heap_array.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
@@ -246,6 +249,17 @@ public:
      * @returns The number of reachable peer BRs.
      */
     uint16_t GetReachablePeerBrCount(void) const { return mDecisionFactors.mReachablePeerBrCount; }
+
+    /**
+     * Gets the fingerprint of the set of reachable peer Border Routers.
+     *
+     * The fingerprint is an order-independent hash over the addresses of all reachable peer BRs. It changes whenever
+     * a peer BR joins or leaves the set, so callers can detect set membership changes with a single `uint32_t`
+     * comparison.
+     *
+     * @returns The fingerprint of the reachable peer BR set.
+     */
+    uint32_t GetReachablePeerBrFingerprint(void) const { return mDecisionFactors.mReachablePeerBrFingerprint; }
 #endif
 
     /**
@@ -351,7 +365,7 @@ private:
     struct Entry : public Type,
                    public LinkedListEntry<Entry<Type>>,
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_USE_HEAP_ENABLE
-                   public Heap::Allocatable<Entry<Type>>
+                   public Heap::Allocatable<Entry<Type>, Heap::kOwnerBorderRouting>
 #else
                    public InstanceLocatorInit
 #endif
@@ -443,6 +457,9 @@ private:
         UptimeSec        mDiscoverTime;
         TimeMilli        mLastUpdateTime;
         TimeMilli        mTimeoutTime;
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
+        uint32_t mFingerprint; // CRC32 of `mAddress`, calculated once on discovery.
+#endif
         uint8_t          mNsProbeCount;
         bool             mManagedAddressConfigFlag : 1;
         bool             mOtherConfigFlag : 1;
@@ -531,6 +548,66 @@ private:
 
     //-  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -
 
+    class PrefixIndex
+    {
+        // Maintains a sorted array of the unique on-link and route
+        // prefixes across all routers, along with the aggregated
+        // stale time of each unique prefix (the latest stale time
+        // among all entries advertising it). The index is rebuilt by
+        // `Evaluate()` and enables binary-search lookups, avoiding
+        // nested iterations over all routers and their entries.
+
+    public:
+        struct Key
+        {
+            const Ip6::Prefix *mPrefix;   // The prefix to search for.
+            bool               mIsOnLink; // Whether to search among on-link or route prefixes.
+        };
+
+        struct IndexEntry
+        {
+            int  Compare(const Key &aKey) const;
+            void UpdateStaleTime(TimeMilli aStaleTime);
+
+            Ip6::Prefix mPrefix;           // The unique prefix.
+            TimeMilli   mStaleTime;        // Aggregated stale time (valid when `mHasStaleTime`).
+            bool        mIsOnLink : 1;     // Whether this is an on-link or a route prefix.
+            bool        mHasStaleTime : 1; // Whether any entry contributed a stale time.
+        };
+
+        PrefixIndex(void) { Clear(); }
+
+        // Indicates whether the index covers all prefixes. It can be
+        // incomplete only if an entry allocation failed while it was
+        // being rebuilt (possible only in heap-based builds when
+        // device is out of memory). While incomplete, a missed index
+        // lookup is not conclusive and callers need to fall back to
+        // scanning the routers and their entries directly.
+        bool IsComplete(void) const { return mIsComplete; }
+
+        void              Clear(void);
+        IndexEntry       *FindOrAdd(const Ip6::Prefix &aPrefix, bool aIsOnLink);
+        const IndexEntry *Find(const Ip6::Prefix &aPrefix, bool aIsOnLink) const;
+
+        // Iteration over index entries (e.g., using range-based `for` loop).
+        const IndexEntry *begin(void) const { return mEntries.begin(); }
+        const IndexEntry *end(void) const { return mEntries.end(); }
+
+    private:
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_USE_HEAP_ENABLE
+        static constexpr uint16_t kGrowthSize = 8;
+
+        using EntryArray = Heap::Array<IndexEntry, kGrowthSize>;
+#else
+        using EntryArray = Array<IndexEntry, kMaxEntries>;
+#endif
+
+        EntryArray mEntries;
+        bool       mIsComplete;
+    };
+
+    //-  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -
+
     struct DecisionFactors : public Clearable<DecisionFactors>, public Equatable<DecisionFactors>
     {
         DecisionFactors(void) { Clear(); }
@@ -555,6 +632,7 @@ private:
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
         uint16_t mReachablePeerBrCount;
+        uint32_t mReachablePeerBrFingerprint;
 #endif
     };
 
@@ -612,15 +690,17 @@ private:
     void UpdateIfAddresses(const Ip6::Address &aAddress);
     void RemoveOrDeprecateOldEntries(TimeMilli aTimeThreshold);
     void Evaluate(void);
-    void DetermineStaleTimeFor(const OnLinkPrefix &aPrefix, NextFireTime &aStaleTime);
-    void DetermineStaleTimeFor(const RoutePrefix &aPrefix, NextFireTime &aStaleTime);
+    void AddToPrefixIndex(const OnLinkPrefix &aPrefix, NextFireTime &aStaleTime);
+    void AddToPrefixIndex(const RoutePrefix &aPrefix, NextFireTime &aStaleTime);
     void SendNeighborSolicitToRouter(const Router &aRouter);
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
-    uint16_t CountReachablePeerBrs(void) const;
+    static uint32_t CalculateRouterFingerprint(const Ip6::Address &aAddress);
 #endif
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
     void ReportChangesToHistoryTracker(Router &aRouter, bool aRemoved);
 #endif
+    static constexpr ot::Events::Flags kNotifierEvents = ot::kEventThreadNetdataChanged;
+
     void HandleNotifierEvents(ot::Events aEvents);
     void HandleNetDataChange(void);
 
@@ -662,6 +742,7 @@ private:
     Events               mPendingEvents;
     RsSender             mRsSender;
     DecisionFactors      mDecisionFactors;
+    PrefixIndex          mPrefixIndex;
     RouterList           mRouters;
     IfAddressList        mIfAddresses;
     ExpirationTimer      mExpirationTimer;
@@ -129,6 +129,9 @@ CoapBase::CoapBase(Instance &aInstance, Transmitter aTransmitter)
     , mLastResponse(nullptr)
 #endif
 {
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE && (OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW > 1)
+    ClearAllBytes(mBlockTransfer);
+#endif
 }
 
 void CoapBase::ClearAllRequestsAndResponses(void)
@@ -325,6 +328,58 @@ Error CoapBase::SendMessage(Message &aMessage, const Ip6::MessageInfo &aMessageI
     return SendMessage(aMessage, aMessageInfo, &aTxParameters, callbacks);
 }
 
+Error CoapBase::SendCopy(const Message          &aMessage,
+                         const Ip6::MessageInfo &aMessageInfo,
+                         const Token            *aToken,
+                         ResponseHandler         aHandler,
+                         void                   *aContext)
+{
+    SendCallbacks callbacks;
+
+    callbacks.Clear();
+    callbacks.mResponseHandler = aHandler;
+    callbacks.mContext         = aContext;
+
+    return SendCopy(aMessage, aMessageInfo, aToken, callbacks);
+}
+
+Error CoapBase::SendCopyWithResponseHandlerSeparateParams(const Message                &aMessage,
+                                                          const Ip6::MessageInfo       &aMessageInfo,
+                                                          const Token                  *aToken,
+                                                          ResponseHandlerSeparateParams aHandler,
+                                                          void                         *aContext)
+{
+    SendCallbacks callbacks;
+
+    callbacks.Clear();
+    callbacks.mResponseHandlerSeparateParams = aHandler;
+    callbacks.mContext                       = aContext;
+
+    return SendCopy(aMessage, aMessageInfo, aToken, callbacks);
+}
+
+Error CoapBase::SendCopy(const Message          &aMessage,
+                         const Ip6::MessageInfo &aMessageInfo,
+                         const Token            *aToken,
+                         const SendCallbacks    &aCallbacks)
+{
+    Error    error;
+    Message *message = CloneMessage(aMessage);
+
+    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+
+    if (aToken != nullptr)
+    {
+        SuccessOrExit(error = message->WriteToken(*aToken));
+    }
+
+    error = SendMessage(*message, aMessageInfo, /* aTxParameters */ nullptr, aCallbacks);
+
+exit:
+    FreeMessageOnError(message, error);
+    return error;
+}
+
 Error CoapBase::SendMessage(Message                &aMessage,
                             const Ip6::MessageInfo &aMessageInfo,
                             const ResponseHandler   aHandler,
@@ -1169,6 +1224,40 @@ Error CoapBase::SendNextBlock2Request(Request &aRequest, Msg &aRxMsg, uint32_t a
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW > 1
+    if (!aBeginBlock1Transfer)
+    {
+        BlockTransfer *transfer = FindBlockTransfer(aRequest.GetMessage());
+
+        if (transfer != nullptr)
+        {
+            if (transfer->mOutstanding > 0)
+            {
+                transfer->mOutstanding--;
+            }
+
+            // Grow the window by one for every successfully received
+            // block, up to the configured maximum.
+
+            if (transfer->mWindow < BlockTransfer::kMaxWindow)
+            {
+                transfer->mWindow++;
+            }
+        }
+        else
+        {
+            transfer = StartBlockTransfer(aRequest.GetMessage(), msgBlockInfo.mBlockNumber + 1);
+        }
+
+        if (transfer != nullptr)
+        {
+            SuccessOrExit(error = SendPipelinedBlock2Requests(*transfer, aRequest, aRxMsg, msgBlockInfo));
+            mPendingRequests.Remove(aRequest);
+            ExitNow();
+        }
+    }
+#endif
+
     VerifyOrExit((request = NewMessage()) != nullptr, error = kErrorNoBufs);
 
     requestBlockInfo = msgBlockInfo;
@@ -1195,6 +1284,128 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW > 1
+
+bool CoapBase::BlockTransfer::Matches(const Message &aMessage) const
+{
+    Token token;
+
+    return (aMessage.ReadToken(token) == kErrorNone) && (token == mToken);
+}
+
+CoapBase::BlockTransfer *CoapBase::FindBlockTransfer(const Message &aMessage)
+{
+    return IsActiveBlockTransfer(aMessage) ? &mBlockTransfer : nullptr;
+}
+
+CoapBase::BlockTransfer *CoapBase::StartBlockTransfer(const Message &aMessage, uint32_t aNextBlockNumber)
+{
+    BlockTransfer *transfer = nullptr;
+
+    VerifyOrExit(!mBlockTransfer.mInUse);
+    SuccessOrExit(aMessage.ReadToken(mBlockTransfer.mToken));
+
+    mBlockTransfer.mInUse           = true;
+    mBlockTransfer.mNextBlockNumber = aNextBlockNumber;
+    mBlockTransfer.mOutstanding     = 0;
+    mBlockTransfer.mWindow          = BlockTransfer::kInitialWindow;
+
+    transfer = &mBlockTransfer;
+
+exit:
+    return transfer;
+}
+
+void CoapBase::EndBlockTransfer(const Message &aMessage)
+{
+    VerifyOrExit(IsActiveBlockTransfer(aMessage));
+
+    mBlockTransfer.mInUse = false;
+
+    // The transfer has concluded. Silently drop any sibling block
+    // requests (sharing the transfer token) still awaiting a response,
+    // such as speculative requests for blocks beyond the last one.
+
+    mPendingRequests.RemoveRequestsMatchingToken(aMessage);
+
+exit:
+    return;
+}
+
+void CoapBase::HandleBlockTransferRetransmit(const Message &aMessage)
+{
+    VerifyOrExit(IsActiveBlockTransfer(aMessage));
+
+    // A retransmission signals congestion or loss on the path; collapse
+    // the pipeline window back to its initial value.
+
+    mBlockTransfer.mWindow = BlockTransfer::kInitialWindow;
+
+exit:
+    return;
+}
+
+Error CoapBase::SendPipelinedBlock2Requests(BlockTransfer &aTransfer, Request &aRequest, Msg &aRxMsg,
+                                            BlockInfo aBlockInfo)
+{
+    Error         error = kErrorNone;
+    SendCallbacks callbacks;
+
+    callbacks                        = aRequest.GetCallbacks();
+    callbacks.mBlockwiseTransmitHook = nullptr;
+
+    aBlockInfo.mMoreBlocks = false; // RFC 7959 Section 2.3 second bullet: MUST be 0 in request.
+
+    while (aTransfer.mOutstanding < aTransfer.mWindow)
+    {
+        Message *request = nullptr;
+
+        aBlockInfo.mBlockNumber = aTransfer.mNextBlockNumber;
+
+        if ((request = NewMessage()) == nullptr)
+        {
+            error = kErrorNoBufs;
+            break;
+        }
+
+        error = PrepareNextBlockRequest(kOptionBlock2, aRequest, *request, aBlockInfo);
+
+        if (error == kErrorNone)
+        {
+            error = SendMessage(*request, aRxMsg.mMessageInfo, /* aTxParameters */ nullptr, callbacks);
+        }
+
+        if (error != kErrorNone)
+        {
+            request->Free();
+            break;
+        }
+
+        LogInfo("Request Block2 Nr. %d, Size: %d bytes", aBlockInfo.mBlockNumber, aBlockInfo.GetBlockSize());
+
+        aTransfer.mNextBlockNumber++;
+        aTransfer.mOutstanding++;
+    }
+
+    // Keep the transfer going as long as at least one block request
+    // remains in flight; a failed speculative send only shrinks the
+    // effective window. The transfer fails only when nothing could be
+    // sent, in which case the caller finalizes the request.
+
+    if (aTransfer.mOutstanding > 0)
+    {
+        error = kErrorNone;
+    }
+    else
+    {
+        aTransfer.mInUse = false;
+    }
+
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW > 1
+
 Error CoapBase::ProcessBlock1Request(Msg &aRxMsg, const ResourceBlockWise &aResource, uint32_t aTotalLength)
 {
     Error       error    = kErrorNone;
@@ -1508,6 +1719,7 @@ void CoapBase::Request::UpdateRetxCounterAndTimeout(TimeMilli aNow)
 
     mMetadata.mTimerFireTime = aNow + mMetadata.mRetxTimeout;
     WriteMetadataInMessage();
+    mMessage->SetTimestamp(mMetadata.mTimerFireTime);
 }
 
 #if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
@@ -1554,6 +1766,12 @@ Error CoapBase::PendingRequests::Add(const Msg           &aTxMsg,
 
     SuccessOrExit(error = aRequest.AppendMetadataToMessage());
 
+    // The message timestamp mirrors the metadata `mTimerFireTime`,
+    // allowing `HandleTimer()` to determine whether a request is due
+    // without reading the metadata footer from the message buffers.
+
+    aRequest.mMessage->SetTimestamp(aRequest.GetTimerFireTime());
+
     mRequestMessages.Enqueue(*aRequest.mMessage);
 
     mTimer.FireAtIfEarlier(aRequest.GetTimerFireTime());
@@ -1563,6 +1781,15 @@ exit:
     return error;
 }
 
+uint16_t CoapBase::PendingRequests::GetCount(void) const
+{
+    MessageQueue::Info info;
+
+    mRequestMessages.GetInfo(info);
+
+    return info.mNumMessages;
+}
+
 void CoapBase::PendingRequests::Remove(Request &aRequest)
 {
     VerifyOrExit(aRequest.HasMessage());
@@ -1622,6 +1849,10 @@ void CoapBase::PendingRequests::FinalizeRequest(Request &aRequest, Error aResult
 {
     VerifyOrExit(aRequest.HasMessage());
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE && (OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW > 1)
+    mCoapBase.EndBlockTransfer(aRequest.GetMessage());
+#endif
+
     Remove(aRequest);
     aRequest.InvokeResponseHandler(aResponse, aResult);
 
@@ -1671,17 +1902,51 @@ Error CoapBase::PendingRequests::AbortAllMatching(const Matcher &aMatcher)
 
 void CoapBase::PendingRequests::FinalizeRemovedRequestsIn(MessageQueue &aQueue, Error aResult)
 {
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE && (OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW > 1)
+    const Message *endedTransferMessage = nullptr;
+#endif
+
     for (Message &message : aQueue)
     {
         Request request;
 
         request.InitFrom(message);
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE && (OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW > 1)
+        if ((endedTransferMessage != nullptr) && message.HasSameTokenAs(*endedTransferMessage))
+        {
+            // Sibling request of a pipelined block transfer that was
+            // already finalized in this pass; invoke the response
+            // handler only once per transfer.
+            continue;
+        }
+
+        if (mCoapBase.IsActiveBlockTransfer(message))
+        {
+            mCoapBase.EndBlockTransfer(message);
+            endedTransferMessage = &message;
+        }
+#endif
+
         request.InvokeResponseHandler(/* aResponse */ nullptr, aResult);
     }
 
     aQueue.DequeueAndFreeAll();
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE && (OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW > 1)
+void CoapBase::PendingRequests::RemoveRequestsMatchingToken(const Message &aMessage)
+{
+    for (Message &message : mRequestMessages)
+    {
+        if ((&message != &aMessage) && message.HasSameTokenAs(aMessage))
+        {
+            mRequestMessages.DequeueAndFree(message);
+        }
+    }
+}
+#endif
+
 void CoapBase::PendingRequests::RetransmitRequest(const Request &aRequest)
 {
     Error            error;
@@ -1713,6 +1978,16 @@ void CoapBase::PendingRequests::HandleTimer(void)
     {
         Request request;
 
+        // The message timestamp mirrors the metadata `mTimerFireTime`,
+        // so requests that are not yet due can be skipped without
+        // reading the metadata footer from the message buffers.
+
+        if (nextTime.GetNow() < message.GetTimestamp())
+        {
+            nextTime.UpdateIfEarlier(message.GetTimestamp());
+            continue;
+        }
+
         request.InitFrom(message);
 
 #if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
@@ -1745,6 +2020,9 @@ void CoapBase::PendingRequests::HandleTimer(void)
             if (!request.IsAcknowledged())
             {
                 RetransmitRequest(request);
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE && (OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW > 1)
+                mCoapBase.HandleBlockTransferRetransmit(request.GetMessage());
+#endif
             }
         }
 
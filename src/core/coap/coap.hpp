@@ -555,6 +555,55 @@ public:
      */
     Error SendMessage(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
+    /**
+     * Sends a copy of an already prepared CoAP message, optionally rewriting its token.
+     *
+     * This method is intended for fanning out the same notification to many destinations (e.g., CoAP observers):
+     * the message (header, options, and payload) is prepared and serialized once, and a copy is cloned and sent per
+     * destination, avoiding re-building and re-serializing the payload for every recipient. The clone is assigned a
+     * fresh Message ID by `SendMessage()`; @p aMessage itself is left unchanged and stays owned by the caller.
+     *
+     * When @p aToken is not `nullptr`, the copy's token is rewritten to @p aToken (e.g., the token from an observer's
+     * registration). The new token MUST have the same length as the token in @p aMessage.
+     *
+     * @param[in]  aMessage      A reference to the prepared message to copy and send.
+     * @param[in]  aMessageInfo  A reference to the message info (destination) for this copy.
+     * @param[in]  aToken        A pointer to the token to use in the copy, or `nullptr` to keep the original token.
+     * @param[in]  aHandler      A function pointer that shall be called on response reception or time-out.
+     * @param[in]  aContext      A pointer to arbitrary context information.
+     *
+     * @retval kErrorNone         Successfully sent a copy of the CoAP message.
+     * @retval kErrorInvalidArgs  The length of @p aToken differs from the token length in @p aMessage.
+     * @retval kErrorNoBufs       Insufficient buffers available to send the CoAP message copy.
+     */
+    Error SendCopy(const Message          &aMessage,
+                   const Ip6::MessageInfo &aMessageInfo,
+                   const Token            *aToken,
+                   ResponseHandler         aHandler,
+                   void                   *aContext);
+
+    /**
+     * Sends a copy of an already prepared CoAP message using the `ResponseHandlerSeparateParams` handler type.
+     *
+     * This variant of `SendCopy()` is intended for use by the public OT CoAP APIs, `otCoap*`, and should not be used
+     * within the OpenThread core modules.
+     *
+     * @param[in]  aMessage      A reference to the prepared message to copy and send.
+     * @param[in]  aMessageInfo  A reference to the message info (destination) for this copy.
+     * @param[in]  aToken        A pointer to the token to use in the copy, or `nullptr` to keep the original token.
+     * @param[in]  aHandler      A function pointer that shall be called on response reception or time-out.
+     * @param[in]  aContext      A pointer to arbitrary context information.
+     *
+     * @retval kErrorNone         Successfully sent a copy of the CoAP message.
+     * @retval kErrorInvalidArgs  The length of @p aToken differs from the token length in @p aMessage.
+     * @retval kErrorNoBufs       Insufficient buffers available to send the CoAP message copy.
+     */
+    Error SendCopyWithResponseHandlerSeparateParams(const Message                &aMessage,
+                                                    const Ip6::MessageInfo       &aMessageInfo,
+                                                    const Token                  *aToken,
+                                                    ResponseHandlerSeparateParams aHandler,
+                                                    void                         *aContext);
+
     /**
      * Sends a CoAP message with default transmission parameters.
      *
@@ -678,6 +727,13 @@ public:
      */
     void GetRequestAndCachedResponsesQueueInfo(MessageQueue::Info &aQueueInfo) const;
 
+    /**
+     * Gets the number of pending CoAP requests awaiting a response, acknowledgment, or retransmission.
+     *
+     * @returns The number of pending requests.
+     */
+    uint16_t GetPendingRequestCount(void) const { return mPendingRequests.GetCount(); }
+
     /**
      * Sends a CoAP message with custom transmission parameters using `ResponseHandlerSeparateParams` handle type.
      *
@@ -898,6 +954,12 @@ private:
         Error AbortRequestsMatching(ResponseHandler aHandler, void *aContext);
         void  GetInfo(MessageQueue::Info &aInfo) const { mRequestMessages.GetInfo(aInfo); }
 
+        uint16_t GetCount(void) const;
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE && (OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW > 1)
+        void RemoveRequestsMatchingToken(const Message &aMessage);
+#endif
+
     private:
         class Matcher
         {
@@ -977,6 +1039,10 @@ private:
                          const Ip6::MessageInfo &aMessageInfo,
                          const TxParameters     *aTxParameters,
                          const SendCallbacks    &aCallbacks);
+    Error    SendCopy(const Message          &aMessage,
+                      const Ip6::MessageInfo &aMessageInfo,
+                      const Token            *aToken,
+                      const SendCallbacks    &aCallbacks);
     Error    Transmit(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
@@ -997,6 +1063,36 @@ private:
 
     static Error DetermineBlockSzxFromSize(uint16_t aSize, BlockSzx &aBlockSzx);
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW > 1
+    // Tracks a pipelined Block2 transfer, where up to `mWindow` block
+    // requests (sharing the transfer token) are kept in flight at the
+    // same time.
+    struct BlockTransfer
+    {
+        static constexpr uint8_t kInitialWindow = 2;
+        static constexpr uint8_t kMaxWindow     = OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW;
+
+        bool Matches(const Message &aMessage) const;
+
+        Token    mToken;
+        uint32_t mNextBlockNumber;
+        uint8_t  mOutstanding;
+        uint8_t  mWindow;
+        bool     mInUse;
+    };
+
+    bool IsActiveBlockTransfer(const Message &aMessage) const
+    {
+        return mBlockTransfer.mInUse && mBlockTransfer.Matches(aMessage);
+    }
+
+    BlockTransfer *FindBlockTransfer(const Message &aMessage);
+    BlockTransfer *StartBlockTransfer(const Message &aMessage, uint32_t aNextBlockNumber);
+    void           EndBlockTransfer(const Message &aMessage);
+    void           HandleBlockTransferRetransmit(const Message &aMessage);
+    Error SendPipelinedBlock2Requests(BlockTransfer &aTransfer, Request &aRequest, Msg &aRxMsg, BlockInfo aBlockInfo);
+#endif
+
 #endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 
     PendingRequests            mPendingRequests;
@@ -1011,6 +1107,9 @@ private:
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
     LinkedList<ResourceBlockWise> mBlockWiseResources;
     Message                      *mLastResponse;
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW > 1
+    BlockTransfer mBlockTransfer;
+#endif
 #endif
 };
 
@@ -66,6 +66,58 @@ Error Appender::AppendBytes(const void *aBuffer, uint16_t aLength)
     return error;
 }
 
+Error Appender::ReserveBytes(uint16_t aLength, uint16_t &aOffset)
+{
+    Error    error    = kErrorNone;
+    uint16_t reserved = 0;
+    uint8_t  zeros[16];
+
+    memset(zeros, 0, sizeof(zeros));
+
+    aOffset = GetAppendedLength();
+
+    while (reserved < aLength)
+    {
+        uint16_t length = Min(static_cast<uint16_t>(sizeof(zeros)), static_cast<uint16_t>(aLength - reserved));
+
+        SuccessOrExit(error = AppendBytes(zeros, length));
+        reserved += length;
+    }
+
+exit:
+    if (error != kErrorNone)
+    {
+        // Remove any partially appended placeholder bytes.
+
+        switch (mType)
+        {
+        case kMessage:
+            IgnoreError(mShared.mMessage.mMessage->SetLength(mShared.mMessage.mStartOffset + aOffset));
+            break;
+
+        case kBuffer:
+            mShared.mFrameBuilder.RemoveBytes(aOffset, reserved);
+            break;
+        }
+    }
+
+    return error;
+}
+
+void Appender::WriteBytes(uint16_t aOffset, const void *aBuffer, uint16_t aLength)
+{
+    switch (mType)
+    {
+    case kMessage:
+        mShared.mMessage.mMessage->WriteBytes(mShared.mMessage.mStartOffset + aOffset, aBuffer, aLength);
+        break;
+
+    case kBuffer:
+        mShared.mFrameBuilder.WriteBytes(aOffset, aBuffer, aLength);
+        break;
+    }
+}
+
 uint16_t Appender::GetAppendedLength(void) const
 {
     uint16_t length = 0;
@@ -117,6 +117,55 @@ public:
         return AppendBytes(&aObject, sizeof(ObjectType));
     }
 
+    /**
+     * Reserves a range of bytes in the appended content to be written later.
+     *
+     * Appends @p aLength placeholder (zero) bytes and outputs in @p aOffset the offset of the reserved range
+     * (relative to the start of the appended content). The caller can continue appending and later commit the
+     * final bytes into the reserved range using `WriteBytes()` or `Write()`. This allows content such as a TLV
+     * or record header, whose length is not known until its value is appended, to be constructed in a single
+     * pass without first measuring the value length.
+     *
+     * If the reservation fails, any partially appended placeholder bytes are removed.
+     *
+     * @param[in]  aLength   The number of bytes to reserve.
+     * @param[out] aOffset   A reference to return the offset of the reserved range.
+     *
+     * @retval kErrorNone    Successfully reserved the range.
+     * @retval kErrorNoBufs  Insufficient available buffers.
+     */
+    Error ReserveBytes(uint16_t aLength, uint16_t &aOffset);
+
+    /**
+     * Overwrites previously appended content at a given offset.
+     *
+     * The given range MUST lie fully within the already appended content, i.e., @p aOffset plus @p aLength MUST
+     * not be beyond the appended length. @p aOffset is relative to the start of the appended content (zero
+     * corresponds to the first appended byte).
+     *
+     * @param[in] aOffset  The offset within the appended content to begin writing.
+     * @param[in] aBuffer  A pointer to a data buffer (MUST NOT be `nullptr`) to write.
+     * @param[in] aLength  The number of bytes to write.
+     */
+    void WriteBytes(uint16_t aOffset, const void *aBuffer, uint16_t aLength);
+
+    /**
+     * Overwrites previously appended content with an object at a given offset.
+     *
+     * The object MUST lie fully within the already appended content (see `WriteBytes()`).
+     *
+     * @tparam    ObjectType   The object type to write.
+     *
+     * @param[in] aOffset      The offset within the appended content to begin writing.
+     * @param[in] aObject      A reference to the object to write.
+     */
+    template <typename ObjectType> void Write(uint16_t aOffset, const ObjectType &aObject)
+    {
+        static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+
+        WriteBytes(aOffset, &aObject, sizeof(ObjectType));
+    }
+
     /**
      * Returns the number of bytes appended so far using `Appender` methods.
      *
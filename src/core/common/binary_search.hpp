@@ -75,6 +75,30 @@ public:
             Find(&aKey, &aTable[0], kLength, sizeof(aTable[0]), BinarySearch::Compare<Key, Entry>));
     }
 
+    /**
+     * Performs binary search in a sorted array (given by a pointer and length) to find an entry matching a given key.
+     *
+     * @note This method requires the array to be sorted, otherwise its behavior is undefined.
+     *
+     * This variant is intended for use with dynamically sized arrays where the length is not known at compile time.
+     * The `Entry` class MUST provide the same `Compare()` method as described in `Find(aKey, aTable)`.
+     *
+     * @tparam Key         The type of `Key` to search for.
+     * @tparam Entry       The array `Entry` type.
+     *
+     * @param[in] aKey      The key to search for within the array.
+     * @param[in] aEntries  A pointer to the array of entries (MUST be sorted). Can be `nullptr` if @p aLength is zero.
+     * @param[in] aLength   The number of entries in the array.
+     *
+     * @returns A pointer to the entry in the array if a match is found, otherwise `nullptr` (no match in array).
+     */
+    template <typename Key, typename Entry>
+    static const Entry *Find(const Key &aKey, const Entry *aEntries, uint16_t aLength)
+    {
+        return static_cast<const Entry *>(
+            Find(&aKey, aEntries, aLength, sizeof(Entry), BinarySearch::Compare<Key, Entry>));
+    }
+
     /**
      * Indicates whether a given table array is sorted based or not.
      *
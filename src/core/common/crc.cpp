@@ -72,15 +72,13 @@ template <typename UintType> UintType CrcCalculator<UintType>::FeedBytes(const v
 template <typename UintType>
 UintType CrcCalculator<UintType>::Feed(const Message &aMessage, const OffsetRange &aOffsetRange)
 {
-    uint16_t       length = aOffsetRange.GetLength();
-    Message::Chunk chunk;
+    Message::ChunkIterator iterator(aMessage, aOffsetRange);
+    const uint8_t         *bytes;
+    uint16_t               length;
 
-    aMessage.GetFirstChunk(aOffsetRange.GetOffset(), length, chunk);
-
-    while (chunk.GetLength() > 0)
+    while (iterator.GetNextChunk(bytes, length))
     {
-        FeedBytes(chunk.GetBytes(), chunk.GetLength());
-        aMessage.GetNextChunk(length, chunk);
+        FeedBytes(bytes, length);
     }
 
     return mCrc;
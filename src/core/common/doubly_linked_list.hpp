@@ -0,0 +1,368 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a generic intrusive doubly linked list.
+ */
+
+#ifndef OT_CORE_COMMON_DOUBLY_LINKED_LIST_HPP_
+#define OT_CORE_COMMON_DOUBLY_LINKED_LIST_HPP_
+
+#include "openthread-core-config.h"
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+#include "common/iterator_utils.hpp"
+
+namespace ot {
+
+/**
+ * @addtogroup core-linked-list
+ *
+ * @{
+ */
+
+/**
+ * Represents a doubly linked list entry.
+ *
+ * Provides methods to get and set the next and previous entries in the linked list.
+ *
+ * Users of this class should follow CRTP-style inheritance, i.e., the `Type` class itself should publicly inherit
+ * from `DoublyLinkedListEntry<Type>`.
+ *
+ * The template type `Type` should contain `mNext` and `mPrev` member variables. Both should be of a type that can be
+ * down-casted to `Type` itself.
+ */
+template <class Type> class DoublyLinkedListEntry
+{
+public:
+    /**
+     * Gets the next entry in the linked list.
+     *
+     * @returns A pointer to the next entry in the linked list or `nullptr` if at the end of the list.
+     */
+    const Type *GetNext(void) const { return static_cast<const Type *>(static_cast<const Type *>(this)->mNext); }
+
+    /**
+     * Gets the next entry in the linked list.
+     *
+     * @returns A pointer to the next entry in the linked list or `nullptr` if at the end of the list.
+     */
+    Type *GetNext(void) { return static_cast<Type *>(static_cast<Type *>(this)->mNext); }
+
+    /**
+     * Gets the previous entry in the linked list.
+     *
+     * @returns A pointer to the previous entry in the linked list or `nullptr` if at the head of the list.
+     */
+    const Type *GetPrev(void) const { return static_cast<const Type *>(static_cast<const Type *>(this)->mPrev); }
+
+    /**
+     * Gets the previous entry in the linked list.
+     *
+     * @returns A pointer to the previous entry in the linked list or `nullptr` if at the head of the list.
+     */
+    Type *GetPrev(void) { return static_cast<Type *>(static_cast<Type *>(this)->mPrev); }
+
+    /**
+     * Sets the next pointer on the entry.
+     *
+     * @param[in] aNext  A pointer to the next entry.
+     */
+    void SetNext(Type *aNext) { static_cast<Type *>(this)->mNext = aNext; }
+
+    /**
+     * Sets the previous pointer on the entry.
+     *
+     * @param[in] aPrev  A pointer to the previous entry.
+     */
+    void SetPrev(Type *aPrev) { static_cast<Type *>(this)->mPrev = aPrev; }
+};
+
+/**
+ * Represents a doubly linked list.
+ *
+ * Unlike `LinkedList`, removal of an entry known to be in the list is O(1) and does not require walking the list to
+ * find the predecessor, making this container suitable for queues where entries are frequently removed from the
+ * middle. The cost is one extra pointer per entry. Lists whose entries are only pushed, popped, or iterated are
+ * better served by the singly linked `LinkedList`.
+ *
+ * The template type `Type` should provide `GetNext()`, `SetNext()`, `GetPrev()`, and `SetPrev()` methods (which can
+ * be realized by `Type` inheriting from `DoublyLinkedListEntry<Type>` class).
+ */
+template <typename Type> class DoublyLinkedList
+{
+    class Iterator;
+    class ConstIterator;
+
+public:
+    /**
+     * Initializes the linked list.
+     */
+    DoublyLinkedList(void)
+        : mHead(nullptr)
+    {
+    }
+
+    /**
+     * Returns the entry at the head of the linked list.
+     *
+     * @returns Pointer to the entry at the head of the linked list, or `nullptr` if the list is empty.
+     */
+    Type *GetHead(void) { return mHead; }
+
+    /**
+     * Returns the entry at the head of the linked list.
+     *
+     * @returns Pointer to the entry at the head of the linked list, or `nullptr` if the list is empty.
+     */
+    const Type *GetHead(void) const { return mHead; }
+
+    /**
+     * Clears the linked list.
+     */
+    void Clear(void) { mHead = nullptr; }
+
+    /**
+     * Indicates whether the linked list is empty or not.
+     *
+     * @retval TRUE   If the linked list is empty.
+     * @retval FALSE  If the linked list is not empty.
+     */
+    bool IsEmpty(void) const { return (mHead == nullptr); }
+
+    /**
+     * Pushes an entry at the head of the linked list.
+     *
+     * @param[in] aEntry   A reference to an entry to push at the head of linked list.
+     */
+    void Push(Type &aEntry)
+    {
+        aEntry.SetNext(mHead);
+        aEntry.SetPrev(nullptr);
+
+        if (mHead != nullptr)
+        {
+            mHead->SetPrev(&aEntry);
+        }
+
+        mHead = &aEntry;
+    }
+
+    /**
+     * Pushes an entry after a given previous existing entry in the linked list.
+     *
+     * @param[in] aEntry       A reference to an entry to push into the list.
+     * @param[in] aPrevEntry   A reference to a previous entry (new entry @p aEntry will be pushed after this).
+     */
+    void PushAfter(Type &aEntry, Type &aPrevEntry)
+    {
+        AssertLinked(aPrevEntry);
+
+        aEntry.SetNext(aPrevEntry.GetNext());
+        aEntry.SetPrev(&aPrevEntry);
+
+        if (aPrevEntry.GetNext() != nullptr)
+        {
+            aPrevEntry.GetNext()->SetPrev(&aEntry);
+        }
+
+        aPrevEntry.SetNext(&aEntry);
+    }
+
+    /**
+     * Pops an entry from head of the linked list.
+     *
+     * @note This method does not change the popped entry itself, i.e., the popped entry next and previous pointers
+     * stay as before.
+     *
+     * @returns The entry that was popped if the list is not empty, or `nullptr` if the list is empty.
+     */
+    Type *Pop(void)
+    {
+        Type *entry = mHead;
+
+        if (mHead != nullptr)
+        {
+            mHead = mHead->GetNext();
+
+            if (mHead != nullptr)
+            {
+                mHead->SetPrev(nullptr);
+            }
+        }
+
+        return entry;
+    }
+
+    /**
+     * Removes an entry from the linked list.
+     *
+     * The entry MUST be present in the list. Unlike `LinkedList::Remove()`, this method does not walk the list and
+     * runs in O(1).
+     *
+     * @note This method does not change the removed entry itself, i.e., the removed entry next and previous pointers
+     * stay as before.
+     *
+     * @param[in] aEntry   A reference to an entry to remove.
+     */
+    void Remove(Type &aEntry)
+    {
+        AssertLinked(aEntry);
+
+        if (aEntry.GetPrev() != nullptr)
+        {
+            aEntry.GetPrev()->SetNext(aEntry.GetNext());
+        }
+        else
+        {
+            mHead = aEntry.GetNext();
+        }
+
+        if (aEntry.GetNext() != nullptr)
+        {
+            aEntry.GetNext()->SetPrev(aEntry.GetPrev());
+        }
+    }
+
+    /**
+     * Moves all entries from another linked list to the head of this list.
+     *
+     * @param[in] aList   The list to move entries from (will be empty after this call).
+     */
+    void TakeAllFrom(DoublyLinkedList &aList)
+    {
+        if (!aList.IsEmpty())
+        {
+            Type *tail = aList.GetHead();
+
+            while (tail->GetNext() != nullptr)
+            {
+                tail = tail->GetNext();
+            }
+
+            tail->SetNext(mHead);
+
+            if (mHead != nullptr)
+            {
+                mHead->SetPrev(tail);
+            }
+
+            mHead = aList.GetHead();
+            aList.Clear();
+        }
+    }
+
+    /**
+     * Indicates whether the linked list contains a given entry.
+     *
+     * @param[in] aEntry   A reference to an entry.
+     *
+     * @retval TRUE   The linked list contains @p aEntry.
+     * @retval FALSE  The linked list does not contain @p aEntry.
+     */
+    bool Contains(const Type &aEntry) const
+    {
+        bool contains = false;
+
+        for (const Type &entry : *this)
+        {
+            if (&entry == &aEntry)
+            {
+                contains = true;
+                break;
+            }
+        }
+
+        return contains;
+    }
+
+    // The following methods are intended to support range-based `for`
+    // loop iteration over the linked-list entries and should not be
+    // used directly.
+
+    Iterator begin(void) { return Iterator(GetHead()); }
+    Iterator end(void) { return Iterator(nullptr); }
+
+    ConstIterator begin(void) const { return ConstIterator(GetHead()); }
+    ConstIterator end(void) const { return ConstIterator(nullptr); }
+
+private:
+    // Checks (under `OPENTHREAD_CONFIG_ASSERT_ENABLE`) that the next
+    // and previous pointers of a supposedly linked entry agree with
+    // its neighbors and the list head. This catches removal of an
+    // entry from the wrong list and use of stale link pointers.
+    void AssertLinked(const Type &aEntry) const
+    {
+        OT_UNUSED_VARIABLE(aEntry);
+
+        OT_ASSERT((aEntry.GetPrev() != nullptr) ? (aEntry.GetPrev()->GetNext() == &aEntry) : (mHead == &aEntry));
+        OT_ASSERT((aEntry.GetNext() == nullptr) || (aEntry.GetNext()->GetPrev() == &aEntry));
+    }
+
+    class Iterator : public ItemPtrIterator<Type, Iterator>
+    {
+        friend class DoublyLinkedList;
+        friend class ItemPtrIterator<Type, Iterator>;
+
+        using ItemPtrIterator<Type, Iterator>::mItem;
+
+        explicit Iterator(Type *aItem)
+            : ItemPtrIterator<Type, Iterator>(aItem)
+        {
+        }
+
+        void Advance(void) { mItem = mItem->GetNext(); }
+    };
+
+    class ConstIterator : public ItemPtrIterator<const Type, ConstIterator>
+    {
+        friend class DoublyLinkedList;
+        friend class ItemPtrIterator<const Type, ConstIterator>;
+
+        using ItemPtrIterator<const Type, ConstIterator>::mItem;
+
+        explicit ConstIterator(const Type *aItem)
+            : ItemPtrIterator<const Type, ConstIterator>(aItem)
+        {
+        }
+
+        void Advance(void) { mItem = mItem->GetNext(); }
+    };
+
+    Type *mHead;
+};
+
+/**
+ * @}
+ */
+
+} // namespace ot
+
+#endif // OT_CORE_COMMON_DOUBLY_LINKED_LIST_HPP_
@@ -96,6 +96,18 @@ exit:
     return error;
 }
 
+Error FrameData::ReadBytesInPlace(const uint8_t *&aBufferPtr, uint16_t aLength)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(CanRead(aLength), error = kErrorParse);
+    aBufferPtr = GetBytes();
+    SkipOver(aLength);
+
+exit:
+    return error;
+}
+
 void FrameData::SkipOver(uint16_t aLength) { Init(GetBytes() + aLength, GetLength() - aLength); }
 
 } // namespace ot
@@ -36,6 +36,7 @@
 
 #include "openthread-core-config.h"
 
+#include "common/code_utils.hpp"
 #include "common/data.hpp"
 #include "common/type_traits.hpp"
 
@@ -151,6 +152,62 @@ public:
         return ReadBytes(&aObject, sizeof(ObjectType));
     }
 
+    /**
+     * Reads a given number of bytes from the `FrameData` in place, returning a pointer into the frame buffer.
+     *
+     * If read successfully, @p aBufferPtr points into the frame buffer (no copy is performed) and the `FrameData`
+     * is updated to skip over the read content. The returned pointer remains valid as long as the frame buffer
+     * itself.
+     *
+     * @param[out] aBufferPtr  A reference to a pointer to return the location of the read bytes.
+     * @param[in]  aLength     Number of bytes to read.
+     *
+     * @retval kErrorNone   Successfully read @p aLength bytes in place and skipped over them.
+     * @retval kErrorParse  Not enough bytes remaining to read @p aLength.
+     */
+    Error ReadBytesInPlace(const uint8_t *&aBufferPtr, uint16_t aLength);
+
+    /**
+     * Reads an object from the `FrameData`, avoiding a copy when possible.
+     *
+     * If read successfully, @p aObjectPtr points either directly into the frame buffer (when the read position
+     * satisfies the alignment requirement of `ObjectType`, or when the platform supports unaligned access, i.e.,
+     * `OPENTHREAD_CONFIG_PLATFORM_UNALIGNED_ACCESS_ENABLE` is enabled), or at @p aFallbackObject after copying
+     * the read content into it. In either case the `FrameData` is updated to skip over the read content.
+     *
+     * @tparam     ObjectType       The object type to read from the frame.
+     *
+     * @param[out] aObjectPtr       A reference to a pointer to return the location of the read object.
+     * @param[out] aFallbackObject  A reference to an object used as copy destination when an in-place read is not
+     *                              possible.
+     *
+     * @retval kErrorNone   Successfully read the object and skipped over the read content.
+     * @retval kErrorParse  Not enough bytes remaining to read the entire object.
+     */
+    template <typename ObjectType> Error ReadAs(const ObjectType *&aObjectPtr, ObjectType &aFallbackObject)
+    {
+        static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+
+        Error error = kErrorParse;
+
+        if (CanRead(sizeof(ObjectType)))
+        {
+            if (IsInPlaceReadAligned(alignof(ObjectType)))
+            {
+                aObjectPtr = reinterpret_cast<const ObjectType *>(GetBytes());
+                SkipOver(sizeof(ObjectType));
+                error = kErrorNone;
+            }
+            else
+            {
+                aObjectPtr = &aFallbackObject;
+                error      = Read(aFallbackObject);
+            }
+        }
+
+        return error;
+    }
+
     /**
      * Skips over a given number of bytes from `FrameData`.
      *
@@ -160,6 +217,17 @@ public:
      * @param[in] aLength   The length (number of bytes) to skip over.
      */
     void SkipOver(uint16_t aLength);
+
+private:
+    bool IsInPlaceReadAligned(size_t aAlignment) const
+    {
+#if OPENTHREAD_CONFIG_PLATFORM_UNALIGNED_ACCESS_ENABLE
+        OT_UNUSED_VARIABLE(aAlignment);
+        return true;
+#else
+        return (reinterpret_cast<uintptr_t>(GetBytes()) % aAlignment) == 0;
+#endif
+    }
 };
 
 } // namespace ot
@@ -52,5 +52,38 @@ void Free(void *aPointer) { Instance::GetHeap().Free(aPointer); }
 
 #endif // OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
 
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+
+// The heap itself is shared across instances, so the per-owner
+// accounting is kept in static (process-wide) state as well.
+
+struct OwnerStats
+{
+    uint16_t mNumObjects;
+    uint32_t mBytes;
+};
+
+static OwnerStats sOwnerStats[kNumOwners];
+
+void RecordAllocation(Owner aOwner, uint16_t aSize)
+{
+    sOwnerStats[aOwner].mNumObjects++;
+    sOwnerStats[aOwner].mBytes += aSize;
+}
+
+void RecordFree(Owner aOwner, uint16_t aSize)
+{
+    sOwnerStats[aOwner].mNumObjects--;
+    sOwnerStats[aOwner].mBytes -= aSize;
+}
+
+void GetOwnerStats(Owner aOwner, uint16_t &aNumObjects, uint32_t &aBytes)
+{
+    aNumObjects = sOwnerStats[aOwner].mNumObjects;
+    aBytes      = sOwnerStats[aOwner].mBytes;
+}
+
+#endif // OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+
 } // namespace Heap
 } // namespace ot
@@ -61,6 +61,51 @@ void *CAlloc(size_t aCount, size_t aSize);
  */
 void Free(void *aPointer);
 
+/**
+ * Represents the module owning a heap allocation, used for per-owner memory accounting.
+ *
+ * Modules without their own entry use `kOwnerOther`.
+ */
+enum Owner : uint8_t
+{
+    kOwnerOther,         ///< Other (untagged) modules.
+    kOwnerDns,           ///< DNS modules (mDNS).
+    kOwnerSrp,           ///< SRP server modules (including advertising proxy).
+    kOwnerMeshCoP,       ///< MeshCoP modules (border agent).
+    kOwnerTrel,          ///< TREL radio link module.
+    kOwnerBorderRouting, ///< Border routing modules.
+    kNumOwners,          ///< Number of owners.
+};
+
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+
+/**
+ * Records a heap allocation against a given owner module.
+ *
+ * @param[in] aOwner   The owner module.
+ * @param[in] aSize    The allocation size (in bytes).
+ */
+void RecordAllocation(Owner aOwner, uint16_t aSize);
+
+/**
+ * Records the free of a previously recorded heap allocation of a given owner module.
+ *
+ * @param[in] aOwner   The owner module.
+ * @param[in] aSize    The allocation size (in bytes).
+ */
+void RecordFree(Owner aOwner, uint16_t aSize);
+
+/**
+ * Gets the per-owner accounting stats for a given owner module.
+ *
+ * @param[in]  aOwner        The owner module.
+ * @param[out] aNumObjects   A reference to output the number of live objects.
+ * @param[out] aBytes        A reference to output the total bytes held by the live objects.
+ */
+void GetOwnerStats(Owner aOwner, uint16_t &aNumObjects, uint32_t &aBytes);
+
+#endif // OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+
 } // namespace Heap
 } // namespace ot
 
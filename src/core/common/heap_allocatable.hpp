@@ -54,8 +54,11 @@ namespace Heap {
  *
  * The `Type` class destructor is used when `Free()` is called. The destructor frees any heap allocated data members
  * that are stored in a `Type` instance (e.g., `Heap::String`, `Heap::Data`, etc).
+ *
+ * The optional `kOwner` template parameter tags the allocations with the owner module for per-owner memory accounting
+ * (when `OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE` is used). Untagged allocations are attributed to `kOwnerOther`.
  */
-template <class Type> class Allocatable
+template <class Type, Owner kOwner = kOwnerOther> class Allocatable
 {
 public:
     /**
@@ -72,6 +75,13 @@ public:
     {
         void *buf = Heap::CAlloc(1, sizeof(Type));
 
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+        if (buf != nullptr)
+        {
+            RecordAllocation(kOwner, sizeof(Type));
+        }
+#endif
+
         return (buf != nullptr) ? new (buf) Type(static_cast<Args &&>(aArgs)...) : nullptr;
     }
 
@@ -93,6 +103,10 @@ public:
 
         VerifyOrExit(buf != nullptr);
 
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+        RecordAllocation(kOwner, sizeof(Type));
+#endif
+
         object = new (buf) Type();
 
         if (object->Init(static_cast<Args &&>(aArgs)...) != kErrorNone)
@@ -118,6 +132,10 @@ public:
     {
         static_cast<Type *>(this)->~Type();
         Heap::Free(this);
+
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+        RecordFree(kOwner, sizeof(Type));
+#endif
     }
 
 protected:
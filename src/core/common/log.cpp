@@ -38,6 +38,7 @@
 #include <openthread/platform/logging.h>
 
 #include "common/code_utils.hpp"
+#include "common/frame_builder.hpp"
 #include "common/num_utils.hpp"
 #include "common/numeric_limits.hpp"
 #include "common/string.hpp"
@@ -113,7 +114,176 @@ void Logger::LogVarArgs(const char *aModuleName, LogLevel aLogLevel, const char
     Log(aModuleName, aLogLevel, kErrorNone, aFormat, aArgs);
 }
 
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+
+static Error AppendBinaryUint64(FrameBuilder &aFrameBuilder, uint64_t aUint64)
+{
+    Error error;
+
+    SuccessOrExit(error = aFrameBuilder.AppendLittleEndianUint32(static_cast<uint32_t>(aUint64 & 0xffffffff)));
+    SuccessOrExit(error = aFrameBuilder.AppendLittleEndianUint32(static_cast<uint32_t>(aUint64 >> 32)));
+
+exit:
+    return error;
+}
+
+static void AppendBinaryFormatArgs(FrameBuilder &aFrameBuilder, const char *aFormat, va_list aArgs)
+{
+    // Serializes the arguments in `aArgs` as directed by the
+    // conversions in `aFormat`, so they can be rendered off-device
+    // (where `aFormat` itself is recovered from the image file).
+
+    for (const char *cur = aFormat; *cur != '\0'; cur++)
+    {
+        uint8_t numLongs = 0;
+
+        if (*cur != '%')
+        {
+            continue;
+        }
+
+        cur++;
+
+        // Flags, field width, and precision do not change how an
+        // argument is read from `aArgs`, except for `*` which reads
+        // the width or precision as an extra `int` argument.
+
+        for (; *cur != '\0'; cur++)
+        {
+            if (*cur == '*')
+            {
+                SuccessOrExit(aFrameBuilder.AppendLittleEndianUint32(static_cast<uint32_t>(va_arg(aArgs, int))));
+            }
+            else if (!IsDigit(*cur) && (*cur != '-') && (*cur != '+') && (*cur != ' ') && (*cur != '#') &&
+                     (*cur != '.'))
+            {
+                break;
+            }
+        }
+
+        while (*cur == 'h')
+        {
+            // `h`/`hh` prefixed integer arguments are promoted to `int`.
+            cur++;
+        }
+
+        while (*cur == 'l')
+        {
+            numLongs++;
+            cur++;
+        }
+
+        switch (*cur)
+        {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+            // `long` and `long long` arguments are both serialized as
+            // 64 bits so that the record layout does not depend on
+            // the native `long` width.
+
+            if (numLongs >= 2)
+            {
+                SuccessOrExit(AppendBinaryUint64(aFrameBuilder, va_arg(aArgs, unsigned long long)));
+            }
+            else if (numLongs == 1)
+            {
+                SuccessOrExit(AppendBinaryUint64(aFrameBuilder, va_arg(aArgs, unsigned long)));
+            }
+            else
+            {
+                SuccessOrExit(aFrameBuilder.AppendLittleEndianUint32(va_arg(aArgs, uint32_t)));
+            }
+            break;
+
+        case 'c':
+            SuccessOrExit(aFrameBuilder.AppendUint8(static_cast<uint8_t>(va_arg(aArgs, int))));
+            break;
+
+        case 'p':
+            SuccessOrExit(aFrameBuilder.AppendLittleEndianUint32(
+                static_cast<uint32_t>(reinterpret_cast<uintptr_t>(va_arg(aArgs, void *)))));
+            break;
+
+        case 's':
+        {
+            const char *string = va_arg(aArgs, const char *);
+            uint16_t    length;
+
+            if (string == nullptr)
+            {
+                string = "";
+            }
+
+            length = StringLength(string, NumericLimits<uint8_t>::kMax);
+            length = Min(length, static_cast<uint16_t>(aFrameBuilder.GetMaxLength() - aFrameBuilder.GetLength() - 1));
+
+            SuccessOrExit(aFrameBuilder.AppendUint8(static_cast<uint8_t>(length)));
+            SuccessOrExit(aFrameBuilder.AppendBytes(string, length));
+            break;
+        }
+
+        case '%':
+            break;
+
+        default:
+            // An unsupported conversion: the size of this (and any
+            // following) argument is unknown, so stop serializing.
+            ExitNow();
+        }
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+
 void Logger::Log(const char *aModuleName, LogLevel aLogLevel, Error aError, const char *aFormat, va_list aArgs)
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+{
+    uint8_t      buffer[OPENTHREAD_CONFIG_LOG_MAX_SIZE];
+    FrameBuilder frameBuilder;
+
+#if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
+
+#if !OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
+    VerifyOrExit(Instance::Get().GetLogLevel() >= aLogLevel);
+#elif !OPENTHREAD_CONFIG_LOG_INSTANCE_AWARE_API_ENABLE
+    VerifyOrExit(Instance::GetGlobalLogLevel() >= aLogLevel);
+#else
+    {
+        Instance *instance = Instance::GetActiveInstance();
+
+        VerifyOrExit(instance != nullptr);
+        VerifyOrExit(instance->GetLogLevel() >= aLogLevel);
+    }
+#endif
+
+#endif // OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
+
+    frameBuilder.Init(buffer, sizeof(buffer));
+
+    IgnoreError(frameBuilder.AppendLittleEndianUint32(TimerMilli::GetNow().GetValue()));
+    IgnoreError(frameBuilder.AppendUint8(static_cast<uint8_t>(aLogLevel)));
+    IgnoreError(frameBuilder.AppendUint8(static_cast<uint8_t>(aError)));
+    IgnoreError(
+        frameBuilder.AppendLittleEndianUint32(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(aModuleName))));
+    IgnoreError(frameBuilder.AppendLittleEndianUint32(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(aFormat))));
+
+    AppendBinaryFormatArgs(frameBuilder, aFormat, aArgs);
+
+    otPlatLogBinary(aLogLevel, frameBuilder.GetBytes(), frameBuilder.GetLength());
+
+    ExitNow();
+
+exit:
+    return;
+}
+#else // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
 {
     static const char kModuleNamePadding[] = "--------------";
 
@@ -209,6 +379,7 @@ void Logger::Log(const char *aModuleName, LogLevel aLogLevel, Error aError, cons
 exit:
     return;
 }
+#endif // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
 
 #if OPENTHREAD_CONFIG_LOG_PKT_DUMP
 
@@ -249,6 +420,35 @@ void Logger::DumpInModule(const char *aModuleName,
                           const char *aText,
                           const void *aData,
                           uint16_t    aDataLength)
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+{
+    // Emits the dump as a single binary record (event id zero) with
+    // the raw data bytes, instead of formatting hex dump lines.
+
+    uint8_t      buffer[OPENTHREAD_CONFIG_LOG_MAX_SIZE];
+    FrameBuilder frameBuilder;
+
+    VerifyOrExit(otLoggingGetLevel() >= aLogLevel);
+
+    frameBuilder.Init(buffer, sizeof(buffer));
+
+    IgnoreError(frameBuilder.AppendLittleEndianUint32(TimerMilli::GetNow().GetValue()));
+    IgnoreError(frameBuilder.AppendUint8(static_cast<uint8_t>(aLogLevel)));
+    IgnoreError(frameBuilder.AppendUint8(static_cast<uint8_t>(kErrorNone)));
+    IgnoreError(
+        frameBuilder.AppendLittleEndianUint32(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(aModuleName))));
+    IgnoreError(frameBuilder.AppendLittleEndianUint32(0));
+    IgnoreError(frameBuilder.AppendLittleEndianUint32(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(aText))));
+    IgnoreError(frameBuilder.AppendLittleEndianUint16(aDataLength));
+    IgnoreError(frameBuilder.AppendBytes(
+        aData, Min(aDataLength, static_cast<uint16_t>(frameBuilder.GetMaxLength() - frameBuilder.GetLength()))));
+
+    otPlatLogBinary(aLogLevel, frameBuilder.GetBytes(), frameBuilder.GetLength());
+
+exit:
+    return;
+}
+#else // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
 {
     HexDumpInfo info;
 
@@ -267,6 +467,7 @@ void Logger::DumpInModule(const char *aModuleName,
 exit:
     return;
 }
+#endif // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
 
 #endif // OPENTHREAD_CONFIG_LOG_PKT_DUMP
 
@@ -41,6 +41,11 @@
 #error "OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE conflicts with OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT."
 #endif
 
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE && \
+    (OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE || OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT)
+#error "OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE requires the internal message buffer pool."
+#endif
+
 namespace ot {
 
 RegisterLogModule("Message");
@@ -48,14 +53,37 @@ RegisterLogModule("Message");
 //---------------------------------------------------------------------------------------------------------------------
 // MessagePool
 
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+static_assert((Buffer::kSmallSize % sizeof(uint64_t)) == 0,
+              "OPENTHREAD_CONFIG_SMALL_MESSAGE_BUFFER_SIZE must be a multiple of 8");
+#endif
+
 MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mNumAllocated(0)
     , mMaxAllocated(0)
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+    , mSmallFreeList(nullptr)
+    , mNumSmallAllocated(0)
+#endif
 {
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+    ClearAllBytes(mTypeStats);
+#endif
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
 #endif
+
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+    for (uint16_t index = 0; index < kNumSmallBuffers; index++)
+    {
+        Buffer *buffer =
+            reinterpret_cast<Buffer *>(reinterpret_cast<uint8_t *>(mSmallBufferStorage) + index * Buffer::kSmallSize);
+
+        buffer->SetNextBuffer(mSmallFreeList);
+        mSmallFreeList = buffer;
+    }
+#endif
 }
 
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
@@ -63,13 +91,33 @@ MessagePool::~MessagePool(void) { otPlatMessagePoolDeinit(&GetInstance()); }
 #endif
 
 Message *MessagePool::Allocate(Message::Type aType, uint16_t aReserveHeader, const Message::Settings &aSettings)
+{
+    return Allocate(aType, aReserveHeader, aSettings, Message::kBufferClassRegular);
+}
+
+Message *MessagePool::Allocate(Message::Type            aType,
+                               uint16_t                 aReserveHeader,
+                               const Message::Settings &aSettings,
+                               Message::BufferClass     aBufferClass)
 {
     Error    error = kErrorNone;
     Message *message;
 
-    VerifyOrExit((message = static_cast<Message *>(NewBuffer(aSettings.GetPriority()))) != nullptr);
+    VerifyOrExit((message = static_cast<Message *>(NewBuffer(aSettings.GetPriority(), aBufferClass))) != nullptr);
 
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+    if (IsSmallBuffer(*message))
+    {
+        memset(static_cast<void *>(message), 0, Buffer::kSmallSize);
+        message->SetBufferClass(Message::kBufferClassSmall);
+    }
+    else
+    {
+        ClearAllBytes(*message);
+    }
+#else
     ClearAllBytes(*message);
+#endif
 
 #if OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
     message->GetMetadata().mInstance = &GetInstance();
@@ -81,6 +129,12 @@ Message *MessagePool::Allocate(Message::Type aType, uint16_t aReserveHeader, con
     message->SetOrigin(Message::kOriginHostTrusted);
     message->MarkAsNotInAQueue();
 
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+    // Recorded before the fallible init steps below, so that the
+    // `Free()` call in the error path stays balanced.
+    UpdateTypeStats(aType, /* aNumMessagesDelta */ 1, /* aNumBytesDelta */ 0);
+#endif
+
     SuccessOrExit(error = message->SetPriority(aSettings.GetPriority()));
     SuccessOrExit(error = message->SetLength(0));
 
@@ -105,9 +159,23 @@ void MessagePool::Free(Message *aMessage)
 {
     OT_ASSERT(!aMessage->IsInAQueue());
 
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+    UpdateTypeStats(aMessage->GetType(), /* aNumMessagesDelta */ -1, -static_cast<int32_t>(aMessage->GetLength()));
+#endif
+
     FreeBuffers(static_cast<Buffer *>(aMessage));
 }
 
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+void MessagePool::UpdateTypeStats(Message::Type aType, int32_t aNumMessagesDelta, int32_t aNumBytesDelta)
+{
+    TypeStats &stats = mTypeStats[aType];
+
+    stats.mNumMessages = static_cast<uint16_t>(stats.mNumMessages + aNumMessagesDelta);
+    stats.mNumBytes    = static_cast<uint32_t>(static_cast<int64_t>(stats.mNumBytes) + aNumBytesDelta);
+}
+#endif
+
 Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
 {
     Buffer *buffer = nullptr;
@@ -129,21 +197,105 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
     mMaxAllocated = Max(mMaxAllocated, mNumAllocated);
 
     buffer->SetNextBuffer(nullptr);
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+    buffer->SetRefCount(1);
+#endif
 
 exit:
     if (buffer == nullptr)
     {
         LogInfo("No available message buffer");
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
+        Get<HistoryTracker::Local>().RecordBufferPressure();
+#endif
+    }
+
+    return buffer;
+}
+
+Buffer *MessagePool::NewBuffer(Message::Priority aPriority, Message::BufferClass aBufferClass)
+{
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+    Buffer *buffer = nullptr;
+
+    if (aBufferClass == Message::kBufferClassSmall)
+    {
+        buffer = NewSmallBuffer();
+    }
+
+    if (buffer == nullptr)
+    {
+        buffer = NewBuffer(aPriority);
+    }
+
+    return buffer;
+#else
+    OT_UNUSED_VARIABLE(aBufferClass);
+
+    return NewBuffer(aPriority);
+#endif
+}
+
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+
+Buffer *MessagePool::NewSmallBuffer(void)
+{
+    Buffer *buffer = mSmallFreeList;
+
+    if (buffer != nullptr)
+    {
+        mSmallFreeList = buffer->GetNextBuffer();
+        mNumSmallAllocated++;
+        buffer->SetNextBuffer(nullptr);
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+        buffer->SetRefCount(1);
+#endif
     }
 
     return buffer;
 }
 
+bool MessagePool::IsSmallBuffer(const Buffer &aBuffer) const
+{
+    const uint8_t *bufPtr  = reinterpret_cast<const uint8_t *>(&aBuffer);
+    const uint8_t *poolPtr = reinterpret_cast<const uint8_t *>(mSmallBufferStorage);
+
+    return (bufPtr >= poolPtr) && (bufPtr < poolPtr + kNumSmallBuffers * Buffer::kSmallSize);
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+
 void MessagePool::FreeBuffers(Buffer *aBuffer)
 {
     while (aBuffer != nullptr)
     {
         Buffer *next = aBuffer->GetNextBuffer();
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+        if (aBuffer->GetRefCount() > 1)
+        {
+            // The rest of the chain is shared with another message
+            // (see `Message::CloneWithSharedBuffers()`). Release our
+            // reference and leave the buffers to the remaining
+            // owner(s).
+
+            aBuffer->DecrementRefCount();
+            break;
+        }
+#endif
+
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+        if (IsSmallBuffer(*aBuffer))
+        {
+            aBuffer->SetNextBuffer(mSmallFreeList);
+            mSmallFreeList = aBuffer;
+            mNumSmallAllocated--;
+            aBuffer = next;
+            continue;
+        }
+#endif
+
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
         Heap::Free(aBuffer);
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
@@ -176,6 +328,9 @@ uint16_t MessagePool::GetFreeBufferCount(void) const
     rval = otPlatMessagePoolNumFreeBuffers(&GetInstance());
 #else
     rval = kNumBuffers - mNumAllocated;
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+    rval += kNumSmallBuffers - mNumSmallAllocated;
+#endif
 #endif
 
     return rval;
@@ -193,6 +348,9 @@ uint16_t MessagePool::GetTotalBufferCount(void) const
 #endif
 #else
     rval = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+    rval += kNumSmallBuffers;
+#endif
 #endif
 
     return rval;
@@ -226,6 +384,20 @@ void Message::Iterator::Advance(void)
 //---------------------------------------------------------------------------------------------------------------------
 // Message
 
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+
+uint16_t Message::GetHeadBufferDataSize(void) const
+{
+    return Get<MessagePool>().IsSmallBuffer(*this) ? kSmallHeadBufferDataSize : kHeadBufferDataSize;
+}
+
+uint16_t Message::GetBufferDataSize(const Buffer &aBuffer) const
+{
+    return Get<MessagePool>().IsSmallBuffer(aBuffer) ? kSmallBufferDataSize : kBufferDataSize;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+
 Error Message::ResizeMessage(uint16_t aLength)
 {
     // This method adds or frees message buffers to meet the
@@ -234,18 +406,31 @@ Error Message::ResizeMessage(uint16_t aLength)
     Error    error     = kErrorNone;
     Buffer  *curBuffer = this;
     Buffer  *lastBuffer;
-    uint16_t curLength = kHeadBufferDataSize;
+    uint16_t curLength = GetHeadBufferDataSize();
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+    if (AreBuffersShared())
+    {
+        // With a shared buffer chain, shrinking needs no copy: the
+        // trailing buffers stay in the shared chain and are freed
+        // when the last referencing message is freed. Growing the
+        // message requires exclusive ownership of the buffers.
+
+        VerifyOrExit(aLength > GetReserved() + GetLength());
+        SuccessOrExit(error = EnsureUniquelyOwned());
+    }
+#endif
 
     while (curLength < aLength)
     {
         if (curBuffer->GetNextBuffer() == nullptr)
         {
-            curBuffer->SetNextBuffer(Get<MessagePool>().NewBuffer(GetPriority()));
+            curBuffer->SetNextBuffer(Get<MessagePool>().NewBuffer(GetPriority(), GetBufferClass()));
             VerifyOrExit(curBuffer->GetNextBuffer() != nullptr, error = kErrorNoBufs);
         }
 
         curBuffer = curBuffer->GetNextBuffer();
-        curLength += kBufferDataSize;
+        curLength += GetBufferDataSize(*curBuffer);
     }
 
     lastBuffer = curBuffer;
@@ -258,6 +443,94 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+
+bool Message::AreBuffersShared(void) const
+{
+    const Buffer *next = GetNextBuffer();
+
+    return (next != nullptr) && (next->GetRefCount() > 1);
+}
+
+Error Message::EnsureUniquelyOwned(void)
+{
+    Error    error = kErrorNone;
+    Buffer  *sharedChain;
+    uint16_t totalSize = GetReserved() + GetLength();
+
+    VerifyOrExit(AreBuffersShared());
+
+    // Detach from the shared chain and allocate a fresh, uniquely
+    // owned chain covering the message content. The bytes previously
+    // held in the shared buffers are then copied into it.
+
+    sharedChain = GetNextBuffer();
+    SetNextBuffer(nullptr);
+
+    error = ResizeMessage(totalSize);
+
+    if (error != kErrorNone)
+    {
+        // Failed to allocate: free any partially allocated chain and
+        // re-attach to the shared one, leaving the message unchanged.
+
+        Buffer *newChain = GetNextBuffer();
+
+        SetNextBuffer(sharedChain);
+        Get<MessagePool>().FreeBuffers(newChain);
+        ExitNow();
+    }
+
+    if (totalSize > GetHeadBufferDataSize())
+    {
+        uint16_t      remaining = totalSize - GetHeadBufferDataSize();
+        const Buffer *srcBuffer = sharedChain;
+        uint16_t      srcOffset = 0;
+
+        for (Buffer *dstBuffer = GetNextBuffer(); (dstBuffer != nullptr) && (remaining > 0);
+             dstBuffer = dstBuffer->GetNextBuffer())
+        {
+            uint16_t dstSize   = GetBufferDataSize(*dstBuffer);
+            uint16_t dstOffset = 0;
+
+            while ((dstOffset < dstSize) && (remaining > 0))
+            {
+                uint16_t copyLength;
+
+                OT_ASSERT(srcBuffer != nullptr);
+
+                copyLength = Min(static_cast<uint16_t>(dstSize - dstOffset),
+                                 static_cast<uint16_t>(GetBufferDataSize(*srcBuffer) - srcOffset));
+                copyLength = Min(copyLength, remaining);
+
+                memcpy(dstBuffer->GetData() + dstOffset, srcBuffer->GetData() + srcOffset, copyLength);
+
+                dstOffset += copyLength;
+                srcOffset += copyLength;
+                remaining -= copyLength;
+
+                if (srcOffset == GetBufferDataSize(*srcBuffer))
+                {
+                    srcBuffer = srcBuffer->GetNextBuffer();
+                    srcOffset = 0;
+                }
+            }
+        }
+    }
+
+    // Release our reference to the shared chain through
+    // `FreeBuffers()`. While allocating the new chain, buffers may
+    // have been reclaimed by evicting the other message(s) sharing
+    // the chain, in which case this frees the chain itself.
+
+    Get<MessagePool>().FreeBuffers(sharedChain);
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+
 void Message::Free(void)
 {
     // `TxCallback` is cleared once it is invoked. If the message is
@@ -268,6 +541,14 @@ void Message::Free(void)
     Get<MessagePool>().Free(this);
 }
 
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+void Message::RecordLengthChange(uint16_t aOldLength, uint16_t aNewLength)
+{
+    Get<MessagePool>().UpdateTypeStats(GetType(), /* aNumMessagesDelta */ 0,
+                                       static_cast<int32_t>(aNewLength) - static_cast<int32_t>(aOldLength));
+}
+#endif
+
 Error Message::SetLength(uint16_t aLength)
 {
     Error    error;
@@ -278,6 +559,10 @@ Error Message::SetLength(uint16_t aLength)
     size = GetReserved() + aLength;
     SuccessOrExit(error = ResizeMessage(size));
 
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+    RecordLengthChange(GetLength(), aLength);
+#endif
+
     GetMetadata().mLength = aLength;
 
     // Correct the offset in case shorter length is set.
@@ -322,6 +607,16 @@ void Message::MoveOffset(int16_t aDelta)
 
 void Message::SetOffset(uint16_t aOffset) { GetMetadata().mOffset = Min(aOffset, GetLength()); }
 
+void Message::SetIp6ReceiveInfo(uint8_t aProto, uint8_t aEcn, uint16_t aPayloadOffset)
+{
+    Metadata &metadata = GetMetadata();
+
+    metadata.mIp6Proto         = aProto;
+    metadata.mIp6Ecn           = aEcn & 0x3;
+    metadata.mIp6PayloadOffset = aPayloadOffset;
+    metadata.mIp6RxInfoSet     = true;
+}
+
 uint16_t Message::DetermineLengthAfterOffset(void) const
 {
     return (GetOffset() <= GetLength()) ? GetLength() - GetOffset() : 0;
@@ -379,6 +674,46 @@ void Message::InvokeTxCallback(Error aError)
     }
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_LIFECYCLE_TRACE_ENABLE
+
+void Message::MarkLifecycleQueueTime(void)
+{
+    Metadata &metadata = GetMetadata();
+
+    metadata.mLifecycleQueueTime        = TimerMilli::GetNow();
+    metadata.mLifecycleQueueTimeSet     = true;
+    metadata.mLifecycleFramePrepTimeSet = false;
+}
+
+void Message::MarkLifecycleFramePrepTime(void)
+{
+    Metadata &metadata = GetMetadata();
+
+    VerifyOrExit(metadata.mLifecycleQueueTimeSet && !metadata.mLifecycleFramePrepTimeSet);
+
+    metadata.mLifecycleFramePrepTime    = TimerMilli::GetNow();
+    metadata.mLifecycleFramePrepTimeSet = true;
+
+exit:
+    return;
+}
+
+bool Message::GetLifecycleTimes(TimeMilli &aQueueTime, TimeMilli &aFramePrepTime) const
+{
+    const Metadata &metadata = GetMetadata();
+    bool            areSet   = (metadata.mLifecycleQueueTimeSet && metadata.mLifecycleFramePrepTimeSet);
+
+    VerifyOrExit(areSet);
+
+    aQueueTime     = metadata.mLifecycleQueueTime;
+    aFramePrepTime = metadata.mLifecycleFramePrepTime;
+
+exit:
+    return areSet;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_LIFECYCLE_TRACE_ENABLE
+
 Error Message::AppendBytes(const void *aBuf, uint16_t aLength)
 {
     Error    error;
@@ -426,24 +761,34 @@ Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
     Error   error     = kErrorNone;
     Buffer *newBuffer = nullptr;
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+    SuccessOrExit(error = EnsureUniquelyOwned());
+#endif
+
     while (aLength > GetReserved())
     {
-        VerifyOrExit((newBuffer = Get<MessagePool>().NewBuffer(GetPriority())) != nullptr, error = kErrorNoBufs);
+        VerifyOrExit((newBuffer = Get<MessagePool>().NewBuffer(GetPriority(), GetBufferClass())) != nullptr,
+                     error = kErrorNoBufs);
 
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
 
-        if (GetReserved() < sizeof(mBuffer.mHead.mData))
+        if (GetReserved() < GetHeadBufferDataSize())
         {
             // Copy payload from the first buffer.
-            memcpy(newBuffer->mBuffer.mHead.mData + GetReserved(), mBuffer.mHead.mData + GetReserved(),
-                   sizeof(mBuffer.mHead.mData) - GetReserved());
+            memcpy(newBuffer->GetData() + GetBufferDataSize(*newBuffer) - GetHeadBufferDataSize() + GetReserved(),
+                   GetFirstData() + GetReserved(), GetHeadBufferDataSize() - GetReserved());
         }
 
-        SetReserved(GetReserved() + kBufferDataSize);
+        SetReserved(GetReserved() + GetBufferDataSize(*newBuffer));
     }
 
     SetReserved(GetReserved() - aLength);
+
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+    RecordLengthChange(GetLength(), GetLength() + aLength);
+#endif
+
     GetMetadata().mLength += aLength;
     SetOffset(GetOffset() + aLength);
 
@@ -460,6 +805,10 @@ void Message::RemoveHeader(uint16_t aLength)
 {
     OT_ASSERT(aLength <= GetMetadata().mLength);
 
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+    RecordLengthChange(GetLength(), GetLength() - aLength);
+#endif
+
     GetMetadata().mReserved += aLength;
     GetMetadata().mLength -= aLength;
 
@@ -558,29 +907,33 @@ void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk)
 
     // Special case for the first buffer
 
-    if (aOffset < kHeadBufferDataSize)
+    if (aOffset < GetHeadBufferDataSize())
     {
-        aChunk.Init(GetFirstData() + aOffset, kHeadBufferDataSize - aOffset);
+        aChunk.Init(GetFirstData() + aOffset, GetHeadBufferDataSize() - aOffset);
         ExitNow();
     }
 
-    aOffset -= kHeadBufferDataSize;
+    aOffset -= GetHeadBufferDataSize();
 
     // Find the `Buffer` matching the offset
 
     while (true)
     {
+        uint16_t bufferDataSize;
+
         aChunk.SetBuffer(aChunk.GetBuffer()->GetNextBuffer());
 
         OT_ASSERT(aChunk.GetBuffer() != nullptr);
 
-        if (aOffset < kBufferDataSize)
+        bufferDataSize = GetBufferDataSize(*aChunk.GetBuffer());
+
+        if (aOffset < bufferDataSize)
         {
-            aChunk.Init(aChunk.GetBuffer()->GetData() + aOffset, kBufferDataSize - aOffset);
+            aChunk.Init(aChunk.GetBuffer()->GetData() + aOffset, bufferDataSize - aOffset);
             ExitNow();
         }
 
-        aOffset -= kBufferDataSize;
+        aOffset -= bufferDataSize;
     }
 
 exit:
@@ -606,7 +959,7 @@ void Message::GetNextChunk(uint16_t &aLength, Chunk &aChunk) const
 
     OT_ASSERT(aChunk.GetBuffer() != nullptr);
 
-    aChunk.Init(aChunk.GetBuffer()->GetData(), kBufferDataSize);
+    aChunk.Init(aChunk.GetBuffer()->GetData(), GetBufferDataSize(*aChunk.GetBuffer()));
 
     if (aChunk.GetLength() > aLength)
     {
@@ -619,6 +972,52 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, MutableChunk &aChunk)
+{
+    // Writing requires exclusive buffer ownership, unless the
+    // requested range is fully contained in the head buffer which is
+    // always uniquely owned (see `CloneWithSharedBuffers()`).
+
+    if (AreBuffersShared() &&
+        (static_cast<uint32_t>(GetReserved()) + aOffset + aLength > GetHeadBufferDataSize()) &&
+        (EnsureUniquelyOwned() != kErrorNone))
+    {
+        LogWarn("Dropping write to shared buffers, no buffers to copy");
+        aLength = 0;
+        aChunk.SetLength(0);
+        ExitNow();
+    }
+
+    AsConst(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+
+Message::ChunkIterator::ChunkIterator(const Message &aMessage, const OffsetRange &aOffsetRange)
+    : mMessage(aMessage)
+    , mRemainingLength(aOffsetRange.GetLength())
+{
+    mMessage.GetFirstChunk(aOffsetRange.GetOffset(), mRemainingLength, mChunk);
+}
+
+bool Message::ChunkIterator::GetNextChunk(const uint8_t *&aBytes, uint16_t &aLength)
+{
+    bool hasChunk = (mChunk.GetLength() != 0);
+
+    VerifyOrExit(hasChunk);
+
+    aBytes  = mChunk.GetBytes();
+    aLength = mChunk.GetLength();
+
+    mMessage.GetNextChunk(mRemainingLength, mChunk);
+
+exit:
+    return hasChunk;
+}
+
 uint16_t Message::ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) const
 {
     uint8_t *bufPtr = reinterpret_cast<uint8_t *>(aBuf);
@@ -791,35 +1190,40 @@ Message *Message::Clone(uint16_t aLength, uint16_t aReserveHeader) const
     Message         *clone;
     LinkSecurityMode linkSecurityMode = IsLinkSecurityEnabled() ? kWithLinkSecurity : kNoLinkSecurity;
 
-    clone = Get<MessagePool>().Allocate(GetType(), aReserveHeader, Settings(linkSecurityMode, GetPriority()));
+    clone = Get<MessagePool>().Allocate(GetType(), aReserveHeader, Settings(linkSecurityMode, GetPriority()),
+                                        GetBufferClass());
     VerifyOrExit(clone != nullptr, error = kErrorNoBufs);
 
     aLength = Min(aLength, GetLength());
 
     SuccessOrExit(error = clone->AppendBytesFromMessage(*this, 0, aLength));
 
-    // Copy selected message information.
-
     clone->SetOffset(Min(GetOffset(), aLength));
-
-    clone->SetSubType(GetSubType());
-    clone->SetLoopbackToHostAllowed(IsLoopbackToHostAllowed());
-    clone->SetOrigin(GetOrigin());
-    clone->SetTimestamp(GetTimestamp());
-    clone->SetMeshDest(GetMeshDest());
-    clone->SetPanId(GetPanId());
-    clone->SetChannel(GetChannel());
-    clone->SetRssAverager(GetRssAverager());
-    clone->SetLqiAverager(GetLqiAverager());
-#if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
-    clone->SetTimeSync(IsTimeSync());
-#endif
+    CopySelectedInfoTo(*clone);
 
 exit:
     FreeAndNullMessageOnError(clone, error);
     return clone;
 }
 
+void Message::CopySelectedInfoTo(Message &aClone) const
+{
+    // Copy selected message information to a cloned message.
+
+    aClone.SetSubType(GetSubType());
+    aClone.SetLoopbackToHostAllowed(IsLoopbackToHostAllowed());
+    aClone.SetOrigin(GetOrigin());
+    aClone.SetTimestamp(GetTimestamp());
+    aClone.SetMeshDest(GetMeshDest());
+    aClone.SetPanId(GetPanId());
+    aClone.SetChannel(GetChannel());
+    aClone.SetRssAverager(GetRssAverager());
+    aClone.SetLqiAverager(GetLqiAverager());
+#if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
+    aClone.SetTimeSync(IsTimeSync());
+#endif
+}
+
 template <> Message *Message::Clone<kNoReservedHeader>(void) const { return Clone(GetLength(), 0); }
 
 template <> Message *Message::Clone<kSameReservedHeader>(void) const { return Clone(GetLength(), GetReserved()); }
@@ -831,6 +1235,62 @@ template <> Message *Message::Clone<kSameReservedHeader>(uint16_t aLength) const
     return Clone(aLength, GetReserved());
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+Message *Message::CloneWithSharedBuffers(void) const
+{
+    Message         *clone = nullptr;
+    Buffer          *sharedChain;
+    LinkSecurityMode linkSecurityMode = IsLinkSecurityEnabled() ? kWithLinkSecurity : kNoLinkSecurity;
+
+    // Sharing requires a tail buffer chain with room in its reference
+    // counter. Otherwise fall back to a regular deep clone.
+
+    VerifyOrExit(GetNextBuffer() != nullptr);
+    VerifyOrExit(GetNextBuffer()->GetRefCount() < NumericLimits<uint16_t>::kMax);
+
+    clone = Get<MessagePool>().Allocate(GetType(), GetReserved(), Settings(linkSecurityMode, GetPriority()),
+                                        GetBufferClass());
+    VerifyOrExit(clone != nullptr);
+
+    // The head buffer layouts must match for the byte offsets within
+    // the shared tail buffers to line up.
+
+    if (clone->GetHeadBufferDataSize() != GetHeadBufferDataSize())
+    {
+        clone->Free();
+        clone = nullptr;
+        ExitNow();
+    }
+
+    // Free any tail buffers allocated for the reserved header and
+    // share the original message's chain instead.
+
+    Get<MessagePool>().FreeBuffers(clone->GetNextBuffer());
+
+    sharedChain = AsNonConst(GetNextBuffer());
+    sharedChain->IncrementRefCount();
+    clone->SetNextBuffer(sharedChain);
+
+    memcpy(clone->GetFirstData(), GetFirstData(), GetHeadBufferDataSize());
+
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+    clone->RecordLengthChange(clone->GetLength(), GetLength());
+#endif
+
+    clone->GetMetadata().mLength = GetLength();
+    clone->SetOffset(GetOffset());
+    CopySelectedInfoTo(*clone);
+
+exit:
+    if (clone == nullptr)
+    {
+        clone = Clone<kSameReservedHeader>();
+    }
+
+    return clone;
+}
+#endif // OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+
 Error Message::GetLinkInfo(ThreadLinkInfo &aLinkInfo) const
 {
     Error error = kErrorNone;
@@ -855,6 +1315,10 @@ Error Message::GetLinkInfo(ThreadLinkInfo &aLinkInfo) const
     aLinkInfo.mRadioType = GetRadioType();
 #endif
 
+#if OPENTHREAD_CONFIG_RADIO_RX_TIMESTAMP_ENABLE
+    aLinkInfo.mRadioRxTimestamp = GetRadioRxTimestamp();
+#endif
+
 exit:
     return error;
 }
@@ -876,6 +1340,10 @@ void Message::UpdateLinkInfoFrom(const ThreadLinkInfo &aLinkInfo)
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     SetRadioType(static_cast<Mac::RadioType>(aLinkInfo.mRadioType));
 #endif
+
+#if OPENTHREAD_CONFIG_RADIO_RX_TIMESTAMP_ENABLE
+    SetRadioRxTimestamp(aLinkInfo.GetRadioRxTimestamp());
+#endif
 }
 
 bool Message::IsTimeSync(void) const
@@ -1018,6 +1486,11 @@ void MessageQueue::GetInfo(Info &aInfo) const
         aInfo.mNumBuffers += message.GetBufferCount();
         aInfo.mTotalBytes += message.GetLength();
     }
+
+    // `MessageQueue` does not track a queue-depth watermark (its
+    // layout is constrained by the public `otMessageQueue` struct),
+    // so the current queue depth is reported instead.
+    aInfo.mMaxNumMessages = aInfo.mNumMessages;
 }
 
 void MessageQueue::AddQueueInfos(Info &aInfo, const Info &aOther)
@@ -1025,6 +1498,7 @@ void MessageQueue::AddQueueInfos(Info &aInfo, const Info &aOther)
     aInfo.mNumMessages += aOther.mNumMessages;
     aInfo.mNumBuffers += aOther.mNumBuffers;
     aInfo.mTotalBytes += aOther.mTotalBytes;
+    aInfo.mMaxNumMessages += aOther.mMaxNumMessages;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1136,6 +1610,9 @@ void PriorityQueue::Enqueue(Message &aMessage)
     }
 
     mTails[priority] = &aMessage;
+
+    mNumMessages++;
+    mMaxNumMessages = Max(mMaxNumMessages, mNumMessages);
 }
 
 void PriorityQueue::Dequeue(Message &aMessage)
@@ -1179,6 +1656,8 @@ void PriorityQueue::Dequeue(Message &aMessage)
     }
 
     aMessage.MarkAsNotInAQueue();
+
+    mNumMessages--;
 }
 
 void PriorityQueue::DequeueAndFree(Message &aMessage)
@@ -1211,6 +1690,8 @@ void PriorityQueue::GetInfo(Info &aInfo) const
         aInfo.mNumBuffers += message.GetBufferCount();
         aInfo.mTotalBytes += message.GetLength();
     }
+
+    aInfo.mMaxNumMessages = mMaxNumMessages;
 }
 
 } // namespace ot
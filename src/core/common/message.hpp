@@ -81,6 +81,12 @@ class HmacSha256;
 
 } // namespace Crypto
 
+namespace Ip6 {
+
+class Tcp;
+
+} // namespace Ip6
+
 /**
  * @addtogroup core-message
  *
@@ -171,10 +177,15 @@ enum CloneMode : uint8_t
 class Buffer : public otMessageBuffer, public LinkedListEntry<Buffer>
 {
     friend class Message;
+    friend class MessagePool;
 
 public:
     static constexpr uint16_t kSize = OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE; ///< Size of buffer in bytes.
 
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+    static constexpr uint16_t kSmallSize = OPENTHREAD_CONFIG_SMALL_MESSAGE_BUFFER_SIZE; ///< Size of a small buffer.
+#endif
+
     typedef otMessageTxCallback TxCallback; ///< Message TX callback.
 
     /**
@@ -199,6 +210,13 @@ public:
     void SetNextBuffer(Buffer *aNext) { SetNext(aNext); }
 
 protected:
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+    uint16_t GetRefCount(void) const { return mRefCount; }
+    void     SetRefCount(uint16_t aRefCount) { mRefCount = aRefCount; }
+    void     IncrementRefCount(void) { mRefCount++; }
+    void     DecrementRefCount(void) { mRefCount--; }
+#endif
+
     struct Metadata
     {
 #if OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
@@ -213,6 +231,11 @@ protected:
         bool mResolvingAddress : 1;    // Whether the message is pending an address query resolution.
         bool mAllowLookbackToHost : 1; // Whether the message is allowed to be looped back to host.
         bool mIsDstPanIdBroadcast : 1; // Whether the dest PAN ID is broadcast.
+        bool mIp6RxInfoSet : 1;        // Whether the IPv6 receive info annotation is set.
+#if OPENTHREAD_CONFIG_MESSAGE_LIFECYCLE_TRACE_ENABLE
+        bool mLifecycleQueueTimeSet : 1;     // Whether `mLifecycleQueueTime` is set.
+        bool mLifecycleFramePrepTimeSet : 1; // Whether `mLifecycleFramePrepTime` is set.
+#endif
 #if OPENTHREAD_CONFIG_MULTI_RADIO
         bool mIsRadioTypeSet : 1; // Whether the radio type is set.
 #endif
@@ -221,6 +244,10 @@ protected:
 #endif
         uint8_t mPriority : 2; // The message priority level (higher value is higher priority).
         uint8_t mOrigin : 2;   // The origin of the message.
+        uint8_t mIp6Ecn : 2;   // The annotated ECN value from the IPv6 header (when `mIp6RxInfoSet`).
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+        uint8_t mBufferClass : 1; // The buffer class (pool) used when allocating buffers for this message.
+#endif
 #if OPENTHREAD_CONFIG_MULTI_RADIO
         uint8_t mRadioType : 2; // The radio link type the message was received on, or should be sent on.
         static_assert(Mac::kNumRadioTypes <= (1 << 2), "mRadioType bitfield cannot store all radio type values");
@@ -229,19 +256,31 @@ protected:
         uint8_t mSubType : 4; // The message sub type.
         uint8_t mMleCommand;  // The MLE command type (used when `mSubType is `Mle`).
         uint8_t mChannel;     // The message channel (used for MLE Announce).
+        uint8_t mIp6Proto;    // The annotated IPv6 payload protocol (when `mIp6RxInfoSet`).
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
         uint8_t mTimeSyncSeq; // The time sync sequence.
 #endif
-        uint16_t mLength;      // Current message length (number of bytes).
-        uint16_t mOffset;      // A byte offset within the message.
-        uint16_t mReserved;    // Number of reserved bytes (for header).
-        uint16_t mMeshDest;    // Used for unicast non-link-local messages.
-        uint16_t mPanId;       // PAN ID (used for MLE Discover Request and Response).
-        uint32_t mDatagramTag; // The datagram tag used for 6LoWPAN frags or IPv6fragmentation.
+        uint16_t mLength;           // Current message length (number of bytes).
+        uint16_t mOffset;           // A byte offset within the message.
+        uint16_t mIp6PayloadOffset; // The annotated IPv6 payload offset (when `mIp6RxInfoSet`).
+        uint16_t mReserved;         // Number of reserved bytes (for header).
+        uint16_t mMeshDest;         // Used for unicast non-link-local messages.
+        uint16_t mPanId;            // PAN ID (used for MLE Discover Request and Response).
+        uint32_t mDatagramTag;      // The datagram tag used for 6LoWPAN frags or IPv6fragmentation.
+#if OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+        uint16_t mMaxReassemblyGap; // Largest observed gap (in msec) between fragment arrivals during reassembly.
+#endif
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
         int64_t mNetworkTimeOffset; // The time offset to the Thread network time, in microseconds.
 #endif
-        TimeMilli   mTimestamp;   // The message timestamp.
+#if OPENTHREAD_CONFIG_RADIO_RX_TIMESTAMP_ENABLE
+        uint64_t mRadioRxTimestamp; // The radio receive timestamp, in microseconds.
+#endif
+        TimeMilli mTimestamp; // The message timestamp.
+#if OPENTHREAD_CONFIG_MESSAGE_LIFECYCLE_TRACE_ENABLE
+        TimeMilli mLifecycleQueueTime;     // Time the message was queued as an IPv6 datagram for tx.
+        TimeMilli mLifecycleFramePrepTime; // Time the first MAC frame of the message was prepared.
+#endif
         Message    *mNext;        // Next message in a doubly linked list.
         Message    *mPrev;        // Previous message in a doubly linked list.
         TxCallback  mTxCallback;  // The callback to inform message TX success or failure.
@@ -253,11 +292,29 @@ protected:
 #endif
     };
 
-    static_assert(kSize > sizeof(Metadata) + sizeof(otMessageBuffer), "Metadata does not fit in a single buffer");
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+    // Size of the buffer header (the `otMessageBuffer` fields and `mRefCount`), including any padding up to the
+    // alignment of the data/metadata union.
+    static constexpr uint16_t kHeaderSize =
+        OT_ALIGNED_VAR_SIZE(sizeof(otMessageBuffer) + sizeof(uint16_t), uint64_t) * sizeof(uint64_t);
+#else
+    static constexpr uint16_t kHeaderSize = sizeof(otMessageBuffer);
+#endif
+
+    static_assert(kSize > sizeof(Metadata) + kHeaderSize, "Metadata does not fit in a single buffer");
 
-    static constexpr uint16_t kBufferDataSize     = kSize - sizeof(otMessageBuffer);
+    static constexpr uint16_t kBufferDataSize     = kSize - kHeaderSize;
     static constexpr uint16_t kHeadBufferDataSize = kBufferDataSize - sizeof(Metadata);
 
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+    static_assert(kSmallSize > sizeof(Metadata) + kHeaderSize,
+                  "Metadata does not fit in a small buffer. Increase OPENTHREAD_CONFIG_SMALL_MESSAGE_BUFFER_SIZE.");
+    static_assert(kSmallSize <= kSize, "Small buffer size cannot be larger than the regular buffer size");
+
+    static constexpr uint16_t kSmallBufferDataSize     = kSmallSize - kHeaderSize;
+    static constexpr uint16_t kSmallHeadBufferDataSize = kSmallBufferDataSize - sizeof(Metadata);
+#endif
+
     Metadata       &GetMetadata(void) { return mBuffer.mHead.mMetadata; }
     const Metadata &GetMetadata(void) const { return mBuffer.mHead.mMetadata; }
 
@@ -268,6 +325,10 @@ protected:
     const uint8_t *GetData(void) const { return mBuffer.mData; }
 
 private:
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+    uint16_t mRefCount; // Number of messages referencing the buffer chain starting at this buffer.
+#endif
+
     union
     {
         struct
@@ -287,9 +348,7 @@ static_assert(sizeof(Buffer) >= Buffer::kSize,
  */
 class Message : public otMessage, public Buffer, public GetProvider<Message>
 {
-    friend class Checksum;
-    friend class CrcCalculator<uint16_t>;
-    friend class CrcCalculator<uint32_t>;
+    friend class Ip6::Tcp;
     friend class Crypto::HmacSha256;
     friend class Crypto::Sha256;
     friend class Crypto::AesCcm;
@@ -336,6 +395,18 @@ public:
 
     static constexpr uint8_t kNumPriorities = 4; ///< Number of priority levels.
 
+    /**
+     * Represents the buffer class (pool) from which message buffers are allocated.
+     *
+     * When `OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE` is not enabled, all buffers are allocated from the
+     * regular pool and the buffer class is ignored.
+     */
+    enum BufferClass : uint8_t
+    {
+        kBufferClassRegular = 0, ///< Regular buffers of size `OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE`.
+        kBufferClassSmall   = 1, ///< Small buffers of size `OPENTHREAD_CONFIG_SMALL_MESSAGE_BUFFER_SIZE`.
+    };
+
     /**
      * Represents an IPv6 message origin.
      */
@@ -546,6 +617,53 @@ public:
      */
     void SetOffset(uint16_t aOffset);
 
+    /**
+     * Annotates the message with info parsed from its IPv6 header on receive.
+     *
+     * This allows the IPv6 header to be parsed once when the datagram is received, with later processing stages
+     * using the accessors `GetIp6Proto()`, `GetIp6Ecn()`, and `GetIp6PayloadOffset()` instead of re-reading the
+     * header bytes from the message buffers.
+     *
+     * @param[in] aProto          The payload protocol (next header value after any extension headers).
+     * @param[in] aEcn            The ECN field value from the IPv6 header.
+     * @param[in] aPayloadOffset  The offset of the payload (e.g., transport-layer header) within the message.
+     */
+    void SetIp6ReceiveInfo(uint8_t aProto, uint8_t aEcn, uint16_t aPayloadOffset);
+
+    /**
+     * Clears the IPv6 receive info annotation (e.g., after the message content is modified).
+     */
+    void ClearIp6ReceiveInfo(void) { GetMetadata().mIp6RxInfoSet = false; }
+
+    /**
+     * Indicates whether the message carries a valid IPv6 receive info annotation.
+     *
+     * @retval TRUE   The IPv6 receive info annotation is set.
+     * @retval FALSE  The IPv6 receive info annotation is not set.
+     */
+    bool IsIp6ReceiveInfoSet(void) const { return GetMetadata().mIp6RxInfoSet; }
+
+    /**
+     * Returns the annotated IPv6 payload protocol. MUST be used only when `IsIp6ReceiveInfoSet()` is `TRUE`.
+     *
+     * @returns The payload protocol (next header value after any extension headers).
+     */
+    uint8_t GetIp6Proto(void) const { return GetMetadata().mIp6Proto; }
+
+    /**
+     * Returns the annotated IPv6 ECN field value. MUST be used only when `IsIp6ReceiveInfoSet()` is `TRUE`.
+     *
+     * @returns The ECN field value from the IPv6 header.
+     */
+    uint8_t GetIp6Ecn(void) const { return GetMetadata().mIp6Ecn; }
+
+    /**
+     * Returns the annotated IPv6 payload offset. MUST be used only when `IsIp6ReceiveInfoSet()` is `TRUE`.
+     *
+     * @returns The offset of the payload (e.g., transport-layer header) within the message.
+     */
+    uint16_t GetIp6PayloadOffset(void) const { return GetMetadata().mIp6PayloadOffset; }
+
     /**
      * Determines the length (number of bytes) in the message from the current message offset to the end of the message.
      *
@@ -656,6 +774,17 @@ public:
      */
     Error SetPriority(Priority aPriority);
 
+    /**
+     * Returns the buffer class used when allocating buffers for this message.
+     *
+     * @returns The buffer class associated with this message.
+     */
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+    BufferClass GetBufferClass(void) const { return static_cast<BufferClass>(GetMetadata().mBufferClass); }
+#else
+    BufferClass GetBufferClass(void) const { return kBufferClassRegular; }
+#endif
+
     /**
      * Convert a `Priority` to a string.
      *
@@ -1146,6 +1275,48 @@ public:
      */
     template <CloneMode kMode> Message *Clone(uint16_t aLength) const;
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+    /**
+     * Creates a copy of the message sharing its buffers (copy-on-write).
+     *
+     * Instead of deep-copying every buffer, the cloned message gets its own head buffer (and therefore its own
+     * metadata and reserved header) while sharing the rest of the buffer chain with the original message using
+     * reference counting. The shared buffers are released when the last message referencing them is freed.
+     *
+     * A message with a shared buffer chain is copied on write: growing the message, prepending bytes, or writing
+     * beyond the head buffer first copies the shared buffers so the message becomes uniquely owned (see
+     * `EnsureUniquelyOwned()`). Shrinking the message length does not require a copy. Callers are expected to
+     * treat the cloned payload as a frozen snapshot and use this method for fan-out of messages that are not
+     * further modified (e.g., per-transmission copies of a buffered multicast).
+     *
+     * If the buffer layouts of the two messages do not allow sharing, a regular deep clone (with the same
+     * reserved header size) is created instead.
+     *
+     * See the non-templated `Clone()` method for details on which message fields are also copied.
+     *
+     * @returns A pointer to the message or `nullptr` if insufficient message buffers are available.
+     */
+    Message *CloneWithSharedBuffers(void) const;
+
+    /**
+     * Indicates whether the message's tail buffer chain is shared with another message.
+     *
+     * The head buffer (containing the message metadata) is always uniquely owned.
+     *
+     * @retval TRUE   The tail buffer chain is shared with at least one other message.
+     * @retval FALSE  All buffers are uniquely owned by this message.
+     */
+    bool AreBuffersShared(void) const;
+
+    /**
+     * Ensures the message exclusively owns all its buffers, copying any shared ones.
+     *
+     * @retval kErrorNone    The message now exclusively owns all its buffers (or already did).
+     * @retval kErrorNoBufs  Insufficient buffers to copy the shared chain. The message is unchanged.
+     */
+    Error EnsureUniquelyOwned(void);
+#endif // OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+
     /**
      * Returns the datagram tag used for 6LoWPAN fragmentation or the identification used for IPv6
      * fragmentation.
@@ -1161,6 +1332,24 @@ public:
      */
     void SetDatagramTag(uint32_t aTag) { GetMetadata().mDatagramTag = aTag; }
 
+#if OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+    /**
+     * Returns the largest observed gap between successive fragment arrivals while the message is under 6LoWPAN
+     * reassembly.
+     *
+     * @returns The largest observed inter-fragment gap (in milliseconds).
+     */
+    uint16_t GetMaxReassemblyGap(void) const { return GetMetadata().mMaxReassemblyGap; }
+
+    /**
+     * Sets the largest observed gap between successive fragment arrivals while the message is under 6LoWPAN
+     * reassembly.
+     *
+     * @param[in]  aGap  The largest observed inter-fragment gap (in milliseconds).
+     */
+    void SetMaxReassemblyGap(uint16_t aGap) { GetMetadata().mMaxReassemblyGap = aGap; }
+#endif
+
 #if OPENTHREAD_FTD
     /**
      * Gets the indirect transmission `ChildMask` associated with this `Message`.
@@ -1268,6 +1457,54 @@ public:
      */
     void SetTimestampToNow(void) { SetTimestamp(TimerMilli::GetNow()); }
 
+#if OPENTHREAD_CONFIG_MESSAGE_LIFECYCLE_TRACE_ENABLE
+    /**
+     * Records the current time as the message's lifecycle trace queue time.
+     *
+     * Intended to be called when the message is queued as an IPv6 datagram for transmission. Calling this also
+     * clears any previously recorded frame preparation time.
+     */
+    void MarkLifecycleQueueTime(void);
+
+    /**
+     * Records the current time as the message's lifecycle trace frame preparation time.
+     *
+     * Only the first call after `MarkLifecycleQueueTime()` takes effect, so for a fragmented message the recorded
+     * time corresponds to the preparation of its first MAC frame.
+     */
+    void MarkLifecycleFramePrepTime(void);
+
+    /**
+     * Gets the recorded lifecycle trace times.
+     *
+     * @param[out] aQueueTime      A reference to return the time the message was queued for transmission.
+     * @param[out] aFramePrepTime  A reference to return the time the first MAC frame was prepared.
+     *
+     * @retval TRUE   Both times were recorded and are returned in @p aQueueTime and @p aFramePrepTime.
+     * @retval FALSE  The lifecycle trace times were not fully recorded.
+     */
+    bool GetLifecycleTimes(TimeMilli &aQueueTime, TimeMilli &aFramePrepTime) const;
+#endif
+
+#if OPENTHREAD_CONFIG_RADIO_RX_TIMESTAMP_ENABLE
+    /**
+     * Returns the radio receive timestamp.
+     *
+     * This is applicable for messages received over Thread radio. For a multi-fragment message, the timestamp
+     * tracks the last received fragment.
+     *
+     * @returns The radio receive timestamp (in microseconds, `otPlatRadioGetNow()` time base).
+     */
+    uint64_t GetRadioRxTimestamp(void) const { return GetMetadata().mRadioRxTimestamp; }
+
+    /**
+     * Sets the radio receive timestamp.
+     *
+     * @param[in] aTimestamp   The radio receive timestamp (in microseconds).
+     */
+    void SetRadioRxTimestamp(uint64_t aTimestamp) { GetMetadata().mRadioRxTimestamp = aTimestamp; }
+#endif
+
     /**
      * Returns whether or not message forwarding is scheduled for direct transmission.
      *
@@ -1619,19 +1856,78 @@ private:
         uint8_t *GetBytes(void) { return AsNonConst(Chunk::GetBytes()); }
     };
 
+public:
+    /**
+     * Represents an iterator over the successive contiguous data buffer segments (chunks) of a message covering a
+     * given offset range.
+     *
+     * This allows the message bytes to be processed in place, chunk by chunk, without copying them out into a
+     * separate linear buffer.
+     */
+    class ChunkIterator
+    {
+    public:
+        /**
+         * Initializes the `ChunkIterator` for a given message and offset range.
+         *
+         * The offset range is clamped to the bytes available in @p aMessage. The constructed iterator keeps a
+         * reference to @p aMessage and MUST not outlive it.
+         *
+         * @param[in] aMessage      The message whose chunks to iterate over.
+         * @param[in] aOffsetRange  The offset range in @p aMessage to cover.
+         */
+        ChunkIterator(const Message &aMessage, const OffsetRange &aOffsetRange);
+
+        /**
+         * Gets the next chunk (contiguous segment of message bytes).
+         *
+         * @param[out] aBytes   A reference to a pointer to output the start of the chunk.
+         * @param[out] aLength  A reference to a `uint16_t` to output the number of bytes in the chunk.
+         *
+         * @retval TRUE   Successfully got the next chunk. @p aBytes and @p aLength are updated.
+         * @retval FALSE  No more chunks. Reached the end of the covered offset range.
+         */
+        bool GetNextChunk(const uint8_t *&aBytes, uint16_t &aLength);
+
+    private:
+        const Message &mMessage;
+        uint16_t       mRemainingLength;
+        Chunk          mChunk;
+    };
+
+private:
     void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk) const;
     void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, MutableChunk &aChunk);
+#else
     void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, MutableChunk &aChunk)
     {
         AsConst(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
     }
+#endif
 
     void GetNextChunk(uint16_t &aLength, MutableChunk &aChunk)
     {
         AsConst(this)->GetNextChunk(aLength, static_cast<Chunk &>(aChunk));
     }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+    void SetBufferClass(BufferClass aBufferClass) { GetMetadata().mBufferClass = aBufferClass; }
+
+    uint16_t GetHeadBufferDataSize(void) const;
+    uint16_t GetBufferDataSize(const Buffer &aBuffer) const;
+#else
+    uint16_t GetHeadBufferDataSize(void) const { return kHeadBufferDataSize; }
+
+    uint16_t GetBufferDataSize(const Buffer &aBuffer) const
+    {
+        OT_UNUSED_VARIABLE(aBuffer);
+        return kBufferDataSize;
+    }
+#endif
+
     void MarkAsNotInAQueue(void);
     bool IsInAQueue(void) const { return (Prev() != this); }
     bool IsInAPriorityQueue(void) const { return GetMetadata().mInPriorityQ; }
@@ -1648,6 +1944,11 @@ private:
     static const Message *NextOf(const Message *aMessage) { return (aMessage != nullptr) ? aMessage->Next() : nullptr; }
 
     Error ResizeMessage(uint16_t aLength);
+
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+    void RecordLengthChange(uint16_t aOldLength, uint16_t aNewLength);
+#endif
+    void  CopySelectedInfoTo(Message &aClone) const;
 };
 
 /**
@@ -1890,6 +2191,29 @@ public:
      */
     void GetInfo(Info &aInfo) const;
 
+    /**
+     * Returns the current number of messages in the queue.
+     *
+     * @returns The number of messages in the queue.
+     */
+    uint16_t GetNumMessages(void) const { return mNumMessages; }
+
+    /**
+     * Returns the maximum number of messages in the queue at the same time (queue-depth watermark).
+     *
+     * The watermark is tracked since initialization or since the last call to `ResetMaxNumMessages()`.
+     *
+     * @returns The maximum number of messages in the queue at the same time so far.
+     */
+    uint16_t GetMaxNumMessages(void) const { return mMaxNumMessages; }
+
+    /**
+     * Resets the tracked queue-depth watermark.
+     *
+     * @sa GetMaxNumMessages
+     */
+    void ResetMaxNumMessages(void) { mMaxNumMessages = mNumMessages; }
+
     // The following methods are intended to support range-based `for`
     // loop iteration over the queue entries and should not be used
     // directly. The range-based `for` works correctly even if the
@@ -1911,6 +2235,8 @@ private:
 
     Message *mHead;
     Message *mTails[Message::kNumPriorities]; // Tail pointers associated with different priority levels.
+    uint16_t mNumMessages;                    // Current number of messages in the queue.
+    uint16_t mMaxNumMessages;                 // Maximum number of messages in the queue at the same time.
 };
 
 /**
@@ -1946,6 +2272,24 @@ public:
      */
     Message *Allocate(Message::Type aType, uint16_t aReserveHeader, const Message::Settings &aSettings);
 
+    /**
+     * Allocates a new message with specified settings from a given buffer class.
+     *
+     * If no buffer of the requested class is available, the allocation falls back to the regular buffer class. When
+     * `OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE` is not enabled, @p aBufferClass is ignored.
+     *
+     * @param[in]  aType           The message type.
+     * @param[in]  aReserveHeader  The number of header bytes to reserve.
+     * @param[in]  aSettings       The message settings.
+     * @param[in]  aBufferClass    The buffer class to allocate the message buffers from.
+     *
+     * @returns A pointer to the message or `nullptr` if no message buffers are available.
+     */
+    Message *Allocate(Message::Type            aType,
+                      uint16_t                 aReserveHeader,
+                      const Message::Settings &aSettings,
+                      Message::BufferClass     aBufferClass);
+
     /**
      * Allocates a new message of a given type using default settings.
      *
@@ -2001,18 +2345,62 @@ public:
      */
     void ResetMaxUsedBufferCount(void) { mMaxAllocated = mNumAllocated; }
 
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+    /**
+     * Represents the per-type accounting stats (live message count and payload bytes).
+     */
+    struct TypeStats : public Clearable<TypeStats>
+    {
+        uint16_t mNumMessages; ///< Number of live messages of this type.
+        uint32_t mNumBytes;    ///< Total payload bytes across the live messages.
+    };
+
+    static constexpr uint8_t kNumTypes = Message::kTypeOther + 1; ///< Number of message types.
+
+    /**
+     * Gets the accounting stats for a given message type.
+     *
+     * @param[in] aType   The message type.
+     *
+     * @returns The accounting stats for @p aType.
+     */
+    const TypeStats &GetTypeStats(Message::Type aType) const { return mTypeStats[aType]; }
+#endif
+
 private:
     static constexpr uint16_t kNumBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
 
     Buffer *NewBuffer(Message::Priority aPriority);
+    Buffer *NewBuffer(Message::Priority aPriority, Message::BufferClass aBufferClass);
     void    FreeBuffers(Buffer *aBuffer);
     Error   ReclaimBuffers(Message::Priority aPriority);
 
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+    void UpdateTypeStats(Message::Type aType, int32_t aNumMessagesDelta, int32_t aNumBytesDelta);
+#endif
+
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+    static constexpr uint16_t kNumSmallBuffers = OPENTHREAD_CONFIG_NUM_SMALL_MESSAGE_BUFFERS;
+
+    Buffer *NewSmallBuffer(void);
+    bool    IsSmallBuffer(const Buffer &aBuffer) const;
+#endif
+
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     Pool<Buffer, kNumBuffers> mBufferPool;
 #endif
     uint16_t mNumAllocated;
     uint16_t mMaxAllocated;
+
+#if OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+    TypeStats mTypeStats[kNumTypes];
+#endif
+
+#if OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+    Buffer  *mSmallFreeList;
+    uint16_t mNumSmallAllocated;
+    uint64_t mSmallBufferStorage[OT_ALIGNED_VAR_SIZE(kNumSmallBuffers * Buffer::kSmallSize, uint64_t)];
+#endif
 };
 
 // Declare specializations of `Message::Clone<CloneMode>()` (implemented in `message.cpp`).
@@ -41,6 +41,8 @@ RegisterLogModule("Notifier");
 
 Notifier::Notifier(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mNumEventsEmitted(0)
+    , mNumEventsDelivered(0)
     , mTask(aInstance)
 {
 }
@@ -97,98 +99,102 @@ void Notifier::EmitEvents(void)
 
     // Emit events to core internal modules
 
-    Get<Mle::Mle>().HandleNotifierEvents(events);
+    EmitTo<Mle::Mle>(events);
 #if OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
-    Get<NetworkData::Service::Manager>().HandleNotifierEvents(events);
+    EmitTo<NetworkData::Service::Manager>(events);
 #endif
 #if (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
-    Get<BackboneRouter::Leader>().HandleNotifierEvents(events);
+    EmitTo<BackboneRouter::Leader>(events);
 #endif
 #if OPENTHREAD_CONFIG_DHCP6_SERVER_ENABLE
-    Get<Dhcp6::Server>().HandleNotifierEvents(events);
+    EmitTo<Dhcp6::Server>(events);
 #endif
 #if OPENTHREAD_CONFIG_NEIGHBOR_DISCOVERY_AGENT_ENABLE
-    Get<NeighborDiscovery::Agent>().HandleNotifierEvents(events);
+    EmitTo<NeighborDiscovery::Agent>(events);
 #endif
 #if OPENTHREAD_CONFIG_DHCP6_CLIENT_ENABLE
-    Get<Dhcp6::Client>().HandleNotifierEvents(events);
+    EmitTo<Dhcp6::Client>(events);
 #endif
-    Get<EnergyScanServer>().HandleNotifierEvents(events);
+    EmitTo<EnergyScanServer>(events);
+    EmitTo<Lowpan::Lowpan>(events);
 #if OPENTHREAD_FTD
-    Get<MeshCoP::JoinerRouter>().HandleNotifierEvents(events);
+    EmitTo<MeshCoP::JoinerRouter>(events);
 #if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
-    Get<BackboneRouter::Manager>().HandleNotifierEvents(events);
+    EmitTo<BackboneRouter::Manager>(events);
 #endif
-    Get<ChildSupervisor>().HandleNotifierEvents(events);
+    EmitTo<ChildSupervisor>(events);
 #if OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE
-    Get<MeshCoP::DatasetUpdater>().HandleNotifierEvents(events);
+    EmitTo<MeshCoP::DatasetUpdater>(events);
 #endif
 #endif // OPENTHREAD_FTD
 #if OPENTHREAD_FTD || OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE || OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
-    Get<NetworkData::Notifier>().HandleNotifierEvents(events);
+    EmitTo<NetworkData::Notifier>(events);
 #endif
 #if OPENTHREAD_CONFIG_ANNOUNCE_SENDER_ENABLE
-    Get<AnnounceSender>().HandleNotifierEvents(events);
+    EmitTo<AnnounceSender>(events);
 #endif
 #if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE
-    Get<MeshCoP::BorderAgent::Manager>().HandleNotifierEvents(events);
-    Get<MeshCoP::BorderAgent::TxtData>().HandleNotifierEvents(events);
+    EmitTo<MeshCoP::BorderAgent::Manager>(events);
+    EmitTo<MeshCoP::BorderAgent::TxtData>(events);
 #endif
 #if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE && OPENTHREAD_CONFIG_BORDER_AGENT_ADMITTER_ENABLE
-    Get<MeshCoP::BorderAgent::Admitter>().HandleNotifierEvents(events);
+    EmitTo<MeshCoP::BorderAgent::Admitter>(events);
 #endif
 #if OPENTHREAD_CONFIG_MLR_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE)
-    Get<MlrManager>().HandleNotifierEvents(events);
+    EmitTo<MlrManager>(events);
 #endif
 #if OPENTHREAD_CONFIG_DUA_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE)
-    Get<DuaManager>().HandleNotifierEvents(events);
+    EmitTo<DuaManager>(events);
 #endif
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
-    Get<Trel::Link>().HandleNotifierEvents(events);
+    EmitTo<Trel::Link>(events);
 #endif
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
-    Get<TimeSync>().HandleNotifierEvents(events);
+    EmitTo<TimeSync>(events);
 #endif
 #if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
-    Get<Ip6::Slaac>().HandleNotifierEvents(events);
+    EmitTo<Ip6::Slaac>(events);
 #endif
 #if OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE
-    Get<Utils::JamDetector>().HandleNotifierEvents(events);
+    EmitTo<Utils::JamDetector>(events);
 #endif
 #if OPENTHREAD_CONFIG_OTNS_ENABLE
-    Get<Utils::Otns>().HandleNotifierEvents(events);
+    EmitTo<Utils::Otns>(events);
+#endif
+#if OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE
+    EmitTo<Utils::TelemetryEmitter>(events);
 #endif
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
-    Get<HistoryTracker::Local>().HandleNotifierEvents(events);
+    EmitTo<HistoryTracker::Local>(events);
 #endif
 #if OPENTHREAD_ENABLE_VENDOR_EXTENSION
-    Get<Extension::ExtensionBase>().HandleNotifierEvents(events);
+    EmitTo<Extension::ExtensionBase>(events);
 #endif
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
-    Get<BorderRouter::RxRaTracker>().HandleNotifierEvents(events);
-    Get<BorderRouter::RoutingManager>().HandleNotifierEvents(events);
+    EmitTo<BorderRouter::RxRaTracker>(events);
+    EmitTo<BorderRouter::RoutingManager>(events);
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_TRACK_PEER_BR_INFO_ENABLE
-    Get<BorderRouter::NetDataBrTracker>().HandleNotifierEvents(events);
+    EmitTo<BorderRouter::NetDataBrTracker>(events);
 #endif
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
-    Get<BorderRouter::MultiAilDetector>().HandleNotifierEvents(events);
+    EmitTo<BorderRouter::MultiAilDetector>(events);
 #endif
 #endif
 #if OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
-    Get<Srp::Client>().HandleNotifierEvents(events);
+    EmitTo<Srp::Client>(events);
 #endif
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
-    Get<Srp::Server>().HandleNotifierEvents(events);
+    EmitTo<Srp::Server>(events);
 #endif
 
 #if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_ENABLE
     // The `NetworkData::Publisher` is notified last (e.g., after SRP
     // client) to allow other modules to request changes to what is
     // being published (if needed).
-    Get<NetworkData::Publisher>().HandleNotifierEvents(events);
+    EmitTo<NetworkData::Publisher>(events);
 #endif
 #if OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_ENABLE
-    Get<Utils::LinkMetricsManager>().HandleNotifierEvents(events);
+    EmitTo<Utils::LinkMetricsManager>(events);
 #endif
 
     for (ExternalCallback &callback : mExternalCallbacks)
@@ -242,6 +242,24 @@ public:
      */
     bool IsPending(void) const { return !mEventsToSignal.IsEmpty(); }
 
+    /**
+     * Returns the total number of times a core internal subscriber was considered while emitting event batches.
+     *
+     * Together with `GetNumEventsDelivered()`, this sizes the benefit of the per-subscriber event masks: the
+     * difference between the two counters is the number of `HandleNotifierEvents()` calls skipped because the
+     * emitted batch contained none of the events in the subscriber's mask.
+     *
+     * @returns The number of subscriber notifications considered.
+     */
+    uint32_t GetNumEventsEmitted(void) const { return mNumEventsEmitted; }
+
+    /**
+     * Returns the total number of `HandleNotifierEvents()` calls actually made to core internal subscribers.
+     *
+     * @returns The number of subscriber notifications delivered.
+     */
+    uint32_t GetNumEventsDelivered(void) const { return mNumEventsDelivered; }
+
     /**
      * Indicates whether or not an event has been signaled before.
      *
@@ -298,6 +316,23 @@ private:
 
     void EmitEvents(void);
 
+    // Emits the events to a core internal subscriber, skipping the
+    // `HandleNotifierEvents()` call when the emitted batch contains
+    // none of the events in the subscriber's `kNotifierEvents` mask.
+    // Every subscriber declares `kNotifierEvents` next to its
+    // handler declaration and MUST keep it in sync with the events
+    // its handler checks.
+    template <typename SubscriberType> void EmitTo(Events aEvents)
+    {
+        mNumEventsEmitted++;
+
+        if (aEvents.ContainsAny(SubscriberType::kNotifierEvents))
+        {
+            mNumEventsDelivered++;
+            Get<SubscriberType>().HandleNotifierEvents(aEvents);
+        }
+    }
+
     void        LogEvents(Events aEvents) const;
     const char *EventToString(Event aEvent) const;
 
@@ -306,6 +341,8 @@ private:
 
     Events                mEventsToSignal;
     Events                mSignaledEvents;
+    uint32_t              mNumEventsEmitted;
+    uint32_t              mNumEventsDelivered;
     EmitEventsTask        mTask;
     ExternalCallbackArray mExternalCallbacks;
 };
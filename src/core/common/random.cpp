@@ -35,6 +35,8 @@
 
 #include <openthread/platform/entropy.h>
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 
@@ -44,6 +46,12 @@ namespace Random {
 uint16_t               Manager::sInitCount = 0;
 Manager::NonCryptoPrng Manager::sPrng;
 
+#if (OPENTHREAD_FTD || OPENTHREAD_MTD) && (OPENTHREAD_CONFIG_CRYPTO_RANDOM_POOL_SIZE > 0)
+uint8_t                  Manager::sCryptoPool[OPENTHREAD_CONFIG_CRYPTO_RANDOM_POOL_SIZE];
+uint16_t                 Manager::sCryptoPoolRemaining = 0;
+Manager::CryptoPoolStats Manager::sCryptoPoolStats;
+#endif
+
 Manager::Manager(void)
 {
     uint32_t seed;
@@ -73,6 +81,10 @@ Manager::~Manager(void)
     VerifyOrExit(sInitCount == 0);
 
 #if OPENTHREAD_FTD || OPENTHREAD_MTD
+#if OPENTHREAD_CONFIG_CRYPTO_RANDOM_POOL_SIZE > 0
+    memset(sCryptoPool, 0, sizeof(sCryptoPool));
+    sCryptoPoolRemaining = 0;
+#endif
     otPlatCryptoRandomDeinit();
 #endif
 
@@ -80,6 +92,45 @@ exit:
     return;
 }
 
+#if (OPENTHREAD_FTD || OPENTHREAD_MTD) && (OPENTHREAD_CONFIG_CRYPTO_RANDOM_POOL_SIZE > 0)
+
+Error Manager::CryptoFillBuffer(uint8_t *aBuffer, uint16_t aSize)
+{
+    Error error = kErrorNone;
+
+    sCryptoPoolStats.mNumRequests++;
+
+    if (aSize >= sizeof(sCryptoPool))
+    {
+        // Requests at least as large as the pool gain nothing from
+        // caching and are passed to the platform DRBG directly.
+
+        sCryptoPoolStats.mNumPlatformCalls++;
+        error = otPlatCryptoRandomGet(aBuffer, aSize);
+        ExitNow();
+    }
+
+    if (aSize > sCryptoPoolRemaining)
+    {
+        sCryptoPoolStats.mNumPlatformCalls++;
+        SuccessOrExit(error = otPlatCryptoRandomGet(sCryptoPool, sizeof(sCryptoPool)));
+        sCryptoPoolRemaining = sizeof(sCryptoPool);
+    }
+
+    // Bytes are served from the end of the pool and wiped afterwards
+    // so that previously handed-out random values (which may have been
+    // used as key material) cannot be recovered from the pool.
+
+    sCryptoPoolRemaining -= aSize;
+    memcpy(aBuffer, &sCryptoPool[sCryptoPoolRemaining], aSize);
+    memset(&sCryptoPool[sCryptoPoolRemaining], 0, aSize);
+
+exit:
+    return error;
+}
+
+#endif // (OPENTHREAD_FTD || OPENTHREAD_MTD) && (OPENTHREAD_CONFIG_CRYPTO_RANDOM_POOL_SIZE > 0)
+
 uint32_t Manager::NonCryptoGetUint32(void)
 {
     OT_ASSERT(sInitCount > 0);
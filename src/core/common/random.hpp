@@ -72,6 +72,36 @@ public:
     static uint32_t NonCryptoGetUint32(void);
 
 #if OPENTHREAD_FTD || OPENTHREAD_MTD
+#if OPENTHREAD_CONFIG_CRYPTO_RANDOM_POOL_SIZE > 0
+    /**
+     * Represents crypto random pool statistics (for measuring the reduction in platform DRBG invocations).
+     */
+    struct CryptoPoolStats
+    {
+        uint32_t mNumRequests;      ///< Number of `CryptoFillBuffer()` requests.
+        uint32_t mNumPlatformCalls; ///< Number of `otPlatCryptoRandomGet()` invocations (refills and bypasses).
+    };
+
+    /**
+     * Fills a given buffer with cryptographically secure random bytes.
+     *
+     * Requests smaller than the pool are served from the cached pool (refilling it from the platform DRBG when
+     * needed), while larger requests are passed to the platform DRBG directly. Served bytes are wiped from the pool.
+     *
+     * @param[out] aBuffer  A pointer to a buffer to fill with the random bytes.
+     * @param[in]  aSize    Size of buffer (number of bytes to fill).
+     *
+     * @retval kErrorNone    Successfully filled buffer with random values.
+     */
+    static Error CryptoFillBuffer(uint8_t *aBuffer, uint16_t aSize);
+
+    /**
+     * Gets the crypto random pool statistics.
+     *
+     * @returns The crypto random pool statistics.
+     */
+    static const CryptoPoolStats &GetCryptoPoolStats(void) { return sCryptoPoolStats; }
+#else
     /**
      * Fills a given buffer with cryptographically secure random bytes.
      *
@@ -82,6 +112,7 @@ public:
      */
     static Error CryptoFillBuffer(uint8_t *aBuffer, uint16_t aSize) { return otPlatCryptoRandomGet(aBuffer, aSize); }
 #endif
+#endif
 
 private:
     class NonCryptoPrng // A non-crypto Pseudo Random Number Generator (PRNG)
@@ -96,6 +127,11 @@ private:
 
     static uint16_t      sInitCount;
     static NonCryptoPrng sPrng;
+#if (OPENTHREAD_FTD || OPENTHREAD_MTD) && (OPENTHREAD_CONFIG_CRYPTO_RANDOM_POOL_SIZE > 0)
+    static uint8_t         sCryptoPool[OPENTHREAD_CONFIG_CRYPTO_RANDOM_POOL_SIZE];
+    static uint16_t        sCryptoPoolRemaining;
+    static CryptoPoolStats sCryptoPoolStats;
+#endif
 };
 
 namespace NonCrypto {
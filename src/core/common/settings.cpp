@@ -161,11 +161,12 @@ const char *SettingsBase::KeyToString(Key aKey)
     _(kKeyBrUlaPrefix, "BrUlaPrefix")             \
     _(kKeyBrOnLinkPrefixes, "BrOnLinkPrefixes")   \
     _(kKeyBorderAgentId, "BorderAgentId")         \
-    _(kKeyTcatCommrCert, "TcatCommrCert")
+    _(kKeyTcatCommrCert, "TcatCommrCert")         \
+    _(kKeyDiscoverChannel, "DiscoverChannel")
 
     DefineEnumStringArray(KeyMapList);
 
-    static_assert(kLastKey == kKeyTcatCommrCert, "kLastKey is not valid");
+    static_assert(kLastKey == kKeyDiscoverChannel, "kLastKey is not valid");
 
     OT_ASSERT(aKey <= kLastKey);
 
@@ -187,10 +188,27 @@ const uint16_t Settings::kSensitiveKeys[] = {
 
 void Settings::Init(void) { Get<SettingsDriver>().Init(kSensitiveKeys, GetArrayLength(kSensitiveKeys)); }
 
-void Settings::Deinit(void) { Get<SettingsDriver>().Deinit(); }
+void Settings::Deinit(void)
+{
+#if OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+    mFlushTimer.Stop();
+    FlushDirtyEntries();
+#endif
+    Get<SettingsDriver>().Deinit();
+}
 
 void Settings::Wipe(void)
 {
+#if OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+    mFlushTimer.Stop();
+
+    for (CacheEntry &entry : mCacheEntries)
+    {
+        entry.mIsValid = true;
+        entry.mIsFound = false;
+        entry.mIsDirty = false;
+    }
+#endif
     Get<SettingsDriver>().Wipe();
     LogInfo("Wiped all info");
 }
@@ -379,9 +397,59 @@ Error Settings::ReadEntry(Key aKey, void *aValue, uint16_t aMaxLength) const
     Error    error;
     uint16_t length = aMaxLength;
 
+#if OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+    CacheEntry *cache = FindCacheEntry(aKey);
+
+    if (cache != nullptr)
+    {
+        if (!cache->mIsValid)
+        {
+            uint16_t cacheLength = sizeof(cache->mValue);
+
+            switch (Get<SettingsDriver>().Get(aKey, cache->mValue, &cacheLength))
+            {
+            case kErrorNone:
+                cache->mLength  = Min(cacheLength, static_cast<uint16_t>(sizeof(cache->mValue)));
+                cache->mIsFound = true;
+                cache->mIsValid = true;
+                break;
+
+            case kErrorNotFound:
+                cache->mIsFound = false;
+                cache->mIsValid = true;
+                break;
+
+            default:
+                // On any other error the read falls through to the
+                // platform store directly (cache stays invalid).
+                break;
+            }
+        }
+
+        if (cache->mIsValid)
+        {
+            if (cache->mIsFound)
+            {
+                memcpy(aValue, cache->mValue, Min(cache->mLength, aMaxLength));
+                error = kErrorNone;
+            }
+            else
+            {
+                error = kErrorNotFound;
+            }
+
+            Log(kActionRead, error, aKey, aValue);
+            ExitNow();
+        }
+    }
+#endif
+
     error = Get<SettingsDriver>().Get(aKey, aValue, &length);
     Log(kActionRead, error, aKey, aValue);
 
+#if OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+exit:
+#endif
     return error;
 }
 
@@ -391,6 +459,46 @@ void Settings::SaveEntry(Key aKey, const void *aValue, void *aPrev, uint16_t aLe
     uint16_t readLength = aLength;
     Action   action     = kActionSave;
 
+#if OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+    CacheEntry *cache = FindCacheEntry(aKey);
+
+    if ((cache != nullptr) && (aLength <= sizeof(cache->mValue)))
+    {
+        if (cache->mIsValid && cache->mIsFound && (cache->mLength == aLength) &&
+            (memcmp(cache->mValue, aValue, aLength) == 0))
+        {
+            action = kActionResave;
+        }
+        else
+        {
+            memcpy(cache->mValue, aValue, aLength);
+            cache->mLength  = aLength;
+            cache->mIsFound = true;
+            cache->mIsValid = true;
+
+            if (aKey == kKeyNetworkInfo)
+            {
+                // The `NetworkInfo` record is saved in bursts (frame
+                // counter persistence on attach and key rotation), so
+                // its writes are coalesced in the cache and flushed to
+                // the platform store after a short bounded delay.
+                // Other records write through immediately.
+
+                cache->mIsDirty = true;
+                mFlushTimer.FireAtIfEarlier(TimerMilli::GetNow() + kFlushDelay);
+            }
+            else
+            {
+                error = Get<SettingsDriver>().Set(aKey, aValue, aLength);
+            }
+        }
+
+        Log(action, error, aKey, aValue);
+        SuccessOrAssert(error);
+        ExitNow();
+    }
+#endif
+
     if ((Get<SettingsDriver>().Get(aKey, aPrev, &readLength) == kErrorNone) && (readLength == aLength) &&
         (memcmp(aValue, aPrev, aLength) == 0))
     {
@@ -404,15 +512,71 @@ void Settings::SaveEntry(Key aKey, const void *aValue, void *aPrev, uint16_t aLe
     Log(action, error, aKey, aValue);
 
     SuccessOrAssert(error);
+
+#if OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+exit:
+    return;
+#endif
 }
 
 void Settings::DeleteEntry(Key aKey)
 {
-    Error error = Get<SettingsDriver>().Delete(aKey);
+    Error error;
+
+#if OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+    CacheEntry *cache = FindCacheEntry(aKey);
+
+    if (cache != nullptr)
+    {
+        cache->mIsValid = true;
+        cache->mIsFound = false;
+        cache->mIsDirty = false;
+    }
+#endif
+
+    error = Get<SettingsDriver>().Delete(aKey);
 
     Log(kActionDelete, error, aKey);
 }
 
+#if OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+
+const Settings::Key Settings::kCachedKeys[Settings::kNumCacheEntries] = {kKeyNetworkInfo, kKeyParentInfo};
+
+Settings::CacheEntry *Settings::FindCacheEntry(Key aKey) const
+{
+    CacheEntry *entry = nullptr;
+
+    for (uint8_t index = 0; index < kNumCacheEntries; index++)
+    {
+        if (kCachedKeys[index] == aKey)
+        {
+            entry = &mCacheEntries[index];
+            break;
+        }
+    }
+
+    return entry;
+}
+
+void Settings::HandleFlushTimer(void) { FlushDirtyEntries(); }
+
+void Settings::FlushDirtyEntries(void)
+{
+    for (uint8_t index = 0; index < kNumCacheEntries; index++)
+    {
+        CacheEntry &entry = mCacheEntries[index];
+
+        if (entry.mIsDirty)
+        {
+            entry.mIsDirty = false;
+            SuccessOrAssert(Get<SettingsDriver>().Set(kCachedKeys[index], entry.mValue, entry.mLength));
+        }
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+
 void Settings::Log(Action aAction, Error aError, Key aKey, const void *aValue)
 {
     OT_UNUSED_VARIABLE(aAction);
@@ -45,6 +45,9 @@
 #include "common/log.hpp"
 #include "common/non_copyable.hpp"
 #include "common/settings_driver.hpp"
+#if OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+#include "common/timer.hpp"
+#endif
 #include "crypto/ecdsa.hpp"
 #include "mac/mac_types.hpp"
 #include "meshcop/border_agent.hpp"
@@ -120,9 +123,10 @@ public:
         kKeyBrOnLinkPrefixes  = OT_SETTINGS_KEY_BR_ON_LINK_PREFIXES,
         kKeyBorderAgentId     = OT_SETTINGS_KEY_BORDER_AGENT_ID,
         kKeyTcatCommrCert     = OT_SETTINGS_KEY_TCAT_COMMR_CERT,
+        kKeyDiscoverChannel   = OT_SETTINGS_KEY_DISCOVER_CHANNEL,
     };
 
-    static constexpr Key kLastKey = kKeyTcatCommrCert; ///< The last (numerically) enumerator value in `Key`.
+    static constexpr Key kLastKey = kKeyDiscoverChannel; ///< The last (numerically) enumerator value in `Key`.
 
     static_assert(static_cast<uint16_t>(kLastKey) < static_cast<uint16_t>(OT_SETTINGS_KEY_VENDOR_RESERVED_MIN),
                   "Core settings keys overlap with vendor reserved keys");
@@ -722,6 +726,20 @@ public:
     };
 #endif
 
+    /**
+     * Defines constants and types for the channel of the last successful MLE Discovery.
+     */
+    class DiscoverChannel
+    {
+    public:
+        static constexpr Key kKey = kKeyDiscoverChannel; ///< The associated key.
+
+        typedef uint8_t ValueType; ///< The associated value type.
+
+    private:
+        DiscoverChannel(void) = default;
+    };
+
 protected:
     explicit SettingsBase(Instance &aInstance)
         : InstanceLocator(aInstance)
@@ -755,6 +773,10 @@ public:
      */
     explicit Settings(Instance &aInstance)
         : SettingsBase(aInstance)
+#if OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+        , mCacheEntries()
+        , mFlushTimer(aInstance)
+#endif
     {
     }
 
@@ -1128,6 +1150,33 @@ private:
     static void Log(Action aAction, Error aError, Key aKey, const void *aValue = nullptr);
 
     static const uint16_t kSensitiveKeys[];
+
+#if OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+    static constexpr uint8_t  kNumCacheEntries = 2;   // `NetworkInfo` and `ParentInfo`.
+    static constexpr uint32_t kFlushDelay      = 500; // Delay (in msec) before flushing coalesced writes.
+
+    struct CacheEntry
+    {
+        uint8_t  mValue[sizeof(NetworkInfo)];
+        uint16_t mLength;
+        bool     mIsValid : 1; // Whether the cached state (including absence) is known.
+        bool     mIsFound : 1; // Whether the record exists (applicable when `mIsValid` is set).
+        bool     mIsDirty : 1; // Whether a coalesced write to the platform store is pending.
+    };
+
+    static_assert(sizeof(ParentInfo) <= sizeof(NetworkInfo), "Cache entry value buffer is too small");
+
+    static const Key kCachedKeys[kNumCacheEntries];
+
+    CacheEntry *FindCacheEntry(Key aKey) const;
+    void        HandleFlushTimer(void);
+    void        FlushDirtyEntries(void);
+
+    using FlushTimer = TimerMilliIn<Settings, &Settings::HandleFlushTimer>;
+
+    mutable CacheEntry mCacheEntries[kNumCacheEntries];
+    FlushTimer         mFlushTimer;
+#endif
 };
 
 } // namespace ot
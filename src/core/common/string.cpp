@@ -334,6 +334,10 @@ StringWriter &StringWriter::AppendVarArgs(const char *aFormat, va_list aArgs)
 {
     int len;
 
+#if OPENTHREAD_CONFIG_LIGHTWEIGHT_STRING_FORMATTER_ENABLE
+    VerifyOrExit(!TryAppendFormatted(aFormat, aArgs));
+#endif
+
     len = vsnprintf(mBuffer + mLength, (mSize > mLength ? (mSize - mLength) : 0), aFormat, aArgs);
     OT_ASSERT(len >= 0);
 
@@ -344,9 +348,260 @@ StringWriter &StringWriter::AppendVarArgs(const char *aFormat, va_list aArgs)
         mBuffer[mSize - 1] = kNullChar;
     }
 
+#if OPENTHREAD_CONFIG_LIGHTWEIGHT_STRING_FORMATTER_ENABLE
+exit:
+#endif
     return *this;
 }
 
+#if OPENTHREAD_CONFIG_LIGHTWEIGHT_STRING_FORMATTER_ENABLE
+
+bool StringWriter::CanFormatDirectly(const char *aFormat)
+{
+    // Determines whether @p aFormat uses only the conversions the
+    // direct formatter in `TryAppendFormatted()` supports. The check
+    // is performed (without consuming any arguments) before any
+    // output is emitted, so unsupported format strings fall back to
+    // `vsnprintf()` in full.
+
+    bool supported = true;
+
+    for (const char *cur = aFormat; *cur != kNullChar; cur++)
+    {
+        if (*cur != '%')
+        {
+            continue;
+        }
+
+        cur++;
+
+        while ((*cur == '-') || (*cur == '0'))
+        {
+            cur++;
+        }
+
+        while (IsDigit(*cur))
+        {
+            cur++;
+        }
+
+        if (*cur == 'l')
+        {
+            cur++;
+
+            if (*cur == 'l')
+            {
+                cur++;
+            }
+        }
+
+        switch (*cur)
+        {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'c':
+        case 's':
+        case '%':
+            break;
+
+        default:
+            ExitNow(supported = false);
+        }
+    }
+
+exit:
+    return supported;
+}
+
+bool StringWriter::TryAppendFormatted(const char *aFormat, va_list aArgs)
+{
+    bool success = CanFormatDirectly(aFormat);
+
+    VerifyOrExit(success);
+
+    for (const char *cur = aFormat; *cur != kNullChar; cur++)
+    {
+        bool     leftJustify = false;
+        char     padChar     = ' ';
+        uint16_t width       = 0;
+        uint8_t  numLongs    = 0;
+        char     conversion;
+
+        if (*cur != '%')
+        {
+            PutChar(*cur);
+            continue;
+        }
+
+        cur++;
+
+        for (;; cur++)
+        {
+            if (*cur == '-')
+            {
+                leftJustify = true;
+            }
+            else if (*cur == '0')
+            {
+                padChar = '0';
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        for (; IsDigit(*cur); cur++)
+        {
+            width = static_cast<uint16_t>(width * 10 + static_cast<uint8_t>(*cur - '0'));
+        }
+
+        for (; *cur == 'l'; cur++)
+        {
+            numLongs++;
+        }
+
+        conversion = *cur;
+
+        switch (conversion)
+        {
+        case '%':
+            PutChar('%');
+            break;
+
+        case 'c':
+        {
+            char c = static_cast<char>(va_arg(aArgs, int));
+
+            PutJustified(&c, 1, width, leftJustify, ' ');
+            break;
+        }
+
+        case 's':
+        {
+            const char *string = va_arg(aArgs, const char *);
+
+            if (string == nullptr)
+            {
+                string = "(null)";
+            }
+
+            PutJustified(string, StringLength(string, NumericLimits<uint16_t>::kMax), width, leftJustify, ' ');
+            break;
+        }
+
+        default: // 'd', 'i', 'u', 'x', or 'X'.
+        {
+            // Digits are generated from the least significant one into
+            // the end of `digits[]` (24 chars cover a 64-bit decimal
+            // value along with a sign character).
+
+            char               digits[24];
+            uint16_t           pos        = sizeof(digits);
+            bool               isNegative = false;
+            unsigned long long value;
+            const char        *hexChars = (conversion == 'X') ? "0123456789ABCDEF" : "0123456789abcdef";
+            uint8_t            base     = ((conversion == 'x') || (conversion == 'X')) ? 16 : 10;
+
+            if ((conversion == 'd') || (conversion == 'i'))
+            {
+                long long signedValue = (numLongs == 0)   ? va_arg(aArgs, int)
+                                        : (numLongs == 1) ? va_arg(aArgs, long)
+                                                          : va_arg(aArgs, long long);
+
+                isNegative = (signedValue < 0);
+                value      = static_cast<unsigned long long>(signedValue);
+
+                if (isNegative)
+                {
+                    value = 0 - value;
+                }
+            }
+            else
+            {
+                value = (numLongs == 0)   ? va_arg(aArgs, unsigned int)
+                        : (numLongs == 1) ? va_arg(aArgs, unsigned long)
+                                          : va_arg(aArgs, unsigned long long);
+            }
+
+            do
+            {
+                digits[--pos] = hexChars[value % base];
+                value /= base;
+            } while (value != 0);
+
+            if (isNegative)
+            {
+                if ((padChar == '0') && !leftJustify && (width > 0))
+                {
+                    // Zero padding goes between the sign and the
+                    // digits, so the sign is emitted separately and
+                    // the field width reduced accordingly.
+
+                    PutChar('-');
+                    width--;
+                }
+                else
+                {
+                    digits[--pos] = '-';
+                }
+            }
+
+            PutJustified(&digits[pos], sizeof(digits) - pos, width, leftJustify, padChar);
+            break;
+        }
+        }
+    }
+
+    mBuffer[(mLength < mSize) ? mLength : (mSize - 1)] = kNullChar;
+
+exit:
+    return success;
+}
+
+void StringWriter::PutChar(char aChar)
+{
+    // Tracks the full (untruncated) length in `mLength` while only
+    // writing characters that fit (leaving room for the null
+    // terminator), matching the `vsnprintf()` behavior.
+
+    if (mLength + 1 < mSize)
+    {
+        mBuffer[mLength] = aChar;
+    }
+
+    mLength++;
+}
+
+void StringWriter::PutJustified(const char *aChars, uint16_t aNumChars, uint16_t aWidth, bool aLeftJustify, char aPadChar)
+{
+    if (!aLeftJustify)
+    {
+        for (uint16_t i = aNumChars; i < aWidth; i++)
+        {
+            PutChar(aPadChar);
+        }
+    }
+
+    for (uint16_t i = 0; i < aNumChars; i++)
+    {
+        PutChar(aChars[i]);
+    }
+
+    if (aLeftJustify)
+    {
+        for (uint16_t i = aNumChars; i < aWidth; i++)
+        {
+            PutChar(' ');
+        }
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_LIGHTWEIGHT_STRING_FORMATTER_ENABLE
+
 StringWriter &StringWriter::AppendHexBytes(const uint8_t *aBytes, uint16_t aLength)
 {
     while (aLength--)
@@ -525,6 +525,14 @@ public:
     void ConvertToUppercase(void) { StringConvertToUppercase(mBuffer); }
 
 private:
+#if OPENTHREAD_CONFIG_LIGHTWEIGHT_STRING_FORMATTER_ENABLE
+    static bool CanFormatDirectly(const char *aFormat);
+
+    bool TryAppendFormatted(const char *aFormat, va_list aArgs);
+    void PutChar(char aChar);
+    void PutJustified(const char *aChars, uint16_t aNumChars, uint16_t aWidth, bool aLeftJustify, char aPadChar);
+#endif
+
     char          *mBuffer;
     uint16_t       mLength;
     const uint16_t mSize;
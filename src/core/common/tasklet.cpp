@@ -42,6 +42,9 @@ void Tasklet::Post(void)
 {
     if (!IsPosted())
     {
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+        mPostTime = TimerMilli::GetNow();
+#endif
         Get<Scheduler>().PostTasklet(*this);
     }
 }
@@ -54,6 +57,111 @@ void Tasklet::Unpost(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+
+void Tasklet::Scheduler::PostTasklet(Tasklet &aTasklet)
+{
+    // Tasklets are saved in circular singly linked lists, one per
+    // priority class.
+
+    Tasklet *&tail       = mTails[aTasklet.mPriority];
+    bool      wasPending = AreTaskletsPending();
+
+    if (tail == nullptr)
+    {
+        tail        = &aTasklet;
+        tail->mNext = tail;
+    }
+    else
+    {
+        aTasklet.mNext = tail->mNext;
+        tail->mNext    = &aTasklet;
+        tail           = &aTasklet;
+    }
+
+    if (!wasPending)
+    {
+        otTaskletsSignalPending(&aTasklet.GetInstance());
+    }
+}
+
+void Tasklet::Scheduler::RemoveTasklet(Tasklet &aTasklet)
+{
+    Tasklet *&tail = mTails[aTasklet.mPriority];
+    Tasklet  *prev = tail;
+
+    while (prev->mNext != &aTasklet)
+    {
+        prev = prev->mNext;
+    }
+
+    prev->mNext    = aTasklet.mNext;
+    aTasklet.mNext = nullptr;
+
+    if (tail == &aTasklet)
+    {
+        tail = (prev != &aTasklet) ? prev : nullptr;
+    }
+}
+
+void Tasklet::Scheduler::ProcessQueuedTasklets(void)
+{
+    // The per-class budget of tasklet runs per round-robin round. The
+    // budgets bound the deficit between the classes: in each round the
+    // high class runs up to its budget before the next class gets a
+    // turn, so latency critical tasklets are served first while a
+    // tasklet of a lower class never waits for more than one full
+    // round of higher class budgets.
+
+    static const uint8_t kBudgets[kNumPriorities] = {8, 4, 1};
+
+    Tasklet *tails[kNumPriorities];
+    bool     anyPending;
+
+    // This method processes all tasklets queued when this is called.
+    // We keep a copy of the current lists and then clear the main
+    // lists. A newly posted tasklet while processing the currently
+    // queued tasklets will then trigger a call to
+    // `otTaskletsSignalPending()`.
+
+    for (uint8_t priority = 0; priority < kNumPriorities; priority++)
+    {
+        tails[priority]  = mTails[priority];
+        mTails[priority] = nullptr;
+    }
+
+    do
+    {
+        anyPending = false;
+
+        for (uint8_t priority = 0; priority < kNumPriorities; priority++)
+        {
+            for (uint8_t budget = kBudgets[priority]; (budget > 0) && (tails[priority] != nullptr); budget--)
+            {
+                Tasklet *tail    = tails[priority];
+                Tasklet *tasklet = tail->mNext;
+
+                if (tasklet == tail)
+                {
+                    tails[priority] = nullptr;
+                }
+                else
+                {
+                    tail->mNext = tasklet->mNext;
+                }
+
+                tasklet->mNext = nullptr;
+
+                RunTasklet(*tasklet);
+            }
+
+            anyPending = anyPending || (tails[priority] != nullptr);
+        }
+    } while (anyPending);
+}
+
+#else // OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+
 void Tasklet::Scheduler::PostTasklet(Tasklet &aTasklet)
 {
     // Tasklets are saved in a circular singly linked list.
@@ -116,8 +224,28 @@ void Tasklet::Scheduler::ProcessQueuedTasklets(void)
         }
 
         tasklet->mNext = nullptr;
-        tasklet->RunTask();
+
+        RunTasklet(*tasklet);
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+
+void Tasklet::Scheduler::RunTasklet(Tasklet &aTasklet)
+{
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+    aTasklet.mMaxDelay = Max(aTasklet.mMaxDelay, TimerMilli::GetNow() - aTasklet.mPostTime);
+#endif
+
+#if OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
+    {
+        Utils::Instrumentation::Scope scope(aTasklet.GetInstance(), Utils::Instrumentation::kSiteTasklet);
+
+        aTasklet.RunTask();
     }
+#else
+    aTasklet.RunTask();
+#endif
 }
 
 } // namespace ot
@@ -42,6 +42,9 @@
 
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+#include "common/time.hpp"
+#endif
 
 namespace ot {
 
@@ -60,6 +63,20 @@ namespace ot {
 class Tasklet : public InstanceLocator
 {
 public:
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+    /**
+     * Represents the priority class of a tasklet.
+     */
+    enum Priority : uint8_t
+    {
+        kPriorityHigh   = 0, ///< Latency critical tasklets (e.g., frame TX preparation).
+        kPriorityNormal = 1, ///< Default priority class.
+        kPriorityLow    = 2, ///< Heavy background tasklets that tolerate extra delay.
+    };
+
+    static constexpr uint8_t kNumPriorities = 3; ///< Number of priority classes.
+#endif
+
     /**
      * Implements the tasklet scheduler.
      */
@@ -68,6 +85,27 @@ public:
         friend class Tasklet;
 
     public:
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+        /**
+         * Initializes the object.
+         */
+        Scheduler(void)
+            : mTails()
+        {
+        }
+
+        /**
+         * Indicates whether or not there are tasklets pending.
+         *
+         * @retval TRUE   If there are tasklets pending.
+         * @retval FALSE  If there are no tasklets pending.
+         */
+        bool AreTaskletsPending(void) const
+        {
+            return (mTails[kPriorityHigh] != nullptr) || (mTails[kPriorityNormal] != nullptr) ||
+                   (mTails[kPriorityLow] != nullptr);
+        }
+#else
         /**
          * Initializes the object.
          */
@@ -83,6 +121,7 @@ public:
          * @retval FALSE  If there are no tasklets pending.
          */
         bool AreTaskletsPending(void) const { return mTail != nullptr; }
+#endif
 
         /**
          * Processes all tasklets queued when this is called.
@@ -92,8 +131,13 @@ public:
     private:
         void PostTasklet(Tasklet &aTasklet);
         void RemoveTasklet(Tasklet &aTasklet);
+        void RunTasklet(Tasklet &aTasklet);
 
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+        Tasklet *mTails[kNumPriorities]; // Circular singly linked-lists, one per priority class.
+#else
         Tasklet *mTail; // A circular singly linked-list
+#endif
     };
 
     /**
@@ -113,6 +157,11 @@ public:
         : InstanceLocator(aInstance)
         , mHandler(aHandler)
         , mNext(nullptr)
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+        , mPriority(kPriorityNormal)
+        , mPostTime(0)
+        , mMaxDelay(0)
+#endif
     {
     }
 
@@ -138,11 +187,41 @@ public:
      */
     bool IsPosted(void) const { return (mNext != nullptr); }
 
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+    /**
+     * Sets the priority class of the tasklet.
+     *
+     * MUST be called when the tasklet is not posted.
+     *
+     * @param[in] aPriority  The priority class.
+     */
+    void SetPriority(Priority aPriority) { mPriority = aPriority; }
+
+    /**
+     * Returns the priority class of the tasklet.
+     *
+     * @returns The priority class of the tasklet.
+     */
+    Priority GetPriority(void) const { return mPriority; }
+
+    /**
+     * Returns the maximum observed delay (in msec) between posting and running the tasklet.
+     *
+     * @returns The maximum observed post-to-run delay (in msec).
+     */
+    uint32_t GetMaxDelay(void) const { return mMaxDelay; }
+#endif
+
 private:
     void RunTask(void) { mHandler(*this); }
 
     Handler  mHandler;
     Tasklet *mNext;
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+    Priority  mPriority;
+    TimeMilli mPostTime;
+    uint32_t  mMaxDelay;
+#endif
 };
 
 /**
@@ -44,87 +44,132 @@ TimeTicker::TimeTicker(Instance &aInstance)
 {
 }
 
-void TimeTicker::RegisterReceiver(Receiver aReceiver)
+void TimeTicker::RegisterReceiver(Receiver aReceiver, uint32_t aTickInterval)
 {
+    VerifyOrExit(!IsReceiverRegistered(aReceiver) || (mTickIntervals[aReceiver] != aTickInterval));
+
     mReceivers |= Mask(aReceiver);
+    mTickIntervals[aReceiver] = aTickInterval;
 
-    if (!mTimer.IsRunning())
-    {
-        mTimer.Start(Random::NonCrypto::GetUint32InRange(0, kTickInterval + 1));
-    }
+    // The first tick is scheduled at a random point within the
+    // receiver's interval to spread the tick phases of the receivers.
+
+    mNextTickTimes[aReceiver] = TimerMilli::GetNow() + Random::NonCrypto::GetUint32InRange(0, aTickInterval + 1);
+
+    ScheduleNextTick();
+
+exit:
+    return;
 }
 
 void TimeTicker::UnregisterReceiver(Receiver aReceiver)
 {
     mReceivers &= ~Mask(aReceiver);
 
-    if (mReceivers == 0)
+    ScheduleNextTick();
+}
+
+void TimeTicker::ScheduleNextTick(void)
+{
+    NextFireTime nextTime;
+
+    for (uint8_t receiver = 0; receiver < kNumReceivers; receiver++)
     {
-        mTimer.Stop();
+        if (mReceivers & Mask(static_cast<Receiver>(receiver)))
+        {
+            nextTime.UpdateIfEarlier(mNextTickTimes[receiver]);
+        }
     }
+
+    mTimer.FireAt(nextTime);
 }
 
 void TimeTicker::HandleTimer(void)
 {
-    mTimer.FireAt(mTimer.GetFireTime() + Random::NonCrypto::AddJitter(kTickInterval, kRestartJitter));
+    TimeMilli now          = TimerMilli::GetNow();
+    uint32_t  dueReceivers = 0;
+
+    // Determine the receivers whose tick is due and advance their next
+    // tick times, then program the timer for the earliest next needed
+    // tick before invoking the handlers.
+
+    for (uint8_t receiver = 0; receiver < kNumReceivers; receiver++)
+    {
+        uint32_t mask = Mask(static_cast<Receiver>(receiver));
+
+        if (((mReceivers & mask) == 0) || (mNextTickTimes[receiver] > now))
+        {
+            continue;
+        }
+
+        dueReceivers |= mask;
+        mNextTickTimes[receiver] += Random::NonCrypto::AddJitter(mTickIntervals[receiver], kRestartJitter);
+
+        if (mNextTickTimes[receiver] <= now)
+        {
+            mNextTickTimes[receiver] = now + mTickIntervals[receiver];
+        }
+    }
+
+    ScheduleNextTick();
 
-    if (mReceivers & Mask(kMeshForwarder))
+    if (dueReceivers & Mask(kMeshForwarder))
     {
         Get<MeshForwarder>().HandleTimeTick();
     }
 
 #if OPENTHREAD_FTD
-    if (mReceivers & Mask(kMle))
+    if (dueReceivers & Mask(kMle))
     {
         Get<Mle::Mle>().HandleTimeTick();
     }
 
-    if (mReceivers & Mask(kAddressResolver))
+    if (dueReceivers & Mask(kAddressResolver))
     {
         Get<AddressResolver>().HandleTimeTick();
     }
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE && OPENTHREAD_CONFIG_BORDER_ROUTER_REQUEST_ROUTER_ROLE
-    if (mReceivers & Mask(kNetworkDataNotifier))
+    if (dueReceivers & Mask(kNetworkDataNotifier))
     {
         Get<NetworkData::Notifier>().HandleTimeTick();
     }
 #endif
 
-    if (mReceivers & Mask(kChildSupervisor))
+    if (dueReceivers & Mask(kChildSupervisor))
     {
         Get<ChildSupervisor>().HandleTimeTick();
     }
 #endif // OPENTHREAD_FTD
 
 #if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
-    if (mReceivers & Mask(kIp6FragmentReassembler))
+    if (dueReceivers & Mask(kIp6FragmentReassembler))
     {
         Get<Ip6::Ip6>().HandleTimeTick();
     }
 #endif
 
 #if OPENTHREAD_CONFIG_DUA_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE)
-    if (mReceivers & Mask(kDuaManager))
+    if (dueReceivers & Mask(kDuaManager))
     {
         Get<DuaManager>().HandleTimeTick();
     }
 #endif
 
 #if OPENTHREAD_CONFIG_MLR_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE)
-    if (mReceivers & Mask(kMlrManager))
+    if (dueReceivers & Mask(kMlrManager))
     {
         Get<MlrManager>().HandleTimeTick();
     }
 #endif
 
-    if (mReceivers & Mask(kIp6Mpl))
+    if (dueReceivers & Mask(kIp6Mpl))
     {
         Get<Ip6::Mpl>().HandleTimeTick();
     }
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
-    if (mReceivers & Mask(kBbrLocal))
+    if (dueReceivers & Mask(kBbrLocal))
     {
         Get<BackboneRouter::Local>().HandleTimeTick();
     }
@@ -47,9 +47,13 @@ namespace ot {
 /**
  * Represents a time ticker.
  *
- * The time ticker emits periodic ticks (with 1 second period interval) to a set of registered tick receiver modules.
- * The tick receivers (OpenThread objects) are identified by the `Receiver` enumeration. The receiver objects
- * must provide `HandleTimeTick()` method which would be invoked by `TimeTicker` periodically.
+ * The time ticker emits periodic ticks (with 1 second period interval by default) to a set of registered tick
+ * receiver modules. The tick receivers (OpenThread objects) are identified by the `Receiver` enumeration. The
+ * receiver objects must provide `HandleTimeTick()` method which would be invoked by `TimeTicker` periodically.
+ *
+ * Each receiver can register with its own tick interval, and the ticker programs its timer for the earliest next
+ * needed tick across the registered receivers, so receivers with longer intervals do not force every-second
+ * wakeups (which matters for deep sleep on battery-powered devices).
  */
 class TimeTicker : public InstanceLocator, private NonCopyable
 {
@@ -75,6 +79,11 @@ public:
         kNumReceivers, ///< Number of receivers.
     };
 
+    /**
+     * The default time tick interval (in msec).
+     */
+    static constexpr uint32_t kDefaultTickInterval = Time::kOneSecondInMsec;
+
     /**
      * Initializes the `TimeTicker` instance.
      */
@@ -83,9 +92,12 @@ public:
     /**
      * Registers a receiver with `TimeTicker` to receive periodic ticks.
      *
-     * @param[in] aReceiver   A tick receiver identifier.
+     * If the receiver is already registered, its tick interval and phase are reset to use @p aTickInterval.
+     *
+     * @param[in] aReceiver       A tick receiver identifier.
+     * @param[in] aTickInterval   The tick interval (in msec) for the receiver.
      */
-    void RegisterReceiver(Receiver aReceiver);
+    void RegisterReceiver(Receiver aReceiver, uint32_t aTickInterval = kDefaultTickInterval);
 
     /**
      * Unregisters a receiver with `TimeTicker` to receive periodic ticks.
@@ -105,16 +117,18 @@ public:
     bool IsReceiverRegistered(Receiver aReceiver) const { return (mReceivers & Mask(aReceiver)) != 0; }
 
 private:
-    static constexpr uint32_t kTickInterval  = Time::kOneSecondInMsec;
     static constexpr uint32_t kRestartJitter = 4; // in msec, jitter added when restarting the timer [-4,+4] ms.
 
     constexpr static uint32_t Mask(Receiver aReceiver) { return static_cast<uint32_t>(1U) << aReceiver; }
 
     void HandleTimer(void);
+    void ScheduleNextTick(void);
 
     using TickerTimer = TimerMilliIn<TimeTicker, &TimeTicker::HandleTimer>;
 
     uint32_t    mReceivers;
+    uint32_t    mTickIntervals[kNumReceivers];
+    TimeMilli   mNextTickTimes[kNumReceivers];
     TickerTimer mTimer;
 
     static_assert(kNumReceivers < BitSizeOf(mReceivers), "Too many `Receiver`s - does not fit in a bit mask");
@@ -152,6 +152,334 @@ void TimerMilli::RemoveAll(Instance &aInstance) { aInstance.Get<Scheduler>().Rem
 //---------------------------------------------------------------------------------------------------------------------
 // `Timer::Scheduler`
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
+// The scheduler keeps timers in a hierarchical timing wheel. Level `L`
+// covers `kNumSlots^(L+1)` time units ahead of `mBaseTime`, split into
+// `kNumSlots` slots of `kNumSlots^L` units each, and the slot of a
+// timer is read directly from the corresponding `kSlotBits` bits of
+// its fire time. `mBaseTime` tracks the time up to which the wheel has
+// been advanced (slots behind it are always empty) and is moved
+// forward by `Advance()` on every `Add()` and `ProcessTimers()`, which
+// bounds all fire time deltas to the 32-bit range the levels tile.
+// Due timers are collected into `mDueList` and fired from there
+// (earliest first, one per `ProcessTimers()` invocation), preserving
+// the firing behavior of the sorted-list scheduler.
+
+uint8_t Timer::Scheduler::Insert(Timer &aTimer)
+{
+    uint8_t  level = 0;
+    uint32_t delta = 0;
+    uint32_t time  = mBaseTime.GetValue();
+
+    if (aTimer.mFireTime > mBaseTime)
+    {
+        delta = aTimer.mFireTime - mBaseTime;
+        time  = aTimer.mFireTime.GetValue();
+    }
+
+    // An already due timer (fire time at or before `mBaseTime`) is
+    // placed in the level zero slot of `mBaseTime` itself, which is
+    // the first slot drained by the next `Advance()`.
+
+    while ((level < kNumLevels - 1) && ((delta >> (kSlotBits * (level + 1))) != 0))
+    {
+        level++;
+    }
+
+    aTimer.mWheelLevel = level;
+    aTimer.mWheelSlot  = (time >> (kSlotBits * level)) & (kNumSlots - 1);
+
+    mSlots[level][aTimer.mWheelSlot].Push(aTimer);
+
+    return level;
+}
+
+void Timer::Scheduler::Advance(Time aNow)
+{
+    uint32_t elapsed = aNow - mBaseTime;
+    uint32_t base    = mBaseTime.GetValue();
+
+    mBaseTime = aNow;
+
+    for (uint8_t level = 0; level < kNumLevels; level++)
+    {
+        uint8_t  shift   = kSlotBits * level;
+        uint32_t crossed = ((base & ((1U << shift) - 1)) + elapsed) >> shift;
+        uint8_t  slot    = (base >> shift) & (kNumSlots - 1);
+
+        // `crossed` is the number of slot boundaries passed at this
+        // level while advancing from the old base time to `aNow`. No
+        // boundary passed at this level implies none at higher levels
+        // either.
+
+        if ((level != 0) && (crossed == 0))
+        {
+            break;
+        }
+
+        // Drain the passed slots along with the slot now containing
+        // `aNow`. Each drained timer either is due (moved to the due
+        // list), or belongs to a later lap of the wheel and is
+        // re-inserted relative to the new base time (landing in a
+        // lower level or a not yet drained slot).
+
+        for (uint32_t numSlots = Min<uint32_t>(crossed + 1, kNumSlots); numSlots > 0; numSlots--)
+        {
+            DoublyLinkedList<Timer> drained;
+            Timer                  *timer;
+
+            drained.TakeAllFrom(mSlots[level][slot]);
+
+            while ((timer = drained.Pop()) != nullptr)
+            {
+                if (timer->mFireTime <= aNow)
+                {
+                    timer->mWheelLevel = kLevelDueList;
+                    mDueList.Push(*timer);
+                }
+                else
+                {
+                    IgnoreReturnValue(Insert(*timer));
+                }
+            }
+
+            slot = (slot + 1) & (kNumSlots - 1);
+        }
+    }
+}
+
+Timer *Timer::Scheduler::PopEarliestDue(void)
+{
+    Timer *earliest = nullptr;
+
+    // All entries in the due list are within `kMaxDelay` of each
+    // other, so their fire times can be compared directly.
+
+    for (Timer &timer : mDueList)
+    {
+        if ((earliest == nullptr) || (timer.mFireTime < earliest->mFireTime))
+        {
+            earliest = &timer;
+        }
+    }
+
+    if (earliest != nullptr)
+    {
+        mDueList.Remove(*earliest);
+        earliest->SetNext(earliest);
+        mStats.mNumTimers--;
+    }
+
+    return earliest;
+}
+
+const Timer *Timer::Scheduler::FindEarliest(void) const
+{
+    const Timer *earliest = nullptr;
+
+    for (const Timer &timer : mDueList)
+    {
+        if ((earliest == nullptr) || (timer.mFireTime < earliest->mFireTime))
+        {
+            earliest = &timer;
+        }
+    }
+
+    VerifyOrExit(earliest == nullptr);
+
+    for (uint8_t level = 0; level < kNumLevels; level++)
+    {
+        uint8_t shift    = kSlotBits * level;
+        uint8_t baseSlot = (mBaseTime.GetValue() >> shift) & (kNumSlots - 1);
+
+        // Walking the slots forward from the base time slot visits
+        // them in increasing span order, so the first occupied slot
+        // holds the earliest timer of the level. At level zero the
+        // base time slot is visited first (it can only hold timers
+        // due at the base time itself), while at higher levels it is
+        // visited last (it can only hold timers nearly a full level
+        // span ahead). Levels cannot be compared by occupancy alone:
+        // a timer keeps the level assigned on insertion until its
+        // slot is drained, so as the base time advances it can come
+        // to fire before timers bucketed at lower levels. The
+        // per-level candidates are therefore compared explicitly.
+
+        for (uint8_t i = (level == 0) ? 0 : 1; i < ((level == 0) ? kNumSlots : (kNumSlots + 1)); i++)
+        {
+            const DoublyLinkedList<Timer> &list = mSlots[level][(baseSlot + i) & (kNumSlots - 1)];
+
+            if (list.IsEmpty())
+            {
+                continue;
+            }
+
+            for (const Timer &timer : list)
+            {
+                if ((earliest == nullptr) || timer.DoesFireBefore(*earliest, mBaseTime))
+                {
+                    earliest = &timer;
+                }
+            }
+
+            break;
+        }
+    }
+
+exit:
+    return earliest;
+}
+
+void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    uint8_t level;
+    Time    now(aAlarmApi.AlarmGetNow());
+
+    Remove(aTimer, aAlarmApi);
+
+    if (mStats.mNumTimers == 0)
+    {
+        mBaseTime = now;
+    }
+    else if (now > mBaseTime)
+    {
+        Advance(now);
+    }
+
+    level = Insert(aTimer);
+
+    mStats.mNumTimers++;
+    mStats.mMaxNumTimers = Max(mStats.mMaxNumTimers, mStats.mNumTimers);
+    mStats.mInsertLevelHistogram[level]++;
+
+    // `mAlarmTimer` always refers to a currently scheduled timer (it
+    // is re-determined whenever its timer is removed), so it is safe
+    // to compare against. `DoesFireBefore()` is used rather than a
+    // direct fire time comparison since an overdue alarm and a far
+    // future timer can be more than `kMaxDt` apart.
+
+    if ((mAlarmTimer == nullptr) || aTimer.DoesFireBefore(*mAlarmTimer, now))
+    {
+        mAlarmTimer = &aTimer;
+        mAlarmTime  = aTimer.mFireTime;
+        aAlarmApi.AlarmStartAt(&GetInstance(), now.GetValue(), aTimer.mFireTime.DetermineRemainingDurationFrom(now));
+    }
+}
+
+void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    VerifyOrExit(aTimer.IsRunning());
+
+    // A running timer is always present in the bucket recorded in its
+    // wheel position tags, so the removal is O(1).
+
+    if (aTimer.mWheelLevel == kLevelDueList)
+    {
+        mDueList.Remove(aTimer);
+    }
+    else
+    {
+        mSlots[aTimer.mWheelLevel][aTimer.mWheelSlot].Remove(aTimer);
+    }
+
+    aTimer.SetNext(&aTimer);
+    mStats.mNumTimers--;
+
+    // The alarm is tracked by timer identity (rather than fire time,
+    // which may have already been updated when re-adding a running
+    // timer) and is re-programmed when its timer is removed.
+
+    if (&aTimer == mAlarmTimer)
+    {
+        SetAlarm(aAlarmApi);
+    }
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
+{
+    const Timer *earliest = FindEarliest();
+
+    if (earliest == nullptr)
+    {
+        mAlarmTimer = nullptr;
+        aAlarmApi.AlarmStop(&GetInstance());
+    }
+    else
+    {
+        Time now(aAlarmApi.AlarmGetNow());
+
+        mAlarmTimer = earliest;
+        mAlarmTime  = earliest->mFireTime;
+        aAlarmApi.AlarmStartAt(&GetInstance(), now.GetValue(), earliest->mFireTime.DetermineRemainingDurationFrom(now));
+    }
+}
+
+void Timer::Scheduler::ProcessTimers(const AlarmApi &aAlarmApi)
+{
+    Timer *timer;
+    Time   now(aAlarmApi.AlarmGetNow());
+
+    // `Advance()` is called even when no time has elapsed since the
+    // base time: the base time slot at level zero can hold already
+    // due timers (a timer added with a fire time in the past is
+    // placed there) which only a drain of that slot collects.
+
+    Advance(now);
+
+    timer = PopEarliestDue();
+
+    // The alarm is re-programmed before firing the timer; if more
+    // timers are already due, it is set to expire immediately so that
+    // they are fired (earliest first) on subsequent callbacks.
+
+    SetAlarm(aAlarmApi);
+
+    VerifyOrExit(timer != nullptr);
+
+#if OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
+    {
+        Utils::Instrumentation::Scope scope(GetInstance(), Utils::Instrumentation::kSiteTimerHandler);
+
+        timer->Fired();
+    }
+#else
+    timer->Fired();
+#endif
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    Timer *timer;
+
+    for (uint8_t level = 0; level < kNumLevels; level++)
+    {
+        for (uint8_t slot = 0; slot < kNumSlots; slot++)
+        {
+            while ((timer = mSlots[level][slot].Pop()) != nullptr)
+            {
+                timer->SetNext(timer);
+            }
+        }
+    }
+
+    while ((timer = mDueList.Pop()) != nullptr)
+    {
+        timer->SetNext(timer);
+    }
+
+    mStats.mNumTimers = 0;
+    mAlarmTimer       = nullptr;
+    aAlarmApi.AlarmStop(&GetInstance());
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
 void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Timer *prev = nullptr;
@@ -191,7 +519,7 @@ void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
     }
     else
     {
-        IgnoreError(mTimerList.Remove(aTimer));
+        mTimerList.Remove(aTimer);
     }
 
     aTimer.SetNext(&aTimer);
@@ -228,7 +556,16 @@ void Timer::Scheduler::ProcessTimers(const AlarmApi &aAlarmApi)
         if (now >= timer->mFireTime)
         {
             Remove(*timer, aAlarmApi); // `Remove()` will `SetAlarm` for next timer if there is any.
+
+#if OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
+            {
+                Utils::Instrumentation::Scope scope(GetInstance(), Utils::Instrumentation::kSiteTimerHandler);
+
+                timer->Fired();
+            }
+#else
             timer->Fired();
+#endif
             ExitNow();
         }
     }
@@ -251,6 +588,8 @@ void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
     SetAlarm(aAlarmApi);
 }
 
+#endif // OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance)
 {
     VerifyOrExit(otInstanceIsInitialized(aInstance));
@@ -43,7 +43,7 @@
 #include <openthread/platform/alarm-milli.h>
 
 #include "common/debug.hpp"
-#include "common/linked_list.hpp"
+#include "common/doubly_linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/tasklet.hpp"
@@ -177,9 +177,9 @@ private:
 /**
  * Implements a timer.
  */
-class Timer : public InstanceLocator, public LinkedListEntry<Timer>
+class Timer : public InstanceLocator, public DoublyLinkedListEntry<Timer>
 {
-    friend class LinkedListEntry<Timer>;
+    friend class DoublyLinkedListEntry<Timer>;
 
 public:
     /**
@@ -222,8 +222,32 @@ protected:
             uint32_t (*AlarmGetNow)(void);
         };
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        static constexpr uint8_t kSlotBits  = 4;                ///< Number of fire time bits consumed per level.
+        static constexpr uint8_t kNumSlots  = (1 << kSlotBits); ///< Number of slots per wheel level.
+        static constexpr uint8_t kNumLevels = 32 / kSlotBits;   ///< Number of levels (tiling the 32-bit time range).
+
+        static constexpr uint8_t kLevelDueList = kNumLevels; ///< `mWheelLevel` marker for timers in the due list.
+
+        /**
+         * Represents timer scheduler statistics (for timing wheel verification).
+         */
+        struct Stats
+        {
+            uint16_t mNumTimers;                        ///< Number of currently scheduled timers.
+            uint16_t mMaxNumTimers;                     ///< Max number of simultaneously scheduled timers seen.
+            uint32_t mInsertLevelHistogram[kNumLevels]; ///< Number of timer insertions into each wheel level.
+        };
+#endif
+
         explicit Scheduler(Instance &aInstance)
             : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+            , mBaseTime(0)
+            , mAlarmTime(0)
+            , mAlarmTimer(nullptr)
+            , mStats()
+#endif
         {
         }
 
@@ -233,13 +257,36 @@ protected:
         void ProcessTimers(const AlarmApi &aAlarmApi);
         void SetAlarm(const AlarmApi &aAlarmApi);
 
-        LinkedList<Timer> mTimerList;
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        /**
+         * Gets the scheduler statistics.
+         *
+         * @returns The scheduler statistics.
+         */
+        const Stats &GetStats(void) const { return mStats; }
+
+    private:
+        void         Advance(Time aNow);
+        uint8_t      Insert(Timer &aTimer);
+        Timer       *PopEarliestDue(void);
+        const Timer *FindEarliest(void) const;
+
+        DoublyLinkedList<Timer> mSlots[kNumLevels][kNumSlots];
+        DoublyLinkedList<Timer> mDueList;
+        Time                    mBaseTime;
+        Time                    mAlarmTime;
+        const Timer            *mAlarmTimer; // The timer the alarm is programmed for (`nullptr` if alarm is not set).
+        Stats                   mStats;
+#else
+        DoublyLinkedList<Timer> mTimerList;
+#endif
     };
 
     Timer(Instance &aInstance, Handler aHandler)
         : InstanceLocator(aInstance)
         , mHandler(aHandler)
         , mNext(this)
+        , mPrev(this)
     {
     }
 
@@ -249,6 +296,14 @@ protected:
     Handler mHandler;
     Time    mFireTime;
     Timer  *mNext;
+    Timer  *mPrev;
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+    // Wheel position of a scheduled timer, maintained by the scheduler
+    // (`mFireTime` cannot be used to locate the bucket on removal,
+    // since `FireAt()` updates it before re-adding a running timer).
+    uint8_t mWheelLevel;
+    uint8_t mWheelSlot;
+#endif
 };
 
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance);
@@ -278,6 +333,10 @@ public:
         {
         }
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        using Timer::Scheduler::GetStats;
+#endif
+
     private:
         void Add(TimerMilli &aTimer) { Timer::Scheduler::Add(aTimer, sAlarmMilliApi); }
         void Remove(TimerMilli &aTimer) { Timer::Scheduler::Remove(aTimer, sAlarmMilliApi); }
@@ -450,6 +509,10 @@ public:
         {
         }
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        using Timer::Scheduler::GetStats;
+#endif
+
     private:
         void Add(TimerMicro &aTimer) { Timer::Scheduler::Add(aTimer, sAlarmMicroApi); }
         void Remove(TimerMicro &aTimer) { Timer::Scheduler::Remove(aTimer, sAlarmMicroApi); }
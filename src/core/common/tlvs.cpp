@@ -200,6 +200,97 @@ template Error Tlv::Info::ReadUintValue<uint8_t>(const Message &aMessage, uint8_
 template Error Tlv::Info::ReadUintValue<uint16_t>(const Message &aMessage, uint16_t &aValue) const;
 template Error Tlv::Info::ReadUintValue<uint32_t>(const Message &aMessage, uint32_t &aValue) const;
 
+void Tlv::Index::BuildFrom(const Message &aMessage)
+{
+    OffsetRange offsetRange;
+    Info        info;
+
+    mMessage    = &aMessage;
+    mNumEntries = 0;
+    mHasMore    = false;
+
+    offsetRange.InitFromMessageOffsetToEnd(aMessage);
+
+    while (info.ParseFrom(aMessage, offsetRange) == kErrorNone)
+    {
+        if (mNumEntries == kCapacity)
+        {
+            mHasMore = true;
+            break;
+        }
+
+        mEntries[mNumEntries].mOffset = info.GetTlvOffset();
+        mEntries[mNumEntries].mType   = info.GetType();
+        mNumEntries++;
+
+        offsetRange.AdvanceOffset(info.GetSize());
+    }
+}
+
+Error Tlv::Index::Find(uint8_t aType, Info &aInfo) const
+{
+    Error error = kErrorNotFound;
+
+    for (uint16_t index = 0; index < mNumEntries; index++)
+    {
+        if (mEntries[index].mType == aType)
+        {
+            error = aInfo.ParseFrom(*mMessage, mEntries[index].mOffset);
+            ExitNow();
+        }
+    }
+
+    if (mHasMore)
+    {
+        // The message contains more TLVs than the index capacity, so a
+        // miss in the table is not conclusive. Fall back to scanning
+        // the message directly.
+
+        error = aInfo.FindIn(*mMessage, aType);
+    }
+
+exit:
+    return error;
+}
+
+Error Tlv::Index::FindTlv(uint8_t aType, uint16_t aMaxSize, Tlv &aTlv) const
+{
+    Error error;
+    Info  info;
+
+    SuccessOrExit(error = Find(aType, info));
+
+    info.mTlvOffsetRange.ShrinkLength(aMaxSize);
+    mMessage->ReadBytes(info.mTlvOffsetRange, &aTlv);
+
+exit:
+    return error;
+}
+
+Error Tlv::Index::FindTlvValueOffsetRange(uint8_t aType, OffsetRange &aOffsetRange) const
+{
+    Error error;
+    Info  info;
+
+    SuccessOrExit(error = Find(aType, info));
+    aOffsetRange = info.GetValueOffsetRange();
+
+exit:
+    return error;
+}
+
+Error Tlv::Index::FindTlv(uint8_t aType, void *aValue, uint16_t aLength) const
+{
+    Error       error;
+    OffsetRange offsetRange;
+
+    SuccessOrExit(error = FindTlvValueOffsetRange(aType, offsetRange));
+    error = mMessage->Read(offsetRange, aValue, aLength);
+
+exit:
+    return error;
+}
+
 Error Tlv::FindStringTlv(const Message &aMessage, uint8_t aType, uint8_t aMaxStringLength, char *aValue)
 {
     Error error;
@@ -377,6 +468,59 @@ exit:
     return error;
 }
 
+Error TlvBatchWriter::AppendTlv(uint8_t aType, const void *aValue, uint16_t aLength)
+{
+    Error    error = kErrorNone;
+    uint16_t headerSize;
+
+    if (aLength > Tlv::kBaseTlvMaxLength)
+    {
+        ExtendedTlv extTlv;
+
+        headerSize = sizeof(ExtendedTlv);
+        VerifyOrExit(static_cast<uint32_t>(headerSize) + aLength <= static_cast<uint32_t>(mSize - mLength),
+                     error = kErrorNoBufs);
+
+        extTlv.SetType(aType);
+        extTlv.SetLength(aLength);
+        memcpy(&mBuffer[mLength], &extTlv, sizeof(extTlv));
+    }
+    else
+    {
+        Tlv tlv;
+
+        headerSize = sizeof(Tlv);
+        VerifyOrExit(static_cast<uint32_t>(headerSize) + aLength <= static_cast<uint32_t>(mSize - mLength),
+                     error = kErrorNoBufs);
+
+        tlv.SetType(aType);
+        tlv.SetLength(static_cast<uint8_t>(aLength));
+        memcpy(&mBuffer[mLength], &tlv, sizeof(tlv));
+    }
+
+    mLength += headerSize;
+
+    if (aLength > 0)
+    {
+        memcpy(&mBuffer[mLength], aValue, aLength);
+        mLength += aLength;
+    }
+
+exit:
+    return error;
+}
+
+Error TlvBatchWriter::CommitTo(Message &aMessage)
+{
+    Error error;
+
+    SuccessOrExit(error = aMessage.AppendBytes(mBuffer, mLength));
+    mLength = 0;
+
+exit:
+    return error;
+}
+
 const Tlv *Tlv::FindTlv(const void *aTlvsStart, uint16_t aTlvsLength, uint8_t aType)
 {
     const Tlv *tlv;
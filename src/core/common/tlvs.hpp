@@ -229,6 +229,8 @@ public:
     //------------------------------------------------------------------------------------------------------------------
     // Static methods for reading/finding/appending TLVs in a `Message`.
 
+    class Index;
+
     /**
      * Represents metdata information about a TLV within a message.
      *
@@ -238,6 +240,7 @@ public:
     class Info
     {
         friend class Tlv;
+        friend class Index;
 
     public:
         /**
@@ -439,6 +442,149 @@ public:
         OffsetRange mValueOffsetRange;
     };
 
+    /**
+     * Represents a one-pass parse index of the TLVs contained in a message.
+     *
+     * An `Index` is built in a single walk over the TLVs in a message (starting from `aMessage.GetOffset()`) and
+     * records the type and offset of each TLV in a small scratch table. Subsequent `Find()` calls are answered from
+     * the table, avoiding repeated re-scans of the message buffer chain when multiple TLVs are read from the same
+     * message (e.g., while processing an MLE Parent Response). If the message contains more TLVs than the table
+     * capacity, lookups for types beyond the capacity transparently fall back to scanning the message.
+     *
+     * The index refers to the message it was built from and remains valid only as long as the message content and
+     * offset are unchanged.
+     */
+    class Index
+    {
+    public:
+        /**
+         * Initializes the `Index`, building it from a given message.
+         *
+         * @param[in] aMessage   The message to build the index from.
+         */
+        explicit Index(const Message &aMessage) { BuildFrom(aMessage); }
+
+        /**
+         * Rebuilds the index from a given message.
+         *
+         * @param[in] aMessage   The message to build the index from.
+         */
+        void BuildFrom(const Message &aMessage);
+
+        /**
+         * Finds a TLV of a given type, populating a given `Info` object.
+         *
+         * Similar to `Info::FindIn()`, but answered from the index table when possible.
+         *
+         * @param[in]  aType   The TLV type to find.
+         * @param[out] aInfo   A reference to an `Info` object to populate.
+         *
+         * @retval kErrorNone      Successfully found and parsed the TLV, and populated the `Info` object.
+         * @retval kErrorNotFound  No valid TLV of the given type was found.
+         */
+        Error Find(uint8_t aType, Info &aInfo) const;
+
+        /**
+         * Finds a TLV of a given type and reads it into a given `Tlv`.
+         *
+         * Similar to the static `Tlv::FindTlv()`, but answered from the index table when possible.
+         *
+         * @param[in]   aType      The TLV type to find.
+         * @param[in]   aMaxSize   Maximum number of bytes to read.
+         * @param[out]  aTlv       A reference to the TLV that will be copied to.
+         *
+         * @retval kErrorNone       Successfully copied the TLV.
+         * @retval kErrorNotFound   Could not find the TLV with Type @p aType.
+         */
+        Error FindTlv(uint8_t aType, uint16_t aMaxSize, Tlv &aTlv) const;
+
+        /**
+         * Finds the offset range of the value of a TLV of a given type.
+         *
+         * Similar to the static `Tlv::FindTlvValueOffsetRange()`, but answered from the index table when possible.
+         *
+         * @param[in]   aType          The TLV type to find.
+         * @param[out]  aOffsetRange   A reference to return the offset range of the TLV value.
+         *
+         * @retval kErrorNone       Successfully found the TLV.
+         * @retval kErrorNotFound   Could not find the TLV with Type @p aType.
+         */
+        Error FindTlvValueOffsetRange(uint8_t aType, OffsetRange &aOffsetRange) const;
+
+        /**
+         * Finds a TLV of a given type and reads its value into a given buffer.
+         *
+         * Similar to the static `Tlv::FindTlv(aMessage, aType, aValue, aLength)`, but answered from the index table
+         * when possible.
+         *
+         * @param[in]    aType       The TLV type to find.
+         * @param[out]   aValue      A buffer to output the value (must contain at least @p aLength bytes).
+         * @param[in]    aLength     The expected (minimum) length of the TLV value.
+         *
+         * @retval kErrorNone       The TLV was found and read successfully. @p aValue is updated.
+         * @retval kErrorNotFound   Could not find the TLV with Type @p aType.
+         * @retval kErrorParse      TLV was found but it was not well-formed and could not be parsed.
+         */
+        Error FindTlv(uint8_t aType, void *aValue, uint16_t aLength) const;
+
+        /**
+         * Finds a simple TLV with a single non-integral value and reads its value.
+         *
+         * Similar to the static `Tlv::Find<SimpleTlvType>()`, but answered from the index table when possible.
+         *
+         * @tparam       SimpleTlvType   The simple TLV type to find (must be a sub-class of `SimpleTlvInfo`).
+         *
+         * @param[out]   aValue          A reference to the value object to output the read value.
+         *
+         * @retval kErrorNone         The TLV was found and read successfully. @p aValue is updated.
+         * @retval kErrorNotFound     Could not find the TLV with Type @p aType.
+         * @retval kErrorParse        TLV was found but it was not well-formed and could not be parsed.
+         */
+        template <typename SimpleTlvType> Error Find(typename SimpleTlvType::ValueType &aValue) const
+        {
+            return FindTlv(SimpleTlvType::kType, &aValue, sizeof(aValue));
+        }
+
+        /**
+         * Finds a simple TLV with a single integral value and reads its value.
+         *
+         * Similar to the static `Tlv::Find<UintTlvType>()`, but answered from the index table when possible.
+         *
+         * @tparam       UintTlvType     The simple TLV type to find (must be a sub-class of `UintTlvInfo`).
+         *
+         * @param[out]   aValue          A reference to an unsigned int value to output the TLV's value.
+         *
+         * @retval kErrorNone         The TLV was found and read successfully. @p aValue is updated.
+         * @retval kErrorNotFound     Could not find the TLV with Type @p aType.
+         * @retval kErrorParse        TLV was found but it was not well-formed and could not be parsed.
+         */
+        template <typename UintTlvType> Error Find(typename UintTlvType::UintValueType &aValue) const
+        {
+            Error error;
+            Info  info;
+
+            SuccessOrExit(error = Find(UintTlvType::kType, info));
+            error = info.template Read<UintTlvType>(*mMessage, aValue);
+
+        exit:
+            return error;
+        }
+
+    private:
+        static constexpr uint16_t kCapacity = 16;
+
+        struct Entry
+        {
+            uint16_t mOffset;
+            uint8_t  mType;
+        };
+
+        const Message *mMessage;
+        uint16_t       mNumEntries;
+        bool           mHasMore; // Whether the message has more TLVs beyond the indexed ones.
+        Entry          mEntries[kCapacity];
+    };
+
     /**
      * Searches for and reads a requested TLV out of a given message.
      *
@@ -924,6 +1070,147 @@ private:
     uint16_t mLength;
 } OT_TOOL_PACKED_END;
 
+/**
+ * Acts as a writer staging a sequence of TLVs in a scratch buffer.
+ *
+ * A `TlvBatchWriter` encodes a full TLV sequence in a caller-provided buffer and commits it to a `Message` with a
+ * single `AppendBytes()` call, instead of one `Message` append per TLV or field (each of which traverses the message
+ * buffer chain). The `TlvBatch<kCapacity>` sub-class provides a variant with its own compile-time sized buffer,
+ * suited for fixed-layout TLV sequences whose total size is known at compile time.
+ */
+class TlvBatchWriter
+{
+public:
+    /**
+     * Initializes the `TlvBatchWriter` to stage TLVs in a given buffer.
+     *
+     * @param[in] aBuffer  A pointer to the scratch buffer to stage the TLVs in.
+     * @param[in] aSize    The size (number of bytes) of @p aBuffer.
+     */
+    TlvBatchWriter(uint8_t *aBuffer, uint16_t aSize)
+        : mBuffer(aBuffer)
+        , mSize(aSize)
+        , mLength(0)
+    {
+    }
+
+    /**
+     * Returns the number of bytes staged so far.
+     *
+     * @returns The number of staged bytes.
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    /**
+     * Stages a TLV with a given type and value.
+     *
+     * An Extended TLV header is used when @p aLength requires it.
+     *
+     * @param[in] aType    The TLV type.
+     * @param[in] aValue   A pointer to the TLV value (can be `nullptr` when @p aLength is zero).
+     * @param[in] aLength  The TLV value length (number of bytes).
+     *
+     * @retval kErrorNone    Successfully staged the TLV.
+     * @retval kErrorNoBufs  Insufficient room remaining in the scratch buffer.
+     */
+    Error AppendTlv(uint8_t aType, const void *aValue, uint16_t aLength);
+
+    /**
+     * Stages a TLV with a given type and value.
+     *
+     * @tparam     TlvType  The TLV type to stage.
+     *
+     * @param[in]  aValue   A pointer to the TLV value.
+     * @param[in]  aLength  The TLV value length (number of bytes).
+     *
+     * @retval kErrorNone    Successfully staged the TLV.
+     * @retval kErrorNoBufs  Insufficient room remaining in the scratch buffer.
+     */
+    template <typename TlvType> Error Append(const void *aValue, uint16_t aLength)
+    {
+        return AppendTlv(TlvType::kType, aValue, aLength);
+    }
+
+    /**
+     * Stages a simple TLV with a single (non-integral) value.
+     *
+     * @tparam     SimpleTlvType  The simple TLV type to stage (must be a sub-class of `SimpleTlvInfo`).
+     *
+     * @param[in]  aValue         A reference to the TLV value.
+     *
+     * @retval kErrorNone    Successfully staged the TLV.
+     * @retval kErrorNoBufs  Insufficient room remaining in the scratch buffer.
+     */
+    template <typename SimpleTlvType> Error Append(const typename SimpleTlvType::ValueType &aValue)
+    {
+        return AppendTlv(SimpleTlvType::kType, &aValue, sizeof(aValue));
+    }
+
+    /**
+     * Stages a simple TLV with a single integral value.
+     *
+     * @tparam     UintTlvType  The simple TLV type to stage (must be a sub-class of `UintTlvInfo`).
+     *
+     * @param[in]  aValue       The TLV value (will be encoded in big endian).
+     *
+     * @retval kErrorNone    Successfully staged the TLV.
+     * @retval kErrorNoBufs  Insufficient room remaining in the scratch buffer.
+     */
+    template <typename UintTlvType> Error Append(typename UintTlvType::UintValueType aValue)
+    {
+        typename UintTlvType::UintValueType value = BigEndian::HostSwap(aValue);
+
+        return AppendTlv(UintTlvType::kType, &value, sizeof(value));
+    }
+
+    /**
+     * Stages an empty TLV (no value) with a given type.
+     *
+     * @tparam TlvType  The TLV type to stage.
+     *
+     * @retval kErrorNone    Successfully staged the TLV.
+     * @retval kErrorNoBufs  Insufficient room remaining in the scratch buffer.
+     */
+    template <typename TlvType> Error AppendEmpty(void) { return AppendTlv(TlvType::kType, nullptr, 0); }
+
+    /**
+     * Commits the staged TLV sequence to a message with a single append.
+     *
+     * On success, the writer is reset (staged length becomes zero) and can be reused.
+     *
+     * @param[in] aMessage   The message to append the staged TLVs to.
+     *
+     * @retval kErrorNone    Successfully appended the staged TLVs to @p aMessage.
+     * @retval kErrorNoBufs  Insufficient available buffers to grow the message.
+     */
+    Error CommitTo(Message &aMessage);
+
+private:
+    uint8_t *mBuffer;
+    uint16_t mSize;
+    uint16_t mLength;
+};
+
+/**
+ * Represents a `TlvBatchWriter` with its own compile-time sized scratch buffer.
+ *
+ * @tparam kCapacity  The size (number of bytes) of the scratch buffer.
+ */
+template <uint16_t kCapacity> class TlvBatch : public TlvBatchWriter
+{
+public:
+    /**
+     * Initializes the `TlvBatch` as empty.
+     */
+    TlvBatch(void)
+        : TlvBatchWriter(mStorage, kCapacity)
+    {
+    }
+
+private:
+    uint8_t mStorage[kCapacity];
+};
+
 /**
  * Casts a `Tlv` pointer to a given subclass `TlvType` pointer.
  *
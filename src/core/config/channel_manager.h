@@ -77,6 +77,22 @@
 #define OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_DELAY 120
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_FAST_MIGRATION_DELAY
+ *
+ * The delay (in seconds) used by Channel Manager module for a fast channel migration (@sa
+ * `RequestFastNetworkChannelChange()`).
+ *
+ * Unlike `OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_DELAY`, this delay is intentionally short so that the network can
+ * escape a jammed channel within seconds. Sleepy end devices polling less frequently than this delay may miss the
+ * pending dataset and need to re-attach after the change.
+ *
+ * Applicable only if Channel Manager feature is enabled (i.e., `OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE` is set).
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_FAST_MIGRATION_DELAY
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_FAST_MIGRATION_DELAY 10
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_MONITOR_SAMPLE_COUNT
  *
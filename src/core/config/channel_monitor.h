@@ -110,6 +110,39 @@
 #define OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_WINDOW 960
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_SLICED_SCAN_ENABLE
+ *
+ * Define to 1 to scan a single channel per scan slice instead of a group of channels.
+ *
+ * By default, Channel Monitor divides the sample interval into a small number of scan slices, each scanning a group
+ * of channels back-to-back. When this option is enabled, each slice scans a single channel, spreading the per-channel
+ * RSSI samples evenly across the sample interval. A slice is also briefly deferred (up to a bounded number of times)
+ * while the MAC is in the middle of a transmission, moving the scans into radio idle gaps and reducing the impact of
+ * channel monitoring on data throughput.
+ *
+ * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE` is set).
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_SLICED_SCAN_ENABLE
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_SLICED_SCAN_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM_ENABLE
+ *
+ * Define to 1 to accumulate a per-channel RSSI histogram from the channel monitoring samples.
+ *
+ * In addition to the channel occupancy average, each RSSI sample is then also counted into one of a small number of
+ * coarse RSSI bins per channel, providing the distribution of observed signal levels (e.g., to distinguish a channel
+ * with constant mid-level noise from one with occasional strong interference). This costs extra RAM proportional to
+ * the number of channels times the number of bins.
+ *
+ * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE` is set).
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM_ENABLE
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM_ENABLE 0
+#endif
+
 /**
  * @}
  */
@@ -90,6 +90,22 @@
 #define OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH 1024
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW
+ *
+ * Specifies the maximum number of concurrently outstanding block requests in a CoAP Block2 (block-wise download)
+ * transfer.
+ *
+ * The default value of 1 preserves the RFC 7959 stop-and-wait behavior (one block in flight per exchange). Values
+ * larger than 1 enable speculative pipelining of next-block requests sharing the transfer token, reducing transfer
+ * time over multi-hop paths roughly by the window factor. The window adapts to congestion, collapsing back to two
+ * whenever a block request needs to be retransmitted. Requires a server that handles concurrent block requests
+ * statelessly (as the OpenThread block-wise server does).
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW
+#define OPENTHREAD_CONFIG_COAP_BLOCKWISE_PIPELINE_WINDOW 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
  *
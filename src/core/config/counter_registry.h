@@ -0,0 +1,75 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes compile-time configurations for the counter registry module.
+ */
+
+#ifndef OT_CORE_CONFIG_COUNTER_REGISTRY_H_
+#define OT_CORE_CONFIG_COUNTER_REGISTRY_H_
+
+/**
+ * @addtogroup config-counter-registry
+ *
+ * @brief
+ *   This module includes configuration variables for the counter registry.
+ *
+ * @{
+ */
+
+/**
+ * @def OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+ *
+ * Define to 1 to enable the counter registry.
+ *
+ * When enabled, `otCountersGetSnapshot()` captures all counter groups (MAC, IP, MLE) with a single uptime
+ * stamp, so telemetry can diff mutually consistent totals instead of reading each group separately.
+ */
+#ifndef OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+#define OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE
+ *
+ * Define to 1 to enable on-device windowed counter rates.
+ *
+ * When enabled, the counter registry maintains per-minute exponentially weighted moving average rates of
+ * key MAC counters (retrievable through `otCountersGetRates()`). Requires
+ * `OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE`.
+ */
+#ifndef OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE
+#define OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+#endif
+
+/**
+ * @}
+ */
+
+#endif // OT_CORE_CONFIG_COUNTER_REGISTRY_H_
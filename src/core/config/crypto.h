@@ -68,6 +68,20 @@
 #define OPENTHREAD_CONFIG_CRYPTO_PLATFORM_ALLOCS_CONTEXT 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CRYPTO_RANDOM_POOL_SIZE
+ *
+ * Specifies the size (in bytes) of the cached pool of cryptographically secure random bytes (0 disables the pool).
+ *
+ * When non-zero, `Random::Crypto` requests smaller than the pool are served from a pool refilled from the platform
+ * DRBG (`otPlatCryptoRandomGet()`) one pool at a time, replacing a DRBG invocation (with its per-call reseed checks)
+ * per request with one per pool refill. Served bytes are wiped from the pool and larger requests bypass it. Counters
+ * of requests and platform DRBG invocations are kept so the reduction can be measured.
+ */
+#ifndef OPENTHREAD_CONFIG_CRYPTO_RANDOM_POOL_SIZE
+#define OPENTHREAD_CONFIG_CRYPTO_RANDOM_POOL_SIZE 0
+#endif
+
 #if OPENTHREAD_CONFIG_CRYPTO_LIB == OPENTHREAD_CONFIG_CRYPTO_LIB_PLATFORM
 
 /**
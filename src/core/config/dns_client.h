@@ -93,6 +93,34 @@
 #define OPENTHREAD_CONFIG_DNS_CLIENT_ARBITRARY_RECORD_QUERY_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+ *
+ * Define to 1 to enable DNS client query coalescing.
+ *
+ * When enabled, a new address or browse query whose question matches an in-flight query (same name, type, and
+ * server) delays its own transmission and is answered from the in-flight query's response when it arrives. This
+ * avoids duplicate traffic when multiple modules resolve the same name concurrently (e.g., several services
+ * reconnecting after a link flap). If the in-flight query fails or its response never arrives, the delayed query
+ * is transmitted on its own after the response timeout, so behavior degrades to independent queries.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES
+ *
+ * Specifies the maximum number of cached DNS responses. Zero disables the response cache.
+ *
+ * When non-zero, successful address query responses are cached (respecting the minimum TTL of the answer
+ * records) and a new query matching a fresh cached response is answered from the cache without any transmission.
+ * Cached responses are cloned messages and therefore use buffers from the message pool.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
  *
@@ -70,6 +70,21 @@
 #define OPENTHREAD_CONFIG_DNS_DSO_RESPONSE_TIMEOUT (30 * 1000)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_DSO_KEEP_ALIVE_BATCH_WINDOW
+ *
+ * Specifies the window (in msec) used to batch Keep Alive transmissions across DSO sessions.
+ *
+ * On a timer wakeup, a client also sends the Keep Alive message of any session whose deadline falls within this
+ * window, instead of scheduling another wakeup shortly after. Sessions naturally align to a shared Keep Alive
+ * schedule, so idle maintenance with many sessions wakes the CPU once per interval rather than once per session.
+ * Keep Alive messages are only ever sent early (never late), which is always permitted. Use zero to disable
+ * batching and wake at each session's exact deadline.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_DSO_KEEP_ALIVE_BATCH_WINDOW
+#define OPENTHREAD_CONFIG_DNS_DSO_KEEP_ALIVE_BATCH_WINDOW (1 * 1000)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DNS_DSO_MAX_PENDING_REQUESTS
  *
@@ -126,6 +126,29 @@
 #define OPENTHREAD_CONFIG_HISTORY_TRACKER_TX_LIST_SIZE 32
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_BUFFER_PRESSURE_LIST_SIZE
+ *
+ * Specifies the maximum number of entries in message buffer pressure history list.
+ *
+ * Can be set to zero to configure History Tracker module not to collect any buffer pressure history.
+ */
+#ifndef OPENTHREAD_CONFIG_HISTORY_TRACKER_BUFFER_PRESSURE_LIST_SIZE
+#define OPENTHREAD_CONFIG_HISTORY_TRACKER_BUFFER_PRESSURE_LIST_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_BUFFER_PRESSURE_BUCKET_INTERVAL
+ *
+ * Specifies the time bucket interval (in milliseconds) for recording message buffer pressure events.
+ *
+ * At most one buffer pressure event is recorded per interval, so that sustained buffer exhaustion does not flush the
+ * history list.
+ */
+#ifndef OPENTHREAD_CONFIG_HISTORY_TRACKER_BUFFER_PRESSURE_BUCKET_INTERVAL
+#define OPENTHREAD_CONFIG_HISTORY_TRACKER_BUFFER_PRESSURE_BUCKET_INTERVAL 10000
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_EXCLUDE_THREAD_CONTROL_MESSAGES
  *
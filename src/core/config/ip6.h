@@ -90,6 +90,20 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_IP6_CHECKSUM_OFFLOAD_BY_HOST_ENABLE
+ *
+ * Define as 1 to skip software checksum verification of UDP/ICMPv6/TCP datagrams originating from the trusted host.
+ *
+ * This can be enabled on platforms (e.g., a Linux-based Border Router) where the host networking stack already
+ * computes or verifies the transport-layer checksum of any datagram it hands to OpenThread, saving a full message
+ * traversal per received datagram. It MUST NOT be enabled when the host can pass through datagrams with unverified
+ * checksums.
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_CHECKSUM_OFFLOAD_BY_HOST_ENABLE
+#define OPENTHREAD_CONFIG_IP6_CHECKSUM_OFFLOAD_BY_HOST_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_IP6_HOP_LIMIT_DEFAULT
  *
@@ -168,6 +182,43 @@
 #define OPENTHREAD_CONFIG_IP6_SLAAC_DEPRECATION_INTERVAL 300
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_IP6_SLAAC_REGISTRATION_STAGGER_INTERVAL
+ *
+ * Specifies the stagger interval (in milliseconds) between netif registrations of newly generated SLAAC addresses.
+ *
+ * Applicable only if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE is enabled.
+ *
+ * When multiple on-mesh prefixes change together (e.g., during a Border Router failover), the generated SLAAC
+ * addresses are registered with the netif this interval apart, spreading out the address registration signaling
+ * (MLE Child Update, DUA registration) each addition triggers. The first address of a burst is always registered
+ * immediately. Set to zero to disable staggering and register all addresses immediately.
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_SLAAC_REGISTRATION_STAGGER_INTERVAL
+#define OPENTHREAD_CONFIG_IP6_SLAAC_REGISTRATION_STAGGER_INTERVAL 50
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ICMP6_ERROR_RATE_LIMIT_PER_SECOND
+ *
+ * Specifies the token-bucket refill rate (tokens per second) used to rate limit transmission of ICMPv6 error
+ * messages. A separate bucket is maintained per error type, so a storm of one error type (e.g., "Destination
+ * Unreachable" during a routing flap) cannot starve the others. Zero (the default) disables the rate limiting.
+ */
+#ifndef OPENTHREAD_CONFIG_ICMP6_ERROR_RATE_LIMIT_PER_SECOND
+#define OPENTHREAD_CONFIG_ICMP6_ERROR_RATE_LIMIT_PER_SECOND 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ICMP6_ERROR_RATE_LIMIT_BURST
+ *
+ * Specifies the token-bucket capacity (maximum burst size) for ICMPv6 error rate limiting. Used only when
+ * `OPENTHREAD_CONFIG_ICMP6_ERROR_RATE_LIMIT_PER_SECOND` is non-zero.
+ */
+#ifndef OPENTHREAD_CONFIG_ICMP6_ERROR_RATE_LIMIT_BURST
+#define OPENTHREAD_CONFIG_ICMP6_ERROR_RATE_LIMIT_BURST 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES
  *
@@ -207,6 +258,32 @@
 #define OPENTHREAD_CONFIG_TCP_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+ *
+ * Define as 1 to enable the TCP zero-copy receive mode.
+ *
+ * In this mode, an endpoint initialized with `mReceiveZeroCopy` set retains in-order received segments in their
+ * original message buffers instead of copying their payloads into the receive buffer, and the application reads
+ * them in place using `otTcpReceiveChunksByReference()`.
+ */
+#ifndef OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+#define OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TCP_MAX_SEGMENTS_PER_BURST
+ *
+ * The maximum number of TCP segments transmitted back-to-back by one invocation of the TCP output routine, or zero
+ * for no limit.
+ *
+ * Bounding the burst size paces outgoing segments across link wakeups (e.g., CSL intervals): the remainder of the
+ * send window is transmitted as acknowledgments arrive rather than as a single burst.
+ */
+#ifndef OPENTHREAD_CONFIG_TCP_MAX_SEGMENTS_PER_BURST
+#define OPENTHREAD_CONFIG_TCP_MAX_SEGMENTS_PER_BURST 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TLS_ENABLE
  *
@@ -234,6 +311,26 @@
 #define OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE
+ *
+ * Define as 1 to enable per-prefix IPv6 Border Routing counters.
+ *
+ * Requires `OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE`.
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE
+#define OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_TABLE_SIZE
+ *
+ * Specifies the maximum number of prefixes tracked by the per-prefix Border Routing counters.
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_TABLE_SIZE
+#define OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_TABLE_SIZE 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_IP6_RESTRICT_FORWARDING_LARGER_SCOPE_MCAST_WITH_LOCAL_SRC
  *
@@ -61,6 +61,17 @@
 #define OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_ON_BY_DEFAULT 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_MAX_CONFIGS_PER_BATCH
+ *
+ * Specifies the maximum number of subjects for which an Enhanced-ACK Probing configuration exchange is started per
+ * update batch. Remaining subjects are configured in subsequent staggered batches, avoiding a burst of unicast link
+ * metrics exchanges on devices with many neighbors (e.g., after a reset).
+ */
+#ifndef OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_MAX_CONFIGS_PER_BATCH
+#define OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_MAX_CONFIGS_PER_BATCH 4
+#endif
+
 /**
  * @}
  */
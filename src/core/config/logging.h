@@ -55,6 +55,7 @@
  * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_DEBUG_UART
  * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_APP
  * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
+ * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
  * - and others
  *
  * Note:
@@ -76,6 +77,8 @@
 #define OPENTHREAD_CONFIG_LOG_OUTPUT_APP 2
 /** Log output is handled by a platform defined function */
 #define OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED 3
+/** Log output goes to `otPlatLogBinary()` as a binary structured record (rendered off-device) */
+#define OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY 4
 
 /**
  * @def OPENTHREAD_CONFIG_LOG_INSTANCE_AWARE_API_ENABLE
@@ -90,6 +90,46 @@
 #define OPENTHREAD_CONFIG_MAC_DEFAULT_MAX_FRAME_RETRIES_INDIRECT 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_CSL_OFFLOAD
+ *
+ * The maximum number of retries allowed after a transmission failure for CSL transmissions when the radio provides
+ * both `OT_RADIO_CAPS_TRANSMIT_RETRIES` and `OT_RADIO_CAPS_RETX_IE_UPDATE` capabilities.
+ *
+ * CSL transmissions are otherwise requested with zero retries, since the CSL IE content becomes stale between
+ * transmit attempts.
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_CSL_OFFLOAD
+#define OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_CSL_OFFLOAD 3
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+ *
+ * Define as 1 to enable adaptive CCA backoff.
+ *
+ * When enabled, the sub-MAC tracks the recent CCA failure rate per channel and increases the CSMA backoff exponents
+ * (macMinBE/macMaxBE) used on congested channels, within the bounds allowed by IEEE 802.15.4. This de-synchronizes
+ * contending transmitters on collision-heavy channels. Applicable only when CSMA backoff is handled in software.
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+#define OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLLING_ENABLE
+ *
+ * Define as 1 to enable adaptive data polling.
+ *
+ * When enabled, a sleepy device that receives a data frame from its parent switches to a fast poll period, which
+ * then doubles with every poll that returns no data until it decays back to the configured poll period. Bursty
+ * downlink traffic (e.g., command clusters) is drained with low latency while an idle link quickly returns to the
+ * battery-friendly period. Poll efficiency counters (polls that returned data vs. total polls) are also maintained.
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLLING_ENABLE
+#define OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLLING_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_ADD_DELAY_ON_NO_ACK_ERROR_BEFORE_RETRY
  *
@@ -346,6 +386,18 @@
 #define OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+ *
+ * Define to 1 to cache the expanded AES key schedule used for MAC frame security in persistent AES-CCM contexts,
+ * re-deriving it only when the key in use changes (e.g., on key rotation) rather than on every secured frame.
+ *
+ * This trades a small amount of RAM (the persistent AES contexts) for lower per-frame security processing cost.
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_TIMING_ENABLE
  *
@@ -391,6 +443,67 @@
 #define OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_ENABLE
+ *
+ * Define to 1 to enable CSL transmit burst mode. After a successful CSL transmission with the frame pending bit set,
+ * additional queued frames for the same CSL receiver are transmitted back-to-back within the same receive window
+ * (rather than one frame per CSL sample window), reducing the delivery latency of multi-fragment datagrams.
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_ENABLE
+#define OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_MAX_FRAMES
+ *
+ * Specifies the maximum number of follow-up frames transmitted back-to-back after the first frame in a CSL burst.
+ *
+ * Applicable only when CSL transmit burst mode is enabled (`OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_ENABLE`).
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_MAX_FRAMES
+#define OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_MAX_FRAMES 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_SRC_MATCH_BATCH_UPDATE_ENABLE
+ *
+ * Define as 1 to re-add pending source match entries using the batched `otPlatRadioSetSrcMatch{Short,Ext}Entries()`
+ * platform APIs, replacing the full table in a single platform call instead of one call per entry.
+ *
+ * This is intended mainly for host builds driving an RCP, where each platform call is a separate radio transaction.
+ * It uses stack arrays sized by `OPENTHREAD_CONFIG_MLE_MAX_CHILDREN`.
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_SRC_MATCH_BATCH_UPDATE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_SRC_MATCH_BATCH_UPDATE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE
+ *
+ * Define as 1 to maintain a source match pending filter on the radio (`otPlatRadioSetSrcMatchPendingFilter()`).
+ *
+ * The pending filter is a compact bitmap (hashed over child addresses) the radio consults while source matching is
+ * disabled after the source match table overflows. It lets the radio keep answering data polls with an accurate
+ * "frame pending" bit (modulo hash collisions) without host involvement, instead of setting the bit on all acks.
+ *
+ * Requires radio platform support; on platforms without support the legacy set-on-all-acks behavior is retained.
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE
+#define OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_SIZE
+ *
+ * Specifies the source match pending filter size (in bytes).
+ *
+ * Applicable only when the pending filter is enabled (`OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE`).
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_SIZE
+#define OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_SIZE 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
  *
@@ -558,6 +671,20 @@
 #define OPENTHREAD_CONFIG_MAC_DATA_POLL_TIMEOUT 100
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_RADIO_RX_TIMESTAMP_ENABLE
+ *
+ * Define to 1 to plumb the radio receive timestamp of received frames (from `otRadioFrame`) up through the message
+ * metadata and `otThreadLinkInfo`, making it available to receive-side consumers (e.g., the ping sender uses it to
+ * exclude host-side processing delay from measured round-trip times).
+ *
+ * Requires the radio platform to timestamp received frames and to implement `otPlatRadioGetNow()` with the same
+ * time base.
+ */
+#ifndef OPENTHREAD_CONFIG_RADIO_RX_TIMESTAMP_ENABLE
+#define OPENTHREAD_CONFIG_RADIO_RX_TIMESTAMP_ENABLE 0
+#endif
+
 /**
  * @}
  */
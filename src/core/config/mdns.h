@@ -95,6 +95,34 @@
 #define OPENTHREAD_CONFIG_MULTICAST_DNS_DEFAULT_QUESTION_UNICAST_ALLOWED 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_WINDOW
+ *
+ * Specifies the start-up ramp window (in msec) used to spread probe transmissions of a large registration batch.
+ *
+ * The mDNS module aggregates entries registered close in time onto a shared probe transmission slot. When a large
+ * number of entries is registered at once (e.g., an SRP Advertising Proxy re-registering all services after a
+ * restart), this aggregation would probe and subsequently announce every entry on nearly the same schedule, producing
+ * bursts of large multicast messages. With a non-zero ramp window, at most
+ * `OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_SLOT_MAX_ENTRIES` entries share a probe slot, and overflow entries are
+ * paced onto later slots within the window. Since announcements start when probing completes, this spreads the
+ * announce transmissions as well. Use zero to disable the ramp and aggregate all entries onto a single slot.
+ */
+#ifndef OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_WINDOW
+#define OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_WINDOW 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_SLOT_MAX_ENTRIES
+ *
+ * Specifies the maximum number of entries sharing a probe transmission slot when the start-up ramp is enabled.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_WINDOW` is non-zero.
+ */
+#ifndef OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_SLOT_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_SLOT_MAX_ENTRIES 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MULTICAST_DNS_PERSIST_STATE_ON_POST_PROBE_CONFLICT
  *
@@ -65,6 +65,18 @@
 #define OPENTHREAD_CONFIG_MESH_DIAG_RESPONSE_TIMEOUT 5000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESH_DIAG_MAX_CONCURRENT_QUERIES
+ *
+ * Specifies the maximum number of concurrently outstanding mesh diagnostic queries.
+ *
+ * At most one query can be outstanding towards a given destination at any time. Set to 1 to serialize all queries
+ * (one query at a time, matching the earlier behavior).
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_DIAG_MAX_CONCURRENT_QUERIES
+#define OPENTHREAD_CONFIG_MESH_DIAG_MAX_CONCURRENT_QUERIES 4
+#endif
+
 /**
  * @}
  */
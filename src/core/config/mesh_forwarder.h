@@ -69,6 +69,132 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_MAX_REASSEMBLY_SESSIONS
+ *
+ * The maximum number of 6LoWPAN datagrams that can be under reassembly at the same time.
+ *
+ * When a new first fragment arrives while the limit is reached, the least recently updated in-progress datagram is
+ * dropped to make room for it.
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_MAX_REASSEMBLY_SESSIONS
+#define OPENTHREAD_CONFIG_6LOWPAN_MAX_REASSEMBLY_SESSIONS 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_MAX_REASSEMBLY_SESSIONS_PER_SENDER
+ *
+ * The maximum number of 6LoWPAN datagrams that can be under reassembly at the same time from a single sender (same
+ * IPv6 source address).
+ *
+ * When a new first fragment arrives while the sender is at its quota, the sender's least recently updated in-progress
+ * datagram is dropped to make room for it. This prevents one sender from claiming all reassembly sessions (and the
+ * message buffers backing them).
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_MAX_REASSEMBLY_SESSIONS_PER_SENDER
+#define OPENTHREAD_CONFIG_6LOWPAN_MAX_REASSEMBLY_SESSIONS_PER_SENDER 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+ *
+ * Define as 1 to enable the adaptive 6LoWPAN reassembly timeout feature.
+ *
+ * When enabled, the gap between successive fragment arrivals is observed for each datagram under reassembly (tracked
+ * in the reassembly entry itself). An in-progress datagram is then allowed to wait for its next fragment for up to a
+ * multiple of its largest observed gap, bounded below by `OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT` and above by
+ * four times that value. On a congested channel where fragments legitimately arrive far apart, this avoids dropping
+ * nearly complete datagrams (which would otherwise force full IP-level retransmissions).
+ *
+ * A histogram of the observed inter-fragment gaps is also collected and can be retrieved using the
+ * `otThreadGetReassemblyGapHistogram()` function.
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+#define OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_GAP_HISTOGRAM_MAX_INTERVAL
+ *
+ * Specifies the maximum inter-fragment gap interval in milliseconds tracked by the histogram when the adaptive
+ * reassembly timeout feature is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_GAP_HISTOGRAM_MAX_INTERVAL
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_GAP_HISTOGRAM_MAX_INTERVAL (OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT * 1000)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_GAP_HISTOGRAM_BIN_INTERVAL
+ *
+ * Specifies the reassembly gap histogram bin interval in milliseconds.
+ *
+ * The number of bins is calculated by dividing `OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_GAP_HISTOGRAM_MAX_INTERVAL` by
+ * `OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_GAP_HISTOGRAM_BIN_INTERVAL` and rounding up to the nearest integer.
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_GAP_HISTOGRAM_BIN_INTERVAL
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_GAP_HISTOGRAM_BIN_INTERVAL 50
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE
+ *
+ * Define to 1 to prepare the next fragment frame of an outbound message while the radio transmits the current one.
+ *
+ * After handing a fragment frame to the MAC layer, the mesh forwarder prepares the following fragment (6LoWPAN
+ * fragmentation header and payload copy) into a staging buffer from a tasklet, and provides the pre-built frame on
+ * the next MAC frame request. This overlaps host-side frame preparation with the radio transmit time, which is
+ * mainly useful on RCP designs where the radio otherwise idles waiting for the host to build the next frame.
+ *
+ * This feature is not supported together with multi-radio links or time sync.
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE
+ *
+ * Define to 1 to schedule an outbound datagram for transmission synchronously from the IPv6 enqueue when possible.
+ *
+ * Normally an outbound datagram passes through two tasklet hops before reaching the MAC layer: the IPv6 send queue
+ * tasklet and the mesh forwarder transmission scheduling tasklet. When this feature is enabled, the IPv6 send queue
+ * is drained synchronously on enqueue, and the mesh forwarder prepares the frame directly from `SendMessage()` when
+ * the MAC is idle with no transmission in progress. This removes the tasklet round-trip latency per packet, which is
+ * the dominant cost for small datagrams on platforms with a scheduling overhead (e.g., the POSIX daemon). When the
+ * MAC is busy or a transmission is already prepared, scheduling falls back to the tasklet.
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+ *
+ * Define to 1 to enable fairness scheduling of direct transmissions across destinations.
+ *
+ * When enabled, after a configurable number of consecutive frames to the same MAC destination, the mesh forwarder
+ * prefers a queued message of the same priority for a different destination (when one exists) before continuing with
+ * the current destination. This prevents one busy destination (e.g., a chatty child) from monopolizing airtime within
+ * a priority level. Messages of higher priority (e.g., MLE and TMF traffic) are always served first, independent of
+ * this feature.
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_DEFAULT_MAX_BURST
+ *
+ * The default maximum number of consecutive direct-transmission frames to the same MAC destination before yielding
+ * to a same-priority message for a different destination.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE` is enabled. Can be changed at run-time using
+ * `otThreadSetTxFairnessMaxBurst()`. Value zero disables the fairness scheduling.
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_DEFAULT_MAX_BURST
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_DEFAULT_MAX_BURST 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NUM_FRAGMENT_PRIORITY_ENTRIES
  *
@@ -134,6 +134,19 @@
 #define OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_JAM_DETECTION_PROACTIVE_CHANNEL_SELECT_ENABLE
+ *
+ * Define to 1 to let the Jam Detection service request a channel selection from `ChannelManager` when the jam
+ * warning state is entered (i.e., before the hard jam threshold is reached).
+ *
+ * Applicable only on FTD builds with both `OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE` and
+ * `OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE` set.
+ */
+#ifndef OPENTHREAD_CONFIG_JAM_DETECTION_PROACTIVE_CHANNEL_SELECT_ENABLE
+#define OPENTHREAD_CONFIG_JAM_DETECTION_PROACTIVE_CHANNEL_SELECT_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_VERHOEFF_CHECKSUM_ENABLE
  *
@@ -179,6 +192,16 @@
 #define OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_UDP_SOCKET_LOOKUP_CACHE_ENABLE
+ *
+ * Define to 1 to enable a one-entry last-match cache for inbound UDP socket lookup. Steady-state flows then
+ * resolve their socket without walking the socket list.
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_SOCKET_LOOKUP_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_UDP_SOCKET_LOOKUP_CACHE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
  *
@@ -190,6 +213,61 @@
 #define OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+ *
+ * Define to 1 to enable copy-on-write buffer sharing for message cloning.
+ *
+ * When enabled, `Message::CloneWithSharedBuffers()` creates a clone that shares the original message's tail buffer
+ * chain through a per-buffer reference count (adding a `uint16_t` to every buffer header), and MPL uses it for
+ * per-retransmission copies of buffered multicasts. A shared chain is copied on write; if the copy fails due to
+ * buffer exhaustion, the write is logged and dropped.
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+ *
+ * Define to 1 to enable per-owner memory accounting.
+ *
+ * When enabled, live message counts and payload bytes are tracked per message type, and live object counts and bytes
+ * are tracked per owner module for `Heap::Allocatable` allocations. The accounting table is retrieved using
+ * `otMessageGetMemOwnerStats()` and helps identify which subsystem is consuming the buffers when allocations start
+ * failing with `OT_ERROR_NO_BUFS`.
+ */
+#ifndef OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE
+#define OPENTHREAD_CONFIG_MEM_OWNER_STATS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_PARSED_VIEW_ENABLE
+ *
+ * Define to 1 to enable the parsed view of the Leader Network Data.
+ *
+ * When enabled, the on-mesh prefix, external route, and service entries in the Leader Network Data are parsed once
+ * into typed arrays whenever the Network Data changes, and iteration over the entries reads from the arrays instead
+ * of re-parsing the raw TLVs on every `GetNext()` call. This trades RAM (the arrays are kept alongside the raw
+ * TLVs) for faster repeated iteration, e.g., source address selection route checks performed per transmitted packet.
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_PARSED_VIEW_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_PARSED_VIEW_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_LIFECYCLE_TRACE_ENABLE
+ *
+ * Define to 1 to enable message lifecycle tracing for transmitted IPv6 messages.
+ *
+ * When enabled, a transmitted message records the time it was queued as an IPv6 datagram and the time its first MAC
+ * frame was prepared. The History Tracker (when also enabled) uses the recorded times to report per-message queue
+ * and transmit durations in its TX history entries.
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_LIFECYCLE_TRACE_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_LIFECYCLE_TRACE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
  *
@@ -217,6 +295,46 @@
 #define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE (sizeof(void *) * 32)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+ *
+ * Define to 1 to enable size-classed message buffer pools.
+ *
+ * When enabled, in addition to the regular buffer pool, the `MessagePool` maintains a pool of small buffers of size
+ * `OPENTHREAD_CONFIG_SMALL_MESSAGE_BUFFER_SIZE`. Callers allocating short messages (e.g., MLE keepalives or other
+ * control messages) can request the small buffer class, reducing internal fragmentation of the buffer pool and
+ * leaving regular buffers available for the data path.
+ *
+ * This option requires the internal buffer pool, i.e., it cannot be used together with
+ * `OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE` or `OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT`.
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NUM_SMALL_MESSAGE_BUFFERS
+ *
+ * The number of small message buffers in the small buffer pool.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_SMALL_MESSAGE_BUFFERS
+#define OPENTHREAD_CONFIG_NUM_SMALL_MESSAGE_BUFFERS 22
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SMALL_MESSAGE_BUFFER_SIZE
+ *
+ * The size of a small message buffer in bytes.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_MESSAGE_SIZE_CLASS_POOLS_ENABLE` is enabled. The size MUST be large enough
+ * to fit the message metadata and MUST NOT be larger than `OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE`.
+ */
+#ifndef OPENTHREAD_CONFIG_SMALL_MESSAGE_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_SMALL_MESSAGE_BUFFER_SIZE (sizeof(void *) * 24)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_TRANSMIT_POWER
  *
@@ -542,6 +660,16 @@
 #define OPENTHREAD_CONFIG_MLR_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLR_AGGREGATION_DELAY
+ *
+ * Specifies the maximum aggregation delay (in seconds) used to batch pending Multicast Listener Registrations
+ * into a single MLR.req. Must be larger than 1. The default matches the Thread 1.2 Parent Aggregate Delay.
+ */
+#ifndef OPENTHREAD_CONFIG_MLR_AGGREGATION_DELAY
+#define OPENTHREAD_CONFIG_MLR_AGGREGATION_DELAY 5
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NEIGHBOR_DISCOVERY_AGENT_ENABLE
  *
@@ -598,6 +726,19 @@
 #define OPENTHREAD_CONFIG_BLE_TCAT_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_BLE_TCAT_TLS_DATA_MAX_SIZE
+ *
+ * Specifies the maximum size (in bytes) of data chunks (TLS record payloads) sent by BLE secure.
+ *
+ * Larger chunks amortize the per-record TLS overhead when transferring large payloads (e.g., Operational Datasets or
+ * certificates) and help saturate the BLE connection interval. The value must not exceed the maximum TLS fragment
+ * length supported by the TLS stack configuration.
+ */
+#ifndef OPENTHREAD_CONFIG_BLE_TCAT_TLS_DATA_MAX_SIZE
+#define OPENTHREAD_CONFIG_BLE_TCAT_TLS_DATA_MAX_SIZE 800
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_PLATFORM_LOG_CRASH_DUMP_ENABLE
  *
@@ -611,6 +752,65 @@
 #define OPENTHREAD_CONFIG_PLATFORM_LOG_CRASH_DUMP_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+ *
+ * Define to 1 to back the timer schedulers with a hierarchical timing wheel instead of a sorted linked list.
+ *
+ * The wheel makes timer start and stop O(1) regardless of the number of scheduled timers (the sorted list walks
+ * all earlier timers on every insertion), at the cost of about 0.5 kB of additional RAM per scheduler. It is
+ * intended for devices carrying many active timers (e.g., routers with per-child supervision and CoAP
+ * retransmission timers) where timer insertion is on the packet path.
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+ *
+ * Define to 1 to enable priority classes in the tasklet scheduler.
+ *
+ * When enabled, tasklets are assigned one of three priority classes (high, normal, or low) and the scheduler
+ * drains them with bounded-deficit round-robin between the classes (a fixed per-class budget of runs per round),
+ * so latency critical tasklets (e.g., frame TX preparation) are not delayed behind heavy background work while
+ * lower classes still make guaranteed progress. The scheduler also tracks the maximum observed delay between
+ * posting and running each tasklet.
+ */
+#ifndef OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+#define OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LIGHTWEIGHT_STRING_FORMATTER_ENABLE
+ *
+ * Define to 1 to format common conversion specifiers in `StringWriter` directly instead of through `vsnprintf()`.
+ *
+ * When enabled, `StringWriter::AppendVarArgs()` (used by logging, and by CLI output) emits the conversions commonly
+ * used in the stack (`%s`, `%c`, `%d`, `%u`, `%x`, `%X` with optional `-`/`0` flags, field width, and `l`/`ll` length
+ * modifiers) directly into the output buffer, avoiding the libc `vsnprintf()` formatting machinery on the log and CLI
+ * hot paths. Format strings using any other conversion fall back to `vsnprintf()` unchanged.
+ */
+#ifndef OPENTHREAD_CONFIG_LIGHTWEIGHT_STRING_FORMATTER_ENABLE
+#define OPENTHREAD_CONFIG_LIGHTWEIGHT_STRING_FORMATTER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+ *
+ * Define to 1 to enable the RAM cache of frequently accessed settings records.
+ *
+ * When enabled, the `NetworkInfo` and `ParentInfo` settings records (re-read from the platform settings store during
+ * attach and key rotation) are cached in RAM, making repeated reads and unchanged re-saves free of platform store
+ * accesses. Writes of the `NetworkInfo` record (which carries the persisted MAC/MLE frame counters and is saved in
+ * bursts) are coalesced and flushed to the platform store after a short bounded delay, or immediately on
+ * de-initialization; all other records continue to write through immediately. MLE persists frame counters ahead of
+ * their use, which bounds the effect of losing a deferred `NetworkInfo` write on an ungraceful reset.
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_SETTINGS_CACHE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_ENABLE_VENDOR_EXTENSION
  *
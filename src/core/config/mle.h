@@ -73,6 +73,20 @@
 #define OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_DEFAULT 240
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_TX_TLV_TEMPLATE_ENABLE
+ *
+ * Define to 1 to enable the prebuilt MLE TLV template.
+ *
+ * When enabled, the Source Address and Leader Data TLV section shared by outgoing MLE messages (advertisements,
+ * child updates, etc.) is serialized once into a small template buffer and copied into each message, instead of
+ * being re-encoded TLV by TLV. The template is rebuilt only when the RLOC16 or the Leader Data changes. This mainly
+ * benefits routers, which transmit advertisements continually.
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_TX_TLV_TEMPLATE_ENABLE
+#define OPENTHREAD_CONFIG_MLE_TX_TLV_TEMPLATE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD
  *
@@ -267,6 +281,46 @@
 #define OPENTHREAD_CONFIG_MLE_LONG_ROUTES_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+ *
+ * Define as 1 to enable equal-cost multi-path (ECMP) routing between routers.
+ *
+ * When enabled, each `Router` entry tracks (in addition to its next hop) up to
+ * `OPENTHREAD_CONFIG_MLE_ECMP_MAX_ALT_NEXT_HOPS` alternate next hops offering an equal path cost towards the
+ * destination (learned from received MLE Advertisements). When forwarding, the mesh forwarder hashes the IPv6 flow
+ * (flow label and source/destination addresses) to pick among the equal-cost next hops, spreading concurrent flows
+ * across parallel links while keeping each flow on a single path.
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+#define OPENTHREAD_CONFIG_MLE_ECMP_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ECMP_MAX_ALT_NEXT_HOPS
+ *
+ * Specifies the maximum number of alternate (equal-cost) next hops tracked per `Router` entry.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_MLE_ECMP_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ECMP_MAX_ALT_NEXT_HOPS
+#define OPENTHREAD_CONFIG_MLE_ECMP_MAX_ALT_NEXT_HOPS 2
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+ *
+ * Define as 1 to enable caching of computed next hop and path cost per destination router.
+ *
+ * When enabled, `RouterTable` caches the next hop and path cost determined for a destination router, so repeated
+ * lookups (e.g., per forwarded packet towards the same destination) become an array read instead of a scan over the
+ * router table. Cached results are invalidated on any router table change (using a generation counter) and also
+ * expire after a short lifetime to track link quality variations which do not emit a table change event.
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_SEND_UNICAST_ANNOUNCE_RESPONSE
  *
@@ -279,6 +333,21 @@
 #define OPENTHREAD_CONFIG_MLE_SEND_UNICAST_ANNOUNCE_RESPONSE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_FAST_REATTACH_ENABLE
+ *
+ * Define as 1 to enable fast reattach to the previously known parent.
+ *
+ * If this feature is enabled, when a detached device starts an attach cycle, it additionally unicasts the first
+ * Parent Request directly to its previously known parent (persisted in `Settings::ParentInfo`) alongside the
+ * normal multicast scan. A Parent Response from the previous parent is committed to immediately rather than
+ * waiting out the full response window, cutting reattach latency to about one round trip when the topology is
+ * unchanged.
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_FAST_REATTACH_ENABLE
+#define OPENTHREAD_CONFIG_MLE_FAST_REATTACH_ENABLE 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_INFORM_PREVIOUS_PARENT_ON_REATTACH
  *
@@ -56,9 +56,12 @@
  * @def OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS
  *
  * Specifies maximum number of active mappings for NAT64.
+ *
+ * Mapping lookups use a hashed index, so larger tables remain practical on border routers fronting many
+ * concurrent flows.
  */
 #ifndef OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS
-#define OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS 254
+#define OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS 508
 #endif
 
 /**
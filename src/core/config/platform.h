@@ -102,6 +102,27 @@
 #define OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_UNALIGNED_ACCESS_ENABLE
+ *
+ * Define as 1 if the platform CPU supports unaligned memory access.
+ *
+ * When enabled, `FrameData` in-place read methods (e.g., `FrameData::ReadAs()`) return typed pointers directly
+ * into the frame buffer regardless of alignment. When disabled, reads from unaligned positions automatically
+ * fall back to copying into a caller-provided object.
+ *
+ * The default is derived from the target architecture: enabled on architectures known to support unaligned
+ * access (e.g., ARM cores defining `__ARM_FEATURE_UNALIGNED`, x86/x86-64, AArch64), disabled otherwise (e.g.,
+ * ARMv6-M Cortex-M0/M0+).
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_UNALIGNED_ACCESS_ENABLE
+#if defined(__ARM_FEATURE_UNALIGNED) || defined(__i386__) || defined(__x86_64__) || defined(__aarch64__)
+#define OPENTHREAD_CONFIG_PLATFORM_UNALIGNED_ACCESS_ENABLE 1
+#else
+#define OPENTHREAD_CONFIG_PLATFORM_UNALIGNED_ACCESS_ENABLE 0
+#endif
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_PLATFORM_DNSSD_ENABLE
  *
@@ -97,6 +97,22 @@
 #define OPENTHREAD_CONFIG_MULTI_RADIO_FRAG_TAG_TIMEOUT (20 * 1000)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MULTI_RADIO_TRAFFIC_STEERING_ENABLE
+ *
+ * Set to 1 to enable traffic-class based steering between radio links.
+ *
+ * When enabled, `RadioSelector` steers bulk (data) traffic onto the TREL radio link and keeps latency-critical MLE
+ * traffic on the IEEE 802.15.4 radio link whenever the relevant link is usable (high preference) for the neighbor,
+ * rather than sending all traffic over the single most-preferred link. Per-link transmitted byte counters are also
+ * maintained, showing the resulting traffic distribution.
+ *
+ * Applicable only in multi radio link builds (`OPENTHREAD_CONFIG_MULTI_RADIO`).
+ */
+#ifndef OPENTHREAD_CONFIG_MULTI_RADIO_TRAFFIC_STEERING_ENABLE
+#define OPENTHREAD_CONFIG_MULTI_RADIO_TRAFFIC_STEERING_ENABLE 0
+#endif
+
 /**
  * @}
  */
@@ -57,6 +57,20 @@
 #define OPENTHREAD_CONFIG_DTLS_MAX_CONTENT_LEN MBEDTLS_SSL_IN_CONTENT_LEN
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_HANDSHAKE_MAX_CRYPTO_OPS
+ *
+ * The maximum number of basic ECC operations performed in a single DTLS/TLS handshake step, when the mbedtls backend
+ * supports restartable ECC operations (`MBEDTLS_ECP_RESTARTABLE`).
+ *
+ * Bounding the per-step cost allows concurrent handshakes (e.g., multiple external commissioner sessions on the
+ * Border Agent) to make fair interleaved progress, instead of one long-running handshake computation delaying all
+ * others. A stalled step is resumed from a tasklet. Zero leaves the mbedtls default (unbounded) in place.
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_HANDSHAKE_MAX_CRYPTO_OPS
+#define OPENTHREAD_CONFIG_DTLS_HANDSHAKE_MAX_CRYPTO_OPS 10000
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_SECURE_TRANSPORT_ENABLE
  *
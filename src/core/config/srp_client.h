@@ -210,6 +210,22 @@
 #define OPENTHREAD_CONFIG_SRP_CLIENT_EARLY_LEASE_RENEW_FACTOR_DENOMINATOR 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_CLIENT_DIFFERENTIAL_UPDATE_ENABLE
+ *
+ * Define to 1 to enable differential SRP update messages.
+ *
+ * When enabled, an update triggered by a change to the service list (e.g., adding, refreshing, or removing a single
+ * service) includes only the changed services and does not opportunistically pull in the other already registered
+ * services. The opportunistic early refresh (see the early lease renewal factor above) is then limited to updates
+ * that are themselves driven by lease renewal, i.e., that contain at least one service that reached its renew time.
+ * Registered services left out of an update are still refreshed individually when their own lease renew time is
+ * reached, so every service continues to be fully re-registered once per lease interval.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_CLIENT_DIFFERENTIAL_UPDATE_ENABLE
+#define OPENTHREAD_CONFIG_SRP_CLIENT_DIFFERENTIAL_UPDATE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_SRP_CLIENT_MIN_RETRY_WAIT_INTERVAL
  *
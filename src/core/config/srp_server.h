@@ -111,6 +111,37 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_SERVICE_UPDATE_TIMEOUT ((4 * 250u) + 250u)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_LEASE_EXPIRY_GRANULARITY
+ *
+ * Specifies the granularity (in milliseconds) used when scheduling the lease expiry timer.
+ *
+ * The fire time of the lease timer is rounded up to the next multiple of this value, so that
+ * registrations expiring close together are processed in a single pass over the host list (with
+ * one batch of service update notifications) rather than with one timer firing per entry. Expiry
+ * of a lease may thus be processed up to this duration late, which is negligible compared to the
+ * lease intervals (which are in seconds). Use zero to schedule the timer at the exact earliest
+ * expire time.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_LEASE_EXPIRY_GRANULARITY
+#define OPENTHREAD_CONFIG_SRP_SERVER_LEASE_EXPIRY_GRANULARITY 1000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_SIG_VERIFY_CACHE_SIZE
+ *
+ * Specifies the number of entries in the SIG(0) verification cache. Zero disables the cache.
+ *
+ * The cache remembers digests of recently verified SRP update signatures, so that a retransmitted
+ * copy of the same update (e.g., a UDP retry sent by a client while the server is still busy
+ * processing the earlier copy) does not incur a second ECDSA verification. An entry is keyed on
+ * the host key, the signed message data, and the signature itself, so a change to any of them
+ * results in a cache miss and full verification.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_SIG_VERIFY_CACHE_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_SIG_VERIFY_CACHE_SIZE 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
  *
@@ -0,0 +1,74 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes compile-time configurations for the telemetry emitter module.
+ */
+
+#ifndef OT_CORE_CONFIG_TELEMETRY_EMITTER_H_
+#define OT_CORE_CONFIG_TELEMETRY_EMITTER_H_
+
+/**
+ * @addtogroup config-telemetry-emitter
+ *
+ * @brief
+ *   This module includes configuration variables for the telemetry emitter.
+ *
+ * @{
+ */
+
+/**
+ * @def OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE
+ *
+ * Define to 1 to enable the telemetry emitter.
+ *
+ * When enabled, the stack emits sampled forwarding decisions (with queue depths) and parent changes as compact
+ * binary events through the `otPlatTelemetryEmit()` platform stream.
+ */
+#ifndef OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE
+#define OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TELEMETRY_EMITTER_SAMPLE_INTERVAL
+ *
+ * Specifies the sampling interval for hot-path telemetry events.
+ *
+ * One forwarding decision event is emitted for every this-many frame transmissions. Rare events (parent changes)
+ * are always emitted. Must be larger than zero.
+ */
+#ifndef OPENTHREAD_CONFIG_TELEMETRY_EMITTER_SAMPLE_INTERVAL
+#define OPENTHREAD_CONFIG_TELEMETRY_EMITTER_SAMPLE_INTERVAL 16
+#endif
+
+/**
+ * @}
+ */
+
+#endif // OT_CORE_CONFIG_TELEMETRY_EMITTER_H_
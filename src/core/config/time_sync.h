@@ -97,6 +97,46 @@
 #define OPENTHREAD_CONFIG_TIME_SYNC_JUMP_NOTIF_MIN_US 10000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+ *
+ * Define as 1 to enable the network time drift model.
+ *
+ * When enabled, the device maintains rate and offset estimates (a simple phase-locked loop) from successive time
+ * sync messages and slews small corrections instead of stepping the network time, avoiding timestamp jumps between
+ * sync messages. Corrections larger than `OPENTHREAD_CONFIG_TIME_SYNC_STEP_THRESHOLD_US` are still stepped.
+ *
+ * Applicable only if time synchronization service feature is enabled (i.e., OPENTHREAD_CONFIG_TIME_SYNC_ENABLE is
+ * set).
+ */
+#ifndef OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+#define OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TIME_SYNC_SLEW_RATE_PPM
+ *
+ * Specifies the maximum rate (in PPM) at which the network time is slewed towards a new offset.
+ *
+ * Applicable only if the network time drift model is enabled (i.e., OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+ * is set).
+ */
+#ifndef OPENTHREAD_CONFIG_TIME_SYNC_SLEW_RATE_PPM
+#define OPENTHREAD_CONFIG_TIME_SYNC_SLEW_RATE_PPM 500
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TIME_SYNC_STEP_THRESHOLD_US
+ *
+ * Specifies the offset correction (in microseconds) above which the network time is stepped instead of slewed.
+ *
+ * Applicable only if the network time drift model is enabled (i.e., OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+ * is set).
+ */
+#ifndef OPENTHREAD_CONFIG_TIME_SYNC_STEP_THRESHOLD_US
+#define OPENTHREAD_CONFIG_TIME_SYNC_STEP_THRESHOLD_US 50000
+#endif
+
 /**
  * @}
  */
@@ -117,6 +117,20 @@
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_RETRY_DELAY 120
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_NEW_PER_SECOND
+ *
+ * Maximum number of first-time address queries (for targets with no existing cache entry) that can be initiated per
+ * second. Queries beyond this budget are dropped early, before a cache entry or query message is allocated. This
+ * bounds the query load and message pool usage when an external host scans a large address range through a Border
+ * Router. Retries for already tracked targets are not subject to this limit.
+ *
+ * Define as zero to disable the limit.
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_NEW_PER_SECOND
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_NEW_PER_SECOND 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_ALLOW_ADDRESS_RESOLUTION_USING_NET_DATA_SERVICES
  *
@@ -177,6 +191,21 @@
 #define OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_MAX_ALOCS 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_LEADER_COMMIT_AGGREGATION_WINDOW
+ *
+ * Specifies the aggregation window (in milliseconds) used by the leader to batch Network Data registrations.
+ *
+ * When a non-zero window is used, the leader delays signaling a Network Data change (which triggers delta
+ * propagation to the rest of the network) until the window expires, so that a burst of concurrent server data
+ * registrations results in a single propagation wave. The window is anchored at the first change, bounding the
+ * added delay. Network Data versions are still incremented per change. A value of zero disables aggregation
+ * (every registration is signaled immediately).
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_LEADER_COMMIT_AGGREGATION_WINDOW
+#define OPENTHREAD_CONFIG_NETDATA_LEADER_COMMIT_AGGREGATION_WINDOW 500
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_NETDIAG_CLIENT_ENABLE
  *
@@ -189,6 +218,21 @@
 #define OPENTHREAD_CONFIG_TMF_NETDIAG_CLIENT_ENABLE OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE
+ *
+ * Define to 1 to enable delta responses to diagnostic get requests (vendor extension).
+ *
+ * When enabled, and a diagnostic get request includes a Delta Generation TLV echoing the cookie from the previous
+ * answer, the server omits any requested TLV whose content is unchanged since that answer, tracking a per-requester
+ * generation cookie and per-TLV checksums. A request without the TLV (or with a stale cookie) always gets the full
+ * response. This is a vendor extension intended for frequent pollers with cooperating clients: a TLV absent from a
+ * delta answer means "unchanged since the echoed generation".
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE
+#define OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_ENABLE
  *
@@ -212,6 +256,31 @@
 #define OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_SEND_RESPONSE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_MAX_QUERIES
+ *
+ * Specifies the maximum number of anycast locate queries that can be in progress in parallel.
+ *
+ * This config is used only when `OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_MAX_QUERIES
+#define OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_MAX_QUERIES 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_CACHE_ENTRIES
+ *
+ * Specifies the number of ALOC to RLOC16 binding cache entries maintained by the anycast locator.
+ *
+ * A cached binding is used (avoiding a new locate query) as long as the Network Data version has not changed
+ * since the binding was learned.
+ *
+ * This config is used only when `OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_CACHE_ENTRIES
+#define OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_CACHE_ENTRIES 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
  *
@@ -222,6 +291,21 @@
 #define OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_PROXY_DUA_MAX_PARALLEL_REGISTRATIONS
+ *
+ * Specifies the maximum number of proxy DUA.req transactions (for children's DUAs) that can be in flight in
+ * parallel.
+ *
+ * Pipelining the registrations shortens the window after a parent switch during which backbone-originated traffic
+ * to children with not yet re-registered DUAs is dropped.
+ *
+ * This config is used only when `OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_PROXY_DUA_MAX_PARALLEL_REGISTRATIONS
+#define OPENTHREAD_CONFIG_TMF_PROXY_DUA_MAX_PARALLEL_REGISTRATIONS 4
+#endif
+
 #if OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE && OPENTHREAD_CONFIG_THREAD_VERSION < OT_THREAD_VERSION_1_2
 #error "Thread 1.2 or higher version is required for OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE"
 #endif
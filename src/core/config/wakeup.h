@@ -79,6 +79,33 @@
 #define OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_CONNECTION_RETRY_COUNT 12
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MULTI_TARGET_ENABLE
+ *
+ * Define to 1 to allow waking up multiple Wake-up End Devices within a single wake-up sequence.
+ *
+ * When enabled, additional targets can join an ongoing wake-up sequence (`otThreadWakeup()` can be called again while
+ * a wake-up is already in progress). Wake-up frames for all targets are interleaved within the same sequence window:
+ * each wake-up interval is divided into equal sub-slots, one target per sub-slot, so waking a group occupies the
+ * radio for roughly the same time as waking a single device. Each target still observes wake-up frames at the full
+ * wake-up interval spacing.
+ */
+#ifndef OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MULTI_TARGET_ENABLE
+#define OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MULTI_TARGET_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MAX_TARGETS
+ *
+ * The maximum number of Wake-up End Devices that can be woken up within a single wake-up sequence.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MULTI_TARGET_ENABLE` is enabled. Note that the wake-up
+ * interval is divided by the number of targets, so the wake-up frame air time must still fit in a sub-slot.
+ */
+#ifndef OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MAX_TARGETS
+#define OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MAX_TARGETS 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_WAKEUP_END_DEVICE_ENABLE
  *
@@ -36,6 +36,7 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
+#include "common/num_utils.hpp"
 
 namespace ot {
 namespace Crypto {
@@ -56,6 +57,26 @@ void AesCcm::SetKey(const Mac::KeyMaterial &aMacKey)
     SetKey(cryptoKey);
 }
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+void AesCcm::SetKeyCached(const Mac::KeyMaterial &aMacKey)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    // With key references, the platform owns the key schedule and key
+    // refs may be reused across rotations, so the key is always set.
+    SetKey(aMacKey);
+#else
+    VerifyOrExit(!mHasCachedKey || (aMacKey.GetKey() != mCachedKey));
+
+    mCachedKey    = aMacKey.GetKey();
+    mHasCachedKey = true;
+    SetKey(aMacKey);
+
+exit:
+    return;
+#endif
+}
+#endif // OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+
 void AesCcm::Init(uint32_t    aHeaderLength,
                   uint32_t    aPlainTextLength,
                   uint8_t     aTagLength,
@@ -193,10 +214,35 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
     uint8_t *plaintextBytes  = reinterpret_cast<uint8_t *>(aPlainText);
     uint8_t *ciphertextBytes = reinterpret_cast<uint8_t *>(aCipherText);
     uint8_t  byte;
+    uint32_t i = 0;
 
     OT_ASSERT(mPlainTextCur + aLength <= mPlainTextLength);
 
-    for (unsigned i = 0; i < aLength; i++)
+    // Fast path: at a block-aligned state with both buffers present,
+    // process whole blocks at once, generating the CTR key-stream for
+    // multiple blocks in a single platform submission.
+
+    if ((mBlockLength == 0) && (mCtrLength == sizeof(mCtrPad)) && (plaintextBytes != nullptr) &&
+        (ciphertextBytes != nullptr))
+    {
+        uint32_t numBlocks = aLength / sizeof(mCtrPad);
+
+        if (numBlocks > 0)
+        {
+            if (aMode == kEncrypt)
+            {
+                PayloadBlocks(plaintextBytes, ciphertextBytes, numBlocks, aMode);
+            }
+            else
+            {
+                PayloadBlocks(ciphertextBytes, plaintextBytes, numBlocks, aMode);
+            }
+
+            i = numBlocks * sizeof(mCtrPad);
+        }
+    }
+
+    for (; i < aLength; i++)
     {
         if (mCtrLength == 16)
         {
@@ -254,6 +300,73 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
     }
 }
 
+void AesCcm::PayloadBlocks(const uint8_t *aInput, uint8_t *aOutput, uint32_t aNumBlocks, Mode aMode)
+{
+    uint8_t pads[kCtrPadBatchBlocks * AesEcb::kBlockSize];
+
+    while (aNumBlocks > 0)
+    {
+        uint32_t       numBlocks = Min<uint32_t>(aNumBlocks, kCtrPadBatchBlocks);
+        const uint8_t *pad       = pads;
+
+        // Prepare the counter values for `numBlocks` key-stream blocks
+        // and encrypt them all in one submission.
+
+        for (uint32_t block = 0; block < numBlocks; block++)
+        {
+            for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
+            {
+                if (++mCtr[j])
+                {
+                    break;
+                }
+            }
+
+            memcpy(&pads[block * AesEcb::kBlockSize], mCtr, AesEcb::kBlockSize);
+        }
+
+        mEcb.EncryptBlocks(pads, pads, static_cast<uint16_t>(numBlocks));
+
+        for (uint32_t block = 0; block < numBlocks; block++)
+        {
+            if (mBlockLength == sizeof(mBlock))
+            {
+                mEcb.Encrypt(mBlock, mBlock);
+                mBlockLength = 0;
+            }
+
+            for (unsigned j = 0; j < AesEcb::kBlockSize; j++)
+            {
+                uint8_t byte;
+
+                if (aMode == kEncrypt)
+                {
+                    byte       = aInput[j];
+                    aOutput[j] = byte ^ pad[j];
+                }
+                else
+                {
+                    byte       = aInput[j] ^ pad[j];
+                    aOutput[j] = byte;
+                }
+
+                mBlock[j] ^= byte;
+            }
+
+            mBlockLength = sizeof(mBlock);
+            pad += AesEcb::kBlockSize;
+            aInput += AesEcb::kBlockSize;
+            aOutput += AesEcb::kBlockSize;
+        }
+
+        aNumBlocks -= numBlocks;
+    }
+
+    // The key-stream pad buffer is left fully consumed (`mCtrLength`
+    // remains at `sizeof(mCtrPad)`), matching the byte-wise path state
+    // at a block boundary.
+}
+
 #if OPENTHREAD_FTD || OPENTHREAD_MTD
 void AesCcm::Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, Mode aMode)
 {
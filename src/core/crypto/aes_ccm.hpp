@@ -74,6 +74,16 @@ public:
         kDecrypt, // Decryption mode.
     };
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE && !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    /**
+     * Initializes the `AesCcm` object.
+     */
+    AesCcm(void)
+        : mHasCachedKey(false)
+    {
+    }
+#endif
+
     /**
      * Sets the key.
      *
@@ -96,6 +106,19 @@ public:
      */
     void SetKey(const Mac::KeyMaterial &aMacKey);
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    /**
+     * Sets the key, skipping the AES key schedule derivation when @p aMacKey matches the key already configured on
+     * this object by an earlier call.
+     *
+     * Intended for persistent (long-lived) `AesCcm` objects that secure many frames with a rarely changing key. A
+     * changed key (e.g., after key rotation) no longer matches the cached one and is derived anew.
+     *
+     * @param[in]  aMacKey        Key Material for AES operation.
+     */
+    void SetKeyCached(const Mac::KeyMaterial &aMacKey);
+#endif
+
     /**
      * Initializes the AES CCM computation.
      *
@@ -188,6 +211,16 @@ public:
                               uint8_t               *aNonce);
 
 private:
+    // Number of CTR key-stream blocks generated per platform submission
+    // in the whole-block `Payload()` fast path.
+    static constexpr uint8_t kCtrPadBatchBlocks = 4;
+
+    void PayloadBlocks(const uint8_t *aInput, uint8_t *aOutput, uint32_t aNumBlocks, Mode aMode);
+
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE && !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    Mac::Key mCachedKey;
+    bool     mHasCachedKey;
+#endif
     AesEcb   mEcb;
     uint8_t  mBlock[AesEcb::kBlockSize];
     uint8_t  mCtr[AesEcb::kBlockSize];
@@ -47,6 +47,11 @@ void AesEcb::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSiz
     SuccessOrAssert(otPlatCryptoAesEncrypt(&mContext, aInput, aOutput));
 }
 
+void AesEcb::EncryptBlocks(const uint8_t *aInput, uint8_t *aOutput, uint16_t aNumBlocks)
+{
+    SuccessOrAssert(otPlatCryptoAesEncryptBlocks(&mContext, aInput, aOutput, aNumBlocks));
+}
+
 AesEcb::~AesEcb(void) { SuccessOrAssert(otPlatCryptoAesFree(&mContext)); }
 
 } // namespace Crypto
@@ -84,6 +84,17 @@ public:
      */
     void Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]);
 
+    /**
+     * Encrypts a sequence of independent data blocks in a single platform submission.
+     *
+     * In-place operation (@p aInput equal to @p aOutput) is supported.
+     *
+     * @param[in]   aInput      A pointer to the input buffer (containing @p aNumBlocks blocks of `kBlockSize` bytes).
+     * @param[out]  aOutput     A pointer to the output buffer (to receive @p aNumBlocks blocks of `kBlockSize` bytes).
+     * @param[in]   aNumBlocks  Number of blocks to encrypt.
+     */
+    void EncryptBlocks(const uint8_t *aInput, uint8_t *aOutput, uint16_t aNumBlocks);
+
 private:
     ContextWith<kAesContextSize> mContext;
 };
@@ -137,6 +137,29 @@ exit:
     return error;
 }
 
+OT_TOOL_WEAK otError otPlatCryptoAesEncryptBlocks(otCryptoContext *aContext,
+                                                  const uint8_t   *aInput,
+                                                  uint8_t         *aOutput,
+                                                  uint16_t         aNumBlocks)
+{
+    Error                error = kErrorNone;
+    mbedtls_aes_context *context;
+
+    VerifyOrExit(aContext != nullptr, error = kErrorInvalidArgs);
+    VerifyOrExit(aContext->mContextSize >= sizeof(mbedtls_aes_context), error = kErrorFailed);
+
+    context = static_cast<mbedtls_aes_context *>(aContext->mContext);
+
+    for (uint16_t block = 0; block < aNumBlocks; block++, aInput += 16, aOutput += 16)
+    {
+        VerifyOrExit((mbedtls_aes_crypt_ecb(context, MBEDTLS_AES_ENCRYPT, aInput, aOutput) == 0),
+                     error = kErrorFailed);
+    }
+
+exit:
+    return error;
+}
+
 OT_TOOL_WEAK otError otPlatCryptoAesFree(otCryptoContext *aContext)
 {
     Error                error = kErrorNone;
@@ -663,6 +686,20 @@ exit:
     return error;
 }
 
+OT_TOOL_WEAK otError otPlatCryptoEcdsaVerifyAsync(const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                                                  const otPlatCryptoSha256Hash     *aHash,
+                                                  const otPlatCryptoEcdsaSignature *aSignature,
+                                                  otPlatCryptoEcdsaVerifyCallback   aCallback,
+                                                  void                             *aContext)
+{
+    // The default implementation verifies synchronously, invoking the
+    // callback before returning. Platforms with an asynchronous crypto
+    // accelerator can override this to defer the verification.
+    aCallback(otPlatCryptoEcdsaVerify(aPublicKey, aHash, aSignature), aContext);
+
+    return kErrorNone;
+}
+
 #endif // #if OPENTHREAD_CONFIG_ECDSA_ENABLE
 
 #endif // #if OPENTHREAD_FTD || OPENTHREAD_MTD
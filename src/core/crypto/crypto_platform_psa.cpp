@@ -382,6 +382,30 @@ exit:
     return error;
 }
 
+OT_TOOL_WEAK otError otPlatCryptoAesEncryptBlocks(otCryptoContext *aContext,
+                                                  const uint8_t   *aInput,
+                                                  uint8_t         *aOutput,
+                                                  uint16_t         aNumBlocks)
+{
+    Error         error     = kErrorNone;
+    const size_t  blockSize = PSA_BLOCK_CIPHER_BLOCK_LENGTH(PSA_KEY_TYPE_AES);
+    psa_status_t  status    = PSA_SUCCESS;
+    psa_key_id_t *keyRef;
+    size_t        cipherLen;
+
+    SuccessOrExit(error = ValidateContext(aContext, sizeof(psa_key_id_t)));
+    VerifyOrExit(aInput != nullptr && aOutput != nullptr, error = kErrorInvalidArgs);
+
+    keyRef = static_cast<psa_key_id_t *>(aContext->mContext);
+    status = psa_cipher_encrypt(*keyRef, PSA_ALG_ECB_NO_PADDING, aInput, blockSize * aNumBlocks, aOutput,
+                                blockSize * aNumBlocks, &cipherLen);
+
+    error = PsaToOtError(status);
+
+exit:
+    return error;
+}
+
 OT_TOOL_WEAK otError otPlatCryptoAesFree(otCryptoContext *aContext)
 {
     OT_UNUSED_VARIABLE(aContext);
@@ -764,6 +788,20 @@ exit:
     return PsaToOtError(status);
 }
 
+OT_TOOL_WEAK otError otPlatCryptoEcdsaVerifyAsync(const otPlatCryptoEcdsaPublicKey *aPublicKey,
+                                                  const otPlatCryptoSha256Hash     *aHash,
+                                                  const otPlatCryptoEcdsaSignature *aSignature,
+                                                  otPlatCryptoEcdsaVerifyCallback   aCallback,
+                                                  void                             *aContext)
+{
+    // The default implementation verifies synchronously, invoking the
+    // callback before returning. Platforms with an asynchronous crypto
+    // accelerator can override this to defer the verification.
+    aCallback(otPlatCryptoEcdsaVerify(aPublicKey, aHash, aSignature), aContext);
+
+    return kErrorNone;
+}
+
 OT_TOOL_WEAK otError otPlatCryptoEcdsaVerifyUsingKeyRef(otCryptoKeyRef                    aKeyRef,
                                                         const otPlatCryptoSha256Hash     *aHash,
                                                         const otPlatCryptoEcdsaSignature *aSignature)
@@ -327,6 +327,35 @@ public:
             return otPlatCryptoEcdsaVerify(this, &aHash, &aSignature);
         }
 
+        /**
+         * Pointer to callback function used to report the result of an asynchronous verification.
+         */
+        typedef otPlatCryptoEcdsaVerifyCallback VerifyCallback;
+
+        /**
+         * Uses the `PublicKey` to verify the ECDSA signature of a hashed message, asynchronously.
+         *
+         * When this method returns `kErrorNone`, @p aCallback is invoked exactly once with the verification result.
+         * The callback may be invoked before this method returns (the default platform implementation verifies
+         * synchronously); platforms with an asynchronous crypto accelerator can defer it.
+         *
+         * @param[in] aHash                The SHA-256 hash value of a message to use for signature verification.
+         * @param[in] aSignature           The signature value to verify.
+         * @param[in] aCallback            A callback function to report the verification result.
+         * @param[in] aContext             A pointer to arbitrary context information used with @p aCallback.
+         *
+         * @retval kErrorNone          The verification was started (@p aCallback reports the result).
+         * @retval kErrorInvalidArgs   The key or hash is invalid.
+         * @retval kErrorNoBufs        Failed to allocate buffer for signature verification
+         */
+        Error VerifyAsync(const Sha256::Hash &aHash,
+                          const Signature    &aSignature,
+                          VerifyCallback      aCallback,
+                          void               *aContext) const
+        {
+            return otPlatCryptoEcdsaVerifyAsync(this, &aHash, &aSignature, aCallback, aContext);
+        }
+
     } OT_TOOL_PACKED_END;
 };
 
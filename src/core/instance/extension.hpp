@@ -99,6 +99,11 @@ public:
      */
     void HandleNotifierEvents(Events aEvents);
 
+    /**
+     * The set of events the extension subscribes to (all events, since vendor code may handle any of them).
+     */
+    static constexpr Events::Flags kNotifierEvents = 0xffffffff;
+
 protected:
     /**
      * Initializes the object.
@@ -90,6 +90,9 @@ Instance::Instance(void)
 #if OPENTHREAD_CONFIG_OTNS_ENABLE
     , mOtns(*this)
 #endif
+#if OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
+    , mInstrumentation(*this)
+#endif
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     , mNotifier(*this)
     , mTimeTicker(*this)
@@ -264,9 +267,15 @@ Instance::Instance(void)
     (OPENTHREAD_FTD || OPENTHREAD_CONFIG_CHANNEL_MANAGER_CSL_CHANNEL_SELECT_ENABLE)
     , mChannelManager(*this)
 #endif
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+    , mCounterRegistry(*this)
+#endif
 #if OPENTHREAD_CONFIG_MESH_DIAG_ENABLE && OPENTHREAD_FTD
     , mMeshDiag(*this)
 #endif
+#if OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE
+    , mTelemetryEmitter(*this)
+#endif
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
     , mHistoryTrackerLocal(*this)
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_SERVER_ENABLE
@@ -581,7 +590,12 @@ void Instance::GetBufferInfo(BufferInfo &aInfo)
 #endif
 }
 
-void Instance::ResetBufferInfo(void) { Get<MessagePool>().ResetMaxUsedBufferCount(); }
+void Instance::ResetBufferInfo(void)
+{
+    Get<MessagePool>().ResetMaxUsedBufferCount();
+    Get<MeshForwarder>().ResetSendQueueWatermark();
+    Get<Ip6::Ip6>().ResetSendQueueWatermark();
+}
 
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 
@@ -68,6 +68,7 @@
 #include "instance/extension.hpp"
 #include "mac/link_raw.hpp"
 #include "radio/radio.hpp"
+#include "utils/instrumentation.hpp"
 #include "utils/otns.hpp"
 #include "utils/power_calibration.hpp"
 #include "utils/static_counter.hpp"
@@ -150,6 +151,7 @@
 #include "thread/vendor_info.hpp"
 #include "utils/channel_manager.hpp"
 #include "utils/channel_monitor.hpp"
+#include "utils/counter_registry.hpp"
 #include "utils/heap.hpp"
 #include "utils/history_tracker.hpp"
 #include "utils/history_tracker_client.hpp"
@@ -159,6 +161,7 @@
 #include "utils/mesh_diag.hpp"
 #include "utils/ping_sender.hpp"
 #include "utils/srp_client_buffers.hpp"
+#include "utils/telemetry_emitter.hpp"
 #endif // OPENTHREAD_FTD || OPENTHREAD_MTD
 
 /**
@@ -600,6 +603,10 @@ private:
     Utils::Otns mOtns;
 #endif
 
+#if OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
+    Utils::Instrumentation mInstrumentation;
+#endif
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     // Notifier, TimeTicker, Settings, and MessagePool are initialized
     // before other member variables since other classes/objects from
@@ -826,10 +833,18 @@ private:
     Utils::ChannelManager mChannelManager;
 #endif
 
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+    Utils::CounterRegistry mCounterRegistry;
+#endif
+
 #if OPENTHREAD_CONFIG_MESH_DIAG_ENABLE && OPENTHREAD_FTD
     Utils::MeshDiag mMeshDiag;
 #endif
 
+#if OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE
+    Utils::TelemetryEmitter mTelemetryEmitter;
+#endif
+
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
     HistoryTracker::Local mHistoryTrackerLocal;
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_SERVER_ENABLE
@@ -932,6 +947,10 @@ template <> inline UptimeTracker &Instance::Get(void) { return mUptimeTracker; }
 template <> inline Utils::Otns &Instance::Get(void) { return mOtns; }
 #endif
 
+#if OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
+template <> inline Utils::Instrumentation &Instance::Get(void) { return mInstrumentation; }
+#endif
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
 template <> inline Notifier &Instance::Get(void) { return mNotifier; }
 
@@ -1171,10 +1190,18 @@ template <> inline Utils::ChannelMonitor &Instance::Get(void) { return mChannelM
 template <> inline Utils::ChannelManager &Instance::Get(void) { return mChannelManager; }
 #endif
 
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+template <> inline Utils::CounterRegistry &Instance::Get(void) { return mCounterRegistry; }
+#endif
+
 #if OPENTHREAD_CONFIG_MESH_DIAG_ENABLE && OPENTHREAD_FTD
 template <> inline Utils::MeshDiag &Instance::Get(void) { return mMeshDiag; }
 #endif
 
+#if OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE
+template <> inline Utils::TelemetryEmitter &Instance::Get(void) { return mTelemetryEmitter; }
+#endif
+
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
 
 template <> inline HistoryTracker::Local &Instance::Get(void) { return mHistoryTrackerLocal; }
@@ -43,6 +43,11 @@ DataPollSender::DataPollSender(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mTimerStartTime(0)
     , mPollPeriod(0)
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLLING_ENABLE
+    , mAdaptivePollPeriod(0)
+    , mTotalPollCount(0)
+    , mPollsWithDataCount(0)
+#endif
     , mExternalPollPeriod(0)
     , mFastPollsUsers(0)
     , mTimer(aInstance)
@@ -85,6 +90,9 @@ void DataPollSender::StopPolling(void)
     mRemainingFastPolls   = 0;
     mFastPollsUsers       = 0;
     mEnabled              = false;
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLLING_ENABLE
+    mAdaptivePollPeriod = 0;
+#endif
 }
 
 Error DataPollSender::SendDataPoll(void)
@@ -215,6 +223,27 @@ void DataPollSender::HandlePollSent(Mac::TxFrame &aFrame, Error aError)
     {
     case kErrorNone:
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLLING_ENABLE
+        mTotalPollCount++;
+
+        if (mAdaptivePollPeriod != 0)
+        {
+            // Decay the adaptive fast poll period: every sent poll
+            // doubles it until it reaches the configured period.
+            // Receiving a data frame (`ProcessRxFrame()`) snaps it
+            // back to the fast period, so only quiet polls decay.
+
+            mAdaptivePollPeriod *= 2;
+
+            if (mAdaptivePollPeriod >= GetDefaultPollPeriod())
+            {
+                mAdaptivePollPeriod = 0;
+            }
+
+            shouldRecalculatePollPeriod = true;
+        }
+#endif
+
         if (mRemainingFastPolls != 0)
         {
             mRemainingFastPolls--;
@@ -310,6 +339,23 @@ void DataPollSender::ProcessRxFrame(const Mac::RxFrame &aFrame)
 
     mPollTimeoutCounter = 0;
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLLING_ENABLE
+    if (aFrame.GetType() == Mac::Frame::kTypeData)
+    {
+        mPollsWithDataCount++;
+
+        if (mAdaptivePollPeriod != kFastPollPeriod)
+        {
+            // Downlink activity observed: switch to fast polling to
+            // drain a possible burst with low latency. The period
+            // decays back in `HandlePollSent()`.
+
+            mAdaptivePollPeriod = kFastPollPeriod;
+            ScheduleNextPoll(kRecalculatePollPeriod);
+        }
+    }
+#endif
+
     if (aFrame.GetFramePending())
     {
         IgnoreError(SendDataPoll());
@@ -501,6 +547,13 @@ uint32_t DataPollSender::CalculatePollPeriod(void) const
         period = Min(period, kFastPollPeriod);
     }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLLING_ENABLE
+    if (mAdaptivePollPeriod != 0)
+    {
+        period = Min(period, mAdaptivePollPeriod);
+    }
+#endif
+
     if (mExternalPollPeriod != 0)
     {
         period = Min(period, mExternalPollPeriod);
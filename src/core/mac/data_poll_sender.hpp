@@ -236,6 +236,25 @@ public:
      */
     Mac::TxFrame *PrepareDataRequest(Mac::TxFrames &aTxFrames);
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLLING_ENABLE
+    /**
+     * Returns the total number of successfully transmitted data polls.
+     *
+     * @returns The total number of transmitted data polls.
+     */
+    uint32_t GetTotalPollCount(void) const { return mTotalPollCount; }
+
+    /**
+     * Returns the number of data polls that were answered with a data frame from the parent.
+     *
+     * The ratio of this counter to `GetTotalPollCount()` gives the poll efficiency (share of polls that carried
+     * data), which quantifies the battery cost of empty polls.
+     *
+     * @returns The number of data polls answered with data.
+     */
+    uint32_t GetPollsWithDataCount(void) const { return mPollsWithDataCount; }
+#endif
+
 private:
     static constexpr uint8_t kQuickPollsAfterTimeout = 5; // Quick data poll tx in case of back-to-back poll timeouts.
     static constexpr uint8_t kMaxPollRetxAttempts    = OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS;
@@ -268,6 +287,11 @@ private:
 
     TimeMilli mTimerStartTime;
     uint32_t  mPollPeriod;
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLLING_ENABLE
+    uint32_t mAdaptivePollPeriod; // Current adaptive fast poll period, zero when not in adaptive fast polling.
+    uint32_t mTotalPollCount;
+    uint32_t mPollsWithDataCount;
+#endif
     uint32_t  mExternalPollPeriod : 26; // In milliseconds.
     uint8_t   mFastPollsUsers : 6;      // Number of callers which request fast polls.
 
@@ -908,7 +908,12 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
     VerifyOrExit(!aFrame.IsCslIePresent());
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    mTxFrameAesCcm.SetKeyCached(aFrame.GetAesKey());
+    aFrame.ProcessTransmitAesCcm(*extAddress, mTxFrameAesCcm);
+#else
     aFrame.ProcessTransmitAesCcm(*extAddress);
+#endif
 
 exit:
     return;
@@ -990,7 +995,7 @@ void Mac::BeginTransmit(void)
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     case kOperationTransmitDataCsl:
         txFrames.SetMaxCsmaBackoffs(kMaxCsmaBackoffsCsl);
-        txFrames.SetMaxFrameRetries(kMaxFrameRetriesCsl);
+        txFrames.SetMaxFrameRetries(DetermineMaxFrameRetriesCsl());
         frame = Get<CslTxScheduler>().HandleFrameRequest(txFrames);
         VerifyOrExit(frame != nullptr);
 
@@ -1624,7 +1629,12 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    mRxFrameAesCcm.SetKeyCached(*macKey);
+    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, mRxFrameAesCcm));
+#else
     SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+#endif
 
     if ((keyIdMode == Frame::kKeyIdMode1) && aNeighbor->IsStateValid())
     {
@@ -1747,7 +1757,12 @@ Error Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
         VerifyOrExit(frameCounter >= neighbor->GetLinkAckFrameCounter());
     }
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    mRxFrameAesCcm.SetKeyCached(*macKey);
+    error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), mRxFrameAesCcm);
+#else
     error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey);
+#endif
     SuccessOrExit(error);
 
     if (neighbor->IsStateValid())
@@ -2521,6 +2536,25 @@ void Mac::ProcessCsl(const RxFrame &aFrame, const Address &aSrcAddr)
 exit:
     return;
 }
+
+uint8_t Mac::DetermineMaxFrameRetriesCsl(void) const
+{
+    // CSL frames are normally requested with no retries, since the CSL
+    // IE content becomes stale between transmit attempts. When the
+    // radio handles the retry loop itself and can refresh
+    // time-dependent header IEs on each attempt, the retries can be
+    // offloaded, avoiding a full host round trip per attempt.
+
+    uint8_t     maxRetries = kMaxFrameRetriesCsl;
+    otRadioCaps caps       = mLinks.GetSubMac().GetRadioCaps();
+
+    if ((caps & OT_RADIO_CAPS_TRANSMIT_RETRIES) && (caps & OT_RADIO_CAPS_RETX_IE_UPDATE))
+    {
+        maxRetries = kMaxFrameRetriesCslOffload;
+    }
+
+    return maxRetries;
+}
 #endif // OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
 
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_INITIATOR_ENABLE
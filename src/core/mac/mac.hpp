@@ -46,6 +46,9 @@
 #include "common/tasklet.hpp"
 #include "common/time.hpp"
 #include "common/timer.hpp"
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+#include "crypto/aes_ccm.hpp"
+#endif
 #include "mac/channel_mask.hpp"
 #include "mac/mac_filter.hpp"
 #include "mac/mac_frame.hpp"
@@ -85,6 +88,7 @@ constexpr uint8_t kMaxCsmaBackoffsCsl      = 0;
 constexpr uint8_t kDefaultMaxFrameRetriesDirect   = OPENTHREAD_CONFIG_MAC_DEFAULT_MAX_FRAME_RETRIES_DIRECT;
 constexpr uint8_t kDefaultMaxFrameRetriesIndirect = OPENTHREAD_CONFIG_MAC_DEFAULT_MAX_FRAME_RETRIES_INDIRECT;
 constexpr uint8_t kMaxFrameRetriesCsl             = 0;
+constexpr uint8_t kMaxFrameRetriesCslOffload      = OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_CSL_OFFLOAD;
 
 constexpr uint8_t kTxNumBcast = OPENTHREAD_CONFIG_MAC_TX_NUM_BCAST; ///< Num of times broadcast frame is tx.
 
@@ -858,7 +862,8 @@ private:
 #endif
 
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    void ProcessCsl(const RxFrame &aFrame, const Address &aSrcAddr);
+    void    ProcessCsl(const RxFrame &aFrame, const Address &aSrcAddr);
+    uint8_t DetermineMaxFrameRetriesCsl(void) const;
 #endif
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
     void UpdateCslParameters(void);
@@ -949,6 +954,13 @@ private:
     Filter mFilter;
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    // Persistent AES-CCM contexts (for tx and rx separately) caching
+    // the derived AES key schedule across frames using the same key.
+    Crypto::AesCcm mTxFrameAesCcm;
+    Crypto::AesCcm mRxFrameAesCcm;
+#endif
+
     KeyMaterial mMode2KeyMaterial;
 };
 
@@ -621,8 +621,15 @@ exit:
 
 uint8_t Frame::FindSrcAddrIndex(void) const
 {
-    uint16_t fcf   = GetFrameControlField();
-    uint8_t  index = SkipSequenceIndex();
+    uint16_t fcf = GetFrameControlField();
+    uint8_t  index;
+
+    if (IsCommonShapeFcf(fcf))
+    {
+        ExitNow(index = kCommonShapeSrcAddrIndex);
+    }
+
+    index = SkipSequenceIndex();
 
     if (IsDstPanIdPresent(fcf))
     {
@@ -645,6 +652,7 @@ uint8_t Frame::FindSrcAddrIndex(void) const
         index += sizeof(PanId);
     }
 
+exit:
     return index;
 }
 
@@ -980,6 +988,13 @@ uint8_t Frame::CalculateSecurityHeaderSize(uint8_t aSecurityControl)
 {
     uint8_t size;
 
+    if (aSecurityControl == kCommonShapeSecurityControl)
+    {
+        // ENC-MIC-32 with Key ID Mode 1 (the security control used on
+        // almost all frames) has a fixed, pre-computed header size.
+        ExitNow(size = kCommonShapeSecurityHeaderSize);
+    }
+
     VerifyOrExit((aSecurityControl & kSecLevelMask) != kSecurityNone, size = kInvalidSize);
 
     size = kSecurityControlSize + kFrameCounterSize + CalculateKeySourceSize(aSecurityControl);
@@ -1016,6 +1031,13 @@ uint8_t Frame::CalculateAddrFieldSize(uint16_t aFcf)
     // Addresses. If the `aFcf` is not valid, this method returns
     // `kInvalidSize`.
 
+    if (IsCommonShapeFcf(aFcf))
+    {
+        // For the common frame shape the full size is known at compile
+        // time, skipping the PAN ID presence checks below.
+        ExitNow(size = kCommonShapeAddrFieldSize);
+    }
+
     if (IsDstPanIdPresent(aFcf))
     {
         size += sizeof(PanId);
@@ -1374,26 +1396,41 @@ void TxFrame::CopyFrom(const TxFrame &aFromFrame)
 void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress)
 {
 #if OPENTHREAD_FTD || OPENTHREAD_MTD || OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
-    uint32_t       frameCounter = 0;
-    uint8_t        securityLevel;
-    uint8_t        nonce[Crypto::AesCcm::kNonceSize];
-    uint8_t        tagLength;
     Crypto::AesCcm aesCcm;
 
     VerifyOrExit(GetSecurityEnabled());
 
+    aesCcm.SetKey(GetAesKey());
+    ProcessTransmitAesCcm(aExtAddress, aesCcm);
+
+exit:
+    return;
+#else
+    OT_UNUSED_VARIABLE(aExtAddress);
+#endif // OPENTHREAD_FTD || OPENTHREAD_MTD || OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
+}
+
+void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm)
+{
+#if OPENTHREAD_FTD || OPENTHREAD_MTD || OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
+    uint32_t frameCounter = 0;
+    uint8_t  securityLevel;
+    uint8_t  nonce[Crypto::AesCcm::kNonceSize];
+    uint8_t  tagLength;
+
+    VerifyOrExit(GetSecurityEnabled());
+
     SuccessOrExit(GetSecurityLevel(securityLevel));
     SuccessOrExit(GetFrameCounter(frameCounter));
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(GetAesKey());
     tagLength = GetFooterLength() - GetFcsSize();
 
-    aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
-    aesCcm.Header(GetHeader(), GetHeaderLength());
-    aesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kEncrypt);
-    aesCcm.Finalize(GetFooter());
+    aAesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
+    aAesCcm.Header(GetHeader(), GetHeaderLength());
+    aAesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kEncrypt);
+    aAesCcm.Finalize(GetFooter());
 
     SetIsSecurityProcessed(true);
 
@@ -1401,6 +1438,7 @@ exit:
     return;
 #else
     OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aAesCcm);
 #endif // OPENTHREAD_FTD || OPENTHREAD_MTD || OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
 }
 
@@ -1563,6 +1601,27 @@ exit:
 
 Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey)
 {
+#if OPENTHREAD_FTD || OPENTHREAD_MTD
+    Error          error = kErrorNone;
+    Crypto::AesCcm aesCcm;
+
+    VerifyOrExit(GetSecurityEnabled());
+
+    aesCcm.SetKey(aMacKey);
+    error = ProcessReceiveAesCcm(aExtAddress, aesCcm);
+
+exit:
+    return error;
+#else
+    OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aMacKey);
+
+    return kErrorNone;
+#endif // OPENTHREAD_FTD || OPENTHREAD_MTD
+}
+
+Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm)
+{
 #if OPENTHREAD_FTD || OPENTHREAD_MTD
     Error          error        = kErrorSecurity;
     uint32_t       frameCounter = 0;
@@ -1570,7 +1629,6 @@ Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMate
     uint8_t        nonce[Crypto::AesCcm::kNonceSize];
     uint8_t        tag[kMaxMicSize];
     uint8_t        tagLength;
-    Crypto::AesCcm aesCcm;
 
     VerifyOrExit(GetSecurityEnabled(), error = kErrorNone);
 
@@ -1579,18 +1637,17 @@ Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMate
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(aMacKey);
     tagLength = GetFooterLength() - GetFcsSize();
 
-    aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
-    aesCcm.Header(GetHeader(), GetHeaderLength());
+    aAesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
+    aAesCcm.Header(GetHeader(), GetHeaderLength());
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-    aesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
+    aAesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
 #else
     // For fuzz tests, execute AES but do not alter the payload. A large
-    aesCcm.Payload(nullptr, GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
+    aAesCcm.Payload(nullptr, GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
 #endif
-    aesCcm.Finalize(tag);
+    aAesCcm.Finalize(tag);
 
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
     VerifyOrExit(memcmp(tag, GetFooter(), tagLength) == 0);
@@ -1602,7 +1659,7 @@ exit:
     return error;
 #else
     OT_UNUSED_VARIABLE(aExtAddress);
-    OT_UNUSED_VARIABLE(aMacKey);
+    OT_UNUSED_VARIABLE(aAesCcm);
 
     return kErrorNone;
 #endif // OPENTHREAD_FTD || OPENTHREAD_MTD
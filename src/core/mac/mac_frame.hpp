@@ -45,6 +45,11 @@
 #include "meshcop/network_name.hpp"
 
 namespace ot {
+
+namespace Crypto {
+class AesCcm;
+}
+
 namespace Mac {
 
 /**
@@ -848,6 +853,29 @@ protected:
     static constexpr uint8_t kKeySourceSizeMode2 = 4;
     static constexpr uint8_t kKeySourceSizeMode3 = 8;
 
+    // The frame shape seen for nearly all frames exchanged on a Thread
+    // mesh: a data frame using the 2006 frame version, carrying the
+    // destination PAN ID with short destination and source addresses
+    // and PAN ID compression, and secured with ENC-MIC-32 using Key ID
+    // Mode 1. `kCommonShapeFcfMask` covers every FCF bit that
+    // influences the header layout (frame type, security enabled, PAN
+    // ID compression, sequence suppression, IE present, address modes,
+    // and frame version), so an FCF matching `kCommonShapeFcf` under
+    // this mask allows field offsets and sizes to be read from the
+    // pre-computed `constexpr` values below instead of walking the
+    // header byte by byte.
+    static constexpr uint16_t kCommonShapeFcfMask = kFcfFrameTypeMask | kFcfSecurityEnabled | kFcfPanidCompression |
+                                                    kFcfSequenceSuppression | kFcfIePresent | kFcfDstAddrMask |
+                                                    kFcfFrameVersionMask | kFcfSrcAddrMask;
+    static constexpr uint16_t kCommonShapeFcf =
+        kTypeData | kFcfSecurityEnabled | kFcfPanidCompression | kFcfDstAddrShort | kVersion2006 | kFcfSrcAddrShort;
+    static constexpr uint8_t kCommonShapeSecurityControl = kSecurityEncMic32 | kKeyIdMode1;
+    static constexpr uint8_t kCommonShapeSrcAddrIndex    = kFcfSize + kDsnSize + sizeof(PanId) + sizeof(ShortAddress);
+    static constexpr uint8_t kCommonShapeAddrFieldSize =
+        kFcfSize + kDsnSize + sizeof(PanId) + 2 * sizeof(ShortAddress);
+    static constexpr uint8_t kCommonShapeSecurityHeaderSize =
+        kSecurityControlSize + kFrameCounterSize + kKeySourceSizeMode1 + kKeyIndexSize;
+
     static constexpr uint8_t kInvalidIndex = 0xff;
     static constexpr uint8_t kInvalidSize  = kInvalidIndex;
     static constexpr uint8_t kMaxPsduSize  = kInvalidSize - 1;
@@ -866,6 +894,8 @@ protected:
     uint8_t FindHeaderIeIndex(void) const;
 #endif
 
+    static bool IsCommonShapeFcf(uint16_t aFcf) { return (aFcf & kCommonShapeFcfMask) == kCommonShapeFcf; }
+
 #if OPENTHREAD_CONFIG_MAC_MULTIPURPOSE_FRAME
     static uint8_t GetFcfSize(uint16_t aFcf) { return IsShortFcf(aFcf) ? kShortFcfSize : kFcfSize; }
 #else
@@ -998,6 +1028,21 @@ public:
      */
     Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey);
 
+    /**
+     * Performs AES CCM on the frame which is received, using a caller-provided AES CCM context.
+     *
+     * The key MUST already be set on @p aAesCcm (e.g., using `Crypto::AesCcm::SetKeyCached()`), which allows a
+     * persistent context to reuse its derived AES key schedule across frames secured with the same key.
+     *
+     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
+     *                          for AES CCM computation.
+     * @param[in]  aAesCcm      The AES CCM context to use, with the key already set.
+     *
+     * @retval kErrorNone      Process of received frame AES CCM succeeded.
+     * @retval kErrorSecurity  Received frame MIC check failed.
+     */
+    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm);
+
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     /**
      * Gets the offset to network time.
@@ -1216,6 +1261,18 @@ public:
      */
     void ProcessTransmitAesCcm(const ExtAddress &aExtAddress);
 
+    /**
+     * Performs AES CCM on the frame which is going to be sent, using a caller-provided AES CCM context.
+     *
+     * The key MUST already be set on @p aAesCcm (e.g., using `Crypto::AesCcm::SetKeyCached()`), which allows a
+     * persistent context to reuse its derived AES key schedule across frames secured with the same key.
+     *
+     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
+     *                          for AES CCM computation.
+     * @param[in]  aAesCcm      The AES CCM context to use, with the key already set.
+     */
+    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm);
+
     /**
      * Indicates whether or not the frame has security processed.
      *
@@ -93,6 +93,13 @@ void SubMac::Init(void)
     mKeyId        = 0;
     mTimer.Stop();
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+    for (SuccessRateTracker &tracker : mCcaFailRateTrackers)
+    {
+        tracker.Clear();
+    }
+#endif
+
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
     CslInit();
 #endif
@@ -412,7 +419,12 @@ void SubMac::ProcessTransmitSecurity(void)
     VerifyOrExit(mTransmitFrame.GetTimeIeOffset() == 0);
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    mTxFrameAesCcm.SetKeyCached(mTransmitFrame.GetAesKey());
+    mTransmitFrame.ProcessTransmitAesCcm(*extAddress, mTxFrameAesCcm);
+#else
     mTransmitFrame.ProcessTransmitAesCcm(*extAddress);
+#endif
 
 exit:
     return;
@@ -420,7 +432,11 @@ exit:
 
 void SubMac::StartCsmaBackoff(void)
 {
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+    uint8_t backoffExponent = GetCsmaMinBe(mTransmitFrame.GetChannel()) + mCsmaBackoffs;
+#else
     uint8_t backoffExponent = kCsmaMinBe + mCsmaBackoffs;
+#endif
 
 #if !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     if (mTransmitFrame.mInfo.mTxInfo.mTxDelay != 0 || mTransmitFrame.mInfo.mTxInfo.mTxDelayBaseTime != 0)
@@ -457,7 +473,11 @@ void SubMac::StartCsmaBackoff(void)
 
     VerifyOrExit(mTransmitFrame.GetMaxCsmaBackoffs() > 0 && ShouldHandleCsmaBackOff(), BeginTransmit());
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+    backoffExponent = Min(backoffExponent, GetCsmaMaxBe(mTransmitFrame.GetChannel()));
+#else
     backoffExponent = Min(backoffExponent, kCsmaMaxBe);
+#endif
 
     StartTimerForBackoff(backoffExponent);
 
@@ -566,6 +586,9 @@ void SubMac::HandleTransmitDone(TxFrame &aFrame, RxFrame *aAckFrame, Error aErro
         if (aFrame.IsCsmaCaEnabled())
         {
             mCallbacks.RecordCcaStatus(ccaSuccess, aFrame.GetChannel());
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+            UpdateAdaptiveCca(ccaSuccess, aFrame.GetChannel());
+#endif
         }
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
         UpdateCslLastSyncTimestamp(aFrame, aAckFrame);
@@ -828,6 +851,78 @@ exit:
     return swTxSecurity;
 }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+
+uint8_t SubMac::GetCsmaMinBe(uint8_t aChannel) const
+{
+    uint8_t  minBe = kCsmaMinBe;
+    uint16_t failRate;
+
+    VerifyOrExit((Radio::kChannelMin <= aChannel) && (aChannel <= Radio::kChannelMax));
+
+    failRate = mCcaFailRateTrackers[aChannel - Radio::kChannelMin].GetFailureRate();
+
+    if (failRate >= kAdaptiveCcaHighFailRate)
+    {
+        minBe = kCsmaMinBe + 2;
+    }
+    else if (failRate >= kAdaptiveCcaMedFailRate)
+    {
+        minBe = kCsmaMinBe + 1;
+    }
+
+exit:
+    return minBe;
+}
+
+uint8_t SubMac::GetCsmaMaxBe(uint8_t aChannel) const
+{
+    uint8_t  maxBe = kCsmaMaxBe;
+    uint16_t failRate;
+
+    VerifyOrExit((Radio::kChannelMin <= aChannel) && (aChannel <= Radio::kChannelMax));
+
+    failRate = mCcaFailRateTrackers[aChannel - Radio::kChannelMin].GetFailureRate();
+
+    if (failRate >= kAdaptiveCcaHighFailRate)
+    {
+        maxBe = Min(static_cast<uint8_t>(kCsmaMaxBe + 3), kCsmaMaxBeUpperBound);
+    }
+    else if (failRate >= kAdaptiveCcaMedFailRate)
+    {
+        maxBe = Min(static_cast<uint8_t>(kCsmaMaxBe + 2), kCsmaMaxBeUpperBound);
+    }
+
+exit:
+    return maxBe;
+}
+
+void SubMac::UpdateAdaptiveCca(bool aCcaSuccess, uint8_t aChannel)
+{
+    VerifyOrExit((Radio::kChannelMin <= aChannel) && (aChannel <= Radio::kChannelMax));
+
+    mCcaFailRateTrackers[aChannel - Radio::kChannelMin].AddSample(aCcaSuccess);
+
+exit:
+    return;
+}
+
+Error SubMac::GetAdaptiveCcaState(uint8_t aChannel, otLinkAdaptiveCcaState &aState) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit((Radio::kChannelMin <= aChannel) && (aChannel <= Radio::kChannelMax), error = kErrorInvalidArgs);
+
+    aState.mCsmaMinBe      = GetCsmaMinBe(aChannel);
+    aState.mCsmaMaxBe      = GetCsmaMaxBe(aChannel);
+    aState.mCcaFailureRate = mCcaFailRateTrackers[aChannel - Radio::kChannelMin].GetFailureRate();
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+
 bool SubMac::ShouldHandleCsmaBackOff(void) const
 {
     bool swCsma = true;
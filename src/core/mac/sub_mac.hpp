@@ -46,6 +46,12 @@
 #include "common/timer.hpp"
 #include "mac/mac_frame.hpp"
 #include "radio/radio.hpp"
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+#include "thread/link_quality.hpp"
+#endif
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+#include "crypto/aes_ccm.hpp"
+#endif
 
 namespace ot {
 
@@ -211,6 +217,19 @@ public:
      */
     otRadioCaps GetCaps(void) const;
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+    /**
+     * Gets the adaptive CCA backoff state for a given channel.
+     *
+     * @param[in]   aChannel   The radio channel to query.
+     * @param[out]  aState     A reference to an `otLinkAdaptiveCcaState` to populate.
+     *
+     * @retval kErrorNone         Successfully retrieved the adaptive CCA state.
+     * @retval kErrorInvalidArgs  @p aChannel is not a valid radio channel.
+     */
+    Error GetAdaptiveCcaState(uint8_t aChannel, otLinkAdaptiveCcaState &aState) const;
+#endif
+
     /**
      * Sets the PAN ID.
      *
@@ -528,6 +547,12 @@ private:
     static constexpr uint8_t  kCsmaMinBe         = 3;                  // macMinBE (IEEE 802.15.4-2006).
     static constexpr uint8_t  kCsmaMaxBe         = 5;                  // macMaxBE (IEEE 802.15.4-2006).
     static constexpr uint32_t kUnitBackoffPeriod = 20;                 // Number of symbols (IEEE 802.15.4-2006).
+
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+    static constexpr uint8_t  kCsmaMaxBeUpperBound     = 8;      // macMaxBE upper bound (IEEE 802.15.4-2006).
+    static constexpr uint16_t kAdaptiveCcaMedFailRate  = 0x4000; // CCA failure rate of 25% (out of 0xffff).
+    static constexpr uint16_t kAdaptiveCcaHighFailRate = 0x8000; // CCA failure rate of 50% (out of 0xffff).
+#endif
     static constexpr uint32_t kAckTimeout = 16 * Time::kOneMsecInUsec; // Timeout for waiting on an ACK (in usec).
     static constexpr uint32_t kCcaSampleInterval = 128;                // CCA sample interval, 128 usec.
 
@@ -611,6 +636,12 @@ private:
     bool ShouldHandleTransmitTargetTime(void) const;
     bool ShouldHandleTransitionToSleep(void) const;
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+    uint8_t GetCsmaMinBe(uint8_t aChannel) const;
+    uint8_t GetCsmaMaxBe(uint8_t aChannel) const;
+    void    UpdateAdaptiveCca(bool aCcaSuccess, uint8_t aChannel);
+#endif
+
     void ProcessTransmitSecurity(void);
     void SignalFrameCounterUsed(uint32_t aFrameCounter, uint8_t aKeyId);
     void StartCsmaBackoff(void);
@@ -666,8 +697,14 @@ private:
     KeyMaterial                  mNextKey;
     uint32_t                     mFrameCounter;
     uint8_t                      mKeyId;
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    Crypto::AesCcm mTxFrameAesCcm; // Caches the derived AES key schedule across frames using the same key.
+#endif
 #if OPENTHREAD_CONFIG_MAC_ADD_DELAY_ON_NO_ACK_ERROR_BEFORE_RETRY
     uint8_t mRetxDelayBackOffExponent;
+#endif
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CCA_BACKOFF_ENABLE
+    SuccessRateTracker mCcaFailRateTrackers[Radio::kChannelMax - Radio::kChannelMin + 1];
 #endif
     SubMacTimer mTimer;
 
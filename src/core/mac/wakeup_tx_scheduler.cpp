@@ -45,6 +45,8 @@ WakeupTxScheduler::WakeupTxScheduler(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mTxTimeUs(0)
     , mTxEndTimeUs(0)
+    , mTargetCount(0)
+    , mTargetIndex(0)
     , mTimer(aInstance)
     , mIsRunning(false)
 {
@@ -59,11 +61,16 @@ Error WakeupTxScheduler::WakeUp(const Mac::WakeupRequest &aWakeupRequest, uint16
     // TODO: Add support for wake-up identifiers.
     VerifyOrExit(aWakeupRequest.IsWakeupByExtAddress(), error = kErrorInvalidState);
 
-    mWakeupRequest = aWakeupRequest;
-    mTxTimeUs      = TimerMicro::GetNow() + mTxRequestAheadTimeUs;
-    mTxEndTimeUs   = mTxTimeUs + aDurationMs * Time::kOneMsecInUsec + aIntervalUs;
-    mIntervalUs    = aIntervalUs;
-    mIsRunning     = true;
+    mWakeupRequests[0] = aWakeupRequest;
+    mTargetCount       = 1;
+    mTargetIndex       = 0;
+    mTxTimeUs          = TimerMicro::GetNow() + mTxRequestAheadTimeUs;
+    mTxEndTimeUs       = mTxTimeUs + aDurationMs * Time::kOneMsecInUsec + aIntervalUs;
+    mIntervalUs        = aIntervalUs;
+#if OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MULTI_TARGET_ENABLE
+    mDurationMs = aDurationMs;
+#endif
+    mIsRunning = true;
 
     LogInfo("Started wake-up sequence to %s", aWakeupRequest.GetExtAddress().ToString().AsCString());
 
@@ -73,6 +80,34 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MULTI_TARGET_ENABLE
+Error WakeupTxScheduler::AddTarget(const Mac::WakeupRequest &aWakeupRequest)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(mIsRunning, error = kErrorInvalidState);
+    VerifyOrExit(aWakeupRequest.IsWakeupByExtAddress(), error = kErrorInvalidState);
+    VerifyOrExit(mTargetCount < kMaxWakeupTargets, error = kErrorNoBufs);
+
+    for (uint8_t i = 0; i < mTargetCount; i++)
+    {
+        VerifyOrExit(mWakeupRequests[i].GetExtAddress() != aWakeupRequest.GetExtAddress(), error = kErrorAlready);
+    }
+
+    mWakeupRequests[mTargetCount++] = aWakeupRequest;
+
+    // Extend the sequence so that the new target observes wake-up frames for the full wake-up duration.
+    mTxEndTimeUs = Max(mTxEndTimeUs, TimerMicro::GetNow() + mTxRequestAheadTimeUs +
+                                         mDurationMs * Time::kOneMsecInUsec + mIntervalUs);
+
+    LogInfo("Added %s to wake-up sequence (%u targets)", aWakeupRequest.GetExtAddress().ToString().AsCString(),
+            mTargetCount);
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MULTI_TARGET_ENABLE
+
 void WakeupTxScheduler::RequestWakeupFrameTransmission(void) { Get<Mac::Mac>().RequestWakeupFrameTransmission(); }
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
@@ -98,7 +133,8 @@ Mac::TxFrame *WakeupTxScheduler::PrepareWakeupFrame(Mac::TxFrames &aTxFrames)
     frame = &aTxFrames.GetTxFrame();
 #endif
 
-    VerifyOrExit(frame->GenerateWakeupFrame(Get<Mac::Mac>().GetPanId(), mWakeupRequest, source) == kErrorNone,
+    VerifyOrExit(frame->GenerateWakeupFrame(Get<Mac::Mac>().GetPanId(), mWakeupRequests[mTargetIndex], source) ==
+                     kErrorNone,
                  frame = nullptr);
     frame->SetTxDelayBaseTime(static_cast<uint32_t>(Get<Radio>().GetNow()));
     frame->SetTxDelay(radioTxDelay);
@@ -118,8 +154,10 @@ Mac::TxFrame *WakeupTxScheduler::PrepareWakeupFrame(Mac::TxFrames &aTxFrames)
     connectionIe->SetRetryInterval(kConnectionRetryInterval);
     connectionIe->SetRetryCount(kConnectionRetryCount);
 
-    // Advance to the time of the next wake-up frame.
-    mTxTimeUs = Max(mTxTimeUs + mIntervalUs, TimerMicro::GetNow() + mTxRequestAheadTimeUs);
+    // Advance to the time of the next wake-up frame. With multiple targets, each wake-up interval is divided into
+    // equal sub-slots (one target per sub-slot), so consecutive frames to the same target remain `mIntervalUs` apart.
+    mTargetIndex = static_cast<uint8_t>((mTargetIndex + 1) % mTargetCount);
+    mTxTimeUs    = Max(mTxTimeUs + mIntervalUs / mTargetCount, TimerMicro::GetNow() + mTxRequestAheadTimeUs);
 
     // Schedule the next timer right away before waiting for the transmission completion
     // to keep up with the high rate of wake-up frames in the RCP architecture.
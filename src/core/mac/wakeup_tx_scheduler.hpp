@@ -69,6 +69,25 @@ public:
      */
     Error WakeUp(const Mac::WakeupRequest &aWakeupRequest, uint16_t aIntervalUs, uint16_t aDurationMs);
 
+#if OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MULTI_TARGET_ENABLE
+    /**
+     * Adds another Wake-up End Device target to the ongoing wake-up sequence.
+     *
+     * Wake-up frames for all targets are interleaved within the same sequence window: each wake-up interval is
+     * divided into equal sub-slots, one target per sub-slot, so consecutive wake-up frames to the same target remain
+     * a full wake-up interval apart. The sequence end time is extended so that the new target observes wake-up
+     * frames for the full wake-up duration.
+     *
+     * @param[in] aWakeupRequest  The wake-up request of the target to add.
+     *
+     * @retval kErrorNone         Successfully added the target to the ongoing wake-up sequence.
+     * @retval kErrorInvalidState No wake-up sequence is running, or the wake-up request type is unsupported.
+     * @retval kErrorAlready      The target is already part of the ongoing wake-up sequence.
+     * @retval kErrorNoBufs       The maximum number of targets is already being woken up.
+     */
+    Error AddTarget(const Mac::WakeupRequest &aWakeupRequest);
+#endif
+
     /**
      * Returns the connection window used by this device.
      *
@@ -100,9 +119,9 @@ public:
     void UpdateFrameRequestAhead(void);
 
     /**
-     * Returns the wake-up request.
+     * Returns the wake-up request of the first target.
      */
-    const Mac::WakeupRequest &GetWakeupRequest(void) const { return mWakeupRequest; }
+    const Mac::WakeupRequest &GetWakeupRequest(void) const { return mWakeupRequests[0]; }
 
 private:
     constexpr static uint8_t  kConnectionRetryInterval = OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_CONNECTION_RETRY_INTERVAL;
@@ -110,6 +129,11 @@ private:
     constexpr static uint32_t kWakeupFrameLength       = 54; // Includes SHR
     constexpr static bool     kWakeupFrameTxCca        = OPENTHREAD_CONFIG_WAKEUP_FRAME_TX_CCA_ENABLE;
     constexpr static uint32_t kParentRequestLength     = 78; // Includes SHR
+#if OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MULTI_TARGET_ENABLE
+    constexpr static uint8_t kMaxWakeupTargets = OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MAX_TARGETS;
+#else
+    constexpr static uint8_t kMaxWakeupTargets = 1;
+#endif
 
     // Called by the MAC layer when a wake-up frame transmission is about to be started.
     Mac::TxFrame *PrepareWakeupFrame(Mac::TxFrames &aTxFrames);
@@ -121,13 +145,18 @@ private:
 
     using WakeupTimer = TimerMicroIn<WakeupTxScheduler, &WakeupTxScheduler::RequestWakeupFrameTransmission>;
 
-    Mac::WakeupRequest mWakeupRequest;
-    TimeMicro          mTxTimeUs;             // Point in time when the next TX occurs.
-    TimeMicro          mTxEndTimeUs;          // Point in time when the wake-up sequence is over.
+    Mac::WakeupRequest mWakeupRequests[kMaxWakeupTargets]; // Wake-up targets interleaved within the sequence.
+    TimeMicro          mTxTimeUs;                          // Point in time when the next TX occurs.
+    TimeMicro          mTxEndTimeUs;                       // Point in time when the wake-up sequence is over.
     uint32_t           mTxRequestAheadTimeUs; // How much ahead the TX MAC operation needs to be requested.
-    uint16_t           mIntervalUs;           // Interval between consecutive wake-up frames.
-    WakeupTimer        mTimer;
-    bool               mIsRunning;
+    uint16_t           mIntervalUs;           // Interval between consecutive wake-up frames to the same target.
+#if OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MULTI_TARGET_ENABLE
+    uint16_t mDurationMs; // Wake-up duration, used to extend the sequence for targets added later.
+#endif
+    uint8_t     mTargetCount; // Number of targets in the ongoing wake-up sequence.
+    uint8_t     mTargetIndex; // Index of the target of the next wake-up frame.
+    WakeupTimer mTimer;
+    bool        mIsRunning;
 };
 
 } // namespace ot
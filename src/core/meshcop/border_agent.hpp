@@ -270,9 +270,9 @@ private:
     static constexpr uint8_t  kBaseServiceNameMaxLen = OT_BORDER_AGENT_MESHCOP_SERVICE_BASE_NAME_MAX_LENGTH;
 #endif
 
-    class CoapDtlsSession : public Coap::SecureSession, public Heap::Allocatable<CoapDtlsSession>
+    class CoapDtlsSession : public Coap::SecureSession, public Heap::Allocatable<CoapDtlsSession, Heap::kOwnerMeshCoP>
     {
-        friend Heap::Allocatable<CoapDtlsSession>;
+        friend Heap::Allocatable<CoapDtlsSession, Heap::kOwnerMeshCoP>;
 #if OPENTHREAD_CONFIG_BORDER_AGENT_ADMITTER_ENABLE
         friend class Admitter;
 #endif
@@ -296,7 +296,7 @@ private:
         };
 
         struct ForwardContext : public ot::LinkedListEntry<ForwardContext>,
-                                public Heap::Allocatable<ForwardContext>,
+                                public Heap::Allocatable<ForwardContext, Heap::kOwnerMeshCoP>,
                                 private ot::NonCopyable
         {
             ForwardContext(CoapDtlsSession &aSession, const Coap::Message &aMessage, Uri aUri);
@@ -371,6 +371,8 @@ private:
     void Stop(void);
 
     // Callback from Notifier
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventPskcChanged;
+
     void HandleNotifierEvents(Events aEvents);
 
     template <Uri kUri> void HandleTmf(Coap::Msg &aMsg);
@@ -226,7 +226,7 @@ private:
     //-----------------------------------------------------------------------------------------------------------------
     // Nested Types
 
-    struct Joiner : public InstanceLocator, LinkedListEntry<Joiner>, Heap::Allocatable<Joiner>
+    struct Joiner : public InstanceLocator, LinkedListEntry<Joiner>, Heap::Allocatable<Joiner, Heap::kOwnerMeshCoP>
     {
         // Track information about a Joiner which is accepted by
         // an Enroller.
@@ -247,7 +247,7 @@ private:
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-    struct Enroller : Heap::Allocatable<Enroller>
+    struct Enroller : Heap::Allocatable<Enroller, Heap::kOwnerMeshCoP>
     {
         // Tracks information for a registered enroller. This is
         // included in `CoapDtlsSession` as the member variable
@@ -426,6 +426,8 @@ private:
     void  ForwardUdpProxyToEnrollers(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void  HandleJoinerTimer(void);
     void  HandleEnrollerChange(void);
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged;
+
     void  HandleNotifierEvents(Events aEvents);
 
     static const char *EnrollerUriToString(Uri aUri);
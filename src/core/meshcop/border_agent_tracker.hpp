@@ -156,7 +156,7 @@ private:
         kMatchHostName,
     };
 
-    struct Host : public InstanceLocator, public RetainCountable, public Heap::Allocatable<Host>
+    struct Host : public InstanceLocator, public RetainCountable, public Heap::Allocatable<Host, Heap::kOwnerMeshCoP>
     {
         explicit Host(Instance &aInstance);
         ~Host(void);
@@ -168,7 +168,8 @@ private:
         Heap::Array<Ip6::Address> mAddresses;
     };
 
-    struct Agent : public InstanceLocator, public Heap::Allocatable<Agent>, public LinkedListEntry<Agent>
+    struct Agent : public InstanceLocator, public Heap::Allocatable<Agent, Heap::kOwnerMeshCoP>,
+                   public LinkedListEntry<Agent>
     {
         explicit Agent(Instance &aInstance);
         ~Agent(void);
@@ -362,6 +362,9 @@ private:
 
 #if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE
     // Callback from Notifier
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadExtPanIdChanged |
+        kEventThreadNetworkNameChanged | kEventThreadBackboneRouterStateChanged | kEventActiveDatasetChanged;
+
     void HandleNotifierEvents(Events aEvents);
     // Callbacks from VendorInfo
     void HandleVendorNameChange(void);
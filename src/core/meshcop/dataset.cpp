@@ -33,6 +33,7 @@
 
 #include "dataset.hpp"
 
+#include "common/crc.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -40,6 +41,58 @@ namespace MeshCoP {
 
 RegisterLogModule("Dataset");
 
+//---------------------------------------------------------------------------------------------------------------------
+// TlvDescriptor
+
+// Describes a known Dataset TLV type: its minimum acceptable value
+// length (derived at compile time from the TLV value types) and
+// whether it is required in an Active and/or Pending Dataset. The
+// table below is the single source for format validation and the
+// one-pass required-TLV presence check.
+
+struct TlvDescriptor
+{
+    static constexpr uint8_t kRequiredInActive  = (1 << 0); // TLV is required in an Active Dataset.
+    static constexpr uint8_t kRequiredInPending = (1 << 1); // TLV is required in a Pending Dataset.
+    static constexpr uint8_t kRequiredInBoth    = (kRequiredInActive | kRequiredInPending);
+
+    uint8_t mType;      // The TLV type (`Tlv::Type`).
+    uint8_t mMinLength; // Minimum acceptable TLV value length.
+    uint8_t mFlags;     // Combination of `kRequiredIn{Active,Pending}` flags.
+};
+
+static const TlvDescriptor kTlvDescriptors[] = {
+    {Tlv::kActiveTimestamp, sizeof(ActiveTimestampTlv::ValueType), TlvDescriptor::kRequiredInBoth},
+    {Tlv::kPendingTimestamp, sizeof(PendingTimestampTlv::ValueType), TlvDescriptor::kRequiredInPending},
+    {Tlv::kDelayTimer, sizeof(DelayTimerTlv::UintValueType), TlvDescriptor::kRequiredInPending},
+    {Tlv::kPanId, sizeof(PanIdTlv::UintValueType), TlvDescriptor::kRequiredInBoth},
+    {Tlv::kExtendedPanId, sizeof(ExtendedPanIdTlv::ValueType), TlvDescriptor::kRequiredInBoth},
+    {Tlv::kPskc, sizeof(PskcTlv::ValueType), TlvDescriptor::kRequiredInBoth},
+    {Tlv::kNetworkKey, sizeof(NetworkKeyTlv::ValueType), TlvDescriptor::kRequiredInBoth},
+    {Tlv::kMeshLocalPrefix, sizeof(MeshLocalPrefixTlv::ValueType), TlvDescriptor::kRequiredInBoth},
+    {Tlv::kChannel, sizeof(ChannelTlvValue), TlvDescriptor::kRequiredInBoth},
+    {Tlv::kWakeupChannel, sizeof(ChannelTlvValue), 0},
+    {Tlv::kNetworkName, 0, TlvDescriptor::kRequiredInBoth},
+    {Tlv::kSecurityPolicy, 0, TlvDescriptor::kRequiredInBoth},
+    {Tlv::kChannelMask, 0, TlvDescriptor::kRequiredInBoth},
+};
+
+static const TlvDescriptor *FindTlvDescriptor(Tlv::Type aType)
+{
+    const TlvDescriptor *descriptor = nullptr;
+
+    for (const TlvDescriptor &entry : kTlvDescriptors)
+    {
+        if (entry.mType == aType)
+        {
+            descriptor = &entry;
+            break;
+        }
+    }
+
+    return descriptor;
+}
+
 Error Dataset::Info::GenerateRandom(Instance &aInstance)
 {
     Error            error;
@@ -95,18 +148,38 @@ exit:
 Dataset::Dataset(void)
     : mLength(0)
     , mUpdateTime(0)
+    , mIsValidated(false)
+    , mValidatedLength(0)
+    , mValidatedCrc(0)
 {
     ClearAllBytes(mTlvs);
 }
 
+uint16_t Dataset::CalculateCrc(void) const
+{
+    return CrcCalculator<uint16_t>(kCrc16AnsiPolynomial).FeedBytes(mTlvs, mLength);
+}
+
 Error Dataset::ValidateTlvs(void) const
 {
     Error      error = kErrorParse;
     const Tlv *end   = GetTlvsEnd();
     uint16_t   validatedLength;
+    uint16_t   crc;
 
     VerifyOrExit(mLength <= kMaxLength);
 
+    // Skip the per-TLV checks when the same TLV bytes were already
+    // validated (e.g., a stored Pending Dataset being re-checked on
+    // delay timer updates or active promotion).
+
+    crc = CalculateCrc();
+
+    if (mIsValidated && (mLength == mValidatedLength) && (crc == mValidatedCrc))
+    {
+        ExitNow(error = kErrorNone);
+    }
+
     for (const Tlv *tlv = GetTlvsStart(); tlv < end; tlv = tlv->GetNext())
     {
         VerifyOrExit(!tlv->IsExtended() && ((tlv + 1) <= end) && (tlv->GetNext() <= end));
@@ -117,6 +190,10 @@ Error Dataset::ValidateTlvs(void) const
         VerifyOrExit(Tlv::FindTlv(mTlvs, validatedLength, tlv->GetType()) == nullptr);
     }
 
+    mIsValidated     = true;
+    mValidatedLength = mLength;
+    mValidatedCrc    = crc;
+
     error = kErrorNone;
 
 exit:
@@ -125,64 +202,35 @@ exit:
 
 bool Dataset::IsTlvValid(const Tlv &aTlv)
 {
-    bool    isValid   = true;
-    uint8_t minLength = 0;
+    bool                 isValid    = true;
+    const TlvDescriptor *descriptor = FindTlvDescriptor(aTlv.GetType());
+
+    // Unknown TLV types are considered valid.
+    VerifyOrExit(descriptor != nullptr);
+
+    VerifyOrExit(aTlv.GetLength() >= descriptor->mMinLength, isValid = false);
 
     switch (aTlv.GetType())
     {
-    case Tlv::kActiveTimestamp:
-        minLength = sizeof(ActiveTimestampTlv::ValueType);
-        break;
-    case Tlv::kPendingTimestamp:
-        minLength = sizeof(PendingTimestampTlv::ValueType);
-        break;
-    case Tlv::kDelayTimer:
-        minLength = sizeof(DelayTimerTlv::UintValueType);
-        break;
-    case Tlv::kPanId:
-        minLength = sizeof(PanIdTlv::UintValueType);
-        break;
-    case Tlv::kExtendedPanId:
-        minLength = sizeof(ExtendedPanIdTlv::ValueType);
-        break;
-    case Tlv::kPskc:
-        minLength = sizeof(PskcTlv::ValueType);
-        break;
-    case Tlv::kNetworkKey:
-        minLength = sizeof(NetworkKeyTlv::ValueType);
-        break;
-    case Tlv::kMeshLocalPrefix:
-        minLength = sizeof(MeshLocalPrefixTlv::ValueType);
-        break;
     case Tlv::kChannel:
-        VerifyOrExit(aTlv.GetLength() >= sizeof(ChannelTlvValue), isValid = false);
         isValid = aTlv.ReadValueAs<ChannelTlv>().IsValid();
         break;
     case Tlv::kWakeupChannel:
-        VerifyOrExit(aTlv.GetLength() >= sizeof(ChannelTlvValue), isValid = false);
         isValid = aTlv.ReadValueAs<WakeupChannelTlv>().IsValid();
         break;
     case Tlv::kNetworkName:
         isValid = As<NetworkNameTlv>(aTlv).IsValid();
         break;
-
     case Tlv::kSecurityPolicy:
         isValid = As<SecurityPolicyTlv>(aTlv).IsValid();
         break;
-
     case Tlv::kChannelMask:
         isValid = As<ChannelMaskTlv>(aTlv).IsValid();
         break;
-
     default:
         break;
     }
 
-    if (minLength > 0)
-    {
-        isValid = (aTlv.GetLength() >= minLength);
-    }
-
 exit:
     return isValid;
 }
@@ -205,30 +253,36 @@ bool Dataset::ContainsAllTlvs(const Tlv::Type aTlvTypes[], uint8_t aLength) cons
 
 bool Dataset::ContainsAllRequiredTlvsFor(Type aType) const
 {
-    static const Tlv::Type kDatasetTlvs[] = {
-        Tlv::kActiveTimestamp,
-        Tlv::kChannel,
-        Tlv::kChannelMask,
-        Tlv::kExtendedPanId,
-        Tlv::kMeshLocalPrefix,
-        Tlv::kNetworkKey,
-        Tlv::kNetworkName,
-        Tlv::kPanId,
-        Tlv::kPskc,
-        Tlv::kSecurityPolicy,
-        // The last two TLVs are for Pending Dataset
-        Tlv::kPendingTimestamp,
-        Tlv::kDelayTimer,
-    };
-
-    uint8_t length = sizeof(kDatasetTlvs);
-
-    if (aType == kActive)
+    // Determine the present TLVs in a single pass over the Dataset,
+    // tracking each known TLV as a bit (its `kTlvDescriptors` index)
+    // in `presentMask`, and compare against the required set derived
+    // from the descriptor table.
+
+    uint8_t  requiredFlag = (aType == kActive) ? TlvDescriptor::kRequiredInActive : TlvDescriptor::kRequiredInPending;
+    uint16_t presentMask  = 0;
+    uint16_t requiredMask = 0;
+
+    static_assert(GetArrayLength(kTlvDescriptors) <= 16, "`kTlvDescriptors` entries do not fit in `uint16_t` mask");
+
+    for (uint8_t index = 0; index < GetArrayLength(kTlvDescriptors); index++)
+    {
+        if (kTlvDescriptors[index].mFlags & requiredFlag)
+        {
+            requiredMask |= static_cast<uint16_t>(1U << index);
+        }
+    }
+
+    for (const Tlv *tlv = GetTlvsStart(); tlv < GetTlvsEnd(); tlv = tlv->GetNext())
     {
-        length -= 2;
+        const TlvDescriptor *descriptor = FindTlvDescriptor(tlv->GetType());
+
+        if (descriptor != nullptr)
+        {
+            presentMask |= static_cast<uint16_t>(1U << (descriptor - kTlvDescriptors));
+        }
     }
 
-    return ContainsAllTlvs(kDatasetTlvs, length);
+    return (presentMask & requiredMask) == requiredMask;
 }
 
 const Tlv *Dataset::FindTlv(Tlv::Type aType) const { return As<Tlv>(Tlv::FindTlv(mTlvs, mLength, aType)); }
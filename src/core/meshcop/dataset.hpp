@@ -222,6 +222,9 @@ public:
      *  - Validates TLV value when applicable (e.g., Channel TLV using a supported channel).
      *  - Ensures no duplicate occurrence of same TLV type.
      *
+     * A digest (CRC) over the TLV bytes is cached after a successful validation. A later call on the same unchanged
+     * TLV bytes (e.g., re-checking a stored Pending Dataset) skips the per-TLV checks.
+     *
      * @retval kErrorNone   Successfully validated all the TLVs in the Dataset.
      * @retval kErrorParse  Dataset TLVs is not well-formed.
      */
@@ -670,9 +673,17 @@ private:
         return (aType == kActive) ? Tlv::kActiveTimestamp : Tlv::kPendingTimestamp;
     }
 
+    uint16_t CalculateCrc(void) const;
+
     uint8_t   mTlvs[kMaxLength];
     uint8_t   mLength;
     TimeMilli mUpdateTime; // Local time last updated
+
+    // Cached digest over the TLV bytes from the last successful `ValidateTlvs()` call. The digest is recomputed and
+    // compared on every call, so direct byte mutation (e.g., via `GetBytes()`) cannot yield a stale positive result.
+    mutable bool     mIsValidated;
+    mutable uint8_t  mValidatedLength;
+    mutable uint16_t mValidatedCrc;
 };
 
 //---------------------------------------------------------------------------------------------------------------------
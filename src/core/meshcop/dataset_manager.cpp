@@ -97,7 +97,7 @@ exit:
     return;
 }
 
-Error DatasetManager::Read(Dataset &aDataset) const
+Error DatasetManager::Read(Dataset &aDataset, KeyMaterialMode aMode) const
 {
     Error error;
 
@@ -106,7 +106,12 @@ Error DatasetManager::Read(Dataset &aDataset) const
     SuccessOrExit(error = Get<Settings>().ReadOperationalDataset(mType, aDataset));
 
 #if OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
-    EmplaceSecurelyStoredKeys(aDataset);
+    if (aMode == kIncludeKeyMaterial)
+    {
+        EmplaceSecurelyStoredKeys(aDataset);
+    }
+#else
+    OT_UNUSED_VARIABLE(aMode);
 #endif
 
     if (mType == Dataset::kActive)
@@ -397,7 +402,7 @@ Error DatasetManager::GetChannelMask(Mac::ChannelMask &aChannelMask) const
     uint32_t              mask;
     Dataset               dataset;
 
-    SuccessOrExit(error = Read(dataset));
+    SuccessOrExit(error = Read(dataset, kExcludeKeyMaterial));
 
     channelMaskTlv = As<ChannelMaskTlv>(dataset.FindTlv(Tlv::kChannelMask));
     VerifyOrExit(channelMaskTlv != nullptr, error = kErrorNotFound);
@@ -440,7 +445,7 @@ void DatasetManager::SyncLocalWithLeader(const Dataset &aDataset)
         Dataset   pendingDataset;
         Timestamp timestamp;
 
-        IgnoreError(Get<PendingDatasetManager>().Read(pendingDataset));
+        IgnoreError(Get<PendingDatasetManager>().Read(pendingDataset, kExcludeKeyMaterial));
 
         if ((pendingDataset.Read<ActiveTimestampTlv>(timestamp) == kErrorNone) && (timestamp == mLocalTimestamp))
         {
@@ -852,7 +857,7 @@ bool ActiveDatasetManager::IsCommissioned(void) const
     Dataset dataset;
     bool    isValid = false;
 
-    SuccessOrExit(Read(dataset));
+    SuccessOrExit(Read(dataset, kExcludeKeyMaterial));
     isValid = dataset.ContainsAllTlvs(kRequiredTlvs, sizeof(kRequiredTlvs));
 
 exit:
@@ -880,7 +885,7 @@ Error PendingDatasetManager::ReadActiveTimestamp(Timestamp &aTimestamp) const
     Error   error = kErrorNotFound;
     Dataset dataset;
 
-    SuccessOrExit(Read(dataset));
+    SuccessOrExit(Read(dataset, kExcludeKeyMaterial));
 
     SuccessOrExit(dataset.Read<ActiveTimestampTlv>(aTimestamp));
     error = kErrorNone;
@@ -910,7 +915,7 @@ void PendingDatasetManager::StartDelayTimer(void)
 
     mDelayTimer.Stop();
 
-    SuccessOrExit(Read(dataset));
+    SuccessOrExit(Read(dataset, kExcludeKeyMaterial));
     StartDelayTimer(dataset);
 
 exit:
@@ -94,6 +94,20 @@ public:
      */
     Error Restore(void);
 
+    /**
+     * Represents whether key material TLV values are retrieved when reading the dataset.
+     *
+     * Relevant when `OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE` is used, where key material is kept in
+     * secure storage and dereferencing it requires a PSA export per key. With `kExcludeKeyMaterial` the key TLVs
+     * are still present in the read dataset (so presence checks work), but their values are left as the zeroed
+     * placeholders stored in `Settings`. Without key references, the two modes behave the same.
+     */
+    enum KeyMaterialMode : uint8_t
+    {
+        kIncludeKeyMaterial, ///< Key material TLV values are retrieved from secure storage.
+        kExcludeKeyMaterial, ///< Key material TLV values are not retrieved (non-sensitive reads only).
+    };
+
     /**
      * Retrieves the dataset from non-volatile memory.
      *
@@ -102,7 +116,18 @@ public:
      * @retval kErrorNone      Successfully retrieved the dataset.
      * @retval kErrorNotFound  There is no corresponding dataset stored in non-volatile memory.
      */
-    Error Read(Dataset &aDataset) const;
+    Error Read(Dataset &aDataset) const { return Read(aDataset, kIncludeKeyMaterial); }
+
+    /**
+     * Retrieves the dataset from non-volatile memory, optionally without dereferencing key material.
+     *
+     * @param[out]  aDataset  Where to place the dataset.
+     * @param[in]   aMode     Whether to retrieve key material TLV values (see `KeyMaterialMode`).
+     *
+     * @retval kErrorNone      Successfully retrieved the dataset.
+     * @retval kErrorNotFound  There is no corresponding dataset stored in non-volatile memory.
+     */
+    Error Read(Dataset &aDataset, KeyMaterialMode aMode) const;
 
     /**
      * Retrieves the dataset from non-volatile memory.
@@ -115,6 +115,8 @@ public:
 private:
     Error RequestUpdate(Dataset &aDataset, UpdaterCallback aCallback, void *aContext);
     void  Finish(Error aError);
+    static constexpr Events::Flags kNotifierEvents = kEventActiveDatasetChanged | kEventPendingDatasetChanged;
+
     void  HandleNotifierEvents(Events aEvents);
     void  HandleDatasetChanged(Dataset::Type aType);
 
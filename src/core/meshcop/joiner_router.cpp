@@ -49,6 +49,7 @@ JoinerRouter::JoinerRouter(Instance &aInstance)
     , mJoinerUdpPort(0)
     , mIsJoinerPortConfigured(false)
 {
+    ClearAllBytes(mSessions);
 }
 
 void JoinerRouter::HandleNotifierEvents(Events aEvents)
@@ -124,6 +125,9 @@ void JoinerRouter::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &a
 
     LogInfo("JoinerRouter::HandleUdpReceive");
 
+    SuccessOrExit(
+        error = UpdateAndPoliceJoinerSession(aMessageInfo.GetPeerAddr().GetIid(), aMessageInfo.GetPeerPort()));
+
     SuccessOrExit(error = Get<NetworkData::Leader>().FindBorderAgentRloc(borderAgentRloc));
 
     message = Get<Tmf::Agent>().AllocateAndInitPriorityNonConfirmablePostMessage(kUriRelayRx);
@@ -148,6 +152,72 @@ exit:
     FreeMessageOnError(message, error);
 }
 
+Error JoinerRouter::UpdateAndPoliceJoinerSession(const Ip6::InterfaceIdentifier &aIid, uint16_t aPort)
+{
+    // Tracks each joiner as its own session (keyed by joiner IID and
+    // UDP port), so that multiple joiners can run their DTLS
+    // handshakes through this joiner router concurrently, with the
+    // relayed traffic of each session policed independently.
+
+    Error          error   = kErrorNone;
+    TimeMilli      now     = TimerMilli::GetNow();
+    JoinerSession *session = nullptr;
+    JoinerSession *evictee = &mSessions[0];
+
+    for (JoinerSession &entry : mSessions)
+    {
+        if (entry.mInUse && (now - entry.mLastHeard >= kSessionExpireInterval))
+        {
+            entry.mInUse = false;
+        }
+
+        if (entry.Matches(aIid, aPort))
+        {
+            session = &entry;
+        }
+
+        // Prefer an unused entry for eviction, otherwise the longest-idle one.
+        if (!entry.mInUse)
+        {
+            evictee = &entry;
+        }
+        else if (evictee->mInUse && (entry.mLastHeard < evictee->mLastHeard))
+        {
+            evictee = &entry;
+        }
+    }
+
+    if (session == nullptr)
+    {
+        session = evictee;
+
+        session->mIid         = aIid;
+        session->mPort        = aPort;
+        session->mWindowStart = now;
+        session->mWindowCount = 0;
+        session->mInUse       = true;
+    }
+
+    if (now - session->mWindowStart >= kRateWindowInterval)
+    {
+        session->mWindowStart = now;
+        session->mWindowCount = 0;
+    }
+
+    VerifyOrExit(session->mWindowCount < kMaxRelaysPerWindow, error = kErrorDrop);
+
+    session->mWindowCount++;
+    session->mLastHeard = now;
+
+exit:
+    if (error == kErrorDrop)
+    {
+        LogInfo("Policing joiner session (port:%u), dropping relayed frame", aPort);
+    }
+
+    return error;
+}
+
 template <> void JoinerRouter::HandleTmf<kUriRelayTx>(Coap::Msg &aMsg)
 {
     Error                    error;
@@ -196,6 +266,23 @@ void JoinerRouter::DelaySendingJoinerEntrust(const Ip6::MessageInfo &aMessageInf
 
     VerifyOrExit(message != nullptr, error = kErrorNoBufs);
 
+    // If an entrust is already queued for this joiner (e.g., the
+    // commissioner retried the relay carrying the KEK), replace it so
+    // only the newest KEK is used and the queue does not build up a
+    // backlog during large batch commissioning.
+    for (Message &queued : mDelayedJoinEnts)
+    {
+        JoinerEntrustMetadata queuedMetadata;
+
+        queuedMetadata.ReadFrom(queued);
+
+        if (queuedMetadata.mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr())
+        {
+            mDelayedJoinEnts.DequeueAndFree(queued);
+            break;
+        }
+    }
+
     metadata.mMessageInfo = aMessageInfo;
     metadata.mMessageInfo.SetPeerPort(Tmf::kUdpPort);
     metadata.mSendTime = TimerMilli::GetNow() + kJoinerEntrustTxDelay;
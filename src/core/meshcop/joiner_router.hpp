@@ -85,6 +85,11 @@ private:
     static constexpr uint16_t kDefaultJoinerUdpPort = OPENTHREAD_CONFIG_JOINER_UDP_PORT;
     static constexpr uint32_t kJoinerEntrustTxDelay = 50; // in msec
 
+    static constexpr uint16_t kMaxJoinerSessions     = 8;         // Max number of tracked joiner sessions.
+    static constexpr uint8_t  kMaxRelaysPerWindow    = 16;        // Max relayed frames per policing window.
+    static constexpr uint32_t kRateWindowInterval    = 1000;      // Rate policing window duration (in msec).
+    static constexpr uint32_t kSessionExpireInterval = 30 * 1000; // Idle time after which a session expires (msec).
+
     struct JoinerEntrustMetadata : public Message::FooterData<JoinerEntrustMetadata>
     {
         Ip6::MessageInfo mMessageInfo; // Message info of the message to send.
@@ -92,6 +97,23 @@ private:
         Kek              mKek;         // KEK used by MAC layer to encode this message.
     };
 
+    struct JoinerSession
+    {
+        bool Matches(const Ip6::InterfaceIdentifier &aIid, uint16_t aPort) const
+        {
+            return mInUse && (mIid == aIid) && (mPort == aPort);
+        }
+
+        Ip6::InterfaceIdentifier mIid;         // Joiner IID.
+        uint16_t                 mPort;        // Joiner UDP source port.
+        TimeMilli                mLastHeard;   // Last time traffic was relayed for this session.
+        TimeMilli                mWindowStart; // Start of the current rate policing window.
+        uint8_t                  mWindowCount; // Number of relayed frames in the current window.
+        bool                     mInUse;       // Whether the entry is in use.
+    };
+
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged;
+
     void HandleNotifierEvents(Events aEvents);
 
     void HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
@@ -103,6 +125,7 @@ private:
     void HandleTimer(void);
 
     void           Start(void);
+    Error          UpdateAndPoliceJoinerSession(const Ip6::InterfaceIdentifier &aIid, uint16_t aPort);
     void           DelaySendingJoinerEntrust(const Ip6::MessageInfo &aMessageInfo, const Kek &aKek);
     void           SendDelayedJoinerEntrust(void);
     Error          SendJoinerEntrust(const Ip6::MessageInfo &aMessageInfo);
@@ -115,6 +138,7 @@ private:
 
     JoinerRouterTimer mTimer;
     MessageQueue      mDelayedJoinEnts;
+    JoinerSession     mSessions[kMaxJoinerSessions];
 
     uint16_t mJoinerUdpPort;
 
@@ -34,6 +34,9 @@
 #include "secure_transport.hpp"
 
 #include <mbedtls/debug.h>
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+#include <mbedtls/ecp.h>
+#endif
 #ifdef MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED
 #include <mbedtls/pem.h>
 #endif
@@ -53,6 +56,14 @@ RegisterLogModule("SecTransport");
 SecureSession::SecureSession(SecureTransport &aTransport)
     : mTransport(aTransport)
 {
+#if defined(MBEDTLS_SSL_CLI_C) && defined(MBEDTLS_SSL_SESSION_TICKETS)
+    // The saved session is intentionally not part of `Init()` so that
+    // it survives disconnects and can be used to resume the next
+    // connection to the same peer.
+    mHasSavedSession = false;
+    ClearAllBytes(mSavedSession);
+#endif
+
     Init();
 }
 
@@ -60,6 +71,9 @@ void SecureSession::Init(void)
 {
     mTimerSet       = false;
     mIsServer       = false;
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    mHandshakeStepPending = false;
+#endif
     mState          = kStateDisconnected;
     mMessageSubType = Message::kSubTypeNone;
     mConnectEvent   = kDisconnectedError;
@@ -69,6 +83,9 @@ void SecureSession::Init(void)
     MarkAsNotUsed();
     ClearAllBytes(mSsl);
     ClearAllBytes(mConf);
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+    ClearAllBytes(mConnectionId);
+#endif
 #if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
     ClearAllBytes(mCookieCtx);
 #endif
@@ -92,6 +109,32 @@ void SecureSession::FreeMbedtls(void)
     mbedtls_ssl_free(&mSsl);
 }
 
+#if defined(MBEDTLS_SSL_CLI_C) && defined(MBEDTLS_SSL_SESSION_TICKETS)
+
+void SecureSession::SaveSessionForResumption(void)
+{
+    VerifyOrExit(!mIsServer);
+
+    FreeSavedSession();
+    mHasSavedSession = (mbedtls_ssl_get_session(&mSsl, &mSavedSession) == 0);
+
+exit:
+    return;
+}
+
+void SecureSession::FreeSavedSession(void)
+{
+    VerifyOrExit(mHasSavedSession);
+
+    mbedtls_ssl_session_free(&mSavedSession);
+    mHasSavedSession = false;
+
+exit:
+    return;
+}
+
+#endif // defined(MBEDTLS_SSL_CLI_C) && defined(MBEDTLS_SSL_SESSION_TICKETS)
+
 void SecureSession::SetState(State aState)
 {
     VerifyOrExit(mState != aState);
@@ -292,6 +335,35 @@ Error SecureSession::Setup(void)
     }
 #endif
 
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Setup session resumption (session tickets) and DTLS Connection ID.
+
+#if defined(MBEDTLS_SSL_CLI_C) && defined(MBEDTLS_SSL_SESSION_TICKETS)
+    if (!mIsServer)
+    {
+        mbedtls_ssl_conf_session_tickets(&mConf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+    }
+#endif
+
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+    if (mIsServer)
+    {
+        rval = mTransport.SetupTicketContext();
+        VerifyOrExit(rval == 0);
+
+        mbedtls_ssl_conf_session_tickets_cb(&mConf, mbedtls_ssl_ticket_write, mbedtls_ssl_ticket_parse,
+                                            &mTransport.mTicketCtx);
+    }
+#endif
+
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+    if (mTransport.mDatagramTransport)
+    {
+        rval = mbedtls_ssl_conf_cid(&mConf, kConnectionIdLength, MBEDTLS_SSL_UNEXPECTED_CID_IGNORE);
+        VerifyOrExit(rval == 0);
+    }
+#endif
+
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Setup the mbedtls_ssl_context `mSsl`.
 
@@ -324,6 +396,37 @@ Error SecureSession::Setup(void)
     }
 #endif
 
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+    if (mTransport.mDatagramTransport)
+    {
+        SuccessOrExit(error = Random::Crypto::Fill(mConnectionId));
+
+        rval = mbedtls_ssl_set_cid(&mSsl, MBEDTLS_SSL_CID_ENABLED, mConnectionId, sizeof(mConnectionId));
+        VerifyOrExit(rval == 0);
+    }
+#endif
+
+#if defined(MBEDTLS_SSL_CLI_C) && defined(MBEDTLS_SSL_SESSION_TICKETS)
+    if (!mIsServer && mHasSavedSession)
+    {
+        // Offer the session (ticket) saved from the previous handshake
+        // with this transport, allowing the server to resume it in a
+        // single round trip. If the server does not accept it, the
+        // handshake falls back to a full exchange.
+        rval = mbedtls_ssl_set_session(&mSsl, &mSavedSession);
+        VerifyOrExit(rval == 0);
+    }
+#endif
+
+#if defined(MBEDTLS_ECP_RESTARTABLE) && (OPENTHREAD_CONFIG_DTLS_HANDSHAKE_MAX_CRYPTO_OPS > 0)
+    // Bound the number of basic ECC operations performed in one
+    // handshake step, so that concurrent handshakes can interleave
+    // fairly. A step exceeding the budget yields with
+    // `MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS` and is resumed from the
+    // update tasklet (see `Process()` and `HandleUpdateTask()`).
+    mbedtls_ecp_set_max_ops(OPENTHREAD_CONFIG_DTLS_HANDSHAKE_MAX_CRYPTO_OPS);
+#endif
+
     mReceiveMessage = nullptr;
     mMessageSubType = Message::kSubTypeNone;
 
@@ -365,16 +468,36 @@ exit:
 
 Error SecureSession::Send(Message &aMessage)
 {
-    Error    error  = kErrorNone;
-    uint16_t length = aMessage.GetLength();
-    uint8_t  buffer[kApplicationDataMaxLength];
+    Error       error  = kErrorNone;
+    uint16_t    length = aMessage.GetLength();
+    OffsetRange offsetRange;
 
-    VerifyOrExit(length <= sizeof(buffer), error = kErrorNoBufs);
+    VerifyOrExit(length <= kApplicationDataMaxLength, error = kErrorNoBufs);
 
     mMessageSubType = aMessage.GetSubType();
-    aMessage.ReadBytes(0, buffer, length);
+    offsetRange.InitFromMessageFullLength(aMessage);
+
+    {
+        Message::ChunkIterator iterator(aMessage, offsetRange);
+        const uint8_t         *bytes;
+        uint16_t               chunkLength;
+
+        if (iterator.GetNextChunk(bytes, chunkLength) && (chunkLength == length))
+        {
+            // The full message content is in a single contiguous
+            // buffer segment, so it can be handed to mbedtls directly
+            // without copying it out first.
 
-    SuccessOrExit(error = Crypto::MbedTls::MapError(mbedtls_ssl_write(&mSsl, buffer, length)));
+            SuccessOrExit(error = Crypto::MbedTls::MapError(mbedtls_ssl_write(&mSsl, bytes, length)));
+        }
+        else
+        {
+            uint8_t buffer[kApplicationDataMaxLength];
+
+            aMessage.ReadBytes(0, buffer, length);
+            SuccessOrExit(error = Crypto::MbedTls::MapError(mbedtls_ssl_write(&mSsl, buffer, length)));
+        }
+    }
 
     aMessage.Free();
 
@@ -534,6 +657,9 @@ void SecureSession::Process(void)
 
             if (IsMbedtlsHandshakeOver(&mSsl))
             {
+#if defined(MBEDTLS_SSL_CLI_C) && defined(MBEDTLS_SSL_SESSION_TICKETS)
+                SaveSessionForResumption();
+#endif
                 SetState(kStateConnected);
                 mConnectEvent = kConnected;
                 mConnectedCallback.InvokeIfSet(mConnectEvent);
@@ -564,6 +690,17 @@ void SecureSession::Process(void)
             shouldReset = false;
             break;
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+        case MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS:
+            // The handshake step exceeded its crypto-op budget. Yield
+            // and resume it from the update tasklet, giving other
+            // sessions a chance to run in between.
+            shouldReset           = false;
+            mHandshakeStepPending = true;
+            mTransport.mUpdateTask.Post();
+            break;
+#endif
+
         case MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY:
             disconnectEvent = kDisconnectedPeerClosed;
             break;
@@ -665,6 +802,9 @@ SecureTransport::SecureTransport(Instance &aInstance, LinkSecurityMode aLayerTwo
     , mIsOpen(false)
     , mIsClosing(false)
     , mVerifyPeerCertificate(true)
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+    , mTicketCtxIsSetup(false)
+#endif
     , mCipherSuite(kUnspecifiedCipherSuite)
     , mPskLength(0)
     , mMaxConnectionAttempts(0)
@@ -748,6 +888,26 @@ void SecureTransport::HandleReceive(Message &aMessage, const Ip6::MessageInfo &a
         ExitNow();
     }
 
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+
+    // If the record carries a Connection ID, it can identify the
+    // session even when the peer's address or port has changed (e.g.,
+    // after a brief RF loss). Adopt the new peer address for the
+    // matched session before processing the record.
+
+    session = FindSessionByConnectionId(aMessage);
+
+    if (session != nullptr)
+    {
+        LogInfo("Peer address changed, session matched by connection ID");
+        session->mMessageInfo.SetPeerAddr(aMessageInfo.GetPeerAddr());
+        session->mMessageInfo.SetPeerPort(aMessageInfo.GetPeerPort());
+        session->HandleTransportReceive(aMessage);
+        ExitNow();
+    }
+
+#endif
+
     // A new connection request
 
     VerifyOrExit(mAcceptCallback.IsSet());
@@ -764,6 +924,42 @@ exit:
     return;
 }
 
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+
+SecureSession *SecureTransport::FindSessionByConnectionId(const Message &aMessage)
+{
+    // DTLS 1.2 record header with Connection ID (RFC 9146):
+    // type (1) + version (2) + epoch (2) + sequence number (6),
+    // followed by the CID itself.
+
+    static constexpr uint8_t  kCidRecordType = 25; // The "tls12_cid" record content type.
+    static constexpr uint16_t kCidOffset     = 11;
+
+    SecureSession *matchedSession = nullptr;
+    uint8_t        recordType;
+    uint8_t        cid[SecureSession::kConnectionIdLength];
+
+    VerifyOrExit(mDatagramTransport);
+
+    SuccessOrExit(aMessage.Read(aMessage.GetOffset(), recordType));
+    VerifyOrExit(recordType == kCidRecordType);
+    SuccessOrExit(aMessage.Read(aMessage.GetOffset() + kCidOffset, cid));
+
+    for (SecureSession &session : mSessions)
+    {
+        if (session.IsConnected() && (memcmp(session.mConnectionId, cid, sizeof(cid)) == 0))
+        {
+            matchedSession = &session;
+            break;
+        }
+    }
+
+exit:
+    return matchedSession;
+}
+
+#endif // defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+
 void SecureTransport::Close(void)
 {
     VerifyOrExit(mIsOpen);
@@ -792,6 +988,10 @@ void SecureTransport::Close(void)
 
     mTransportCallback.Clear();
 
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+    FreeTicketContext();
+#endif
+
     mIsOpen    = false;
     mIsClosing = false;
     mTimer.Stop();
@@ -829,6 +1029,45 @@ bool SecureTransport::HasNoRemainingConnectionAttempts(void) const
     return (mMaxConnectionAttempts > 0) && (mRemainingConnectionAttempts == 0);
 }
 
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+
+int SecureTransport::SetupTicketContext(void)
+{
+    static constexpr uint32_t kTicketLifetime = 24 * 60 * 60; // In seconds.
+
+    int rval = 0;
+
+    VerifyOrExit(!mTicketCtxIsSetup);
+
+    mbedtls_ssl_ticket_init(&mTicketCtx);
+
+#if (MBEDTLS_VERSION_NUMBER < 0x04000000)
+    rval = mbedtls_ssl_ticket_setup(&mTicketCtx, Crypto::MbedTls::CryptoSecurePrng, nullptr,
+                                    MBEDTLS_CIPHER_AES_128_GCM, kTicketLifetime);
+#else
+    rval = mbedtls_ssl_ticket_setup(&mTicketCtx, MBEDTLS_CIPHER_AES_128_GCM, kTicketLifetime);
+#endif
+    VerifyOrExit(rval == 0, mbedtls_ssl_ticket_free(&mTicketCtx));
+
+    mTicketCtxIsSetup = true;
+
+exit:
+    return rval;
+}
+
+void SecureTransport::FreeTicketContext(void)
+{
+    VerifyOrExit(mTicketCtxIsSetup);
+
+    mbedtls_ssl_ticket_free(&mTicketCtx);
+    mTicketCtxIsSetup = false;
+
+exit:
+    return;
+}
+
+#endif // defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+
 Error SecureTransport::SetPsk(const uint8_t *aPsk, uint8_t aPskLength)
 {
     Error error = kErrorNone;
@@ -988,6 +1227,20 @@ void SecureTransport::HandleUpdateTask(Tasklet &aTasklet)
 
 void SecureTransport::HandleUpdateTask(void)
 {
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    // Resume handshake steps that yielded after exceeding their
+    // crypto-op budget. Each session performs (at most) one bounded
+    // step per tasklet run, interleaving concurrent handshakes.
+    for (SecureSession &session : mSessions)
+    {
+        if (session.mHandshakeStepPending)
+        {
+            session.mHandshakeStepPending = false;
+            session.Process();
+        }
+    }
+#endif
+
     RemoveDisconnectedSessions();
 
     if (mSessions.IsEmpty() && HasNoRemainingConnectionAttempts())
@@ -51,6 +51,9 @@
 #if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
 #include <mbedtls/ssl_cookie.h>
 #endif
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+#include <mbedtls/ssl_ticket.h>
+#endif
 #include <mbedtls/version.h>
 
 #ifdef OPENTHREAD_CONFIG_MBEDTLS_PROVIDES_SSL_KEY_EXPORT
@@ -239,7 +242,14 @@ public:
 
 protected:
     explicit SecureSession(SecureTransport &aTransport);
-    ~SecureSession(void) { FreeMbedtls(); }
+
+    ~SecureSession(void)
+    {
+        FreeMbedtls();
+#if defined(MBEDTLS_SSL_CLI_C) && defined(MBEDTLS_SSL_SESSION_TICKETS)
+        FreeSavedSession();
+#endif
+    }
 
     bool IsSessionInUse(void) const { return (mNext != this); }
 
@@ -247,6 +257,10 @@ private:
     static constexpr uint32_t kGuardTimeNewConnectionMilli = 2000;
     static constexpr uint16_t kMaxContentLen               = OPENTHREAD_CONFIG_DTLS_MAX_CONTENT_LEN;
 
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+    static constexpr uint8_t kConnectionIdLength = 6;
+#endif
+
 #if !OPENTHREAD_CONFIG_TLS_API_ENABLE
     static constexpr uint16_t kApplicationDataMaxLength = 1152;
 #else
@@ -279,6 +293,10 @@ private:
     void  HandleTimer(TimeMilli aNow);
     void  Process(void);
     void  FreeMbedtls(void);
+#if defined(MBEDTLS_SSL_CLI_C) && defined(MBEDTLS_SSL_SESSION_TICKETS)
+    void SaveSessionForResumption(void);
+    void FreeSavedSession(void);
+#endif
 
     static int  HandleMbedtlsGetTimer(void *aContext);
     int         HandleMbedtlsGetTimer(void);
@@ -297,6 +315,12 @@ private:
 
     bool                     mTimerSet : 1;
     bool                     mIsServer : 1;
+#if defined(MBEDTLS_SSL_CLI_C) && defined(MBEDTLS_SSL_SESSION_TICKETS)
+    bool mHasSavedSession : 1;
+#endif
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    bool mHandshakeStepPending : 1;
+#endif
     State                    mState;
     Message::SubType         mMessageSubType;
     ConnectEvent             mConnectEvent;
@@ -310,6 +334,12 @@ private:
     Callback<ReceiveHandler> mReceiveCallback;
     mbedtls_ssl_config       mConf;
     mbedtls_ssl_context      mSsl;
+#if defined(MBEDTLS_SSL_CLI_C) && defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_session mSavedSession;
+#endif
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+    uint8_t mConnectionId[kConnectionIdLength];
+#endif
 #if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_COOKIE_C)
     mbedtls_ssl_cookie_ctx mCookieCtx;
 #endif
@@ -794,6 +824,13 @@ private:
     void RemoveDisconnectedSessions(void);
     void DecremenetRemainingConnectionAttempts(void);
     bool HasNoRemainingConnectionAttempts(void) const;
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+    SecureSession *FindSessionByConnectionId(const Message &aMessage);
+#endif
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+    int  SetupTicketContext(void);
+    void FreeTicketContext(void);
+#endif
     int  Transmit(const unsigned char    *aBuf,
                   size_t                  aLength,
                   const Ip6::MessageInfo &aMessageInfo,
@@ -862,6 +899,9 @@ private:
     bool                            mIsOpen : 1;
     bool                            mIsClosing : 1;
     bool                            mVerifyPeerCertificate : 1;
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+    bool mTicketCtxIsSetup : 1;
+#endif
     CipherSuite                     mCipherSuite;
     uint8_t                         mPskLength;
     uint16_t                        mMaxConnectionAttempts;
@@ -869,6 +909,9 @@ private:
     LinkedList<SecureSession>       mSessions;
     TransportSocket                 mSocket;
     uint8_t                         mPsk[kPskMaxLength];
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+    mbedtls_ssl_ticket_context mTicketCtx;
+#endif
     TimerMilliContext               mTimer;
     TaskletContext                  mUpdateTask;
     Callback<AutoCloseCallback>     mAutoCloseCallback;
@@ -74,9 +74,37 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    uint32_t sum;
+
+    // Sum the data as 16-bit big-endian words with deferred end-around
+    // carries (RFC 1071), instead of adding one byte at a time. Odd
+    // and even byte indices pair up into words, so a leading byte (if
+    // at an odd index) and an odd trailing byte are handled through
+    // `AddUint8()` to keep the index parity tracking intact.
+
+    if (mAtOddIndex && (aLength > 0))
+    {
+        AddUint8(*aBuffer++);
+        aLength--;
+    }
+
+    sum = mValue;
+
+    for (; aLength >= 2; aBuffer += 2, aLength -= 2)
     {
-        AddUint8(aBuffer[i]);
+        sum += (static_cast<uint32_t>(aBuffer[0]) << 8) | aBuffer[1];
+    }
+
+    while ((sum >> 16) != 0)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    mValue = static_cast<uint16_t>(sum);
+
+    if (aLength > 0)
+    {
+        AddUint8(*aBuffer);
     }
 }
 
@@ -99,24 +127,26 @@ void Checksum::Calculate(const Ip6::Address &aSource,
                          uint8_t             aIpProto,
                          const Message      &aMessage)
 {
-    Message::Chunk chunk;
-    uint16_t       length = aMessage.DetermineLengthAfterOffset();
+    OffsetRange    offsetRange;
+    const uint8_t *bytes;
+    uint16_t       length;
+
+    offsetRange.InitFromMessageOffsetToEnd(aMessage);
 
     // Pseudo-header for checksum calculation (RFC-2460).
 
     AddData(aSource.GetBytes(), sizeof(Ip6::Address));
     AddData(aDestination.GetBytes(), sizeof(Ip6::Address));
-    AddUint16(length);
+    AddUint16(offsetRange.GetLength());
     AddUint16(static_cast<uint16_t>(aIpProto));
 
     // Add message content (from offset to the end) to checksum.
 
-    aMessage.GetFirstChunk(aMessage.GetOffset(), length, chunk);
+    Message::ChunkIterator iterator(aMessage, offsetRange);
 
-    while (chunk.GetLength() > 0)
+    while (iterator.GetNextChunk(bytes, length))
     {
-        AddData(chunk.GetBytes(), chunk.GetLength());
-        aMessage.GetNextChunk(length, chunk);
+        AddData(bytes, length);
     }
 }
 
@@ -125,8 +155,11 @@ void Checksum::Calculate(const Ip4::Address &aSource,
                          uint8_t             aIpProto,
                          const Message      &aMessage)
 {
-    Message::Chunk chunk;
-    uint16_t       length = aMessage.DetermineLengthAfterOffset();
+    OffsetRange    offsetRange;
+    const uint8_t *bytes;
+    uint16_t       length;
+
+    offsetRange.InitFromMessageOffsetToEnd(aMessage);
 
     // Pseudo-header for checksum calculation (RFC-768/792/793).
     // Note: ICMP checksum won't count the pseudo header like TCP and UDP.
@@ -135,18 +168,63 @@ void Checksum::Calculate(const Ip4::Address &aSource,
         AddData(aSource.GetBytes(), sizeof(Ip4::Address));
         AddData(aDestination.GetBytes(), sizeof(Ip4::Address));
         AddUint16(static_cast<uint16_t>(aIpProto));
-        AddUint16(length);
+        AddUint16(offsetRange.GetLength());
     }
 
     // Add message content (from offset to the end) to checksum.
 
-    aMessage.GetFirstChunk(aMessage.GetOffset(), length, chunk);
+    Message::ChunkIterator iterator(aMessage, offsetRange);
+
+    while (iterator.GetNextChunk(bytes, length))
+    {
+        AddData(bytes, length);
+    }
+}
+
+void Checksum::Adjuster::AddData(const uint8_t *aBuffer, uint16_t aLength)
+{
+    for (; aLength >= 2; aBuffer += 2, aLength -= 2)
+    {
+        mDelta += (static_cast<uint32_t>(aBuffer[0]) << 8) | aBuffer[1];
+    }
+}
+
+void Checksum::Adjuster::RemoveData(const uint8_t *aBuffer, uint16_t aLength)
+{
+    for (; aLength >= 2; aBuffer += 2, aLength -= 2)
+    {
+        mDelta += static_cast<uint16_t>(~((static_cast<uint32_t>(aBuffer[0]) << 8) | aBuffer[1]));
+    }
+}
+
+void Checksum::Adjuster::ApplyTo(Message &aMessage, uint16_t aChecksumOffset) const
+{
+    uint32_t sum;
+    uint16_t checksum;
+
+    IgnoreError(aMessage.Read(aChecksumOffset, checksum));
 
-    while (chunk.GetLength() > 0)
+    // RFC 1624: HC' = ~(~HC + ~m + m'). `mDelta` holds the one's
+    // complement of the old field values plus the new field values,
+    // so the updated checksum is the complement of the folded sum of
+    // `mDelta` and the complement of the current checksum.
+
+    sum = static_cast<uint16_t>(~BigEndian::HostSwap16(checksum));
+    sum += mDelta;
+
+    while ((sum >> 16) != 0)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    checksum = static_cast<uint16_t>(~sum);
+
+    if (checksum == 0)
     {
-        AddData(chunk.GetBytes(), chunk.GetLength());
-        aMessage.GetNextChunk(length, chunk);
+        checksum = 0xffff;
     }
+
+    aMessage.Write(aChecksumOffset, BigEndian::HostSwap16(checksum));
 }
 
 Error Checksum::VerifyMessageChecksum(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo, uint8_t aIpProto)
@@ -154,6 +232,13 @@ Error Checksum::VerifyMessageChecksum(const Message &aMessage, const Ip6::Messag
     Error    error = kErrorNone;
     Checksum checksum;
 
+#if OPENTHREAD_CONFIG_IP6_CHECKSUM_OFFLOAD_BY_HOST_ENABLE
+    // The host networking stack has already computed or verified the
+    // checksum of any datagram it hands over.
+
+    VerifyOrExit(!aMessage.IsOriginHostTrusted());
+#endif
+
     checksum.Calculate(aMessageInfo.GetPeerAddr(), aMessageInfo.GetSockAddr(), aIpProto, aMessage);
 
     if (checksum.GetValue() != kValidRxChecksum)
@@ -162,6 +247,9 @@ Error Checksum::VerifyMessageChecksum(const Message &aMessage, const Ip6::Messag
         error = kErrorDrop;
     }
 
+#if OPENTHREAD_CONFIG_IP6_CHECKSUM_OFFLOAD_BY_HOST_ENABLE
+exit:
+#endif
     return error;
 }
 
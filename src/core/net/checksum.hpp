@@ -104,6 +104,70 @@ public:
      */
     static void UpdateIp4HeaderChecksum(Ip4::Header &aHeader);
 
+    /**
+     * Represents an incremental checksum adjustment (RFC 1624).
+     *
+     * Collects the old and new values of fields being rewritten in a checksummed region (e.g., addresses in the
+     * pseudo-header, or port numbers in the transport header) and then applies the resulting adjustment directly to
+     * the checksum field in a message. This makes the cost of a rewrite proportional to the rewritten fields instead
+     * of requiring a full checksum recalculation over the payload.
+     */
+    class Adjuster
+    {
+    public:
+        /**
+         * Initializes the `Adjuster` with no adjustment.
+         */
+        Adjuster(void)
+            : mDelta(0)
+        {
+        }
+
+        /**
+         * Accounts for a data field (as big-endian 16-bit words) being written into the checksummed region.
+         *
+         * @param[in] aBuffer  A pointer to the buffer containing the new field value.
+         * @param[in] aLength  The field length (in bytes). MUST be an even number.
+         */
+        void AddData(const uint8_t *aBuffer, uint16_t aLength);
+
+        /**
+         * Accounts for a data field (as big-endian 16-bit words) being removed from the checksummed region.
+         *
+         * @param[in] aBuffer  A pointer to the buffer containing the old field value.
+         * @param[in] aLength  The field length (in bytes). MUST be an even number.
+         */
+        void RemoveData(const uint8_t *aBuffer, uint16_t aLength);
+
+        /**
+         * Accounts for a `uint16_t` field value being written into the checksummed region.
+         *
+         * @param[in] aUint16  The new field value.
+         */
+        void AddUint16(uint16_t aUint16) { mDelta += aUint16; }
+
+        /**
+         * Accounts for a `uint16_t` field value being removed from the checksummed region.
+         *
+         * @param[in] aUint16  The old field value.
+         */
+        void RemoveUint16(uint16_t aUint16) { mDelta += static_cast<uint16_t>(~aUint16); }
+
+        /**
+         * Applies the collected adjustment to the checksum field in a given message.
+         *
+         * The current checksum value at @p aChecksumOffset MUST be valid for the old field values (in particular,
+         * it cannot be an omitted zero UDP checksum). A resulting zero checksum is written as `0xffff`.
+         *
+         * @param[in,out] aMessage         The message to update the checksum in.
+         * @param[in]     aChecksumOffset  The offset in @p aMessage of the (big-endian) checksum field.
+         */
+        void ApplyTo(Message &aMessage, uint16_t aChecksumOffset) const;
+
+    private:
+        uint32_t mDelta;
+    };
+
 private:
     Checksum(void)
         : mValue(0)
@@ -121,6 +121,8 @@ private:
     Error ProcessIaNaOption(const Message &aMessage);
     Error ProcessIaAddressOption(const IaAddressOption &aOption);
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged;
+
     void HandleNotifierEvents(Events aEvents);
     void UpdateAddresses(void);
 
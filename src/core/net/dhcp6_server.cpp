@@ -61,12 +61,29 @@ void Server::HandleNotifierEvents(Events aEvents)
 
 void Server::UpdateService(void)
 {
-    uint16_t                        rloc16 = Get<Mle::Mle>().GetRloc16();
+    uint16_t                        rloc16        = Get<Mle::Mle>().GetRloc16();
+    bool                            hasDhcpPrefix = false;
     NetworkData::Iterator           iterator;
     NetworkData::OnMeshPrefixConfig prefixConfig;
     Lowpan::Context                 lowpanContext;
 
-    // remove dhcp agent aloc and prefix delegation
+    // Check whether any DHCPv6/configure prefix remains in network data.
+
+    iterator = NetworkData::kIteratorInit;
+
+    while (Get<NetworkData::Leader>().GetNext(iterator, rloc16, prefixConfig) == kErrorNone)
+    {
+        if (prefixConfig.mDhcp || prefixConfig.mConfigure)
+        {
+            hasDhcpPrefix = true;
+            break;
+        }
+    }
+
+    // Remove dhcp agent aloc and prefix delegation for entries no longer
+    // in network data. A single context lookup per agent replaces the
+    // previous per-agent walk over all network data entries.
+
     for (PrefixAgent &prefixAgent : mPrefixAgents)
     {
         bool found = false;
@@ -76,23 +93,10 @@ void Server::UpdateService(void)
             continue;
         }
 
-        iterator = NetworkData::kIteratorInit;
-
-        while (Get<NetworkData::Leader>().GetNext(iterator, rloc16, prefixConfig) == kErrorNone)
+        if (hasDhcpPrefix)
         {
-            if (!(prefixConfig.mDhcp || prefixConfig.mConfigure))
-            {
-                continue;
-            }
-
             Get<NetworkData::Leader>().FindContextForAddress(prefixAgent.GetPrefixAsAddress(), lowpanContext);
-
-            if (lowpanContext.MatchesContextId(prefixAgent.GetContextId()))
-            {
-                // still in network data
-                found = true;
-                break;
-            }
+            found = lowpanContext.MatchesContextId(prefixAgent.GetContextId());
         }
 
         if (!found)
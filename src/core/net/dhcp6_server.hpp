@@ -163,6 +163,8 @@ private:
 
     static constexpr uint16_t kNumPrefixes = OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_PREFIXES;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged;
+
     void  HandleNotifierEvents(Events aEvents);
     void  UpdateService(void);
     void  Start(void);
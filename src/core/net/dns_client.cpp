@@ -786,6 +786,7 @@ Client::Client(Instance &aInstance)
 #if OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_ENABLE
     ClearAllBytes(mSendLink);
 #endif
+    ClearAllBytes(mCounters);
 }
 
 Error Client::Start(void)
@@ -822,6 +823,10 @@ void Client::Stop(void)
 #endif
 
     mLimitedQueryServers.Clear();
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES
+    mResponseCache.DequeueAndFreeAll();
+#endif
 }
 
 #if OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_ENABLE
@@ -1052,6 +1057,36 @@ Error Client::StartQuery(QueryInfo &aInfo, const char *aLabel, const char *aName
     SuccessOrExit(error = AllocateQuery(aInfo, aLabel, aName, query));
 
     mMainQueries.Enqueue(*query);
+    mCounters.mQueries++;
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES
+    if ((aSecondType == kNoQuery) && ServeFromResponseCache(*query, aInfo))
+    {
+        // The query is finalized from `HandleTimer()` using the
+        // cached response (cloned into its `mSavedResponse`).
+
+        mCounters.mCacheHits++;
+        ExitNow();
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+    if ((aSecondType == kNoQuery) && (FindInFlightMatchingQuery(aInfo, *query) != nullptr))
+    {
+        // Coalesce with the in-flight query asking the same question:
+        // delay our own transmission and wait to be answered from its
+        // response in `FinalizeCoalescedQueries()`. If that response
+        // never arrives, the retry timer transmits this query
+        // normally.
+
+        aInfo.mRetransmissionTime = TimerMilli::GetNow() + aInfo.mConfig.GetResponseTimeout();
+        UpdateQuery(*query, aInfo);
+        mTimer.FireAtIfEarlier(aInfo.mRetransmissionTime);
+
+        mCounters.mCoalescedQueries++;
+        ExitNow();
+    }
+#endif
 
     error = SendQuery(*query, aInfo, /* aUpdateTimer */ true);
     VerifyOrExit(error == kErrorNone, FreeQuery(*query));
@@ -1423,6 +1458,302 @@ exit:
     return matchedQuery;
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+
+bool Client::IsCoalescableQueryType(QueryType aQueryType)
+{
+    bool coalescable;
+
+    switch (aQueryType)
+    {
+    case kIp6AddressQuery:
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    case kIp4AddressQuery:
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
+    case kBrowseQuery:
+#endif
+        coalescable = true;
+        break;
+
+    default:
+        coalescable = false;
+        break;
+    }
+
+    return coalescable;
+}
+
+Client::Query *Client::FindInFlightMatchingQuery(const QueryInfo &aInfo, const Query &aQuery)
+{
+    // Searches for an already transmitted query asking the same
+    // question (same name, type, and server) as the newly started
+    // `aQuery` (which itself is skipped during the search).
+
+    Query    *matchedQuery = nullptr;
+    QueryInfo info;
+    Name      name;
+
+    VerifyOrExit(IsCoalescableQueryType(aInfo.mQueryType));
+    VerifyOrExit(aInfo.mConfig.GetTransportProto() == QueryConfig::kDnsTransportUdp);
+
+    name.SetFromMessage(aQuery, kNameOffsetInQuery);
+
+    for (Query &query : mMainQueries)
+    {
+        uint16_t offset = kNameOffsetInQuery;
+
+        if (&query == &aQuery)
+        {
+            continue;
+        }
+
+        info.ReadFrom(query);
+
+        if ((info.mMessageId == 0) || (info.mQueryType != aInfo.mQueryType) ||
+            (info.mConfig.GetServerSockAddr() != aInfo.mConfig.GetServerSockAddr()) ||
+            (info.mConfig.GetRecursionFlag() != aInfo.mConfig.GetRecursionFlag()))
+        {
+            continue;
+        }
+
+        if (Name::CompareName(query, offset, name) != kErrorNone)
+        {
+            continue;
+        }
+
+        matchedQuery = &query;
+        break;
+    }
+
+exit:
+    return matchedQuery;
+}
+
+void Client::FinalizeCoalescedQueries(Query &aQuery, const Message &aResponseMessage, Error aError)
+{
+    // Serves the pending queries coalesced with `aQuery` (i.e.,
+    // asking the same question but not yet transmitted) using the
+    // response received for `aQuery`.
+
+    Query    &mainQuery = FindMainQuery(aQuery);
+    QueryInfo queryInfo;
+    QueryInfo info;
+    Name      name;
+
+    queryInfo.ReadFrom(aQuery);
+
+    VerifyOrExit(IsCoalescableQueryType(queryInfo.mQueryType));
+
+    name.SetFromMessage(aQuery, kNameOffsetInQuery);
+
+    for (Query &query : mMainQueries)
+    {
+        uint16_t offset = kNameOffsetInQuery;
+
+        if (&query == &mainQuery)
+        {
+            continue;
+        }
+
+        info.ReadFrom(query);
+
+        if ((info.mMessageId != 0) || (info.mSavedResponse != nullptr) || (info.mQueryType != queryInfo.mQueryType) ||
+            (info.mConfig.GetServerSockAddr() != queryInfo.mConfig.GetServerSockAddr()))
+        {
+            continue;
+        }
+
+        if (Name::CompareName(query, offset, name) != kErrorNone)
+        {
+            continue;
+        }
+
+        if (aError != kErrorNone)
+        {
+            FinalizeQuery(query, aError);
+        }
+        else
+        {
+            PrepareResponseAndFinalize(query, aResponseMessage, nullptr);
+        }
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES
+
+bool Client::IsCacheableQueryType(QueryType aQueryType)
+{
+    bool cacheable = (aQueryType == kIp6AddressQuery);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    cacheable = cacheable || (aQueryType == kIp4AddressQuery);
+#endif
+
+    return cacheable;
+}
+
+bool Client::ServeFromResponseCache(Query &aQuery, QueryInfo &aInfo)
+{
+    bool     served = false;
+    Message *cachedResponse;
+
+    VerifyOrExit(IsCacheableQueryType(aInfo.mQueryType));
+    VerifyOrExit(aInfo.mConfig.GetTransportProto() == QueryConfig::kDnsTransportUdp);
+
+    cachedResponse = FindCachedResponse(aQuery, aInfo);
+    VerifyOrExit(cachedResponse != nullptr);
+
+    aInfo.mSavedResponse = cachedResponse->Clone<kNoReservedHeader>();
+    VerifyOrExit(aInfo.mSavedResponse != nullptr);
+
+    // Finalizing the query (and invoking its callback) is deferred to
+    // `HandleTimer()` so that the caller observes the same
+    // asynchronous behavior as a query answered by the server.
+
+    aInfo.mRetransmissionTime = TimerMilli::GetNow();
+    UpdateQuery(aQuery, aInfo);
+    mTimer.FireAtIfEarlier(aInfo.mRetransmissionTime);
+
+    served = true;
+
+exit:
+    return served;
+}
+
+Message *Client::FindCachedResponse(const Query &aQuery, const QueryInfo &aInfo)
+{
+    // Searches the response cache for a fresh response answering the
+    // same question as `aQuery`. Expired entries encountered during
+    // the search are evicted.
+
+    Message *matchedResponse = nullptr;
+    Message *next;
+    Name     name;
+
+    name.SetFromMessage(aQuery, kNameOffsetInQuery);
+
+    for (Message *response = mResponseCache.GetHead(); response != nullptr; response = next)
+    {
+        CachedResponseFooter footer;
+        Question             question;
+        uint16_t             offset;
+
+        next = response->GetNext();
+
+        SuccessOrAssert(response->Read(response->GetLength() - sizeof(footer), footer));
+
+        if (TimerMilli::GetNow() >= footer.mExpireTime)
+        {
+            mResponseCache.DequeueAndFree(*response);
+            continue;
+        }
+
+        offset = response->GetOffset() + sizeof(Header);
+
+        if (Name::CompareName(*response, offset, name) != kErrorNone)
+        {
+            continue;
+        }
+
+        if ((response->Read(offset, question) != kErrorNone) ||
+            (question.GetType() != DetermineQuestionRecordType(aInfo)))
+        {
+            continue;
+        }
+
+        matchedResponse = response;
+        break;
+    }
+
+    return matchedResponse;
+}
+
+void Client::UpdateResponseCache(const Query &aQuery, const Message &aResponseMessage)
+{
+    QueryInfo            info;
+    Header               header;
+    uint16_t             offset;
+    uint32_t             minTtl = kMaxCachedResponseTtl;
+    uint16_t             numEntries;
+    Message             *existingResponse;
+    Message             *cachedResponse = nullptr;
+    CachedResponseFooter footer;
+
+    info.ReadFrom(aQuery);
+
+    VerifyOrExit(IsCacheableQueryType(info.mQueryType));
+    VerifyOrExit(info.mConfig.GetTransportProto() == QueryConfig::kDnsTransportUdp);
+
+    offset = aResponseMessage.GetOffset();
+    SuccessOrExit(aResponseMessage.Read(offset, header));
+    offset += sizeof(Header);
+
+    VerifyOrExit(header.GetQuestionCount() == 1);
+    VerifyOrExit(header.GetAnswerCount() > 0);
+
+    SuccessOrExit(Name::ParseName(aResponseMessage, offset));
+    offset += sizeof(Question);
+
+    // The cached response expires based on the minimum TTL among the
+    // answer records (capped at `kMaxCachedResponseTtl`). Responses
+    // with a zero TTL are not cached.
+
+    for (uint16_t num = 0; num < header.GetAnswerCount(); num++)
+    {
+        ResourceRecord record;
+
+        SuccessOrExit(Name::ParseName(aResponseMessage, offset));
+        SuccessOrExit(aResponseMessage.Read(offset, record));
+        minTtl = Min(minTtl, record.GetTtl());
+        offset += static_cast<uint16_t>(record.GetSize());
+    }
+
+    VerifyOrExit(minTtl > 0);
+
+    // Replace any cached response answering the same question, and
+    // evict the oldest entry when the cache is full.
+
+    existingResponse = FindCachedResponse(aQuery, info);
+
+    if (existingResponse != nullptr)
+    {
+        mResponseCache.DequeueAndFree(*existingResponse);
+    }
+
+    numEntries = 0;
+
+    for (const Message &response : mResponseCache)
+    {
+        OT_UNUSED_VARIABLE(response);
+        numEntries++;
+    }
+
+    if (numEntries >= OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES)
+    {
+        mResponseCache.DequeueAndFree(*mResponseCache.GetHead());
+    }
+
+    cachedResponse = aResponseMessage.Clone<kNoReservedHeader>();
+    VerifyOrExit(cachedResponse != nullptr);
+
+    footer.mExpireTime = TimerMilli::GetNow() + Time::SecToMsec(minTtl);
+    SuccessOrExit(cachedResponse->Append(footer));
+
+    mResponseCache.Enqueue(*cachedResponse);
+    cachedResponse = nullptr;
+
+exit:
+    FreeMessage(cachedResponse);
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES
+
 void Client::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMsgInfo)
 {
     OT_UNUSED_VARIABLE(aMsgInfo);
@@ -1455,12 +1786,24 @@ void Client::ProcessResponse(const Message &aResponseMessage)
         }
 #endif
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+        FinalizeCoalescedQueries(*query, aResponseMessage, responseError);
+#endif
+
         FinalizeQuery(*query, responseError);
         ExitNow();
     }
 
     // Received successful response from server.
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES
+    UpdateResponseCache(*query, aResponseMessage);
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+    FinalizeCoalescedQueries(*query, aResponseMessage, kErrorNone);
+#endif
+
 #if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
     ResolveHostAddressIfNeeded(*query, aResponseMessage);
 #endif
@@ -1649,6 +1992,16 @@ void Client::HandleTimer(void)
 
             if (info.mSavedResponse != nullptr)
             {
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES
+                if (info.mMessageId == 0)
+                {
+                    // The query was answered from the response cache
+                    // (in `ServeFromResponseCache()`); finalize it.
+
+                    PrepareResponseAndFinalize(*query, *info.mSavedResponse, nullptr);
+                    break;
+                }
+#endif
                 continue;
             }
 
@@ -715,6 +715,13 @@ public:
      */
     void ResetDefaultConfig(void);
 
+    /**
+     * Returns the counters of the DNS client.
+     *
+     * @returns  A reference to the counters of the DNS client.
+     */
+    const otDnsClientCounters &GetCounters(void) const { return mCounters; }
+
     /**
      * Sends an address resolution DNS query for AAAA (IPv6) record for a given host name.
      *
@@ -932,6 +939,15 @@ private:
 
     static constexpr uint16_t kNameOffsetInQuery = sizeof(QueryInfo);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES
+    struct CachedResponseFooter // Appended at the end of a cached response message.
+    {
+        TimeMilli mExpireTime; // Time when the cached response expires (based on min TTL of answer records).
+    };
+
+    static constexpr uint32_t kMaxCachedResponseTtl = 600; // Max TTL of a cached response (in seconds).
+#endif
+
     Error       StartQuery(QueryInfo &aInfo, const char *aLabel, const char *aName, QueryType aSecondType = kNoQuery);
     Error       AllocateQuery(const QueryInfo &aInfo, const char *aLabel, const char *aName, Query *&aQuery);
     void        FreeQuery(Query &aQuery);
@@ -944,6 +960,17 @@ private:
     static void GetQueryTypeAndCallback(const Query &aQuery, QueryType &aType, Callback &aCallback, void *&aContext);
     Error       AppendNameFromQuery(const Query &aQuery, Message &aMessage);
     Query      *FindQueryById(uint16_t aMessageId);
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+    static bool IsCoalescableQueryType(QueryType aQueryType);
+    Query      *FindInFlightMatchingQuery(const QueryInfo &aInfo, const Query &aQuery);
+    void        FinalizeCoalescedQueries(Query &aQuery, const Message &aResponseMessage, Error aError);
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES
+    static bool IsCacheableQueryType(QueryType aQueryType);
+    bool        ServeFromResponseCache(Query &aQuery, QueryInfo &aInfo);
+    Message    *FindCachedResponse(const Query &aQuery, const QueryInfo &aInfo);
+    void        UpdateResponseCache(const Query &aQuery, const Message &aResponseMessage);
+#endif
     void        HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMsgInfo);
     void        ProcessResponse(const Message &aResponseMessage);
     Error       ParseResponse(const Message &aResponseMessage, Query *&aQuery, Error &aResponseError);
@@ -1018,6 +1045,10 @@ private:
     QueryList   mMainQueries;
     RetryTimer  mTimer;
     QueryConfig mDefaultConfig;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_MAX_ENTRIES
+    MessageQueue mResponseCache;
+#endif
+    otDnsClientCounters mCounters;
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     bool mUserDidSetDefaultAddress;
 #endif
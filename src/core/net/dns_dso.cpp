@@ -1268,21 +1268,31 @@ void Dso::Connection::HandleTimer(NextFireTime &aNextTime)
             ExitNow();
         }
 
-        if (mKeepAlive.IsUsed() && mKeepAlive.IsExpired(aNextTime.GetNow()))
+        if (mKeepAlive.IsUsed())
         {
             // On client, if the Keep Alive interval elapses without any
             // DNS messages being sent or received, the client MUST take
             // action and send a DSO Keep Alive message.
             //
+            // A client also sends the Keep Alive message when its
+            // deadline falls within `kKeepAliveBatchWindow` from now,
+            // batching the transmissions of sessions with nearby
+            // deadlines into this wakeup (sending early is always
+            // permitted). The resets below align such sessions to a
+            // shared Keep Alive schedule going forward.
+            //
             // On server, if twice the Keep Alive interval value elapses
             // without any messages being sent or received, the server
             // considers the client delinquent and aborts the connection.
 
             if (IsClient())
             {
-                IgnoreError(SendKeepAliveMessage());
+                if (mKeepAlive.IsExpired(aNextTime.GetNow() + kKeepAliveBatchWindow))
+                {
+                    IgnoreError(SendKeepAliveMessage());
+                }
             }
-            else
+            else if (mKeepAlive.IsExpired(aNextTime.GetNow()))
             {
                 Disconnect(kForciblyAbort, kReasonKeepAliveTimeout);
                 ExitNow();
@@ -115,6 +115,15 @@ public:
      */
     static constexpr uint32_t kMinServerInactivityWaitTime = TimeMilli::SecToMsec(5);
 
+    /**
+     * The window (in msec) used to batch Keep Alive transmissions across DSO sessions.
+     *
+     * On a timer wakeup, a client also sends the Keep Alive message of any session whose deadline falls within
+     * this window, aligning idle sessions to a shared Keep Alive schedule (one CPU wakeup per interval rather
+     * than one per session). Zero disables batching.
+     */
+    static constexpr uint32_t kKeepAliveBatchWindow = OPENTHREAD_CONFIG_DNS_DSO_KEEP_ALIVE_BATCH_WINDOW;
+
     /**
      * Represents a DSO TLV.
      */
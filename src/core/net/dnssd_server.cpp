@@ -247,6 +247,7 @@ Server::Response::Response(Instance &aInstance)
     // `mHeader` constructors already clears it
 
     mOffsets.Clear();
+    mQueryName[0] = kNullChar;
 }
 
 Error Server::Response::AllocateAndInitFrom(const Request &aRequest)
@@ -439,12 +440,16 @@ Error Server::Response::ParseQueryName(void)
     // offsets, and validates that the query name is for
     // `kDefaultDomainName` ("default.service.arpa.").
 
-    Error        error = kErrorNone;
-    Name::Buffer name;
-    uint16_t     offset;
+    Error    error = kErrorNone;
+    uint16_t offset;
+
+    // The query name is read once into `mQueryName`, so later name
+    // checks (e.g., matching against every SRP host and service in
+    // `ResolveBySrp()`) can use plain string comparisons instead of
+    // re-parsing the name labels from the query message per check.
 
     offset = sizeof(Header);
-    SuccessOrExit(error = Name::ReadName(*mMessage, offset, name));
+    SuccessOrExit(error = Name::ReadName(*mMessage, offset, mQueryName));
 
     // `mOffsets.mServiceName` may be updated as we read labels and if we
     // determine that the query name is a sub-type service.
@@ -487,7 +492,7 @@ exit:
 
 void Server::Response::ReadQueryName(Name::Buffer &aName) const { Server::ReadQueryName(*mMessage, aName); }
 
-bool Server::Response::QueryNameMatches(const char *aName) const { return Server::QueryNameMatches(*mMessage, aName); }
+bool Server::Response::QueryNameMatches(const char *aName) const { return Name::IsSameDomain(mQueryName, aName); }
 
 bool Server::Response::QueryNameIsForDomain(const char *aDomainName) const
 {
@@ -1412,6 +1417,7 @@ void Server::Response::InitFrom(ProxyQuery &aQuery, const ProxyQueryInfo &aInfo)
     IgnoreError(mMessage->Read(0, mHeader));
     mQuestions = aInfo.mQuestions;
     mOffsets   = aInfo.mOffsets;
+    Server::ReadQueryName(*mMessage, mQueryName);
 }
 
 void Server::Response::Answer(const ServiceInstanceInfo &aInstanceInfo, const Ip6::MessageInfo &aMessageInfo)
@@ -487,6 +487,7 @@ private:
         Questions         mQuestions;
         Section           mSection;
         NameOffsets       mOffsets;
+        Name::Buffer      mQueryName;
     };
 
     struct ProxyQueryInfo : Message::FooterData<ProxyQueryInfo>
@@ -45,6 +45,11 @@ Icmp::Icmp(Instance &aInstance)
     , mEchoSequence(1)
     , mEchoMode(OT_ICMP6_ECHO_HANDLER_ALL)
 {
+    for (uint8_t index = 0; index < kNumErrorTypes; index++)
+    {
+        mErrorTokens[index]     = kErrorBurst;
+        mErrorRefillTime[index] = TimerMilli::GetNow();
+    }
 }
 
 Error Icmp::RegisterHandler(Handler &aHandler) { return mHandlers.Add(aHandler); }
@@ -99,6 +104,8 @@ Error Icmp::SendError(Header::Type aType, Header::Code aCode, const MessageInfo
         VerifyOrExit(!aHeaders.GetIcmpHeader().IsError());
     }
 
+    VerifyOrExit(AllowError(aType), error = kErrorDrop);
+
     messageInfoLocal = aMessageInfo;
 
     VerifyOrExit((message = Get<Ip6>().NewMessage(settings)) != nullptr, error = kErrorNoBufs);
@@ -121,6 +128,51 @@ exit:
     return error;
 }
 
+bool Icmp::AllowError(Header::Type aType)
+{
+    // Implements a per-error-type token bucket. Each bucket holds up
+    // to `kErrorBurst` tokens and refills at `kErrorRateLimit` tokens
+    // per second (refilled lazily when an error is sent). This bounds
+    // the buffer usage of error storms (e.g., during routing flaps)
+    // without letting one error type starve the others.
+
+    static_assert(Header::kTypeParameterProblem - Header::kTypeDstUnreach == kNumErrorTypes - 1,
+                  "ICMPv6 error types are expected to be contiguous");
+
+    bool      allow = true;
+    uint8_t   index;
+    TimeMilli now;
+    uint32_t  refill;
+
+    VerifyOrExit(kErrorRateLimit != 0);
+    VerifyOrExit((aType >= Header::kTypeDstUnreach) && (aType <= Header::kTypeParameterProblem));
+
+    index  = static_cast<uint8_t>(aType - Header::kTypeDstUnreach);
+    now    = TimerMilli::GetNow();
+    refill = (now - mErrorRefillTime[index]) * kErrorRateLimit / Time::kOneSecondInMsec;
+
+    if (refill > 0)
+    {
+        mErrorTokens[index] = static_cast<uint8_t>(Min<uint32_t>(kErrorBurst, mErrorTokens[index] + refill));
+
+        // Advance the refill time by the duration worth of the added
+        // tokens (rather than to `now`) so that the remainder is not
+        // lost to rounding.
+
+        // The `Max()` guards against a literal division by zero when
+        // the rate limiting is disabled (this code is unreachable in
+        // that case).
+
+        mErrorRefillTime[index] += refill * Time::kOneSecondInMsec / Max<uint32_t>(kErrorRateLimit, 1);
+    }
+
+    VerifyOrExit(mErrorTokens[index] > 0, allow = false);
+    mErrorTokens[index]--;
+
+exit:
+    return allow;
+}
+
 Error Icmp::HandleMessage(Message &aMessage, MessageInfo &aMessageInfo)
 {
     Error  error = kErrorNone;
@@ -45,6 +45,7 @@
 #include "common/locator.hpp"
 #include "common/message_allocator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/time.hpp"
 #include "net/ip6_headers.hpp"
 
 namespace ot {
@@ -149,6 +150,7 @@ public:
      *
      * @retval kErrorNone     Successfully enqueued the ICMPv6 error message.
      * @retval kErrorNoBufs   Insufficient buffers available.
+     * @retval kErrorDrop     The error message was suppressed by the error rate limiter.
      */
     Error SendError(Header::Type aType, Header::Code aCode, const MessageInfo &aMessageInfo, const Message &aMessage);
 
@@ -162,6 +164,7 @@ public:
      *
      * @retval kErrorNone     Successfully enqueued the ICMPv6 error message.
      * @retval kErrorNoBufs   Insufficient buffers available.
+     * @retval kErrorDrop     The error message was suppressed by the error rate limiter.
      */
     Error SendError(Header::Type aType, Header::Code aCode, const MessageInfo &aMessageInfo, const Headers &aHeaders);
 
@@ -210,12 +213,21 @@ public:
     uint16_t GetEchoSequence(void) const { return mEchoSequence; }
 
 private:
+    static constexpr uint32_t kErrorRateLimit = OPENTHREAD_CONFIG_ICMP6_ERROR_RATE_LIMIT_PER_SECOND;
+    static constexpr uint8_t  kErrorBurst     = OPENTHREAD_CONFIG_ICMP6_ERROR_RATE_LIMIT_BURST;
+
+    // Number of ICMPv6 error types (`kTypeDstUnreach` through `kTypeParameterProblem`).
+    static constexpr uint8_t kNumErrorTypes = 4;
+
     Error HandleEchoRequest(Message &aRequestMessage, const MessageInfo &aMessageInfo);
+    bool  AllowError(Header::Type aType);
 
     LinkedList<Handler> mHandlers;
 
     uint16_t        mEchoSequence;
     otIcmp6EchoMode mEchoMode;
+    uint8_t         mErrorTokens[kNumErrorTypes];
+    TimeMilli       mErrorRefillTime[kNumErrorTypes];
 };
 
 /**
@@ -52,6 +52,9 @@ Ip6::Ip6(Instance &aInstance)
     , mReceiveFilterEnabled(false)
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     , mTmfOriginFilterEnabled(true)
+#endif
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE
+    , mIsHandlingSendQueue(false)
 #endif
     , mSendQueueTask(aInstance)
     , mIcmp(aInstance)
@@ -383,7 +386,20 @@ exit:
 void Ip6::EnqueueDatagram(Message &aMessage)
 {
     mSendQueue.Enqueue(aMessage);
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE
+    // Drain the send queue synchronously, avoiding the tasklet
+    // round-trip latency. When already draining (e.g., a fragment or
+    // multicast copy enqueued from within `HandleSendQueue()`), the
+    // outer drain loop picks up the new message.
+
+    if (!mIsHandlingSendQueue)
+    {
+        HandleSendQueue();
+    }
+#else
     mSendQueueTask.Post();
+#endif
 }
 
 Error Ip6::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, uint8_t aIpProto)
@@ -449,6 +465,10 @@ Error Ip6::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, uint8_t aI
 
     aMessage.SetMulticastLoop(aMessageInfo.GetMulticastLoop());
 
+#if OPENTHREAD_CONFIG_MESSAGE_LIFECYCLE_TRACE_ENABLE
+    aMessage.MarkLifecycleQueueTime();
+#endif
+
     if (aMessage.GetLength() > kMaxDatagramLength)
     {
         error = FragmentDatagram(aMessage, aIpProto);
@@ -467,11 +487,19 @@ void Ip6::HandleSendQueue(void)
 {
     Message *message;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE
+    mIsHandlingSendQueue = true;
+#endif
+
     while ((message = mSendQueue.GetHead()) != nullptr)
     {
         mSendQueue.Dequeue(*message);
         IgnoreError(HandleDatagram(OwnedPtr<Message>(message)));
     }
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE
+    mIsHandlingSendQueue = false;
+#endif
 }
 
 Error Ip6::ReadHopByHopHeader(const Message &aMessage, OffsetRange &aOffsetRange, HopByHopHeader &aHbhHeader) const
@@ -901,7 +929,7 @@ Error Ip6::Receive(Header            &aIp6Header,
     {
 #if OPENTHREAD_CONFIG_TCP_ENABLE
     case kProtoTcp:
-        error = mTcp.HandleMessage(aIp6Header, *messagePtr, messageInfo);
+        error = mTcp.HandleMessage(aIp6Header, messagePtr, messageInfo);
         break;
 #endif
     case kProtoUdp:
@@ -1079,7 +1107,7 @@ void Ip6::DetermineAction(const Message &aMessage,
                           const Header  &aHeader,
                           bool          &aForwardThread,
                           bool          &aForwardHost,
-                          bool          &aReceive) const
+                          bool          &aReceive)
 {
     // Determine `aForwardThread`, `aForwardHost` and `aReceive`
     // based on the destination address and message origin.
@@ -1169,10 +1197,15 @@ void Ip6::DetermineAction(const Message &aMessage,
 
     // Destination is unicast
 
-    if (Get<ThreadNetif>().HasUnicastAddress(aHeader.GetDestination()))
     {
-        aReceive = true;
-        ExitNow();
+        Netif::UnicastAddress *destAddress = Get<ThreadNetif>().FindUnicastAddress(aHeader.GetDestination());
+
+        if (destAddress != nullptr)
+        {
+            destAddress->mRxCounter++;
+            aReceive = true;
+            ExitNow();
+        }
     }
 
     if (aHeader.GetDestination().IsLinkLocalUnicast())
@@ -1245,6 +1278,12 @@ Error Ip6::HandleDatagram(OwnedPtr<Message> aMessagePtr, bool aIsReassembled)
     nextHeader = header.GetNextHeader();
     SuccessOrExit(error = HandleExtensionHeaders(aMessagePtr, header, nextHeader, receive));
 
+    // Annotate the message with the parsed header info (payload
+    // protocol, ECN, payload offset) so that later processing stages
+    // can use the `Message` accessors instead of re-reading and
+    // re-parsing the header bytes.
+    aMessagePtr->SetIp6ReceiveInfo(nextHeader, header.GetEcn(), aMessagePtr->GetOffset());
+
     if (receive && (nextHeader == kProtoIp6))
     {
         // Process the embedded IPv6 message in an IPv6 tunnel message.
@@ -1260,6 +1299,7 @@ Error Ip6::HandleDatagram(OwnedPtr<Message> aMessagePtr, bool aIsReassembled)
                                                    forwardThread ? kCopyMessageToUse : kTakeMessageCustody));
         messagePtr->SetMulticastLoop(multicastLoop);
         messagePtr->RemoveHeader(messagePtr->GetOffset());
+        messagePtr->ClearIp6ReceiveInfo();
 
         Get<MeshForwarder>().LogMessage(MeshForwarder::kMessageReceive, *messagePtr);
 
@@ -1525,6 +1565,11 @@ exit:
     {
         counter->mPackets++;
         counter->mBytes += aMessageLength;
+
+#if OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE
+        UpdateBorderRoutingPrefixCounters(aIsInbound ? aHeader.GetDestination() : aHeader.GetSource(), aMessageLength,
+                                          aIsInbound);
+#endif
     }
     if (internetCounter)
     {
@@ -1533,6 +1578,66 @@ exit:
     }
 }
 
+#if OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE
+
+void Ip6::UpdateBorderRoutingPrefixCounters(const Address &aMeshSideAddress, uint16_t aMessageLength, bool aIsInbound)
+{
+    // Attributes a forwarded message to the /64 prefix of its
+    // mesh-side address (the destination for inbound messages, the
+    // source for outbound messages), which corresponds to the OMR
+    // prefix of the mesh subnet sending or receiving the traffic.
+    // The table is bounded: once it is full, traffic not matching
+    // any tracked prefix is counted only in the aggregate counters.
+
+    BrPrefixCounters  *entry = nullptr;
+    otPacketsAndBytes *counter;
+    Prefix             prefix;
+
+    VerifyOrExit(!aMeshSideAddress.IsMulticast());
+
+    aMeshSideAddress.GetPrefix(NetworkPrefix::kLength, prefix);
+
+    for (uint16_t index = 0; index < mBrPrefixCountersLength; index++)
+    {
+        if (prefix == AsCoreType(&mBrPrefixCounters[index].mPrefix))
+        {
+            entry = &mBrPrefixCounters[index];
+            break;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        VerifyOrExit(mBrPrefixCountersLength < kBrPrefixCountersTableSize);
+
+        entry = &mBrPrefixCounters[mBrPrefixCountersLength++];
+        ClearAllBytes(*entry);
+        entry->mPrefix = prefix;
+    }
+
+    counter = aIsInbound ? &entry->mInbound : &entry->mOutbound;
+    counter->mPackets++;
+    counter->mBytes += aMessageLength;
+
+exit:
+    return;
+}
+
+Error Ip6::GetNextBrPrefixCounters(uint8_t &aIterator, BrPrefixCounters &aCounters) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aIterator < mBrPrefixCountersLength, error = kErrorNotFound);
+
+    aCounters = mBrPrefixCounters[aIterator];
+    aIterator++;
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE
+
 #endif // OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE
 
 // LCOV_EXCL_START
@@ -1570,22 +1675,39 @@ const char *Ip6::EcnToString(Ecn aEcn)
 
 Error Headers::ParseFrom(const Message &aMessage)
 {
-    Error error = kErrorParse;
+    Error    error = kErrorParse;
+    uint16_t payloadOffset;
 
     Clear();
 
     SuccessOrExit(mIp6Header.ParseFrom(aMessage));
 
+    if (aMessage.IsIp6ReceiveInfoSet())
+    {
+        // Use the info annotated when the datagram was received,
+        // which also locates the payload when extension headers
+        // precede it. The next-header field is replaced with the
+        // payload protocol so that `GetIpProto()` and the parsed
+        // payload header stay consistent.
+
+        mIp6Header.SetNextHeader(aMessage.GetIp6Proto());
+        payloadOffset = aMessage.GetIp6PayloadOffset();
+    }
+    else
+    {
+        payloadOffset = sizeof(Header);
+    }
+
     switch (mIp6Header.GetNextHeader())
     {
     case kProtoUdp:
-        SuccessOrExit(aMessage.Read(sizeof(Header), mHeader.mUdp));
+        SuccessOrExit(aMessage.Read(payloadOffset, mHeader.mUdp));
         break;
     case kProtoTcp:
-        SuccessOrExit(aMessage.Read(sizeof(Header), mHeader.mTcp));
+        SuccessOrExit(aMessage.Read(payloadOffset, mHeader.mTcp));
         break;
     case kProtoIcmp6:
-        SuccessOrExit(aMessage.Read(sizeof(Header), mHeader.mIcmp));
+        SuccessOrExit(aMessage.Read(payloadOffset, mHeader.mIcmp));
         break;
     default:
         break;
@@ -38,6 +38,7 @@
 
 #include <stddef.h>
 
+#include <openthread/border_routing.h>
 #include <openthread/ip6.h>
 #include <openthread/nat64.h>
 #include <openthread/udp.h>
@@ -249,6 +250,11 @@ public:
      */
     void GetSendQueueInfo(PriorityQueue::Info &aQueueInfo) const { mSendQueue.GetInfo(aQueueInfo); }
 
+    /**
+     * Resets the tracked queue-depth watermark of the IPv6 send queue.
+     */
+    void ResetSendQueueWatermark(void) { mSendQueue.ResetMaxNumMessages(); }
+
     /**
      * Converts an IP protocol number to a string.
      *
@@ -295,7 +301,30 @@ public:
     /**
      * Resets the Border Routing counters.
      */
-    void ResetBorderRoutingCounters(void) { ClearAllBytes(mBrCounters); }
+    void ResetBorderRoutingCounters(void)
+    {
+        ClearAllBytes(mBrCounters);
+#if OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE
+        mBrPrefixCountersLength = 0;
+#endif
+    }
+
+#if OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE
+
+    typedef otBorderRoutingPrefixCounters BrPrefixCounters; ///< Per-prefix Border Routing counters.
+
+    /**
+     * Gets the next entry from the per-prefix Border Routing counter table.
+     *
+     * @param[in,out] aIterator  The iterator. To get the first entry, it should be set to zero.
+     * @param[out]    aCounters  A reference to return the entry.
+     *
+     * @retval kErrorNone      Successfully retrieved the next entry.
+     * @retval kErrorNotFound  No more entries in the table.
+     */
+    Error GetNextBrPrefixCounters(uint8_t &aIterator, BrPrefixCounters &aCounters) const;
+
+#endif // OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE
 
 #endif // OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE
 
@@ -339,7 +368,7 @@ private:
                           const Header  &aHeader,
                           bool          &aForwardThread,
                           bool          &aForwardHost,
-                          bool          &aReceive) const;
+                          bool          &aReceive);
     Error PassToHost(OwnedPtr<Message> &aMessagePtr,
                      const Header      &aHeader,
                      uint8_t            aIpProto,
@@ -369,6 +398,9 @@ private:
                   MessageOwnership   aMessageOwnership);
 #if OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE
     void UpdateBorderRoutingCounters(const Header &aHeader, uint16_t aMessageLength, bool aIsInbound);
+#if OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE
+    void UpdateBorderRoutingPrefixCounters(const Address &aMeshSideAddress, uint16_t aMessageLength, bool aIsInbound);
+#endif
 #endif
 
     using SendQueueTask = TaskletIn<Ip6, &Ip6::HandleSendQueue>;
@@ -376,6 +408,9 @@ private:
     bool mReceiveFilterEnabled;
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     bool mTmfOriginFilterEnabled;
+#endif
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE
+    bool mIsHandlingSendQueue;
 #endif
     Callback<ReceiveCallback> mReceiveCallback;
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
@@ -394,6 +429,12 @@ private:
 #endif
 #if OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE
     BrCounters mBrCounters;
+#if OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_ENABLE
+    static constexpr uint16_t kBrPrefixCountersTableSize = OPENTHREAD_CONFIG_IP6_BR_PREFIX_COUNTERS_TABLE_SIZE;
+
+    uint16_t         mBrPrefixCountersLength;
+    BrPrefixCounters mBrPrefixCounters[kBrPrefixCountersTableSize];
+#endif
 #endif
 };
 
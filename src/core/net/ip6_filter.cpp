@@ -42,9 +42,8 @@ RegisterLogModule("Ip6Filter");
 
 Error Filter::Apply(const Message &aMessage) const
 {
-    Error    error = kErrorDrop;
-    Headers  headers;
-    uint16_t dstPort;
+    Error   error = kErrorDrop;
+    Headers headers;
 
     // Allow all received IPv6 datagrams with link security enabled
     if (aMessage.IsLinkSecurityEnabled())
@@ -54,7 +53,18 @@ Error Filter::Apply(const Message &aMessage) const
 
     SuccessOrExit(headers.ParseFrom(aMessage));
 
-    VerifyOrExit(headers.GetDestinationAddress().IsLinkLocalUnicastOrMulticast());
+    error = Apply(headers);
+
+exit:
+    return error;
+}
+
+Error Filter::Apply(const Headers &aHeaders) const
+{
+    Error    error = kErrorDrop;
+    uint16_t dstPort;
+
+    VerifyOrExit(aHeaders.GetDestinationAddress().IsLinkLocalUnicastOrMulticast());
 
     // Allow all link-local IPv6 datagrams when Thread is not enabled
     if (Get<Mle::Mle>().GetRole() == Mle::kRoleDisabled)
@@ -62,9 +72,9 @@ Error Filter::Apply(const Message &aMessage) const
         ExitNow(error = kErrorNone);
     }
 
-    dstPort = headers.GetDestinationPort();
+    dstPort = aHeaders.GetDestinationPort();
 
-    switch (headers.GetIpProto())
+    switch (aHeaders.GetIpProto())
     {
     case kProtoUdp:
         // Allow MLE traffic
@@ -44,6 +44,8 @@
 namespace ot {
 namespace Ip6 {
 
+class Headers;
+
 /**
  * @addtogroup core-ipv6
  *
@@ -79,6 +81,20 @@ public:
      */
     Error Apply(const Message &aMessage) const;
 
+    /**
+     * Applies the filter to already parsed IPv6 and UDP/TCP headers to determine if the datagram should be dropped.
+     *
+     * This can be used to check a received frame before it is converted into a `Message`, so that to-be-dropped
+     * frames do not consume message buffers. The caller MUST ensure the headers are from a datagram received without
+     * link security (datagrams with link security enabled are always accepted).
+     *
+     * @param[in]  aHeaders  The parsed IPv6 and UDP/TCP/ICMP6 headers of the datagram.
+     *
+     * @retval kErrorNone  The datagram is not filtered and should be accepted.
+     * @retval kErrorDrop  The datagram matches the filter criteria and should be dropped.
+     */
+    Error Apply(const Headers &aHeaders) const;
+
     /**
      * Adds a port to the allowed unsecured port list.
      *
@@ -46,6 +46,7 @@ Mpl::Mpl(Instance &aInstance)
 #endif
 {
     ClearAllBytes(mSeedSet);
+    ClearAllBytes(mSeedCache);
 }
 
 void Mpl::InitOption(MplOption &aOption, const Address &aAddress)
@@ -150,14 +151,35 @@ exit:
  *   - Require group size to have >=2 entries.
  *   - If inserting into existing group, require Sequence to be larger than oldest stored Sequence in group.
  */
+uint16_t Mpl::DetermineSeedCacheIndex(uint16_t aSeedId, uint8_t aSequence)
+{
+    uint16_t hash = aSeedId ^ static_cast<uint16_t>(aSequence * 31u);
+
+    return (hash ^ (hash >> 4) ^ (hash >> 8)) & (kNumSeedCacheEntries - 1);
+}
+
 Error Mpl::UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence)
 {
-    Error      error    = kErrorNone;
-    SeedEntry *insert   = nullptr;
-    SeedEntry *group    = mSeedSet;
-    SeedEntry *evict    = mSeedSet;
-    uint8_t    curCount = 0;
-    uint8_t    maxCount = 0;
+    Error      error      = kErrorNone;
+    SeedEntry *insert     = nullptr;
+    SeedEntry *group      = mSeedSet;
+    SeedEntry *evict      = mSeedSet;
+    SeedEntry *cacheEntry = &mSeedCache[DetermineSeedCacheIndex(aSeedId, aSequence)];
+    uint8_t    curCount   = 0;
+    uint8_t    maxCount   = 0;
+
+    // Duplicate-drop fast path: during a multicast burst most
+    // datagrams repeat the most recently seen (Seed ID, Sequence)
+    // values. The hashed cache detects these repeats without
+    // scanning the seed set. Cache entries age out through the same
+    // time ticks as the seed set entries, so a cache hit is a value
+    // the seed set would (or did) report as a duplicate.
+
+    if ((cacheEntry->mLifetime != 0) && (cacheEntry->mSeedId == aSeedId) && (cacheEntry->mSequence == aSequence))
+    {
+        cacheEntry->mLifetime = kSeedEntryLifetime;
+        ExitNow(error = kErrorDrop);
+    }
 
     for (uint32_t i = 0; i < kNumSeedEntries; i++, curCount++)
     {
@@ -207,6 +229,11 @@ Error Mpl::UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence)
                 // already received, drop message
 
                 mSeedSet[i].mLifetime = kSeedEntryLifetime;
+
+                cacheEntry->mSeedId   = aSeedId;
+                cacheEntry->mSequence = aSequence;
+                cacheEntry->mLifetime = kSeedEntryLifetime;
+
                 ExitNow(error = kErrorDrop);
             }
             else if (insert == nullptr && SerialNumber::IsLess(aSequence, mSeedSet[i].mSequence))
@@ -268,6 +295,10 @@ Error Mpl::UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence)
     insert->mSequence = aSequence;
     insert->mLifetime = kSeedEntryLifetime;
 
+    cacheEntry->mSeedId   = aSeedId;
+    cacheEntry->mSequence = aSequence;
+    cacheEntry->mLifetime = kSeedEntryLifetime;
+
     Get<TimeTicker>().RegisterReceiver(TimeTicker::kIp6Mpl);
 
 exit:
@@ -295,6 +326,15 @@ void Mpl::HandleTimeTick(void)
         mSeedSet[j].mLifetime = 0;
     }
 
+    for (SeedEntry &cacheEntry : mSeedCache)
+    {
+        if (cacheEntry.mLifetime > 0)
+        {
+            cacheEntry.mLifetime--;
+            continueRxingTicks = (cacheEntry.mLifetime > 0) || continueRxingTicks;
+        }
+    }
+
     if (!continueRxingTicks)
     {
         Get<TimeTicker>().UnregisterReceiver(TimeTicker::kIp6Mpl);
@@ -413,7 +453,15 @@ void Mpl::HandleRetransmissionTimer(void)
 
             nextTime.UpdateIfEarlier(metadata.mTransmissionTime);
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+            // The per-transmission copy shares the buffered message's
+            // payload buffers (copy-on-write), so each retransmission
+            // costs one extra head buffer rather than a full copy.
+
+            messageCopy = message.CloneWithSharedBuffers();
+#else
             messageCopy = message.Clone<kSameReservedHeader>();
+#endif
         }
         else
         {
@@ -122,6 +122,9 @@ private:
     static constexpr uint32_t kSeedEntryLifetimeDt = 1000;
     static constexpr uint8_t  kDataMessageInterval = 64;
 
+    // Number of entries in the hashed duplicate-drop cache (must be a power of two).
+    static constexpr uint16_t kNumSeedCacheEntries = 16;
+
     struct SeedEntry
     {
         uint16_t mSeedId;
@@ -132,7 +135,10 @@ private:
     void  HandleTimeTick(void);
     Error UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence);
 
+    static uint16_t DetermineSeedCacheIndex(uint16_t aSeedId, uint8_t aSequence);
+
     SeedEntry mSeedSet[kNumSeedEntries];
+    SeedEntry mSeedCache[kNumSeedCacheEntries];
     uint8_t   mSequence;
 
 #if OPENTHREAD_FTD
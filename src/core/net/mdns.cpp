@@ -95,6 +95,10 @@ Core::Core(Instance &aInstance)
     , mLocalHost(aInstance)
     , mMultiPacketRxMessages(aInstance)
     , mNextProbeTxTime(TimerMilli::GetNow() - 1)
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_WINDOW > 0
+    , mProbeSlotEntries(0)
+#endif
+    , mProbeConflictCount(0)
     , mEntryTimer(aInstance)
     , mEntryTask(aInstance)
     , mTxMessageHistory(aInstance)
@@ -106,6 +110,10 @@ Core::Core(Instance &aInstance)
     , mVerboseLogging(kDefaultVerboseLog)
 #endif
 {
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+    mEntryTask.SetPriority(Tasklet::kPriorityLow);
+    mCacheTask.SetPriority(Tasklet::kPriorityLow);
+#endif
 }
 
 void Core::AfterInstanceInit(void)
@@ -601,6 +609,51 @@ bool Core::NameMatch(const Heap::String &aFirst, const Heap::String &aSecond)
     return !aSecond.IsNull() && NameMatch(aFirst, aSecond.AsCString());
 }
 
+Core::HashedName::HashedName(const Name &aName)
+    : mName(aName)
+    , mHash(0)
+    , mHashValid(false)
+{
+    Name::LabelBuffer label;
+    uint8_t           length = sizeof(label);
+    uint16_t          offset;
+    const Message    *message;
+
+    // The hash can be determined only for a name read from a received
+    // message. When it cannot be determined (e.g., for a malformed
+    // name), the hash filter is skipped and entries are compared
+    // fully.
+
+    VerifyOrExit(aName.IsFromMessage());
+
+    message = &aName.GetAsMessage(offset);
+    SuccessOrExit(Name::ReadLabel(*message, offset, label, length));
+
+    mHash      = DetermineHash(label, /* aIsSingleLabel */ true);
+    mHashValid = true;
+
+exit:
+    return;
+}
+
+uint32_t Core::HashedName::DetermineHash(const char *aName, bool aIsSingleLabel)
+{
+    // Calculates a case-insensitive FNV-1a hash over the first label
+    // of `aName`, or over the full string when `aIsSingleLabel` is
+    // `true` (where any dot `.` character is part of the label
+    // itself, e.g., in a service instance label).
+
+    uint32_t hash = 0x811c9dc5; // FNV-1a offset basis
+
+    for (; (*aName != kNullChar) && (aIsSingleLabel || (*aName != Name::kLabelSeparatorChar)); aName++)
+    {
+        hash ^= static_cast<uint8_t>(ToLowercase(*aName));
+        hash *= 16777619; // FNV-1a prime
+    }
+
+    return hash;
+}
+
 void Core::UpdateCacheFlushFlagIn(ResourceRecord &aResourceRecord, Section aSection, bool aIsLegacyUnicast)
 {
     // Do not set the cache-flush flag if the record is
@@ -1355,6 +1408,7 @@ void Core::Entry::SetStateToConflict(void)
     switch (GetState())
     {
     case kProbing:
+        Get<Core>().mProbeConflictCount++;
         SetState(kConflict);
         break;
 
@@ -1938,6 +1992,7 @@ bool Core::LocalHost::AddrEvent::Matches(AddrType aType) const
 
 Core::HostEntry::HostEntry(void)
     : mNext(nullptr)
+    , mNameHash(0)
     , mNameOffset(kUnspecifiedOffset)
 {
 }
@@ -1946,6 +2001,8 @@ Error Core::HostEntry::Init(Instance &aInstance, const char *aName)
 {
     Entry::Init(aInstance);
 
+    mNameHash = HashedName::DetermineHash(aName, /* aIsSingleLabel */ false);
+
     return mName.Set(aName);
 }
 
@@ -1954,6 +2011,11 @@ bool Core::HostEntry::Matches(const Name &aName) const
     return aName.Matches(/* aFirstLabel */ nullptr, mName.AsCString(), kLocalDomain);
 }
 
+bool Core::HostEntry::Matches(const HashedName &aHashedName) const
+{
+    return (!aHashedName.mHashValid || (mNameHash == aHashedName.mHash)) && Matches(aHashedName.mName);
+}
+
 bool Core::HostEntry::Matches(const Host &aHost) const { return NameMatch(mName, aHost.mHostName); }
 
 bool Core::HostEntry::Matches(const LocalHost &aLocalHost) const { return NameMatch(mName, aLocalHost.GetName()); }
@@ -2485,6 +2547,9 @@ const uint8_t Core::ServiceEntry::kEmptyTxtData[] = {0};
 
 Core::ServiceEntry::ServiceEntry(void)
     : mNext(nullptr)
+    , mNameHash(0)
+    , mServiceTypeHash(0)
+    , mHostNameHash(0)
     , mPriority(0)
     , mWeight(0)
     , mPort(0)
@@ -2505,6 +2570,9 @@ Error Core::ServiceEntry::Init(Instance &aInstance, const char *aServiceInstance
     SuccessOrExit(error = mServiceInstance.Set(aServiceInstance));
     SuccessOrExit(error = mServiceType.Set(aServiceType));
 
+    mNameHash        = HashedName::DetermineHash(aServiceInstance, /* aIsSingleLabel */ true);
+    mServiceTypeHash = HashedName::DetermineHash(aServiceType, /* aIsSingleLabel */ false);
+
 exit:
     return error;
 }
@@ -2524,6 +2592,11 @@ bool Core::ServiceEntry::Matches(const Name &aFullName) const
     return aFullName.Matches(mServiceInstance.AsCString(), mServiceType.AsCString(), kLocalDomain);
 }
 
+bool Core::ServiceEntry::Matches(const HashedName &aHashedName) const
+{
+    return (!aHashedName.mHashValid || (mNameHash == aHashedName.mHash)) && Matches(aHashedName.mName);
+}
+
 bool Core::ServiceEntry::MatchesServiceType(const Name &aServiceType) const
 {
     // When matching service type, PTR record should be
@@ -2610,6 +2683,7 @@ void Core::ServiceEntry::Register(const Service &aService, const Callback &aCall
 
     mSrvRecord.UpdateTtl(ttl);
     mSrvRecord.UpdateProperty(mHostName, hostName);
+    mHostNameHash = HashedName::DetermineHash(mHostName.AsCString(), /* aIsSingleLabel */ false);
     mSrvRecord.UpdateProperty(mPriority, aService.mPriority);
     mSrvRecord.UpdateProperty(mWeight, aService.mWeight);
     mSrvRecord.UpdateProperty(mPort, aService.mPort);
@@ -3085,6 +3159,14 @@ void Core::ServiceEntry::DiscoverOffsetsAndHost(HostEntry *&aHostEntry)
             break;
         }
 
+        if (HasAllCompressOffsets())
+        {
+            // All compression offsets are already discovered, no
+            // need to check the remaining earlier entries.
+
+            break;
+        }
+
         if (other.GetState() != GetState())
         {
             // Validate that both entries are in the same state,
@@ -3094,12 +3176,16 @@ void Core::ServiceEntry::DiscoverOffsetsAndHost(HostEntry *&aHostEntry)
             continue;
         }
 
-        if (NameMatch(mHostName, other.mHostName))
+        // The cached name hashes are compared first to quickly rule
+        // out non-matching entries before the full (string) name
+        // comparison.
+
+        if ((mHostNameHash == other.mHostNameHash) && NameMatch(mHostName, other.mHostName))
         {
             UpdateCompressOffset(mHostNameOffset, other.mHostNameOffset);
         }
 
-        if (NameMatch(mServiceType, other.mServiceType))
+        if ((mServiceTypeHash == other.mServiceTypeHash) && NameMatch(mServiceType, other.mServiceType))
         {
             UpdateCompressOffset(mServiceTypeOffset, other.mServiceTypeOffset);
 
@@ -3126,6 +3212,33 @@ void Core::ServiceEntry::DiscoverOffsetsAndHost(HostEntry *&aHostEntry)
     }
 }
 
+bool Core::ServiceEntry::HasAllCompressOffsets(void) const
+{
+    // Indicates whether all name compression offsets used by this
+    // entry are already discovered (from previously appended
+    // entries).
+
+    bool hasAll = false;
+
+    VerifyOrExit(mHostNameOffset != kUnspecifiedOffset);
+    VerifyOrExit(mServiceTypeOffset != kUnspecifiedOffset);
+
+    if ((GetState() != kProbing) && !mSubTypes.IsEmpty())
+    {
+        VerifyOrExit(mSubServiceTypeOffset != kUnspecifiedOffset);
+
+        for (const SubType &subType : mSubTypes)
+        {
+            VerifyOrExit(subType.mSubServiceNameOffset != kUnspecifiedOffset);
+        }
+    }
+
+    hasAll = true;
+
+exit:
+    return hasAll;
+}
+
 void Core::ServiceEntry::UpdateServiceTypes(void)
 {
     // This method updates the `mServiceTypes` list adding or
@@ -3638,8 +3751,6 @@ Core::TxMessage::TxMessage(Instance &aInstance, Type aType, const AddressInfo &a
 
 void Core::TxMessage::Init(Type aType, uint16_t aMessageId)
 {
-    Header header;
-
     mRecordCounts.Clear();
     mSavedRecordCounts.Clear();
     mSavedMsgLength      = 0;
@@ -3649,19 +3760,33 @@ void Core::TxMessage::Init(Type aType, uint16_t aMessageId)
     mTcpOffset           = kUnspecifiedOffset;
     mServicesDnssdOffset = kUnspecifiedOffset;
     mType                = aType;
+    mMessageId           = aMessageId;
 
-    // Allocate messages. The main `mMsgPtr` is always allocated.
-    // The Authority and Addition section messages are allocated
-    // the first time they are used.
+    // All messages are allocated lazily on first use (from
+    // `GetMainMessage()`). This avoids any message buffer allocation
+    // when a `TxMessage` ends up with nothing to send (e.g., an entry
+    // timer tick preparing no records, or a received query where all
+    // answers are suppressed).
+
+    mMsgPtr.Reset();
+    mExtraMsgPtr.Reset();
+}
+
+Message &Core::TxMessage::GetMainMessage(void)
+{
+    // Returns the main message, allocating it and appending the DNS
+    // header on first use.
+
+    Header header;
+
+    VerifyOrExit(mMsgPtr.IsNull());
 
     mMsgPtr.Reset(Get<MessagePool>().Allocate(Message::kTypeOther));
     OT_ASSERT(!mMsgPtr.IsNull());
 
-    mExtraMsgPtr.Reset();
-
     header.Clear();
 
-    switch (aType)
+    switch (mType)
     {
     case kMulticastProbe:
     case kMulticastQuery:
@@ -3671,11 +3796,14 @@ void Core::TxMessage::Init(Type aType, uint16_t aMessageId)
     case kUnicastResponse:
     case kLegacyUnicastResponse:
         header.SetType(Header::kTypeResponse);
-        header.SetMessageId(aMessageId);
+        header.SetMessageId(mMessageId);
         break;
     }
 
     SuccessOrAssert(mMsgPtr->Append(header));
+
+exit:
+    return *mMsgPtr;
 }
 
 Message &Core::TxMessage::SelectMessageFor(Section aSection)
@@ -3706,7 +3834,7 @@ Message &Core::TxMessage::SelectMessageFor(Section aSection)
 
     if (aSection == mainSection)
     {
-        message = mMsgPtr.Get();
+        message = &GetMainMessage();
     }
     else if (aSection == extraSection)
     {
@@ -3862,7 +3990,7 @@ void Core::TxMessage::AddQuestionFrom(const Message &aMessage)
 
     IgnoreError(Name::ParseName(aMessage, offset));
     offset += sizeof(ot::Dns::Question);
-    SuccessOrAssert(mMsgPtr->AppendBytesFromMessage(aMessage, sizeof(Header), offset - sizeof(Header)));
+    SuccessOrAssert(GetMainMessage().AppendBytesFromMessage(aMessage, sizeof(Header), offset - sizeof(Header)));
     IncrementRecordCount(kQuestionSection);
 }
 
@@ -3895,7 +4023,7 @@ void Core::TxMessage::SaveOffset(uint16_t &aCompressOffset, const Message &aMess
 
 bool Core::TxMessage::IsOverSizeLimit(void) const
 {
-    uint32_t size = mMsgPtr->GetLength();
+    uint32_t size = mMsgPtr.IsNull() ? sizeof(Header) : mMsgPtr->GetLength();
 
     if (!mExtraMsgPtr.IsNull())
     {
@@ -3908,7 +4036,7 @@ bool Core::TxMessage::IsOverSizeLimit(void) const
 void Core::TxMessage::SaveCurrentState(void)
 {
     mSavedRecordCounts   = mRecordCounts;
-    mSavedMsgLength      = mMsgPtr->GetLength();
+    mSavedMsgLength      = mMsgPtr.IsNull() ? sizeof(Header) : mMsgPtr->GetLength();
     mSavedExtraMsgLength = mExtraMsgPtr.IsNull() ? 0 : mExtraMsgPtr->GetLength();
 }
 
@@ -3916,7 +4044,10 @@ void Core::TxMessage::RestoreToSavedState(void)
 {
     mRecordCounts = mSavedRecordCounts;
 
-    IgnoreError(mMsgPtr->SetLength(mSavedMsgLength));
+    if (!mMsgPtr.IsNull())
+    {
+        IgnoreError(mMsgPtr->SetLength(mSavedMsgLength));
+    }
 
     if (!mExtraMsgPtr.IsNull())
     {
@@ -4011,7 +4142,7 @@ exit:
 
 void Core::TxMessage::Reinit(void)
 {
-    Init(GetType());
+    Init(GetType(), mMessageId);
 
     // After re-initializing `TxMessage`, we clear the "AppendState"
     // on all related host and service entries, and service types
@@ -4374,13 +4505,20 @@ void Core::RxMessage::ProcessQuestion(Question &aQuestion)
     }
 
     // Check if question name matches a `HostEntry` or a `ServiceEntry`.
+    // The name's first label is hashed once, so non-matching entries
+    // are ruled out by an integer compare rather than a full name
+    // comparison per entry.
 
-    aQuestion.mEntry = Get<Core>().mHostEntries.FindMatching(name);
-
-    if (aQuestion.mEntry == nullptr)
     {
-        aQuestion.mEntry        = Get<Core>().mServiceEntries.FindMatching(name);
-        aQuestion.mIsForService = (aQuestion.mEntry != nullptr);
+        HashedName hashedName(name);
+
+        aQuestion.mEntry = Get<Core>().mHostEntries.FindMatching(hashedName);
+
+        if (aQuestion.mEntry == nullptr)
+        {
+            aQuestion.mEntry        = Get<Core>().mServiceEntries.FindMatching(hashedName);
+            aQuestion.mIsForService = (aQuestion.mEntry != nullptr);
+        }
     }
 
     if (aQuestion.mEntry != nullptr)
@@ -4809,17 +4947,18 @@ void Core::RxMessage::ProcessRecordForConflict(const Name &aName, const Resource
 {
     HostEntry    *hostEntry;
     ServiceEntry *serviceEntry;
+    HashedName    hashedName(aName);
 
     VerifyOrExit(aRecord.GetTtl() > 0);
 
-    hostEntry = Get<Core>().mHostEntries.FindMatching(aName);
+    hostEntry = Get<Core>().mHostEntries.FindMatching(hashedName);
 
     if (hostEntry != nullptr)
     {
         hostEntry->HandleConflict();
     }
 
-    serviceEntry = Get<Core>().mServiceEntries.FindMatching(aName);
+    serviceEntry = Get<Core>().mServiceEntries.FindMatching(hashedName);
 
     if (serviceEntry != nullptr)
     {
@@ -5416,14 +5555,37 @@ TimeMilli Core::RandomizeFirstProbeTxTime(void)
 
     TimeMilli now = TimerMilli::GetNow();
 
-    // The comparison using `(mNextProbeTxTime - now)` will work
+    // The comparisons using `(mNextProbeTxTime - now)` will work
     // correctly even in the unlikely case that `now` has wrapped
     // (49 days has passed) since `mNextProbeTxTime` was last set.
 
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_WINDOW > 0
+    // With the start-up ramp enabled, at most `kProbeRampSlotMaxEntries`
+    // entries share a probe tx slot. Overflow entries are paced onto
+    // later slots (spaced `kProbeWaitTime` apart) until the ramp window
+    // is filled, which spreads the probe (and subsequent announce)
+    // transmissions of a large registration batch over the window.
+
+    if ((mNextProbeTxTime - now) >= (kProbeRampWindow + kMaxProbeDelay))
+    {
+        mNextProbeTxTime  = now + Random::NonCrypto::GetUint32InRange(kMinProbeDelay, kMaxProbeDelay);
+        mProbeSlotEntries = 0;
+    }
+
+    if ((mProbeSlotEntries >= kProbeRampSlotMaxEntries) &&
+        ((mNextProbeTxTime + kProbeWaitTime - now) < (kProbeRampWindow + kMaxProbeDelay)))
+    {
+        mNextProbeTxTime += kProbeWaitTime;
+        mProbeSlotEntries = 0;
+    }
+
+    mProbeSlotEntries++;
+#else
     if ((mNextProbeTxTime - now) >= kMaxProbeDelay)
     {
         mNextProbeTxTime = now + Random::NonCrypto::GetUint32InRange(kMinProbeDelay, kMaxProbeDelay);
     }
+#endif
 
     return mNextProbeTxTime;
 }
@@ -281,6 +281,16 @@ public:
      */
     void SetConflictCallback(ConflictCallback aCallback) { mConflictCallback = aCallback; }
 
+    /**
+     * Returns the number of name conflicts detected while probing.
+     *
+     * The counter covers host, service, and key entries and is tracked since OpenThread instance initialization.
+     * Conflicts detected after a name is successfully claimed (post-probe) are not counted.
+     *
+     * @returns The number of probe-stage name conflicts detected.
+     */
+    uint32_t GetProbeConflictCount(void) const { return mProbeConflictCount; }
+
     /**
      * Registers or updates a host.
      *
@@ -906,6 +916,11 @@ private:
     static constexpr uint32_t kMaxProbeDelay  = 250; // In msec
     static constexpr uint32_t kProbeWaitTime  = 250; // In msec
 
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_WINDOW > 0
+    static constexpr uint32_t kProbeRampWindow         = OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_WINDOW;
+    static constexpr uint16_t kProbeRampSlotMaxEntries = OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_SLOT_MAX_ENTRIES;
+#endif
+
     static constexpr uint8_t  kNumberOfAnnounces = 3;
     static constexpr uint32_t kAnnounceInterval  = 1000; // In msec - time between first two announces
 
@@ -1252,7 +1267,7 @@ private:
     private:
         static constexpr uint32_t kGuardTimeToProcessAddrEvents = 4; // msec
 
-        struct AddrEvent : public LinkedListEntry<AddrEvent>, public Heap::Allocatable<AddrEvent>
+        struct AddrEvent : public LinkedListEntry<AddrEvent>, public Heap::Allocatable<AddrEvent, Heap::kOwnerDns>
         {
             AddrEvent(const Ip6::Address &aAddress, bool aAdded);
             bool Matches(const Ip6::Address &aAddress) const { return mAddress == aAddress; }
@@ -1276,7 +1291,26 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-    class HostEntry : public Entry, public LinkedListEntry<HostEntry>, public Heap::Allocatable<HostEntry>
+    struct HashedName
+    {
+        // Pairs a DNS name with a case-insensitive hash of its first
+        // label, used to quickly rule out non-matching `HostEntry` or
+        // `ServiceEntry` instances (comparing against their cached
+        // `mNameHash`) before a full (label by label) name comparison.
+
+        explicit HashedName(const Name &aName);
+
+        static uint32_t DetermineHash(const char *aName, bool aIsSingleLabel);
+
+        const Name &mName;
+        uint32_t    mHash;
+        bool        mHashValid;
+    };
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    class HostEntry : public Entry, public LinkedListEntry<HostEntry>,
+                      public Heap::Allocatable<HostEntry, Heap::kOwnerDns>
     {
         friend class LinkedListEntry<HostEntry>;
         friend class Entry;
@@ -1289,6 +1323,7 @@ private:
         Error Init(Instance &aInstance, const Key &aKey) { return Init(aInstance, aKey.mName); }
         bool  IsEmpty(void) const;
         bool  Matches(const Name &aName) const;
+        bool  Matches(const HashedName &aHashedName) const;
         bool  Matches(const Host &aHost) const;
         bool  Matches(const LocalHost &aLocalHost) const;
         bool  Matches(const Key &aKey) const;
@@ -1312,7 +1347,7 @@ private:
 #endif
 
     private:
-        struct AddrRecord : public RecordInfo, public Heap::Allocatable<AddrRecord>
+        struct AddrRecord : public RecordInfo, public Heap::Allocatable<AddrRecord, Heap::kOwnerDns>
         {
             void Clear(void);
             void UpdateAddresses(const Host &aHost);
@@ -1341,6 +1376,7 @@ private:
 
         HostEntry           *mNext;
         Heap::String         mName;
+        uint32_t             mNameHash;
         AddrRecord           mIp6AddrRecord;
         OwnedPtr<AddrRecord> mIp4AddrRecord;
         uint16_t             mNameOffset;
@@ -1348,7 +1384,8 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-    class ServiceEntry : public Entry, public LinkedListEntry<ServiceEntry>, public Heap::Allocatable<ServiceEntry>
+    class ServiceEntry : public Entry, public LinkedListEntry<ServiceEntry>,
+                         public Heap::Allocatable<ServiceEntry, Heap::kOwnerDns>
     {
         friend class LinkedListEntry<ServiceEntry>;
         friend class Entry;
@@ -1360,6 +1397,7 @@ private:
         Error Init(Instance &aInstance, const Key &aKey);
         bool  IsEmpty(void) const;
         bool  Matches(const Name &aFullName) const;
+        bool  Matches(const HashedName &aHashedName) const;
         bool  Matches(const Service &aService) const;
         bool  Matches(const Key &aKey) const;
         bool  Matches(State aState) const { return GetState() == aState; }
@@ -1384,7 +1422,8 @@ private:
 #endif
 
     private:
-        class SubType : public LinkedListEntry<SubType>, public Heap::Allocatable<SubType>, private ot::NonCopyable
+        class SubType : public LinkedListEntry<SubType>, public Heap::Allocatable<SubType, Heap::kOwnerDns>,
+                        private ot::NonCopyable
         {
         public:
             Error Init(const char *aLabel);
@@ -1407,6 +1446,7 @@ private:
         void  UpdateRecordsState(const TxMessage &aResponse);
         void  DetermineNextFireTime(void);
         void  DiscoverOffsetsAndHost(HostEntry *&aHost);
+        bool  HasAllCompressOffsets(void) const;
         void  UpdateServiceTypes(void);
         void  AppendSrvRecordTo(TxMessage &aTxMessage, Section aSection);
         void  AppendTxtRecordTo(TxMessage &aTxMessage, Section aSection);
@@ -1426,6 +1466,9 @@ private:
         ServiceEntry       *mNext;
         Heap::String        mServiceInstance;
         Heap::String        mServiceType;
+        uint32_t            mNameHash;
+        uint32_t            mServiceTypeHash;
+        uint32_t            mHostNameHash;
         RecordInfo          mPtrRecord;
         RecordInfo          mSrvRecord;
         RecordInfo          mTxtRecord;
@@ -1447,7 +1490,7 @@ private:
     class ServiceType : public InstanceLocatorInit,
                         public FireTime,
                         public LinkedListEntry<ServiceType>,
-                        public Heap::Allocatable<ServiceType>,
+                        public Heap::Allocatable<ServiceType, Heap::kOwnerDns>,
                         private NonCopyable
     {
         // Track a service type to answer to `_services._dns-sd._udp.local`
@@ -1515,6 +1558,7 @@ private:
 
         void          Init(Type aType, uint16_t aMessageId = 0);
         void          Reinit(void);
+        Message      &GetMainMessage(void);
         bool          IsOverSizeLimit(void) const;
         AppendOutcome AppendLabels(Section     aSection,
                                    const char *aLabels,
@@ -1538,6 +1582,7 @@ private:
         uint16_t          mServicesDnssdOffset; // Offset to `_services._dns-sd`
         AddressInfo       mUnicastDest;
         Type              mType;
+        uint16_t          mMessageId;
     };
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1558,7 +1603,7 @@ private:
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
     class RxMessage : public InstanceLocatorInit,
-                      public Heap::Allocatable<RxMessage>,
+                      public Heap::Allocatable<RxMessage, Heap::kOwnerDns>,
                       public LinkedListEntry<RxMessage>,
                       private NonCopyable
     {
@@ -1664,7 +1709,7 @@ private:
 
         struct RxMsgEntry : public InstanceLocator,
                             public LinkedListEntry<RxMsgEntry>,
-                            public Heap::Allocatable<RxMsgEntry>,
+                            public Heap::Allocatable<RxMsgEntry, Heap::kOwnerDns>,
                             private NonCopyable
         {
             explicit RxMsgEntry(Instance &aInstance);
@@ -1712,7 +1757,7 @@ private:
             uint32_t mCrc32;
         };
 
-        struct MsgEntry : public LinkedListEntry<MsgEntry>, public Heap::Allocatable<MsgEntry>
+        struct MsgEntry : public LinkedListEntry<MsgEntry>, public Heap::Allocatable<MsgEntry, Heap::kOwnerDns>
         {
             bool Matches(const MsgInfo &aInfo) const { return mInfo == aInfo; }
             bool Matches(const ExpirationChecker &aChecker) const { return aChecker.IsExpired(mExpireTime); }
@@ -1733,9 +1778,10 @@ private:
     class CacheEntry;
     class TxtCache;
 
-    class ResultCallback : public LinkedListEntry<ResultCallback>, public Heap::Allocatable<ResultCallback>
+    class ResultCallback : public LinkedListEntry<ResultCallback>,
+                           public Heap::Allocatable<ResultCallback, Heap::kOwnerDns>
     {
-        friend class Heap::Allocatable<ResultCallback>;
+        friend class Heap::Allocatable<ResultCallback, Heap::kOwnerDns>;
         friend class LinkedListEntry<ResultCallback>;
         friend class CacheEntry;
 
@@ -1900,10 +1946,11 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-    class BrowseCache : public CacheEntry, public LinkedListEntry<BrowseCache>, public Heap::Allocatable<BrowseCache>
+    class BrowseCache : public CacheEntry, public LinkedListEntry<BrowseCache>,
+                        public Heap::Allocatable<BrowseCache, Heap::kOwnerDns>
     {
         friend class LinkedListEntry<BrowseCache>;
-        friend class Heap::Allocatable<BrowseCache>;
+        friend class Heap::Allocatable<BrowseCache, Heap::kOwnerDns>;
         friend class CacheEntry;
 
     public:
@@ -1920,7 +1967,7 @@ private:
 #endif
 
     private:
-        struct PtrEntry : public LinkedListEntry<PtrEntry>, public Heap::Allocatable<PtrEntry>
+        struct PtrEntry : public LinkedListEntry<PtrEntry>, public Heap::Allocatable<PtrEntry, Heap::kOwnerDns>
         {
             Error Init(const char *aServiceInstance);
             bool  Matches(const char *aServiceInstance) const { return NameMatch(mServiceInstance, aServiceInstance); }
@@ -2002,10 +2049,11 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-    class SrvCache : public ServiceCache, public LinkedListEntry<SrvCache>, public Heap::Allocatable<SrvCache>
+    class SrvCache : public ServiceCache, public LinkedListEntry<SrvCache>,
+                     public Heap::Allocatable<SrvCache, Heap::kOwnerDns>
     {
         friend class LinkedListEntry<SrvCache>;
-        friend class Heap::Allocatable<SrvCache>;
+        friend class Heap::Allocatable<SrvCache, Heap::kOwnerDns>;
         friend class CacheEntry;
         friend class TxtCache;
         friend class BrowseCache;
@@ -2041,10 +2089,11 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-    class TxtCache : public ServiceCache, public LinkedListEntry<TxtCache>, public Heap::Allocatable<TxtCache>
+    class TxtCache : public ServiceCache, public LinkedListEntry<TxtCache>,
+                     public Heap::Allocatable<TxtCache, Heap::kOwnerDns>
     {
         friend class LinkedListEntry<TxtCache>;
-        friend class Heap::Allocatable<TxtCache>;
+        friend class Heap::Allocatable<TxtCache, Heap::kOwnerDns>;
         friend class CacheEntry;
         friend class BrowseCache;
 
@@ -2096,7 +2145,7 @@ private:
 #endif
 
     protected:
-        struct AddrEntry : public LinkedListEntry<AddrEntry>, public Heap::Allocatable<AddrEntry>
+        struct AddrEntry : public LinkedListEntry<AddrEntry>, public Heap::Allocatable<AddrEntry, Heap::kOwnerDns>
         {
             explicit AddrEntry(const Ip6::Address &aAddress);
             bool     Matches(const Ip6::Address &aAddress) const { return (mAddress == aAddress); }
@@ -2132,11 +2181,12 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-    class Ip6AddrCache : public AddrCache, public LinkedListEntry<Ip6AddrCache>, public Heap::Allocatable<Ip6AddrCache>
+    class Ip6AddrCache : public AddrCache, public LinkedListEntry<Ip6AddrCache>,
+                         public Heap::Allocatable<Ip6AddrCache, Heap::kOwnerDns>
     {
         friend class CacheEntry;
         friend class LinkedListEntry<Ip6AddrCache>;
-        friend class Heap::Allocatable<Ip6AddrCache>;
+        friend class Heap::Allocatable<Ip6AddrCache, Heap::kOwnerDns>;
 
     public:
         void ProcessResponseRecord(const Message &aMessage, uint16_t aRecordOffset);
@@ -2149,11 +2199,12 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-    class Ip4AddrCache : public AddrCache, public LinkedListEntry<Ip4AddrCache>, public Heap::Allocatable<Ip4AddrCache>
+    class Ip4AddrCache : public AddrCache, public LinkedListEntry<Ip4AddrCache>,
+                         public Heap::Allocatable<Ip4AddrCache, Heap::kOwnerDns>
     {
         friend class CacheEntry;
         friend class LinkedListEntry<Ip4AddrCache>;
-        friend class Heap::Allocatable<Ip4AddrCache>;
+        friend class Heap::Allocatable<Ip4AddrCache, Heap::kOwnerDns>;
 
     public:
         void ProcessResponseRecord(const Message &aMessage, uint16_t aRecordOffset);
@@ -2166,11 +2217,12 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-    class RecordCache : public CacheEntry, public LinkedListEntry<RecordCache>, public Heap::Allocatable<RecordCache>
+    class RecordCache : public CacheEntry, public LinkedListEntry<RecordCache>,
+                        public Heap::Allocatable<RecordCache, Heap::kOwnerDns>
     {
         friend class CacheEntry;
         friend class LinkedListEntry<RecordCache>;
-        friend class Heap::Allocatable<RecordCache>;
+        friend class Heap::Allocatable<RecordCache, Heap::kOwnerDns>;
 
     public:
         bool  Matches(const Name &aFullName, uint16_t aRecordType) const;
@@ -2185,7 +2237,8 @@ private:
 #endif
 
     private:
-        struct NewRecordEntry : public LinkedListEntry<NewRecordEntry>, public Heap::Allocatable<NewRecordEntry>
+        struct NewRecordEntry : public LinkedListEntry<NewRecordEntry>,
+                                public Heap::Allocatable<NewRecordEntry, Heap::kOwnerDns>
         {
             NewRecordEntry(const ResourceRecord &aRecord, Heap::Data &aData);
 
@@ -2199,7 +2252,7 @@ private:
             Heap::Data      mData;
         };
 
-        struct RecordEntry : public LinkedListEntry<RecordEntry>, public Heap::Allocatable<RecordEntry>
+        struct RecordEntry : public LinkedListEntry<RecordEntry>, public Heap::Allocatable<RecordEntry, Heap::kOwnerDns>
         {
             explicit RecordEntry(NewRecordEntry &aNewEntry);
 
@@ -2242,9 +2295,10 @@ private:
 
 #if OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_ITERATION_API_ENABLE
 
-    class EntryIterator : public Iterator, public InstanceLocator, public Heap::Allocatable<EntryIterator>
+    class EntryIterator : public Iterator, public InstanceLocator,
+                          public Heap::Allocatable<EntryIterator, Heap::kOwnerDns>
     {
-        friend class Heap::Allocatable<EntryIterator>;
+        friend class Heap::Allocatable<EntryIterator, Heap::kOwnerDns>;
         friend class ServiceEntry;
 
     public:
@@ -2400,6 +2454,10 @@ private:
     OwningList<ServiceType>  mServiceTypes;
     MultiPacketRxMessages    mMultiPacketRxMessages;
     TimeMilli                mNextProbeTxTime;
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_PROBE_RAMP_WINDOW > 0
+    uint16_t                 mProbeSlotEntries;
+#endif
+    uint32_t                 mProbeConflictCount;
     EntryTimer               mEntryTimer;
     EntryTask                mEntryTask;
     TxMessageHistory         mTxMessageHistory;
@@ -68,7 +68,9 @@ Translator::Translator(Instance &aInstance)
 
     mNat64Prefix.Clear();
     mIp4Cidr.Clear();
-    mTimer.Start(Min(kIdleTimeout, kIcmpTimeout));
+
+    ClearAllBytes(mIp6HashBuckets);
+    ClearAllBytes(mIp4HashBuckets);
 
     mCounters.Clear();
     ClearAllBytes(mErrorCounters);
@@ -109,12 +111,15 @@ uint16_t Translator::GetDestinationPortOrIcmp4Id(const Ip4::Headers &aIp4Headers
 
 Error Translator::TranslateIp6ToIp4(Message &aMessage)
 {
-    Error        error      = kErrorNone;
-    DropReason   dropReason = kReasonUnknown;
-    Ip6::Headers ip6Headers;
-    Ip4::Header  ip4Header;
-    uint16_t     srcPortOrId = 0;
-    Mapping     *mapping     = nullptr;
+    Error              error      = kErrorNone;
+    DropReason         dropReason = kReasonUnknown;
+    Ip6::Headers       ip6Headers;
+    Ip4::Header        ip4Header;
+    Checksum::Adjuster adjuster;
+    uint16_t           srcPortOrId    = 0;
+    uint16_t           checksumOffset = 0;
+    bool               adjustChecksum = false;
+    Mapping           *mapping        = nullptr;
 
     VerifyOrExit(mState == kStateActive, error = kErrorAbort);
 
@@ -132,7 +137,7 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
         ExitNow(error = kErrorAbort);
     }
 
-    mapping = mActiveMappings.FindMatching(ip6Headers);
+    mapping = FindMapping(ip6Headers);
 
     if (mapping == nullptr)
     {
@@ -169,13 +174,25 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
     // The IP header is consumed, so the next header is at offset 0.
     case Ip6::kProtoUdp:
         ip4Header.SetProtocol(Ip4::kProtoUdp);
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+        adjuster.RemoveUint16(ip6Headers.GetSourcePort());
+        adjuster.AddUint16(srcPortOrId);
+#endif
         ip6Headers.SetSourcePort(srcPortOrId);
         aMessage.Write(0, ip6Headers.GetUdpHeader());
+        checksumOffset = Ip6::Udp::Header::kChecksumFieldOffset;
+        adjustChecksum = true;
         break;
     case Ip6::kProtoTcp:
         ip4Header.SetProtocol(Ip4::kProtoTcp);
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+        adjuster.RemoveUint16(ip6Headers.GetSourcePort());
+        adjuster.AddUint16(srcPortOrId);
+#endif
         ip6Headers.SetSourcePort(srcPortOrId);
         aMessage.Write(0, ip6Headers.GetTcpHeader());
+        checksumOffset = Ip6::Tcp::Header::kChecksumFieldOffset;
+        adjustChecksum = true;
         break;
     case Ip6::kProtoIcmp6:
         ip4Header.SetProtocol(Ip4::kProtoIcmp);
@@ -189,8 +206,29 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
     // TODO: Implement the logic for replying ICMP messages.
     ip4Header.SetTotalLength(sizeof(Ip4::Header) + aMessage.DetermineLengthAfterOffset());
 
-    Checksum::UpdateMessageChecksum(aMessage, ip4Header.GetSource(), ip4Header.GetDestination(),
-                                    ip4Header.GetProtocol());
+    if (adjustChecksum)
+    {
+        // Adjust the TCP/UDP checksum incrementally (RFC 1624) for the
+        // pseudo-header and port rewrites instead of recalculating it
+        // over the full payload. The payload length and the protocol
+        // number (identical for TCP/UDP in IPv4 and IPv6) are
+        // unchanged, so they cancel out of the pseudo-header
+        // difference. ICMP keeps the full calculation since the ICMPv4
+        // checksum, unlike ICMPv6, does not cover a pseudo-header.
+
+        adjuster.RemoveData(ip6Headers.GetSourceAddress().GetBytes(), sizeof(Ip6::Address));
+        adjuster.RemoveData(ip6Headers.GetDestinationAddress().GetBytes(), sizeof(Ip6::Address));
+        adjuster.AddData(ip4Header.GetSource().GetBytes(), sizeof(Ip4::Address));
+        adjuster.AddData(ip4Header.GetDestination().GetBytes(), sizeof(Ip4::Address));
+
+        adjuster.ApplyTo(aMessage, aMessage.GetOffset() + checksumOffset);
+    }
+    else
+    {
+        Checksum::UpdateMessageChecksum(aMessage, ip4Header.GetSource(), ip4Header.GetDestination(),
+                                        ip4Header.GetProtocol());
+    }
+
     Checksum::UpdateIp4HeaderChecksum(ip4Header);
 
     if (aMessage.Prepend(ip4Header) != kErrorNone)
@@ -217,12 +255,15 @@ exit:
 
 Error Translator::TranslateIp4ToIp6(Message &aMessage)
 {
-    Error        error      = kErrorNone;
-    DropReason   dropReason = kReasonUnknown;
-    Ip6::Header  ip6Header;
-    Ip4::Headers ip4Headers;
-    uint16_t     dstPortOrId = 0;
-    Mapping     *mapping     = nullptr;
+    Error              error      = kErrorNone;
+    DropReason         dropReason = kReasonUnknown;
+    Ip6::Header        ip6Header;
+    Ip4::Headers       ip4Headers;
+    Checksum::Adjuster adjuster;
+    uint16_t           dstPortOrId    = 0;
+    uint16_t           checksumOffset = 0;
+    bool               adjustChecksum = false;
+    Mapping           *mapping        = nullptr;
 
     VerifyOrExit(mState == kStateActive, error = kErrorDrop);
 
@@ -232,7 +273,7 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
         ExitNow(error = kErrorDrop);
     }
 
-    mapping = mActiveMappings.FindMatching(ip4Headers);
+    mapping = FindMapping(ip4Headers);
 
     if (mapping == nullptr)
     {
@@ -267,13 +308,29 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
     // The IP header is consumed , so the next header is at offset 0.
     case Ip4::kProtoUdp:
         ip6Header.SetNextHeader(Ip6::kProtoUdp);
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+        adjuster.RemoveUint16(ip4Headers.GetDestinationPort());
+        adjuster.AddUint16(dstPortOrId);
+#endif
         ip4Headers.SetDestinationPort(dstPortOrId);
         aMessage.Write(0, ip4Headers.GetUdpHeader());
+        checksumOffset = Ip6::Udp::Header::kChecksumFieldOffset;
+
+        // An IPv4 UDP datagram may carry an omitted (zero) checksum,
+        // in which case the mandatory IPv6 UDP checksum is calculated
+        // from scratch.
+        adjustChecksum = (ip4Headers.GetUdpHeader().GetChecksum() != 0);
         break;
     case Ip4::kProtoTcp:
         ip6Header.SetNextHeader(Ip6::kProtoTcp);
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+        adjuster.RemoveUint16(ip4Headers.GetDestinationPort());
+        adjuster.AddUint16(dstPortOrId);
+#endif
         ip4Headers.SetDestinationPort(dstPortOrId);
         aMessage.Write(0, ip4Headers.GetTcpHeader());
+        checksumOffset = Ip6::Tcp::Header::kChecksumFieldOffset;
+        adjustChecksum = true;
         break;
     case Ip4::kProtoIcmp:
         ip6Header.SetNextHeader(Ip6::kProtoIcmp6);
@@ -287,8 +344,23 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
     // TODO: Implement the logic for replying ICMP datagrams.
     ip6Header.SetPayloadLength(aMessage.DetermineLengthAfterOffset());
 
-    Checksum::UpdateMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
-                                    ip6Header.GetNextHeader());
+    if (adjustChecksum)
+    {
+        // Same incremental pseudo-header adjustment as in
+        // `TranslateIp6ToIp4()`.
+
+        adjuster.RemoveData(ip4Headers.GetSourceAddress().GetBytes(), sizeof(Ip4::Address));
+        adjuster.RemoveData(ip4Headers.GetDestinationAddress().GetBytes(), sizeof(Ip4::Address));
+        adjuster.AddData(ip6Header.GetSource().GetBytes(), sizeof(Ip6::Address));
+        adjuster.AddData(ip6Header.GetDestination().GetBytes(), sizeof(Ip6::Address));
+
+        adjuster.ApplyTo(aMessage, aMessage.GetOffset() + checksumOffset);
+    }
+    else
+    {
+        Checksum::UpdateMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
+                                        ip6Header.GetNextHeader());
+    }
 
     if (aMessage.Prepend(ip6Header) != kErrorNone)
     {
@@ -350,6 +422,7 @@ void Translator::Mapping::Free(void)
 {
     LogInfo("Mapping removed: %s", ToString().AsCString());
 
+    Get<Translator>().RemoveFromHashBuckets(*this);
     Get<Translator>().mMappingPool.Free(*this);
 }
 
@@ -463,6 +536,8 @@ Translator::Mapping *Translator::AllocateMapping(const Ip6::Headers &aIp6Headers
     mapping->mTranslatedPortOrId = AllocateSourcePort(mapping->mSrcPortOrId);
 #endif
 
+    AddToHashBuckets(*mapping);
+
     LogInfo("Mapping created: %s", mapping->ToString().AsCString());
 
 exit:
@@ -538,6 +613,139 @@ bool Translator::Mapping::IsBetterEvictionCandidateOver(const Mapping &aOther, T
     return isBetter;
 }
 
+uint16_t Translator::DetermineBucketIndex(const uint8_t *aBytes, uint16_t aLength, uint16_t aPortOrId)
+{
+    // Calculates an FNV-1a hash over the key bytes and the port (or
+    // ICMP ID) and folds it into the bucket range. The hashed key
+    // uses exactly the fields compared by the `Mapping::Matches()`
+    // methods, so a hashed lookup finds the same mapping a linear
+    // scan would.
+
+    uint32_t hash = 2166136261u;
+
+    for (uint16_t index = 0; index < aLength; index++)
+    {
+        hash = (hash ^ aBytes[index]) * 16777619u;
+    }
+
+    hash = (hash ^ (aPortOrId & 0xffu)) * 16777619u;
+    hash = (hash ^ (aPortOrId >> 8)) * 16777619u;
+
+    return static_cast<uint16_t>((hash ^ (hash >> 16)) & (kNumHashBuckets - 1));
+}
+
+uint16_t Translator::DetermineIp6BucketIndex(const Ip6::Address &aIp6Address, uint16_t aPortOrId)
+{
+    return DetermineBucketIndex(aIp6Address.GetBytes(), sizeof(Ip6::Address), aPortOrId);
+}
+
+uint16_t Translator::DetermineIp4BucketIndex(const Ip4::Address &aIp4Address, uint16_t aPortOrId)
+{
+    return DetermineBucketIndex(aIp4Address.GetBytes(), sizeof(Ip4::Address), aPortOrId);
+}
+
+void Translator::AddToHashBuckets(Mapping &aMapping)
+{
+    uint16_t ip6PortOrId = 0;
+    uint16_t ip4PortOrId = 0;
+    uint16_t ip6Index;
+    uint16_t ip4Index;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    ip6PortOrId = aMapping.mSrcPortOrId;
+    ip4PortOrId = aMapping.mTranslatedPortOrId;
+#endif
+
+    ip6Index = DetermineIp6BucketIndex(aMapping.mIp6Address, ip6PortOrId);
+    ip4Index = DetermineIp4BucketIndex(aMapping.mIp4Address, ip4PortOrId);
+
+    aMapping.mNextIp6Hash     = mIp6HashBuckets[ip6Index];
+    mIp6HashBuckets[ip6Index] = &aMapping;
+
+    aMapping.mNextIp4Hash     = mIp4HashBuckets[ip4Index];
+    mIp4HashBuckets[ip4Index] = &aMapping;
+}
+
+void Translator::RemoveFromHashBuckets(Mapping &aMapping)
+{
+    uint16_t ip6PortOrId = 0;
+    uint16_t ip4PortOrId = 0;
+    uint16_t ip6Index;
+    uint16_t ip4Index;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    ip6PortOrId = aMapping.mSrcPortOrId;
+    ip4PortOrId = aMapping.mTranslatedPortOrId;
+#endif
+
+    ip6Index = DetermineIp6BucketIndex(aMapping.mIp6Address, ip6PortOrId);
+    ip4Index = DetermineIp4BucketIndex(aMapping.mIp4Address, ip4PortOrId);
+
+    for (Mapping **prev = &mIp6HashBuckets[ip6Index]; *prev != nullptr; prev = &(*prev)->mNextIp6Hash)
+    {
+        if (*prev == &aMapping)
+        {
+            *prev = aMapping.mNextIp6Hash;
+            break;
+        }
+    }
+
+    for (Mapping **prev = &mIp4HashBuckets[ip4Index]; *prev != nullptr; prev = &(*prev)->mNextIp4Hash)
+    {
+        if (*prev == &aMapping)
+        {
+            *prev = aMapping.mNextIp4Hash;
+            break;
+        }
+    }
+}
+
+Translator::Mapping *Translator::FindMapping(const Ip6::Headers &aIp6Headers)
+{
+    Mapping *mapping;
+    uint16_t portOrId = 0;
+    uint16_t index;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    portOrId = GetSourcePortOrIcmp6Id(aIp6Headers);
+#endif
+
+    index = DetermineIp6BucketIndex(aIp6Headers.GetSourceAddress(), portOrId);
+
+    for (mapping = mIp6HashBuckets[index]; mapping != nullptr; mapping = mapping->mNextIp6Hash)
+    {
+        if (mapping->Matches(aIp6Headers))
+        {
+            break;
+        }
+    }
+
+    return mapping;
+}
+
+Translator::Mapping *Translator::FindMapping(const Ip4::Headers &aIp4Headers)
+{
+    Mapping *mapping;
+    uint16_t portOrId = 0;
+    uint16_t index;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    portOrId = GetDestinationPortOrIcmp4Id(aIp4Headers);
+#endif
+
+    index = DetermineIp4BucketIndex(aIp4Headers.GetDestinationAddress(), portOrId);
+
+    for (mapping = mIp4HashBuckets[index]; mapping != nullptr; mapping = mapping->mNextIp4Hash)
+    {
+        if (mapping->Matches(aIp4Headers))
+        {
+            break;
+        }
+    }
+
+    return mapping;
+}
+
 void Translator::EvictStaleMapping(void)
 {
     // First tries to remove expired mappings, if there is no expired
@@ -588,6 +796,8 @@ void Translator::Mapping::Touch(uint8_t aProtocol)
 
     mLastUseTime    = TimerMilli::GetNow();
     mExpirationTime = mLastUseTime + timeout;
+
+    Get<Translator>().mTimer.FireAtIfEarlier(mExpirationTime);
 }
 
 bool Translator::Mapping::Matches(const Ip6::Headers &aIp6Headers) const
@@ -785,8 +995,21 @@ exit:
 
 void Translator::HandleTimer(void)
 {
-    mActiveMappings.RemoveAndFreeAllMatching(ExpirationChecker(TimerMilli::GetNow()));
-    mTimer.Start(Min(kIcmpTimeout, kIdleTimeout));
+    // The timer is scheduled for the earliest expiration time among
+    // the active mappings (and re-scheduled from `Mapping::Touch()`
+    // whenever a mapping gains an earlier deadline), so expired
+    // mappings are removed in bulk without any periodic scan.
+
+    NextFireTime nextTime;
+
+    mActiveMappings.RemoveAndFreeAllMatching(ExpirationChecker(nextTime.GetNow()));
+
+    for (const Mapping &mapping : mActiveMappings)
+    {
+        nextTime.UpdateIfEarlier(mapping.mExpirationTime);
+    }
+
+    mTimer.FireAt(nextTime);
 }
 
 void Translator::AddressMappingIterator::Init(Instance &aInstance)
@@ -860,6 +1083,31 @@ void Translator::ProtocolCounters::Update4To6(Counters &aCounters, uint16_t aSiz
     aCounters.m4To6Bytes += aSize;
 }
 
+void Translator::GetCounters(ProtocolCounters &aCounters) const
+{
+    aCounters = mCounters;
+
+    for (const Mapping &mapping : mActiveMappings)
+    {
+        aCounters.mTotal.mSessions++;
+
+        if (!Mapping::IsCounterZero(mapping.mCounters.mIcmp))
+        {
+            aCounters.mIcmp.mSessions++;
+        }
+
+        if (!Mapping::IsCounterZero(mapping.mCounters.mUdp))
+        {
+            aCounters.mUdp.mSessions++;
+        }
+
+        if (!Mapping::IsCounterZero(mapping.mCounters.mTcp))
+        {
+            aCounters.mTcp.mSessions++;
+        }
+    }
+}
+
 void Translator::SetState(State aState)
 {
     VerifyOrExit(mState != aState);
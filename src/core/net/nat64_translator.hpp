@@ -260,11 +260,12 @@ public:
     /**
      * Gets the NAT64 translator counters.
      *
-     * The counters are initialized to zero when the OpenThread instance is initialized.
+     * The counters are initialized to zero when the OpenThread instance is initialized. The `mSessions` fields
+     * are determined from the active mapping table when the counters are read.
      *
-     * @returns The protocol counters.
+     * @param[out] aCounters  A `ProtocolCounters` to populate with the translator counters.
      */
-    const ProtocolCounters &GetCounters(void) const { return mCounters; }
+    void GetCounters(ProtocolCounters &aCounters) const;
 
     /**
      * Gets the NAT64 translator error counters.
@@ -287,6 +288,9 @@ private:
 
     static constexpr uint32_t kPoolSize = OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS;
 
+    // Number of buckets in the hashed mapping indexes (must be a power of two).
+    static constexpr uint16_t kNumHashBuckets = 32;
+
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     static constexpr uint16_t kMinTranslationPort = 49152;
     static constexpr uint16_t kMaxTranslationPort = 65535;
@@ -332,6 +336,8 @@ private:
         static bool IsCounterZero(const ProtocolCounters::Counters &aCounters);
 
         Mapping         *mNext;
+        Mapping         *mNextIp6Hash; // Next mapping in the same IPv6 hash bucket chain.
+        Mapping         *mNextIp4Hash; // Next mapping in the same IPv4 hash bucket chain.
         uint64_t         mId;
         TimeMilli        mLastUseTime;
         TimeMilli        mExpirationTime;
@@ -355,12 +361,19 @@ private:
     Mapping *AllocateMapping(const Ip6::Headers &aIp6Headers);
     void     EvictStaleMapping(void);
     void     HandleTimer(void);
+    void     AddToHashBuckets(Mapping &aMapping);
+    void     RemoveFromHashBuckets(Mapping &aMapping);
+    Mapping *FindMapping(const Ip6::Headers &aIp6Headers);
+    Mapping *FindMapping(const Ip4::Headers &aIp4Headers);
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     uint16_t AllocateSourcePort(uint16_t aSrcPort);
 #endif
 
     static uint16_t GetSourcePortOrIcmp6Id(const Ip6::Headers &aIp6Headers);
     static uint16_t GetDestinationPortOrIcmp4Id(const Ip4::Headers &aIp4Headers);
+    static uint16_t DetermineBucketIndex(const uint8_t *aBytes, uint16_t aLength, uint16_t aPortOrId);
+    static uint16_t DetermineIp6BucketIndex(const Ip6::Address &aIp6Address, uint16_t aPortOrId);
+    static uint16_t DetermineIp4BucketIndex(const Ip4::Address &aIp4Address, uint16_t aPortOrId);
 
     using TranslatorTimer = TimerMilliIn<Translator, &Translator::HandleTimer>;
 
@@ -368,6 +381,8 @@ private:
     uint64_t                 mNextMappingId;
     Pool<Mapping, kPoolSize> mMappingPool;
     OwningList<Mapping>      mActiveMappings;
+    Mapping                 *mIp6HashBuckets[kNumHashBuckets];
+    Mapping                 *mIp4HashBuckets[kNumHashBuckets];
     Ip6::Prefix              mNat64Prefix;
     Ip4::Cidr                mIp4Cidr;
     uint32_t                 mMinHostId;
@@ -756,6 +756,20 @@ public:
      */
     void GetAsPacket(Icmp6Packet &aPacket) const { aPacket.Init(mArray.AsCArray(), mArray.GetLength()); }
 
+    /**
+     * Reserves buffer capacity in the ND6 message.
+     *
+     * Pre-reserving the expected final message size ensures the header and all appended options are assembled
+     * directly into their final buffer, avoiding intermediate reallocations (and copies of the partially
+     * prepared message) while the message is being built.
+     *
+     * @param[in] aCapacity  The capacity to reserve (number of bytes).
+     *
+     * @retval kErrorNone    Capacity reserved successfully.
+     * @retval kErrorNoBufs  Insufficient available buffers to reserve @p aCapacity.
+     */
+    Error ReserveCapacity(uint16_t aCapacity) { return mArray.ReserveCapacity(aCapacity); }
+
     /**
      * Appends bytes from a given buffer to the ND6 message.
      *
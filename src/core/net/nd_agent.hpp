@@ -66,6 +66,8 @@ private:
     void FreeAloc(void) { mAloc.mNext = &mAloc; }
     bool IsAlocInUse(void) const { return mAloc.mNext != &mAloc; }
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged;
+
     void HandleNotifierEvents(Events aEvents);
     void UpdateService(void);
 
@@ -89,12 +89,52 @@ const otNetifMulticastAddress Netif::kLinkLocalAllRoutersMulticastAddress = {
 
 Netif::Netif(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mUnicastAddressFilter(0)
+    , mMulticastAddressFilter(0)
 #if OPENTHREAD_CONFIG_IP6_INIT_EXT_ADDR_POOL_ENABLE
     , mInitialized(false)
 #endif
 {
 }
 
+uint64_t Netif::AddressFilterBit(const Address &aAddress)
+{
+    // Determines the bit in the 64-bit address filters corresponding
+    // to a given address. The filters provide an O(1) "definitely
+    // not assigned/subscribed" check before the address lists are
+    // searched; a set bit (possible false positive) falls back to
+    // the list walk.
+
+    uint8_t hash = 0;
+
+    for (uint8_t byte : aAddress.mFields.m8)
+    {
+        hash ^= byte;
+    }
+
+    return (static_cast<uint64_t>(1) << (hash & 63));
+}
+
+void Netif::RebuildUnicastAddressFilter(void)
+{
+    mUnicastAddressFilter = 0;
+
+    for (const UnicastAddress &address : mUnicastAddresses)
+    {
+        mUnicastAddressFilter |= AddressFilterBit(address.GetAddress());
+    }
+}
+
+void Netif::RebuildMulticastAddressFilter(void)
+{
+    mMulticastAddressFilter = 0;
+
+    for (const MulticastAddress &address : mMulticastAddresses)
+    {
+        mMulticastAddressFilter |= AddressFilterBit(address.GetAddress());
+    }
+}
+
 #if OPENTHREAD_CONFIG_IP6_INIT_EXT_ADDR_POOL_ENABLE
 
 Error Netif::Init(UnicastAddress   *aUnicastAddrPool,
@@ -117,7 +157,8 @@ exit:
 
 bool Netif::IsMulticastSubscribed(const Address &aAddress) const
 {
-    return mMulticastAddresses.ContainsMatching(aAddress);
+    return ((mMulticastAddressFilter & AddressFilterBit(aAddress)) != 0) &&
+           mMulticastAddresses.ContainsMatching(aAddress);
 }
 
 void Netif::SubscribeAllNodesMulticast(void)
@@ -265,6 +306,15 @@ exit:
 
 void Netif::SignalMulticastAddressChange(AddressEvent aEvent, const MulticastAddress &aAddress)
 {
+    if (aEvent == kAddressAdded)
+    {
+        mMulticastAddressFilter |= AddressFilterBit(aAddress.GetAddress());
+    }
+    else
+    {
+        RebuildMulticastAddressFilter();
+    }
+
     Get<Notifier>().Signal(aEvent == kAddressAdded ? kEventIp6MulticastSubscribed : kEventIp6MulticastUnsubscribed);
 
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
@@ -425,6 +475,15 @@ void Netif::SignalUnicastAddressChange(AddressEvent aEvent, const UnicastAddress
 {
     Event event;
 
+    if (aEvent == kAddressAdded)
+    {
+        mUnicastAddressFilter |= AddressFilterBit(aAddress.GetAddress());
+    }
+    else
+    {
+        RebuildUnicastAddressFilter();
+    }
+
     if (aAddress.mRloc)
     {
         event = (aEvent == kAddressAdded) ? kEventThreadRlocAdded : kEventThreadRlocRemoved;
@@ -487,6 +546,7 @@ Error Netif::AddExternalUnicastAddress(const UnicastAddress &aAddress)
     entry->mRloc          = false;
     entry->mMeshLocal     = false;
     entry->mSrpRegistered = false;
+    entry->mRxCounter     = 0;
 
     mUnicastAddresses.Push(*entry);
     SignalUnicastAddressChange(kAddressAdded, *entry);
@@ -531,7 +591,21 @@ void Netif::RemoveAllExternalUnicastAddresses(void)
     }
 }
 
-bool Netif::HasUnicastAddress(const Address &aAddress) const { return mUnicastAddresses.ContainsMatching(aAddress); }
+bool Netif::HasUnicastAddress(const Address &aAddress) const
+{
+    return ((mUnicastAddressFilter & AddressFilterBit(aAddress)) != 0) && mUnicastAddresses.ContainsMatching(aAddress);
+}
+
+Netif::UnicastAddress *Netif::FindUnicastAddress(const Address &aAddress)
+{
+    UnicastAddress *entry = nullptr;
+
+    VerifyOrExit((mUnicastAddressFilter & AddressFilterBit(aAddress)) != 0);
+    entry = mUnicastAddresses.FindMatching(aAddress);
+
+exit:
+    return entry;
+}
 
 bool Netif::IsUnicastAddressExternal(const UnicastAddress &aAddress) const
 {
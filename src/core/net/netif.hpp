@@ -427,6 +427,15 @@ public:
      */
     bool HasUnicastAddress(const Address &aAddress) const;
 
+    /**
+     * Finds the unicast address entry matching a given IPv6 address.
+     *
+     * @param[in]  aAddress  A reference to the IPv6 address.
+     *
+     * @returns A pointer to the matching `UnicastAddress` entry, or `nullptr` if no match is found.
+     */
+    UnicastAddress *FindUnicastAddress(const Address &aAddress);
+
     /**
      * Indicates whether or not a unicast address is assigned to the network interface.
      *
@@ -612,9 +621,15 @@ private:
     void SignalMulticastAddressesChange(AddressEvent            aEvent,
                                         const MulticastAddress *aStart,
                                         const MulticastAddress *aEnd);
+    void RebuildUnicastAddressFilter(void);
+    void RebuildMulticastAddressFilter(void);
+
+    static uint64_t AddressFilterBit(const Address &aAddress);
 
     LinkedList<UnicastAddress>     mUnicastAddresses;
     LinkedList<MulticastAddress>   mMulticastAddresses;
+    uint64_t                       mUnicastAddressFilter;
+    uint64_t                       mMulticastAddressFilter;
     Callback<otIp6AddressCallback> mAddressCallback;
 
 #if OPENTHREAD_CONFIG_IP6_INIT_EXT_ADDR_POOL_ENABLE
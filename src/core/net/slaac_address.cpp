@@ -132,8 +132,16 @@ void Slaac::HandleNotifierEvents(Events aEvents)
 
     if (aEvents.Contains(kEventThreadNetdataChanged))
     {
-        RemoveOrDeprecateAddresses();
-        AddAddresses();
+        // SLAAC addresses are derived from on-mesh prefix entries
+        // only, so reprocessing can be skipped when the Network Data
+        // change did not touch any prefix entry.
+
+        if (Get<NetworkData::Leader>().GetChangedCategories() & NetworkData::Leader::kPrefixesChanged)
+        {
+            RemoveOrDeprecateAddresses();
+            AddAddresses();
+        }
+
         ExitNow();
     }
 
@@ -207,7 +215,11 @@ void Slaac::RemoveOrDeprecateAddresses(void)
         }
         else if (!slaacAddr.IsDeprecating())
         {
-            if (slaacAddr.mPreferred)
+            // An address that is still waiting for its staggered netif
+            // registration has no users yet, so it is removed directly
+            // rather than deprecated.
+
+            if (slaacAddr.mPreferred && slaacAddr.IsRegistered())
             {
                 DeprecateAddress(slaacAddr);
             }
@@ -244,7 +256,11 @@ void Slaac::RemoveAddress(SlaacAddress &aAddress)
 {
     LogAddress(kRemoving, aAddress);
 
-    Get<ThreadNetif>().RemoveUnicastAddress(aAddress);
+    if (aAddress.IsRegistered())
+    {
+        Get<ThreadNetif>().RemoveUnicastAddress(aAddress);
+    }
+
     aAddress.MarkAsNotInUse();
 }
 
@@ -352,14 +368,54 @@ void Slaac::AddAddressFor(const NetworkData::OnMeshPrefixConfig &aConfig)
     newAddress->SetContextId(SlaacAddress::kInvalidContextId);
     UpdateContextIdFor(*newAddress);
 
-    LogAddress(kAdding, *newAddress);
-
-    Get<ThreadNetif>().AddUnicastAddress(*newAddress);
+    newAddress->SetRegistered(false);
+    ScheduleRegistration(*newAddress);
 
 exit:
     return;
 }
 
+void Slaac::ScheduleRegistration(SlaacAddress &aAddress)
+{
+    // Netif registrations within a burst of Network Data changes are
+    // staggered `kRegistrationStagger` apart, so that the address
+    // registration signaling (MLE Child Update, DUA registration)
+    // triggered by each addition is spread out rather than occurring
+    // back to back. The first address of a burst is registered
+    // immediately.
+
+    TimeMilli regTime = TimerMilli::GetNow();
+
+    for (const SlaacAddress &slaacAddr : mSlaacAddresses)
+    {
+        if (!slaacAddr.IsInUse() || slaacAddr.IsRegistered() || (&slaacAddr == &aAddress))
+        {
+            continue;
+        }
+
+        regTime = Max(regTime, slaacAddr.GetRegistrationTime() + kRegistrationStagger);
+    }
+
+    if (regTime == TimerMilli::GetNow())
+    {
+        RegisterAddress(aAddress);
+    }
+    else
+    {
+        aAddress.SetRegistrationTime(regTime);
+        mTimer.FireAtIfEarlier(regTime);
+    }
+}
+
+void Slaac::RegisterAddress(SlaacAddress &aAddress)
+{
+    aAddress.SetRegistered(true);
+
+    LogAddress(kAdding, aAddress);
+
+    Get<ThreadNetif>().AddUnicastAddress(aAddress);
+}
+
 bool Slaac::UpdateContextIdFor(SlaacAddress &aSlaacAddress)
 {
     bool            didChange = false;
@@ -384,7 +440,26 @@ void Slaac::HandleTimer(void)
 
     for (SlaacAddress &slaacAddr : mSlaacAddresses)
     {
-        if (!slaacAddr.IsInUse() || !slaacAddr.IsDeprecating())
+        if (!slaacAddr.IsInUse())
+        {
+            continue;
+        }
+
+        if (!slaacAddr.IsRegistered())
+        {
+            if (slaacAddr.GetRegistrationTime() <= nextTime.GetNow())
+            {
+                RegisterAddress(slaacAddr);
+            }
+            else
+            {
+                nextTime.UpdateIfEarlier(slaacAddr.GetRegistrationTime());
+            }
+
+            continue;
+        }
+
+        if (!slaacAddr.IsDeprecating())
         {
             continue;
         }
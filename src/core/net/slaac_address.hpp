@@ -158,6 +158,8 @@ private:
     static constexpr uint32_t kDeprecationInterval =
         TimeMilli::SecToMsec(OPENTHREAD_CONFIG_IP6_SLAAC_DEPRECATION_INTERVAL);
 
+    static constexpr uint32_t kRegistrationStagger = OPENTHREAD_CONFIG_IP6_SLAAC_REGISTRATION_STAGGER_INTERVAL;
+
     enum Action : uint8_t
     {
         kAdding,
@@ -172,6 +174,10 @@ private:
 
         bool      IsInUse(void) const { return mValid; }
         void      MarkAsNotInUse(void) { mValid = false; }
+        bool      IsRegistered(void) const { return mRegistered; }
+        void      SetRegistered(bool aRegistered) { mRegistered = aRegistered; }
+        TimeMilli GetRegistrationTime(void) const { return mRegistrationTime; }
+        void      SetRegistrationTime(TimeMilli aTime) { mRegistrationTime = aTime; }
         uint8_t   GetContextId(void) const { return mContextId; }
         void      SetContextId(uint8_t aContextId) { mContextId = aContextId; }
         uint8_t   GetDomainId(void) const { return mDomainId; }
@@ -192,9 +198,11 @@ private:
     private:
         static constexpr uint32_t kNotDeprecated = 0; // Special `mExpirationTime` value to indicate not deprecated.
 
+        bool      mRegistered;
         uint8_t   mContextId;
         uint8_t   mDomainId;
         TimeMilli mExpirationTime;
+        TimeMilli mRegistrationTime;
     };
 
     bool        IsSlaac(const NetworkData::OnMeshPrefixConfig &aConfig) const;
@@ -205,9 +213,13 @@ private:
     void        DeprecateAddress(SlaacAddress &aAddress);
     void        RemoveAddress(SlaacAddress &aAddress);
     void        AddAddressFor(const NetworkData::OnMeshPrefixConfig &aConfig);
+    void        ScheduleRegistration(SlaacAddress &aAddress);
+    void        RegisterAddress(SlaacAddress &aAddress);
     bool        UpdateContextIdFor(SlaacAddress &aSlaacAddress);
     void        HandleTimer(void);
     void        GetIidSecretKey(IidSecretKey &aKey) const;
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged | kEventIp6AddressRemoved;
+
     void        HandleNotifierEvents(Events aEvents);
     void        LogAddress(Action aAction, const SlaacAddress &aAddress);
     static bool DoesConfigMatchNetifAddr(const NetworkData::OnMeshPrefixConfig &aConfig,
@@ -662,7 +662,8 @@ exit:
 // NOLINTNEXTLINE(readability-inconsistent-declaration-parameter-name)
 template <> bool AdvertisingProxy::EntriesMatch(const Host &aFirstHost, const Host &aSecondHost)
 {
-    bool match = false;
+    bool     match = false;
+    uint16_t numAddresses;
 
     VerifyOrExit(aFirstHost.IsDeleted() == aSecondHost.IsDeleted());
 
@@ -672,13 +673,35 @@ template <> bool AdvertisingProxy::EntriesMatch(const Host &aFirstHost, const Ho
         ExitNow();
     }
 
-    VerifyOrExit(aFirstHost.mAddresses.GetLength() == aSecondHost.mAddresses.GetLength());
+    // Compare only the addresses that are advertisable on the
+    // infrastructure (`RegisterHost()` filters out link-local and
+    // mesh-local addresses), so that a change limited to filtered
+    // addresses does not cause a host re-registration.
+
+    numAddresses = 0;
+
+    for (const Ip6::Address &address : aSecondHost.mAddresses)
+    {
+        if (IsAddressAdvertisable(address))
+        {
+            numAddresses++;
+        }
+    }
 
     for (const Ip6::Address &address : aFirstHost.mAddresses)
     {
+        if (!IsAddressAdvertisable(address))
+        {
+            continue;
+        }
+
         VerifyOrExit(aSecondHost.mAddresses.Contains(address));
+        VerifyOrExit(numAddresses > 0);
+        numAddresses--;
     }
 
+    VerifyOrExit(numAddresses == 0);
+
     match = true;
 
 exit:
@@ -773,6 +796,7 @@ template <typename Entry> bool AdvertisingProxy::CompareAndUpdate(Entry &aEntry,
     if (aExistingEntry.mIsRegistered)
     {
         aEntry.mIsRegistered = true;
+        mCounters.mEntryUpdatesSkipped++;
     }
     else if (aExistingEntry.mAdvId != kInvalidRequestId)
     {
@@ -780,6 +804,7 @@ template <typename Entry> bool AdvertisingProxy::CompareAndUpdate(Entry &aEntry,
         // `aExistingEntry`. We use the same ID for the new `aEntry`.
 
         aEntry.mAdvId = aExistingEntry.mAdvId;
+        mCounters.mEntryUpdatesSkipped++;
     }
     else
     {
@@ -923,6 +948,11 @@ exit:
     return replaced;
 }
 
+bool AdvertisingProxy::IsAddressAdvertisable(const Ip6::Address &aAddress) const
+{
+    return !aAddress.IsLinkLocalUnicast() && !Get<Mle::Mle>().IsMeshLocalAddress(aAddress);
+}
+
 void AdvertisingProxy::RegisterHost(Host &aHost)
 {
     Error                     error = kErrorNone;
@@ -938,7 +968,7 @@ void AdvertisingProxy::RegisterHost(Host &aHost)
 
     for (const Ip6::Address &address : aHost.mAddresses)
     {
-        if (!address.IsLinkLocalUnicast() && !Get<Mle::Mle>().IsMeshLocalAddress(address))
+        if (IsAddressAdvertisable(address))
         {
             IgnoreError(hostAddresses.PushBack(address));
         }
@@ -946,6 +976,8 @@ void AdvertisingProxy::RegisterHost(Host &aHost)
 
     LogInfo("Registering host '%s', id:%lu", hostName, ToUlong(aHost.mAdvId));
 
+    mCounters.mEntryUpdates++;
+
     hostInfo.Clear();
     hostInfo.mHostName        = hostName;
     hostInfo.mAddresses       = hostAddresses.AsCArray();
@@ -1010,6 +1042,8 @@ void AdvertisingProxy::RegisterService(Service &aService)
     LogInfo("Registering service '%s' '%s' on '%s', id:%lu", aService.GetInstanceLabel(), serviceName, hostName,
             ToUlong(aService.mAdvId));
 
+    mCounters.mEntryUpdates++;
+
     serviceInfo.Clear();
     serviceInfo.mHostName            = hostName;
     serviceInfo.mServiceInstance     = aService.GetInstanceLabel();
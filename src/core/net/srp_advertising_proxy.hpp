@@ -77,15 +77,17 @@ public:
      */
     struct Counters : public Clearable<Counters>
     {
-        uint32_t mAdvTotal;           ///< Total number of advertisement requests, i.e., calls to `Advertise()`.
-        uint32_t mAdvReplaced;        ///< Number of advertisements that were replaced by a newer one.
-        uint32_t mAdvSkipped;         ///< Number of advertisement that were skipped (DNS-SD platform not yet ready).
-        uint32_t mAdvSuccessful;      ///< Number of successful adv (all requests registered successfully).
-        uint32_t mAdvRejected;        ///< Number of rejected adv (at least one request was rejected by DNS-SD plat).
-        uint32_t mAdvTimeout;         ///< Number of advertisements that timed out (no response from DNS-SD platform).
-        uint32_t mAdvHostRemovals;    ///< Number of host removal adv, i.e., calls to `AdvertiseRemovalOf(Host &)`
-        uint32_t mAdvServiceRemovals; ///< Number of service removal adv, i.e., calls to `AdvertiseRemovalOf(Service &)`
-        uint32_t mStateChanges;       ///< Number of state changes of Advertising Proxy.
+        uint32_t mAdvTotal;            ///< Total number of advertisement requests, i.e., calls to `Advertise()`.
+        uint32_t mAdvReplaced;         ///< Number of advertisements that were replaced by a newer one.
+        uint32_t mAdvSkipped;          ///< Number of advertisement that were skipped (DNS-SD platform not yet ready).
+        uint32_t mAdvSuccessful;       ///< Number of successful adv (all requests registered successfully).
+        uint32_t mAdvRejected;         ///< Number of rejected adv (at least one request was rejected by DNS-SD plat).
+        uint32_t mAdvTimeout;          ///< Number of adv that timed out (no response from DNS-SD platform).
+        uint32_t mAdvHostRemovals;     ///< Number of host removal adv, i.e., calls to `AdvertiseRemovalOf(Host &)`
+        uint32_t mAdvServiceRemovals;  ///< Number of service removal adv, calls to `AdvertiseRemovalOf(Service &)`
+        uint32_t mStateChanges;        ///< Number of state changes of Advertising Proxy.
+        uint32_t mEntryUpdates;        ///< Number of host/service registrations applied on DNS-SD platform.
+        uint32_t mEntryUpdatesSkipped; ///< Number of host/service entries skipped (unchanged from advertised state).
     };
 
     /**
@@ -215,7 +217,8 @@ private:
         kStateRunning,
     };
 
-    struct AdvInfo : public Heap::Allocatable<AdvInfo>, public LinkedListEntry<AdvInfo>, public GetProvider<AdvInfo>
+    struct AdvInfo : public Heap::Allocatable<AdvInfo, Heap::kOwnerSrp>, public LinkedListEntry<AdvInfo>,
+                     public GetProvider<AdvInfo>
     {
         struct CompletionChecker
         {
@@ -253,6 +256,7 @@ private:
     RequestId   AllocateNextRequestId(void);
     void        Advertise(Host &aHost);
     void        UnregisterHostAndItsServicesAndKeys(Host &aHost);
+    bool        IsAddressAdvertisable(const Ip6::Address &aAddress) const;
     bool        CompareAndUpdateHostAndServices(Host &aHost, Host &aExistingHost);
     bool        CompareAndUpdateHost(Host &aHost, Host &aExistingHost);
     bool        CompareAndUpdateService(Service &aService, Service &aExistingService);
@@ -1291,7 +1291,7 @@ Error Client::AppendServiceInstructions(MsgInfo &aInfo)
         }
     }
 
-    if (!aInfo.mSingleServiceMode)
+    if (!aInfo.mSingleServiceMode && ShouldCoalesceLeaseRenewals())
     {
         for (Service &service : mServices)
         {
@@ -2181,6 +2181,38 @@ bool Client::ShouldRenewEarly(const Service &aService) const
     return shouldRenew;
 }
 
+bool Client::ShouldCoalesceLeaseRenewals(void) const
+{
+    // Determines whether the update message being prepared should pull
+    // in already registered services that are close to their lease
+    // renew time (see `ShouldRenewEarly()`). By default, this is done
+    // for every update message. In differential update mode, it is
+    // limited to updates that are themselves driven by lease renewal,
+    // i.e., contain at least one appended service that reached its
+    // renew time. This ensures that a change to a single service does
+    // not re-send the full service list, while lease-renewal updates
+    // still re-sync nearly-due services onto a shared refresh schedule.
+
+    bool shouldCoalesce = true;
+
+#if OPENTHREAD_CONFIG_SRP_CLIENT_DIFFERENTIAL_UPDATE_ENABLE
+    TimeMilli now = TimerMilli::GetNow();
+
+    shouldCoalesce = false;
+
+    for (const Service &service : mServices)
+    {
+        if (service.IsAppendedInMessage() && (service.GetLeaseRenewTime() <= now))
+        {
+            shouldCoalesce = true;
+            break;
+        }
+    }
+#endif
+
+    return shouldCoalesce;
+}
+
 void Client::HandleTimer(void)
 {
     switch (GetState())
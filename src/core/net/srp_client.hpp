@@ -1025,6 +1025,9 @@ private:
     void         Stop(Requester aRequester, StopMode aMode);
     void         Resume(void);
     void         Pause(void);
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadNetdataChanged |
+        kEventThreadMeshLocalAddrChanged | kEventIp6AddressAdded | kEventIp6AddressRemoved;
+
     void         HandleNotifierEvents(Events aEvents);
     void         HandleRoleChanged(void);
     void         HandleUnicastAddressEvent(Ip6::Netif::AddressEvent aEvent, const Ip6::Netif::UnicastAddress &aAddress);
@@ -1066,6 +1069,7 @@ private:
     uint32_t     DetermineLeaseInterval(uint32_t aInterval, uint32_t aDefaultInterval) const;
     uint32_t     DetermineTtl(void) const;
     bool         ShouldRenewEarly(const Service &aService) const;
+    bool         ShouldCoalesceLeaseRenewals(void) const;
     void         HandleTimer(void);
 #if OPENTHREAD_CONFIG_SRP_CLIENT_AUTO_START_API_ENABLE
     void  ApplyAutoStartGuardOnAttach(void);
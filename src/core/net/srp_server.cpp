@@ -92,7 +92,13 @@ Server::Server(Instance &aInstance)
 #if OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
     , mFastStartMode(false)
 #endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIG_VERIFY_CACHE_SIZE > 0
+    , mSigVerifyCacheIndex(0)
+#endif
 {
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIG_VERIFY_CACHE_SIZE > 0
+    ClearAllBytes(mSigVerifyCache);
+#endif
     IgnoreError(SetDomain(kDefaultDomain));
 }
 
@@ -721,7 +727,7 @@ void Server::CommitSrpUpdate(Error                    aError,
 
     if (!aHost.IsDeleted())
     {
-        mLeaseTimer.FireAtIfEarlier(Min(aHost.GetExpireTime(), aHost.GetKeyExpireTime()));
+        ScheduleLeaseTimerAt(Min(aHost.GetExpireTime(), aHost.GetKeyExpireTime()));
     }
 
 exit:
@@ -898,6 +904,15 @@ void Server::Stop(void)
         mOutstandingUpdates.Pop()->Free();
     }
 
+    // Cancel pending signature verifications. The entries are popped
+    // (and their hosts freed) but remain allocated until the platform
+    // invokes the verification callback, which frees an entry it can
+    // no longer find in the list.
+    while (!mPendingSigVerifies.IsEmpty())
+    {
+        mPendingSigVerifies.Pop()->mHost.Free();
+    }
+
     mLeaseTimer.Stop();
     mOutstandingUpdatesTimer.Stop();
 
@@ -975,7 +990,18 @@ void Server::ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata)
     SuccessOrExit(error = ProcessUpdateSection(*host, aMessage, aMetadata));
 
     // Parse lease time and validate signature.
-    SuccessOrExit(error = ProcessAdditionalSection(host, aMessage, aMetadata));
+    error = ProcessAdditionalSection(host, aMessage, aMetadata);
+
+    if (error == kErrorPending)
+    {
+        // The signature is being verified asynchronously by the
+        // platform. Ownership of `host` was transferred to the
+        // pending-verify entry, and processing continues from
+        // `HandleEcdsaVerifyResult()`.
+        ExitNow(error = kErrorNone);
+    }
+
+    SuccessOrExit(error);
 
 #if OPENTHREAD_FTD
     if (aMetadata.IsDirectRxFromClient())
@@ -1362,7 +1388,7 @@ bool Server::IsValidDeleteAllRecord(const Dns::ResourceRecord &aRecord)
            aRecord.GetTtl() == 0 && aRecord.GetLength() == 0;
 }
 
-Error Server::ProcessAdditionalSection(Host *aHost, const Message &aMessage, MessageMetadata &aMetadata) const
+Error Server::ProcessAdditionalSection(Host *aHost, const Message &aMessage, MessageMetadata &aMetadata)
 {
     Error             error = kErrorNone;
     Dns::OptRecord    optRecord;
@@ -1435,31 +1461,36 @@ Error Server::ProcessAdditionalSection(Host *aHost, const Message &aMessage, Mes
     VerifyOrExit(sigRecord.GetTypeCovered() == 0, error = kErrorFailed);
     VerifyOrExit(signatureLength == Crypto::Ecdsa::P256::Signature::kSize, error = kErrorParse);
 
-    SuccessOrExit(error = VerifySignature(aHost->mKey, aMessage, aMetadata.mDnsHeader, sigOffset, sigRdataOffset,
-                                          sigRecord.GetLength(), signerName));
-
     aMetadata.mOffset = offset;
 
+    error = VerifySignature(*aHost, aMessage, aMetadata, sigOffset, sigRdataOffset, sigRecord.GetLength(), signerName);
+
 exit:
-    LogWarnOnError(error, "process DNS Additional section");
+    if (error != kErrorPending)
+    {
+        LogWarnOnError(error, "process DNS Additional section");
+    }
+
     return error;
 }
 
-Error Server::VerifySignature(const Host::Key  &aKey,
-                              const Message    &aMessage,
-                              Dns::UpdateHeader aDnsHeader,
-                              uint16_t          aSigOffset,
-                              uint16_t          aSigRdataOffset,
-                              uint16_t          aSigRdataLength,
-                              const char       *aSignerName) const
+Error Server::VerifySignature(Host                  &aHost,
+                              const Message         &aMessage,
+                              const MessageMetadata &aMetadata,
+                              uint16_t               aSigOffset,
+                              uint16_t               aSigRdataOffset,
+                              uint16_t               aSigRdataLength,
+                              const char            *aSignerName)
 {
     Error                          error;
-    uint16_t                       offset = aMessage.GetOffset();
+    uint16_t                       offset    = aMessage.GetOffset();
+    Dns::UpdateHeader              dnsHeader = aMetadata.mDnsHeader;
     uint16_t                       signatureOffset;
     Crypto::Sha256                 sha256;
     Crypto::Sha256::Hash           hash;
     Crypto::Ecdsa::P256::Signature signature;
     Message                       *signerNameMessage = nullptr;
+    PendingSigVerify              *pendingVerify;
 
     VerifyOrExit(aSigRdataLength >= Crypto::Ecdsa::P256::Signature::kSize, error = kErrorInvalidArgs);
 
@@ -1476,23 +1507,131 @@ Error Server::VerifySignature(const Host::Key  &aKey,
     sha256.Update(*signerNameMessage, signerNameMessage->GetOffset(), signerNameMessage->GetLength());
 
     // We need the DNS header before appending the SIG RR.
-    aDnsHeader.SetAdditionalRecordCount(aDnsHeader.GetAdditionalRecordCount() - 1);
-    sha256.Update(aDnsHeader);
-    sha256.Update(aMessage, offset + sizeof(aDnsHeader), aSigOffset - offset - sizeof(aDnsHeader));
+    dnsHeader.SetAdditionalRecordCount(dnsHeader.GetAdditionalRecordCount() - 1);
+    sha256.Update(dnsHeader);
+    sha256.Update(aMessage, offset + sizeof(dnsHeader), aSigOffset - offset - sizeof(dnsHeader));
 
     sha256.Finish(hash);
 
     signatureOffset = aSigRdataOffset + aSigRdataLength - Crypto::Ecdsa::P256::Signature::kSize;
     SuccessOrExit(error = aMessage.Read(signatureOffset, signature));
 
-    error = aKey.Verify(hash, signature);
+    pendingVerify = PendingSigVerify::Allocate(GetInstance(), aHost, aMetadata);
+    VerifyOrExit(pendingVerify != nullptr, error = kErrorNoBufs);
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIG_VERIFY_CACHE_SIZE > 0
+    {
+        // The ECDSA verification is skipped if an identical update
+        // (same host key, signed data, and signature) was verified
+        // recently, e.g., when a client retransmits an update while
+        // the server is still processing the earlier copy. Since the
+        // host key is part of the cached digest, a key change can
+        // never match a cached entry.
+
+        Crypto::Sha256       digestSha256;
+        Crypto::Sha256::Hash digest;
+
+        digestSha256.Start();
+        digestSha256.Update(hash);
+        digestSha256.Update(aHost.mKey);
+        digestSha256.Update(signature);
+        digestSha256.Finish(digest);
+
+        for (const SigVerifyCacheEntry &entry : mSigVerifyCache)
+        {
+            if ((entry.mDigest == digest) && (TimerMilli::GetNow() <= entry.mVerifyTime + kSigVerifyCacheEntryLifetime))
+            {
+                pendingVerify->Free();
+                ExitNow(error = kErrorNone);
+            }
+        }
+
+        // The digest is added to the verify cache when the (possibly
+        // deferred) verification succeeds.
+        pendingVerify->mDigest = digest;
+    }
+#endif
+
+    mPendingSigVerifies.Push(*pendingVerify);
+
+    // The platform may complete the verification (invoking
+    // `HandleEcdsaVerifyResult()`) before this call returns, e.g., the
+    // default `otPlatCryptoEcdsaVerifyAsync()` verifies synchronously.
+    error = aHost.mKey.VerifyAsync(hash, signature, HandleEcdsaVerifyResult, pendingVerify);
+
+    if (error != kErrorNone)
+    {
+        // The verification could not be started, so the callback will
+        // not be invoked.
+        IgnoreError(mPendingSigVerifies.Remove(*pendingVerify));
+        pendingVerify->Free();
+        ExitNow();
+    }
+
+    error = kErrorPending;
 
 exit:
-    LogWarnOnError(error, "verify message signature");
+    if (error != kErrorPending)
+    {
+        LogWarnOnError(error, "verify message signature");
+    }
+
     FreeMessage(signerNameMessage);
     return error;
 }
 
+void Server::HandleEcdsaVerifyResult(otError aError, void *aContext)
+{
+    PendingSigVerify *pendingVerify = static_cast<PendingSigVerify *>(aContext);
+
+    pendingVerify->Get<Server>().HandleEcdsaVerifyResult(aError, *pendingVerify);
+}
+
+void Server::HandleEcdsaVerifyResult(Error aError, PendingSigVerify &aPendingVerify)
+{
+    Host                  &host     = aPendingVerify.mHost;
+    const MessageMetadata &metadata = aPendingVerify.mMetadata;
+
+    if (mPendingSigVerifies.Remove(aPendingVerify) != kErrorNone)
+    {
+        // The entry was canceled (server stopped) while the
+        // verification was in flight; its host is already freed.
+        ExitNow();
+    }
+
+    LogWarnOnError(aError, "verify message signature");
+
+    if (aError != kErrorNone)
+    {
+        if (metadata.IsDirectRxFromClient())
+        {
+            SendResponse(metadata.mDnsHeader, ErrorToDnsResponseCode(aError), *metadata.mMessageInfo);
+        }
+
+        host.Free();
+        ExitNow();
+    }
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIG_VERIFY_CACHE_SIZE > 0
+    mSigVerifyCache[mSigVerifyCacheIndex].mDigest     = aPendingVerify.mDigest;
+    mSigVerifyCache[mSigVerifyCacheIndex].mVerifyTime = TimerMilli::GetNow();
+
+    mSigVerifyCacheIndex = (mSigVerifyCacheIndex + 1) % OPENTHREAD_CONFIG_SRP_SERVER_SIG_VERIFY_CACHE_SIZE;
+#endif
+
+#if OPENTHREAD_FTD
+    if (metadata.IsDirectRxFromClient())
+    {
+        UpdateAddrResolverCacheTable(*metadata.mMessageInfo, host);
+    }
+#endif
+
+    HandleUpdate(host, metadata);
+
+exit:
+    aPendingVerify.Free();
+}
+
 void Server::HandleUpdate(Host &aHost, const MessageMetadata &aMetadata)
 {
     Error error = kErrorNone;
@@ -1748,6 +1887,27 @@ exit:
     return error;
 }
 
+void Server::ScheduleLeaseTimerAt(TimeMilli aFireTime)
+{
+    // Expiry processing is batched: the fire time is rounded up to the
+    // next `kLeaseExpiryGranularity` boundary, so that registrations
+    // expiring close together are removed in a single pass over the
+    // host list (with one batch of service update notifications)
+    // rather than with one timer firing per entry.
+
+    if (kLeaseExpiryGranularity != 0)
+    {
+        uint32_t remainder = aFireTime.GetValue() % kLeaseExpiryGranularity;
+
+        if (remainder != 0)
+        {
+            aFireTime += kLeaseExpiryGranularity - remainder;
+        }
+    }
+
+    mLeaseTimer.FireAtIfEarlier(aFireTime);
+}
+
 void Server::HandleLeaseTimer(void)
 {
     NextFireTime nextExpireTime;
@@ -1760,6 +1920,7 @@ void Server::HandleLeaseTimer(void)
         if (host->GetKeyExpireTime() <= nextExpireTime.GetNow())
         {
             LogInfo("KEY LEASE of host %s expired", host->GetFullName());
+            ++mLeaseCounters.mHostKeyLeaseExpirations;
 
             // Removes the whole host and all services if the KEY RR expired.
             RemoveHost(host, kDeleteName);
@@ -1782,6 +1943,7 @@ void Server::HandleLeaseTimer(void)
                 if (service->GetKeyExpireTime() <= nextExpireTime.GetNow())
                 {
                     service->Log(Service::kKeyLeaseExpired);
+                    ++mLeaseCounters.mServiceKeyLeaseExpirations;
                     host->RemoveService(service, kDeleteName, kNotifyServiceHandler);
                 }
                 else
@@ -1793,6 +1955,7 @@ void Server::HandleLeaseTimer(void)
         else if (host->GetExpireTime() <= nextExpireTime.GetNow())
         {
             LogInfo("LEASE of host %s expired", host->GetFullName());
+            ++mLeaseCounters.mHostLeaseExpirations;
 
             // If the host expired, delete all resources of this host and its services.
             for (Service &service : host->mServices)
@@ -1822,6 +1985,7 @@ void Server::HandleLeaseTimer(void)
                 if (service->GetKeyExpireTime() <= nextExpireTime.GetNow())
                 {
                     service->Log(Service::kKeyLeaseExpired);
+                    ++mLeaseCounters.mServiceKeyLeaseExpirations;
                     host->RemoveService(service, kDeleteName, kNotifyServiceHandler);
                 }
                 else if (service->mIsDeleted)
@@ -1832,6 +1996,7 @@ void Server::HandleLeaseTimer(void)
                 else if (service->GetExpireTime() <= nextExpireTime.GetNow())
                 {
                     service->Log(Service::kLeaseExpired);
+                    ++mLeaseCounters.mServiceLeaseExpirations;
 
                     // The service is expired, delete it.
                     host->RemoveService(service, kRetainName, kNotifyServiceHandler);
@@ -1845,7 +2010,10 @@ void Server::HandleLeaseTimer(void)
         }
     }
 
-    mLeaseTimer.FireAtIfEarlier(nextExpireTime);
+    if (nextExpireTime.IsSet())
+    {
+        ScheduleLeaseTimerAt(nextExpireTime.GetNextTime());
+    }
 }
 
 void Server::HandleOutstandingUpdatesTimer(void)
@@ -2321,6 +2489,22 @@ Server::UpdateMetadata::UpdateMetadata(Instance &aInstance, Host &aHost, const M
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// Server::PendingSigVerify
+
+Server::PendingSigVerify::PendingSigVerify(Instance &aInstance, Host &aHost, const MessageMetadata &aMessageMetadata)
+    : InstanceLocator(aInstance)
+    , mNext(nullptr)
+    , mHost(aHost)
+    , mMetadata(aMessageMetadata)
+{
+    if (aMessageMetadata.IsDirectRxFromClient())
+    {
+        mMessageInfo           = *aMessageMetadata.mMessageInfo;
+        mMetadata.mMessageInfo = &mMessageInfo;
+    }
+}
+
 } // namespace Srp
 } // namespace ot
 
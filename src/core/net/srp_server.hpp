@@ -71,6 +71,7 @@
 #include "common/retain_ptr.hpp"
 #include "common/timer.hpp"
 #include "crypto/ecdsa.hpp"
+#include "crypto/sha256.hpp"
 #include "net/dns_types.hpp"
 #include "net/dnssd.hpp"
 #include "net/ip6.hpp"
@@ -247,13 +248,13 @@ public:
     class Service : public otSrpServerService,
                     public LeaseTracker,
                     public LinkedListEntry<Service>,
-                    private Heap::Allocatable<Service>,
+                    private Heap::Allocatable<Service, Heap::kOwnerSrp>,
                     private NonCopyable
     {
         friend class Server;
         friend class LinkedList<Service>;
         friend class LinkedListEntry<Service>;
-        friend class Heap::Allocatable<Service>;
+        friend class Heap::Allocatable<Service, Heap::kOwnerSrp>;
         friend class AdvertisingProxy;
 
     public:
@@ -451,12 +452,12 @@ public:
                  public InstanceLocator,
                  public LeaseTracker,
                  public LinkedListEntry<Host>,
-                 private Heap::Allocatable<Host>,
+                 private Heap::Allocatable<Host, Heap::kOwnerSrp>,
                  private NonCopyable
     {
         friend class Server;
         friend class LinkedListEntry<Host>;
-        friend class Heap::Allocatable<Host>;
+        friend class Heap::Allocatable<Host, Heap::kOwnerSrp>;
         friend class AdvertisingProxy;
 
     public:
@@ -820,6 +821,13 @@ public:
      */
     const otSrpServerResponseCounters *GetResponseCounters(void) const { return &mResponseCounters; }
 
+    /**
+     * Returns the lease counters of the SRP server.
+     *
+     * @returns  A pointer to the lease counters of the SRP server.
+     */
+    const otSrpServerLeaseCounters *GetLeaseCounters(void) const { return &mLeaseCounters; }
+
     /**
      * Receives the service update result from service handler set by
      * SetServiceHandler.
@@ -841,6 +849,8 @@ private:
     static constexpr uint32_t kDefaultMinTtl               = kDefaultMinLease;
     static constexpr uint32_t kDefaultMaxTtl               = kDefaultMaxLease;
     static constexpr uint32_t kDefaultEventsHandlerTimeout = OPENTHREAD_CONFIG_SRP_SERVER_SERVICE_UPDATE_TIMEOUT;
+    static constexpr uint32_t kLeaseExpiryGranularity      = OPENTHREAD_CONFIG_SRP_SERVER_LEASE_EXPIRY_GRANULARITY;
+    static constexpr uint32_t kSigVerifyCacheEntryLifetime = 10 * 1000; // 10 seconds (in msec).
 
     static constexpr AddressMode kDefaultAddressMode =
         static_cast<AddressMode>(OPENTHREAD_CONFIG_SRP_SERVER_DEFAULT_ADDRESS_MODE);
@@ -868,10 +878,10 @@ private:
     // and sending DNS response to the client.
     class UpdateMetadata : public InstanceLocator,
                            public LinkedListEntry<UpdateMetadata>,
-                           public Heap::Allocatable<UpdateMetadata>
+                           public Heap::Allocatable<UpdateMetadata, Heap::kOwnerSrp>
     {
         friend class LinkedListEntry<UpdateMetadata>;
-        friend class Heap::Allocatable<UpdateMetadata>;
+        friend class Heap::Allocatable<UpdateMetadata, Heap::kOwnerSrp>;
 
     public:
         TimeMilli                GetExpireTime(void) const { return mExpireTime; }
@@ -901,6 +911,29 @@ private:
         bool              mIsDirectRxFromClient;
     };
 
+    // Tracks an SRP update whose SIG(0) signature is being verified
+    // asynchronously by the platform. The entry owns the parsed host
+    // until the verification completes.
+    class PendingSigVerify : public InstanceLocator,
+                             public LinkedListEntry<PendingSigVerify>,
+                             public Heap::Allocatable<PendingSigVerify, Heap::kOwnerSrp>
+    {
+        friend class LinkedListEntry<PendingSigVerify>;
+        friend class Heap::Allocatable<PendingSigVerify, Heap::kOwnerSrp>;
+        friend class Server;
+
+    private:
+        PendingSigVerify(Instance &aInstance, Host &aHost, const MessageMetadata &aMessageMetadata);
+
+        PendingSigVerify *mNext;
+        Host             &mHost;
+        MessageMetadata   mMetadata; // Its `mMessageInfo` points to `mMessageInfo` below when direct rx.
+        Ip6::MessageInfo  mMessageInfo;
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIG_VERIFY_CACHE_SIZE > 0
+        Crypto::Sha256::Hash mDigest; // Digest to add to the verify cache on success.
+#endif
+    };
+
     void              Enable(void);
     void              Disable(void);
     void              Start(void);
@@ -918,6 +951,8 @@ private:
 
 #if OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
     void DisableFastStartMode(void);
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadNetdataChanged;
+
     void HandleNotifierEvents(Events aEvents);
     bool NetDataContainsOtherSrpServers(void) const;
 #endif
@@ -943,14 +978,17 @@ private:
                          const Ip6::MessageInfo *aMessageInfo);
     void  ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata);
     Error ProcessUpdateSection(Host &aHost, const Message &aMessage, MessageMetadata &aMetadata) const;
-    Error ProcessAdditionalSection(Host *aHost, const Message &aMessage, MessageMetadata &aMetadata) const;
-    Error VerifySignature(const Host::Key  &aKey,
-                          const Message    &aMessage,
-                          Dns::UpdateHeader aDnsHeader,
-                          uint16_t          aSigOffset,
-                          uint16_t          aSigRdataOffset,
-                          uint16_t          aSigRdataLength,
-                          const char       *aSignerName) const;
+    Error ProcessAdditionalSection(Host *aHost, const Message &aMessage, MessageMetadata &aMetadata);
+    Error VerifySignature(Host                  &aHost,
+                          const Message         &aMessage,
+                          const MessageMetadata &aMetadata,
+                          uint16_t               aSigOffset,
+                          uint16_t               aSigRdataOffset,
+                          uint16_t               aSigRdataLength,
+                          const char            *aSignerName);
+
+    static void HandleEcdsaVerifyResult(otError aError, void *aContext);
+    void        HandleEcdsaVerifyResult(Error aError, PendingSigVerify &aPendingVerify);
     Error ProcessZoneSection(const Message &aMessage, MessageMetadata &aMetadata) const;
     Error ProcessHostDescriptionInstruction(Host                  &aHost,
                                             const Message         &aMessage,
@@ -983,8 +1021,17 @@ private:
     static const char    *AddressModeToString(AddressMode aMode);
 
     void UpdateResponseCounters(Dns::Header::Response aResponseCode);
+    void ScheduleLeaseTimerAt(TimeMilli aFireTime);
     void UpdateAddrResolverCacheTable(const Ip6::MessageInfo &aMessageInfo, const Host &aHost);
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIG_VERIFY_CACHE_SIZE > 0
+    struct SigVerifyCacheEntry
+    {
+        Crypto::Sha256::Hash mDigest;     // Digest of (signed data hash, host key, signature).
+        TimeMilli            mVerifyTime; // Time when the signature was verified.
+    };
+#endif
+
     using LeaseTimer           = TimerMilliIn<Server, &Server::HandleLeaseTimer>;
     using UpdateTimer          = TimerMilliIn<Server, &Server::HandleOutstandingUpdatesTimer>;
     using CompletedUpdatesTask = TaskletIn<Server, &Server::ProcessCompletedUpdates>;
@@ -1007,6 +1054,8 @@ private:
     LinkedList<UpdateMetadata> mCompletedUpdates;
     CompletedUpdatesTask       mCompletedUpdateTask;
 
+    LinkedList<PendingSigVerify> mPendingSigVerifies;
+
     ServiceUpdateId mServiceUpdateId;
     uint16_t        mPort;
     State           mState;
@@ -1023,6 +1072,12 @@ private:
 #endif
 
     otSrpServerResponseCounters mResponseCounters;
+    otSrpServerLeaseCounters    mLeaseCounters;
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIG_VERIFY_CACHE_SIZE > 0
+    SigVerifyCacheEntry mSigVerifyCache[OPENTHREAD_CONFIG_SRP_SERVER_SIG_VERIFY_CACHE_SIZE];
+    uint8_t             mSigVerifyCacheIndex;
+#endif
 };
 
 } // namespace Srp
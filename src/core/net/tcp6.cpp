@@ -60,6 +60,9 @@ Tcp::Tcp(Instance &aInstance)
     , mTimer(aInstance)
     , mTasklet(aInstance)
     , mEphemeralPort(kDynamicPortMin)
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+    , mProcessingMessagePtr(nullptr)
+#endif
 {
     OT_UNUSED_VARIABLE(mEphemeralPort);
 }
@@ -105,6 +108,10 @@ Error Tcp::Endpoint::Initialize(Instance &aInstance, const otTcpEndpointInitiali
 
     tp.instance = &aInstance;
 
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+    tp.recvzerocopy = aArgs.mReceiveZeroCopy ? 1 : 0;
+#endif
+
 exit:
     return error;
 }
@@ -243,21 +250,29 @@ exit:
 
 Error Tcp::Endpoint::ReceiveByReference(const otLinkedBuffer *&aBuffer)
 {
-    struct tcpcb &tp = GetTcb();
+    Error         error = kErrorNone;
+    struct tcpcb &tp    = GetTcb();
+
+    VerifyOrExit(tp.recvzerocopy == 0, error = kErrorInvalidState);
 
     cbuf_reference(&tp.recvbuf, &mReceiveLinks[0], &mReceiveLinks[1]);
     aBuffer = &mReceiveLinks[0];
 
-    return kErrorNone;
+exit:
+    return error;
 }
 
 Error Tcp::Endpoint::ReceiveContiguify(void)
 {
-    struct tcpcb &tp = GetTcb();
+    Error         error = kErrorNone;
+    struct tcpcb &tp    = GetTcb();
+
+    VerifyOrExit(tp.recvzerocopy == 0, error = kErrorInvalidState);
 
     cbuf_contiguify(&tp.recvbuf, tp.reassbmp);
 
-    return kErrorNone;
+exit:
+    return error;
 }
 
 Error Tcp::Endpoint::CommitReceive(size_t aNumBytes, uint32_t aFlags)
@@ -271,12 +286,75 @@ Error Tcp::Endpoint::CommitReceive(size_t aNumBytes, uint32_t aFlags)
     VerifyOrExit(aNumBytes > 0, error = kErrorNone);
 
     cbuf_pop(&tp.recvbuf, aNumBytes);
+
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+    if (tp.recvzerocopy != 0)
+    {
+        // Free the retained messages (or portions thereof) consumed by the
+        // application, mirroring the pop from the receive buffer above.
+
+        MessageQueue &queue     = AsCoreType(&tp.recvmsgq);
+        size_t        remaining = aNumBytes;
+
+        while (remaining > 0)
+        {
+            Message *message = queue.GetHead();
+            size_t   available;
+
+            OT_ASSERT(message != nullptr);
+            available = message->GetLength() - message->GetOffset() - tp.recvmsgoff;
+
+            if (available <= remaining)
+            {
+                remaining -= available;
+                tp.recvmsgoff = 0;
+                queue.DequeueAndFree(*message);
+            }
+            else
+            {
+                tp.recvmsgoff += static_cast<uint32_t>(remaining);
+                remaining = 0;
+            }
+        }
+    }
+#endif
+
     error = BsdErrorToOtError(tcp_usr_rcvd(&tp));
 
 exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+Error Tcp::Endpoint::ReceiveChunksByReference(otLinkedBuffer *aLinks, size_t aNumLinks, size_t &aNumUsed)
+{
+    Error         error      = kErrorNone;
+    struct tcpcb &tp         = GetTcb();
+    uint32_t      headOffset = tp.recvmsgoff;
+
+    aNumUsed = 0;
+
+    VerifyOrExit(tp.recvzerocopy != 0, error = kErrorInvalidState);
+
+    for (const Message &message : AsCoreType(&tp.recvmsgq))
+    {
+        uint16_t offset = static_cast<uint16_t>(message.GetOffset() + headOffset);
+
+        headOffset = 0;
+        aNumUsed += Get<Tcp>().AppendMessageChunks(message, offset, &aLinks[aNumUsed], aNumLinks - aNumUsed);
+        VerifyOrExit(aNumUsed < aNumLinks);
+    }
+
+exit:
+    for (size_t i = 1; i < aNumUsed; i++)
+    {
+        aLinks[i - 1].mNext = &aLinks[i];
+    }
+
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+
 Error Tcp::Endpoint::SendEndOfStream(void)
 {
     struct tcpcb &tp = GetTcb();
@@ -300,12 +378,31 @@ Error Tcp::Endpoint::Deinitialize(void)
     SuccessOrExit(error = Get<Tcp>().mEndpoints.Remove(*this));
     SetNext(nullptr);
 
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+    AsCoreType(&GetTcb().recvmsgq).DequeueAndFreeAll();
+    GetTcb().recvmsgoff = 0;
+#endif
+
     SuccessOrExit(error = Abort());
 
 exit:
     return error;
 }
 
+Error Tcp::Endpoint::GetInfo(otTcpEndpointInfo &aInfo) const
+{
+    const struct tcpcb &tp = GetTcb();
+
+    aInfo.mCongestionWindow   = static_cast<uint32_t>(tp.snd_cwnd);
+    aInfo.mSlowStartThreshold = static_cast<uint32_t>(tp.snd_ssthresh);
+    aInfo.mSmoothedRtt        = static_cast<uint32_t>(tp.t_srtt) >> TCP_RTT_SHIFT;
+    aInfo.mRttVariance        = static_cast<uint32_t>(tp.t_rttvar) >> TCP_RTTVAR_SHIFT;
+    aInfo.mRetransmitCount    = tp.t_rexmtcnt;
+    aInfo.mZeroWindowEvents   = tp.t_zerowincnt;
+
+    return kErrorNone;
+}
+
 bool Tcp::Endpoint::IsClosed(void) const { return GetTcb().t_state == TCP6S_CLOSED; }
 
 uint8_t Tcp::Endpoint::TimerFlagToIndex(uint8_t aTimerFlag)
@@ -617,9 +714,10 @@ exit:
     return matches;
 }
 
-Error Tcp::HandleMessage(ot::Ip6::Header &aIp6Header, Message &aMessage, MessageInfo &aMessageInfo)
+Error Tcp::HandleMessage(ot::Ip6::Header &aIp6Header, OwnedPtr<Message> &aMessagePtr, MessageInfo &aMessageInfo)
 {
-    Error error = kErrorNotImplemented;
+    Error    error   = kErrorNotImplemented;
+    Message &message = *aMessagePtr;
 
     /*
      * The type uint32_t was chosen for alignment purposes. The size is the
@@ -639,17 +737,17 @@ Error Tcp::HandleMessage(ot::Ip6::Header &aIp6Header, Message &aMessage, Message
     struct tcplp_signals sig;
     int                  nextAction;
 
-    VerifyOrExit(length == aMessage.DetermineLengthAfterOffset(), error = kErrorParse);
+    VerifyOrExit(length == message.DetermineLengthAfterOffset(), error = kErrorParse);
     VerifyOrExit(length >= sizeof(Tcp::Header), error = kErrorParse);
-    SuccessOrExit(error = aMessage.Read(aMessage.GetOffset() + offsetof(struct tcphdr, th_off_x2), headerSize));
+    SuccessOrExit(error = message.Read(message.GetOffset() + offsetof(struct tcphdr, th_off_x2), headerSize));
     headerSize = static_cast<uint8_t>((headerSize >> TH_OFF_SHIFT) << 2);
     VerifyOrExit(headerSize >= sizeof(struct tcphdr) && headerSize <= sizeof(header) &&
                      static_cast<uint16_t>(headerSize) <= length,
                  error = kErrorParse);
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-    SuccessOrExit(error = Checksum::VerifyMessageChecksum(aMessage, aMessageInfo, kProtoTcp));
+    SuccessOrExit(error = Checksum::VerifyMessageChecksum(message, aMessageInfo, kProtoTcp));
 #endif
-    SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), &header[0], headerSize));
+    SuccessOrExit(error = message.Read(message.GetOffset(), &header[0], headerSize));
 
     ip6Header = reinterpret_cast<struct ip6_hdr *>(&aIp6Header);
     tcpHeader = reinterpret_cast<struct tcphdr *>(&header[0]);
@@ -668,7 +766,13 @@ Error Tcp::HandleMessage(ot::Ip6::Header &aIp6Header, Message &aMessage, Message
         size_t          priorBacklog = endpoint->GetSendBufferBytes() - endpoint->GetInFlightBytes();
 
         ClearAllBytes(sig);
-        nextAction = tcplp_input(ip6Header, tcpHeader, &aMessage, tp, nullptr, &sig);
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+        mProcessingMessagePtr = &aMessagePtr;
+#endif
+        nextAction = tcplp_input(ip6Header, tcpHeader, &message, tp, nullptr, &sig);
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+        mProcessingMessagePtr = nullptr;
+#endif
         if (nextAction != RELOOKUP_REQUIRED)
         {
             ProcessSignals(*endpoint, priorHead, priorBacklog, sig);
@@ -684,7 +788,7 @@ Error Tcp::HandleMessage(ot::Ip6::Header &aIp6Header, Message &aMessage, Message
         struct tcpcb_listen *tpl = &listener->GetTcbListen();
 
         ClearAllBytes(sig);
-        nextAction = tcplp_input(ip6Header, tcpHeader, &aMessage, nullptr, tpl, &sig);
+        nextAction = tcplp_input(ip6Header, tcpHeader, &message, nullptr, tpl, &sig);
         OT_ASSERT(nextAction != RELOOKUP_REQUIRED);
         if (sig.accepted_connection != nullptr)
         {
@@ -760,6 +864,48 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+bool Tcp::CaptureSegment(Endpoint &aEndpoint, Message &aMessage, uint16_t aOffset, uint16_t aLength)
+{
+    bool          captured = false;
+    struct tcpcb &tp       = aEndpoint.GetTcb();
+
+    // Take over ownership of the message being processed, trimming it so
+    // that its offset and length delimit the in-order payload accepted by
+    // the TCP logic.
+
+    VerifyOrExit((mProcessingMessagePtr != nullptr) && (mProcessingMessagePtr->Get() == &aMessage));
+
+    IgnoreError(aMessage.SetLength(static_cast<uint16_t>(aOffset + aLength)));
+    aMessage.SetOffset(aOffset);
+    AsCoreType(&tp.recvmsgq).Enqueue(*mProcessingMessagePtr->Release());
+    captured = true;
+
+exit:
+    return captured;
+}
+
+size_t Tcp::AppendMessageChunks(const Message &aMessage, uint16_t aOffset, otLinkedBuffer *aLinks, size_t aMaxLinks)
+{
+    size_t         numUsed = 0;
+    uint16_t       length  = aMessage.GetLength() - aOffset;
+    Message::Chunk chunk;
+
+    aMessage.GetFirstChunk(aOffset, length, chunk);
+
+    while ((chunk.GetLength() > 0) && (numUsed < aMaxLinks))
+    {
+        aLinks[numUsed].mNext   = nullptr;
+        aLinks[numUsed].mData   = chunk.GetBytes();
+        aLinks[numUsed].mLength = chunk.GetLength();
+        numUsed++;
+        aMessage.GetNextChunk(length, chunk);
+    }
+
+    return numUsed;
+}
+#endif // OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+
 Error Tcp::BsdErrorToOtError(int aBsdError)
 {
     Error error = kErrorFailed;
@@ -980,6 +1126,30 @@ void tcplp_sys_send_message(otInstance *aInstance, otMessage *aMessage, otMessag
     IgnoreError(instance.Get<ot::Ip6::Ip6>().SendDatagram(message, info, kProtoTcp));
 }
 
+bool tcplp_sys_capture_segment(struct tcpcb *aTcb, otMessage *aMessage, size_t aOffset, size_t aLength)
+{
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+    Tcp::Endpoint &endpoint = Tcp::Endpoint::FromTcb(*aTcb);
+
+    return endpoint.Get<Tcp>().CaptureSegment(endpoint, AsCoreType(aMessage), static_cast<uint16_t>(aOffset),
+                                              static_cast<uint16_t>(aLength));
+#else
+    OT_UNUSED_VARIABLE(aTcb);
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aOffset);
+    OT_UNUSED_VARIABLE(aLength);
+
+    return false;
+#endif
+}
+
+uint32_t tcplp_sys_get_max_burst(struct tcpcb *aTcb)
+{
+    OT_UNUSED_VARIABLE(aTcb);
+
+    return OPENTHREAD_CONFIG_TCP_MAX_SEGMENTS_PER_BURST;
+}
+
 uint32_t tcplp_sys_get_ticks(void) { return TimerMilli::GetNow().GetValue(); }
 
 uint32_t tcplp_sys_get_millis(void) { return TimerMilli::GetNow().GetValue(); }
@@ -43,6 +43,7 @@
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/owned_ptr.hpp"
 #include "common/timer.hpp"
 #include "net/ip6_headers.hpp"
 #include "net/socket.hpp"
@@ -66,6 +67,8 @@ void tcplp_sys_set_timer(struct tcpcb *aTcb, uint8_t aTimerFlag, uint32_t aDelay
 
 // NOLINTNEXTLINE(readability-inconsistent-declaration-parameter-name)
 void tcplp_sys_stop_timer(struct tcpcb *aTcb, uint8_t aTimerFlag);
+
+bool tcplp_sys_capture_segment(struct tcpcb *aTcb, otMessage *aMessage, size_t aOffset, size_t aLength);
 }
 
 namespace ot {
@@ -246,8 +249,9 @@ public:
          * @param[out]  aBuffer    A pointer to the linked buffer chain referencing data currently in the receive
          * buffer.
          *
-         * @retval kErrorNone    Successfully completed the operation.
-         * @retval kErrorFailed  Failed to complete the operation.
+         * @retval kErrorNone          Successfully completed the operation.
+         * @retval kErrorFailed        Failed to complete the operation.
+         * @retval kErrorInvalidState  The endpoint uses the zero-copy receive mode.
          */
         Error ReceiveByReference(const otLinkedBuffer *&aBuffer);
 
@@ -262,8 +266,9 @@ public:
          *
          * @sa otTcpReceiveContiguify
          *
-         * @retval kErrorNone    Successfully completed the operation.
-         * @retval kErrorFailed  Failed to complete the operation.
+         * @retval kErrorNone          Successfully completed the operation.
+         * @retval kErrorFailed        Failed to complete the operation.
+         * @retval kErrorInvalidState  The endpoint uses the zero-copy receive mode.
          */
         Error ReceiveContiguify(void);
 
@@ -282,6 +287,29 @@ public:
          */
         Error CommitReceive(size_t aNumBytes, uint32_t aFlags);
 
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+        /**
+         * Provides the application with linked buffers referencing received data
+         * in place, for an endpoint using the zero-copy receive mode.
+         *
+         * Fills at most @p aNumLinks entries of @p aLinks, chained together via
+         * their mNext fields, each referencing one contiguous chunk of received
+         * data in the retained message buffers. The references are valid until
+         * the "receive ready" callback is next invoked, or until the next call
+         * to otTcpCommitReceive().
+         *
+         * @sa otTcpReceiveChunksByReference
+         *
+         * @param[in]   aLinks     A pointer to an array of linked buffers to fill.
+         * @param[in]   aNumLinks  The number of entries in the @p aLinks array.
+         * @param[out]  aNumUsed   The number of entries that were filled.
+         *
+         * @retval kErrorNone          Successfully completed the operation.
+         * @retval kErrorInvalidState  The endpoint does not use the zero-copy receive mode.
+         */
+        Error ReceiveChunksByReference(otLinkedBuffer *aLinks, size_t aNumLinks, size_t &aNumUsed);
+#endif
+
         /**
          * Informs the connection peer that this TCP endpoint will not send more data.
          *
@@ -337,6 +365,18 @@ public:
          */
         Error Deinitialize(void);
 
+        /**
+         * Obtains a snapshot of this TCP endpoint's transport-level state, for
+         * instrumentation and diagnostics.
+         *
+         * @sa otTcpGetInfo
+         *
+         * @param[out]  aInfo  A reference to the structure to populate.
+         *
+         * @retval kErrorNone  Successfully obtained the TCP endpoint info.
+         */
+        Error GetInfo(otTcpEndpointInfo &aInfo) const;
+
         /**
          * Converts a reference to a struct tcpcb to a reference to its
          * enclosing Endpoint.
@@ -519,14 +559,15 @@ public:
     /**
      * Processes a received TCP segment.
      *
-     * @param[in]  aIp6Header    A reference to a structure containing the segment's IPv6 header.
-     * @param[in]  aMessage      A reference to the message containing the TCP segment.
-     * @param[in]  aMessageInfo  A reference to the message info associated with @p aMessage.
+     * @param[in]      aIp6Header    A reference to a structure containing the segment's IPv6 header.
+     * @param[in,out]  aMessagePtr   A reference to an owned pointer to the message containing the TCP segment.
+     *                               Ownership of the message may be taken over in the zero-copy receive mode.
+     * @param[in]      aMessageInfo  A reference to the message info associated with the message.
      *
      * @retval kErrorNone  Successfully processed the TCP segment.
      * @retval kErrorDrop  Dropped the TCP segment due to an invalid checksum.
      */
-    Error HandleMessage(ot::Ip6::Header &aIp6Header, Message &aMessage, MessageInfo &aMessageInfo);
+    Error HandleMessage(ot::Ip6::Header &aIp6Header, OwnedPtr<Message> &aMessagePtr, MessageInfo &aMessageInfo);
 
     /**
      * Automatically selects a local address and/or port for communication with the specified peer.
@@ -553,6 +594,10 @@ public:
     bool IsInitialized(const Listener &aListener) const { return mListeners.Contains(aListener); }
 
 private:
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+    friend bool ::tcplp_sys_capture_segment(struct tcpcb *aTcb, otMessage *aMessage, size_t aOffset, size_t aLength);
+#endif
+
     static constexpr uint16_t kDynamicPortMin = 49152;
     static constexpr uint16_t kDynamicPortMax = 65535;
 
@@ -570,6 +615,11 @@ private:
     static Error BsdErrorToOtError(int aBsdError);
     bool         CanBind(const SockAddr &aSockName);
 
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+    bool   CaptureSegment(Endpoint &aEndpoint, Message &aMessage, uint16_t aOffset, uint16_t aLength);
+    size_t AppendMessageChunks(const Message &aMessage, uint16_t aOffset, otLinkedBuffer *aLinks, size_t aMaxLinks);
+#endif
+
     void HandleTimer(void);
 
     void ProcessCallbacks(void);
@@ -583,6 +633,9 @@ private:
     LinkedList<Endpoint> mEndpoints;
     LinkedList<Listener> mListeners;
     uint16_t             mEphemeralPort;
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_ZERO_COPY_ENABLE
+    OwnedPtr<Message>   *mProcessingMessagePtr;
+#endif
 };
 
 } // namespace Ip6
@@ -199,6 +199,9 @@ Error Udp::Plat::LeaveMulticastGroup(SocketHandle &aSocket, NetifIdentifier aNet
 Udp::Udp(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEphemeralPort(kDynamicPortMin)
+#if OPENTHREAD_CONFIG_UDP_SOCKET_LOOKUP_CACHE_ENABLE
+    , mLastMatchedSocket(nullptr)
+#endif
 {
 }
 
@@ -378,6 +381,13 @@ void Udp::RemoveSocket(SocketHandle &aSocket)
     mSockets.PopAfter(prev);
     aSocket.SetNext(nullptr);
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_LOOKUP_CACHE_ENABLE
+    if (mLastMatchedSocket == &aSocket)
+    {
+        mLastMatchedSocket = nullptr;
+    }
+#endif
+
 exit:
     return;
 }
@@ -459,8 +469,42 @@ void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
 {
     SocketHandle *socket;
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_LOOKUP_CACHE_ENABLE
+    // Steady-state flows keep resolving to the same socket, so the last matched socket is verified first and
+    // the socket list is walked only on a miss. The cached entry is re-validated against the message info, so
+    // a rebind or reconnect of the cached socket cannot misdeliver.
+    if ((mLastMatchedSocket != nullptr) && mLastMatchedSocket->Matches(aMessageInfo))
+    {
+        socket = mLastMatchedSocket;
+    }
+    else
+    {
+        socket = mSockets.FindMatching(aMessageInfo);
+
+        if (socket != nullptr)
+        {
+            mLastMatchedSocket = socket;
+        }
+    }
+#else
     socket = mSockets.FindMatching(aMessageInfo);
-    VerifyOrExit(socket != nullptr);
+#endif
+
+    if (socket == nullptr)
+    {
+        // Track the drop against the socket bound to the port (if any), e.g., a connected socket receiving
+        // from a peer other than the one it is connected to.
+        socket = mSockets.FindMatching(aMessageInfo.GetSockPort());
+
+        if (socket != nullptr)
+        {
+            socket->mRxDropCount++;
+        }
+
+        ExitNow();
+    }
+
+    socket->mRxCount++;
 
     aMessage.RemoveHeader(aMessage.GetOffset());
     OT_ASSERT(aMessage.GetOffset() == 0);
@@ -153,6 +153,21 @@ public:
          */
         bool ShouldUsePlatformUdp(void) const { return GetNetifId() != kNetifThreadInternal; }
 
+        /**
+         * Returns the number of received datagrams delivered to this socket.
+         *
+         * @returns The number of received datagrams delivered to this socket.
+         */
+        uint32_t GetRxCount(void) const { return mRxCount; }
+
+        /**
+         * Returns the number of datagrams matching this socket's port but not delivered to it (e.g., received
+         * from a peer other than the one the socket is connected to).
+         *
+         * @returns The number of datagrams matching this socket's port but not delivered to it.
+         */
+        uint32_t GetRxDropCount(void) const { return mRxDropCount; }
+
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
         /**
          * Indicate whether or not the socket is bound to the backbone network interface.
@@ -557,6 +572,9 @@ private:
     uint16_t                 mEphemeralPort;
     LinkedList<Receiver>     mReceivers;
     LinkedList<SocketHandle> mSockets;
+#if OPENTHREAD_CONFIG_UDP_SOCKET_LOOKUP_CACHE_ENABLE
+    SocketHandle *mLastMatchedSocket;
+#endif
 #if OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE
     Callback<otUdpForwarder> mUdpForwarder;
 #endif
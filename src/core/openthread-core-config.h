@@ -75,6 +75,7 @@
 #include "config/child_supervision.h"
 #include "config/coap.h"
 #include "config/commissioner.h"
+#include "config/counter_registry.h"
 #include "config/crypto.h"
 #include "config/dataset_updater.h"
 #include "config/dhcp6_client.h"
@@ -84,6 +85,7 @@
 #include "config/dns_dso.h"
 #include "config/dnssd_server.h"
 #include "config/history_tracker.h"
+#include "config/instrumentation.h"
 #include "config/ip6.h"
 #include "config/joiner.h"
 #include "config/link_metrics_manager.h"
@@ -109,6 +111,7 @@
 #include "config/sntp_client.h"
 #include "config/srp_client.h"
 #include "config/srp_server.h"
+#include "config/telemetry_emitter.h"
 #include "config/time_sync.h"
 #include "config/tmf.h"
 #include "config/trel.h"
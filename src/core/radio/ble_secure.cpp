@@ -323,20 +323,22 @@ Error BleSecure::Flush(void)
     Error        error   = kErrorNone;
     ot::Message *message = nullptr;
     uint16_t     length;
+    uint16_t     maxDataSize;
 
     VerifyOrExit(mSendMessage != nullptr);
     VerifyOrExit(IsConnected(), error = kErrorInvalidState);
-    length = mSendMessage->GetLength();
+    length      = mSendMessage->GetLength();
+    maxDataSize = GetMaxTlsDataSize();
 
     // Split send buffer in chunks which can later be processed by mTls.Send(..)
-    while (length > kTlsDataMaxSize)
+    while (length > maxDataSize)
     {
         VerifyOrExit((message = Get<MessagePool>().Allocate(Message::kTypeBle, 0)) != nullptr, error = kErrorNoBufs);
-        SuccessOrExit(error = message->AppendBytesFromMessage(*mSendMessage, 0, kTlsDataMaxSize));
+        SuccessOrExit(error = message->AppendBytesFromMessage(*mSendMessage, 0, maxDataSize));
 
         // We accept an expensive copy operation in favor of optimal buffer usage for long messages
-        mSendMessage->WriteBytesFromMessage(0, *mSendMessage, kTlsDataMaxSize, length - kTlsDataMaxSize);
-        length -= kTlsDataMaxSize;
+        mSendMessage->WriteBytesFromMessage(0, *mSendMessage, maxDataSize, length - maxDataSize);
+        length -= maxDataSize;
 
         // Should never fail since we are decreasing the length of the message
         IgnoreError(mSendMessage->SetLength(length));
@@ -362,6 +364,25 @@ exit:
     return error;
 }
 
+uint16_t BleSecure::GetMaxTlsDataSize(void) const
+{
+    // Sizes TLS records so that a full record (payload plus record
+    // overhead) occupies a whole number of GATT payload units
+    // (`mMtuSize - kGattOverhead` bytes each). Otherwise the last
+    // indication of every record carries a partially filled payload,
+    // wasting a share of each connection event.
+
+    uint16_t size     = kTlsDataMaxSize;
+    uint16_t unitSize = mMtuSize - kGattOverhead;
+    uint16_t numUnits = (size + kTlsRecordOverhead) / unitSize;
+
+    VerifyOrExit(numUnits * unitSize > kTlsRecordOverhead);
+    size = numUnits * unitSize - kTlsRecordOverhead;
+
+exit:
+    return size;
+}
+
 void BleSecure::HandleBleReceive(uint8_t *aBuf, uint16_t aLength)
 {
     ot::Message     *message = nullptr;
@@ -541,14 +562,16 @@ void BleSecure::HandleTlsReceive(uint8_t *aBuf, uint16_t aLength)
             {
                 Error errorTcatAgent = kErrorNone;
 
-                IgnoreError(Flush());
-
                 if (mSendMessage == nullptr)
                 {
                     mSendMessage = Get<MessagePool>().Allocate(Message::kTypeBle);
                     VerifyOrExit(mSendMessage != nullptr, error = kErrorNoBufs);
                 }
 
+                // The response is accumulated in `mSendMessage` together with the responses to any other
+                // command TLVs carried in this same receive, and sent out in a single batch by the
+                // `Flush()` after the loop. This way pipelined commands do not pay a per-command TLS
+                // record turnaround.
                 errorTcatAgent = Get<MeshCoP::TcatAgent>().HandleSingleTlv(*mReceivedMessage, *mSendMessage);
 
                 if (errorTcatAgent != kErrorNone)
@@ -557,6 +580,8 @@ void BleSecure::HandleTlsReceive(uint8_t *aBuf, uint16_t aLength)
                     if (errorTcatAgent == kErrorAbort)
                     {
                         LogInfo("Disconnecting TCAT client.");
+                        // best effort to send out responses batched for earlier command TLVs.
+                        IgnoreError(Flush());
                     }
                     else
                     {
@@ -568,7 +593,6 @@ void BleSecure::HandleTlsReceive(uint8_t *aBuf, uint16_t aLength)
                     // must be ready to receive a next TCAT commissioner.
                     ExitNow();
                 }
-                SuccessOrExit(error = Flush()); // send out the response generated by the TcatAgent
             }
             else
             {
@@ -581,6 +605,9 @@ void BleSecure::HandleTlsReceive(uint8_t *aBuf, uint16_t aLength)
             IgnoreError(mReceivedMessage->SetLength(0)); // also sets the offset to 0
             requiredBytes = sizeof(Tlv);                 // set for the next TLV
         } // while (aLength > 0)
+
+        // Send out the responses generated by the TcatAgent for all command TLVs handled above.
+        SuccessOrExit(error = Flush());
     }
 
 exit:
@@ -598,27 +625,27 @@ exit:
 void BleSecure::HandleTransmit(void)
 {
     Error        error   = kErrorNone;
-    ot::Message *message = mTransmitQueue.GetHead();
+    ot::Message *message = nullptr;
 
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_DEBG)
     uint16_t len;
     uint8_t  buf[kTlsDataMaxSize];
 #endif
 
-    VerifyOrExit(message != nullptr);
-    mTransmitQueue.Dequeue(*message);
-
-    if (mTransmitQueue.GetHead() != nullptr)
+    // Drain the queue in one pass so that consecutive records are
+    // handed to the platform back to back, instead of paying a
+    // tasklet turnaround between records.
+    while ((message = mTransmitQueue.GetHead()) != nullptr)
     {
-        mTransmitTask.Post();
-    }
+        mTransmitQueue.Dequeue(*message);
 
-    SuccessOrExit(error = mTls.Send(*message));
+        SuccessOrExit(error = mTls.Send(*message));
 
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_DEBG)
-    len = message->ReadBytes(message->GetOffset(), buf, sizeof(buf));
-    DumpDebg("Tx", buf, len);
+        len = message->ReadBytes(message->GetOffset(), buf, sizeof(buf));
+        DumpDebg("Tx", buf, len);
 #endif
+    }
 
 exit:
     FreeMessageOnError(message, error);
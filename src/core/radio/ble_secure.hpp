@@ -351,8 +351,15 @@ private:
     static constexpr uint8_t  kMaxMtuSize       = OT_BLE_ATT_MTU_MAX;
     static constexpr uint8_t  kGattOverhead     = 3; // BLE GATT payload fits (MTU size - 3 bytes)
     static constexpr uint8_t  kPacketBufferSize = OT_BLE_ATT_MTU_MAX - kGattOverhead;
-    static constexpr uint16_t kTxBleHandle      = 0;   // Characteristics Handle for TX (not used)
-    static constexpr uint16_t kTlsDataMaxSize   = 800; // Maximum size of data chunks sent with mTls.Send(..)
+    static constexpr uint16_t kTxBleHandle      = 0; // Characteristics Handle for TX (not used)
+
+    // Maximum size of data chunks sent with mTls.Send(..)
+    static constexpr uint16_t kTlsDataMaxSize = OPENTHREAD_CONFIG_BLE_TCAT_TLS_DATA_MAX_SIZE;
+
+    // TLS application data record overhead for the TCAT cipher suite (TLS_ECJPAKE_WITH_AES_128_CCM_8):
+    // 5 byte record header + 8 byte explicit nonce + 8 byte tag. Used only to align record sizes to
+    // the GATT payload size, so a deviation for another cipher suite is harmless.
+    static constexpr uint16_t kTlsRecordOverhead = 5 + 8 + 8;
 
     static void HandleTlsConnectEvent(MeshCoP::Tls::ConnectEvent aEvent, void *aContext);
     void        HandleTlsConnectEvent(MeshCoP::Tls::ConnectEvent aEvent);
@@ -367,6 +374,8 @@ private:
 
     Error SetRequestedBleAdvertisementsState(void);
 
+    uint16_t GetMaxTlsDataSize(void) const;
+
     using TxTask = TaskletIn<BleSecure, &BleSecure::HandleTransmit>;
 
     MeshCoP::Tls              mTls;
@@ -133,6 +133,7 @@ inline uint64_t UintSafeMinus(uint64_t aLhs, uint64_t aRhs) { return aLhs > aRhs
 
 Radio::Statistics::Statistics(void)
     : mStatus(kDisabled)
+    , mPlatSamplingActive(false)
 {
     ResetTime();
 }
@@ -146,7 +147,7 @@ void Radio::Statistics::RecordStateChange(Status aStatus)
 void Radio::Statistics::HandleReceiveAt(uint32_t aDurationUs)
 {
     // The actual rx time of ReceiveAt cannot be obtained from software level. This is a workaround.
-    if (mStatus == kSleep)
+    if (mStatus == kSleep && !mPlatSamplingActive)
     {
         mTimeStats.mRxTime += aDurationUs;
     }
@@ -154,7 +155,7 @@ void Radio::Statistics::HandleReceiveAt(uint32_t aDurationUs)
 
 void Radio::Statistics::RecordTxDone(otError aError, uint16_t aPsduLength)
 {
-    if (aError == kErrorNone || aError == kErrorNoAck)
+    if (!mPlatSamplingActive && (aError == kErrorNone || aError == kErrorNoAck))
     {
         uint32_t txTimeUs = (aPsduLength + Mac::Frame::kPhyHeaderSize) * Radio::kSymbolsPerOctet * Radio::kSymbolTime;
         uint32_t rxAckTimeUs = (Mac::Frame::kImmAckLength + Mac::Frame::kPhyHeaderSize) * Radio::kPhyUsPerByte;
@@ -182,6 +183,7 @@ void Radio::Statistics::RecordRxDone(otError aError)
 {
     uint32_t ackTimeUs;
 
+    VerifyOrExit(!mPlatSamplingActive);
     VerifyOrExit(aError == kErrorNone);
 
     UpdateTime();
@@ -215,21 +217,42 @@ void Radio::Statistics::UpdateTime(void)
     TimeMicro nowTime     = TimerMicro::GetNow();
     uint32_t  timeElapsed = nowTime - mLastUpdateTime;
 
-    switch (mStatus)
+    if (!mPlatSamplingActive)
     {
-    case kSleep:
-        mTimeStats.mSleepTime += timeElapsed;
-        break;
-    case kReceive:
-        mTimeStats.mRxTime += timeElapsed;
-        break;
-    case kDisabled:
-        mTimeStats.mDisabledTime += timeElapsed;
-        break;
+        switch (mStatus)
+        {
+        case kSleep:
+            mTimeStats.mSleepTime += timeElapsed;
+            break;
+        case kReceive:
+            mTimeStats.mRxTime += timeElapsed;
+            break;
+        case kDisabled:
+            mTimeStats.mDisabledTime += timeElapsed;
+            break;
+        }
     }
+
     mLastUpdateTime = nowTime;
 }
 
+void Radio::Statistics::RecordPlatSample(const TimeStats &aDurations)
+{
+    if (!mPlatSamplingActive)
+    {
+        // Close out the host-side model up to the switch-over point. From
+        // here on, radio time is accounted exclusively from the
+        // platform-reported samples.
+        UpdateTime();
+        mPlatSamplingActive = true;
+    }
+
+    mTimeStats.mTxTime += aDurations.mTxTime;
+    mTimeStats.mRxTime += aDurations.mRxTime;
+    mTimeStats.mSleepTime += aDurations.mSleepTime;
+    mTimeStats.mDisabledTime += aDurations.mDisabledTime;
+}
+
 #endif // OPENTHREAD_CONFIG_RADIO_STATS_ENABLE && (OPENTHREAD_FTD || OPENTHREAD_MTD)
 
 } // namespace ot
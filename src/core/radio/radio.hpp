@@ -245,6 +245,10 @@ public:
      *   will be reduced accordingly.
      * - When `GetStats` is called, an operation will be executed to calculate
      *   the time for the last state. And the result will be returned.
+     *
+     * When the platform reports measured state durations (see
+     * `otPlatRadioTimeStatsSample()`), the simplified model is disabled and
+     * the reported samples are accumulated directly instead.
      */
     class Statistics : private NonCopyable
     {
@@ -266,6 +270,17 @@ public:
          */
         void ResetTime(void);
 
+        /**
+         * Records a platform-reported radio time statistics sample (from `otPlatRadioTimeStatsSample()`).
+         *
+         * Each sample carries the durations spent in each radio state since the previous sample, as measured by
+         * the radio hardware or co-processor. Once the first sample is recorded, the simplified host-side model
+         * is disabled and radio time is accounted exclusively from the reported samples.
+         *
+         * @param[in] aDurations  The durations spent in each radio state since the previous sample.
+         */
+        void RecordPlatSample(const TimeStats &aDurations);
+
     private:
         enum Status : uint8_t
         {
@@ -284,6 +299,7 @@ public:
         Status    mStatus;
         TimeStats mTimeStats;
         TimeMicro mLastUpdateTime;
+        bool      mPlatSamplingActive;
     };
 #endif // OPENTHREAD_CONFIG_RADIO_STATS_ENABLE && (OPENTHREAD_FTD || OPENTHREAD_MTD)
 
@@ -697,6 +713,49 @@ public:
      */
     void ClearSrcMatchExtEntries(void);
 
+    /**
+     * Sets the short addresses in the source address match table, replacing all existing short address entries.
+     *
+     * This is a batched alternative to `AddSrcMatchShortEntry()`, allowing the full table to be reconciled in a
+     * single platform call (e.g., one transaction towards an RCP).
+     *
+     * @param[in]  aShortAddresses  A pointer to an array of short addresses.
+     * @param[in]  aNumEntries      Number of entries in @p aShortAddresses.
+     *
+     * @retval kErrorNone     Successfully set the short address entries in the source match table.
+     * @retval kErrorNoBufs   Not enough entries available in the source match table.
+     */
+    Error SetSrcMatchShortEntries(const Mac::ShortAddress *aShortAddresses, uint16_t aNumEntries);
+
+    /**
+     * Sets the extended addresses in the source address match table, replacing all existing extended address entries.
+     *
+     * This is a batched alternative to `AddSrcMatchExtEntry()`, allowing the full table to be reconciled in a
+     * single platform call (e.g., one transaction towards an RCP).
+     *
+     * @param[in]  aExtAddresses  A pointer to an array of extended addresses stored in big-endian byte order.
+     * @param[in]  aNumEntries    Number of entries in @p aExtAddresses.
+     *
+     * @retval kErrorNone     Successfully set the extended address entries in the source match table.
+     * @retval kErrorNoBufs   Not enough entries available in the source match table.
+     */
+    Error SetSrcMatchExtEntries(const Mac::ExtAddress *aExtAddresses, uint16_t aNumEntries);
+
+    /**
+     * Sets the source match pending filter, a compact bitmap the radio consults while source matching is disabled.
+     *
+     * The bit index for a given source address is the sum of the address bytes modulo the number of bits in the
+     * filter. The radio sets the "frame pending" bit on an ack only when the bit for the data poll's source address
+     * is set in the filter, instead of setting it on all acks while source matching is disabled.
+     *
+     * @param[in]  aFilter   A pointer to the filter bitmap.
+     * @param[in]  aLength   The filter length in bytes, or zero to remove the filter.
+     *
+     * @retval kErrorNone            Successfully set the source match pending filter.
+     * @retval kErrorNotImplemented  The radio does not support the source match pending filter.
+     */
+    Error SetSrcMatchPendingFilter(const uint8_t *aFilter, uint16_t aLength);
+
     /**
      * Gets the radio supported channel mask that the device is allowed to be on.
      *
@@ -1048,6 +1107,21 @@ inline void Radio::ClearSrcMatchShortEntries(void) { otPlatRadioClearSrcMatchSho
 
 inline void Radio::ClearSrcMatchExtEntries(void) { otPlatRadioClearSrcMatchExtEntries(GetInstancePtr()); }
 
+inline Error Radio::SetSrcMatchShortEntries(const Mac::ShortAddress *aShortAddresses, uint16_t aNumEntries)
+{
+    return otPlatRadioSetSrcMatchShortEntries(GetInstancePtr(), aShortAddresses, aNumEntries);
+}
+
+inline Error Radio::SetSrcMatchExtEntries(const Mac::ExtAddress *aExtAddresses, uint16_t aNumEntries)
+{
+    return otPlatRadioSetSrcMatchExtEntries(GetInstancePtr(), aExtAddresses, aNumEntries);
+}
+
+inline Error Radio::SetSrcMatchPendingFilter(const uint8_t *aFilter, uint16_t aLength)
+{
+    return otPlatRadioSetSrcMatchPendingFilter(GetInstancePtr(), aFilter, aLength);
+}
+
 inline uint32_t Radio::GetBusSpeed(void) { return otPlatRadioGetBusSpeed(GetInstancePtr()); }
 
 inline uint32_t Radio::GetBusLatency(void) { return otPlatRadioGetBusLatency(GetInstancePtr()); }
@@ -1153,6 +1227,12 @@ inline void Radio::ClearSrcMatchShortEntries(void) {}
 
 inline void Radio::ClearSrcMatchExtEntries(void) {}
 
+inline Error Radio::SetSrcMatchShortEntries(const Mac::ShortAddress *, uint16_t) { return kErrorNone; }
+
+inline Error Radio::SetSrcMatchExtEntries(const Mac::ExtAddress *, uint16_t) { return kErrorNone; }
+
+inline Error Radio::SetSrcMatchPendingFilter(const uint8_t *, uint16_t) { return kErrorNone; }
+
 inline uint32_t Radio::GetBusSpeed(void) { return 0; }
 
 inline uint32_t Radio::GetBusLatency(void) { return 0; }
@@ -200,6 +200,32 @@ extern "C" void otPlatRadioBusLatencyChanged(otInstance *) {}
 
 #endif // // #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
 
+#if OPENTHREAD_FTD || OPENTHREAD_MTD
+extern "C" void otPlatRadioTimeStatsSample(otInstance *aInstance, const otRadioTimeStats *aDurations)
+{
+#if OPENTHREAD_CONFIG_RADIO_STATS_ENABLE
+    Instance &instance = AsCoreType(aInstance);
+
+    VerifyOrExit(instance.IsInitialized());
+    instance.Get<Radio::Statistics>().RecordPlatSample(*aDurations);
+
+exit:
+    return;
+#else
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aDurations);
+#endif
+}
+#else
+extern "C" OT_TOOL_WEAK void otPlatRadioTimeStatsSample(otInstance *aInstance, const otRadioTimeStats *aDurations)
+{
+    // Default empty implementation for radio-only builds. `NcpBase` provides an implementation that forwards the
+    // samples to the host.
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aDurations);
+}
+#endif
+
 //---------------------------------------------------------------------------------------------------------------------
 // Default/weak implementation of radio platform APIs
 
@@ -209,6 +235,55 @@ extern "C" OT_TOOL_WEAK void otPlatRadioSetAlternateShortAddress(otInstance *aIn
     OT_UNUSED_VARIABLE(aShortAddress);
 }
 
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+
+extern "C" OT_TOOL_WEAK otError otPlatRadioSetSrcMatchShortEntries(otInstance           *aInstance,
+                                                                   const otShortAddress *aShortAddresses,
+                                                                   uint16_t              aNumEntries)
+{
+    otError error = OT_ERROR_NONE;
+
+    otPlatRadioClearSrcMatchShortEntries(aInstance);
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        SuccessOrExit(error = otPlatRadioAddSrcMatchShortEntry(aInstance, aShortAddresses[i]));
+    }
+
+exit:
+    return error;
+}
+
+extern "C" OT_TOOL_WEAK otError otPlatRadioSetSrcMatchExtEntries(otInstance         *aInstance,
+                                                                 const otExtAddress *aExtAddresses,
+                                                                 uint16_t            aNumEntries)
+{
+    otError error = OT_ERROR_NONE;
+
+    otPlatRadioClearSrcMatchExtEntries(aInstance);
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        SuccessOrExit(error = otPlatRadioAddSrcMatchExtEntry(aInstance, &aExtAddresses[i]));
+    }
+
+exit:
+    return error;
+}
+
+extern "C" OT_TOOL_WEAK otError otPlatRadioSetSrcMatchPendingFilter(otInstance    *aInstance,
+                                                                    const uint8_t *aFilter,
+                                                                    uint16_t       aLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aFilter);
+    OT_UNUSED_VARIABLE(aLength);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+#endif // OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+
 extern "C" OT_TOOL_WEAK uint32_t otPlatRadioGetSupportedChannelMask(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
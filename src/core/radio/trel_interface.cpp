@@ -126,11 +126,23 @@ Error Interface::Send(Packet &aPacket, bool aIsDiscovery)
     switch (aPacket.GetHeader().GetType())
     {
     case Header::kTypeBroadcast:
-        for (const Peer &peer : Get<PeerTable>())
+    {
+        // Fan-out to all matching peers is handed to the platform in
+        // batches of up to `kTxBatchSize` packets through a single
+        // `otPlatTrelSendBatch()` call. The payload bytes are shared
+        // among all packets in a batch, with only a per-peer copy of
+        // the header (which carries the per-neighbor packet number and
+        // ack mode).
+
+        uint16_t             headerLength = aPacket.GetHeader().GetLength();
+        uint16_t             numPackets   = 0;
+        Header               headers[kTxBatchSize];
+        otPlatTrelPacketInfo packets[kTxBatchSize];
+
+        for (Peer &peer : Get<PeerTable>())
         {
-            uint32_t        originalPacketNumber = aPacket.GetHeader().GetPacketNumber();
-            Header::AckMode originalAckMode      = aPacket.GetHeader().GetAckMode();
-            Neighbor       *neighbor;
+            Neighbor *neighbor;
+            Header   *header;
 
             if (!peer.HasValidSockAddr())
             {
@@ -142,21 +154,41 @@ Error Interface::Send(Packet &aPacket, bool aIsDiscovery)
                 continue;
             }
 
+            if (numPackets == kTxBatchSize)
+            {
+                otPlatTrelSendBatch(&GetInstance(), packets, numPackets);
+                numPackets = 0;
+            }
+
+            header = &headers[numPackets];
+            memcpy(header, &aPacket.GetHeader(), headerLength);
+
             neighbor = Get<NeighborTable>().FindNeighbor(peer.GetExtAddress(), Neighbor::kInStateAnyExceptInvalid);
 
             if (neighbor != nullptr)
             {
-                aPacket.GetHeader().SetAckMode(Header::kAckRequested);
-                aPacket.GetHeader().SetPacketNumber(neighbor->mTrelTxPacketNumber++);
+                header->SetAckMode(Header::kAckRequested);
+                header->SetPacketNumber(neighbor->mTrelTxPacketNumber++);
                 neighbor->mTrelCurrentPendingAcks++;
             }
 
-            otPlatTrelSend(&GetInstance(), aPacket.GetBuffer(), aPacket.GetLength(), &peer.mSockAddr);
+            packets[numPackets].mHeader        = reinterpret_cast<const uint8_t *>(header);
+            packets[numPackets].mHeaderLength  = headerLength;
+            packets[numPackets].mPayload       = aPacket.GetPayload();
+            packets[numPackets].mPayloadLength = aPacket.GetPayloadLength();
+            packets[numPackets].mDestSockAddr  = &peer.mSockAddr;
 
-            aPacket.GetHeader().SetPacketNumber(originalPacketNumber);
-            aPacket.GetHeader().SetAckMode(originalAckMode);
+            peer.CountTxPacket(aPacket.GetLength());
+            numPackets++;
         }
+
+        if (numPackets > 0)
+        {
+            otPlatTrelSendBatch(&GetInstance(), packets, numPackets);
+        }
+
         break;
+    }
 
     case Header::kTypeUnicast:
     case Header::kTypeAck:
@@ -165,6 +197,7 @@ Error Interface::Send(Packet &aPacket, bool aIsDiscovery)
         VerifyOrExit(peerEntry->HasValidSockAddr(), error = kErrorAbort);
         peerEntry->UpdateLastInteractionTime();
         otPlatTrelSend(&GetInstance(), aPacket.GetBuffer(), aPacket.GetLength(), &peerEntry->GetSockAddr());
+        peerEntry->CountTxPacket(aPacket.GetLength());
         break;
     }
 
@@ -172,6 +205,35 @@ exit:
     return error;
 }
 
+extern "C" OT_TOOL_WEAK void otPlatTrelSendBatch(otInstance                 *aInstance,
+                                                 const otPlatTrelPacketInfo *aPackets,
+                                                 uint16_t                    aNumPackets)
+{
+    // Default implementation of the optional batch send API. It
+    // merges the header and payload segments of each packet into one
+    // buffer and sends the packets one by one using `otPlatTrelSend()`.
+    // Platforms capable of batched send (e.g., mapping the batch to a
+    // single `sendmmsg()` syscall) can override this.
+
+    for (uint16_t index = 0; index < aNumPackets; index++)
+    {
+        const otPlatTrelPacketInfo &info = aPackets[index];
+        uint8_t                     buffer[sizeof(Header) + Link::kMtuSize];
+        uint16_t                    length = info.mHeaderLength + info.mPayloadLength;
+
+        OT_ASSERT(length <= sizeof(buffer));
+
+        memcpy(buffer, info.mHeader, info.mHeaderLength);
+
+        if (info.mPayloadLength != 0)
+        {
+            memcpy(buffer + info.mHeaderLength, info.mPayload, info.mPayloadLength);
+        }
+
+        otPlatTrelSend(aInstance, buffer, length, info.mDestSockAddr);
+    }
+}
+
 extern "C" void otPlatTrelHandleReceived(otInstance       *aInstance,
                                          uint8_t          *aBuffer,
                                          uint16_t          aLength,
@@ -150,6 +150,8 @@ public:
     uint16_t GetUdpPort(void) const { return mUdpPort; }
 
 private:
+    static constexpr uint16_t kTxBatchSize = 16; // Max number of packets passed per `otPlatTrelSendBatch()` call.
+
     enum State : uint8_t
     {
         kStateUninitialized,
@@ -350,6 +350,7 @@ void Link::ProcessReceivedPacket(Packet &aPacket, const Ip6::SockAddr &aSockAddr
     if (mRxPacketPeer != nullptr)
     {
         mRxPacketPeer->UpdateLastInteractionTime();
+        mRxPacketPeer->CountRxPacket(aPacket.GetLength());
     }
 
     if (type != Header::kTypeBroadcast)
@@ -185,6 +185,8 @@ private:
     void SendAck(Packet &aRxPacket);
     void ReportDeferredAckStatus(Neighbor &aNeighbor, Error aError);
     void HandleTimer(Neighbor &aNeighbor);
+    static constexpr Events::Flags kNotifierEvents = kEventThreadExtPanIdChanged;
+
     void HandleNotifierEvents(Events aEvents);
     void HandleTxTasklet(void);
     void HandleTimer(void);
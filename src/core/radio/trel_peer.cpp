@@ -51,6 +51,9 @@ void Peer::Init(Instance &aInstance)
     AsCoreType(&mExtAddress).Clear();
     AsCoreType(&mExtPanId).Clear();
     AsCoreType(&mSockAddr).Clear();
+    ClearAllBytes(mCounters);
+    mNextByExtAddr  = nullptr;
+    mNextBySockAddr = nullptr;
     UpdateLastInteractionTime();
 
 #if OPENTHREAD_CONFIG_TREL_MANAGE_DNSSD_ENABLE
@@ -68,12 +71,14 @@ void Peer::Init(Instance &aInstance)
 
 void Peer::Free(void)
 {
+    Get<PeerTable>().RemoveFromBuckets(*this);
+
     SignalPeerRemoval();
 
     Log(kDeleted);
 
 #if OPENTHREAD_CONFIG_TREL_USE_HEAP_ENABLE
-    Heap::Allocatable<Peer>::Free();
+    Heap::Allocatable<Peer, Heap::kOwnerTrel>::Free();
 #else
     this->~Peer();
     Get<PeerTable>().mPool.Free(*this);
@@ -153,12 +158,22 @@ exit:
 
 void Peer::SetExtAddress(const Mac::ExtAddress &aExtAddress)
 {
+    Get<PeerTable>().RemoveFromExtAddrBucket(*this);
     mExtAddress = aExtAddress;
+    Get<PeerTable>().AddToExtAddrBucket(*this);
+
 #if OPENTHREAD_CONFIG_TREL_MANAGE_DNSSD_ENABLE
     mExtAddressSet = true;
 #endif
 }
 
+void Peer::SetSockAddr(const Ip6::SockAddr &aSockAddr)
+{
+    Get<PeerTable>().RemoveFromSockAddrBucket(*this);
+    mSockAddr = aSockAddr;
+    Get<PeerTable>().AddToSockAddrBucket(*this);
+}
+
 bool Peer::Matches(const Mac::ExtAddress &aExtAddress) const
 {
     bool matches = false;
@@ -217,7 +232,13 @@ void Peer::SetPort(uint16_t aPort)
 
     if (mPort != 0)
     {
-        AsCoreType(&mSockAddr).SetPort(mPort);
+        // Update through `SetSockAddr()` so that the peer is re-added
+        // to the proper socket address hash bucket in the table.
+
+        Ip6::SockAddr sockAddr = GetSockAddr();
+
+        sockAddr.SetPort(mPort);
+        SetSockAddr(sockAddr);
     }
 
 exit:
@@ -353,6 +374,8 @@ PeerTable::PeerTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mTimer(aInstance)
 {
+    ClearAllBytes(mExtAddrBuckets);
+    ClearAllBytes(mSockAddrBuckets);
 }
 
 Peer *PeerTable::AllocatePeer(void)
@@ -386,6 +409,7 @@ Peer *PeerTable::AllocateAndAddNewPeer(void)
 
     newPeer->Init(GetInstance());
     Push(*newPeer);
+    AddToBuckets(*newPeer);
 
 exit:
     return newPeer;
@@ -465,6 +489,120 @@ void PeerTable::HandleTimer(void)
     }
 }
 
+const Peer *PeerTable::FindMatching(const Mac::ExtAddress &aExtAddress) const
+{
+    const Peer *peer;
+
+    for (peer = mExtAddrBuckets[BucketFor(aExtAddress)]; peer != nullptr; peer = peer->mNextByExtAddr)
+    {
+        if (peer->Matches(aExtAddress))
+        {
+            break;
+        }
+    }
+
+    return peer;
+}
+
+const Peer *PeerTable::FindMatching(const Ip6::SockAddr &aSockAddr) const
+{
+    const Peer *peer;
+
+    for (peer = mSockAddrBuckets[BucketFor(aSockAddr)]; peer != nullptr; peer = peer->mNextBySockAddr)
+    {
+        if (peer->Matches(aSockAddr))
+        {
+            break;
+        }
+    }
+
+    return peer;
+}
+
+void PeerTable::AddToBuckets(Peer &aPeer)
+{
+    AddToExtAddrBucket(aPeer);
+    AddToSockAddrBucket(aPeer);
+}
+
+void PeerTable::RemoveFromBuckets(Peer &aPeer)
+{
+    RemoveFromExtAddrBucket(aPeer);
+    RemoveFromSockAddrBucket(aPeer);
+}
+
+void PeerTable::AddToExtAddrBucket(Peer &aPeer)
+{
+    Peer **bucket = &mExtAddrBuckets[BucketFor(aPeer.GetExtAddress())];
+
+    aPeer.mNextByExtAddr = *bucket;
+    *bucket              = &aPeer;
+}
+
+void PeerTable::RemoveFromExtAddrBucket(Peer &aPeer)
+{
+    for (Peer **prevNext = &mExtAddrBuckets[BucketFor(aPeer.GetExtAddress())]; *prevNext != nullptr;
+         prevNext = &(*prevNext)->mNextByExtAddr)
+    {
+        if (*prevNext == &aPeer)
+        {
+            *prevNext            = aPeer.mNextByExtAddr;
+            aPeer.mNextByExtAddr = nullptr;
+            break;
+        }
+    }
+}
+
+void PeerTable::AddToSockAddrBucket(Peer &aPeer)
+{
+    Peer **bucket = &mSockAddrBuckets[BucketFor(aPeer.GetSockAddr())];
+
+    aPeer.mNextBySockAddr = *bucket;
+    *bucket               = &aPeer;
+}
+
+void PeerTable::RemoveFromSockAddrBucket(Peer &aPeer)
+{
+    for (Peer **prevNext = &mSockAddrBuckets[BucketFor(aPeer.GetSockAddr())]; *prevNext != nullptr;
+         prevNext = &(*prevNext)->mNextBySockAddr)
+    {
+        if (*prevNext == &aPeer)
+        {
+            *prevNext             = aPeer.mNextBySockAddr;
+            aPeer.mNextBySockAddr = nullptr;
+            break;
+        }
+    }
+}
+
+uint8_t PeerTable::BucketFor(const Mac::ExtAddress &aExtAddress)
+{
+    uint8_t hash = 0;
+
+    for (uint8_t byte : aExtAddress.m8)
+    {
+        hash ^= byte;
+    }
+
+    return (hash & (kNumBuckets - 1));
+}
+
+uint8_t PeerTable::BucketFor(const Ip6::SockAddr &aSockAddr)
+{
+    uint8_t  hash = 0;
+    uint16_t port = aSockAddr.GetPort();
+
+    for (uint8_t index = 0; index < Ip6::Address::kSize; index++)
+    {
+        hash ^= aSockAddr.GetAddress().GetBytes()[index];
+    }
+
+    hash ^= static_cast<uint8_t>(port & 0xff);
+    hash ^= static_cast<uint8_t>(port >> 8);
+
+    return (hash & (kNumBuckets - 1));
+}
+
 const Peer *PeerTable::GetNextPeer(PeerIterator &aIterator) const
 {
     const Peer *entry = static_cast<const Peer *>(aIterator);
@@ -42,6 +42,8 @@
 #include <openthread/platform/trel.h>
 
 #include "common/as_core_type.hpp"
+#include "common/clearable.hpp"
+#include "common/const_cast.hpp"
 #include "common/heap_allocatable.hpp"
 #include "common/heap_array.hpp"
 #include "common/heap_data.hpp"
@@ -74,7 +76,7 @@ class Peer : public InstanceLocatorInit,
              public otTrelPeer,
              public LinkedListEntry<Peer>,
 #if OPENTHREAD_CONFIG_TREL_USE_HEAP_ENABLE
-             public Heap::Allocatable<Peer>,
+             public Heap::Allocatable<Peer, Heap::kOwnerTrel>,
 #endif
              private NonCopyable
 
@@ -157,6 +159,35 @@ public:
      */
     uint32_t DetermineSecondsSinceLastInteraction(void) const;
 
+    /**
+     * Counts a transmitted TREL packet towards the peer, updating the per-peer TX counters.
+     *
+     * @param[in] aPacketLength   The length (number of bytes) of the transmitted packet.
+     */
+    void CountTxPacket(uint16_t aPacketLength)
+    {
+        mCounters.mTxPackets++;
+        mCounters.mTxBytes += aPacketLength;
+    }
+
+    /**
+     * Counts a received TREL packet from the peer, updating the per-peer RX counters.
+     *
+     * @param[in] aPacketLength   The length (number of bytes) of the received packet.
+     */
+    void CountRxPacket(uint16_t aPacketLength)
+    {
+        mCounters.mRxPackets++;
+        mCounters.mRxBytes += aPacketLength;
+    }
+
+    /**
+     * Returns the per-peer TX/RX counters.
+     *
+     * @returns The peer counters.
+     */
+    const otTrelPeerCounters &GetCounters(void) const { return mCounters; }
+
 #if OPENTHREAD_CONFIG_TREL_MANAGE_DNSSD_ENABLE
 
     /**
@@ -247,7 +278,7 @@ private:
     void     SetDnssdState(DnssdState aState);
     void     SetExtAddress(const Mac::ExtAddress &aExtAddress);
     void     SetExtPanId(const MeshCoP::ExtendedPanId &aExtPanId) { mExtPanId = aExtPanId; }
-    void     SetSockAddr(const Ip6::SockAddr &aSockAddr) { mSockAddr = aSockAddr; }
+    void     SetSockAddr(const Ip6::SockAddr &aSockAddr);
     bool     Matches(const Mac::ExtAddress &aExtAddress) const;
     bool     Matches(const Ip6::SockAddr &aSockAddr) const { return GetSockAddr() == aSockAddr; }
     bool     Matches(const Peer &aPeer) const { return this == &aPeer; }
@@ -275,6 +306,8 @@ private:
 #endif
 
     Peer      *mNext;
+    Peer      *mNextByExtAddr;  // Next peer in the same ext address hash bucket in `PeerTable`.
+    Peer      *mNextBySockAddr; // Next peer in the same socket address hash bucket in `PeerTable`.
     DnssdState mDnssdState;
     UptimeSec  mLastInteractionTime;
 #if OPENTHREAD_CONFIG_TREL_MANAGE_DNSSD_ENABLE
@@ -327,6 +360,54 @@ public:
      */
     Peer *AllocateAndAddNewPeer(void);
 
+    using OwningList<Peer>::FindMatching;
+
+    /**
+     * Searches the peer table for a peer matching a given Extended MAC Address.
+     *
+     * Unlike the linear-scan `FindMatching()` methods inherited from `OwningList`, this overload resolves the peer
+     * through the hash buckets maintained by the table and is intended for per-packet peer resolution on the TREL
+     * tx/rx paths.
+     *
+     * @param[in] aExtAddress   The Extended MAC Address to match against.
+     *
+     * @returns A pointer to the matching `Peer`, or `nullptr` if no match is found.
+     */
+    const Peer *FindMatching(const Mac::ExtAddress &aExtAddress) const;
+
+    /**
+     * Searches the peer table for a peer matching a given Extended MAC Address.
+     *
+     * @param[in] aExtAddress   The Extended MAC Address to match against.
+     *
+     * @returns A pointer to the matching `Peer`, or `nullptr` if no match is found.
+     */
+    Peer *FindMatching(const Mac::ExtAddress &aExtAddress)
+    {
+        return AsNonConst(AsConst(this)->FindMatching(aExtAddress));
+    }
+
+    /**
+     * Searches the peer table for a peer matching a given IPv6 socket address.
+     *
+     * Similar to the ext address variant, this overload resolves the peer through the hash buckets maintained by
+     * the table.
+     *
+     * @param[in] aSockAddr   The IPv6 socket address to match against.
+     *
+     * @returns A pointer to the matching `Peer`, or `nullptr` if no match is found.
+     */
+    const Peer *FindMatching(const Ip6::SockAddr &aSockAddr) const;
+
+    /**
+     * Searches the peer table for a peer matching a given IPv6 socket address.
+     *
+     * @param[in] aSockAddr   The IPv6 socket address to match against.
+     *
+     * @returns A pointer to the matching `Peer`, or `nullptr` if no match is found.
+     */
+    Peer *FindMatching(const Ip6::SockAddr &aSockAddr) { return AsNonConst(AsConst(this)->FindMatching(aSockAddr)); }
+
     /**
      * Initializes a peer table iterator.
      *
@@ -360,13 +441,30 @@ private:
 #endif
 #endif
 
+    // Peers in the table are additionally threaded through two sets of hash buckets, keyed by the peer Extended
+    // MAC Address and by its IPv6 socket address. The buckets are kept in sync as peers are added or removed, and
+    // when a peer key (ext address or socket address) is updated.
+
+    static constexpr uint8_t kNumBuckets = 16; // MUST be a power of two.
+
+    static uint8_t BucketFor(const Mac::ExtAddress &aExtAddress);
+    static uint8_t BucketFor(const Ip6::SockAddr &aSockAddr);
+
     Peer *AllocatePeer(void);
     Error EvictPeer(void);
+    void  AddToBuckets(Peer &aPeer);
+    void  RemoveFromBuckets(Peer &aPeer);
+    void  AddToExtAddrBucket(Peer &aPeer);
+    void  RemoveFromExtAddrBucket(Peer &aPeer);
+    void  AddToSockAddrBucket(Peer &aPeer);
+    void  RemoveFromSockAddrBucket(Peer &aPeer);
     void  HandleTimer(void);
 
     using PeerTimer = TimerMilliIn<PeerTable, &PeerTable::HandleTimer>;
 
     PeerTimer mTimer;
+    Peer     *mExtAddrBuckets[kNumBuckets];
+    Peer     *mSockAddrBuckets[kNumBuckets];
 #if !OPENTHREAD_CONFIG_TREL_USE_HEAP_ENABLE
     Pool<Peer, PoolSize> mPool;
 #endif
@@ -44,6 +44,9 @@ AddressResolver::AddressResolver(Instance &aInstance)
 #if OPENTHREAD_FTD
     , mCacheEntryPool(aInstance)
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_NEW_PER_SECOND != 0
+    , mNewQueryBudget(kMaxNewQueriesPerSecond)
+#endif
 #endif
 {
 #if OPENTHREAD_FTD
@@ -151,6 +154,27 @@ exit:
     return error;
 }
 
+void AddressResolver::GetCacheEntryStats(otCacheEntryStats &aStats) const
+{
+    aStats.mNumCachedEntries     = CountListEntries(mCachedList);
+    aStats.mNumSnoopedEntries    = CountListEntries(mSnoopedList);
+    aStats.mNumQueryEntries      = CountListEntries(mQueryList);
+    aStats.mNumRetryQueryEntries = CountListEntries(mQueryRetryList);
+}
+
+uint16_t AddressResolver::CountListEntries(const CacheEntryList &aList)
+{
+    uint16_t count = 0;
+
+    for (const CacheEntry &entry : aList)
+    {
+        OT_UNUSED_VARIABLE(entry);
+        count++;
+    }
+
+    return count;
+}
+
 void AddressResolver::RemoveEntriesForRouterId(uint8_t aRouterId)
 {
     Remove(Mle::Rloc16FromRouterId(aRouterId), /* aMatchRouterId */ true);
@@ -195,13 +219,14 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
                                                              CacheEntryList    *&aList,
                                                              CacheEntry        *&aPrevEntry)
 {
-    CacheEntry     *entry   = nullptr;
+    CacheEntry     *entry = nullptr;
+    HashedEid       hashedEid(aEid);
     CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
 
     for (CacheEntryList *list : lists)
     {
         aList = list;
-        entry = aList->FindMatchingWithPrev(aPrevEntry, aEid);
+        entry = aList->FindMatchingWithPrev(aPrevEntry, hashedEid);
         VerifyOrExit(entry == nullptr);
     }
 
@@ -528,6 +553,20 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
 
         VerifyOrExit(aAllowAddressQuery, error = kErrorNotFound);
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_NEW_PER_SECOND != 0
+        // Rate-limit first-time address queries. An external host
+        // scanning a large address range through a Border Router
+        // would otherwise trigger a cache entry allocation and a
+        // multicast Address Query message per probed address,
+        // pressuring the message pool that mesh forwarding depends
+        // on. Over-budget targets are dropped early, before any
+        // allocation. The budget is replenished in
+        // `HandleTimeTick()`. Retries for already tracked targets
+        // are not subject to this limit.
+
+        VerifyOrExit(mNewQueryBudget > 0, error = kErrorDrop);
+#endif
+
         entry = NewCacheEntry(/* aSnoopedEntry */ false);
         VerifyOrExit(entry != nullptr, error = kErrorNoBufs);
 
@@ -568,6 +607,9 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
 
     if (list == nullptr)
     {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_NEW_PER_SECOND != 0
+        mNewQueryBudget--;
+#endif
         LogCacheEntryChange(kEntryAdded, kReasonQueryRequest, *entry);
     }
 
@@ -894,6 +936,14 @@ void AddressResolver::HandleTimeTick(void)
 {
     bool continueRxingTicks = false;
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_NEW_PER_SECOND != 0
+    if (mNewQueryBudget != kMaxNewQueriesPerSecond)
+    {
+        mNewQueryBudget    = kMaxNewQueriesPerSecond;
+        continueRxingTicks = true;
+    }
+#endif
+
     for (CacheEntry &entry : mCachedList)
     {
         if (!entry.IsFreshnessTimeoutZero())
@@ -1109,6 +1159,22 @@ void AddressResolver::CacheEntry::Init(Instance &aInstance)
     mFreshnessTimeout = 0;
 }
 
+uint16_t AddressResolver::CacheEntry::CalculateHash(const Ip6::Address &aEid)
+{
+    // Determines a hash of `aEid` by folding (XOR) the halfwords of
+    // its IID. EIDs in the cache commonly share the same mesh-local
+    // prefix, so the IID provides the distinguishing bits.
+
+    const Ip6::InterfaceIdentifier &iid = aEid.GetIid();
+
+    return iid.mFields.m16[0] ^ iid.mFields.m16[1] ^ iid.mFields.m16[2] ^ iid.mFields.m16[3];
+}
+
+bool AddressResolver::CacheEntry::Matches(const HashedEid &aHashedEid) const
+{
+    return (mTargetHash == aHashedEid.mHash) && (GetTarget() == aHashedEid.mEid);
+}
+
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
 {
     return (mNextIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
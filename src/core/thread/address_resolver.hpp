@@ -72,6 +72,7 @@ class AddressResolver : public InstanceLocator, private NonCopyable
 
     class CacheEntry;
     class CacheEntryList;
+    struct HashedEid;
 
 public:
     /**
@@ -129,6 +130,13 @@ public:
      */
     Error GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const;
 
+    /**
+     * Gets the number of EID cache table entries in each state.
+     *
+     * @param[out] aStats  An `otCacheEntryStats` to populate with the per-state entry counts.
+     */
+    void GetCacheEntryStats(otCacheEntryStats &aStats) const;
+
     /**
      * Removes the EID-to-RLOC cache entries corresponding to an RLOC16.
      *
@@ -240,6 +248,7 @@ private:
     static constexpr uint16_t kAddressQueryInitialRetryDelay = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_INITIAL_RETRY_DELAY;
     static constexpr uint16_t kAddressQueryMaxRetryDelay     = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_RETRY_DELAY;
     static constexpr uint16_t kSnoopBlockEvictionTimeout     = OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT;
+    static constexpr uint16_t kMaxNewQueriesPerSecond        = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_NEW_PER_SECOND;
 
     class CacheEntry : public InstanceLocatorInit
     {
@@ -251,7 +260,14 @@ private:
         void              SetNext(CacheEntry *aEntry);
 
         const Ip6::Address &GetTarget(void) const { return mTarget; }
-        void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
+
+        void SetTarget(const Ip6::Address &aTarget)
+        {
+            mTarget     = aTarget;
+            mTargetHash = CalculateHash(aTarget);
+        }
+
+        static uint16_t CalculateHash(const Ip6::Address &aEid);
 
         uint16_t GetRloc16(void) const { return mRloc16; }
         void     SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
@@ -283,6 +299,7 @@ private:
         void SetRampDown(bool aRampDown) { mInfo.mOther.mRampDown = aRampDown; }
 
         bool Matches(const Ip6::Address &aEid) const { return GetTarget() == aEid; }
+        bool Matches(const HashedEid &aHashedEid) const;
 
     private:
         static constexpr uint16_t kNoNextIndex          = 0x3fff;     // `mNextIndex` value when at end of list.
@@ -292,6 +309,7 @@ private:
         static_assert(kCacheEntries < kNoNextIndex, "kCacheEntries is too large and does not fit in 14 bit index");
 
         Ip6::Address mTarget;
+        uint16_t     mTargetHash;
         uint16_t     mRloc16;
         uint16_t     mNextIndex : 14;
         uint8_t      mFreshnessTimeout : 2;
@@ -317,6 +335,23 @@ private:
 
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
 
+    struct HashedEid
+    {
+        // Pairs an EID with its hash (matching the cached
+        // `mTargetHash` in `CacheEntry`), allowing non-matching
+        // entries to be quickly ruled out with an integer compare
+        // while searching the cache entry lists.
+
+        explicit HashedEid(const Ip6::Address &aEid)
+            : mEid(aEid)
+            , mHash(CacheEntry::CalculateHash(aEid))
+        {
+        }
+
+        const Ip6::Address &mEid;
+        uint16_t            mHash;
+    };
+
     class CacheEntryList : public LinkedList<CacheEntry>
     {
     };
@@ -378,6 +413,7 @@ private:
     const char *ListToString(const CacheEntryList *aList) const;
 
     static AddressResolver::CacheEntry *GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList);
+    static uint16_t                     CountListEntries(const CacheEntryList &aList);
 
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_INFO)
     static const char *EntryChangeToString(EntryChange aChange);
@@ -390,6 +426,9 @@ private:
     CacheEntryList     mQueryList;
     CacheEntryList     mQueryRetryList;
     Ip6::Icmp::Handler mIcmpHandler;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_NEW_PER_SECOND != 0
+    uint16_t mNewQueryBudget;
+#endif
 
 #endif // OPENTHREAD_FTD
 };
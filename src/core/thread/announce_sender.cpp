@@ -148,11 +148,29 @@ exit:
 AnnounceSender::AnnounceSender(Instance &aInstance)
     : AnnounceSenderBase(aInstance, AnnounceSender::HandleTimer)
     , mTrickleTimer(aInstance, AnnounceSender::HandleTrickleTimer)
+    , mTxCycleCount(0)
+    , mSuppressedCycleCount(0)
 {
     SetJitter(kMaxJitter);
 }
 
-void AnnounceSender::UpdateOnReceivedAnnounce(void) { mTrickleTimer.IndicateConsistent(); }
+void AnnounceSender::UpdateOnReceivedAnnounce(const Neighbor *aSender)
+{
+    // Count the received Announce towards suppression only when it
+    // is heard from a valid router neighbor. A router neighbor
+    // covers all channels from the channel mask in its own tx
+    // cycle, so its Announce transmissions provide the same
+    // discoverability that ours would. Announce messages from
+    // unknown devices or (sleepy) children do not.
+
+    VerifyOrExit(aSender != nullptr);
+    VerifyOrExit(aSender->IsStateValid() && Mle::IsRouterRloc16(aSender->GetRloc16()));
+
+    mTrickleTimer.IndicateConsistent();
+
+exit:
+    return;
+}
 
 void AnnounceSender::Stop(void)
 {
@@ -174,8 +192,25 @@ void AnnounceSender::HandleTrickleTimer(void)
     // We then request one more cycle of Announce
     // message transmissions.
 
+    // Any full intervals that elapsed since the last transmitted
+    // cycle were suppressed by the trickle redundancy check (enough
+    // Announce messages heard from router neighbors). The elapsed
+    // time is rounded to the nearest number of intervals since the
+    // trickle timer fires at a random point within each interval.
+
+    uint32_t elapsedIntervals = (TimerMilli::GetNow() - mLastTxCycleTime + kInterval / 2) / kInterval;
+
+    if (elapsedIntervals > 0)
+    {
+        mSuppressedCycleCount += elapsedIntervals - 1;
+    }
+
+    mTxCycleCount++;
+    mLastTxCycleTime = TimerMilli::GetNow();
+
     SendAnnounce(1);
-    LogInfo("Schedule tx for one cycle");
+    LogInfo("Schedule tx for one cycle (tx:%lu, suppressed:%lu)", ToUlong(mTxCycleCount),
+            ToUlong(mSuppressedCycleCount));
 }
 
 void AnnounceSender::HandleNotifierEvents(Events aEvents)
@@ -223,6 +258,7 @@ void AnnounceSender::HandleRoleChanged(void)
     // Start the trickle timer with same min and max interval as the
     // desired Announce Tx cycle interval.
 
+    mLastTxCycleTime = TimerMilli::GetNow();
     mTrickleTimer.Start(TrickleTimer::kModeTrickle, kInterval, kInterval, kRedundancyConstant);
     LogInfo("Started");
 
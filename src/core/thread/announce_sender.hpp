@@ -45,6 +45,8 @@
 
 namespace ot {
 
+class Neighbor;
+
 /**
  * Implements the base class for an `AnnounceSender` and `AnnounceBeginSever`.
  *
@@ -203,8 +205,32 @@ public:
     /**
      * Notifies the `AnnounceSender` that a MLE Announcement message was received with a current timestamp
      * to update its internal state (decide whether or not to skip transmission of MLE Announcement in this cycle).
+     *
+     * Only Announce messages heard from valid router neighbors are counted towards suppression, since only a
+     * router covers (announces on) all channels each cycle the same way this device would.
+     *
+     * @param[in] aSender   A pointer to the `Neighbor` the message was received from, or `nullptr` if the sender
+     *                      is not a known neighbor.
+     */
+    void UpdateOnReceivedAnnounce(const Neighbor *aSender);
+
+    /**
+     * Gets the number of Announce transmission cycles performed by this device.
+     *
+     * @returns The number of transmitted cycles.
      */
-    void UpdateOnReceivedAnnounce(void);
+    uint32_t GetTxCycleCount(void) const { return mTxCycleCount; }
+
+    /**
+     * Gets the number of Announce transmission cycles skipped because enough Announce messages were heard
+     * from router neighbors.
+     *
+     * The count is derived from the time elapsed between two transmitted cycles, so it is accurate to within
+     * one cycle interval.
+     *
+     * @returns The number of suppressed cycles.
+     */
+    uint32_t GetSuppressedCycleCount(void) const { return mSuppressedCycleCount; }
 
 private:
     // Specifies the time interval (in milliseconds) between
@@ -237,12 +263,17 @@ private:
     static void HandleTimer(Timer &aTimer);
     static void HandleTrickleTimer(TrickleTimer &aTimer);
     void        HandleTrickleTimer(void);
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventActiveDatasetChanged | kEventThreadChannelChanged;
+
     void        HandleNotifierEvents(Events aEvents);
     void        HandleRoleChanged(void);
     void        HandleActiveDatasetChanged(void);
     void        HandleThreadChannelChanged(void);
 
     TrickleTimer mTrickleTimer;
+    TimeMilli    mLastTxCycleTime;
+    uint32_t     mTxCycleCount;
+    uint32_t     mSuppressedCycleCount;
 };
 
 #endif // OPENTHREAD_CONFIG_ANNOUNCE_SENDER_ENABLE
@@ -41,36 +41,144 @@ namespace ot {
 
 AnycastLocator::AnycastLocator(Instance &aInstance)
     : InstanceLocator(aInstance)
-
+    , mQueryEvictIndex(0)
+    , mCacheEvictIndex(0)
+    , mCachedReportTask(aInstance)
 {
+    ClearAllBytes(mCacheEntries);
+
+    for (Query &query : mQueries)
+    {
+        query.mLocator      = this;
+        query.mAloc16       = 0;
+        query.mReportCached = false;
+    }
 }
 
 Error AnycastLocator::Locate(const Ip6::Address &aAnycastAddress, LocatorCallback aCallback, void *aContext)
 {
-    Error          error   = kErrorNone;
-    Coap::Message *message = nullptr;
+    Error             error   = kErrorNone;
+    Coap::Message    *message = nullptr;
+    Query            *query;
+    const CacheEntry *cacheEntry;
+    uint16_t          aloc16;
 
     VerifyOrExit((aCallback != nullptr) && Get<Mle::Mle>().IsAnycastLocator(aAnycastAddress),
                  error = kErrorInvalidArgs);
 
-    message = Get<Tmf::Agent>().AllocateAndInitConfirmablePostMessage(kUriAnycastLocate);
-    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+    aloc16 = aAnycastAddress.GetIid().GetLocator();
+
+    cacheEntry = FindFreshCacheEntry(aloc16);
 
-    if (mCallback.IsSet())
+    if (cacheEntry != nullptr)
     {
-        IgnoreError(Get<Tmf::Agent>().AbortTransaction(HandleResponse, this));
+        query = AllocateQuery(aloc16);
+
+        query->mAloc16             = aloc16;
+        query->mCachedRloc16       = cacheEntry->mRloc16;
+        query->mCachedMeshLocalIid = cacheEntry->mMeshLocalIid;
+        query->mReportCached       = true;
+        query->mCallback.Set(aCallback, aContext);
+
+        mCachedReportTask.Post();
+        ExitNow();
     }
 
-    SuccessOrExit(error = Get<Tmf::Agent>().SendMessageTo(*message, aAnycastAddress, HandleResponse, this));
+    message = Get<Tmf::Agent>().AllocateAndInitConfirmablePostMessage(kUriAnycastLocate);
+    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+
+    query = AllocateQuery(aloc16);
 
-    mCallback.Set(aCallback, aContext);
+    SuccessOrExit(error = Get<Tmf::Agent>().SendMessageTo(*message, aAnycastAddress, HandleResponse, query));
+
+    query->mAloc16 = aloc16;
+    query->mCallback.Set(aCallback, aContext);
 
 exit:
     FreeMessageOnError(message, error);
     return error;
 }
 
-void AnycastLocator::HandleResponse(Coap::Msg *aMsg, Error aError)
+bool AnycastLocator::IsInProgress(void) const
+{
+    bool inProgress = false;
+
+    for (const Query &query : mQueries)
+    {
+        if (query.IsInUse())
+        {
+            inProgress = true;
+            break;
+        }
+    }
+
+    return inProgress;
+}
+
+AnycastLocator::Query *AnycastLocator::AllocateQuery(uint16_t aAloc16)
+{
+    // Find the query entry to use for a new request for @p aAloc16.
+    // An ongoing request for the same ALOC is canceled and its entry
+    // reused. Otherwise the first free entry is used, and if all
+    // entries are in use, the entries are evicted in a round-robin
+    // order (approximating oldest-first).
+
+    Query *query = nullptr;
+
+    for (Query &entry : mQueries)
+    {
+        if (entry.Matches(aAloc16))
+        {
+            query = &entry;
+            ExitNow();
+        }
+
+        if ((query == nullptr) && !entry.IsInUse())
+        {
+            query = &entry;
+        }
+    }
+
+    if (query == nullptr)
+    {
+        query            = &mQueries[mQueryEvictIndex];
+        mQueryEvictIndex = static_cast<uint8_t>((mQueryEvictIndex + 1) % kMaxQueries);
+    }
+
+exit:
+    CancelQuery(*query);
+    return query;
+}
+
+void AnycastLocator::CancelQuery(Query &aQuery)
+{
+    VerifyOrExit(aQuery.IsInUse());
+
+    if (aQuery.mReportCached)
+    {
+        aQuery.mReportCached = false;
+        aQuery.mCallback.InvokeAndClearIfSet(kErrorAbort, nullptr, Mle::kInvalidRloc16);
+    }
+    else
+    {
+        // Aborting the transaction invokes `HandleResponse()` with
+        // `kErrorAbort` which reports and clears the callback.
+
+        IgnoreError(Get<Tmf::Agent>().AbortTransaction(HandleResponse, &aQuery));
+    }
+
+exit:
+    return;
+}
+
+void AnycastLocator::HandleResponse(void *aContext, Coap::Msg *aMsg, Error aResult)
+{
+    Query &query = *static_cast<Query *>(aContext);
+
+    query.mLocator->HandleResponse(query, aMsg, aResult);
+}
+
+void AnycastLocator::HandleResponse(Query &aQuery, Coap::Msg *aMsg, Error aError)
 {
     uint16_t            rloc16  = Mle::kInvalidRloc16;
     const Ip6::Address *address = nullptr;
@@ -87,10 +195,86 @@ void AnycastLocator::HandleResponse(Coap::Msg *aMsg, Error aError)
     Get<AddressResolver>().UpdateSnoopedCacheEntry(meshLocalAddress, rloc16, Get<Mac::Mac>().GetShortAddress());
 #endif
 
+    UpdateCacheEntry(aQuery.mAloc16, rloc16, meshLocalAddress.GetIid());
+
     address = &meshLocalAddress;
 
 exit:
-    mCallback.InvokeAndClearIfSet(aError, address, rloc16);
+    aQuery.mCallback.InvokeAndClearIfSet(aError, address, rloc16);
+}
+
+void AnycastLocator::HandleCachedReportTask(void)
+{
+    for (Query &query : mQueries)
+    {
+        Ip6::Address meshLocalAddress;
+
+        if (!query.mReportCached)
+        {
+            continue;
+        }
+
+        meshLocalAddress.SetPrefix(Get<Mle::Mle>().GetMeshLocalPrefix());
+        meshLocalAddress.SetIid(query.mCachedMeshLocalIid);
+
+        query.mReportCached = false;
+        query.mCallback.InvokeAndClearIfSet(kErrorNone, &meshLocalAddress, query.mCachedRloc16);
+    }
+}
+
+const AnycastLocator::CacheEntry *AnycastLocator::FindFreshCacheEntry(uint16_t aAloc16) const
+{
+    // A cached binding is considered fresh as long as the Network
+    // Data version has not changed since the binding was learned
+    // (service/anycast destinations can only change along with a
+    // Network Data update).
+
+    const CacheEntry *cacheEntry = nullptr;
+
+    for (const CacheEntry &entry : mCacheEntries)
+    {
+        if (entry.Matches(aAloc16))
+        {
+            if (entry.mNetworkDataVersion == Get<NetworkData::Leader>().GetVersion(NetworkData::kFullSet))
+            {
+                cacheEntry = &entry;
+            }
+
+            break;
+        }
+    }
+
+    return cacheEntry;
+}
+
+void AnycastLocator::UpdateCacheEntry(uint16_t aAloc16, uint16_t aRloc16, const Ip6::InterfaceIdentifier &aIid)
+{
+    CacheEntry *cacheEntry = nullptr;
+
+    for (CacheEntry &entry : mCacheEntries)
+    {
+        if (entry.Matches(aAloc16))
+        {
+            cacheEntry = &entry;
+            break;
+        }
+
+        if ((cacheEntry == nullptr) && (entry.mAloc16 == 0))
+        {
+            cacheEntry = &entry;
+        }
+    }
+
+    if (cacheEntry == nullptr)
+    {
+        cacheEntry       = &mCacheEntries[mCacheEvictIndex];
+        mCacheEvictIndex = static_cast<uint8_t>((mCacheEvictIndex + 1) % kCacheEntries);
+    }
+
+    cacheEntry->mAloc16             = aAloc16;
+    cacheEntry->mRloc16             = aRloc16;
+    cacheEntry->mMeshLocalIid       = aIid;
+    cacheEntry->mNetworkDataVersion = Get<NetworkData::Leader>().GetVersion(NetworkData::kFullSet);
 }
 
 #if OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_SEND_RESPONSE
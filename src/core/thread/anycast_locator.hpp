@@ -41,6 +41,7 @@
 #include "common/callback.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/tasklet.hpp"
 #include "net/ip6_address.hpp"
 #include "thread/tmf.hpp"
 
@@ -72,8 +73,13 @@ public:
     /**
      * Requests the closest destination of a given anycast address to be located.
      *
-     * If a previous `Locate()` request is ongoing, a subsequent call to this method will cancel and replace the
-     * earlier request.
+     * Up to `OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_MAX_QUERIES` requests (for distinct anycast addresses) can be
+     * in progress in parallel. A request for an anycast address with an ongoing request will cancel and replace
+     * the earlier request. If all query entries are in use, the earliest request is canceled and replaced.
+     *
+     * If a fresh cached binding is available for the anycast address (learned from an earlier response and with
+     * no Network Data version change since), the result is reported from the cache (from a tasklet callback)
+     * without sending a new query.
      *
      * @param[in] aAnycastAddress   The anycast address to locate the closest destination of.
      * @param[in] aCallback         The callback handler to report the result.
@@ -90,14 +96,52 @@ public:
      *
      * @returns TRUE if an earlier request is in progress, FALSE otherwise.
      */
-    bool IsInProgress(void) const { return mCallback.IsSet(); }
+    bool IsInProgress(void) const;
 
 private:
-    template <Uri kUri> void HandleTmf(Coap::Msg &aMsg);
+    static constexpr uint16_t kMaxQueries   = OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_MAX_QUERIES;
+    static constexpr uint16_t kCacheEntries = OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_CACHE_ENTRIES;
+
+    struct Query
+    {
+        bool IsInUse(void) const { return mCallback.IsSet(); }
+        bool Matches(uint16_t aAloc16) const { return IsInUse() && (mAloc16 == aAloc16); }
+
+        AnycastLocator           *mLocator;
+        Callback<LocatorCallback> mCallback;
+        uint16_t                  mAloc16;
+        uint16_t                  mCachedRloc16;
+        Ip6::InterfaceIdentifier  mCachedMeshLocalIid;
+        bool                      mReportCached;
+    };
+
+    struct CacheEntry
+    {
+        bool Matches(uint16_t aAloc16) const { return mAloc16 == aAloc16; }
+
+        uint16_t                 mAloc16; // Zero (not a valid ALOC16) when entry is unused.
+        uint16_t                 mRloc16;
+        Ip6::InterfaceIdentifier mMeshLocalIid;
+        uint8_t                  mNetworkDataVersion;
+    };
 
-    DeclareTmfResponseHandlerIn(AnycastLocator, HandleResponse);
+    template <Uri kUri> void HandleTmf(Coap::Msg &aMsg);
 
-    Callback<LocatorCallback> mCallback;
+    static void HandleResponse(void *aContext, Coap::Msg *aMsg, Error aResult);
+    void        HandleResponse(Query &aQuery, Coap::Msg *aMsg, Error aResult);
+    void        HandleCachedReportTask(void);
+    Query      *AllocateQuery(uint16_t aAloc16);
+    void        CancelQuery(Query &aQuery);
+    const CacheEntry *FindFreshCacheEntry(uint16_t aAloc16) const;
+    void              UpdateCacheEntry(uint16_t aAloc16, uint16_t aRloc16, const Ip6::InterfaceIdentifier &aIid);
+
+    using CachedReportTask = TaskletIn<AnycastLocator, &AnycastLocator::HandleCachedReportTask>;
+
+    Query            mQueries[kMaxQueries];
+    CacheEntry       mCacheEntries[kCacheEntries];
+    uint8_t          mQueryEvictIndex;
+    uint8_t          mCacheEvictIndex;
+    CachedReportTask mCachedReportTask;
 };
 
 #if OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_SEND_RESPONSE
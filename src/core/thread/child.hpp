@@ -98,7 +98,14 @@ public:
          * @retval TRUE   The entry matches @p aAddress.
          * @retval FALSE  The entry does not match @p aAddress.
          */
-        bool Matches(const Ip6::Address &aAddress) const { return (*this == aAddress); }
+        bool Matches(const Ip6::Address &aAddress) const
+        {
+            // Compare the last four bytes (tail of the IID) first to
+            // quickly reject non-matching entries, since registered
+            // addresses commonly share their leading prefix bytes.
+
+            return (mFields.m32[3] == aAddress.mFields.m32[3]) && (*this == aAddress);
+        }
 
 #if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
         /**
@@ -88,6 +88,26 @@ exit:
 
 void ChildSupervisor::UpdateOnSend(Child &aChild) { aChild.ResetSecondsSinceLastSupervision(); }
 
+uint16_t ChildSupervisor::GetSendThreshold(const Child &aChild) const
+{
+    // Determine the number of seconds after which a supervision message
+    // is sent to the child. A deterministic per-child phase (derived
+    // from the child table index) shifts the threshold slightly below
+    // the supervision interval. Since the supervision counters of
+    // children attaching around the same time (e.g., after a parent
+    // reset) start in lock-step, the phase spreads the periodic
+    // supervision transmissions (and their message allocations) across
+    // the interval instead of bursting them in a single tick. Sending
+    // ahead of the interval is always safe, and the spread is bounded
+    // by `kMaxPhaseSpread` (and half the interval) to limit the extra
+    // transmissions.
+
+    uint16_t interval = aChild.GetSupervisionInterval();
+    uint16_t phase    = Get<ChildTable>().GetChildIndex(aChild) % (Min<uint16_t>(interval / 2, kMaxPhaseSpread) + 1);
+
+    return interval - phase;
+}
+
 void ChildSupervisor::HandleTimeTick(void)
 {
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
@@ -99,7 +119,7 @@ void ChildSupervisor::HandleTimeTick(void)
 
         child.IncrementSecondsSinceLastSupervision();
 
-        if (child.GetSecondsSinceLastSupervision() >= child.GetSupervisionInterval())
+        if (child.GetSecondsSinceLastSupervision() >= GetSendThreshold(child))
         {
             SendMessage(child);
         }
@@ -119,9 +119,18 @@ public:
 private:
     static constexpr uint16_t kDefaultSupervisionInterval = OPENTHREAD_CONFIG_CHILD_SUPERVISION_INTERVAL; // (seconds)
 
+    // Maximum number of seconds a supervision message may be sent ahead
+    // of the child's supervision interval to spread transmissions to
+    // different children across the interval (see `GetSendThreshold()`).
+    static constexpr uint16_t kMaxPhaseSpread = 16; // (seconds)
+
+    uint16_t GetSendThreshold(const Child &aChild) const;
+
     void SendMessage(Child &aChild);
     void CheckState(void);
     void HandleTimeTick(void);
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadChildAdded | kEventThreadChildRemoved;
+
     void HandleNotifierEvents(Events aEvents);
 };
 
@@ -82,6 +82,9 @@ ChildTable::ChildTable(Instance &aInstance)
     , mNextChildId(Mle::kMaxChildId)
     , mMaxChildrenAllowed(kMaxChildren)
 {
+    ClearAllBytes(mRlocLookupBuckets);
+    ClearAllBytes(mExtAddrLookupBuckets);
+
     for (Child &child : mChildren)
     {
         child.Init(aInstance);
@@ -159,17 +162,74 @@ exit:
 
 Child *ChildTable::FindChild(uint16_t aRloc16, Child::StateFilter aFilter)
 {
-    return FindChild(Child::AddressMatcher(aRloc16, aFilter));
+    Child::AddressMatcher matcher(aRloc16, aFilter);
+    uint8_t               bucket = BucketFor(aRloc16);
+    Child                *child  = GetSteeredChild(mRlocLookupBuckets, bucket);
+
+    if ((child != nullptr) && child->Matches(matcher))
+    {
+        ExitNow();
+    }
+
+    child = FindChild(matcher);
+    UpdateLookupBucket(mRlocLookupBuckets, bucket, child);
+
+exit:
+    return child;
 }
 
 Child *ChildTable::FindChild(const Mac::ExtAddress &aExtAddress, Child::StateFilter aFilter)
 {
-    return FindChild(Child::AddressMatcher(aExtAddress, aFilter));
+    Child::AddressMatcher matcher(aExtAddress, aFilter);
+    uint8_t               bucket = BucketFor(aExtAddress);
+    Child                *child  = GetSteeredChild(mExtAddrLookupBuckets, bucket);
+
+    if ((child != nullptr) && child->Matches(matcher))
+    {
+        ExitNow();
+    }
+
+    child = FindChild(matcher);
+    UpdateLookupBucket(mExtAddrLookupBuckets, bucket, child);
+
+exit:
+    return child;
 }
 
 Child *ChildTable::FindChild(const Mac::Address &aMacAddress, Child::StateFilter aFilter)
 {
-    return FindChild(Child::AddressMatcher(aMacAddress, aFilter));
+    Child *child;
+
+    switch (aMacAddress.GetType())
+    {
+    case Mac::Address::kTypeShort:
+        child = FindChild(aMacAddress.GetShort(), aFilter);
+        break;
+    case Mac::Address::kTypeExtended:
+        child = FindChild(aMacAddress.GetExtended(), aFilter);
+        break;
+    default:
+        child = FindChild(Child::AddressMatcher(aMacAddress, aFilter));
+        break;
+    }
+
+    return child;
+}
+
+Child *ChildTable::GetSteeredChild(const uint16_t *aBuckets, uint8_t aBucket)
+{
+    uint16_t index = aBuckets[aBucket];
+
+    return (index == 0) ? nullptr : &mChildren[index - 1];
+}
+
+void ChildTable::UpdateLookupBucket(uint16_t *aBuckets, uint8_t aBucket, const Child *aChild)
+{
+    VerifyOrExit(aChild != nullptr);
+    aBuckets[aBucket] = GetChildIndex(*aChild) + 1;
+
+exit:
+    return;
 }
 
 bool ChildTable::HasChildren(Child::StateFilter aFilter) const
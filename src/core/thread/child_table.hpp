@@ -314,7 +314,8 @@ public:
     }
 
 private:
-    static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+    static constexpr uint16_t kMaxChildren      = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+    static constexpr uint16_t kNumLookupBuckets = 16; // Must be a power of two.
 
     class IteratorBuilder : public InstanceLocator
     {
@@ -337,8 +338,27 @@ private:
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
     void         RefreshStoredChildren(void);
 
+    // Lookup buckets speed up `FindChild()` searches by remembering the
+    // child entry (as table index plus one, with zero indicating unset)
+    // that last matched a given RLOC16 or extended address hashing to
+    // the bucket. A bucket is only a hint: the steered entry is always
+    // re-verified against the address and state filter before use, so a
+    // stale hint can never produce a wrong match and the buckets need
+    // no explicit invalidation on child state transitions.
+
+    static uint8_t BucketFor(uint16_t aRloc16) { return aRloc16 & (kNumLookupBuckets - 1); }
+    static uint8_t BucketFor(const Mac::ExtAddress &aExtAddress)
+    {
+        return aExtAddress.m8[sizeof(Mac::ExtAddress) - 1] & (kNumLookupBuckets - 1);
+    }
+
+    Child *GetSteeredChild(const uint16_t *aBuckets, uint8_t aBucket);
+    void   UpdateLookupBucket(uint16_t *aBuckets, uint8_t aBucket, const Child *aChild);
+
     uint16_t mNextChildId;
     uint16_t mMaxChildrenAllowed;
+    uint16_t mRlocLookupBuckets[kNumLookupBuckets];
+    uint16_t mExtAddrLookupBuckets[kNumLookupBuckets];
     Child    mChildren[kMaxChildren];
 };
 
@@ -40,6 +40,9 @@ CslTxScheduler::CslTxScheduler(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mCslTxNeighbor(nullptr)
     , mCslTxMessage(nullptr)
+#if OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_ENABLE
+    , mBurstFrameCount(0)
+#endif
     , mFrameContext()
 {
     UpdateFrameRequestAhead();
@@ -90,6 +93,9 @@ void CslTxScheduler::Clear(void)
     mFrameContext.mMessageNextOffset = 0;
     mCslTxNeighbor                   = nullptr;
     mCslTxMessage                    = nullptr;
+#if OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_ENABLE
+    mBurstFrameCount = 0;
+#endif
 }
 
 /**
@@ -102,6 +108,10 @@ void CslTxScheduler::RescheduleCslTx(void)
     uint32_t     minDelayTime = Time::kMaxDuration;
     CslNeighbor *bestNeighbor = nullptr;
 
+#if OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_ENABLE
+    mBurstFrameCount = 0;
+#endif
+
 #if OPENTHREAD_FTD
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
     {
@@ -202,6 +212,18 @@ Mac::TxFrame *CslTxScheduler::HandleFrameRequest(Mac::TxFrames &aTxFrames)
         frame->SetRxChannelAfterTxDone(Get<Mac::Mac>().GetPanChannel());
     }
 
+#if OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_ENABLE
+    if (mBurstFrameCount > 0)
+    {
+        // A follow-up frame in a burst. The receiver has kept its
+        // receive window open after acking the previous frame with the
+        // frame pending bit set, so transmit right away using CSMA/CA
+        // rather than waiting for the next CSL sample window.
+        frame->SetCsmaCaEnabled(true);
+        ExitNow();
+    }
+#endif
+
     delay = GetNextCslTransmissionDelay(*mCslTxNeighbor, txDelay, /* aAheadUs */ 0);
 
     // We make sure that delay is less than `mCslFrameRequestAheadUs`
@@ -248,8 +270,25 @@ void CslTxScheduler::HandleSentFrame(const Mac::TxFrame &aFrame, Error aError)
 
     HandleSentFrame(aFrame, aError, *neighbor);
 
+#if OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_ENABLE
+    if ((aError == kErrorNone) && aFrame.GetFramePending() && neighbor->IsCslSynchronized() &&
+        (neighbor->GetIndirectMessageCount() > 0) && (mBurstFrameCount < kMaxCslTxBurstFrames))
+    {
+        // The CSL receiver stays ready to receive after acking a frame
+        // with the frame pending bit set, so keep draining its queued
+        // frames back-to-back within the same receive window instead of
+        // spreading them across multiple CSL sample windows.
+        mBurstFrameCount++;
+        mCslTxNeighbor = neighbor;
+        Get<Mac::Mac>().RequestCslFrameTransmission(0);
+    }
+#endif
+
 exit:
-    RescheduleCslTx();
+    if (mCslTxNeighbor == nullptr)
+    {
+        RescheduleCslTx();
+    }
 }
 
 void CslTxScheduler::HandleSentFrame(const Mac::TxFrame &aFrame, Error aError, CslNeighbor &aCslNeighbor)
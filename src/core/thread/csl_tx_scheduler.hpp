@@ -186,6 +186,10 @@ private:
     // Guard time in usec to add when checking delay while preparing the CSL frame for tx.
     static constexpr uint32_t kFramePreparationGuardInterval = 1500;
 
+#if OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_ENABLE
+    static constexpr uint8_t kMaxCslTxBurstFrames = OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_MAX_FRAMES;
+#endif
+
     typedef IndirectSenderBase::FrameContext FrameContext;
 
     void RescheduleCslTx(void);
@@ -203,6 +207,9 @@ private:
     uint32_t     mCslFrameRequestAheadUs;
     CslNeighbor *mCslTxNeighbor;
     Message     *mCslTxMessage;
+#if OPENTHREAD_CONFIG_MAC_CSL_TX_BURST_ENABLE
+    uint8_t mBurstFrameCount;
+#endif
     FrameContext mFrameContext;
 };
 
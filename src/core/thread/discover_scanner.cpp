@@ -45,8 +45,10 @@ DiscoverScanner::DiscoverScanner(Instance &aInstance)
     , mFilterIndexes()
     , mState(kStateIdle)
     , mScanChannel(0)
+    , mPreferredChannel(0)
     , mEnableFiltering(false)
     , mShouldRestorePanId(false)
+    , mScanningPreferredChannel(false)
 #if OPENTHREAD_CONFIG_JOINER_ADV_EXPERIMENTAL_ENABLE
     , mAdvDataLength(0)
 #endif
@@ -144,8 +146,35 @@ Error DiscoverScanner::Discover(const Mac::ChannelMask &aScanChannels,
         mShouldRestorePanId = true;
     }
 
-    mScanChannel = Mac::ChannelMask::kChannelIteratorFirst;
-    mState       = (mScanChannels.GetNextChannel(mScanChannel) == kErrorNone) ? kStateScanning : kStateScanDone;
+    // Start the scan on the channel where a Thread network was last
+    // discovered (persisted in `Settings`). On a stable deployment this
+    // typically turns discovery into a single-channel probe; the
+    // remaining channels are still scanned afterwards.
+
+    mPreferredChannel         = 0;
+    mScanningPreferredChannel = false;
+
+    {
+        uint8_t channel;
+
+        if ((Get<Settings>().Read<Settings::DiscoverChannel>(channel) == kErrorNone) &&
+            mScanChannels.ContainsChannel(channel))
+        {
+            mPreferredChannel         = channel;
+            mScanningPreferredChannel = true;
+        }
+    }
+
+    if (mScanningPreferredChannel)
+    {
+        mScanChannel = mPreferredChannel;
+        mState       = kStateScanning;
+    }
+    else
+    {
+        mScanChannel = Mac::ChannelMask::kChannelIteratorFirst;
+        mState       = (mScanChannels.GetNextChannel(mScanChannel) == kErrorNone) ? kStateScanning : kStateScanDone;
+    }
 
     // For rx-off-when-idle device, temporarily enable receiver during discovery procedure.
     if (!Get<Mle>().IsDisabled() && !Get<Mle>().IsRxOnWhenIdle())
@@ -301,7 +330,7 @@ void DiscoverScanner::HandleTimer(void)
     // frame tx is aborted  from `PrepareDiscoveryRequestFrame()` and
     // then wraps up the scan (invoking handler callback).
 
-    if (mScanChannels.GetNextChannel(mScanChannel) != kErrorNone)
+    if (SelectNextScanChannel() != kErrorNone)
     {
         mState = kStateScanDone;
     }
@@ -312,6 +341,32 @@ exit:
     return;
 }
 
+Error DiscoverScanner::SelectNextScanChannel(void)
+{
+    Error error;
+
+    if (mScanningPreferredChannel)
+    {
+        // The preferred channel was probed first (outside the mask
+        // iteration order), so restart the iteration from the first
+        // channel in the mask.
+
+        mScanningPreferredChannel = false;
+        mScanChannel              = Mac::ChannelMask::kChannelIteratorFirst;
+    }
+
+    error = mScanChannels.GetNextChannel(mScanChannel);
+
+    // Skip the preferred channel which was already scanned first.
+
+    if ((error == kErrorNone) && (mPreferredChannel != 0) && (mScanChannel == mPreferredChannel))
+    {
+        error = mScanChannels.GetNextChannel(mScanChannel);
+    }
+
+    return error;
+}
+
 void DiscoverScanner::HandleDiscoveryResponse(Mle::RxInfo &aRxInfo) const
 {
     Error                              error = kErrorNone;
@@ -341,6 +396,31 @@ void DiscoverScanner::HandleDiscoveryResponse(Mle::RxInfo &aRxInfo) const
 
     AsCoreType(&result.mExtAddress).SetFromIid(aRxInfo.mMessageInfo.GetPeerAddr().GetIid());
 
+    // Steering Data (optional). Parsed first so that, when filtering is
+    // enabled, the joiner ID check against the steering data bloom
+    // filter can drop responses from networks that exclude this device
+    // before the remaining TLVs are parsed.
+
+    switch (MeshCoP::SteeringDataTlv::FindIn(aRxInfo.mMessage, steeringData))
+    {
+    case kErrorNone:
+        AsCoreType(&result.mSteeringData) = steeringData;
+
+        if (mEnableFiltering)
+        {
+            VerifyOrExit(steeringData.Contains(mFilterIndexes));
+        }
+
+        break;
+
+    case kErrorNotFound:
+        VerifyOrExit(!mEnableFiltering);
+        break;
+
+    default:
+        ExitNow(error = kErrorParse);
+    }
+
     // Required TLVs
 
     SuccessOrExit(error = Tlv::Find<MeshCoP::DiscoveryResponseTlv>(aRxInfo.mMessage, respTlvValue));
@@ -363,25 +443,11 @@ void DiscoverScanner::HandleDiscoveryResponse(Mle::RxInfo &aRxInfo) const
         ExitNow(error = kErrorParse);
     }
 
-    switch (MeshCoP::SteeringDataTlv::FindIn(aRxInfo.mMessage, steeringData))
-    {
-    case kErrorNone:
-        AsCoreType(&result.mSteeringData) = steeringData;
-
-        if (mEnableFiltering)
-        {
-            VerifyOrExit(steeringData.Contains(mFilterIndexes));
-        }
-
-        break;
-
-    case kErrorNotFound:
-        VerifyOrExit(!mEnableFiltering);
-        break;
+    // Remember the channel of the successfully parsed response so the
+    // next discovery starts its scan there. The settings entry is only
+    // written when the channel actually changes.
 
-    default:
-        ExitNow(error = kErrorParse);
-    }
+    Get<Settings>().Save<Settings::DiscoverChannel>(result.mChannel);
 
     mCallback.InvokeIfSet(&result);
 
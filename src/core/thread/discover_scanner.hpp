@@ -154,6 +154,7 @@ private:
     // Methods used from `Mle`
     void HandleDiscoveryResponse(Mle::RxInfo &aRxInfo) const;
 
+    Error       SelectNextScanChannel(void);
     void        HandleDiscoverComplete(void);
     void        HandleScanDoneTask(void);
     void        HandleTimer(void);
@@ -170,8 +171,10 @@ private:
     Mac::ChannelMask         mScanChannels;
     State                    mState;
     uint8_t                  mScanChannel;
+    uint8_t                  mPreferredChannel;
     bool                     mEnableFiltering : 1;
     bool                     mShouldRestorePanId : 1;
+    bool                     mScanningPreferredChannel : 1;
 #if OPENTHREAD_CONFIG_JOINER_ADV_EXPERIMENTAL_ENABLE
     uint8_t  mAdvDataLength;
     uint8_t  mAdvData[kMaxAdvDataLength];
@@ -44,15 +44,12 @@ RegisterLogModule("DuaManager");
 DuaManager::DuaManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mRegistrationTask(aInstance)
-    , mIsDuaPending(false)
+    , mPendingTxCount(0)
 #if OPENTHREAD_CONFIG_DUA_ENABLE
     , mDuaState(kNotExist)
     , mDadCounter(0)
     , mLastRegistrationTime(0)
 #endif
-#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
-    , mChildIndexDuaRegistering(Mle::kMaxChildren)
-#endif
 {
     mDelay.mValue = 0;
 
@@ -64,6 +61,7 @@ DuaManager::DuaManager(Instance &aInstance)
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
     mChildDuaMask.Clear();
     mChildDuaRegisteredMask.Clear();
+    mChildDuaRegisteringMask.Clear();
 #endif
 }
 
@@ -71,7 +69,7 @@ void DuaManager::HandleDomainPrefixUpdate(BackboneRouter::DomainPrefixEvent aEve
 {
     if ((aEvent == BackboneRouter::kDomainPrefixRemoved) || (aEvent == BackboneRouter::kDomainPrefixRefreshed))
     {
-        if (mIsDuaPending)
+        if (mPendingTxCount > 0)
         {
             IgnoreError(Get<Tmf::Agent>().AbortTransaction(HandleDuaResponse, this));
         }
@@ -85,6 +83,7 @@ void DuaManager::HandleDomainPrefixUpdate(BackboneRouter::DomainPrefixEvent aEve
         {
             mChildDuaMask.Clear();
             mChildDuaRegisteredMask.Clear();
+            mChildDuaRegisteringMask.Clear();
         }
 #endif
     }
@@ -225,7 +224,7 @@ void DuaManager::AddDomainUnicastAddress(void)
 
 void DuaManager::RemoveDomainUnicastAddress(void)
 {
-    if (mDuaState == kRegistering && mIsDuaPending)
+    if (mDuaState == kRegistering && mPendingTxCount > 0)
     {
         IgnoreError(Get<Tmf::Agent>().AbortTransaction(HandleDuaResponse, this));
     }
@@ -418,16 +417,13 @@ void DuaManager::UpdateTimeTickerRegistration(void)
 
 void DuaManager::PerformNextRegistration(void)
 {
-    Error          error   = kErrorNone;
-    Coap::Message *message = nullptr;
-    Ip6::Address   dua;
-    Ip6::Address   destAddr;
+    Error error = kErrorNone;
 
     VerifyOrExit(Get<Mle::Mle>().IsAttached());
     VerifyOrExit(Get<BackboneRouter::Leader>().HasPrimary());
 
-    // Only allow one outgoing DUA.req
-    VerifyOrExit(!mIsDuaPending);
+    // Allow up to `kMaxParallelRegistrations` outgoing DUA.req
+    VerifyOrExit(mPendingTxCount < kMaxParallelRegistrations);
 
     // Only send DUA.req when necessary
 #if OPENTHREAD_CONFIG_DUA_ENABLE
@@ -439,63 +435,58 @@ void DuaManager::PerformNextRegistration(void)
     }
 #endif
     VerifyOrExit(Get<Mle::Mle>().IsFullThreadDevice() || Get<Mle::Mle>().GetParent().IsThreadVersion1p1());
-#endif // OPENTHREAD_CONFIG_DUA_ENABLE
-
-    {
-        bool needReg = false;
 
-#if OPENTHREAD_CONFIG_DUA_ENABLE
-        needReg = (mDuaState == kToRegister && mDelay.mFields.mRegistrationDelay == 0);
-#endif
-
-#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
-        needReg = needReg || (!mChildDuaMask.IsEmpty() && mChildDuaMask != mChildDuaRegisteredMask);
-#endif
-        VerifyOrExit(needReg);
-    }
-
-    // Prepare DUA.req
-    message = Get<Tmf::Agent>().AllocateAndInitPriorityConfirmablePostMessage(kUriDuaRegistrationRequest);
-    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
-
-#if OPENTHREAD_CONFIG_DUA_ENABLE
     if (mDuaState == kToRegister && mDelay.mFields.mRegistrationDelay == 0)
     {
-        dua = GetDomainUnicastAddress();
-        SuccessOrExit(error = Tlv::Append<ThreadTargetTlv>(*message, dua));
-        SuccessOrExit(error = Tlv::Append<ThreadMeshLocalEidTlv>(*message, Get<Mle::Mle>().GetMeshLocalEid().GetIid()));
+        SuccessOrExit(
+            error = SendDuaRegistration(GetDomainUnicastAddress(), Get<Mle::Mle>().GetMeshLocalEid().GetIid(),
+                                        /* aLastTransactionTime */ nullptr));
         mDuaState             = kRegistering;
         mLastRegistrationTime = TimerMilli::GetNow();
     }
-    else
 #endif // OPENTHREAD_CONFIG_DUA_ENABLE
-    {
+
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
-        uint32_t lastTransactionTime;
-        Child   *child = nullptr;
+    // Pipeline the proxy registrations for children's DUAs, keeping
+    // up to `kMaxParallelRegistrations` DUA.req transactions in
+    // flight rather than waiting for each response before sending
+    // the next request.
 
-        OT_ASSERT(mChildIndexDuaRegistering == Mle::kMaxChildren);
+    while (mPendingTxCount < kMaxParallelRegistrations)
+    {
+        Child *child = SelectChildToRegister();
 
-        for (Child &iter : Get<ChildTable>().Iterate(Child::kInStateValid))
-        {
-            uint16_t childIndex = Get<ChildTable>().GetChildIndex(iter);
+        VerifyOrExit(child != nullptr);
+        SuccessOrExit(error = SendChildDuaRegistration(*child));
+    }
+#endif
 
-            if (mChildDuaMask.Has(childIndex) && !mChildDuaRegisteredMask.Has(childIndex))
-            {
-                mChildIndexDuaRegistering = childIndex;
-                break;
-            }
-        }
+exit:
+    if (error == kErrorNoBufs)
+    {
+        UpdateCheckDelay(kNoBufDelay);
+    }
 
-        child = Get<ChildTable>().GetChildAtIndex(mChildIndexDuaRegistering);
-        SuccessOrAssert(child->GetDomainUnicastAddress(dua));
+    LogWarnOnError(error, "perform next registration");
+}
 
-        SuccessOrExit(error = Tlv::Append<ThreadTargetTlv>(*message, dua));
-        SuccessOrExit(error = Tlv::Append<ThreadMeshLocalEidTlv>(*message, child->GetMeshLocalIid()));
+Error DuaManager::SendDuaRegistration(const Ip6::Address             &aDua,
+                                      const Ip6::InterfaceIdentifier &aMlIid,
+                                      const uint32_t                 *aLastTransactionTime)
+{
+    Error          error   = kErrorNone;
+    Coap::Message *message = nullptr;
+    Ip6::Address   destAddr;
 
-        lastTransactionTime = Time::MsecToSec(TimerMilli::GetNow() - child->GetLastHeard());
-        SuccessOrExit(error = Tlv::Append<ThreadLastTransactionTimeTlv>(*message, lastTransactionTime));
-#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
+    message = Get<Tmf::Agent>().AllocateAndInitPriorityConfirmablePostMessage(kUriDuaRegistrationRequest);
+    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+
+    SuccessOrExit(error = Tlv::Append<ThreadTargetTlv>(*message, aDua));
+    SuccessOrExit(error = Tlv::Append<ThreadMeshLocalEidTlv>(*message, aMlIid));
+
+    if (aLastTransactionTime != nullptr)
+    {
+        SuccessOrExit(error = Tlv::Append<ThreadLastTransactionTimeTlv>(*message, *aLastTransactionTime));
     }
 
     if (!Get<Mle::Mle>().IsFullThreadDevice() && Get<Mle::Mle>().GetParent().IsThreadVersion1p1())
@@ -512,8 +503,8 @@ void DuaManager::PerformNextRegistration(void)
 
     SuccessOrExit(error = Get<Tmf::Agent>().SendMessageTo(*message, destAddr, HandleDuaResponse, this));
 
-    mIsDuaPending   = true;
-    mRegisteringDua = dua;
+    mPendingTxCount++;
+    mRegisteringDua = aDua;
     mDelay.mValue   = 0;
 
     // Generally Thread 1.2 Router would send DUA.req on behalf for DUA registered by its MTD child.
@@ -524,25 +515,76 @@ void DuaManager::PerformNextRegistration(void)
         Get<DataPollSender>().SendFastPolls();
     }
 
-    LogInfo("Sent %s for DUA %s", UriToString<kUriDuaRegistrationRequest>(), dua.ToString().AsCString());
+    LogInfo("Sent %s for DUA %s", UriToString<kUriDuaRegistrationRequest>(), aDua.ToString().AsCString());
 
 exit:
-    if (error == kErrorNoBufs)
+    FreeMessageOnError(message, error);
+    return error;
+}
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
+Child *DuaManager::SelectChildToRegister(void)
+{
+    // Select the next child to register a DUA for, prioritizing the
+    // child heard from most recently (most likely to have active
+    // traffic, including backbone-originated flows).
+
+    Child *best = nullptr;
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
     {
-        UpdateCheckDelay(kNoBufDelay);
+        uint16_t childIndex = Get<ChildTable>().GetChildIndex(child);
+
+        if (!mChildDuaMask.Has(childIndex) || mChildDuaRegisteredMask.Has(childIndex) ||
+            mChildDuaRegisteringMask.Has(childIndex))
+        {
+            continue;
+        }
+
+        if ((best == nullptr) || (child.GetLastHeard() > best->GetLastHeard()))
+        {
+            best = &child;
+        }
     }
 
-    LogWarnOnError(error, "perform next registration");
-    FreeMessageOnError(message, error);
+    return best;
+}
+
+Error DuaManager::SendChildDuaRegistration(Child &aChild)
+{
+    Error        error;
+    Ip6::Address dua;
+    uint32_t     lastTransactionTime;
+
+    SuccessOrAssert(aChild.GetDomainUnicastAddress(dua));
+
+    lastTransactionTime = Time::MsecToSec(TimerMilli::GetNow() - aChild.GetLastHeard());
+    SuccessOrExit(error = SendDuaRegistration(dua, aChild.GetMeshLocalIid(), &lastTransactionTime));
+
+    mChildDuaRegisteringMask.Add(Get<ChildTable>().GetChildIndex(aChild));
+
+exit:
+    return error;
 }
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
 
 void DuaManager::HandleDuaResponse(Coap::Msg *aMsg, Error aResult)
 {
     Error error;
 
-    mIsDuaPending = false;
+    if (mPendingTxCount > 0)
+    {
+        mPendingTxCount--;
+    }
+
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
-    mChildIndexDuaRegistering = Mle::kMaxChildren;
+    if (aResult != kErrorNone)
+    {
+        // A timed out or aborted transaction cannot be attributed to
+        // a specific child, so clear the whole "registering" mask to
+        // let all children with unconfirmed registrations be retried.
+        mChildDuaRegisteringMask.Clear();
+    }
 #endif
 
     if (aResult == kErrorResponseTimeout)
@@ -651,6 +693,7 @@ Error DuaManager::ProcessDuaResponse(Coap::Message &aMessage)
         VerifyOrExit(child != nullptr, error = kErrorNotFound);
 
         childIndex = Get<ChildTable>().GetChildIndex(*child);
+        mChildDuaRegisteringMask.Remove(childIndex);
 
         switch (status)
         {
@@ -726,8 +769,9 @@ void DuaManager::HandleChildDuaAddressEvent(const Child &aChild, ChildDuaAddress
 
     if ((aEvent == kAddressRemoved || aEvent == kAddressChanged) && mChildDuaMask.Has(childIndex))
     {
-        // Abort on going proxy DUA.req for this child
-        if (mChildIndexDuaRegistering == childIndex)
+        // Abort ongoing proxy DUA.req for this child (along with any
+        // other in-flight DUA.req which will then be retried).
+        if (mChildDuaRegisteringMask.Has(childIndex))
         {
             IgnoreError(Get<Tmf::Agent>().AbortTransaction(HandleDuaResponse, this));
         }
@@ -200,6 +200,13 @@ private:
     static constexpr uint8_t  kNewRouterRegistrationDelay = 3;   // Delay (in sec) to establish link for a new router.
     static constexpr uint8_t  kNewDuaRegistrationDelay    = 1;   // Delay (in sec) for newly added DUA.
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
+    // Maximum number of DUA.req transactions in flight in parallel.
+    static constexpr uint8_t kMaxParallelRegistrations = OPENTHREAD_CONFIG_TMF_PROXY_DUA_MAX_PARALLEL_REGISTRATIONS;
+#else
+    static constexpr uint8_t kMaxParallelRegistrations = 1;
+#endif
+
 #if OPENTHREAD_CONFIG_DUA_ENABLE
     Error GenerateDomainUnicastAddressIid(void);
     void  Store(void);
@@ -210,9 +217,17 @@ private:
 #endif
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
-    void SendAddressNotification(Ip6::Address &aAddress, DuaStatus aStatus, const Child &aChild);
+    void   SendAddressNotification(Ip6::Address &aAddress, DuaStatus aStatus, const Child &aChild);
+    Child *SelectChildToRegister(void);
+    Error  SendChildDuaRegistration(Child &aChild);
 #endif
 
+    Error SendDuaRegistration(const Ip6::Address             &aDua,
+                              const Ip6::InterfaceIdentifier &aMlIid,
+                              const uint32_t                 *aLastTransactionTime);
+
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged | kEventThreadRoleChanged | kEventIp6AddressAdded;
+
     void HandleNotifierEvents(Events aEvents);
 
     void HandleTimeTick(void);
@@ -233,7 +248,7 @@ private:
 
     RegistrationTask mRegistrationTask;
     Ip6::Address     mRegisteringDua;
-    bool             mIsDuaPending : 1;
+    uint8_t          mPendingTxCount; // Number of DUA.req transactions in flight.
 
 #if OPENTHREAD_CONFIG_DUA_ENABLE
     enum DuaState : uint8_t
@@ -268,9 +283,9 @@ private:
     // TODO: (DUA) may re-evaluate the alternative option of distributing the flags into the child table:
     //       - Child class itself have some padding - may save some RAM
     //       - Avoid cross reference between a bit-vector and the child entry
-    ChildMask mChildDuaMask;             // Child Mask for child who registers DUA via Child Update Request.
-    ChildMask mChildDuaRegisteredMask;   // Child Mask for child's DUA that was registered by the parent on behalf.
-    uint16_t  mChildIndexDuaRegistering; // Child Index of the DUA being registered.
+    ChildMask mChildDuaMask;            // Child Mask for child who registers DUA via Child Update Request.
+    ChildMask mChildDuaRegisteredMask;  // Child Mask for child's DUA that was registered by the parent on behalf.
+    ChildMask mChildDuaRegisteringMask; // Child Mask for child's DUA with a DUA.req in flight.
 #endif
 };
 
@@ -76,6 +76,8 @@ private:
     static void HandleScanResult(Mac::EnergyScanResult *aResult, void *aContext);
     void        HandleScanResult(Mac::EnergyScanResult *aResult);
     void        HandleTimer(void);
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged;
+
     void        HandleNotifierEvents(Events aEvents);
     void        SendReport(void);
 
@@ -75,6 +75,7 @@ void IndirectSender::Stop(void)
     {
         child.SetIndirectMessage(nullptr);
         mSourceMatchController.ResetMessageCount(child);
+        child.ResetIndirectQueuedBytes();
     }
 
     mDataPollHandler.Clear();
@@ -101,6 +102,7 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
 
     aMessage.GetIndirectTxChildMask().Add(childIndex);
     mSourceMatchController.IncrementMessageCount(aChild);
+    aChild.IncreaseIndirectQueuedBytes(aMessage.GetLength());
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
     {
@@ -128,6 +130,7 @@ Error IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &aCh
 
     aMessage.GetIndirectTxChildMask().Remove(childIndex);
     mSourceMatchController.DecrementMessageCount(aChild);
+    aChild.DecreaseIndirectQueuedBytes(aMessage.GetLength());
 
     RequestMessageUpdate(aChild);
 
@@ -148,6 +151,7 @@ void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 
     aChild.SetIndirectMessage(nullptr);
     mSourceMatchController.ResetMessageCount(aChild);
+    aChild.ResetIndirectQueuedBytes();
 
     mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
@@ -163,6 +167,8 @@ const Message *IndirectSender::FindQueuedMessageForSleepyChild(const Child &aChi
     const Message *match      = nullptr;
     uint16_t       childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
+    VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
+
     for (const Message &message : Get<MeshForwarder>().mSendQueue)
     {
         if (message.GetIndirectTxChildMask().Has(childIndex) && aChecker(message))
@@ -172,6 +178,7 @@ const Message *IndirectSender::FindQueuedMessageForSleepyChild(const Child &aChi
         }
     }
 
+exit:
     return match;
 }
 
@@ -211,6 +218,7 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 
         aChild.SetIndirectMessage(nullptr);
         mSourceMatchController.ResetMessageCount(aChild);
+        aChild.ResetIndirectQueuedBytes();
 
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
@@ -496,6 +504,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         {
             message->GetIndirectTxChildMask().Remove(childIndex);
             mSourceMatchController.DecrementMessageCount(aChild);
+            aChild.DecreaseIndirectQueuedBytes(message->GetLength());
         }
 
         message->InvokeTxCallback(txError);
@@ -100,6 +100,13 @@ public:
          */
         uint16_t GetIndirectMessageCount(void) const { return mQueuedMessageCount; }
 
+        /**
+         * Returns the total number of bytes in queued messages for the child.
+         *
+         * @returns Total number of bytes in queued messages for the child.
+         */
+        uint32_t GetIndirectQueuedBytes(void) const { return mQueuedMessageBytes; }
+
     private:
         Message *GetIndirectMessage(void) { return mIndirectMessage; }
         void     SetIndirectMessage(Message *aMessage) { mIndirectMessage = aMessage; }
@@ -120,6 +127,10 @@ public:
         void DecrementIndirectMessageCount(void) { mQueuedMessageCount--; }
         void ResetIndirectMessageCount(void) { mQueuedMessageCount = 0; }
 
+        void IncreaseIndirectQueuedBytes(uint16_t aLength) { mQueuedMessageBytes += aLength; }
+        void DecreaseIndirectQueuedBytes(uint16_t aLength) { mQueuedMessageBytes -= aLength; }
+        void ResetIndirectQueuedBytes(void) { mQueuedMessageBytes = 0; }
+
         bool IsWaitingForMessageUpdate(void) const { return mWaitingForMessageUpdate; }
         void SetWaitingForMessageUpdate(bool aNeedsUpdate) { mWaitingForMessageUpdate = aNeedsUpdate; }
 
@@ -132,6 +143,7 @@ public:
         uint16_t mQueuedMessageCount : 14;     // Number of queued indirect messages for the child.
         bool     mUseShortAddress : 1;         // Indicates whether to use short or extended address.
         bool     mSourceMatchPending : 1;      // Indicates whether or not pending to add to src match table.
+        uint32_t mQueuedMessageBytes;          // Total bytes in queued indirect messages for the child.
 
         static_assert(OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS < (1UL << 14),
                       "mQueuedMessageCount cannot fit max required!");
@@ -173,6 +173,7 @@ KeyManager::KeyManager(Instance &aInstance)
     , mKeySwitchGuardTime(kDefaultKeySwitchGuardTime)
     , mKeySwitchGuardTimer(0)
     , mKeyRotationTimer(aInstance)
+    , mPrepareKeysTask(aInstance)
     , mKekFrameCounter(0)
     , mIsPskcSet(false)
 {
@@ -187,6 +188,7 @@ KeyManager::KeyManager(Instance &aInstance)
 #endif
 
     mMacFrameCounters.Reset();
+    mPreparedKeys.Invalidate();
 }
 
 void KeyManager::Init(void)
@@ -280,6 +282,7 @@ void KeyManager::SetNetworkKey(const NetworkKey &aNetworkKey)
     Get<Notifier>().Signal(kEventThreadKeySeqCounterChanged);
 
     mKeySequence = 0;
+    mPreparedKeys.Invalidate();
     UpdateKeyMaterial();
     ResetFrameCounters();
 
@@ -329,13 +332,40 @@ void KeyManager::ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aKey) const
 }
 #endif
 
+void KeyManager::PrepareKeys(uint32_t aKeySequence)
+{
+    mPreparedKeys.mKeySequence = aKeySequence;
+
+    ComputeKeys(aKeySequence, mPreparedKeys.mHashKeys[PreparedKeys::kCurKey]);
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+    // Also derive the adjacent sequence keys used for out-of-window
+    // frame acceptance.
+    ComputeKeys(aKeySequence - 1, mPreparedKeys.mHashKeys[PreparedKeys::kPrevKey]);
+    ComputeKeys(aKeySequence + 1, mPreparedKeys.mHashKeys[PreparedKeys::kNextKey]);
+#endif
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    ComputeTrelKey(aKeySequence, mPreparedKeys.mTrelKey);
+#endif
+
+    mPreparedKeys.mIsValid = true;
+}
+
+void KeyManager::HandlePrepareKeysTask(void) { PrepareKeys(mKeySequence + 1); }
+
 void KeyManager::UpdateKeyMaterial(void)
 {
-    HashKeys hashKeys;
+    // Use the pre-derived material when it matches the current key
+    // sequence (prepared ahead of the rotation boundary), otherwise
+    // derive it now.
 
-    ComputeKeys(mKeySequence, hashKeys);
+    if (!mPreparedKeys.mIsValid || (mPreparedKeys.mKeySequence != mKeySequence))
+    {
+        PrepareKeys(mKeySequence);
+    }
 
-    mMleKey.SetFrom(hashKeys.GetMleKey());
+    mMleKey.SetFrom(mPreparedKeys.mHashKeys[PreparedKeys::kCurKey].GetMleKey());
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
     {
@@ -343,26 +373,20 @@ void KeyManager::UpdateKeyMaterial(void)
         Mac::KeyMaterial prevKey;
         Mac::KeyMaterial nextKey;
 
-        curKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
-
-        ComputeKeys(mKeySequence - 1, hashKeys);
-        prevKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
-
-        ComputeKeys(mKeySequence + 1, hashKeys);
-        nextKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
+        curKey.SetFrom(mPreparedKeys.mHashKeys[PreparedKeys::kCurKey].GetMacKey(), kExportableMacKeys);
+        prevKey.SetFrom(mPreparedKeys.mHashKeys[PreparedKeys::kPrevKey].GetMacKey(), kExportableMacKeys);
+        nextKey.SetFrom(mPreparedKeys.mHashKeys[PreparedKeys::kNextKey].GetMacKey(), kExportableMacKeys);
 
         Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1, prevKey, curKey, nextKey);
     }
 #endif
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
-    {
-        Mac::Key key;
-
-        ComputeTrelKey(mKeySequence, key);
-        mTrelKey.SetFrom(key);
-    }
+    mTrelKey.SetFrom(mPreparedKeys.mTrelKey);
 #endif
+
+    // Wipe the raw derived material now that it is swapped in.
+    mPreparedKeys.Invalidate();
 }
 
 void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence, KeySeqUpdateFlags aFlags)
@@ -560,6 +584,16 @@ void KeyManager::HandleKeyRotationTimer(void)
     }
 
     CheckForKeyRotation();
+
+    // One hour ahead of the rotation boundary, pre-derive the next
+    // key sequence's material from a tasklet (idle time), so the
+    // rotation itself only hot-swaps the already-derived keys. All
+    // neighbors rotate nearly simultaneously, and deriving the keys
+    // synchronously at the boundary adds to the latency blip.
+    if ((mHoursSinceKeyRotation + 1 >= mSecurityPolicy.mRotationTime) && !mPreparedKeys.mIsValid)
+    {
+        mPrepareKeysTask.Post();
+    }
 }
 
 void KeyManager::CheckForKeyRotation(void)
@@ -684,6 +718,7 @@ void KeyManager::SetNetworkKeyRef(otNetworkKeyRef aKeyRef)
     Get<Notifier>().Signal(kEventNetworkKeyChanged);
     Get<Notifier>().Signal(kEventThreadKeySeqCounterChanged);
     mKeySequence = 0;
+    mPreparedKeys.Invalidate();
     UpdateKeyMaterial();
     ResetFrameCounters();
 
@@ -695,6 +730,7 @@ void KeyManager::DestroyTemporaryKeys(void)
 {
     mMleKey.Clear();
     mKek.Clear();
+    mPreparedKeys.Invalidate();
     Get<Mac::SubMac>().ClearMacKeys();
 }
 
@@ -48,6 +48,7 @@
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/random.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "crypto/hmac_sha256.hpp"
 #include "mac/mac_types.hpp"
@@ -580,12 +581,38 @@ private:
         const Mac::Key &GetMacKey(void) const { return mKeys.mMacKey; }
     };
 
+    // Holds key material derived ahead of time (during idle time
+    // before the rotation boundary) so that the switchover itself
+    // only swaps the already-derived keys in. The raw material is
+    // wiped once consumed.
+    struct PreparedKeys
+    {
+        enum Index : uint8_t
+        {
+            kPrevKey, // Keys for sequence `mKeySequence - 1`.
+            kCurKey,  // Keys for sequence `mKeySequence`.
+            kNextKey, // Keys for sequence `mKeySequence + 1`.
+            kNumKeys,
+        };
+
+        void Invalidate(void) { ClearAllBytes(*this); }
+
+        bool     mIsValid;
+        uint32_t mKeySequence;
+        HashKeys mHashKeys[kNumKeys];
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+        Mac::Key mTrelKey;
+#endif
+    };
+
     void ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys) const;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     void ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aKey) const;
 #endif
 
+    void PrepareKeys(uint32_t aKeySequence);
+    void HandlePrepareKeysTask(void);
     void ResetKeyRotationTimer(void);
     void HandleKeyRotationTimer(void);
     void CheckForKeyRotation(void);
@@ -597,7 +624,8 @@ private:
 
     void ResetFrameCounters(void);
 
-    using RotationTimer = TimerMilliIn<KeyManager, &KeyManager::HandleKeyRotationTimer>;
+    using RotationTimer   = TimerMilliIn<KeyManager, &KeyManager::HandleKeyRotationTimer>;
+    using PrepareKeysTask = TaskletIn<KeyManager, &KeyManager::HandlePrepareKeysTask>;
 
     static const uint8_t kThreadString[];
 
@@ -630,10 +658,12 @@ private:
     uint32_t               mStoredMacFrameCounter;
     uint32_t               mStoredMleFrameCounter;
 
-    uint16_t      mHoursSinceKeyRotation;
-    uint16_t      mKeySwitchGuardTime;
-    uint16_t      mKeySwitchGuardTimer;
-    RotationTimer mKeyRotationTimer;
+    uint16_t        mHoursSinceKeyRotation;
+    uint16_t        mKeySwitchGuardTime;
+    uint16_t        mKeySwitchGuardTimer;
+    RotationTimer   mKeyRotationTimer;
+    PreparedKeys    mPreparedKeys;
+    PrepareKeysTask mPrepareKeysTask;
 
 #if OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
     PskcRef mPskcRef;
@@ -62,22 +62,67 @@ void Context::InitFrom(const NetworkData::PrefixTlv &aPrefixTlv, const NetworkDa
 
 Lowpan::Lowpan(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mContextCacheLength(0)
+    , mContextCacheWriteIndex(0)
 {
 }
 
+void Lowpan::HandleNotifierEvents(Events aEvents)
+{
+    if (aEvents.ContainsAny(kEventThreadNetdataChanged | kEventThreadMeshLocalAddrChanged))
+    {
+        // Cached context lookups are derived from network data and the
+        // mesh-local prefix (context 0) and may be stale now.
+
+        mContextCacheLength     = 0;
+        mContextCacheWriteIndex = 0;
+    }
+}
+
 void Lowpan::FindContextForId(uint8_t aContextId, Context &aContext) const
 {
     Get<NetworkData::Leader>().FindContextForId(aContextId, aContext);
 }
 
-void Lowpan::FindContextToCompressAddress(const Ip6::Address &aIp6Address, Context &aContext) const
+void Lowpan::FindContextToCompressAddress(const Ip6::Address &aIp6Address, Context &aContext)
 {
+    ContextCacheEntry *entry;
+
+    // Devices commonly send bursts of packets to the same few
+    // addresses, while the prefix match against network data is
+    // comparatively costly, so recent lookup results are cached. The
+    // cache is cleared in `HandleNotifierEvents()` when network data
+    // or the mesh-local prefix changes.
+
+    for (uint8_t index = 0; index < mContextCacheLength; index++)
+    {
+        if (mContextCache[index].mAddress == aIp6Address)
+        {
+            aContext = mContextCache[index].mContext;
+            ExitNow();
+        }
+    }
+
     Get<NetworkData::Leader>().FindContextForAddress(aIp6Address, aContext);
 
     if (!aContext.GetCompressFlag())
     {
         aContext.Clear();
     }
+
+    entry           = &mContextCache[mContextCacheWriteIndex];
+    entry->mAddress = aIp6Address;
+    entry->mContext = aContext;
+
+    mContextCacheWriteIndex = static_cast<uint8_t>((mContextCacheWriteIndex + 1) % kNumContextCacheEntries);
+
+    if (mContextCacheLength < kNumContextCacheEntries)
+    {
+        mContextCacheLength++;
+    }
+
+exit:
+    return;
 }
 
 Error Lowpan::ComputeIid(const Mac::Address &aMacAddr, const Context &aContext, Ip6::InterfaceIdentifier &aIid)
@@ -842,6 +887,7 @@ Error Lowpan::DecompressExtensionHeader(Message &aMessage, FrameData &aFrameData
     uint8_t        hdr[2];
     uint8_t        len;
     uint8_t        ctl;
+    const uint8_t *payload;
     Ip6::PadOption padOption;
 
     SuccessOrExit(aFrameData.ReadUint8(ctl));
@@ -869,9 +915,9 @@ Error Lowpan::DecompressExtensionHeader(Message &aMessage, FrameData &aFrameData
     aMessage.MoveOffset(sizeof(hdr));
 
     // payload
-    SuccessOrExit(aMessage.AppendBytes(aFrameData.GetBytes(), len));
+    SuccessOrExit(aFrameData.ReadBytesInPlace(payload, len));
+    SuccessOrExit(aMessage.AppendBytes(payload, len));
     aMessage.MoveOffset(len);
-    aFrameData.SkipOver(len);
 
     // The RFC6282 says: "The trailing Pad1 or PadN option MAY be elided by the compressor.
     // A decompressor MUST ensure that the containing header is padded out to a multiple of 8 octets
@@ -1174,6 +1220,18 @@ void MeshHeader::DecrementHopsLeft(void)
     }
 }
 
+void MeshHeader::UpdateHopsLeftIn(uint8_t *aFrame) const
+{
+    if ((aFrame[0] & kHopsLeftMask) == kDeepHopsLeft)
+    {
+        aFrame[1] = mHopsLeft;
+    }
+    else
+    {
+        aFrame[0] = (aFrame[0] & ~kHopsLeftMask) | (mHopsLeft & kHopsLeftMask);
+    }
+}
+
 Error MeshHeader::AppendTo(FrameBuilder &aFrameBuilder) const
 {
     Error   error;
@@ -43,6 +43,7 @@
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/notifier.hpp"
 #include "mac/mac_types.hpp"
 #include "net/ip6.hpp"
 #include "net/ip6_address.hpp"
@@ -137,6 +138,8 @@ private:
  */
 class Lowpan : public InstanceLocator, private NonCopyable
 {
+    friend class ot::Notifier;
+
 public:
     /**
      * Initializes the object.
@@ -307,8 +310,19 @@ private:
     static constexpr uint8_t kUdpChecksum = 1 << 2;
     static constexpr uint8_t kUdpPortMask = 3 << 0;
 
+    static constexpr uint8_t kNumContextCacheEntries = 4;
+
+    struct ContextCacheEntry
+    {
+        Ip6::Address mAddress;
+        Context      mContext;
+    };
+
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged | kEventThreadMeshLocalAddrChanged;
+
+    void  HandleNotifierEvents(Events aEvents);
     void  FindContextForId(uint8_t aContextId, Context &aContext) const;
-    void  FindContextToCompressAddress(const Ip6::Address &aIp6Address, Context &aContext) const;
+    void  FindContextToCompressAddress(const Ip6::Address &aIp6Address, Context &aContext);
     Error Compress(Message              &aMessage,
                    const Mac::Addresses &aMacAddrs,
                    FrameBuilder         &aFrameBuilder,
@@ -333,6 +347,10 @@ private:
     Error DispatchToNextHeader(uint8_t aDispatch, uint8_t &aNextHeader);
 
     static Error ComputeIid(const Mac::Address &aMacAddr, const Context &aContext, Ip6::InterfaceIdentifier &aIid);
+
+    ContextCacheEntry mContextCache[kNumContextCacheEntries];
+    uint8_t           mContextCacheLength;
+    uint8_t           mContextCacheWriteIndex;
 };
 
 /**
@@ -341,6 +359,9 @@ private:
 class MeshHeader
 {
 public:
+    static constexpr uint16_t kMaxHeaderLength = sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint16_t) +
+                                                 sizeof(uint8_t); ///< Maximum header length (with deep hops).
+
     /**
      * Initializes the Mesh Header with a given Mesh Source, Mesh Destination and Hops Left value.
      *
@@ -434,6 +455,18 @@ public:
      */
     void DecrementHopsLeft(void);
 
+    /**
+     * Writes the Hops Left value of this Mesh Header into an already serialized Mesh Header.
+     *
+     * The encoded header length is never changed: the deep-hops form is kept when the serialized header uses it,
+     * even if the new Hops Left value would fit the short form. This allows a forwarded frame's Mesh Header to be
+     * patched in place after `DecrementHopsLeft()` without re-serializing it.
+     *
+     * @param[in,out] aFrame   A pointer to the start of a serialized Mesh Header (MUST be previously validated,
+     *                         e.g., by a successful `ParseFrom()`).
+     */
+    void UpdateHopsLeftIn(uint8_t *aFrame) const;
+
     /**
      * Returns the Mesh Source address.
      *
@@ -479,7 +512,7 @@ private:
 
     // Dispatch byte + src + dest
     static constexpr uint16_t kMinHeaderLength      = sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint16_t);
-    static constexpr uint16_t kDeepHopsHeaderLength = kMinHeaderLength + sizeof(uint8_t); // min header + deep hops
+    static constexpr uint16_t kDeepHopsHeaderLength = kMaxHeaderLength; // min header + deep hops
 
     uint16_t mSource;
     uint16_t mDestination;
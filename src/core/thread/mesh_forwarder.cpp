@@ -64,29 +64,62 @@ void MeshForwarder::Counters::UpdateOnDrop(const Message &aMessage)
     }
 }
 
+void MeshForwarder::Counters::UpdateOnReassemblyDrop(const Message &aMessage)
+{
+    if (aMessage.GetType() == Message::kTypeIp6)
+    {
+        mRxReassemblyFailure++;
+    }
+
+    UpdateOnDrop(aMessage);
+}
+
 MeshForwarder::MeshForwarder(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMessageNextOffset(0)
     , mSendMessage(nullptr)
     , mMeshSource()
     , mMeshDest()
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+    , mTxFairnessBurstCount(0)
+    , mTxFairnessMaxBurst(OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_DEFAULT_MAX_BURST)
+#endif
     , mAddMeshHeader(false)
     , mEnabled(false)
     , mTxPaused(false)
     , mSendBusy(false)
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE
+    , mTxScheduling(false)
+#endif
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
     , mDelayNextTx(false)
     , mTxDelayTimer(aInstance)
 #endif
     , mScheduleTransmissionTask(aInstance)
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE
+    , mPreparedAheadMessage(nullptr)
+    , mPreparedAheadOffset(0)
+    , mPreparedAheadNextOffset(0)
+    , mPrepareAheadTask(aInstance)
+#endif
 #if OPENTHREAD_FTD || OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     , mIndirectSender(aInstance)
 #endif
     , mDataPollSender(aInstance)
 {
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_SCHEDULER_ENABLE
+    mScheduleTransmissionTask.SetPriority(Tasklet::kPriorityHigh);
+#endif
 #if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
     mTxQueueStats.Clear();
 #endif
+#if OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+    mReassemblyGapStats.Clear();
+#endif
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE
+    ClearAllBytes(mPreparedAheadFrame);
+    mPreparedAheadFrame.mPsdu = mPreparedAheadPsdu;
+#endif
 }
 
 void MeshForwarder::Start(void)
@@ -171,6 +204,15 @@ Error MeshForwarder::UpdateEcnOrDrop(Message &aMessage, bool aPreparingToSend)
 
     VerifyOrExit(aMessage.IsDirectTransmission() && (aMessage.GetOffset() == 0));
 
+    // For IPv6 messages, below the ECN-mark threshold neither
+    // marking nor dropping applies, so the header does not need to
+    // be read or parsed. This keeps the per-message cost of the
+    // queue scans negligible when the queues are not congested.
+    // 6LoWPAN messages are excluded since their fragment tracking
+    // must run regardless of the thresholds.
+
+    VerifyOrExit((aMessage.GetType() != Message::kTypeIp6) || shouldMarkEcn || (timeInQueue >= kTimeInQueueDropMsg));
+
     if (aMessage.GetType() == Message::kTypeIp6)
     {
         Ip6::Header ip6Header;
@@ -447,8 +489,36 @@ void MeshForwarder::TxQueueStats::UpdateFor(const Message &aMessage)
 }
 #endif
 
+void MeshForwarder::ScheduleTransmission(void)
+{
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE
+    if (!mTxScheduling && !mSendBusy && !mTxPaused && (mSendMessage == nullptr))
+    {
+        // The MAC is idle with no prepared transmission: prepare the
+        // frame synchronously, avoiding the tasklet round-trip
+        // latency. The `mTxScheduling` check avoids re-entering the
+        // scheduling task when a message is enqueued from within it
+        // (e.g., an ICMP error emitted during route determination).
+
+        ScheduleTransmissionTask();
+    }
+    else
+#endif
+    {
+        mScheduleTransmissionTask.Post();
+    }
+}
+
 void MeshForwarder::ScheduleTransmissionTask(void)
 {
+#if OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
+    Utils::Instrumentation::Scope scope(GetInstance(), Utils::Instrumentation::kSiteMeshForwarderTxPrepare);
+#endif
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE
+    mTxScheduling = true;
+#endif
+
     VerifyOrExit(!mSendBusy && !mTxPaused);
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
@@ -466,23 +536,42 @@ void MeshForwarder::ScheduleTransmissionTask(void)
     Get<Mac::Mac>().RequestDirectFrameTransmission();
 
 exit:
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE
+    mTxScheduling = false;
+#endif
     return;
 }
 
 Message *MeshForwarder::PrepareNextDirectTransmission(void)
 {
     Message *curMessage, *nextMessage;
-    Error    error = kErrorNone;
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+    Message *deferredMessage = nullptr;
+#endif
+    Error error = kErrorNone;
 
     for (curMessage = mSendQueue.GetHead(); curMessage; curMessage = nextMessage)
     {
         // We set the `nextMessage` here but it can be updated again
-        // after the `switch(message.GetType())` since it may be
-        // evicted during message processing (e.g., from the call to
-        // `UpdateIp6Route()` due to Address Solicit).
+        // after the route update since the message may be evicted
+        // during processing (e.g., from the call to `UpdateIp6Route()`
+        // due to Address Solicit).
 
         nextMessage = curMessage->GetNext();
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+        if ((deferredMessage != nullptr) && (curMessage->GetPriority() != deferredMessage->GetPriority()))
+        {
+            // Scanned past the deferred message's priority level
+            // without finding a same-priority candidate for a
+            // different destination; go with the deferred message
+            // rather than promoting lower priority traffic.
+
+            curMessage = nullptr;
+            break;
+        }
+#endif
+
         if (!curMessage->IsDirectTransmission() || curMessage->IsResolvingAddress())
         {
             continue;
@@ -494,34 +583,7 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
             continue;
         }
 #endif
-        curMessage->SetDoNotEvict(true);
-
-        switch (curMessage->GetType())
-        {
-        case Message::kTypeIp6:
-            error = UpdateIp6Route(*curMessage);
-            break;
-
-#if OPENTHREAD_FTD
-
-        case Message::kType6lowpan:
-            error = UpdateMeshRoute(*curMessage);
-            break;
-
-#endif
-
-#if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
-        case Message::kTypeMacEmptyData:
-            error = kErrorNone;
-            break;
-#endif
-
-        default:
-            error = kErrorDrop;
-            break;
-        }
-
-        curMessage->SetDoNotEvict(false);
+        error = UpdateRouteForMessage(*curMessage);
 
         // the next message may have been evicted during processing (e.g. due to Address Solicit)
         nextMessage = curMessage->GetNext();
@@ -538,6 +600,18 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
                 continue;
             }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+            if (ShouldDeferForTxFairness(*curMessage))
+            {
+                if (deferredMessage == nullptr)
+                {
+                    deferredMessage = curMessage;
+                }
+
+                continue;
+            }
+#endif
+
 #if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
             mTxQueueStats.UpdateFor(*curMessage);
 #endif
@@ -560,10 +634,120 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
         }
     }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+    if ((curMessage == nullptr) && (deferredMessage != nullptr))
+    {
+        // All other same-priority candidates were for the same
+        // destination (or not sendable). Re-run the route update for
+        // the deferred message (later candidates overwrote the MAC
+        // address and mesh header state) and use it, resetting the
+        // burst count so the destination gets a fresh round.
+
+        if (UpdateRouteForMessage(*deferredMessage) == kErrorNone)
+        {
+            curMessage            = deferredMessage;
+            mTxFairnessBurstCount = 0;
+#if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
+            mTxQueueStats.UpdateFor(*curMessage);
+#endif
+        }
+    }
+#endif
+
 exit:
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+    if (curMessage != nullptr)
+    {
+        UpdateTxFairnessOnSelect();
+    }
+#endif
+
     return curMessage;
 }
 
+Error MeshForwarder::UpdateRouteForMessage(Message &aMessage)
+{
+    Error error;
+
+    aMessage.SetDoNotEvict(true);
+
+    switch (aMessage.GetType())
+    {
+    case Message::kTypeIp6:
+        error = UpdateIp6Route(aMessage);
+        break;
+
+#if OPENTHREAD_FTD
+
+    case Message::kType6lowpan:
+        error = UpdateMeshRoute(aMessage);
+        break;
+
+#endif
+
+#if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
+    case Message::kTypeMacEmptyData:
+        error = kErrorNone;
+        break;
+#endif
+
+    default:
+        error = kErrorDrop;
+        break;
+    }
+
+    aMessage.SetDoNotEvict(false);
+
+    return error;
+}
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+
+bool MeshForwarder::ShouldDeferForTxFairness(const Message &aMessage) const
+{
+    // Determines whether @p aMessage (whose route was just updated
+    // into `mMacAddrs`) should be deferred in favor of a queued
+    // same-priority message for a different destination. A message
+    // with earlier fragment frames already transmitted is never
+    // deferred, so fairness acts on message boundaries.
+
+    bool shouldDefer = false;
+
+    VerifyOrExit(mTxFairnessMaxBurst != 0);
+    VerifyOrExit(aMessage.GetOffset() == 0);
+    VerifyOrExit(!mMacAddrs.mDestination.IsBroadcast());
+    VerifyOrExit(mMacAddrs.mDestination == mTxFairnessLastDest);
+    VerifyOrExit(mTxFairnessBurstCount >= mTxFairnessMaxBurst);
+
+    shouldDefer = true;
+
+exit:
+    return shouldDefer;
+}
+
+void MeshForwarder::UpdateTxFairnessOnSelect(void)
+{
+    // Tracks the number of consecutive frames prepared for the same
+    // MAC destination. This is called once per frame (not per
+    // message), so a long fragmented message uses up its
+    // destination's burst allowance frame by frame.
+
+    if (mMacAddrs.mDestination == mTxFairnessLastDest)
+    {
+        if (mTxFairnessBurstCount < NumericLimits<uint8_t>::kMax)
+        {
+            mTxFairnessBurstCount++;
+        }
+    }
+    else
+    {
+        mTxFairnessLastDest   = mMacAddrs.mDestination;
+        mTxFairnessBurstCount = 1;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+
 Error MeshForwarder::UpdateIp6Route(Message &aMessage)
 {
     Error       error = kErrorNone;
@@ -676,6 +860,9 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
     switch (mSendMessage->GetType())
     {
     case Message::kTypeIp6:
+#if OPENTHREAD_CONFIG_MESSAGE_LIFECYCLE_TRACE_ENABLE
+        mSendMessage->MarkLifecycleFramePrepTime();
+#endif
         if (mSendMessage->IsMleCommand(Mle::kCommandDiscoveryRequest))
         {
             frame = Get<Mle::DiscoverScanner>().PrepareDiscoveryRequestFrame(*frame);
@@ -686,6 +873,12 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
         {
             mSendMessage->SetLinkSecurityEnabled(true);
         }
+#endif
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE
+        if (TakePreparedAheadFrame(*frame))
+        {
+            break;
+        }
 #endif
         mMessageNextOffset = Get<MessageFramer>().PrepareFrame(*frame, *mSendMessage, mMacAddrs, mAddMeshHeader,
                                                                mMeshSource, mMeshDest, addFragHeader);
@@ -732,10 +925,83 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
 
     frame->SetIsARetransmission(false);
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE
+    if ((mSendMessage->GetType() == Message::kTypeIp6) && (mMessageNextOffset < mSendMessage->GetLength()))
+    {
+        // The message needs more fragment frames. Prepare the next
+        // fragment into the staging buffer from a tasklet, which runs
+        // after the MAC layer has handed the current frame to the
+        // radio, overlapping frame preparation with its transmission.
+
+        mPrepareAheadTask.Post();
+    }
+#endif
+
 exit:
     return frame;
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE
+
+bool MeshForwarder::TakePreparedAheadFrame(Mac::TxFrame &aFrame)
+{
+    bool taken = false;
+
+    VerifyOrExit(mPreparedAheadMessage != nullptr);
+    VerifyOrExit(mPreparedAheadMessage == mSendMessage);
+    VerifyOrExit(mPreparedAheadOffset == mSendMessage->GetOffset());
+    VerifyOrExit(mPreparedAheadMacAddrs.mSource == mMacAddrs.mSource);
+    VerifyOrExit(mPreparedAheadMacAddrs.mDestination == mMacAddrs.mDestination);
+
+    aFrame.CopyFrom(mPreparedAheadFrame);
+    mMessageNextOffset = mPreparedAheadNextOffset;
+    taken              = true;
+
+exit:
+    // The staged frame is single-use: whether consumed or found stale,
+    // it is invalidated and rebuilt for the next fragment.
+
+    InvalidatePreparedAheadFrame();
+
+    return taken;
+}
+
+void MeshForwarder::PrepareAheadFrame(void)
+{
+    uint16_t offset;
+
+    InvalidatePreparedAheadFrame();
+
+    VerifyOrExit(mEnabled && (mSendMessage != nullptr));
+    VerifyOrExit(mSendMessage->GetType() == Message::kTypeIp6);
+    VerifyOrExit((mMessageNextOffset > 0) && (mMessageNextOffset < mSendMessage->GetLength()));
+
+    // Prepare the next fragment frame as if the in-flight one has
+    // already been sent, temporarily advancing the message offset.
+    // The staged frame is only consumed in `HandleFrameRequest()`
+    // after verifying the message, offset, and MAC addresses still
+    // match (e.g., the in-flight frame may fail and abort the
+    // message, or the message may be evicted meanwhile).
+
+    offset = mSendMessage->GetOffset();
+    mSendMessage->SetOffset(mMessageNextOffset);
+
+    mPreparedAheadNextOffset =
+        Get<MessageFramer>().PrepareFrame(mPreparedAheadFrame, *mSendMessage, mMacAddrs, mAddMeshHeader, mMeshSource,
+                                          mMeshDest);
+
+    mSendMessage->SetOffset(offset);
+
+    mPreparedAheadMessage  = mSendMessage;
+    mPreparedAheadOffset   = mMessageNextOffset;
+    mPreparedAheadMacAddrs = mMacAddrs;
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE
+
 Neighbor *MeshForwarder::UpdateNeighborOnSentFrame(Mac::TxFrame       &aFrame,
                                                    Error               aError,
                                                    const Mac::Address &aMacDest,
@@ -836,6 +1102,10 @@ void MeshForwarder::HandleSentFrame(Mac::TxFrame &aFrame, Error aError)
     Neighbor    *neighbor = nullptr;
     Mac::Address macDest;
 
+#if OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
+    Utils::Instrumentation::Scope scope(GetInstance(), Utils::Instrumentation::kSiteMeshForwarderTxDone);
+#endif
+
     OT_ASSERT((aError == kErrorNone) || (aError == kErrorChannelAccessFailure) || (aError == kErrorAbort) ||
               (aError == kErrorNoAck));
 
@@ -861,6 +1131,11 @@ void MeshForwarder::HandleSentFrame(Mac::TxFrame &aFrame, Error aError)
         neighbor = UpdateNeighborOnSentFrame(aFrame, aError, macDest, /* aIsDataPoll */ false);
     }
 
+#if OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE
+    Get<Utils::TelemetryEmitter>().EmitForwardingDecision(
+        macDest.IsShort() ? macDest.GetShort() : Mle::kInvalidRloc16, aError);
+#endif
+
     UpdateSendMessage(aError, macDest, neighbor);
 
 exit:
@@ -1010,6 +1285,10 @@ void MeshForwarder::HandleReceivedFrame(Mac::RxFrame &aFrame)
     Error  error = kErrorNone;
     RxInfo rxInfo(GetInstance());
 
+#if OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
+    Utils::Instrumentation::Scope scope(GetInstance(), Utils::Instrumentation::kSiteMeshForwarderRx);
+#endif
+
     VerifyOrExit(mEnabled, error = kErrorInvalidState);
 
     rxInfo.mFrameData.Init(aFrame.GetPayload(), aFrame.GetPayloadLength());
@@ -1106,6 +1385,16 @@ void MeshForwarder::HandleFragment(RxInfo &aRxInfo)
     {
         uint16_t datagramSize = fragmentHeader.GetDatagramSize();
 
+        // Apply the IPv6 filter checks directly against the received
+        // frame before converting it into a message, so that
+        // to-be-dropped frames never consume message buffers.
+
+        if (!aRxInfo.IsLinkSecurityEnabled())
+        {
+            SuccessOrExit(error = aRxInfo.ParseIp6Headers());
+            SuccessOrExit(error = Get<Ip6::Filter>().Apply(aRxInfo.mIp6Headers));
+        }
+
 #if OPENTHREAD_FTD
         UpdateEidRlocCacheAndStaleChild(aRxInfo);
 #endif
@@ -1119,8 +1408,6 @@ void MeshForwarder::HandleFragment(RxInfo &aRxInfo)
         message->SetTimestampToNow();
         message->UpdateLinkInfoFrom(aRxInfo.mLinkInfo);
 
-        SuccessOrExit(error = Get<Ip6::Filter>().Apply(*message));
-
 #if OPENTHREAD_FTD
         CheckReachabilityToSendIcmpError(*message, aRxInfo.mMacAddrs);
 #endif
@@ -1134,6 +1421,8 @@ void MeshForwarder::HandleFragment(RxInfo &aRxInfo)
             ClearReassemblyList();
         }
 
+        ApplyReassemblyListLimits(*message);
+
         mReassemblyList.Enqueue(*message);
 
         Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
@@ -1171,6 +1460,9 @@ void MeshForwarder::HandleFragment(RxInfo &aRxInfo)
         message->MoveOffset(aRxInfo.mFrameData.GetLength());
         message->AddRss(aRxInfo.mLinkInfo.GetRss());
         message->AddLqi(aRxInfo.mLinkInfo.GetLqi());
+#if OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+        UpdateReassemblyGap(*message);
+#endif
         message->SetTimestampToNow();
     }
 
@@ -1191,12 +1483,75 @@ exit:
     }
 }
 
+void MeshForwarder::ApplyReassemblyListLimits(const Message &aMessage)
+{
+    // Bounds the number of in-progress reassemblies before the new
+    // datagram @p aMessage is enqueued. If the sender (same IPv6
+    // source address as @p aMessage) is at its session quota, or the
+    // overall session limit is reached, the least recently updated
+    // in-progress datagram (from the sender or overall, respectively)
+    // is dropped to make room. This bounds the cost of matching a
+    // "next fragment" against the list and prevents a single sender
+    // from claiming all reassembly sessions (and the message buffers
+    // backing them).
+
+    uint16_t    numSessions   = 0;
+    uint16_t    numFromSender = 0;
+    Message    *oldest        = nullptr;
+    Message    *oldestSender  = nullptr;
+    Message    *evict         = nullptr;
+    Ip6::Header ip6Header;
+    Ip6::Address source;
+
+    SuccessOrExit(aMessage.Read(0, ip6Header));
+    source = ip6Header.GetSource();
+
+    for (Message &message : mReassemblyList)
+    {
+        numSessions++;
+
+        if ((oldest == nullptr) || (message.GetTimestamp() < oldest->GetTimestamp()))
+        {
+            oldest = &message;
+        }
+
+        if ((message.Read(0, ip6Header) == kErrorNone) && (ip6Header.GetSource() == source))
+        {
+            numFromSender++;
+
+            if ((oldestSender == nullptr) || (message.GetTimestamp() < oldestSender->GetTimestamp()))
+            {
+                oldestSender = &message;
+            }
+        }
+    }
+
+    if (numFromSender >= kMaxReassemblySessionsPerSender)
+    {
+        evict = oldestSender;
+    }
+    else if (numSessions >= kMaxReassemblySessions)
+    {
+        evict = oldest;
+    }
+
+    if (evict != nullptr)
+    {
+        LogMessage(kMessageReassemblyDrop, *evict, kErrorNoBufs);
+        mCounters.UpdateOnReassemblyDrop(*evict);
+        mReassemblyList.DequeueAndFree(*evict);
+    }
+
+exit:
+    return;
+}
+
 void MeshForwarder::ClearReassemblyList(void)
 {
     for (Message &message : mReassemblyList)
     {
         LogMessage(kMessageReassemblyDrop, message, kErrorNoFrameReceived);
-        mCounters.UpdateOnDrop(message);
+        mCounters.UpdateOnReassemblyDrop(message);
         mReassemblyList.DequeueAndFree(message);
     }
 }
@@ -1223,10 +1578,16 @@ bool MeshForwarder::UpdateReassemblyList(void)
 
     for (Message &message : mReassemblyList)
     {
-        if (now - message.GetTimestamp() >= TimeMilli::SecToMsec(kReassemblyTimeout))
+#if OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+        uint32_t timeout = DetermineReassemblyTimeout(message);
+#else
+        uint32_t timeout = TimeMilli::SecToMsec(kReassemblyTimeout);
+#endif
+
+        if (now - message.GetTimestamp() >= timeout)
         {
             LogMessage(kMessageReassemblyDrop, message, kErrorReassemblyTimeout);
-            mCounters.UpdateOnDrop(message);
+            mCounters.UpdateOnReassemblyDrop(message);
             mReassemblyList.DequeueAndFree(message);
         }
     }
@@ -1234,6 +1595,43 @@ bool MeshForwarder::UpdateReassemblyList(void)
     return mReassemblyList.GetHead() != nullptr;
 }
 
+#if OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+
+void MeshForwarder::UpdateReassemblyGap(Message &aMessage)
+{
+    uint32_t gap = TimerMilli::GetNow() - aMessage.GetTimestamp();
+
+    mReassemblyGapStats.UpdateFor(gap);
+
+    gap = Min<uint32_t>(gap, NumericLimits<uint16_t>::kMax);
+    aMessage.SetMaxReassemblyGap(Max(aMessage.GetMaxReassemblyGap(), static_cast<uint16_t>(gap)));
+}
+
+uint32_t MeshForwarder::DetermineReassemblyTimeout(const Message &aMessage) const
+{
+    uint32_t timeout = kReassemblyGapGrowthFactor * static_cast<uint32_t>(aMessage.GetMaxReassemblyGap());
+
+    timeout = Max(timeout, TimeMilli::SecToMsec(kReassemblyTimeout));
+    timeout = Min(timeout, kMaxAdaptiveReassemblyTimeout);
+
+    return timeout;
+}
+
+const uint32_t *MeshForwarder::ReassemblyGapStats::GetHistogram(uint16_t &aNumBins, uint32_t &aBinInterval) const
+{
+    aNumBins     = kNumHistBins;
+    aBinInterval = kHistBinInterval;
+    return mHistogram;
+}
+
+void MeshForwarder::ReassemblyGapStats::UpdateFor(uint32_t aGap)
+{
+    mHistogram[Min<uint32_t>(aGap / kHistBinInterval, kNumHistBins - 1)]++;
+    mMaxInterval = Max(mMaxInterval, aGap);
+}
+
+#endif // OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+
 Error MeshForwarder::FrameToMessage(RxInfo &aRxInfo, uint16_t aDatagramSize, Message *&aMessage)
 {
     Error             error     = kErrorNone;
@@ -1259,6 +1657,16 @@ void MeshForwarder::HandleLowpanHc(RxInfo &aRxInfo)
     Error    error   = kErrorNone;
     Message *message = nullptr;
 
+    // Apply the IPv6 filter checks directly against the received
+    // frame before converting it into a message, so that
+    // to-be-dropped frames never consume message buffers.
+
+    if (!aRxInfo.IsLinkSecurityEnabled())
+    {
+        SuccessOrExit(error = aRxInfo.ParseIp6Headers());
+        SuccessOrExit(error = Get<Ip6::Filter>().Apply(aRxInfo.mIp6Headers));
+    }
+
 #if OPENTHREAD_FTD
     UpdateEidRlocCacheAndStaleChild(aRxInfo);
 #endif
@@ -1267,8 +1675,6 @@ void MeshForwarder::HandleLowpanHc(RxInfo &aRxInfo)
 
     message->UpdateLinkInfoFrom(aRxInfo.mLinkInfo);
 
-    SuccessOrExit(error = Get<Ip6::Filter>().Apply(*message));
-
 #if OPENTHREAD_FTD
     CheckReachabilityToSendIcmpError(*message, aRxInfo.mMacAddrs);
 #endif
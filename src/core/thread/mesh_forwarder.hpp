@@ -57,6 +57,11 @@
 #include "thread/network_data_leader.hpp"
 #include "thread/thread_link_info.hpp"
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE && \
+    (OPENTHREAD_CONFIG_MULTI_RADIO || OPENTHREAD_CONFIG_TIME_SYNC_ENABLE)
+#error "OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE is not supported with multi-radio or time sync"
+#endif
+
 namespace ot {
 
 namespace Mle {
@@ -101,6 +106,7 @@ public:
         void UpdateOnTxDone(const Message &aMessage, bool aTxSuccess);
         void UpdateOnRx(const Message &aMessage);
         void UpdateOnDrop(const Message &aMessage);
+        void UpdateOnReassemblyDrop(const Message &aMessage);
     };
 
     /**
@@ -194,6 +200,18 @@ public:
         mSendQueue.GetInfo(aSendQueueInfo), mReassemblyList.GetInfo(aReassemblyQueueInfo);
     }
 
+    /**
+     * Resets the tracked queue-depth watermark of the send queue.
+     */
+    void ResetSendQueueWatermark(void) { mSendQueue.ResetMaxNumMessages(); }
+
+    /**
+     * Returns the number of messages currently in the send queue.
+     *
+     * @returns The number of messages in the send queue.
+     */
+    uint16_t GetSendQueueNumMessages(void) const { return mSendQueue.GetNumMessages(); }
+
     /**
      * Returns a reference to the IP level counters.
      *
@@ -206,6 +224,24 @@ public:
      */
     void ResetCounters(void) { mCounters.Clear(); }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+    /**
+     * Gets the maximum number of consecutive direct-transmission frames to the same MAC destination before the
+     * scheduler yields to a same-priority message for a different destination.
+     *
+     * @returns The maximum burst length (in frames). Zero indicates fairness scheduling is disabled.
+     */
+    uint8_t GetTxFairnessMaxBurst(void) const { return mTxFairnessMaxBurst; }
+
+    /**
+     * Sets the maximum number of consecutive direct-transmission frames to the same MAC destination before the
+     * scheduler yields to a same-priority message for a different destination.
+     *
+     * @param[in] aMaxBurst   The maximum burst length (in frames). Zero disables fairness scheduling.
+     */
+    void SetTxFairnessMaxBurst(uint8_t aMaxBurst) { mTxFairnessMaxBurst = aMaxBurst; }
+#endif
+
 #if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
     /**
      * Gets the time-in-queue histogram for messages in the TX queue.
@@ -252,6 +288,44 @@ public:
     void ResetTimeInQueueStat(void) { mTxQueueStats.Clear(); }
 #endif
 
+#if OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+    /**
+     * Gets the histogram of observed gaps between successive fragment arrivals for datagrams under reassembly.
+     *
+     * The histogram is returned as an array of `uint32_t` values with `aNumBins` entries. The first entry in the
+     * array (at index 0) represents the number of gaps shorter than `aBinInterval`. The second entry represents the
+     * number of gaps greater than or equal to `aBinInterval`, but less than `2 * aBinInterval`. And so on. The last
+     * entry represents the number of gaps greater than or equal to `(aNumBins - 1) * aBinInterval`.
+     *
+     * The collected statistics can be reset by calling `ResetReassemblyGapStat()`. The histogram information is
+     * collected since the instance was initialized or since the last time statistics collection was reset by calling
+     * the `ResetReassemblyGapStat()`.
+     *
+     * @param[out] aNumBins       Reference to return the number of bins in histogram (array length).
+     * @param[out] aBinInterval   Reference to return the histogram bin interval length in milliseconds.
+     *
+     * @returns A pointer to an array of @p aNumBins entries representing the collected histogram info.
+     */
+    const uint32_t *GetReassemblyGapHistogram(uint16_t &aNumBins, uint32_t &aBinInterval) const
+    {
+        return mReassemblyGapStats.GetHistogram(aNumBins, aBinInterval);
+    }
+
+    /**
+     * Gets the maximum observed gap between successive fragment arrivals for datagrams under reassembly.
+     *
+     * The collected statistics can be reset by calling `ResetReassemblyGapStat()`.
+     *
+     * @returns The maximum observed inter-fragment gap in milliseconds (so far).
+     */
+    uint32_t GetMaxReassemblyGap(void) const { return mReassemblyGapStats.GetMaxInterval(); }
+
+    /**
+     * Resets the reassembly inter-fragment gap statistics.
+     */
+    void ResetReassemblyGapStat(void) { mReassemblyGapStats.Clear(); }
+#endif
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     /**
      * Handles a deferred ack.
@@ -274,6 +348,17 @@ private:
     static constexpr uint8_t kFailedCslDataPollTransmissions = 15;
 
     static constexpr uint8_t kReassemblyTimeout      = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT; // in seconds.
+    static constexpr uint16_t kMaxReassemblySessions = OPENTHREAD_CONFIG_6LOWPAN_MAX_REASSEMBLY_SESSIONS;
+    static constexpr uint16_t kMaxReassemblySessionsPerSender =
+        OPENTHREAD_CONFIG_6LOWPAN_MAX_REASSEMBLY_SESSIONS_PER_SENDER;
+
+#if OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+    // With adaptive reassembly timeout, an in-progress datagram may wait for its next fragment for up to
+    // `kReassemblyGapGrowthFactor` times its largest observed inter-fragment gap, bounded below by
+    // `kReassemblyTimeout` and above by `kMaxAdaptiveReassemblyTimeout`.
+    static constexpr uint8_t  kReassemblyGapGrowthFactor    = 4;
+    static constexpr uint32_t kMaxAdaptiveReassemblyTimeout = 4 * 1000u * kReassemblyTimeout; // in msec.
+#endif
     static constexpr uint8_t kMeshHeaderFrameMtu     = OT_RADIO_FRAME_MAX_SIZE; // Max MTU with a Mesh Header frame.
     static constexpr uint8_t kMeshHeaderFrameFcsSize = sizeof(uint16_t);        // Frame FCS size for Mesh Header frame.
 
@@ -421,6 +506,24 @@ private:
     };
 #endif
 
+#if OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+    class ReassemblyGapStats : public Clearable<ReassemblyGapStats>
+    {
+    public:
+        const uint32_t *GetHistogram(uint16_t &aNumBins, uint32_t &aBinInterval) const;
+        uint32_t        GetMaxInterval(void) const { return mMaxInterval; }
+        void            UpdateFor(uint32_t aGap);
+
+    private:
+        static constexpr uint32_t kHistMaxInterval = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_GAP_HISTOGRAM_MAX_INTERVAL;
+        static constexpr uint32_t kHistBinInterval = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_GAP_HISTOGRAM_BIN_INTERVAL;
+        static constexpr uint16_t kNumHistBins     = (kHistMaxInterval + kHistBinInterval - 1) / kHistBinInterval;
+
+        uint32_t mMaxInterval;
+        uint32_t mHistogram[kNumHistBins];
+    };
+#endif
+
 #if OPENTHREAD_FTD
     bool  IsReachable(uint16_t aMeshDest, const Ip6::Header &aIp6Header) const;
     void  CheckReachabilityToSendIcmpError(const Message &aMessage, const Mac::Addresses &aMacAddrs);
@@ -429,6 +532,11 @@ private:
     void     UpdateEidRlocCacheAndStaleChild(RxInfo &aRxInfo);
     Error    FrameToMessage(RxInfo &aRxInfo, uint16_t aDatagramSize, Message *&aMessage);
     Message *PrepareNextDirectTransmission(void);
+    Error    UpdateRouteForMessage(Message &aMessage);
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+    bool ShouldDeferForTxFairness(const Message &aMessage) const;
+    void UpdateTxFairnessOnSelect(void);
+#endif
     void     HandleMesh(RxInfo &aRxInfo);
     void     ResolveRoutingLoops(uint16_t aSourceRloc16, uint16_t aDestRloc16);
     void     HandleFragment(RxInfo &aRxInfo);
@@ -446,14 +554,28 @@ private:
     Error UpdateIp6Route(Message &aMessage);
     Error UpdateIp6RouteFtd(const Ip6::Header &aIp6Header, Message &aMessage);
     Error UpdateMeshRoute(Message &aMessage);
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+    static uint32_t CalcEcmpFlowHash(const Ip6::Header &aIp6Header);
+    static uint32_t CalcEcmpMeshFlowHash(const Message &aMessage, const Lowpan::MeshHeader &aMeshHeader);
+#endif
     bool  UpdateReassemblyList(void);
     void  UpdateFragmentPriority(Lowpan::FragmentHeader &aFragmentHeader,
                                  uint16_t                aFragmentLength,
                                  uint16_t                aSrcRloc16,
                                  Message::Priority       aPriority);
     Error HandleDatagram(Message &aMessage, const Mac::Address &aMacSource);
+    void  ApplyReassemblyListLimits(const Message &aMessage);
     void  ClearReassemblyList(void);
+#if OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+    void     UpdateReassemblyGap(Message &aMessage);
+    uint32_t DetermineReassemblyTimeout(const Message &aMessage) const;
+#endif
     void  HandleDiscoverComplete(void);
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE
+    bool TakePreparedAheadFrame(Mac::TxFrame &aFrame);
+    void PrepareAheadFrame(void);
+    void InvalidatePreparedAheadFrame(void) { mPreparedAheadMessage = nullptr; }
+#endif
 
     void          HandleReceivedFrame(Mac::RxFrame &aFrame);
     Mac::TxFrame *HandleFrameRequest(Mac::TxFrames &aTxFrames);
@@ -470,6 +592,7 @@ private:
 
     void HandleTimeTick(void);
     void ScheduleTransmissionTask(void);
+    void ScheduleTransmission(void);
 
     Error EvictMessage(Message::Priority aPriority, EvictReason aEvictReason);
     Error GetFramePriority(RxInfo &aRxInfo, Message::Priority &aPriority);
@@ -540,6 +663,10 @@ private:
 
     using TxTask = TaskletIn<MeshForwarder, &MeshForwarder::ScheduleTransmissionTask>;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE
+    using PrepareAheadTask = TaskletIn<MeshForwarder, &MeshForwarder::PrepareAheadFrame>;
+#endif
+
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
     using TxDelayTimer = TimerMilliIn<MeshForwarder, &MeshForwarder::HandleTxDelayTimer>;
 #endif
@@ -553,10 +680,18 @@ private:
     Mac::Addresses mMacAddrs;
     uint16_t       mMeshSource;
     uint16_t       mMeshDest;
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_TX_FAIRNESS_ENABLE
+    Mac::Address mTxFairnessLastDest;
+    uint8_t      mTxFairnessBurstCount;
+    uint8_t      mTxFairnessMaxBurst;
+#endif
     bool           mAddMeshHeader : 1;
     bool           mEnabled : 1;
     bool           mTxPaused : 1;
     bool           mSendBusy : 1;
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_SYNC_TX_FAST_PATH_ENABLE
+    bool mTxScheduling : 1;
+#endif
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
     bool         mDelayNextTx : 1;
     TxDelayTimer mTxDelayTimer;
@@ -564,6 +699,16 @@ private:
 
     TxTask mScheduleTransmissionTask;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PREP_AHEAD_ENABLE
+    Message         *mPreparedAheadMessage;
+    uint16_t         mPreparedAheadOffset;
+    uint16_t         mPreparedAheadNextOffset;
+    Mac::Addresses   mPreparedAheadMacAddrs;
+    PrepareAheadTask mPrepareAheadTask;
+    Mac::TxFrame     mPreparedAheadFrame;
+    uint8_t          mPreparedAheadPsdu[OT_RADIO_FRAME_MAX_SIZE];
+#endif
+
     Counters mCounters;
 
 #if OPENTHREAD_FTD || OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
@@ -579,6 +724,10 @@ private:
 #if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
     TxQueueStats mTxQueueStats;
 #endif
+
+#if OPENTHREAD_CONFIG_6LOWPAN_ADAPTIVE_REASSEMBLY_TIMEOUT_ENABLE
+    ReassemblyGapStats mReassemblyGapStats;
+#endif
 };
 
 /**
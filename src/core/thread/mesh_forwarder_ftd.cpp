@@ -35,6 +35,7 @@
 
 #if OPENTHREAD_FTD
 
+#include "common/crc.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -132,7 +133,7 @@ void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
     ApplyDirectTxQueueLimit(message);
 #endif
 
-    mScheduleTransmissionTask.Post();
+    ScheduleTransmission();
 
 exit:
     return;
@@ -349,7 +350,11 @@ Error MeshForwarder::UpdateMeshRoute(Message &aMessage)
 
     IgnoreError(meshHeader.ParseFrom(aMessage));
 
+#if OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+    nextHop = Get<RouterTable>().GetNextHop(meshHeader.GetDestination(), CalcEcmpMeshFlowHash(aMessage, meshHeader));
+#else
     nextHop = Get<RouterTable>().GetNextHop(meshHeader.GetDestination());
+#endif
 
     if (nextHop != Mle::kInvalidRloc16)
     {
@@ -383,6 +388,64 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+
+uint32_t MeshForwarder::CalcEcmpFlowHash(const Ip6::Header &aIp6Header)
+{
+    // Hashes the fields identifying the flow (flow label along with
+    // source and destination addresses), so that a given flow always
+    // selects the same next hop among the equal-cost candidates.
+
+    CrcCalculator<uint32_t> crc(kCrc32AnsiPolynomial);
+    uint32_t                flow = aIp6Header.GetFlow();
+
+    crc.Feed(flow);
+    crc.Feed(aIp6Header.GetSource());
+    crc.Feed(aIp6Header.GetDestination());
+
+    return crc.GetCrc();
+}
+
+uint32_t MeshForwarder::CalcEcmpMeshFlowHash(const Message &aMessage, const Lowpan::MeshHeader &aMeshHeader)
+{
+    // For a forwarded mesh-header frame the IPv6 flow label is only
+    // present (compressed) in the first fragment, so we instead hash
+    // the mesh source/destination along with the 6LoWPAN datagram tag.
+    // This keeps all fragments of a datagram on the same next hop
+    // while spreading concurrent datagrams across equal-cost links.
+
+    CrcCalculator<uint32_t>    crc(kCrc32AnsiPolynomial);
+    Lowpan::FragmentHeader     fragmentHeader;
+    Lowpan::MeshHeader         meshHeader;
+    uint16_t                   offset = 0;
+    uint16_t                   headerLength;
+    uint16_t                   tag = 0;
+
+    if (meshHeader.ParseFrom(aMessage, headerLength) == kErrorNone)
+    {
+        offset = headerLength;
+    }
+
+    if (fragmentHeader.ParseFrom(aMessage, offset, headerLength) == kErrorNone)
+    {
+        tag = fragmentHeader.GetDatagramTag();
+    }
+
+    crc.Feed(tag);
+
+    {
+        uint16_t source      = aMeshHeader.GetSource();
+        uint16_t destination = aMeshHeader.GetDestination();
+
+        crc.Feed(source);
+        crc.Feed(destination);
+    }
+
+    return crc.GetCrc();
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+
 Error MeshForwarder::UpdateIp6RouteFtd(const Ip6::Header &aIp6Header, Message &aMessage)
 {
     Error     error = kErrorNone;
@@ -445,7 +508,11 @@ Error MeshForwarder::UpdateIp6RouteFtd(const Ip6::Header &aIp6Header, Message &a
 
     VerifyOrExit(IsReachable(mMeshDest, aIp6Header), error = kErrorNoRoute);
     aMessage.SetMeshDest(mMeshDest);
+#if OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+    mMacAddrs.mDestination.SetShort(Get<RouterTable>().GetNextHop(mMeshDest, CalcEcmpFlowHash(aIp6Header)));
+#else
     mMacAddrs.mDestination.SetShort(Get<RouterTable>().GetNextHop(mMeshDest));
+#endif
 
     if (mMacAddrs.mDestination.GetShort() != mMeshDest)
     {
@@ -569,10 +636,16 @@ void MeshForwarder::HandleMesh(RxInfo &aRxInfo)
     Error              error = kErrorNone;
     Lowpan::MeshHeader meshHeader;
     Mac::Address       neighborMacSource;
+    FrameData          receivedFrameData;
 
     // Security Check: only process Mesh Header frames that had security enabled.
     VerifyOrExit(aRxInfo.IsLinkSecurityEnabled(), error = kErrorSecurity);
 
+    // Save the frame data including the Mesh Header itself, which is
+    // used when forwarding the frame towards its next hop.
+
+    receivedFrameData = aRxInfo.mFrameData;
+
     SuccessOrExit(error = meshHeader.ParseFrom(aRxInfo.mFrameData));
 
     neighborMacSource = aRxInfo.GetSrcAddr();
@@ -616,8 +689,25 @@ void MeshForwarder::HandleMesh(RxInfo &aRxInfo)
             Get<MessagePool>().Allocate(Message::kType6lowpan, /* aReserveHeader */ 0, Message::Settings(priority)));
         VerifyOrExit(messagePtr != nullptr, error = kErrorNoBufs);
 
-        SuccessOrExit(error = meshHeader.AppendTo(*messagePtr));
-        SuccessOrExit(error = messagePtr->AppendData(aRxInfo.mFrameData));
+        // The forwarded frame matches the received one except for the
+        // decremented Hops Left value, whose encoded size never
+        // changes. So instead of re-serializing the Mesh Header, copy
+        // the received bytes, Mesh Header included, into the message
+        // in a single pass and patch the Hops Left field in place.
+        // The one copy into the message pool is required since the rx
+        // frame buffer is owned by the radio platform and remains
+        // valid only within the receive callback, while the forwarded
+        // message is transmitted asynchronously.
+        {
+            uint8_t hopsBytes[2];
+
+            memcpy(hopsBytes, receivedFrameData.GetBytes(), sizeof(hopsBytes));
+            meshHeader.UpdateHopsLeftIn(hopsBytes);
+
+            SuccessOrExit(error = messagePtr->SetLength(receivedFrameData.GetLength()));
+            messagePtr->WriteData(0, receivedFrameData);
+            messagePtr->WriteBytes(0, hopsBytes, sizeof(hopsBytes));
+        }
 
         messagePtr->UpdateLinkInfoFrom(aRxInfo.mLinkInfo);
 
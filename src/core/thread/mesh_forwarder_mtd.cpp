@@ -47,7 +47,7 @@ void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
     message.SetTimestampToNow();
 
     mSendQueue.Enqueue(message);
-    mScheduleTransmissionTask.Post();
+    ScheduleTransmission();
 
 #if (OPENTHREAD_CONFIG_MAX_FRAMES_IN_DIRECT_TX_QUEUE > 0)
     ApplyDirectTxQueueLimit(message);
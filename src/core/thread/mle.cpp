@@ -108,6 +108,9 @@ Mle::Mle(Instance &aInstance)
     , mAdvertiseTrickleTimer(aInstance, Mle::HandleAdvertiseTrickleTimer)
     , mChildTable(aInstance)
     , mRouterTable(aInstance)
+    , mAdvUpdatesInSlice(0)
+    , mDeferredAdvTask(aInstance)
+    , mNextChildSweepTime(0)
 #endif // OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_P2P_ENABLE
     , mP2p(aInstance)
@@ -116,6 +119,9 @@ Mle::Mle(Instance &aInstance)
     mParent.Init(aInstance);
 
     mLeaderData.Clear();
+#if OPENTHREAD_CONFIG_MLE_TX_TLV_TEMPLATE_ENABLE
+    ClearAllBytes(mTxTlvTemplate);
+#endif
     mParent.Clear();
     ResetCounters();
 
@@ -154,6 +160,8 @@ Mle::Mle(Instance &aInstance)
 
     SetRouterId(kInvalidRouterId);
 
+    ClearAllBytes(mDeferredAdvs);
+
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
     mSteeringData.Clear();
 #endif
@@ -930,6 +938,27 @@ const LeaderData &Mle::GetLeaderData(void)
     return mLeaderData;
 }
 
+#if OPENTHREAD_CONFIG_MLE_TX_TLV_TEMPLATE_ENABLE
+void Mle::RebuildTxTlvTemplate(const LeaderDataTlvValue &aLeaderDataValue)
+{
+    Tlv tlv;
+
+    tlv.SetType(Tlv::kSourceAddress);
+    tlv.SetLength(sizeof(uint16_t));
+    memcpy(&mTxTlvTemplate.mBytes[0], &tlv, sizeof(Tlv));
+    BigEndian::WriteUint16(GetRloc16(), &mTxTlvTemplate.mBytes[TxTlvTemplate::kSrcAddrValueOffset]);
+
+    tlv.SetType(Tlv::kLeaderData);
+    tlv.SetLength(sizeof(LeaderDataTlvValue));
+    memcpy(&mTxTlvTemplate.mBytes[TxTlvTemplate::kLeaderDataValueOffset - sizeof(Tlv)], &tlv, sizeof(Tlv));
+    memcpy(&mTxTlvTemplate.mBytes[TxTlvTemplate::kLeaderDataValueOffset], &aLeaderDataValue,
+           sizeof(LeaderDataTlvValue));
+
+    mTxTlvTemplate.mRloc16  = GetRloc16();
+    mTxTlvTemplate.mIsValid = true;
+}
+#endif
+
 bool Mle::HasUnregisteredAddress(void) const
 {
     bool has = false;
@@ -3120,6 +3149,19 @@ Error Mle::Wakeup(const Mac::ExtAddress &aWedAddress,
 
     VerifyOrExit((aIntervalUs > 0) && (aDurationMs > 0), error = kErrorInvalidArgs);
     VerifyOrExit(aIntervalUs < aDurationMs * Time::kOneMsecInUsec, error = kErrorInvalidArgs);
+
+#if OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_MULTI_TARGET_ENABLE
+    if (mWedAttachState == kWedAttaching)
+    {
+        // Join the ongoing wake-up sequence: wake-up frames for the additional WED are interleaved within the
+        // current sequence window, retaining the interval and duration of the ongoing sequence.
+        wakeupRequest.SetExtAddress(aWedAddress);
+        SuccessOrExit(error = mWakeupTxScheduler.AddTarget(wakeupRequest));
+        mWedAttachTimer.FireAt(mWakeupTxScheduler.GetTxEndTime() + mWakeupTxScheduler.GetConnectionWindowUs());
+        ExitNow();
+    }
+#endif
+
     VerifyOrExit(mWedAttachState == kWedDetached, error = kErrorInvalidState);
 
     wakeupRequest.SetExtAddress(aWedAddress);
@@ -3578,6 +3620,11 @@ Error Mle::TxMessage::AppendResponseTlv(const RxChallenge &aResponse)
 }
 
 Error Mle::TxMessage::AppendLinkFrameCounterTlv(void)
+{
+    return Tlv::Append<LinkFrameCounterTlv>(*this, DetermineLinkFrameCounter());
+}
+
+uint32_t Mle::TxMessage::DetermineLinkFrameCounter(void)
 {
     uint32_t counter;
 
@@ -3592,7 +3639,7 @@ Error Mle::TxMessage::AppendLinkFrameCounterTlv(void)
     Get<KeyManager>().SetAllMacFrameCounters(counter, /* aSetIfLarger */ true);
 #endif
 
-    return Tlv::Append<LinkFrameCounterTlv>(*this, counter);
+    return counter;
 }
 
 Error Mle::TxMessage::AppendMleFrameCounterTlv(void)
@@ -3861,10 +3908,13 @@ Error Mle::TxMessage::AppendCslClockAccuracyTlv(void)
 
 Error Mle::TxMessage::AppendLinkAndMleFrameCounterTlvs(void)
 {
-    Error error;
+    Error                                          error;
+    TlvBatch<2 * (sizeof(Tlv) + sizeof(uint32_t))> batch;
 
-    SuccessOrExit(error = AppendLinkFrameCounterTlv());
-    error = AppendMleFrameCounterTlv();
+    SuccessOrExit(error = batch.Append<LinkFrameCounterTlv>(DetermineLinkFrameCounter()));
+    SuccessOrExit(error = batch.Append<MleFrameCounterTlv>(Get<KeyManager>().GetMleFrameCounter()));
+
+    error = batch.CommitTo(*this);
 
 exit:
     return error;
@@ -3872,6 +3922,24 @@ exit:
 
 Error Mle::TxMessage::AppendSourceAddressAndLeaderDataTlvs(void)
 {
+#if OPENTHREAD_CONFIG_MLE_TX_TLV_TEMPLATE_ENABLE
+    Mle               &mle  = Get<Mle>();
+    TxTlvTemplate     &tmpl = mle.mTxTlvTemplate;
+    LeaderDataTlvValue value;
+
+    mle.mLeaderData.SetDataVersion(Get<NetworkData::Leader>().GetVersion(NetworkData::kFullSet));
+    mle.mLeaderData.SetStableDataVersion(Get<NetworkData::Leader>().GetVersion(NetworkData::kStableSubset));
+
+    value = LeaderDataTlvValue(mle.mLeaderData);
+
+    if (!tmpl.mIsValid || (tmpl.mRloc16 != mle.GetRloc16()) ||
+        (memcmp(&tmpl.mBytes[TxTlvTemplate::kLeaderDataValueOffset], &value, sizeof(value)) != 0))
+    {
+        mle.RebuildTxTlvTemplate(value);
+    }
+
+    return AppendBytes(tmpl.mBytes, TxTlvTemplate::kLength);
+#else
     Error error;
 
     SuccessOrExit(error = AppendSourceAddressTlv());
@@ -3879,6 +3947,7 @@ Error Mle::TxMessage::AppendSourceAddressAndLeaderDataTlvs(void)
 
 exit:
     return error;
+#endif
 }
 
 Error Mle::TxMessage::AppendActiveAndPendingTimestampTlvs(void)
@@ -4489,6 +4558,9 @@ void Mle::PrevRoleRestorer::SendMulticastLinkRequest(void)
 Mle::Attacher::Attacher(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mReceivedResponseFromParent(false)
+#if OPENTHREAD_CONFIG_MLE_FAST_REATTACH_ENABLE
+    , mFastProbeActive(false)
+#endif
     , mState(kStateIdle)
     , mMode(kAnyPartition)
     , mReattachMode(kReattachModeStop)
@@ -4822,6 +4894,9 @@ void Mle::Attacher::HandleTimer(void)
         mReceivedResponseFromParent = false;
         mParentRequestCounter       = 0;
         mChildIdRequestsRemaining   = kMaxChildIdRequests;
+#if OPENTHREAD_CONFIG_MLE_FAST_REATTACH_ENABLE
+        mFastProbeActive = ShouldProbePrevParent();
+#endif
         Get<MeshForwarder>().SetRxOnWhenIdle(true);
 
         OT_FALL_THROUGH;
@@ -5026,6 +5101,13 @@ void Mle::Attacher::SendParentRequest(ParentRequestType aType)
     SuccessOrExit(error = message->AppendTimeRequestTlv());
 #endif
 
+#if OPENTHREAD_CONFIG_MLE_FAST_REATTACH_ENABLE
+    if (mFastProbeActive && (mParentRequestCounter == 1))
+    {
+        SendFastProbeToPrevParent(*message);
+    }
+#endif
+
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_PARENT_SEARCH_ENABLE
     if (aType == kToSelectedRouter)
     {
@@ -5071,6 +5153,85 @@ exit:
     FreeMessageOnError(message, error);
 }
 
+#if OPENTHREAD_CONFIG_MLE_FAST_REATTACH_ENABLE
+
+bool Mle::Attacher::ShouldProbePrevParent(void)
+{
+    // Determines whether to unicast a fast probe to the previously
+    // known parent at the start of an attach cycle, and if so reads
+    // its extended address into `mPrevParentExtAddress`. The probe is
+    // used only on the first attach cycle of a detached device.
+
+    bool                 shouldProbe = false;
+    Settings::ParentInfo parentInfo;
+
+    VerifyOrExit(Get<Mle>().IsDetached());
+    VerifyOrExit(mMode == kAnyPartition);
+    VerifyOrExit(mAttachCounter <= 1);
+    SuccessOrExit(Get<Settings>().Read(parentInfo));
+
+    mPrevParentExtAddress = parentInfo.GetExtAddress();
+    shouldProbe           = true;
+
+exit:
+    return shouldProbe;
+}
+
+void Mle::Attacher::SendFastProbeToPrevParent(const TxMessage &aMessage)
+{
+    // Unicasts a copy of the Parent Request in @p aMessage directly
+    // to the previously known parent, alongside the normal multicast
+    // scan. The unicast transmission benefits from MAC-level acks and
+    // retries, and a Parent Response from the previous parent is then
+    // committed to immediately (see `HandleFastProbeResponse()`). The
+    // probe is best effort; failure to send it does not affect the
+    // multicast scan.
+
+    TxMessage   *probeMessage;
+    Ip6::Address destination;
+
+    probeMessage = static_cast<TxMessage *>(Get<Mle>().mSocket.CloneMessage(aMessage));
+    VerifyOrExit(probeMessage != nullptr);
+
+    destination.SetToLinkLocalAddress(mPrevParentExtAddress);
+
+    if (probeMessage->SendTo(destination) != kErrorNone)
+    {
+        probeMessage->Free();
+        ExitNow();
+    }
+
+    Log(kMessageSend, kTypeParentRequestToRouters, destination);
+
+exit:
+    return;
+}
+
+void Mle::Attacher::HandleFastProbeResponse(const Mac::ExtAddress &aExtAddress)
+{
+    // Called from `HandleParentResponse()` after a Parent Response
+    // has been accepted as the parent candidate. If the response is
+    // from the previously known (probed) parent, commit to it
+    // immediately instead of waiting out the full response window.
+
+    VerifyOrExit(mFastProbeActive);
+    VerifyOrExit(mState == kStateParentRequest);
+    VerifyOrExit(aExtAddress == mPrevParentExtAddress);
+
+    mFastProbeActive = false;
+
+    VerifyOrExit(SendChildIdRequest() == kErrorNone);
+
+    SetState(kStateChildIdRequest);
+    mChildIdRequestsRemaining--;
+    mTimer.Start(Random::NonCrypto::AddJitter(kChildIdResponseTimeout, kChildIdResponseJitter));
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_FAST_REATTACH_ENABLE
+
 void Mle::Attacher::HandleChildIdRequestTxDone(const otMessage *aMessage, otError aError, void *aContext)
 {
     OT_UNUSED_VARIABLE(aError);
@@ -5264,8 +5425,9 @@ void Mle::Attacher::HandleParentResponse(RxInfo &aRxInfo)
     uint32_t         mleFrameCounter;
     Mac::ExtAddress  extAddress;
     Mac::CslAccuracy cslAccuracy;
+    Tlv::Index       tlvIndex(aRxInfo.mMessage);
 
-    SuccessOrExit(error = Tlv::Find<SourceAddressTlv>(aRxInfo.mMessage, sourceAddress));
+    SuccessOrExit(error = tlvIndex.Find<SourceAddressTlv>(sourceAddress));
 
     Log(kMessageReceive, kTypeParentResponse, aRxInfo.mMessageInfo.GetPeerAddr(), sourceAddress);
 
@@ -5284,7 +5446,7 @@ void Mle::Attacher::HandleParentResponse(RxInfo &aRxInfo)
 
     SuccessOrExit(error = aRxInfo.mMessage.ReadLeaderDataTlv(leaderData));
 
-    SuccessOrExit(error = Tlv::Find<LinkMarginTlv>(aRxInfo.mMessage, linkMarginOut));
+    SuccessOrExit(error = tlvIndex.Find<LinkMarginTlv>(linkMarginOut));
     twoWayLinkMargin = Min(Get<Mac::Mac>().ComputeLinkMargin(rss), linkMarginOut);
 
     SuccessOrExit(error = aRxInfo.mMessage.ReadConnectivityTlv(connectivity));
@@ -5393,7 +5555,7 @@ void Mle::Attacher::HandleParentResponse(RxInfo &aRxInfo)
     {
         TimeParameterTlvValue tlvValue;
 
-        if (Tlv::Find<TimeParameterTlv>(aRxInfo.mMessage, tlvValue) == kErrorNone)
+        if (tlvIndex.Find<TimeParameterTlv>(tlvValue) == kErrorNone)
         {
             Get<TimeSync>().SetTimeSyncPeriod(tlvValue.GetTimeSyncPeriod());
             Get<TimeSync>().SetXtalThreshold(tlvValue.GetXtalThreshold());
@@ -5431,6 +5593,10 @@ void Mle::Attacher::HandleParentResponse(RxInfo &aRxInfo)
     mParentCandidate.mLeaderData   = leaderData;
     mParentCandidate.mLinkMargin   = twoWayLinkMargin;
 
+#if OPENTHREAD_CONFIG_MLE_FAST_REATTACH_ENABLE
+    HandleFastProbeResponse(extAddress);
+#endif
+
 exit:
     LogProcessError(kTypeParentResponse, error);
 }
@@ -6060,7 +6226,7 @@ void Mle::AnnounceHandler::HandleAnnounce(RxInfo &aRxInfo)
         // Notify `AnnounceSender` of the received Announce
         // message so it can update its state to determine
         // whether to send Announce or not.
-        Get<AnnounceSender>().UpdateOnReceivedAnnounce();
+        Get<AnnounceSender>().UpdateOnReceivedAnnounce(aRxInfo.mNeighbor);
 #endif
         break;
     }
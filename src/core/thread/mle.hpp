@@ -47,6 +47,7 @@
 #include "common/log.hpp"
 #include "common/non_copyable.hpp"
 #include "common/notifier.hpp"
+#include "common/tasklet.hpp"
 #include "common/time_ticker.hpp"
 #include "common/timer.hpp"
 #include "common/trickle_timer.hpp"
@@ -792,6 +793,14 @@ public:
      */
     bool IsSingleton(void) const;
 
+    /**
+     * Requests the child table timeout sweep to run on the next time tick.
+     *
+     * Called when an event may shorten a child's expiry time (e.g., a new child is added), since the periodic
+     * sweep otherwise skips ticks until the earliest tracked expiry.
+     */
+    void ScheduleChildTableSweep(void) { mNextChildSweepTime = TimerMilli::GetNow(); }
+
     /**
      * Generates an Address Solicit request for a Router ID.
      *
@@ -1375,6 +1384,19 @@ private:
 
     static constexpr uint8_t kMinCriticalChildrenCount = 6;
 
+    // Max number of seconds the periodic child table timeout sweep
+    // may be skipped for, bounding the effect of any event that
+    // shortens a child's expiry without rescheduling the sweep.
+    static constexpr uint32_t kMaxChildSweepSkip = 16; // in sec
+
+    // Budget for MLE Advertisement route digestion per scheduler
+    // slice. Route updates beyond the budget are deferred (coalesced
+    // per router, newest advertisement wins) and digested from a
+    // tasklet, so that advertisement bursts during network-wide
+    // reattach events do not starve data traffic.
+    static constexpr uint8_t kAdvUpdateBudget       = 4;
+    static constexpr uint8_t kNumDeferredAdvEntries = 8;
+
     static constexpr uint16_t kChildSupervisionDefaultIntervalForOlderVersion =
         OPENTHREAD_CONFIG_CHILD_SUPERVISION_OLDER_VERSION_CHILD_DEFAULT_INTERVAL;
 
@@ -1624,8 +1646,9 @@ private:
         Error SendTo(const Ip6::Address &aDestination);
 
     private:
-        Error AppendAddressRegistrationEntry(const Ip6::Address &aAddress);
-        Error AppendDatasetTlv(MeshCoP::Dataset::Type aDatasetType);
+        uint32_t DetermineLinkFrameCounter(void);
+        Error    AppendAddressRegistrationEntry(const Ip6::Address &aAddress);
+        Error    AppendDatasetTlv(MeshCoP::Dataset::Type aDatasetType);
     };
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1968,6 +1991,11 @@ private:
         uint32_t Reattach(void);
 
         Error DetermineParentRequestType(ParentRequestType &aType) const;
+#if OPENTHREAD_CONFIG_MLE_FAST_REATTACH_ENABLE
+        bool  ShouldProbePrevParent(void);
+        void  SendFastProbeToPrevParent(const TxMessage &aMessage);
+        void  HandleFastProbeResponse(const Mac::ExtAddress &aExtAddress);
+#endif
         Error GetNextAnnounceChannel(uint8_t &aChannel) const;
         bool  HasMoreChannelsToAnnounce(void) const;
         void  SendParentRequest(ParentRequestType aType);
@@ -1990,6 +2018,9 @@ private:
         using AttachTimer = TimerMilliIn<Mle, &Mle::HandleAttacherTimer>;
 
         bool                    mReceivedResponseFromParent : 1;
+#if OPENTHREAD_CONFIG_MLE_FAST_REATTACH_ENABLE
+        bool                    mFastProbeActive : 1;
+#endif
         State                   mState;
         AttachMode              mMode;
         ReattachMode            mReattachMode;
@@ -2001,6 +2032,9 @@ private:
         uint16_t                mAnnounceDelay;
         TxChallenge             mParentRequestChallenge;
         ParentCandidate         mParentCandidate;
+#if OPENTHREAD_CONFIG_MLE_FAST_REATTACH_ENABLE
+        Mac::ExtAddress         mPrevParentExtAddress;
+#endif
         AttachTimer             mTimer;
     };
 
@@ -2233,6 +2267,13 @@ private:
         uint8_t mJitter;
     };
 
+    struct DeferredAdv
+    {
+        RouteTlv mRouteTlv;
+        uint8_t  mRouterId;
+        bool     mInUse;
+    };
+
 #endif
 
     //------------------------------------------------------------------------------------------------------------------
@@ -2318,6 +2359,12 @@ private:
     void       InitNeighbor(Neighbor &aNeighbor, const RxInfo &aRxInfo);
     Error      SendDataRequestToParent(void);
     Error      SendDataRequest(const Ip6::Address &aDestination);
+    static constexpr Events::Flags kNotifierEvents =
+        kEventIp6AddressAdded | kEventIp6AddressRemoved | kEventIp6MulticastSubscribed |
+        kEventIp6MulticastUnsubscribed | kEventThreadNetdataChanged | kEventThreadRoleChanged |
+        kEventThreadKeySeqCounterChanged | kEventThreadChildRemoved | kEventSecurityPolicyChanged |
+        kEventSupportedChannelMaskChanged;
+
     void       HandleNotifierEvents(Events aEvents);
     void       HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void       ReestablishLinkWithNeighbor(Neighbor &aNeighbor);
@@ -2427,12 +2474,15 @@ private:
     void     HandleLinkAcceptAndRequest(RxInfo &aRxInfo);
     void     HandleLinkAcceptVariant(RxInfo &aRxInfo, MessageType aMessageType);
     Error    HandleAdvertisementOnFtd(RxInfo &aRxInfo, uint16_t aSourceAddress, const LeaderData &aLeaderData);
+    void     DeferRouteUpdate(const RouteTlv &aRouteTlv, uint8_t aRouterId);
+    void     HandleDeferredAdvTask(void);
     void     HandleParentRequest(RxInfo &aRxInfo);
     void     HandleChildIdRequest(RxInfo &aRxInfo);
     void     HandleChildUpdateRequestOnParent(RxInfo &aRxInfo);
     void     HandleChildUpdateResponseOnParent(RxInfo &aRxInfo);
     void     HandleDataRequest(RxInfo &aRxInfo);
     void     HandleNetworkDataUpdateRouter(void);
+    void     UpdateChildTableOnTimeTick(void);
     void     HandleDiscoveryRequest(RxInfo &aRxInfo);
     void     EstablishRouterLinkOnFtdChild(Router &aRouter, RxInfo &aRxInfo, uint8_t aLinkMargin);
     Error    ProcessRouteTlv(const RouteTlv &aRouteTlv, RxInfo &aRxInfo);
@@ -2494,6 +2544,9 @@ private:
     // Variables
 
     using MleSocket = Ip6::Udp::SocketIn<Mle, &Mle::HandleUdpReceive>;
+#if OPENTHREAD_FTD
+    using DeferredAdvTask = TaskletIn<Mle, &Mle::HandleDeferredAdvTask>;
+#endif
 #if OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_ENABLE
     using WedAttachTimer = TimerMicroIn<Mle, &Mle::HandleWedAttachTimer>;
 #endif
@@ -2504,6 +2557,25 @@ private:
     bool       mRequestRouteTlv : 1;
     bool       mHasRestored : 1;
     bool       mInitiallyAttachedAsSleepy : 1;
+#if OPENTHREAD_CONFIG_MLE_TX_TLV_TEMPLATE_ENABLE
+    struct TxTlvTemplate
+    {
+        // Prebuilt serialized form of the Source Address and Leader
+        // Data TLVs, copied into outgoing MLE messages and rebuilt
+        // only when the RLOC16 or the Leader Data changes.
+
+        static constexpr uint8_t kSrcAddrValueOffset    = sizeof(Tlv);
+        static constexpr uint8_t kLeaderDataValueOffset = 2 * sizeof(Tlv) + sizeof(uint16_t);
+        static constexpr uint8_t kLength                = kLeaderDataValueOffset + sizeof(LeaderDataTlvValue);
+
+        bool     mIsValid;
+        uint16_t mRloc16;
+        uint8_t  mBytes[kLength];
+    };
+
+    void RebuildTxTlvTemplate(const LeaderDataTlvValue &aLeaderDataValue);
+#endif
+
     DeviceRole mRole;
     DeviceRole mLastSavedRole;
     DeviceMode mDeviceMode;
@@ -2517,6 +2589,9 @@ private:
     UptimeSec        mLastAttachTime;
     UptimeMsec       mLastUpdatedTimestamp;
     LeaderData       mLeaderData;
+#if OPENTHREAD_CONFIG_MLE_TX_TLV_TEMPLATE_ENABLE
+    TxTlvTemplate mTxTlvTemplate;
+#endif
     Parent           mParent;
     NeighborTable    mNeighborTable;
     DelayedSender    mDelayedSender;
@@ -2578,6 +2653,10 @@ private:
     ChildTable                 mChildTable;
     RouterTable                mRouterTable;
     RouterRoleTransition       mRouterRoleTransition;
+    uint8_t                    mAdvUpdatesInSlice;
+    DeferredAdv                mDeferredAdvs[kNumDeferredAdvEntries];
+    DeferredAdvTask            mDeferredAdvTask;
+    TimeMilli                  mNextChildSweepTime;
     Ip6::Netif::UnicastAddress mLeaderAloc;
 #if OPENTHREAD_CONFIG_MLE_DEVICE_PROPERTY_LEADER_WEIGHT_ENABLE
     DeviceProperties mDeviceProperties;
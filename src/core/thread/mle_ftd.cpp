@@ -1373,7 +1373,17 @@ Error Mle::HandleAdvertisementOnFtd(RxInfo &aRxInfo, uint16_t aSourceAddress, co
 
     router->SetLastHeard(TimerMilli::GetNow());
 
-    mRouterTable.UpdateRoutes(routeTlv, routerId);
+    if (mAdvUpdatesInSlice < kAdvUpdateBudget)
+    {
+        mAdvUpdatesInSlice++;
+        mRouterTable.UpdateRoutes(routeTlv, routerId);
+    }
+    else
+    {
+        DeferRouteUpdate(routeTlv, routerId);
+    }
+
+    mDeferredAdvTask.Post();
 
 exit:
     if (aRxInfo.mNeighbor && aRxInfo.mNeighbor->GetRloc16() != aSourceAddress)
@@ -1384,6 +1394,88 @@ exit:
     return error;
 }
 
+void Mle::DeferRouteUpdate(const RouteTlv &aRouteTlv, uint8_t aRouterId)
+{
+    DeferredAdv *entry = nullptr;
+
+    for (DeferredAdv &adv : mDeferredAdvs)
+    {
+        if (adv.mInUse && (adv.mRouterId == aRouterId))
+        {
+            // Coalesce: the newest advertisement from a given router
+            // supersedes any earlier deferred one.
+            mCounters.mCoalescedAdvertisements++;
+            entry = &adv;
+            break;
+        }
+
+        if (!adv.mInUse && (entry == nullptr))
+        {
+            entry = &adv;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        // No free entry. Digest the route update immediately (over
+        // budget) rather than dropping it.
+        mRouterTable.UpdateRoutes(aRouteTlv, aRouterId);
+        ExitNow();
+    }
+
+    if (!entry->mInUse)
+    {
+        mCounters.mDeferredAdvertisements++;
+    }
+
+    entry->mInUse    = true;
+    entry->mRouterId = aRouterId;
+    entry->mRouteTlv = aRouteTlv;
+
+exit:
+    return;
+}
+
+void Mle::HandleDeferredAdvTask(void)
+{
+    // Runs after the current scheduler pass, resetting the per-slice
+    // advertisement budget and digesting any deferred route updates
+    // (up to the budget, leaving the rest for the next slice).
+
+    bool hasMore = false;
+
+    mAdvUpdatesInSlice = 0;
+
+    for (DeferredAdv &adv : mDeferredAdvs)
+    {
+        if (!adv.mInUse)
+        {
+            continue;
+        }
+
+        if (mAdvUpdatesInSlice >= kAdvUpdateBudget)
+        {
+            hasMore = true;
+            break;
+        }
+
+        adv.mInUse = false;
+
+        if (!IsRouterOrLeader() || (mRouterTable.FindRouterById(adv.mRouterId) == nullptr))
+        {
+            continue;
+        }
+
+        mAdvUpdatesInSlice++;
+        mRouterTable.UpdateRoutes(adv.mRouteTlv, adv.mRouterId);
+    }
+
+    if (hasMore || (mAdvUpdatesInSlice > 0))
+    {
+        mDeferredAdvTask.Post();
+    }
+}
+
 void Mle::EstablishRouterLinkOnFtdChild(Router &aRouter, RxInfo &aRxInfo, uint8_t aLinkMargin)
 {
     // Decide on an FTD child whether to establish a link with a
@@ -1671,47 +1763,9 @@ void Mle::HandleTimeTick(void)
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Update `ChildTable`
 
-    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+    if (TimerMilli::GetNow() >= mNextChildSweepTime)
     {
-        uint32_t timeout = 0;
-
-        switch (child.GetState())
-        {
-        case Neighbor::kStateInvalid:
-            continue;
-
-        case Neighbor::kStateParentRequest:
-        case Neighbor::kStateChildIdRequest:
-        case Neighbor::kStateValid:
-        case Neighbor::kStateRestored:
-        case Neighbor::kStateChildUpdateRequest:
-            timeout = Time::SecToMsec(child.GetTimeout());
-            break;
-
-        case Neighbor::kStateParentResponse:
-        case Neighbor::kStateLinkRequest:
-            OT_ASSERT(false);
-        }
-
-#if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        if (child.IsCslSynchronized() &&
-            TimerMilli::GetNow() - child.GetCslLastHeard() >= Time::SecToMsec(child.GetCslTimeout()))
-        {
-            LogInfo("Child 0x%04x CSL synchronization expired", child.GetRloc16());
-            child.SetCslSynchronized(false);
-            Get<CslTxScheduler>().Update();
-        }
-#endif
-
-        if (TimerMilli::GetNow() - child.GetLastHeard() >= timeout)
-        {
-            LogInfo("Child 0x%04x timeout expired", child.GetRloc16());
-            RemoveNeighbor(child);
-        }
-        else if (IsRouterOrLeader() && child.IsStateRestored())
-        {
-            IgnoreError(SendChildUpdateRequestToChild(child));
-        }
+        UpdateChildTableOnTimeTick();
     }
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1822,6 +1876,79 @@ exit:
     return;
 }
 
+void Mle::UpdateChildTableOnTimeTick(void)
+{
+    // Sweeps the child table for expired timeouts and determines when
+    // the sweep next needs to run (`mNextChildSweepTime`), letting
+    // `HandleTimeTick()` skip the full-table walk on the (common)
+    // ticks where no child can expire. Hearing from a child only
+    // pushes its expiry further out, so the determined time stays
+    // conservative. It is capped at `kMaxChildSweepSkip` seconds, and
+    // events that may shorten an expiry (e.g., a new child being
+    // added) reset it through `ScheduleChildTableSweep()`.
+
+    TimeMilli now       = TimerMilli::GetNow();
+    TimeMilli nextSweep = now + Time::SecToMsec(kMaxChildSweepSkip);
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+    {
+        uint32_t timeout = 0;
+
+        switch (child.GetState())
+        {
+        case Neighbor::kStateInvalid:
+            continue;
+
+        case Neighbor::kStateParentRequest:
+        case Neighbor::kStateChildIdRequest:
+        case Neighbor::kStateValid:
+        case Neighbor::kStateRestored:
+        case Neighbor::kStateChildUpdateRequest:
+            timeout = Time::SecToMsec(child.GetTimeout());
+            break;
+
+        case Neighbor::kStateParentResponse:
+        case Neighbor::kStateLinkRequest:
+            OT_ASSERT(false);
+        }
+
+#if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
+        if (child.IsCslSynchronized())
+        {
+            if (now - child.GetCslLastHeard() >= Time::SecToMsec(child.GetCslTimeout()))
+            {
+                LogInfo("Child 0x%04x CSL synchronization expired", child.GetRloc16());
+                child.SetCslSynchronized(false);
+                Get<CslTxScheduler>().Update();
+            }
+            else
+            {
+                nextSweep = Min(nextSweep, child.GetCslLastHeard() + Time::SecToMsec(child.GetCslTimeout()));
+            }
+        }
+#endif
+
+        if (now - child.GetLastHeard() >= timeout)
+        {
+            LogInfo("Child 0x%04x timeout expired", child.GetRloc16());
+            RemoveNeighbor(child);
+        }
+        else if (IsRouterOrLeader() && child.IsStateRestored())
+        {
+            IgnoreError(SendChildUpdateRequestToChild(child));
+
+            // Restored children are serviced on every tick.
+            nextSweep = now;
+        }
+        else
+        {
+            nextSweep = Min(nextSweep, child.GetLastHeard() + timeout);
+        }
+    }
+
+    mNextChildSweepTime = nextSweep;
+}
+
 void Mle::SendParentResponse(const ParentResponseInfo &aInfo)
 {
     Error        error   = kErrorNone;
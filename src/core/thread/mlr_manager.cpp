@@ -46,6 +46,7 @@ MlrManager::MlrManager(Instance &aInstance)
     , mReregistrationDelay(0)
     , mSendDelay(0)
     , mMlrPending(false)
+    , mMlrFullPayload(false)
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
     , mRegisterPending(false)
 #endif
@@ -169,7 +170,7 @@ exit:
 
     if (aChild.HasAnyMlrToRegisterAddress())
     {
-        ScheduleSend(Random::NonCrypto::GetUint16InRange(1, BackboneRouter::kParentAggregateDelay));
+        ScheduleSend(Random::NonCrypto::GetUint16InRange(1, kAggregationDelay));
     }
 }
 
@@ -275,7 +276,8 @@ void MlrManager::SendMlr(void)
     SuccessOrExit(
         error = SendMlrMessage(addresses.GetArrayBuffer(), addresses.GetLength(), nullptr, HandleMlrResponse, this));
 
-    mMlrPending = true;
+    mMlrPending     = true;
+    mMlrFullPayload = addresses.IsFull();
 
     // Generally Thread 1.2 Router would send MLR.req on behalf for MA (scope >=4) subscribed by its MTD child.
     // When Thread 1.2 MTD attaches to Thread 1.1 parent, 1.2 MTD should send MLR.req to PBBR itself.
@@ -419,8 +421,20 @@ void MlrManager::HandleMlrResponse(Coap::Msg *aMsg, Error aResult)
 
     if (error == kErrorNone && status == kMlrSuccess)
     {
-        // keep sending until all multicast addresses are registered.
-        ScheduleSend(0);
+        if (mMlrFullPayload)
+        {
+            // The previous MLR.req used a full address list, so a backlog
+            // likely remains; keep draining back-to-back until all
+            // multicast addresses are registered.
+            ScheduleSend(0);
+        }
+        else if (HasPendingMlrRegistration())
+        {
+            // Addresses arrived while the MLR.req was in flight. Apply the
+            // aggregation delay so they batch with any still trickling in
+            // rather than each triggering its own small transaction.
+            ScheduleSend(Random::NonCrypto::GetUint16InRange(1, kAggregationDelay));
+        }
     }
     else
     {
@@ -472,6 +486,33 @@ exit:
     return aResult != kErrorNone ? aResult : error;
 }
 
+bool MlrManager::HasPendingMlrRegistration(void) const
+{
+    bool ret = false;
+
+#if OPENTHREAD_CONFIG_MLR_ENABLE
+    for (const Ip6::Netif::MulticastAddress &addr : Get<ThreadNetif>().GetMulticastAddresses())
+    {
+        if (addr.Matches(kMlrStateToRegister))
+        {
+            ExitNow(ret = true);
+        }
+    }
+#endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
+    for (const Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        if (child.HasAnyMlrToRegisterAddress())
+        {
+            ExitNow(ret = true);
+        }
+    }
+#endif
+
+exit:
+    return ret;
+}
+
 void MlrManager::SetMulticastAddressMlrState(MlrState aFromState, MlrState aToState)
 {
 #if OPENTHREAD_CONFIG_MLR_ENABLE
@@ -141,6 +141,10 @@ public:
 #endif
 
 private:
+    static constexpr uint16_t kAggregationDelay = OPENTHREAD_CONFIG_MLR_AGGREGATION_DELAY; // In seconds.
+
+    static_assert(kAggregationDelay > 1, "OPENTHREAD_CONFIG_MLR_AGGREGATION_DELAY must be larger than 1 second");
+
     class AddressArray : public Array<Ip6::Address, Ip6AddressesTlv::kMaxAddresses>
     {
     public:
@@ -148,6 +152,8 @@ private:
         void AddUnique(const Ip6::Address &aAddress);
     };
 
+    static constexpr Events::Flags kNotifierEvents = kEventIp6MulticastSubscribed | kEventThreadRoleChanged;
+
     void HandleNotifierEvents(Events aEvents);
 
     void  SendMlr(void);
@@ -178,6 +184,7 @@ private:
     bool IsAddressMlrRegisteredByAnyChildExcept(const Ip6::Address &aAddress, const Child *aExceptChild) const;
 #endif
 
+    bool HasPendingMlrRegistration(void) const;
     void SetMulticastAddressMlrState(MlrState aFromState, MlrState aToState);
     void FinishMlr(bool aSuccess, const AddressArray &aFailedAddresses);
 
@@ -199,6 +206,7 @@ private:
     uint16_t mSendDelay;
 
     bool mMlrPending : 1;
+    bool mMlrFullPayload : 1;
 #if (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE) && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
     bool mRegisterPending : 1;
 #endif
@@ -251,6 +251,38 @@ exit:
     return error;
 }
 
+void NeighborTable::GetStats(otNeighborTableStats &aStats) const
+{
+    TimeMilli now = TimerMilli::GetNow();
+
+    ClearAllBytes(aStats);
+
+    for (const Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
+    {
+        uint32_t ageInSec = Time::MsecToSec(now - child.GetLastHeard());
+
+        aStats.mNumChildren++;
+        aStats.mAgeBuckets[Min<uint32_t>(ageInSec / OT_NEIGHBOR_TABLE_AGE_BUCKET_WIDTH,
+                                         OT_NEIGHBOR_TABLE_AGE_BUCKETS - 1)]++;
+    }
+
+    for (const Router &router : Get<RouterTable>())
+    {
+        uint32_t ageInSec;
+
+        if (!router.IsStateValid() || Get<Mle::Mle>().HasRloc16(router.GetRloc16()))
+        {
+            continue;
+        }
+
+        ageInSec = Time::MsecToSec(now - router.GetLastHeard());
+
+        aStats.mNumRouterNeighbors++;
+        aStats.mAgeBuckets[Min<uint32_t>(ageInSec / OT_NEIGHBOR_TABLE_AGE_BUCKET_WIDTH,
+                                         OT_NEIGHBOR_TABLE_AGE_BUCKETS - 1)]++;
+    }
+}
+
 #endif // OPENTHREAD_FTD
 
 #if OPENTHREAD_MTD
@@ -276,6 +308,21 @@ exit:
 
 void NeighborTable::Signal(Event aEvent, const Neighbor &aNeighbor)
 {
+#if OPENTHREAD_FTD
+    switch (aEvent)
+    {
+    case kChildAdded:
+    case kChildModeChanged:
+        // May shorten a child's expiry time, so make sure the child
+        // table timeout sweep runs on the next time tick.
+        Get<Mle::Mle>().ScheduleChildTableSweep();
+        break;
+
+    default:
+        break;
+    }
+#endif
+
 #if !OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
     if (mCallback != nullptr)
 #endif
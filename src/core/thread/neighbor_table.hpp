@@ -189,6 +189,13 @@ public:
      */
     Neighbor *FindRxOnlyNeighborRouter(const Mac::Address &aMacAddress);
 
+    /**
+     * Gets statistics about the neighbor table, including the distribution of neighbors by last-heard age.
+     *
+     * @param[out]  aStats  A reference to an `otNeighborTableStats` to populate.
+     */
+    void GetStats(otNeighborTableStats &aStats) const;
+
 #endif // OPENTHREAD_FTD
 
     /**
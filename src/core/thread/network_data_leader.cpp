@@ -33,6 +33,7 @@
 
 #include "network_data_leader.hpp"
 
+#include "common/crc.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -43,6 +44,10 @@ RegisterLogModule("NetworkData");
 Leader::Leader(Instance &aInstance)
     : MutableNetworkData(aInstance, mTlvBuffer, 0, sizeof(mTlvBuffer))
     , mMaxLength(0)
+    , mChangedCategories(0)
+    , mPrefixesDigest(0)
+    , mRoutesDigest(0)
+    , mServicesDigest(0)
 #if OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
     , mIsClone(false)
@@ -50,6 +55,9 @@ Leader::Leader(Instance &aInstance)
     , mWaitingForNetDataSync(false)
     , mContextIds(aInstance)
     , mTimer(aInstance)
+#if OPENTHREAD_CONFIG_NETDATA_LEADER_COMMIT_AGGREGATION_WINDOW > 0
+    , mCommitTimer(aInstance)
+#endif
 #endif
 {
     Reset();
@@ -688,9 +696,145 @@ Error Leader::SteeringDataCheckJoiner(const MeshCoP::JoinerDiscerner &aDiscerner
 void Leader::SignalNetDataChanged(void)
 {
     mMaxLength = Max(mMaxLength, GetLength());
+#if OPENTHREAD_CONFIG_NETDATA_PARSED_VIEW_ENABLE
+    RebuildParsedView();
+#endif
+    UpdateChangedCategories();
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_PARSED_VIEW_ENABLE
+
+void Leader::RebuildParsedView(void)
+{
+    Iterator iterator;
+
+    mParsedView.mIsValid     = false;
+    mParsedView.mNumPrefixes = 0;
+    mParsedView.mNumRoutes   = 0;
+    mParsedView.mNumServices = 0;
+
+    iterator = kIteratorInit;
+
+    while (NetworkData::GetNext(iterator, mParsedView.mPrefixes[mParsedView.mNumPrefixes]) == kErrorNone)
+    {
+        mParsedView.mNumPrefixes++;
+        VerifyOrExit(mParsedView.mNumPrefixes < ParsedView::kMaxPrefixes);
+    }
+
+    iterator = kIteratorInit;
+
+    while (NetworkData::GetNext(iterator, mParsedView.mRoutes[mParsedView.mNumRoutes]) == kErrorNone)
+    {
+        mParsedView.mNumRoutes++;
+        VerifyOrExit(mParsedView.mNumRoutes < ParsedView::kMaxRoutes);
+    }
+
+    iterator = kIteratorInit;
+
+    while (NetworkData::GetNext(iterator, mParsedView.mServices[mParsedView.mNumServices]) == kErrorNone)
+    {
+        mParsedView.mNumServices++;
+        VerifyOrExit(mParsedView.mNumServices < ParsedView::kMaxServices);
+    }
+
+    mParsedView.mIsValid = true;
+
+exit:
+    return;
+}
+
+Error Leader::GetNextViewEntry(Iterator &aIterator, OnMeshPrefixConfig &aEntry) const
+{
+    Error error = kErrorNotFound;
+
+    VerifyOrExit(aIterator < mParsedView.mNumPrefixes);
+    aEntry = mParsedView.mPrefixes[aIterator++];
+    error  = kErrorNone;
+
+exit:
+    return error;
+}
+
+Error Leader::GetNextViewEntry(Iterator &aIterator, ExternalRouteConfig &aEntry) const
+{
+    Error error = kErrorNotFound;
+
+    VerifyOrExit(aIterator < mParsedView.mNumRoutes);
+    aEntry = mParsedView.mRoutes[aIterator++];
+    error  = kErrorNone;
+
+exit:
+    return error;
+}
+
+Error Leader::GetNextViewEntry(Iterator &aIterator, ServiceConfig &aEntry) const
+{
+    Error error = kErrorNotFound;
+
+    VerifyOrExit(aIterator < mParsedView.mNumServices);
+    aEntry = mParsedView.mServices[aIterator++];
+    error  = kErrorNone;
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_PARSED_VIEW_ENABLE
+
+void Leader::UpdateChangedCategories(void)
+{
+    // Determines which categories of entries differ from the last
+    // signaled update by comparing per-category digests.
+
+    uint32_t prefixesDigest = DetermineCategoryDigest<OnMeshPrefixConfig>();
+    uint32_t routesDigest   = DetermineCategoryDigest<ExternalRouteConfig>();
+    uint32_t servicesDigest = DetermineCategoryDigest<ServiceConfig>();
+
+    mChangedCategories = 0;
+
+    if (prefixesDigest != mPrefixesDigest)
+    {
+        mChangedCategories |= kPrefixesChanged;
+    }
+
+    if (routesDigest != mRoutesDigest)
+    {
+        mChangedCategories |= kRoutesChanged;
+    }
+
+    if (servicesDigest != mServicesDigest)
+    {
+        mChangedCategories |= kServicesChanged;
+    }
+
+    mPrefixesDigest = prefixesDigest;
+    mRoutesDigest   = routesDigest;
+    mServicesDigest = servicesDigest;
+}
+
+template <typename EntryType> uint32_t Leader::DetermineCategoryDigest(void) const
+{
+    // Calculates a digest over all entries of `EntryType` in the
+    // current Network Data. The entry is cleared before each
+    // `GetNext()` call so that bytes not populated by the parsed
+    // entry hold a deterministic (zero) value.
+
+    CrcCalculator<uint32_t> crc(kCrc32AnsiPolynomial);
+    Iterator                iterator = kIteratorInit;
+    EntryType               entry;
+
+    entry.Clear();
+
+    while (GetNext(iterator, entry) == kErrorNone)
+    {
+        crc.Feed(entry);
+        entry.Clear();
+    }
+
+    return crc.GetCrc();
+}
+
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
 bool Leader::ContainsOmrPrefix(const Ip6::Prefix &aPrefix) const
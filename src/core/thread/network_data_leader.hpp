@@ -97,6 +97,28 @@ public:
      */
     void ResetMaxLength(void) { mMaxLength = GetLength(); }
 
+    /**
+     * Represents categories of Network Data entries, used to report which categories changed in the most recent
+     * update (see `GetChangedCategories()`).
+     */
+    enum CategoryFlag : uint8_t
+    {
+        kPrefixesChanged = (1U << 0), ///< One or more on-mesh prefix entries changed.
+        kRoutesChanged   = (1U << 1), ///< One or more external route entries changed.
+        kServicesChanged = (1U << 2), ///< One or more service entries changed.
+    };
+
+    /**
+     * Returns which categories of entries changed in the most recent Network Data update.
+     *
+     * Intended for use by handlers of `kEventThreadNetdataChanged` to skip reprocessing when no entry of the
+     * category they consume has changed. The per-category change detection is digest (CRC) based and may rarely
+     * over-report a category as changed (e.g., when entries are reordered with no content change).
+     *
+     * @returns Bitwise OR of `CategoryFlag` values indicating the changed categories.
+     */
+    uint8_t GetChangedCategories(void) const { return mChangedCategories; }
+
     /**
      * Returns the Data Version value for a type (full set or stable subset).
      *
@@ -106,6 +128,43 @@ public:
      */
     uint8_t GetVersion(Type aType) const { return (aType == kFullSet) ? mVersion : mStableVersion; }
 
+#if OPENTHREAD_CONFIG_NETDATA_PARSED_VIEW_ENABLE
+    /**
+     * Gets the next Network Data entry of a specific type (e.g., on-mesh prefix, external route, service).
+     *
+     * Behaves as `NetworkData::GetNext()`, but reads the entry from the parsed view of the Leader Network Data
+     * when the view is usable, avoiding re-parsing the raw TLVs on every call. The entries and their order are
+     * the same in both cases.
+     *
+     * @param[in,out] aIterator  A reference to an iterator to track the current position in the Network Data.
+     * @param[out]    aEntry     A reference to an object to populate with the retrieved entry's information.
+     *
+     * @retval kErrorNone      Successfully found the next entry and populated @p aEntry.
+     * @retval kErrorNotFound  No subsequent entry of the requested type exists in the Thread Network Data.
+     */
+    template <typename EntryType> Error GetNext(Iterator &aIterator, EntryType &aEntry) const
+    {
+        return mParsedView.mIsValid ? GetNextViewEntry(aIterator, aEntry) : NetworkData::GetNext(aIterator, aEntry);
+    }
+
+    /**
+     * Gets the next Network Data entry of a specific type associated with a given RLOC16.
+     *
+     * Forwards to `NetworkData::GetNext()` (the parsed view does not track per-RLOC16 association).
+     *
+     * @param[in,out] aIterator  An iterator to track the current position in the Network Data.
+     * @param[in]     aRloc16    The RLOC16 to filter entries by.
+     * @param[out]    aEntry     An object to populate with the retrieved entry's information.
+     *
+     * @retval kErrorNone      Successfully found the next entry and populated @p aEntry.
+     * @retval kErrorNotFound  No subsequent entry of the requested type exists in the Thread Network Data.
+     */
+    template <typename EntryType> Error GetNext(Iterator &aIterator, uint16_t aRloc16, EntryType &aEntry) const
+    {
+        return NetworkData::GetNext(aIterator, aRloc16, aEntry);
+    }
+#endif // OPENTHREAD_CONFIG_NETDATA_PARSED_VIEW_ENABLE
+
     /**
      * Retrieves the 6LoWPAN Context information for a given IPv6 address.
      *
@@ -451,6 +510,42 @@ private:
     Error SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
     Error ReadCommissioningDataUint16SubTlv(MeshCoP::Tlv::Type aType, uint16_t &aValue) const;
     void  SignalNetDataChanged(void);
+    void  UpdateChangedCategories(void);
+
+#if OPENTHREAD_CONFIG_NETDATA_PARSED_VIEW_ENABLE
+    struct ParsedView
+    {
+        // Typed copies of the entries in the Leader Network Data,
+        // kept in the same order as the raw TLVs so that iteration
+        // through the view matches iteration through the TLVs. When
+        // the entries do not fit in the arrays, the view is marked
+        // as unusable and iteration falls back to TLV parsing.
+
+        static constexpr uint8_t kMaxPrefixes = 16;
+        static constexpr uint8_t kMaxRoutes   = 16;
+        static constexpr uint8_t kMaxServices = 4;
+
+        bool                mIsValid;
+        uint8_t             mNumPrefixes;
+        uint8_t             mNumRoutes;
+        uint8_t             mNumServices;
+        OnMeshPrefixConfig  mPrefixes[kMaxPrefixes];
+        ExternalRouteConfig mRoutes[kMaxRoutes];
+        ServiceConfig       mServices[kMaxServices];
+    };
+
+    void  RebuildParsedView(void);
+    Error GetNextViewEntry(Iterator &aIterator, OnMeshPrefixConfig &aEntry) const;
+    Error GetNextViewEntry(Iterator &aIterator, ExternalRouteConfig &aEntry) const;
+    Error GetNextViewEntry(Iterator &aIterator, ServiceConfig &aEntry) const;
+    Error GetNextViewEntry(Iterator &aIterator, LowpanContextInfo &aEntry) const
+    {
+        // Context entries are not materialized in the view.
+        return NetworkData::GetNext(aIterator, aEntry);
+    }
+#endif // OPENTHREAD_CONFIG_NETDATA_PARSED_VIEW_ENABLE
+
+    template <typename EntryType> uint32_t DetermineCategoryDigest(void) const;
     const CommissioningDataTlv *FindCommissioningData(void) const;
     CommissioningDataTlv *FindCommissioningData(void) { return AsNonConst(AsConst(this)->FindCommissioningData()); }
     const MeshCoP::Tlv   *FindCommissioningDataSubTlv(uint8_t aType) const;
@@ -548,6 +643,10 @@ private:
 
     void HandleTimer(void);
 
+#if OPENTHREAD_CONFIG_NETDATA_LEADER_COMMIT_AGGREGATION_WINDOW > 0
+    void HandleCommitTimer(void);
+#endif
+
     static bool IsEntryForDhcp6Agent(const BorderRouterEntry &aEntry);
     static bool IsEntryForNdAgent(const BorderRouterEntry &aEntry);
 
@@ -627,6 +726,9 @@ private:
 #endif
 
     using UpdateTimer = TimerMilliIn<Leader, &Leader::HandleTimer>;
+#if OPENTHREAD_CONFIG_NETDATA_LEADER_COMMIT_AGGREGATION_WINDOW > 0
+    using CommitTimer = TimerMilliIn<Leader, &Leader::HandleCommitTimer>;
+#endif
 #endif // OPENTHREAD_FTD
 
     uint8_t mStableVersion;
@@ -634,6 +736,15 @@ private:
     uint8_t mTlvBuffer[kMaxSize];
     uint8_t mMaxLength;
 
+    uint8_t  mChangedCategories;
+    uint32_t mPrefixesDigest;
+    uint32_t mRoutesDigest;
+    uint32_t mServicesDigest;
+
+#if OPENTHREAD_CONFIG_NETDATA_PARSED_VIEW_ENABLE
+    ParsedView mParsedView;
+#endif
+
 #if OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
     bool mIsClone;
@@ -641,6 +752,9 @@ private:
     bool        mWaitingForNetDataSync;
     ContextIds  mContextIds;
     UpdateTimer mTimer;
+#if OPENTHREAD_CONFIG_NETDATA_LEADER_COMMIT_AGGREGATION_WINDOW > 0
+    CommitTimer mCommitTimer;
+#endif
 #endif
 };
 
@@ -92,13 +92,32 @@ void Leader::IncrementVersions(bool aIncludeStable)
     }
 
     mVersion++;
+
+#if OPENTHREAD_CONFIG_NETDATA_LEADER_COMMIT_AGGREGATION_WINDOW > 0
+    // Versions are incremented per change, but signaling the change
+    // (which triggers delta propagation to the rest of the network) is
+    // aggregated over a short window, so that a burst of concurrent
+    // server data registrations results in a single propagation wave.
+    // The window is anchored at the first change, bounding the delay.
+
+    if (!mCommitTimer.IsRunning())
+    {
+        mCommitTimer.Start(OPENTHREAD_CONFIG_NETDATA_LEADER_COMMIT_AGGREGATION_WINDOW);
+    }
+#else
     SignalNetDataChanged();
+#endif
+
     ExitNow();
 
 exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_LEADER_COMMIT_AGGREGATION_WINDOW > 0
+void Leader::HandleCommitTimer(void) { SignalNetDataChanged(); }
+#endif
+
 Error Leader::AnycastLookup(uint16_t aAloc16, uint16_t &aRloc16) const
 {
     Error error = kErrorNone;
@@ -130,6 +130,9 @@ private:
     Error UpdateInconsistentData(void);
 #endif
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged | kEventThreadRoleChanged |
+        kEventThreadChildRemoved | kEventThreadPartitionIdChanged;
+
     void HandleNotifierEvents(Events aEvents);
     void HandleTimer(void);
 
@@ -557,6 +557,9 @@ private:
 #endif
 
     TimerMilli &GetTimer(void) { return mTimer; }
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged | kEventThreadRoleChanged |
+        kEventThreadMeshLocalAddrChanged;
+
     void        HandleNotifierEvents(Events aEvents);
     void        HandleTimer(void);
 
@@ -553,6 +553,8 @@ private:
     Error RemoveService(uint8_t aServiceNumber) { return RemoveService(&aServiceNumber, sizeof(uint8_t)); }
     Error RemoveService(const void *aServiceData, uint8_t aServiceDataLength);
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged;
+
     void         HandleNotifierEvents(Events aEvents);
     ServiceAloc *FindInServiceAlocs(uint16_t aAloc16);
 
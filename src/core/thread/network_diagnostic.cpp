@@ -33,6 +33,7 @@
 
 #include "network_diagnostic.hpp"
 
+#include "common/crc.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -47,7 +48,16 @@ namespace NetworkDiagnostic {
 Server::Server(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mNonPreferredChannels(0)
+#if OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE
+    , mDeltaEvictIndex(0)
+#endif
 {
+#if OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE
+    for (DeltaRequester &requester : mDeltaRequesters)
+    {
+        requester.Clear();
+    }
+#endif
 }
 
 Error Server::AppendIp6AddressList(Message &aMessage)
@@ -279,6 +289,139 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE
+
+Error Server::AppendRequestedTlvsWithDelta(const Message &aRequest, const Ip6::Address &aPeerAddr, Message &aResponse)
+{
+    Error               error;
+    TlvTypeListIterator iterator;
+    uint8_t             tlvType;
+    uint16_t            cookie;
+    bool                canSkip;
+    DeltaRequester     *requester;
+
+    // Delta mode applies only when the requester includes a Delta
+    // Generation TLV echoing the cookie from the previous answer.
+    // Otherwise the full response is prepared as usual.
+
+    if (Tlv::Find<DeltaGenerationTlv>(aRequest, cookie) != kErrorNone)
+    {
+        error = AppendRequestedTlvs(aRequest, aResponse);
+        ExitNow();
+    }
+
+    requester = FindDeltaRequester(aPeerAddr);
+
+    // Unchanged TLVs can be omitted only when the echoed cookie
+    // matches the generation of the last answer sent to this
+    // requester. On any mismatch (first contact, evicted entry, or a
+    // restarted requester) the full response is sent and the tracked
+    // checksums are rebuilt.
+
+    canSkip = (requester != nullptr) && (requester->mGeneration == cookie);
+
+    if (requester == nullptr)
+    {
+        requester = AllocateDeltaRequester(aPeerAddr);
+    }
+
+    requester->mGeneration++;
+    SuccessOrExit(error = Tlv::Append<DeltaGenerationTlv>(aResponse, requester->mGeneration));
+
+    SuccessOrExit(error = iterator.InitForTypeListTlv(aRequest));
+
+    while (iterator.ReadNextTlvType(tlvType) == kErrorNone)
+    {
+        uint16_t                startOffset = aResponse.GetLength();
+        OffsetRange             offsetRange;
+        CrcCalculator<uint16_t> crcCalculator(kCrc16AnsiPolynomial);
+        uint16_t                crc;
+        uint16_t               *checksum = nullptr;
+
+        SuccessOrExit(error = AppendDiagTlv(tlvType, aResponse));
+
+        offsetRange.InitFromRange(startOffset, aResponse.GetLength());
+        crc = crcCalculator.Feed(aResponse, offsetRange);
+
+        for (uint8_t index = 0; index < requester->mNumTlvs; index++)
+        {
+            if (requester->mTlvTypes[index] == tlvType)
+            {
+                checksum = &requester->mTlvChecksums[index];
+                break;
+            }
+        }
+
+        if (checksum != nullptr)
+        {
+            if (canSkip && (*checksum == crc))
+            {
+                // Unchanged since last answer - remove the appended TLV.
+                IgnoreError(aResponse.SetLength(startOffset));
+            }
+            else
+            {
+                *checksum = crc;
+            }
+        }
+        else if (requester->mNumTlvs < kNumDeltaTrackedTlvs)
+        {
+            requester->mTlvTypes[requester->mNumTlvs]     = tlvType;
+            requester->mTlvChecksums[requester->mNumTlvs] = crc;
+            requester->mNumTlvs++;
+        }
+
+        // An untracked TLV (checksum table full) is always included.
+    }
+
+exit:
+    return error;
+}
+
+Server::DeltaRequester *Server::FindDeltaRequester(const Ip6::Address &aAddress)
+{
+    DeltaRequester *match = nullptr;
+
+    for (DeltaRequester &requester : mDeltaRequesters)
+    {
+        if (requester.IsInUse() && (requester.mAddress == aAddress))
+        {
+            match = &requester;
+            break;
+        }
+    }
+
+    return match;
+}
+
+Server::DeltaRequester *Server::AllocateDeltaRequester(const Ip6::Address &aAddress)
+{
+    DeltaRequester *entry = nullptr;
+
+    for (DeltaRequester &requester : mDeltaRequesters)
+    {
+        if (!requester.IsInUse())
+        {
+            entry = &requester;
+            break;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        // All entries are in use - evict in round-robin order.
+        entry            = &mDeltaRequesters[mDeltaEvictIndex];
+        mDeltaEvictIndex = static_cast<uint8_t>((mDeltaEvictIndex + 1) % kNumDeltaRequesters);
+    }
+
+    entry->Clear();
+    entry->mAddress = aAddress;
+
+    return entry;
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE
+
 #if OPENTHREAD_CONFIG_BLE_TCAT_ENABLE
 Error Server::AppendRequestedTlvsForTcat(const Message &aRequest, Message &aResponse, OffsetRange &aOffsetRange)
 {
@@ -795,7 +938,11 @@ template <> void Server::HandleTmf<kUriDiagnosticGetRequest>(Coap::Msg &aMsg)
     VerifyOrExit(response != nullptr, error = kErrorNoBufs);
 
     IgnoreError(response->SetPriority(aMsg.mMessage.GetPriority()));
+#if OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE
+    SuccessOrExit(error = AppendRequestedTlvsWithDelta(aMsg.mMessage, aMsg.mMessageInfo.GetPeerAddr(), *response));
+#else
     SuccessOrExit(error = AppendRequestedTlvs(aMsg.mMessage, *response));
+#endif
     SuccessOrExit(error = Get<Tmf::Agent>().SendMessage(*response, aMsg.mMessageInfo));
 
 exit:
@@ -139,10 +139,32 @@ private:
         BitSet<NumericLimits<uint8_t>::kMax + 1> mProcessedTlvs;
     };
 
+#if OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE
+    static constexpr uint16_t kNumDeltaRequesters  = 4;
+    static constexpr uint16_t kNumDeltaTrackedTlvs = 16;
+
+    struct DeltaRequester : public Clearable<DeltaRequester>
+    {
+        bool IsInUse(void) const { return !mAddress.IsUnspecified(); }
+
+        Ip6::Address mAddress;                            // Requester address (unspecified when unused).
+        uint16_t     mGeneration;                         // Generation cookie of the last answer sent.
+        uint8_t      mNumTlvs;                            // Number of entries in use in the arrays below.
+        uint8_t      mTlvTypes[kNumDeltaTrackedTlvs];     // TLV types previously sent to the requester.
+        uint16_t     mTlvChecksums[kNumDeltaTrackedTlvs]; // Checksum of the last sent value per TLV type.
+    };
+#endif
+
     Error AppendDiagTlv(uint8_t aTlvType, Message &aMessage);
     Error AppendIp6AddressList(Message &aMessage);
     Error AppendRequestedTlvs(const Message &aRequest, Message &aResponse);
 
+#if OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE
+    Error AppendRequestedTlvsWithDelta(const Message &aRequest, const Ip6::Address &aPeerAddr, Message &aResponse);
+    DeltaRequester *FindDeltaRequester(const Ip6::Address &aAddress);
+    DeltaRequester *AllocateDeltaRequester(const Ip6::Address &aAddress);
+#endif
+
 #if OPENTHREAD_CONFIG_BLE_TCAT_ENABLE
     Error AppendRequestedTlvsForTcat(const Message &aRequest, Message &aResponse, OffsetRange &aOffsetRange);
 #endif
@@ -183,6 +205,10 @@ private:
 #endif
     uint32_t                                    mNonPreferredChannels;
     Callback<NonPreferredChannelsResetCallback> mNonPreferredChannelsResetCallback;
+#if OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE
+    uint8_t        mDeltaEvictIndex;
+    DeltaRequester mDeltaRequesters[kNumDeltaRequesters];
+#endif
 };
 
 DeclareTmfHandler(Server, kUriDiagnosticGetRequest);
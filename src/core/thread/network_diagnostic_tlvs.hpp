@@ -105,6 +105,9 @@ public:
         kBrDhcp6PdOmrPrefix    = OT_NETWORK_DIAGNOSTIC_TLV_BR_DHCP6_PD_OMR_PREFIX,
         kBrLocalOnlinkPrefix   = OT_NETWORK_DIAGNOSTIC_TLV_BR_LOCAL_OL_PREFIX,
         kBrFavoredOnLinkPrefix = OT_NETWORK_DIAGNOSTIC_TLV_BR_FAVORED_OL_PREFIX,
+#if OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE
+        kDeltaGeneration       = 240, // Delta generation cookie (vendor extension, not in Thread spec).
+#endif
     };
 
     /**
@@ -203,6 +206,13 @@ typedef UintTlvInfo<Tlv::kMaxChildTimeout, uint32_t> MaxChildTimeoutTlv;
  */
 typedef SimpleTlvInfo<Tlv::kEui64, Mac::ExtAddress> Eui64Tlv;
 
+#if OPENTHREAD_CONFIG_TMF_NETDIAG_DELTA_RESPONSE_ENABLE
+/**
+ * Defines Delta Generation TLV constants and types (vendor extension).
+ */
+typedef UintTlvInfo<Tlv::kDeltaGeneration, uint16_t> DeltaGenerationTlv;
+#endif
+
 /**
  * Defines Version TLV constants and types.
  */
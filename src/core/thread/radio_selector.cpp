@@ -55,6 +55,9 @@ const Mac::RadioType RadioSelector::sRadioSelectionOrder[Mac::kNumRadioTypes] =
 RadioSelector::RadioSelector(Instance &aInstance)
     : InstanceLocator(aInstance)
 {
+#if OPENTHREAD_CONFIG_MULTI_RADIO_TRAFFIC_STEERING_ENABLE
+    ClearAllBytes(mTxBytes);
+#endif
 }
 
 void RadioSelector::NeighborInfo::PopulateMultiRadioInfo(MultiRadioInfo &aInfo)
@@ -132,6 +135,10 @@ void RadioSelector::UpdateOnSendDone(Mac::TxFrame &aFrame, Error aTxError)
     Mac::Address   macDest;
     Neighbor      *neighbor;
 
+#if OPENTHREAD_CONFIG_MULTI_RADIO_TRAFFIC_STEERING_ENABLE
+    mTxBytes[radioType] += aFrame.GetLength();
+#endif
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     if (radioType == Mac::kRadioTypeTrel)
     {
@@ -251,6 +258,34 @@ Mac::RadioType RadioSelector::Select(Mac::RadioTypes aRadioOptions, const Neighb
     return selectedRadio;
 }
 
+#if OPENTHREAD_CONFIG_MULTI_RADIO_TRAFFIC_STEERING_ENABLE
+
+Mac::RadioType RadioSelector::SteerTraffic(const Message  &aMessage,
+                                           const Neighbor &aNeighbor,
+                                           Mac::RadioType  aSelectedRadio)
+{
+    // Steer traffic classes onto different radio links when the
+    // desired link is usable (high preference) for the neighbor:
+    // latency-critical MLE traffic is kept on the IEEE 802.15.4 link,
+    // while bulk (data) traffic is steered onto the higher-throughput
+    // TREL link. Otherwise, the preference-based selection is kept.
+
+    Mac::RadioType radio     = aSelectedRadio;
+    Mac::RadioType preferred = aMessage.IsSubTypeMle() ? Mac::kRadioTypeIeee802154 : Mac::kRadioTypeTrel;
+
+    VerifyOrExit(preferred != aSelectedRadio);
+    VerifyOrExit(aNeighbor.GetSupportedRadioTypes().Contains(preferred));
+    VerifyOrExit(aNeighbor.GetRadioPreference(preferred) >= kHighPreference);
+
+    radio = preferred;
+    Log(kLogLevelDebg, aMessage.IsSubTypeMle() ? "Steer(Mle)" : "Steer(Bulk)", radio, aNeighbor);
+
+exit:
+    return radio;
+}
+
+#endif // OPENTHREAD_CONFIG_MULTI_RADIO_TRAFFIC_STEERING_ENABLE
+
 Mac::TxFrame &RadioSelector::SelectRadio(Message &aMessage, const Mac::Address &aMacDest, Mac::TxFrames &aTxFrames)
 {
     Neighbor       *neighbor;
@@ -288,6 +323,9 @@ Mac::TxFrame &RadioSelector::SelectRadio(Message &aMessage, const Mac::Address &
     }
 
     selectedRadio = Select(neighbor->GetSupportedRadioTypes(), *neighbor);
+#if OPENTHREAD_CONFIG_MULTI_RADIO_TRAFFIC_STEERING_ENABLE
+    selectedRadio = SteerTraffic(aMessage, *neighbor, selectedRadio);
+#endif
     selections.Add(selectedRadio);
 
     Log(kLogLevelDebg, "SelectRadio", selectedRadio, *neighbor);
@@ -171,6 +171,17 @@ public:
      */
     Mac::TxFrame &SelectRadio(Message &aMessage, const Mac::Address &aMacDest, Mac::TxFrames &aTxFrames);
 
+#if OPENTHREAD_CONFIG_MULTI_RADIO_TRAFFIC_STEERING_ENABLE
+    /**
+     * Returns the total number of frame bytes transmitted on a given radio link.
+     *
+     * @param[in] aRadioType   The radio link type.
+     *
+     * @returns The total number of transmitted frame bytes on @p aRadioType.
+     */
+    uint32_t GetTxBytesOnRadio(Mac::RadioType aRadioType) const { return mTxBytes[aRadioType]; }
+#endif
+
 private:
     static constexpr int16_t kPreferenceChangeOnTxError            = -35;  // Change on a tx error on a radio link.
     static constexpr int16_t kPreferenceChangeOnTxSuccess          = 25;   // Change on tx success on a radio link.
@@ -191,8 +202,15 @@ private:
     LogLevel       UpdatePreference(Neighbor &aNeighbor, Mac::RadioType aRadioType, int16_t aDifference);
     Mac::RadioType Select(Mac::RadioTypes aRadioOptions, const Neighbor &aNeighbor);
     void           Log(LogLevel aLogLevel, const char *aActionText, Mac::RadioType aType, const Neighbor &aNeighbor);
+#if OPENTHREAD_CONFIG_MULTI_RADIO_TRAFFIC_STEERING_ENABLE
+    Mac::RadioType SteerTraffic(const Message &aMessage, const Neighbor &aNeighbor, Mac::RadioType aSelectedRadio);
+#endif
 
     static const Mac::RadioType sRadioSelectionOrder[Mac::kNumRadioTypes];
+
+#if OPENTHREAD_CONFIG_MULTI_RADIO_TRAFFIC_STEERING_ENABLE
+    uint32_t mTxBytes[Mac::kNumRadioTypes];
+#endif
 };
 
 /**
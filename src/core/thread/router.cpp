@@ -99,6 +99,14 @@ bool Router::SetNextHopAndCost(uint8_t aNextHop, uint8_t aCost)
     {
         mNextHop = aNextHop;
         changed  = true;
+
+#if OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+        // Alternate next hops are equal-cost relative to the previous
+        // next hop and are re-learned from subsequent received MLE
+        // Advertisements.
+
+        ClearAltNextHops();
+#endif
     }
 
     if (mCost != aCost)
@@ -112,4 +120,60 @@ bool Router::SetNextHopAndCost(uint8_t aNextHop, uint8_t aCost)
 
 bool Router::SetNextHopToInvalid(void) { return SetNextHopAndCost(Mle::kInvalidRouterId, 0); }
 
+#if OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+
+bool Router::HasAltNextHop(uint8_t aRouterId) const
+{
+    bool has = false;
+
+    for (uint8_t altNextHop : mAltNextHops)
+    {
+        if (altNextHop == aRouterId)
+        {
+            has = true;
+            break;
+        }
+    }
+
+    return has;
+}
+
+void Router::AddAltNextHop(uint8_t aRouterId)
+{
+    VerifyOrExit(!HasAltNextHop(aRouterId));
+
+    for (uint8_t &altNextHop : mAltNextHops)
+    {
+        if (altNextHop == Mle::kInvalidRouterId)
+        {
+            altNextHop = aRouterId;
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
+void Router::RemoveAltNextHop(uint8_t aRouterId)
+{
+    for (uint8_t &altNextHop : mAltNextHops)
+    {
+        if (altNextHop == aRouterId)
+        {
+            altNextHop = Mle::kInvalidRouterId;
+        }
+    }
+}
+
+void Router::ClearAltNextHops(void)
+{
+    for (uint8_t &altNextHop : mAltNextHops)
+    {
+        altNextHop = Mle::kInvalidRouterId;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+
 } // namespace ot
@@ -193,6 +193,50 @@ public:
      */
     bool SetNextHopToInvalid(void);
 
+#if OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+    static constexpr uint8_t kMaxAltNextHops = OPENTHREAD_CONFIG_MLE_ECMP_MAX_ALT_NEXT_HOPS;
+
+    /**
+     * Gets the alternate (equal-cost) next hop router ID at a given index.
+     *
+     * @param[in] aIndex  The index (MUST be smaller than `kMaxAltNextHops`).
+     *
+     * @returns The router ID of the alternate next hop at @p aIndex, or `Mle::kInvalidRouterId` if unused.
+     */
+    uint8_t GetAltNextHop(uint8_t aIndex) const { return mAltNextHops[aIndex]; }
+
+    /**
+     * Indicates whether a given router ID is tracked as an alternate next hop to this router.
+     *
+     * @param[in] aRouterId  The router ID to check.
+     *
+     * @retval TRUE   @p aRouterId is an alternate next hop to this router.
+     * @retval FALSE  @p aRouterId is not an alternate next hop to this router.
+     */
+    bool HasAltNextHop(uint8_t aRouterId) const;
+
+    /**
+     * Adds a given router ID as an alternate (equal-cost) next hop to this router.
+     *
+     * Does nothing if @p aRouterId is already tracked or all alternate next hop entries are in use.
+     *
+     * @param[in] aRouterId  The router ID to add.
+     */
+    void AddAltNextHop(uint8_t aRouterId);
+
+    /**
+     * Removes a given router ID from the alternate next hops to this router (if present).
+     *
+     * @param[in] aRouterId  The router ID to remove.
+     */
+    void RemoveAltNextHop(uint8_t aRouterId);
+
+    /**
+     * Clears all alternate next hops to this router.
+     */
+    void ClearAltNextHops(void);
+#endif // OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+
 #if OPENTHREAD_CONFIG_PARENT_SEARCH_ENABLE
     /**
      * Indicates whether or not this router can be selected as parent.
@@ -236,7 +280,10 @@ private:
                   "kParentReselectTimeout won't fit in mParentReselectTimeout (15-bit filed)");
 #endif
 
-    uint8_t mNextHop;                 // The next hop towards this router
+    uint8_t mNextHop; // The next hop towards this router
+#if OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+    uint8_t mAltNextHops[kMaxAltNextHops]; // Alternate (equal-cost) next hops towards this router
+#endif
     uint8_t mLinkRequestAttempts : 2; // Number of Link Request attempts
     uint8_t mLinkAcceptTimeout : 2;   // Timeout (in seconds) after sending Link Request waiting for Link Accept
 #if !OPENTHREAD_CONFIG_MLE_LONG_ROUTES_ENABLE
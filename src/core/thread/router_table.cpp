@@ -43,11 +43,17 @@ RouterTable::RouterTable(Instance &aInstance)
     , mRouterIdSequenceLastUpdated(0)
     , mRouterIdSequence(Random::NonCrypto::GetUint8())
     , mEvents(0)
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    , mNextHopCacheGeneration(1)
+#endif
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     , mMinRouterId(0)
     , mMaxRouterId(Mle::kMaxRouterId)
 #endif
 {
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    ClearAllBytes(mNextHopCache);
+#endif
     Clear();
 }
 
@@ -225,6 +231,10 @@ Error RouterTable::Release(uint8_t aRouterId)
         {
             otherRouter.SetNextHopToInvalid();
         }
+
+#if OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+        otherRouter.RemoveAltNextHop(aRouterId);
+#endif
     }
 
     mRouterIdSequence++;
@@ -262,6 +272,10 @@ void RouterTable::RemoveRouterLink(Router &aRouter)
                 Get<Mle::Mle>().ResetAdvertiseInterval();
             }
         }
+
+#if OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+        router.RemoveAltNextHop(aRouter.GetRouterId());
+#endif
     }
 
     if (aRouter.GetNextHop() == Mle::kInvalidRouterId)
@@ -478,25 +492,45 @@ void RouterTable::GetNextHopAndPathCost(uint16_t aDestRloc16, uint16_t &aNextHop
 
         VerifyOrExit(router != nullptr);
 
-        aPathCost = GetLinkCost(*router);
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+        NextHopCacheEntry &cacheEntry = AsNonConst(this)->mNextHopCache[router->GetRouterId()];
 
-        if (aPathCost < Mle::kMaxRouteCost)
+        if ((cacheEntry.mGeneration == mNextHopCacheGeneration) &&
+            (TimerMilli::GetNow() - cacheEntry.mCalcTime < kNextHopCacheLifetime))
         {
-            aNextHopRloc16 = router->GetRloc16();
+            aPathCost      = cacheEntry.mPathCost;
+            aNextHopRloc16 = cacheEntry.mNextHopRloc16;
         }
-
-        if (nextHop != nullptr)
+        else
+#endif
         {
-            // Determine whether direct link or forwarding hop link
-            // through `nextHop` has a lower path cost.
+            aPathCost = GetLinkCost(*router);
 
-            uint8_t nextHopPathCost = router->GetCost() + GetLinkCost(*nextHop);
+            if (aPathCost < Mle::kMaxRouteCost)
+            {
+                aNextHopRloc16 = router->GetRloc16();
+            }
 
-            if (nextHopPathCost < aPathCost)
+            if (nextHop != nullptr)
             {
-                aPathCost      = nextHopPathCost;
-                aNextHopRloc16 = nextHop->GetRloc16();
+                // Determine whether direct link or forwarding hop link
+                // through `nextHop` has a lower path cost.
+
+                uint8_t nextHopPathCost = router->GetCost() + GetLinkCost(*nextHop);
+
+                if (nextHopPathCost < aPathCost)
+                {
+                    aPathCost      = nextHopPathCost;
+                    aNextHopRloc16 = nextHop->GetRloc16();
+                }
             }
+
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+            cacheEntry.mNextHopRloc16 = aNextHopRloc16;
+            cacheEntry.mPathCost      = aPathCost;
+            cacheEntry.mGeneration    = mNextHopCacheGeneration;
+            cacheEntry.mCalcTime      = TimerMilli::GetNow();
+#endif
         }
     }
 
@@ -522,6 +556,59 @@ uint16_t RouterTable::GetNextHop(uint16_t aDestRloc16) const
     return nextHopRloc16;
 }
 
+#if OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+uint16_t RouterTable::GetNextHop(uint16_t aDestRloc16, uint32_t aFlowHash) const
+{
+    uint16_t      nextHopRloc16 = GetNextHop(aDestRloc16);
+    const Router *router;
+    uint8_t       candidates[Router::kMaxAltNextHops + 1];
+    uint8_t       numCandidates = 0;
+
+    VerifyOrExit(nextHopRloc16 != Mle::kInvalidRloc16);
+
+    // Spreading applies only when the destination is reached through
+    // a forwarding hop (not the destination itself or one of our
+    // children).
+
+    VerifyOrExit(nextHopRloc16 != aDestRloc16);
+    VerifyOrExit(!Mle::RouterIdMatch(nextHopRloc16, aDestRloc16));
+
+    router = FindRouterById(Mle::RouterIdFromRloc16(aDestRloc16));
+    VerifyOrExit(router != nullptr);
+
+    candidates[numCandidates++] = Mle::RouterIdFromRloc16(nextHopRloc16);
+
+    for (uint8_t index = 0; index < Router::kMaxAltNextHops; index++)
+    {
+        uint8_t       altId = router->GetAltNextHop(index);
+        const Router *alt;
+
+        if ((altId == Mle::kInvalidRouterId) || (altId == candidates[0]))
+        {
+            continue;
+        }
+
+        // Alternate next hops are pruned as received MLE
+        // Advertisements are processed. Here we only check that the
+        // alternate is still a neighbor with a usable link.
+
+        alt = FindRouterById(altId);
+
+        if ((alt == nullptr) || !alt->IsStateValid() || (GetLinkCost(*alt) >= Mle::kMaxRouteCost))
+        {
+            continue;
+        }
+
+        candidates[numCandidates++] = altId;
+    }
+
+    nextHopRloc16 = Mle::Rloc16FromRouterId(candidates[aFlowHash % numCandidates]);
+
+exit:
+    return nextHopRloc16;
+}
+#endif // OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+
 void RouterTable::UpdateRouterIdMask(const Mle::RouterIdMask &aRouterIdMask)
 {
     bool shouldAdd = false;
@@ -696,6 +783,16 @@ void RouterTable::UpdateRoutes(const Mle::RouteTlv &aRouteTlv, uint8_t aNeighbor
                 router->SetNextHopAndCost(aNeighborId, cost);
                 SignalTableChanged(kEventNextHopOrCostChanged);
             }
+#if OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+            else if ((newCost == curCost) && (newCost < Mle::kMaxRouteCost))
+            {
+                router->AddAltNextHop(aNeighborId);
+            }
+            else
+            {
+                router->RemoveAltNextHop(aNeighborId);
+            }
+#endif
         }
     }
 
@@ -763,6 +860,7 @@ void RouterTable::GetRouterIdMask(Mle::RouterIdMask &aRouterIdMask) const
 void RouterTable::FillRouteTlv(Mle::RouteTlv &aRouteTlv, const Neighbor *aNeighbor) const
 {
     uint8_t routerIndex;
+    uint8_t linkQualities[Mle::kMaxRouterId + 1];
 
     GetRouterIdMask(aRouteTlv.GetRouterIdMask());
 
@@ -804,6 +902,22 @@ void RouterTable::FillRouteTlv(Mle::RouteTlv &aRouteTlv, const Neighbor *aNeighb
         }
     }
 
+    // Gather the link qualities of all routers in one sequential pass
+    // over the `mRouters` array into a packed vector indexed by router
+    // ID (quality-in in bits 0-1, quality-out in bits 2-3). The fill
+    // loop below then walks this vector and the Route TLV
+    // sequentially, instead of chasing each `Router` object through
+    // the ID map per router ID, which re-reads the scattered per-router
+    // structs on every advertisement.
+
+    ClearAllBytes(linkQualities);
+
+    for (const Router &router : mRouters)
+    {
+        linkQualities[router.GetRouterId()] =
+            static_cast<uint8_t>(router.GetLinkQualityIn()) | (static_cast<uint8_t>(router.GetLinkQualityOut()) << 2);
+    }
+
     routerIndex = 0;
 
     for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
@@ -823,19 +937,16 @@ void RouterTable::FillRouteTlv(Mle::RouteTlv &aRouteTlv, const Neighbor *aNeighb
         }
         else
         {
-            const Router *router = FindRouterById(routerId);
-            uint8_t       pathCost;
-
-            OT_ASSERT(router != nullptr);
-
-            pathCost = GetPathCost(routerRloc16);
+            uint8_t quality  = linkQualities[routerId];
+            uint8_t pathCost = GetPathCost(routerRloc16);
 
             if (pathCost >= Mle::kMaxRouteCost)
             {
                 pathCost = 0;
             }
 
-            aRouteTlv.SetRouteData(routerIndex, router->GetLinkQualityIn(), router->GetLinkQualityOut(), pathCost);
+            aRouteTlv.SetRouteData(routerIndex, static_cast<LinkQuality>(quality & 0x3),
+                                   static_cast<LinkQuality>(quality >> 2), pathCost);
         }
 
         routerIndex++;
@@ -899,9 +1010,31 @@ void RouterTable::RouterIdMap::HandleTimeTick(void)
 void RouterTable::SignalTableChanged(Events aEvents)
 {
     mEvents |= aEvents;
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    InvalidateNextHopCache();
+#endif
     mChangedTask.Post();
 }
 
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+
+void RouterTable::InvalidateNextHopCache(void)
+{
+    mNextHopCacheGeneration++;
+
+    if (mNextHopCacheGeneration == 0)
+    {
+        // On generation counter wrap, explicitly reset all cached
+        // entries so that a stale stamp cannot match the restarting
+        // generation values.
+
+        ClearAllBytes(mNextHopCache);
+        mNextHopCacheGeneration = 1;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+
 void RouterTable::HandleTableChanged(void)
 {
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_INFO)
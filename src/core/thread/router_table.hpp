@@ -196,6 +196,22 @@ public:
      */
     uint16_t GetNextHop(uint16_t aDestRloc16) const;
 
+#if OPENTHREAD_CONFIG_MLE_ECMP_ENABLE
+    /**
+     * Determines the next hop towards an RLOC16 destination, spreading across equal-cost next hops.
+     *
+     * When the destination is reached through a forwarding hop and alternate (equal-cost) next hops are tracked for
+     * it, @p aFlowHash selects among the primary and alternate next hops, so that distinct flows spread across the
+     * parallel links while a given flow stays on a single path.
+     *
+     * @param[in]  aDestRloc16  The RLOC16 of the destination.
+     * @param[in]  aFlowHash    A hash value identifying the flow.
+     *
+     * @returns A RLOC16 of the next hop if a route is known, `Mle::kInvalidRloc16` otherwise.
+     */
+    uint16_t GetNextHop(uint16_t aDestRloc16, uint32_t aFlowHash) const;
+#endif
+
     /**
      * Determines the next hop and the path cost towards an RLOC16 destination.
      *
@@ -424,6 +440,9 @@ public:
 private:
     static constexpr uint32_t kRouterIdSequencePeriod     = 10; // in sec
     static constexpr uint8_t  kLinkAcceptSequenceRollback = 64;
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    static constexpr uint32_t kNextHopCacheLifetime = 1000; // in msec
+#endif
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     static constexpr uint8_t kMaxRoutersInRouteTlvForLinkAccept = 3;
 #else
@@ -443,6 +462,9 @@ private:
 
     bool IsSelfRouterId(uint8_t aRouterId) const;
     void SignalTableChanged(Events aEvents);
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    void InvalidateNextHopCache(void);
+#endif
     void HandleTableChanged(void);
     void LogEvents(void) const;
     void LogRouteTable(void) const;
@@ -477,6 +499,23 @@ private:
         uint8_t mIndexes[Mle::kMaxRouterId + 1];
     };
 
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    struct NextHopCacheEntry
+    {
+        // Caches the next hop and path cost determined for a
+        // destination router. An entry is valid only when its
+        // `mGeneration` matches the current table generation (bumped
+        // on any table change) and its `mCalcTime` is within
+        // `kNextHopCacheLifetime` (to track link quality variations
+        // which do not emit a table change event).
+
+        uint16_t  mNextHopRloc16;
+        uint16_t  mGeneration;
+        uint8_t   mPathCost;
+        TimeMilli mCalcTime;
+    };
+#endif
+
     using ChangedTask = TaskletIn<RouterTable, &RouterTable::HandleTableChanged>;
 
     Array<Router, Mle::kMaxRouters> mRouters;
@@ -485,6 +524,10 @@ private:
     TimeMilli                       mRouterIdSequenceLastUpdated;
     uint8_t                         mRouterIdSequence;
     Events                          mEvents;
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    uint16_t                        mNextHopCacheGeneration;
+    NextHopCacheEntry               mNextHopCache[Mle::kMaxRouterId + 1];
+#endif
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     uint8_t mMinRouterId;
     uint8_t mMaxRouterId;
@@ -44,7 +44,14 @@ RegisterLogModule("SrcMatchCtrl");
 SourceMatchController::SourceMatchController(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEnabled(false)
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE
+    , mPendingFilterActive(false)
+    , mPendingFilterSupported(true)
+#endif
 {
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE
+    ClearAllBytes(mPendingFilter);
+#endif
     ClearTable();
 }
 
@@ -56,6 +63,10 @@ void SourceMatchController::IncrementMessageCount(Child &aChild)
     }
 
     aChild.IncrementIndirectMessageCount();
+
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE
+    UpdatePendingFilter();
+#endif
 }
 
 void SourceMatchController::DecrementMessageCount(Child &aChild)
@@ -73,6 +84,10 @@ void SourceMatchController::DecrementMessageCount(Child &aChild)
         ClearEntry(aChild);
     }
 
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE
+    UpdatePendingFilter();
+#endif
+
 exit:
     return;
 }
@@ -81,6 +96,10 @@ void SourceMatchController::ResetMessageCount(Child &aChild)
 {
     aChild.ResetIndirectMessageCount();
     ClearEntry(aChild);
+
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE
+    UpdatePendingFilter();
+#endif
 }
 
 void SourceMatchController::SetSrcMatchAsShort(Child &aChild, bool aUseShortAddress)
@@ -113,6 +132,9 @@ void SourceMatchController::Enable(bool aEnable)
 {
     mEnabled = aEnable;
     Get<Radio>().EnableSrcMatch(mEnabled);
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE
+    UpdatePendingFilter();
+#endif
     LogDebg("%sabling", mEnabled ? "En" : "Dis");
 }
 
@@ -193,6 +215,53 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_BATCH_UPDATE_ENABLE
+
+Error SourceMatchController::AddPendingEntries(void)
+{
+    // `AddPendingEntries()` is only called while source match is
+    // disabled, so the radio table can be safely replaced in full,
+    // covering both the already added entries and the pending ones.
+
+    Error             error = kErrorNone;
+    uint16_t          numShort = 0;
+    uint16_t          numExt   = 0;
+    Mac::ShortAddress shortAddrs[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
+    Mac::ExtAddress   extAddrs[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
+    {
+        if ((child.GetIndirectMessageCount() == 0) && !child.IsIndirectSourceMatchPending())
+        {
+            continue;
+        }
+
+        if (child.IsIndirectSourceMatchShort())
+        {
+            shortAddrs[numShort++] = child.GetRloc16();
+        }
+        else
+        {
+            extAddrs[numExt++] = child.GetExtAddress();
+        }
+    }
+
+    SuccessOrExit(error = Get<Radio>().SetSrcMatchShortEntries(shortAddrs, numShort));
+    SuccessOrExit(error = Get<Radio>().SetSrcMatchExtEntries(extAddrs, numExt));
+
+    LogDebg("Set %u short and %u extended entries", numShort, numExt);
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
+    {
+        child.SetIndirectSourceMatchPending(false);
+    }
+
+exit:
+    return error;
+}
+
+#else // OPENTHREAD_CONFIG_MAC_SRC_MATCH_BATCH_UPDATE_ENABLE
+
 Error SourceMatchController::AddPendingEntries(void)
 {
     Error error = kErrorNone;
@@ -210,6 +279,80 @@ exit:
     return error;
 }
 
+#endif // OPENTHREAD_CONFIG_MAC_SRC_MATCH_BATCH_UPDATE_ENABLE
+
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE
+
+void SourceMatchController::UpdatePendingFilter(void)
+{
+    bool    active = !IsEnabled();
+    uint8_t filter[kPendingFilterSize];
+
+    VerifyOrExit(mPendingFilterSupported);
+
+    ClearAllBytes(filter);
+
+    if (active)
+    {
+        for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
+        {
+            if (child.GetIndirectMessageCount() > 0)
+            {
+                AddToPendingFilter(filter, child);
+            }
+        }
+    }
+
+    VerifyOrExit((active != mPendingFilterActive) || (memcmp(filter, mPendingFilter, sizeof(filter)) != 0));
+
+    switch (Get<Radio>().SetSrcMatchPendingFilter(filter, active ? sizeof(filter) : 0))
+    {
+    case kErrorNone:
+        mPendingFilterActive = active;
+        memcpy(mPendingFilter, filter, sizeof(filter));
+        LogDebg("Pending filter %s", active ? "updated" : "removed");
+        break;
+
+    case kErrorNotImplemented:
+        mPendingFilterSupported = false;
+        break;
+
+    default:
+        break;
+    }
+
+exit:
+    return;
+}
+
+void SourceMatchController::AddToPendingFilter(uint8_t *aFilter, const Child &aChild)
+{
+    uint16_t byteSum = (aChild.GetRloc16() & 0xff) + (aChild.GetRloc16() >> 8);
+
+    // Set the bits for both the short and the extended address, since a
+    // child may use either one as the source address in its data polls.
+
+    SetPendingFilterBit(aFilter, byteSum);
+
+    byteSum = 0;
+
+    for (uint8_t byte : aChild.GetExtAddress().m8)
+    {
+        byteSum += byte;
+    }
+
+    SetPendingFilterBit(aFilter, byteSum);
+}
+
+void SourceMatchController::SetPendingFilterBit(uint8_t *aFilter, uint16_t aByteSum)
+{
+    uint16_t bitIndex = aByteSum % (kPendingFilterSize * kBitsPerByte);
+
+    aFilter[bitIndex / kBitsPerByte] |= static_cast<uint8_t>(1 << (bitIndex % kBitsPerByte));
+}
+
+#endif // OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
@@ -173,7 +173,28 @@ private:
      */
     Error AddPendingEntries(void);
 
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE
+    /**
+     * Updates the source match pending filter on the radio.
+     *
+     * While source matching is disabled, the filter has a bit set for every child with a pending indirect frame,
+     * letting the radio answer data polls with an accurate "frame pending" bit (modulo hash collisions) instead of
+     * setting the bit on all acks. While source matching is enabled, the filter is removed.
+     */
+    void UpdatePendingFilter(void);
+
+    static void AddToPendingFilter(uint8_t *aFilter, const Child &aChild);
+    static void SetPendingFilterBit(uint8_t *aFilter, uint16_t aByteSum);
+
+    static constexpr uint16_t kPendingFilterSize = OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_SIZE;
+#endif
+
     bool mEnabled;
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_PENDING_FILTER_ENABLE
+    bool    mPendingFilterActive;
+    bool    mPendingFilterSupported;
+    uint8_t mPendingFilter[kPendingFilterSize];
+#endif
 };
 
 /**
@@ -83,6 +83,9 @@ void ThreadLinkInfo::SetFrom(const Mac::RxFrame &aFrame)
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     mRadioType = static_cast<uint8_t>(aFrame.GetRadioType());
 #endif
+#if OPENTHREAD_CONFIG_RADIO_RX_TIMESTAMP_ENABLE
+    mRadioRxTimestamp = aFrame.GetTimestamp();
+#endif
 }
 
 } // namespace ot
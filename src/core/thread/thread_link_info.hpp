@@ -110,6 +110,15 @@ public:
     int64_t GetNetworkTimeOffset(void) const { return mNetworkTimeOffset; }
 #endif
 
+#if OPENTHREAD_CONFIG_RADIO_RX_TIMESTAMP_ENABLE
+    /**
+     * Returns the radio receive timestamp (in microseconds).
+     *
+     * @returns The radio receive timestamp (in microseconds, `otPlatRadioGetNow()` time base).
+     */
+    uint64_t GetRadioRxTimestamp(void) const { return mRadioRxTimestamp; }
+#endif
+
     /**
      * Sets the `ThreadLinkInfo` from a given received frame.
      *
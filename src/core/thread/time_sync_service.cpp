@@ -59,20 +59,137 @@ TimeSync::TimeSync(Instance &aInstance)
     , mTimer(aInstance)
     , mCurrentStatus(kUnsynchronized)
 {
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+    mOffsetBase      = 0;
+    mAnchorRadioTime = 0;
+    mSlewRemaining   = 0;
+    mRatePpb         = 0;
+    mDriftModelValid = false;
+#endif
+
     CheckAndHandleChanges(false);
 }
 
 TimeSync::Status TimeSync::GetTime(uint64_t &aNetworkTime) const
 {
-    aNetworkTime = static_cast<uint64_t>(static_cast<int64_t>(Get<Radio>().GetNow()) + mNetworkTimeOffset);
+    aNetworkTime = static_cast<uint64_t>(static_cast<int64_t>(Get<Radio>().GetNow()) + GetNetworkTimeOffset());
 
     return mCurrentStatus;
 }
 
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+int64_t TimeSync::GetNetworkTimeOffset(void) const
+{
+    return mDriftModelValid ? ModelOffsetAt(Get<Radio>().GetNow()) : mNetworkTimeOffset;
+}
+
+int64_t TimeSync::ModelOffsetAt(uint64_t aRadioTime) const
+{
+    int64_t elapsed     = static_cast<int64_t>(aRadioTime - mAnchorRadioTime);
+    int64_t rateTerm    = (elapsed * mRatePpb) / 1000000000;
+    int64_t slewBudget  = (elapsed * kSlewRatePpm) / 1000000;
+    int64_t slewApplied = Clamp(mSlewRemaining, -slewBudget, slewBudget);
+
+    return mOffsetBase + rateTerm + slewApplied;
+}
+
+bool TimeSync::UpdateDriftModel(int64_t aMeasuredOffset)
+{
+    bool     stepped   = false;
+    uint64_t radioNow  = Get<Radio>().GetNow();
+    int64_t  oldOffset = GetNetworkTimeOffset();
+
+    if (!mDriftModelValid)
+    {
+        mOffsetBase      = aMeasuredOffset;
+        mAnchorRadioTime = radioNow;
+        mSlewRemaining   = 0;
+        mRatePpb         = 0;
+        mDriftModelValid = true;
+        stepped          = true;
+    }
+    else
+    {
+        int64_t elapsed = static_cast<int64_t>(radioNow - mAnchorRadioTime);
+        int64_t phaseError;
+
+        // Materialize the model at the current time, so that the rate
+        // and slew adjustments below apply from now on.
+
+        {
+            int64_t rateTerm    = (elapsed * mRatePpb) / 1000000000;
+            int64_t slewBudget  = (elapsed * kSlewRatePpm) / 1000000;
+            int64_t slewApplied = Clamp(mSlewRemaining, -slewBudget, slewBudget);
+
+            mOffsetBase += rateTerm + slewApplied;
+            mAnchorRadioTime = radioNow;
+        }
+
+        phaseError = aMeasuredOffset - mOffsetBase;
+
+        if (ABS(phaseError) >= kStepThresholdUs)
+        {
+            // The correction is too large to slew out in reasonable
+            // time (e.g., after a partition merge), so step.
+
+            mOffsetBase    = aMeasuredOffset;
+            mSlewRemaining = 0;
+            stepped        = true;
+        }
+        else
+        {
+            // Simple phase-locked loop: fold a fraction of the
+            // observed frequency error into the rate estimate and
+            // slew out the remaining phase error at `kSlewRatePpm`.
+
+            if (elapsed >= kMinRateUpdateElapsedUs)
+            {
+                int64_t errorPpb = (phaseError * 1000000000) / elapsed;
+
+                mRatePpb = static_cast<int32_t>(
+                    Clamp<int64_t>(mRatePpb + errorPpb / kRateSmoothingDivisor, -kMaxRatePpb, kMaxRatePpb));
+            }
+
+            mSlewRemaining = phaseError;
+        }
+    }
+
+    mNetworkTimeOffset = aMeasuredOffset;
+
+    return stepped && (ABS(aMeasuredOffset - oldOffset) >= OPENTHREAD_CONFIG_TIME_SYNC_JUMP_NOTIF_MIN_US);
+}
+
+TimeSync::Status TimeSync::ConvertRadioTime(uint64_t aRadioTime, uint64_t &aNetworkTime, uint64_t &aMaxError) const
+{
+    uint64_t elapsed = 0;
+
+    if (mDriftModelValid)
+    {
+        aNetworkTime = static_cast<uint64_t>(static_cast<int64_t>(aRadioTime) + ModelOffsetAt(aRadioTime));
+        elapsed      = (aRadioTime >= mAnchorRadioTime) ? (aRadioTime - mAnchorRadioTime)
+                                                        : (mAnchorRadioTime - aRadioTime);
+    }
+    else
+    {
+        aNetworkTime = static_cast<uint64_t>(static_cast<int64_t>(aRadioTime) + mNetworkTimeOffset);
+    }
+
+    // The base synchronization uncertainty plus the worst-case
+    // residual oscillator drift (bounded by the XTAL accuracy
+    // threshold) accumulated relative to the model anchor time.
+
+    aMaxError = kBaseUncertaintyUs + (elapsed * mXtalThreshold) / 1000000;
+
+    return mCurrentStatus;
+}
+#endif // OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+
 void TimeSync::HandleTimeSyncMessage(const Message &aMessage)
 {
+#if !OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
     const int64_t origNetworkTimeOffset = mNetworkTimeOffset;
-    int8_t        timeSyncSeqDelta;
+#endif
+    int8_t timeSyncSeqDelta;
 
     VerifyOrExit(aMessage.GetTimeSyncSeq() != OT_TIME_SYNC_INVALID_SEQ);
 
@@ -105,18 +222,28 @@ void TimeSync::HandleTimeSyncMessage(const Message &aMessage)
         //  3. During reattach or migration process.
         if (mTimeSyncSeq == OT_TIME_SYNC_INVALID_SEQ || timeSyncSeqDelta > 0 || Get<Mle::Mle>().IsDetached())
         {
+            bool timeJumped;
+
             // Update network time and forward it.
             mLastTimeSyncReceived = TimerMilli::GetNow();
             mTimeSyncSeq          = aMessage.GetTimeSyncSeq();
-            mNetworkTimeOffset    = aMessage.GetNetworkTimeOffset();
-            mTimeSyncRequired     = true;
+
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+            // Small corrections are slewed rather than stepped, and
+            // only a step counts as a time jump.
+            timeJumped = UpdateDriftModel(aMessage.GetNetworkTimeOffset());
+#else
+            mNetworkTimeOffset = aMessage.GetNetworkTimeOffset();
+            timeJumped         = (ABS(mNetworkTimeOffset - origNetworkTimeOffset) >=
+                          OPENTHREAD_CONFIG_TIME_SYNC_JUMP_NOTIF_MIN_US);
+#endif
+            mTimeSyncRequired = true;
 
             LogInfo("Newer time sync seq:%u received. Forwarding", mTimeSyncSeq);
 
             // Only notify listeners of an update for network time offset jumps of more than
             // OPENTHREAD_CONFIG_TIME_SYNC_JUMP_NOTIF_MIN_US but notify listeners regardless if the status changes.
-            CheckAndHandleChanges(ABS(mNetworkTimeOffset - origNetworkTimeOffset) >=
-                                  OPENTHREAD_CONFIG_TIME_SYNC_JUMP_NOTIF_MIN_US);
+            CheckAndHandleChanges(timeJumped);
         }
     }
 
@@ -178,6 +305,14 @@ void TimeSync::HandleNotifierEvents(Events aEvents)
         // on the new partition.
         mLastTimeSyncReceived.SetValue(0);
 
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+        // The drift model estimates are relative to the previous
+        // partition's time and are re-learned on the new partition.
+        mDriftModelValid = false;
+        mSlewRemaining   = 0;
+        mRatePpb         = 0;
+#endif
+
         stateChanged = true;
 
         LogInfo("Resetting time sync seq, partition changed");
@@ -116,9 +116,32 @@ public:
     /**
      * Gets the time offset to the Thread network time.
      *
+     * When the drift model is enabled, the returned offset includes the current rate and slew corrections.
+     *
      * @returns The time offset to the Thread network time, in microseconds.
      */
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+    int64_t GetNetworkTimeOffset(void) const;
+#else
     int64_t GetNetworkTimeOffset(void) const { return mNetworkTimeOffset; }
+#endif
+
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+    /**
+     * Converts a local radio (monotonic) time to the Thread network time, along with a bound on the conversion
+     * error.
+     *
+     * The error bound covers the base synchronization uncertainty plus the worst-case residual oscillator drift
+     * (bounded by the XTAL accuracy threshold) accumulated since the last received time sync.
+     *
+     * @param[in]  aRadioTime    The local radio time (in microseconds) to convert.
+     * @param[out] aNetworkTime  The Thread network time (in microseconds) corresponding to @p aRadioTime.
+     * @param[out] aMaxError     The maximum conversion error (in microseconds).
+     *
+     * @returns The time synchronization status.
+     */
+    Status ConvertRadioTime(uint64_t aRadioTime, uint64_t &aNetworkTime, uint64_t &aMaxError) const;
+#endif
 
     /**
      * Set the time synchronization period.
@@ -170,6 +193,8 @@ private:
      *
      * @param[in] aFlags Flags that denote the state change events.
      */
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadPartitionIdChanged;
+
     void HandleNotifierEvents(Events aEvents);
 
     /**
@@ -190,8 +215,38 @@ private:
      */
     void NotifyTimeSyncCallback(void);
 
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+    /**
+     * Updates the drift model (rate and offset estimates) from a newly received network time offset.
+     *
+     * @param[in] aMeasuredOffset  The network time offset from the received time sync message.
+     *
+     * @returns TRUE if the network time was stepped by at least `OPENTHREAD_CONFIG_TIME_SYNC_JUMP_NOTIF_MIN_US`,
+     *          FALSE if the correction is being slewed.
+     */
+    bool UpdateDriftModel(int64_t aMeasuredOffset);
+
+    /**
+     * Computes the modeled network time offset at a given radio time.
+     *
+     * @param[in] aRadioTime  The radio time (in microseconds).
+     *
+     * @returns The modeled network time offset (in microseconds) at @p aRadioTime.
+     */
+    int64_t ModelOffsetAt(uint64_t aRadioTime) const;
+#endif
+
     using SyncTimer = TimerMilliIn<TimeSync, &TimeSync::HandleTimeout>;
 
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+    static constexpr uint16_t kSlewRatePpm            = OPENTHREAD_CONFIG_TIME_SYNC_SLEW_RATE_PPM;
+    static constexpr uint32_t kStepThresholdUs        = OPENTHREAD_CONFIG_TIME_SYNC_STEP_THRESHOLD_US;
+    static constexpr int64_t  kMinRateUpdateElapsedUs = 1000000; // Min elapsed time to update the rate estimate.
+    static constexpr int64_t  kRateSmoothingDivisor   = 4;       // Fraction of frequency error folded into the rate.
+    static constexpr int64_t  kMaxRatePpb             = 1000000; // Bound on the rate correction (1000 PPM).
+    static constexpr uint64_t kBaseUncertaintyUs      = 100;     // Base per-sync uncertainty for the error bound.
+#endif
+
     bool     mTimeSyncRequired; ///< Indicate whether or not a time synchronization message is required.
     uint8_t  mTimeSyncSeq;      ///< The time synchronization sequence.
     uint16_t mTimeSyncPeriod;   ///< The time synchronization period.
@@ -202,6 +257,14 @@ private:
     TimeMilli mLastTimeSyncReceived; ///< The time when the last time synchronization message was received.
     int64_t   mNetworkTimeOffset;    ///< The time offset to the Thread Network time
 
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_MODEL_ENABLE
+    int64_t  mOffsetBase;      ///< The modeled offset at `mAnchorRadioTime` (excluding pending slew).
+    uint64_t mAnchorRadioTime; ///< The radio time the drift model was last updated at.
+    int64_t  mSlewRemaining;   ///< The remaining offset correction being slewed out.
+    int32_t  mRatePpb;         ///< The rate correction estimate, in parts per billion.
+    bool     mDriftModelValid; ///< Whether the drift model has been initialized from a received sync.
+#endif
+
     Callback<otNetworkTimeSyncCallbackFn> mTimeSyncCallback; ///< Callback when time sync is handled or status updated.
     SyncTimer                             mTimer;            ///< Timer for checking if a resync is required.
     Status                                mCurrentStatus;    ///< Current network time status.
@@ -57,6 +57,7 @@ ChannelManager::ChannelManager(Instance &aInstance)
     , mAutoSelectInterval(kDefaultAutoSelectInterval)
 #if OPENTHREAD_FTD
     , mAutoSelectEnabled(false)
+    , mUseFastDelay(false)
 #endif
 #if OPENTHREAD_CONFIG_CHANNEL_MANAGER_CSL_CHANNEL_SELECT_ENABLE
     , mAutoSelectCslEnabled(false)
@@ -83,6 +84,16 @@ void ChannelManager::RequestChannelChange(uint8_t aChannel)
 
 #if OPENTHREAD_FTD
 void ChannelManager::RequestNetworkChannelChange(uint8_t aChannel)
+{
+    RequestNetworkChannelChange(aChannel, /* aUseFastDelay */ false);
+}
+
+void ChannelManager::RequestFastNetworkChannelChange(uint8_t aChannel)
+{
+    RequestNetworkChannelChange(aChannel, /* aUseFastDelay */ true);
+}
+
+void ChannelManager::RequestNetworkChannelChange(uint8_t aChannel, bool aUseFastDelay)
 {
     // Check requested channel != current channel
     if (aChannel == Get<Mac::Mac>().GetPanChannel())
@@ -91,16 +102,32 @@ void ChannelManager::RequestNetworkChannelChange(uint8_t aChannel)
         ExitNow();
     }
 
-    LogInfo("Request to change to channel %d with delay %d sec", aChannel, mDelay);
+    LogInfo("Request to change to channel %d with delay %d sec", aChannel,
+            aUseFastDelay ? kFastMigrationDelay : mDelay);
+
     if (mState == kStateChangeInProgress)
     {
-        VerifyOrExit(mChannel != aChannel);
+        if (aUseFastDelay)
+        {
+            // Cancel the in-progress update (even to the same channel)
+            // so it can be re-staged with the fast-migration delay.
+            Get<MeshCoP::DatasetUpdater>().CancelUpdate();
+        }
+        else
+        {
+            VerifyOrExit(mChannel != aChannel);
+        }
     }
 
-    mState   = kStateChangeRequested;
-    mChannel = aChannel;
+    mUseFastDelay = aUseFastDelay;
+    mState        = kStateChangeRequested;
+    mChannel      = aChannel;
+
+    // A fast migration is meant to escape a jammed channel, so the
+    // start jitter (which spreads out concurrent requests from
+    // multiple devices) is skipped.
 
-    mTimer.Start(1 + Random::NonCrypto::GetUint32InRange(0, kRequestStartJitterInterval));
+    mTimer.Start(aUseFastDelay ? 1 : (1 + Random::NonCrypto::GetUint32InRange(0, kRequestStartJitterInterval)));
 
     Get<Notifier>().Signal(kEventChannelManagerNewChannelChanged);
 
@@ -154,7 +181,7 @@ void ChannelManager::StartDatasetUpdate(void)
 
     dataset.Clear();
     dataset.Set<MeshCoP::Dataset::kChannel>(mChannel);
-    dataset.Set<MeshCoP::Dataset::kDelay>(Time::SecToMsec(mDelay));
+    dataset.Set<MeshCoP::Dataset::kDelay>(Time::SecToMsec(mUseFastDelay ? kFastMigrationDelay : mDelay));
 
     switch (Get<MeshCoP::DatasetUpdater>().RequestUpdate(dataset, HandleDatasetUpdateDone, this))
     {
@@ -197,7 +224,8 @@ void ChannelManager::HandleDatasetUpdateDone(Error aError)
                 (aError == kErrorAlready) ? " since current ActiveDataset is more recent" : "");
     }
 
-    mState = kStateIdle;
+    mUseFastDelay = false;
+    mState        = kStateIdle;
     StartAutoSelectTimer();
 }
 #endif // OPENTHREAD_FTD
@@ -99,6 +99,21 @@ public:
      * @param[in] aChannel             The new channel for the Thread network.
      */
     void RequestNetworkChannelChange(uint8_t aChannel);
+
+    /**
+     * Requests a fast Thread network channel change (e.g., to escape a jammed channel).
+     *
+     * This behaves like `RequestNetworkChannelChange()` except that the Pending Operational Dataset is staged with the
+     * short `kFastMigrationDelay` Delay Timer (instead of `GetDelay()`) and the request start jitter is skipped,
+     * cutting the channel-escape time from minutes to seconds. An ongoing regular channel change (even to the same
+     * channel) is canceled and re-staged with the fast delay.
+     *
+     * Since the delay may be shorter than the data poll interval of sleepy end devices in the network, such devices
+     * may miss the pending dataset and need to re-attach on the new channel.
+     *
+     * @param[in] aChannel             The new channel for the Thread network.
+     */
+    void RequestFastNetworkChannelChange(uint8_t aChannel);
 #endif
 
     /**
@@ -295,6 +310,11 @@ private:
     // Maximum jitter/wait time to start a requested network channel change (in ms).
     static constexpr uint32_t kRequestStartJitterInterval = 10000;
 
+#if OPENTHREAD_FTD
+    // Delay (in seconds) used for a fast channel migration.
+    static constexpr uint16_t kFastMigrationDelay = OPENTHREAD_CONFIG_CHANNEL_MANAGER_FAST_MIGRATION_DELAY;
+#endif
+
     // The minimum number of RSSI samples required before using the collected data (by `ChannelMonitor`) to select
     // a channel.
     static constexpr uint32_t kMinChannelMonitorSampleCount =
@@ -322,6 +342,7 @@ private:
     };
 
 #if OPENTHREAD_FTD
+    void        RequestNetworkChannelChange(uint8_t aChannel, bool aUseFastDelay);
     void        StartDatasetUpdate(void);
     static void HandleDatasetUpdateDone(otError aError, void *aContext);
     void        HandleDatasetUpdateDone(Error aError);
@@ -355,6 +376,7 @@ private:
     uint32_t     mAutoSelectInterval;
 #if OPENTHREAD_FTD
     bool mAutoSelectEnabled;
+    bool mUseFastDelay;
 #endif
 #if OPENTHREAD_CONFIG_CHANNEL_MANAGER_CSL_CHANNEL_SELECT_ENABLE
     bool mAutoSelectCslEnabled;
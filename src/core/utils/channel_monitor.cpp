@@ -59,11 +59,17 @@ const uint32_t ChannelMonitor::mScanChannelMasks[kNumChannelMasks] = {
 
 ChannelMonitor::ChannelMonitor(Instance &aInstance)
     : InstanceLocator(aInstance)
-    , mChannelMaskIndex(0)
+    , mScanSlotIndex(0)
     , mSampleCount(0)
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_SLICED_SCAN_ENABLE
+    , mSlotDeferralCount(0)
+#endif
     , mTimer(aInstance)
 {
     ClearAllBytes(mChannelOccupancy);
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM_ENABLE
+    ClearAllBytes(mRssiHistogram);
+#endif
 }
 
 Error ChannelMonitor::Start(void)
@@ -93,9 +99,15 @@ exit:
 
 void ChannelMonitor::Clear(void)
 {
-    mChannelMaskIndex = 0;
-    mSampleCount      = 0;
+    mScanSlotIndex = 0;
+    mSampleCount   = 0;
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_SLICED_SCAN_ENABLE
+    mSlotDeferralCount = 0;
+#endif
     ClearAllBytes(mChannelOccupancy);
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM_ENABLE
+    ClearAllBytes(mRssiHistogram);
+#endif
 
     LogDebg("Clearing data");
 }
@@ -111,12 +123,55 @@ exit:
     return occupancy;
 }
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM_ENABLE
+const uint16_t *ChannelMonitor::GetRssiHistogram(uint8_t aChannel) const
+{
+    const uint16_t *histogram = nullptr;
+
+    VerifyOrExit((Radio::kChannelMin <= aChannel) && (aChannel <= Radio::kChannelMax));
+    histogram = mRssiHistogram[aChannel - Radio::kChannelMin];
+
+exit:
+    return histogram;
+}
+#endif
+
+uint32_t ChannelMonitor::GetSlotChannelMask(uint8_t aSlot)
+{
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_SLICED_SCAN_ENABLE
+    return static_cast<uint32_t>(1UL << (Radio::kChannelMin + aSlot));
+#else
+    return mScanChannelMasks[aSlot];
+#endif
+}
+
 void ChannelMonitor::HandleTimer(void)
 {
-    IgnoreError(Get<Mac::Mac>().EnergyScan(mScanChannelMasks[mChannelMaskIndex], 0,
-                                           &ChannelMonitor::HandleEnergyScanResult, this));
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_SLICED_SCAN_ENABLE
+    // Briefly defer the scan slice while the MAC is in the middle of a
+    // transmission, moving the RSSI sample into an upcoming radio idle
+    // gap. The number of deferrals is bounded so that a saturated link
+    // cannot starve channel monitoring.
+
+    if (Get<Mac::Mac>().IsInTransmitState() && (mSlotDeferralCount < kMaxSlotDeferrals))
+    {
+        mSlotDeferralCount++;
+        mTimer.Start(kSlotRetryInterval);
+        ExitNow();
+    }
+
+    mSlotDeferralCount = 0;
+#endif
+
+    IgnoreError(
+        Get<Mac::Mac>().EnergyScan(GetSlotChannelMask(mScanSlotIndex), 0, &ChannelMonitor::HandleEnergyScanResult, this));
 
     mTimer.StartAt(mTimer.GetFireTime(), Random::NonCrypto::AddJitter(kTimerInterval, kMaxJitterInterval));
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_SLICED_SCAN_ENABLE
+exit:
+    return;
+#endif
 }
 
 void ChannelMonitor::HandleEnergyScanResult(Mac::EnergyScanResult *aResult, void *aContext)
@@ -128,15 +183,15 @@ void ChannelMonitor::HandleEnergyScanResult(Mac::EnergyScanResult *aResult)
 {
     if (aResult == nullptr)
     {
-        if (mChannelMaskIndex == kNumChannelMasks - 1)
+        if (mScanSlotIndex == kNumScanSlots - 1)
         {
-            mChannelMaskIndex = 0;
+            mScanSlotIndex = 0;
             mSampleCount++;
             LogResults();
         }
         else
         {
-            mChannelMaskIndex++;
+            mScanSlotIndex++;
         }
     }
     else
@@ -153,6 +208,23 @@ void ChannelMonitor::HandleEnergyScanResult(Mac::EnergyScanResult *aResult)
         if (aResult->mMaxRssi != Radio::kInvalidRssi)
         {
             newValue = (aResult->mMaxRssi >= kRssiThreshold) ? kMaxOccupancy : 0;
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM_ENABLE
+            {
+                uint8_t binIndex = 0;
+
+                if (aResult->mMaxRssi >= kRssiBinFloor)
+                {
+                    binIndex = static_cast<uint8_t>(aResult->mMaxRssi - kRssiBinFloor) / kRssiBinWidth;
+                    binIndex = Min(binIndex, static_cast<uint8_t>(kNumRssiBins - 1));
+                }
+
+                if (mRssiHistogram[channelIndex][binIndex] < NumericLimits<uint16_t>::kMax)
+                {
+                    mRssiHistogram[channelIndex][binIndex]++;
+                }
+            }
+#endif
         }
 
         // `mChannelOccupancy` stores the average rate/percentage of RSS
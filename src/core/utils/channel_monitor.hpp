@@ -170,17 +170,63 @@ public:
      */
     Mac::ChannelMask FindBestChannels(const Mac::ChannelMask &aMask, uint16_t &aOccupancy) const;
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM_ENABLE
+    /**
+     * The number of RSSI histogram bins per channel.
+     */
+    static constexpr uint8_t kNumRssiBins = 8;
+
+    /**
+     * The lower edge (in dBm) of the first RSSI histogram bin.
+     *
+     * Samples below this level are counted into the first bin.
+     */
+    static constexpr int8_t kRssiBinFloor = -100;
+
+    /**
+     * The width (in dB) of each RSSI histogram bin.
+     *
+     * Samples at or above `kRssiBinFloor + (kNumRssiBins - 1) * kRssiBinWidth` are counted into the last bin.
+     */
+    static constexpr uint8_t kRssiBinWidth = 10;
+
+    /**
+     * Returns the RSSI histogram for a given channel.
+     *
+     * Each entry gives the number of RSSI samples observed in the corresponding bin since the last call to `Start()`
+     * (or `Clear()`). Bin `i` covers RSSI values from `kRssiBinFloor + i * kRssiBinWidth` (inclusive) up to the start
+     * of the next bin, with the first and last bins additionally counting all samples below/above the covered range.
+     * Bin counters saturate at `0xffff`.
+     *
+     * @param[in]  aChannel   The channel for which to get the histogram.
+     *
+     * @returns A pointer to an array of `kNumRssiBins` bin counters, or `nullptr` if @p aChannel is not valid.
+     */
+    const uint16_t *GetRssiHistogram(uint8_t aChannel) const;
+#endif
+
 private:
 #if (OPENTHREAD_CONFIG_RADIO_2P4GHZ_OQPSK_SUPPORT && OPENTHREAD_CONFIG_RADIO_915MHZ_OQPSK_SUPPORT)
     static constexpr uint8_t kNumChannelMasks = 8;
 #else
     static constexpr uint8_t kNumChannelMasks = 4;
 #endif
-    static constexpr uint8_t  kNumChannels       = (Radio::kChannelMax - Radio::kChannelMin + 1);
-    static constexpr uint32_t kTimerInterval     = (kSampleInterval / kNumChannelMasks);
+    static constexpr uint8_t kNumChannels = (Radio::kChannelMax - Radio::kChannelMin + 1);
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_SLICED_SCAN_ENABLE
+    static constexpr uint8_t  kNumScanSlots       = kNumChannels;
+    static constexpr uint32_t kSlotRetryInterval  = 128;
+    static constexpr uint8_t  kMaxSlotDeferrals   = 8;
+#else
+    static constexpr uint8_t kNumScanSlots = kNumChannelMasks;
+#endif
+
+    static constexpr uint32_t kTimerInterval     = (kSampleInterval / kNumScanSlots);
     static constexpr uint16_t kMaxJitterInterval = 4096;
     static constexpr uint32_t kMaxOccupancy      = 0xffff;
 
+    static uint32_t GetSlotChannelMask(uint8_t aSlot);
+
     void        HandleTimer(void);
     static void HandleEnergyScanResult(Mac::EnergyScanResult *aResult, void *aContext);
     void        HandleEnergyScanResult(Mac::EnergyScanResult *aResult);
@@ -190,9 +236,18 @@ private:
 
     static const uint32_t mScanChannelMasks[kNumChannelMasks];
 
-    uint8_t   mChannelMaskIndex : 3;
-    uint32_t  mSampleCount : 29;
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_SLICED_SCAN_ENABLE
+    uint8_t  mScanSlotIndex : 5;
+    uint32_t mSampleCount : 27;
+    uint8_t  mSlotDeferralCount;
+#else
+    uint8_t  mScanSlotIndex : 3;
+    uint32_t mSampleCount : 29;
+#endif
     uint16_t  mChannelOccupancy[kNumChannels];
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM_ENABLE
+    uint16_t mRssiHistogram[kNumChannels][kNumRssiBins];
+#endif
     ScanTimer mTimer;
 };
 
@@ -0,0 +1,105 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the counter registry.
+ */
+
+#include "counter_registry.hpp"
+
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+
+#include "instance/instance.hpp"
+
+namespace ot {
+namespace Utils {
+
+CounterRegistry::CounterRegistry(Instance &aInstance)
+    : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE
+    , mTimer(aInstance)
+#endif
+{
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE
+    ClearAllBytes(mRates);
+    mPrevCounters.Clear();
+    mTimer.Start(kRateWindow);
+#endif
+}
+
+void CounterRegistry::GetSnapshot(Snapshot &aSnapshot)
+{
+#if OPENTHREAD_CONFIG_UPTIME_ENABLE
+    aSnapshot.mTimestamp = Get<UptimeTracker>().GetUptime();
+#else
+    aSnapshot.mTimestamp = TimerMilli::GetNow().GetValue();
+#endif
+
+    aSnapshot.mMacCounters = Get<Mac::Mac>().GetCounters();
+    aSnapshot.mIpCounters  = Get<MeshForwarder>().GetCounters();
+    aSnapshot.mMleCounters = Get<Mle::Mle>().GetCounters();
+}
+
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE
+
+void CounterRegistry::HandleTimer(void)
+{
+    const otMacCounters &counters = Get<Mac::Mac>().GetCounters();
+
+    mRates.mTxTotal  = UpdateRate(mRates.mTxTotal, counters.mTxTotal, mPrevCounters.mTxTotal);
+    mRates.mRxTotal  = UpdateRate(mRates.mRxTotal, counters.mRxTotal, mPrevCounters.mRxTotal);
+    mRates.mTxRetry  = UpdateRate(mRates.mTxRetry, counters.mTxRetry, mPrevCounters.mTxRetry);
+    mRates.mTxErrCca = UpdateRate(mRates.mTxErrCca, counters.mTxErrCca, mPrevCounters.mTxErrCca);
+    mRates.mRxErrFcs = UpdateRate(mRates.mRxErrFcs, counters.mRxErrFcs, mPrevCounters.mRxErrFcs);
+
+    mTimer.Start(kRateWindow);
+}
+
+uint32_t CounterRegistry::UpdateRate(uint32_t aRate, uint32_t aCounter, uint32_t &aPrevCounter)
+{
+    // EWMA where the most recent one-minute window contributes one
+    // eighth of the new value. A counter value smaller than the
+    // previous reading indicates the counter group was reset, in
+    // which case the window delta is the post-reset value itself.
+
+    static constexpr uint32_t kEwmaWeight = 8;
+
+    uint32_t delta = (aCounter >= aPrevCounter) ? (aCounter - aPrevCounter) : aCounter;
+
+    aPrevCounter = aCounter;
+
+    return static_cast<uint32_t>((static_cast<uint64_t>(aRate) * (kEwmaWeight - 1) + delta) / kEwmaWeight);
+}
+
+#endif // OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
@@ -0,0 +1,116 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the counter registry.
+ */
+
+#ifndef OT_CORE_UTILS_COUNTER_REGISTRY_HPP_
+#define OT_CORE_UTILS_COUNTER_REGISTRY_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+
+#include <openthread/counters.h>
+
+#include "common/clearable.hpp"
+#include "common/locator.hpp"
+#include "common/non_copyable.hpp"
+#include "common/timer.hpp"
+
+namespace ot {
+namespace Utils {
+
+/**
+ * Implements the counter registry.
+ *
+ * The registry captures all counter groups (MAC, IP, MLE) in one call with a single uptime stamp, and
+ * optionally maintains per-minute exponentially weighted moving average rates of key MAC counters.
+ */
+class CounterRegistry : public InstanceLocator, private NonCopyable
+{
+public:
+    typedef otCounterSnapshot Snapshot; ///< A snapshot of all counter groups.
+
+    /**
+     * Initializes the `CounterRegistry` object.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     */
+    explicit CounterRegistry(Instance &aInstance);
+
+    /**
+     * Captures a snapshot of all counter groups with a single uptime stamp.
+     *
+     * @param[out] aSnapshot  A reference to a `Snapshot` to populate.
+     */
+    void GetSnapshot(Snapshot &aSnapshot);
+
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE
+    typedef otCounterRates Rates; ///< Windowed rates of key counters (events per minute).
+
+    /**
+     * Gets the current windowed counter rates.
+     *
+     * @returns The current counter rates.
+     */
+    const Rates &GetRates(void) const { return mRates; }
+#endif
+
+private:
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE
+    static constexpr uint32_t kRateWindow = Time::kOneMinuteInMsec;
+
+    void            HandleTimer(void);
+    static uint32_t UpdateRate(uint32_t aRate, uint32_t aCounter, uint32_t &aPrevCounter);
+
+    using RateTimer = TimerMilliIn<CounterRegistry, &CounterRegistry::HandleTimer>;
+
+    struct PrevCounters : public Clearable<PrevCounters>
+    {
+        uint32_t mTxTotal;
+        uint32_t mRxTotal;
+        uint32_t mTxRetry;
+        uint32_t mTxErrCca;
+        uint32_t mRxErrFcs;
+    };
+
+    Rates        mRates;
+    PrevCounters mPrevCounters;
+    RateTimer    mTimer;
+#endif
+};
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+
+#endif // OT_CORE_UTILS_COUNTER_REGISTRY_HPP_
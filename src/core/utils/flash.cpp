@@ -164,7 +164,16 @@ Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLen
 
 Error Flash::Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    return Add(aKey, true, aValue, aValueLength);
+    Error error = kErrorNone;
+
+    // Skip the append when the stored value already matches, so unchanged
+    // re-saves (e.g. parent info on every attach) cost no flash writes.
+    VerifyOrExit(!DoesValueMatch(aKey, aValue, aValueLength));
+
+    error = Add(aKey, true, aValue, aValueLength);
+
+exit:
+    return error;
 }
 
 Error Flash::Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
@@ -201,6 +210,64 @@ exit:
     return error;
 }
 
+bool Flash::DoesValueMatch(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength) const
+{
+    static constexpr uint16_t kCompareChunkSize = 32;
+
+    bool         matches     = false;
+    bool         multiple    = false;
+    int          index       = 0; // This must be initialized to 0. See [Note] in Delete().
+    uint32_t     matchOffset = 0;
+    uint16_t     matchLength = 0;
+    RecordHeader record;
+
+    for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
+    {
+        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+
+        if ((record.GetKey() != aKey) || !record.IsValid())
+        {
+            continue;
+        }
+
+        if (record.IsFirst())
+        {
+            index    = 0;
+            multiple = false;
+        }
+
+        if (index == 0)
+        {
+            matchOffset = offset;
+            matchLength = record.GetLength();
+        }
+        else
+        {
+            // `Set()` collapses multiple values into a single record, so
+            // a match is only meaningful when one record exists.
+            multiple = true;
+        }
+
+        index++;
+    }
+
+    VerifyOrExit(!multiple && (matchOffset != 0) && (matchLength == aValueLength));
+
+    for (uint16_t position = 0; position < aValueLength; position += kCompareChunkSize)
+    {
+        uint8_t  buffer[kCompareChunkSize];
+        uint16_t chunkLength = Min(kCompareChunkSize, static_cast<uint16_t>(aValueLength - position));
+
+        otPlatFlashRead(&GetInstance(), mSwapIndex, matchOffset + sizeof(record) + position, buffer, chunkLength);
+        VerifyOrExit(memcmp(buffer, aValue + position, chunkLength) == 0);
+    }
+
+    matches = true;
+
+exit:
+    return matches;
+}
+
 bool Flash::DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const
 {
     RecordHeader record;
@@ -211,6 +211,7 @@ private:
 
     Error Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aValueLength);
     bool  DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const;
+    bool  DoesValueMatch(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength) const;
     void  SanitizeFreeSpace(void);
     void  Swap(void);
 
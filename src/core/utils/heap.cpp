@@ -46,6 +46,9 @@ namespace ot {
 namespace Utils {
 
 Heap::Heap(void)
+    : mAllocCount(0)
+    , mFreeCount(0)
+    , mFailedAllocCount(0)
 {
     Block &super = BlockAt(kSuperBlockOffset);
     super.SetSize(kSuperBlockSize);
@@ -56,8 +59,14 @@ Heap::Heap(void)
     Block &guard = BlockRight(first);
     guard.SetSize(Block::kGuardBlockSize);
 
-    super.SetNext(BlockOffset(first));
-    first.SetNext(BlockOffset(guard));
+    super.SetNext(0);
+
+    for (uint16_t &binHead : mBinHeads)
+    {
+        binHead = kGuardBlockOffset;
+    }
+
+    BlockInsert(first);
 
     mMemory.mFreeSize = kFirstBlockSize;
 }
@@ -65,7 +74,6 @@ Heap::Heap(void)
 void *Heap::CAlloc(size_t aCount, size_t aSize)
 {
     void    *ret  = nullptr;
-    Block   *prev = nullptr;
     Block   *curr = nullptr;
     uint16_t size;
 
@@ -88,18 +96,38 @@ void *Heap::CAlloc(size_t aCount, size_t aSize)
     size &= ~(kAlignSize - 1);
     size += kBlockRemainderSize;
 
-    prev = &BlockSuper();
-    curr = &BlockNext(*prev);
+    // Search the bin matching `size` and, failing that, the larger
+    // bins. Every block in a larger bin is big enough, so only the
+    // first bin requires a walk past smaller blocks.
 
-    while (curr->GetSize() < size)
+    for (uint8_t bin = BinIndexFor(size); (curr == nullptr) && (bin < kNumBins); bin++)
     {
-        prev = curr;
-        curr = &BlockNext(*curr);
-    }
+        Block *prev = nullptr;
 
-    VerifyOrExit(curr->IsFree());
+        for (uint16_t offset = mBinHeads[bin]; offset != kGuardBlockOffset; offset = BlockAt(offset).GetNext())
+        {
+            Block &block = BlockAt(offset);
 
-    prev->SetNext(curr->GetNext());
+            if (block.GetSize() >= size)
+            {
+                if (prev == nullptr)
+                {
+                    mBinHeads[bin] = block.GetNext();
+                }
+                else
+                {
+                    prev->SetNext(block.GetNext());
+                }
+
+                curr = &block;
+                break;
+            }
+
+            prev = &block;
+        }
+    }
+
+    VerifyOrExit(curr != nullptr);
 
     if (curr->GetSize() > size + sizeof(Block))
     {
@@ -108,16 +136,8 @@ void *Heap::CAlloc(size_t aCount, size_t aSize)
 
         Block &newBlock = BlockRight(*curr);
         newBlock.SetSize(newBlockSize);
-        newBlock.SetNext(0);
 
-        if (prev->GetSize() < newBlockSize)
-        {
-            BlockInsert(*prev, newBlock);
-        }
-        else
-        {
-            BlockInsert(BlockSuper(), newBlock);
-        }
+        BlockInsert(newBlock);
 
         mMemory.mFreeSize -= sizeof(Block);
     }
@@ -130,32 +150,113 @@ void *Heap::CAlloc(size_t aCount, size_t aSize)
     ret = curr->GetPointer();
 
 exit:
+    if (ret != nullptr)
+    {
+        mAllocCount++;
+    }
+    else
+    {
+        mFailedAllocCount++;
+    }
+
     return ret;
 }
 
-void Heap::BlockInsert(Block &aPrev, Block &aBlock)
+uint8_t Heap::BinIndexFor(uint16_t aSize)
+{
+    uint8_t bin = 0;
+
+    for (uint16_t size = aSize / kBinBaseSize; (size != 0) && (bin < kNumBins - 1); size >>= 1)
+    {
+        bin++;
+    }
+
+    return bin;
+}
+
+void Heap::BlockInsert(Block &aBlock)
+{
+    uint8_t  bin    = BinIndexFor(aBlock.GetSize());
+    uint16_t offset = mBinHeads[bin];
+    Block   *prev   = nullptr;
+
+    while ((offset != kGuardBlockOffset) && (BlockAt(offset).GetSize() < aBlock.GetSize()))
+    {
+        prev   = &BlockAt(offset);
+        offset = prev->GetNext();
+    }
+
+    aBlock.SetNext(offset);
+
+    if (prev == nullptr)
+    {
+        mBinHeads[bin] = BlockOffset(aBlock);
+    }
+    else
+    {
+        prev->SetNext(BlockOffset(aBlock));
+    }
+}
+
+void Heap::BlockUnlink(Block &aBlock)
 {
-    Block *prev = &aPrev;
+    uint8_t  bin    = BinIndexFor(aBlock.GetSize());
+    uint16_t target = BlockOffset(aBlock);
 
-    for (Block *block = &BlockNext(*prev); block->GetSize() < aBlock.GetSize(); block = &BlockNext(*block))
+    if (mBinHeads[bin] == target)
     {
-        prev = block;
+        mBinHeads[bin] = aBlock.GetNext();
     }
+    else
+    {
+        Block *prev = &BlockAt(mBinHeads[bin]);
 
-    aBlock.SetNext(prev->GetNext());
-    prev->SetNext(BlockOffset(aBlock));
+        while (prev->GetNext() != target)
+        {
+            prev = &BlockNext(*prev);
+        }
+
+        prev->SetNext(aBlock.GetNext());
+    }
 }
 
-Block &Heap::BlockPrev(const Block &aBlock)
+Block &Heap::UnlinkLeftNeighborOf(const Block &aBlock)
 {
-    Block *prev = &BlockSuper();
+    // The left neighbor's size (and thus its bin) is not known, so
+    // search all bins for the free block ending right before @p aBlock.
 
-    while (prev->GetNext() != BlockOffset(aBlock))
+    Block *left = nullptr;
+
+    for (uint8_t bin = 0; (left == nullptr) && (bin < kNumBins); bin++)
     {
-        prev = &BlockNext(*prev);
+        Block *prev = nullptr;
+
+        for (uint16_t offset = mBinHeads[bin]; offset != kGuardBlockOffset; offset = BlockAt(offset).GetNext())
+        {
+            Block &block = BlockAt(offset);
+
+            if (&BlockRight(block) == &aBlock)
+            {
+                if (prev == nullptr)
+                {
+                    mBinHeads[bin] = block.GetNext();
+                }
+                else
+                {
+                    prev->SetNext(block.GetNext());
+                }
+
+                left = &block;
+                break;
+            }
+
+            prev = &block;
+        }
     }
 
-    return *prev;
+    OT_ASSERT(left != nullptr);
+
+    return *left;
 }
 
 void Heap::Free(void *aPointer)
@@ -165,67 +266,57 @@ void Heap::Free(void *aPointer)
         return;
     }
 
-    Block &block = BlockOf(aPointer);
-    Block &right = BlockRight(block);
+    Block &block  = BlockOf(aPointer);
+    Block &right  = BlockRight(block);
+    Block *merged = &block;
 
     mMemory.mFreeSize += block.GetSize();
 
     if (IsLeftFree(block))
     {
-        Block *prev = &BlockSuper();
-        Block *left = &BlockNext(*prev);
+        Block &left = UnlinkLeftNeighborOf(block);
+
+        left.SetSize(left.GetSize() + block.GetSize() + sizeof(Block));
+        merged = &left;
 
         mMemory.mFreeSize += sizeof(Block);
+    }
 
-        for (const uint16_t offset = block.GetLeftNext(); left->GetNext() != offset; left = &BlockNext(*left))
-        {
-            prev = left;
-        }
+    if (right.IsFree())
+    {
+        BlockUnlink(right);
+        right.SetNext(0);
+        merged->SetSize(merged->GetSize() + right.GetSize() + sizeof(Block));
 
-        // Remove left from free list.
-        prev->SetNext(left->GetNext());
-        left->SetNext(0);
+        mMemory.mFreeSize += sizeof(Block);
+    }
 
-        if (right.IsFree())
-        {
-            mMemory.mFreeSize += sizeof(Block);
+    BlockInsert(*merged);
 
-            if (right.GetSize() > left->GetSize())
-            {
-                for (const uint16_t offset = BlockOffset(right); prev->GetNext() != offset; prev = &BlockNext(*prev));
-            }
-            else
-            {
-                prev = &BlockPrev(right);
-            }
+    mFreeCount++;
+}
 
-            // Remove right from free list.
-            prev->SetNext(right.GetNext());
-            right.SetNext(0);
+void Heap::GetStats(otHeapStats &aStats) const
+{
+    Heap &self = *AsNonConst(this);
 
-            // Add size of right.
-            left->SetSize(left->GetSize() + right.GetSize() + sizeof(Block));
-        }
+    memset(&aStats, 0, sizeof(aStats));
 
-        // Add size of current block.
-        left->SetSize(left->GetSize() + block.GetSize() + sizeof(Block));
+    aStats.mCapacity             = kFirstBlockSize;
+    aStats.mFreeSize             = mMemory.mFreeSize;
+    aStats.mNumAllocations       = mAllocCount;
+    aStats.mNumFrees             = mFreeCount;
+    aStats.mNumFailedAllocations = mFailedAllocCount;
 
-        BlockInsert(*prev, *left);
-    }
-    else
+    for (uint8_t bin = 0; bin < kNumBins; bin++)
     {
-        if (right.IsFree())
+        for (uint16_t offset = mBinHeads[bin]; offset != kGuardBlockOffset; offset = self.BlockAt(offset).GetNext())
         {
-            Block &prev = BlockPrev(right);
-            prev.SetNext(right.GetNext());
-            block.SetSize(block.GetSize() + right.GetSize() + sizeof(Block));
-            BlockInsert(prev, block);
+            const Block &block = self.BlockAt(offset);
 
-            mMemory.mFreeSize += sizeof(Block);
-        }
-        else
-        {
-            BlockInsert(BlockSuper(), block);
+            aStats.mNumFreeBlocks++;
+            aStats.mNumFreeBlocksInBin[bin]++;
+            aStats.mLargestFreeBlockSize = Max(aStats.mLargestFreeBlockSize, block.GetSize());
         }
     }
 }
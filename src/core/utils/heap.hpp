@@ -41,6 +41,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <openthread/heap.h>
+
 #include "common/const_cast.hpp"
 #include "common/non_copyable.hpp"
 
@@ -195,9 +197,8 @@ public:
     bool IsClean(void) const
     {
         Heap        &self  = *AsNonConst(this);
-        const Block &super = self.BlockSuper();
-        const Block &first = self.BlockRight(super);
-        return super.GetNext() == self.BlockOffset(first) && first.GetSize() == kFirstBlockSize;
+        const Block &first = self.BlockAt(kFirstBlockOffset);
+        return first.GetSize() == kFirstBlockSize && first.IsFree();
     }
 
     /**
@@ -210,6 +211,13 @@ public:
      */
     size_t GetFreeSize(void) const { return mMemory.mFreeSize; }
 
+    /**
+     * Gets the heap statistics (free-block bin occupancy, largest free block, and alloc/free counts).
+     *
+     * @param[out]  aStats   A reference to an `otHeapStats` to populate.
+     */
+    void GetStats(otHeapStats &aStats) const;
+
 private:
 #if OPENTHREAD_CONFIG_TLS_ENABLE || OPENTHREAD_CONFIG_SECURE_TRANSPORT_ENABLE
     static constexpr uint16_t kMemorySize = OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE;
@@ -225,6 +233,14 @@ private:
     static constexpr uint16_t kGuardBlockOffset   = kMemorySize - sizeof(uint16_t);
     static constexpr uint16_t kTotalSizeGuard     = kAlignSize + sizeof(Block);
 
+    // Free blocks are kept in size-segregated bins. Bin `n` holds
+    // blocks with size in `[kBinBaseSize << (n - 1), kBinBaseSize << n)`
+    // bytes; the first bin holds blocks smaller than `kBinBaseSize` and
+    // the last bin all larger blocks. Each bin list is sorted by size
+    // (minimal to maximum) and is terminated by `kGuardBlockOffset`.
+    static constexpr uint8_t  kNumBins     = OT_HEAP_NUM_SIZE_BINS;
+    static constexpr uint16_t kBinBaseSize = 16;
+
     static_assert(kMemorySize % kAlignSize == 0, "The heap memory size is not aligned to kAlignSize!");
 
     /**
@@ -251,14 +267,7 @@ private:
     }
 
     /**
-     * Returns the super block.
-     *
-     * @returns Reference to the super block.
-     */
-    Block &BlockSuper(void) { return BlockAt(kSuperBlockOffset); }
-
-    /**
-     * Returns the free block after @p aBlock in the free block list.
+     * Returns the free block after @p aBlock in its free block list.
      *
      * @param[in]   aBlock  A reference to the block.
      *
@@ -275,13 +284,6 @@ private:
      */
     Block &BlockRight(const Block &aBlock) { return BlockAt(BlockOffset(aBlock) + sizeof(Block) + aBlock.GetSize()); }
 
-    /**
-     * Returns the free block before @p aBlock in the free block list.
-     *
-     * @returns Reference to the free block before this block.
-     */
-    Block &BlockPrev(const Block &aBlock);
-
     /**
      * Returns whether the block on the left side of @p aBlock is free.
      *
@@ -302,14 +304,45 @@ private:
     }
 
     /**
-     * Inserts @p aBlock into the free block list.
+     * Returns the index of the size bin holding free blocks of size @p aSize.
      *
-     * The free block list is single linked and is sorted by size from minimal to maximum.
+     * @param[in]   aSize   Block size in bytes.
+     *
+     * @returns Index of the size bin.
+     */
+    static uint8_t BinIndexFor(uint16_t aSize);
+
+    /**
+     * Inserts @p aBlock into the free block list of its size bin.
+     *
+     * Each bin list is single linked and is sorted by size from minimal to maximum.
      *
-     * @param[in]   aPrev   A reference to the block after which to place @p aBlock.
      * @param[in]   aBlock  A reference to the block.
      */
-    void BlockInsert(Block &aPrev, Block &aBlock);
+    void BlockInsert(Block &aBlock);
+
+    /**
+     * Removes @p aBlock from the free block list of its size bin.
+     *
+     * @param[in]   aBlock  A reference to the block (MUST be in the free list).
+     */
+    void BlockUnlink(Block &aBlock);
+
+    /**
+     * Finds the free block immediately to the left of @p aBlock and removes it from its free block list.
+     *
+     * The left neighbor block MUST be free, i.e., `aBlock.IsLeftFree()`.
+     *
+     * @param[in]   aBlock  A reference to the block.
+     *
+     * @returns Reference to the (unlinked) left neighbor block.
+     */
+    Block &UnlinkLeftNeighborOf(const Block &aBlock);
+
+    uint16_t mBinHeads[kNumBins]; // Offset of the first free block in each bin (`kGuardBlockOffset` if empty).
+    uint32_t mAllocCount;         // Number of successful allocations.
+    uint32_t mFreeCount;          // Number of frees.
+    uint32_t mFailedAllocCount;   // Number of failed allocations.
 
     union
     {
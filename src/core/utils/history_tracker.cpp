@@ -46,6 +46,7 @@ namespace HistoryTracker {
 Local::Local(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mTimer(aInstance)
+    , mNextBufferPressureTime(TimerMilli::GetNow())
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_NET_DATA
     , mPreviousNetworkData(aInstance, mNetworkDataTlvBuffer, 0, sizeof(mNetworkDataTlvBuffer))
 #endif
@@ -74,6 +75,37 @@ exit:
     return;
 }
 
+void Local::RecordBufferPressure(void)
+{
+    BufferPressureInfo *entry;
+    TimeMilli           now = TimerMilli::GetNow();
+
+    // Rate limit recording to one entry per time bucket, so that
+    // sustained buffer exhaustion does not flush the history list.
+
+    VerifyOrExit(now >= mNextBufferPressureTime);
+
+    entry = mBufferPressureHistory.AddNewEntry();
+    VerifyOrExit(entry != nullptr);
+
+    mNextBufferPressureTime = now + kBufferPressureBucketInterval;
+
+    entry->mFreeBuffers       = Get<MessagePool>().GetFreeBufferCount();
+    entry->mMaxUsedBuffers    = Get<MessagePool>().GetMaxUsedBufferCount();
+    entry->mSendQueueMessages = Get<MeshForwarder>().GetSendQueueNumMessages();
+
+exit:
+    return;
+}
+
+#if OPENTHREAD_CONFIG_MESSAGE_LIFECYCLE_TRACE_ENABLE
+static uint16_t ClampTraceDuration(uint32_t aDurationMsec)
+{
+    // `0xffff` indicates an untracked duration, so clamp to one below it.
+    return static_cast<uint16_t>(Min<uint32_t>(aDurationMsec, OT_HISTORY_TRACKER_MSG_DURATION_UNTRACKED - 1));
+}
+#endif
+
 void Local::RecordMessage(const Message      &aMessage,
                           const Mac::Address &aMacAddress,
                           MessageType         aType,
@@ -132,6 +164,27 @@ void Local::RecordMessage(const Message      &aMessage,
     entry->mLinkSecurity         = aMessage.IsLinkSecurityEnabled();
     entry->mTxSuccess            = (aType == kTxMessage) ? aIsTxSuccess : true;
     entry->mPriority             = aMessage.GetPriority();
+    entry->mQueueTimeMsec        = OT_HISTORY_TRACKER_MSG_DURATION_UNTRACKED;
+    entry->mTxTimeMsec           = OT_HISTORY_TRACKER_MSG_DURATION_UNTRACKED;
+
+#if OPENTHREAD_CONFIG_MESSAGE_LIFECYCLE_TRACE_ENABLE
+    if (aType == kTxMessage)
+    {
+        TimeMilli queueTime;
+        TimeMilli framePrepTime;
+
+        if (aMessage.GetLifecycleTimes(queueTime, framePrepTime))
+        {
+            // `RecordMessage()` is called when the MAC transmission of
+            // the message's last frame is done, so the current time
+            // serves as the TX done time.
+            TimeMilli now = TimerMilli::GetNow();
+
+            entry->mQueueTimeMsec = ClampTraceDuration(framePrepTime - queueTime);
+            entry->mTxTimeMsec    = ClampTraceDuration(now - framePrepTime);
+        }
+    }
+#endif
 
     if (aMacAddress.IsExtended())
     {
@@ -649,6 +702,7 @@ void Local::HandleTimer(void)
     mMulticastAddressHistory.UpdateAgedEntries();
     mRxHistory.UpdateAgedEntries();
     mTxHistory.UpdateAgedEntries();
+    mBufferPressureHistory.UpdateAgedEntries();
     mNeighborHistory.UpdateAgedEntries();
     mOnMeshPrefixHistory.UpdateAgedEntries();
     mExternalRouteHistory.UpdateAgedEntries();
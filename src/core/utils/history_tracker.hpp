@@ -110,6 +110,7 @@ typedef otHistoryTrackerNetworkInfo          NetworkInfo;          ///< Thread n
 typedef otHistoryTrackerUnicastAddressInfo   UnicastAddressInfo;   ///< Unicast IPv6 address info.
 typedef otHistoryTrackerMulticastAddressInfo MulticastAddressInfo; ///< Multicast IPv6 address info.
 typedef otHistoryTrackerMessageInfo          MessageInfo;          ///< RX/TX IPv6 message info.
+typedef otHistoryTrackerBufferPressureInfo   BufferPressureInfo;   ///< Message buffer pressure info.
 typedef otHistoryTrackerNeighborInfo         NeighborInfo;         ///< Neighbor info.
 typedef otHistoryTrackerRouterInfo           RouterInfo;           ///< Router info.
 typedef otHistoryTrackerOnMeshPrefixInfo     OnMeshPrefixInfo;     ///< Network Data on mesh prefix info.
@@ -153,6 +154,7 @@ class Local : public InstanceLocator, private NonCopyable
     friend class ot::IndirectSender;
 #endif
     friend class ot::MeshForwarder;
+    friend class ot::MessagePool;
     friend class ot::Notifier;
     friend class ot::Mle::Mle;
     friend class ot::NeighborTable;
@@ -257,6 +259,60 @@ public:
         return mTxHistory.Iterate(aIterator, aEntryAge);
     }
 
+    /**
+     * Exports multiple entries from the RX history list in a single call.
+     *
+     * Entries are copied into @p aEntries (and their ages into @p aEntryAges) starting from the current iterator
+     * position, until either @p aMaxEntries entries are copied or the end of the list is reached. The iterator is
+     * advanced past the copied entries, so repeated calls drain the full list.
+     *
+     * @param[in,out] aIterator    An iterator. MUST be initialized.
+     * @param[out]    aEntries     A pointer to an array of entries to populate.
+     * @param[out]    aEntryAges   A pointer to an array to output the entries' ages (one per copied entry).
+     * @param[in]     aMaxEntries  The maximum number of entries to copy (size of @p aEntries and @p aEntryAges).
+     *
+     * @returns The number of entries copied into @p aEntries.
+     */
+    uint16_t ExportRxHistory(Iterator &aIterator, MessageInfo *aEntries, uint32_t *aEntryAges, uint16_t aMaxEntries)
+        const
+    {
+        return mRxHistory.Export(aIterator, aEntries, aEntryAges, aMaxEntries);
+    }
+
+    /**
+     * Exports multiple entries from the TX history list in a single call.
+     *
+     * Behaves the same as `ExportRxHistory()` but for the TX history list.
+     *
+     * @param[in,out] aIterator    An iterator. MUST be initialized.
+     * @param[out]    aEntries     A pointer to an array of entries to populate.
+     * @param[out]    aEntryAges   A pointer to an array to output the entries' ages (one per copied entry).
+     * @param[in]     aMaxEntries  The maximum number of entries to copy (size of @p aEntries and @p aEntryAges).
+     *
+     * @returns The number of entries copied into @p aEntries.
+     */
+    uint16_t ExportTxHistory(Iterator &aIterator, MessageInfo *aEntries, uint32_t *aEntryAges, uint16_t aMaxEntries)
+        const
+    {
+        return mTxHistory.Export(aIterator, aEntries, aEntryAges, aMaxEntries);
+    }
+
+    /**
+     * Iterates over the entries in the message buffer pressure history list.
+     *
+     * @param[in,out] aIterator  An iterator. MUST be initialized.
+     * @param[out]    aEntryAge  A reference to a variable to output the entry's age.
+     *                           Age is provided as the duration (in milliseconds) from when entry was recorded to
+     *                           @p aIterator initialization time. It is set to `kMaxAge` for entries older than max
+     *                           age.
+     *
+     * @returns A pointer to `BufferPressureInfo` entry or `nullptr` if no more entries in the list.
+     */
+    const BufferPressureInfo *IterateBufferPressureHistory(Iterator &aIterator, uint32_t &aEntryAge) const
+    {
+        return mBufferPressureHistory.Iterate(aIterator, aEntryAge);
+    }
+
     const NeighborInfo *IterateNeighborHistory(Iterator &aIterator, uint32_t &aEntryAge) const
     {
         return mNeighborHistory.Iterate(aIterator, aEntryAge);
@@ -337,11 +393,15 @@ private:
 
     static constexpr uint32_t kAgeCheckPeriod = 16 * Time::kOneHourInMsec;
 
+    static constexpr uint32_t kBufferPressureBucketInterval =
+        OPENTHREAD_CONFIG_HISTORY_TRACKER_BUFFER_PRESSURE_BUCKET_INTERVAL;
+
     static constexpr uint16_t kNetInfoListSize       = OPENTHREAD_CONFIG_HISTORY_TRACKER_NET_INFO_LIST_SIZE;
     static constexpr uint16_t kUnicastAddrListSize   = OPENTHREAD_CONFIG_HISTORY_TRACKER_UNICAST_ADDRESS_LIST_SIZE;
     static constexpr uint16_t kMulticastAddrListSize = OPENTHREAD_CONFIG_HISTORY_TRACKER_MULTICAST_ADDRESS_LIST_SIZE;
     static constexpr uint16_t kRxListSize            = OPENTHREAD_CONFIG_HISTORY_TRACKER_RX_LIST_SIZE;
     static constexpr uint16_t kTxListSize            = OPENTHREAD_CONFIG_HISTORY_TRACKER_TX_LIST_SIZE;
+    static constexpr uint16_t kBufferPressureListSize = OPENTHREAD_CONFIG_HISTORY_TRACKER_BUFFER_PRESSURE_LIST_SIZE;
     static constexpr uint16_t kNeighborListSize      = OPENTHREAD_CONFIG_HISTORY_TRACKER_NEIGHBOR_LIST_SIZE;
     static constexpr uint16_t kRouterListSize        = OPENTHREAD_CONFIG_HISTORY_TRACKER_ROUTER_LIST_SIZE;
     static constexpr uint16_t kOnMeshPrefixListSize  = OPENTHREAD_CONFIG_HISTORY_TRACKER_ON_MESH_PREFIX_LIST_SIZE;
@@ -474,6 +534,27 @@ private:
                                                                                                      : nullptr;
         }
 
+        // Copies up to `aMaxEntries` entries (and their ages) starting
+        // from the iterator position, advancing the iterator.
+        uint16_t Export(Iterator &aIterator, Entry *aEntries, uint32_t *aEntryAges, uint16_t aMaxEntries) const
+        {
+            uint16_t count;
+
+            for (count = 0; count < aMaxEntries; count++)
+            {
+                const Entry *entry = Iterate(aIterator, aEntryAges[count]);
+
+                if (entry == nullptr)
+                {
+                    break;
+                }
+
+                aEntries[count] = *entry;
+            }
+
+            return count;
+        }
+
     private:
         Timestamp mTimestamps[kMaxSize];
         Entry     mEntries[kMaxSize];
@@ -488,6 +569,7 @@ private:
         Entry       *AddNewEntry(void) { return nullptr; }
         void         AddNewEntry(const Entry &) {}
         const Entry *Iterate(Iterator &, uint32_t &) const { return nullptr; }
+        uint16_t     Export(Iterator &, Entry *, uint32_t *, uint16_t) const { return 0; }
         void         UpdateAgedEntries(void) {}
         void         RemoveAgedEntries(void) {}
     };
@@ -509,6 +591,7 @@ private:
     }
 
     void RecordNetworkInfo(void);
+    void RecordBufferPressure(void);
     void RecordMessage(const Message      &aMessage,
                        const Mac::Address &aMacAddress,
                        MessageType         aType,
@@ -516,6 +599,9 @@ private:
     void RecordNeighborEvent(NeighborTable::Event aEvent, const NeighborTable::EntryInfo &aInfo);
     void RecordAddressEvent(Ip6::Netif::AddressEvent aEvent, const Ip6::Netif::UnicastAddress &aUnicastAddress);
     void RecordAddressEvent(Ip6::Netif::AddressEvent aEvent, const Ip6::Netif::MulticastAddress &aMulticastAddress);
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadRlocAdded |
+        kEventThreadRlocRemoved | kEventThreadPartitionIdChanged | kEventThreadNetdataChanged;
+
     void HandleNotifierEvents(Events aEvents);
     void HandleTimer(void);
 #if OPENTHREAD_FTD
@@ -554,6 +640,7 @@ private:
     EntryList<MulticastAddressInfo, kMulticastAddrListSize> mMulticastAddressHistory;
     EntryList<MessageInfo, kRxListSize>                     mRxHistory;
     EntryList<MessageInfo, kTxListSize>                     mTxHistory;
+    EntryList<BufferPressureInfo, kBufferPressureListSize>  mBufferPressureHistory;
     EntryList<NeighborInfo, kNeighborListSize>              mNeighborHistory;
     EntryList<RouterInfo, kRouterListSize>                  mRouterHistory;
     EntryList<OnMeshPrefixInfo, kOnMeshPrefixListSize>      mOnMeshPrefixHistory;
@@ -572,6 +659,7 @@ private:
 #endif
 
     TrackerTimer mTimer;
+    TimeMilli    mNextBufferPressureTime;
 
 #if OPENTHREAD_FTD && (OPENTHREAD_CONFIG_HISTORY_TRACKER_ROUTER_LIST_SIZE > 0)
     struct RouterEntry
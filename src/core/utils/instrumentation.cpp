@@ -0,0 +1,109 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements hot-path instrumentation.
+ */
+
+#include "instrumentation.hpp"
+
+#if OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
+
+#include "common/code_utils.hpp"
+#include "common/num_utils.hpp"
+#include "instance/instance.hpp"
+
+namespace ot {
+namespace Utils {
+
+const char *const Instrumentation::kSiteNames[kNumSites] = {
+    "tasklet",       // (0) kSiteTasklet
+    "timer",         // (1) kSiteTimerHandler
+    "mf-tx-prepare", // (2) kSiteMeshForwarderTxPrepare
+    "mf-tx-done",    // (3) kSiteMeshForwarderTxDone
+    "mf-rx",         // (4) kSiteMeshForwarderRx
+};
+
+Instrumentation::Instrumentation(Instance &aInstance)
+    : InstanceLocator(aInstance)
+{
+    Reset();
+}
+
+Instrumentation::Scope::~Scope(void)
+{
+    mInstance.Get<Instrumentation>().Record(mSite, otPlatAlarmMicroGetNow() - mStartTime);
+}
+
+void Instrumentation::Record(Site aSite, uint32_t aDurationUs)
+{
+    SiteStats &stats = mSiteStats[aSite];
+    uint8_t    bin   = 0;
+
+    stats.mNumInvocations++;
+    stats.mTotalTimeUs += aDurationUs;
+    stats.mMaxTimeUs = Max(stats.mMaxTimeUs, aDurationUs);
+
+    // Bin `n` counts durations `d` (in usec) with `2^(n-1) <= d < 2^n`
+    // (bin 0 counts zero durations, the last bin also counts all
+    // longer durations).
+
+    while (((aDurationUs >> bin) != 0) && (bin < kNumHistogramBins - 1))
+    {
+        bin++;
+    }
+
+    stats.mHistogram[bin]++;
+}
+
+Error Instrumentation::GetSiteInfo(uint16_t aSiteIndex, SiteInfo &aInfo) const
+{
+    Error            error = kErrorNone;
+    const SiteStats *stats;
+
+    VerifyOrExit(aSiteIndex < kNumSites, error = kErrorNotFound);
+
+    stats = &mSiteStats[aSiteIndex];
+
+    aInfo.mName           = kSiteNames[aSiteIndex];
+    aInfo.mNumInvocations = stats->mNumInvocations;
+    aInfo.mTotalTimeUs    = stats->mTotalTimeUs;
+    aInfo.mMaxTimeUs      = stats->mMaxTimeUs;
+    memcpy(aInfo.mHistogram, stats->mHistogram, sizeof(aInfo.mHistogram));
+
+exit:
+    return error;
+}
+
+void Instrumentation::Reset(void) { memset(mSiteStats, 0, sizeof(mSiteStats)); }
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
@@ -0,0 +1,151 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for hot-path instrumentation.
+ */
+
+#ifndef OT_CORE_UTILS_INSTRUMENTATION_HPP_
+#define OT_CORE_UTILS_INSTRUMENTATION_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
+
+#include <openthread/instrumentation.h>
+#include <openthread/platform/alarm-micro.h>
+
+#include "common/error.hpp"
+#include "common/locator.hpp"
+#include "common/non_copyable.hpp"
+
+namespace ot {
+namespace Utils {
+
+/**
+ * Implements hot-path instrumentation.
+ *
+ * Execution times of instrumented sites (tasklet runs, timer handler invocations, `MeshForwarder` stages) are
+ * measured with the platform microsecond time base and accumulated into per-site log2 duration histograms.
+ */
+class Instrumentation : public InstanceLocator, private NonCopyable
+{
+public:
+    typedef otInstrumentationSiteInfo SiteInfo; ///< Accumulated statistics of an instrumented site.
+
+    /**
+     * Identifies an instrumented site.
+     */
+    enum Site : uint8_t
+    {
+        kSiteTasklet,                ///< A tasklet run (`Tasklet::RunTask()`).
+        kSiteTimerHandler,           ///< A timer handler invocation (`Timer::Fired()`).
+        kSiteMeshForwarderTxPrepare, ///< `MeshForwarder` transmit scheduling and frame preparation.
+        kSiteMeshForwarderTxDone,    ///< `MeshForwarder` sent frame handling.
+        kSiteMeshForwarderRx,        ///< `MeshForwarder` received frame handling.
+    };
+
+    /**
+     * Measures the execution time of a scope (RAII-style) and records it against a given site.
+     */
+    class Scope : private NonCopyable
+    {
+    public:
+        /**
+         * Initializes the scope, starting the time measurement.
+         *
+         * @param[in] aInstance  The OpenThread instance.
+         * @param[in] aSite      The site to record the measured time against.
+         */
+        Scope(Instance &aInstance, Site aSite)
+            : mInstance(aInstance)
+            , mSite(aSite)
+            , mStartTime(otPlatAlarmMicroGetNow())
+        {
+        }
+
+        /**
+         * Finalizes the scope, recording the measured time.
+         */
+        ~Scope(void);
+
+    private:
+        Instance &mInstance;
+        Site      mSite;
+        uint32_t  mStartTime;
+    };
+
+    /**
+     * Initializes the `Instrumentation` object.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     */
+    explicit Instrumentation(Instance &aInstance);
+
+    /**
+     * Gets the accumulated statistics of an instrumented site.
+     *
+     * @param[in]  aSiteIndex  The index of the site to retrieve.
+     * @param[out] aInfo       A reference to a `SiteInfo` to populate.
+     *
+     * @retval kErrorNone      Successfully populated @p aInfo.
+     * @retval kErrorNotFound  @p aSiteIndex is beyond the last instrumented site.
+     */
+    Error GetSiteInfo(uint16_t aSiteIndex, SiteInfo &aInfo) const;
+
+    /**
+     * Resets the accumulated statistics of all instrumented sites.
+     */
+    void Reset(void);
+
+private:
+    static constexpr uint16_t kNumSites         = kSiteMeshForwarderRx + 1;
+    static constexpr uint16_t kNumHistogramBins = OT_INSTRUMENTATION_NUM_HISTOGRAM_BINS;
+
+    struct SiteStats
+    {
+        uint32_t mNumInvocations;
+        uint64_t mTotalTimeUs;
+        uint32_t mMaxTimeUs;
+        uint32_t mHistogram[kNumHistogramBins];
+    };
+
+    void Record(Site aSite, uint32_t aDurationUs);
+
+    static const char *const kSiteNames[kNumSites];
+
+    SiteStats mSiteStats[kNumSites];
+};
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_INSTRUMENTATION_ENABLE
+
+#endif // OT_CORE_UTILS_INSTRUMENTATION_HPP_
@@ -53,6 +53,7 @@ JamDetector::JamDetector(Instance &aInstance)
     , mEnabled(false)
     , mAlwaysAboveThreshold(false)
     , mJamState(false)
+    , mWarningState(false)
     , mRssiThreshold(kDefaultRssiThreshold)
 {
 }
@@ -81,8 +82,9 @@ Error JamDetector::Stop(void)
 
     VerifyOrExit(mEnabled, error = kErrorAlready);
 
-    mEnabled  = false;
-    mJamState = false;
+    mEnabled      = false;
+    mJamState     = false;
+    mWarningState = false;
 
     mTimer.Stop();
 
@@ -101,6 +103,7 @@ void JamDetector::CheckState(void)
     case Mle::kRoleDisabled:
         VerifyOrExit(mTimer.IsRunning());
         mTimer.Stop();
+        SetWarningState(false);
         SetJamState(false);
         break;
 
@@ -110,6 +113,7 @@ void JamDetector::CheckState(void)
         mAlwaysAboveThreshold = true;
         mHistoryBitmap        = 0;
         mJamState             = false;
+        mWarningState         = false;
         mSampleInterval       = kMaxSampleInterval;
         mTimer.Start(kMinSampleInterval);
         break;
@@ -239,9 +243,26 @@ void JamDetector::UpdateJamState(void)
         bitmap &= (bitmap - 1);
     }
 
+    // The warning state covers the band between the warning threshold
+    // (half of the busy period) and the busy period itself, giving an
+    // early indication that the busy period is about to be reached.
+
+    SetWarningState((numJammedSeconds >= GetWarningThreshold()) && (numJammedSeconds < mBusyPeriod));
     SetJamState(numJammedSeconds >= mBusyPeriod);
 }
 
+uint8_t JamDetector::GetWarningThreshold(void) const
+{
+    uint8_t threshold = mBusyPeriod / 2;
+
+    // With a busy period of one second there is no room for an early
+    // warning. The threshold then matches the busy period and the
+    // warning state is never entered (the `< mBusyPeriod` check in
+    // `UpdateJamState()` fails first).
+
+    return Max<uint8_t>(threshold, 1);
+}
+
 void JamDetector::SetJamState(bool aNewState)
 {
     bool shouldInvokeHandler = aNewState;
@@ -259,6 +280,27 @@ void JamDetector::SetJamState(bool aNewState)
     }
 }
 
+void JamDetector::SetWarningState(bool aNewState)
+{
+    VerifyOrExit(aNewState != mWarningState);
+
+    mWarningState = aNewState;
+    LogInfo("Jam warning %s", mWarningState ? "raised" : "cleared");
+
+#if OPENTHREAD_CONFIG_JAM_DETECTION_PROACTIVE_CHANNEL_SELECT_ENABLE && OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE && \
+    OPENTHREAD_FTD
+    if (mWarningState)
+    {
+        IgnoreError(Get<ChannelManager>().RequestNetworkChannelSelect(/* aSkipQualityCheck */ false));
+    }
+#endif
+
+    mWarningCallback.InvokeIfSet(aNewState);
+
+exit:
+    return;
+}
+
 void JamDetector::HandleNotifierEvents(Events aEvents)
 {
     if (aEvents.Contains(kEventThreadRoleChanged))
@@ -102,6 +102,27 @@ public:
      */
     bool GetState(void) const { return mJamState; }
 
+    /**
+     * Set the handler called when the jam warning state changes.
+     *
+     * The warning state is entered when the number of jammed seconds within the detection window reaches half of the
+     * busy period (but is still below it), i.e., before the hard jam threshold is reached. This allows a user (e.g.,
+     * `ChannelManager`) to react proactively, before throughput has collapsed. The handler is invoked with `true`
+     * when the warning state is entered and with `false` when it is left (including when the full jam state is
+     * reached).
+     *
+     * @param[in]  aHandler   A pointer to a function called on warning state changes (can be `nullptr` to clear).
+     * @param[in]  aContext   A pointer to application-specific context.
+     */
+    void SetWarningCallback(Handler aHandler, void *aContext) { mWarningCallback.Set(aHandler, aContext); }
+
+    /**
+     * Get the current jam warning state.
+     *
+     * @returns The jam warning state (`true` if in warning state, `false` otherwise).
+     */
+    bool GetWarningState(void) const { return mWarningState; }
+
     /**
      * Set the Jam Detection RSSI Threshold (in dBm).
      *
@@ -176,16 +197,22 @@ private:
     static constexpr uint16_t kMinSampleInterval = 2;   // in ms
     static constexpr uint32_t kMaxRandomDelay    = 4;   // in ms
 
+    uint8_t GetWarningThreshold(void) const;
+
     void CheckState(void);
     void SetJamState(bool aNewState);
+    void SetWarningState(bool aNewState);
     void HandleTimer(void);
     void UpdateHistory(bool aDidExceedThreshold);
     void UpdateJamState(void);
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged;
+
     void HandleNotifierEvents(Events aEvents);
 
     using SampleTimer = TimerMilliIn<JamDetector, &JamDetector::HandleTimer>;
 
     Callback<Handler> mCallback;                 // Callback to inform about jamming state
+    Callback<Handler> mWarningCallback;          // Callback to inform about jam warning state
     SampleTimer       mTimer;                    // RSSI sample timer
     uint64_t          mHistoryBitmap;            // History bitmap, each bit correspond to 1 sec interval
     TimeMilli         mCurSecondStartTime;       // Start time for current 1 sec interval
@@ -195,6 +222,7 @@ private:
     bool              mEnabled : 1;              // If jam detection is enabled
     bool              mAlwaysAboveThreshold : 1; // State for current 1 sec interval
     bool              mJamState : 1;             // Current jam state
+    bool              mWarningState : 1;         // Current jam warning state
     int8_t            mRssiThreshold;            // RSSI threshold for jam detection
 };
 
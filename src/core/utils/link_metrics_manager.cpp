@@ -49,6 +49,8 @@ RegisterLogModule("LinkMetricsMgr");
 LinkMetricsManager::LinkMetricsManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mTimer(aInstance)
+    , mConfigBatchBudget(0)
+    , mHasPendingConfigs(false)
     , mEnabled(OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_ON_BY_DEFAULT)
 {
 }
@@ -88,6 +90,37 @@ exit:
     return error;
 }
 
+Error LinkMetricsManager::GetNextMetricsValue(uint16_t                   &aIterator,
+                                              Mac::ExtAddress            &aExtAddress,
+                                              LinkMetrics::MetricsValues &aMetricsValues)
+{
+    Error    error = kErrorNotFound;
+    uint16_t index = 0;
+
+    for (Subject &subject : mSubjectList)
+    {
+        if (index++ < aIterator)
+        {
+            continue;
+        }
+
+        aIterator++;
+
+        if (subject.mState != kActive && subject.mState != kRenewing)
+        {
+            continue;
+        }
+
+        aExtAddress                     = subject.mExtAddress;
+        aMetricsValues.mLinkMarginValue = subject.mData.mLinkMargin;
+        aMetricsValues.mRssiValue       = subject.mData.mRssi;
+        error                           = kErrorNone;
+        break;
+    }
+
+    return error;
+}
+
 void LinkMetricsManager::Start(void)
 {
     LinkMetrics::Initiator &initiator = Get<LinkMetrics::Initiator>();
@@ -147,10 +180,15 @@ exit:
 }
 
 // This method updates the state and take corresponding actions for all subjects and removes stale subjects.
+// Configuration exchanges are batched: at most `kMaxConfigsPerBatch` subjects are (re)configured per call, with
+// the remaining ones handled in subsequent staggered batches (see `HandleTimer()`).
 void LinkMetricsManager::UpdateLinkMetricsStates(void)
 {
     LinkedList<Subject> staleSubjects;
 
+    mConfigBatchBudget = kMaxConfigsPerBatch;
+    mHasPendingConfigs = false;
+
     mSubjectList.RemoveAllMatching(staleSubjects, *this);
 
     while (!staleSubjects.IsEmpty())
@@ -199,7 +237,7 @@ void LinkMetricsManager::HandleTimer(void)
     if (Get<Mle::Mle>().IsAttached())
     {
         Update();
-        mTimer.Start(kStateUpdateIntervalMilliSec);
+        mTimer.Start(mHasPendingConfigs ? kConfigureBatchIntervalMilliSec : kStateUpdateIntervalMilliSec);
     }
 }
 
@@ -272,7 +310,7 @@ exit:
 // This special Match method is used for "iterating over list while removing some items"
 bool LinkMetricsManager::Subject::Matches(const LinkMetricsManager &aLinkMetricsMgr)
 {
-    Error error = UpdateState(aLinkMetricsMgr.GetInstance());
+    Error error = UpdateState(AsNonConst(aLinkMetricsMgr));
 
     return error == kErrorUnknownNeighbor || error == kErrorNotCapable;
 }
@@ -318,7 +356,7 @@ exit:
     return error;
 }
 
-Error LinkMetricsManager::Subject::UpdateState(Instance &aInstance)
+Error LinkMetricsManager::Subject::UpdateState(LinkMetricsManager &aLinkMetricsMgr)
 {
     bool     shouldConfigure = false;
     uint32_t pastTimeMs;
@@ -354,7 +392,35 @@ Error LinkMetricsManager::Subject::UpdateState(Instance &aInstance)
 
     if (shouldConfigure)
     {
-        error = ConfigureEap(aInstance);
+        if (aLinkMetricsMgr.mConfigBatchBudget == 0)
+        {
+            // Batch budget for this update is used up - leave the
+            // subject as is and revisit it in the next staggered batch.
+            aLinkMetricsMgr.mHasPendingConfigs = true;
+            ExitNow();
+        }
+
+        error = ConfigureEap(aLinkMetricsMgr.GetInstance());
+
+        switch (error)
+        {
+        case kErrorNone:
+            aLinkMetricsMgr.mConfigBatchBudget--;
+            break;
+
+        case kErrorUnknownNeighbor:
+            break;
+
+        default:
+            // A send failure (e.g., out of buffers) likely affects all
+            // remaining subjects - stop this batch and retry shortly,
+            // sharing the retry across subjects rather than burning
+            // per-subject attempts.
+            aLinkMetricsMgr.mConfigBatchBudget = 0;
+            aLinkMetricsMgr.mHasPendingConfigs = true;
+            error                              = kErrorNone;
+            break;
+        }
     }
 
 exit:
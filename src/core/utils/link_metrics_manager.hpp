@@ -138,7 +138,7 @@ class LinkMetricsManager : public InstanceLocator, private NonCopyable
 
         Error ConfigureEap(Instance &aInstance);
         Error UnregisterEap(Instance &aInstance);
-        Error UpdateState(Instance &aInstance);
+        Error UpdateState(LinkMetricsManager &aLinkMetricsMgr);
     };
 
 public:
@@ -176,10 +176,29 @@ public:
      */
     Error GetLinkMetricsValueByExtAddr(const Mac::ExtAddress &aExtAddress, LinkMetrics::MetricsValues &aMetricsValues);
 
+    /**
+     * Get the Link Metrics data of all subjects, one subject per call (aggregate snapshot iteration).
+     *
+     * To start the iteration set @p aIterator to zero. Subjects without valid data (not yet configured or not
+     * capable) are skipped.
+     *
+     * @param[in,out] aIterator       An iterator. MUST be zero on the first call.
+     * @param[out]    aExtAddress     A reference to output the extended address of the subject.
+     * @param[out]    aMetricsValues  A reference to the MetricsValues object to place the result.
+     *
+     * @retval kErrorNone      Successfully got the next metrics value.
+     * @retval kErrorNotFound  No more subjects with valid data.
+     */
+    Error GetNextMetricsValue(uint16_t                   &aIterator,
+                              Mac::ExtAddress            &aExtAddress,
+                              LinkMetrics::MetricsValues &aMetricsValues);
+
 private:
     static constexpr uint16_t kTimeBeforeStartMilliSec         = 5000;
     static constexpr uint32_t kStateUpdateIntervalMilliSec     = 150000;
+    static constexpr uint32_t kConfigureBatchIntervalMilliSec  = 1000;
     static constexpr uint8_t  kConfigureLinkMetricsMaxAttempts = 3;
+    static constexpr uint16_t kMaxConfigsPerBatch              = OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_MAX_CONFIGS_PER_BATCH;
 #if OPENTHREAD_FTD
     static constexpr uint8_t kMaximumSubjectToTrack = 128;
 #elif OPENTHREAD_MTD
@@ -194,6 +213,8 @@ private:
     void UnregisterAllSubjects(void);
     void ReleaseAllSubjects(void);
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged;
+
     void        HandleNotifierEvents(Events aEvents);
     void        HandleTimer(void);
     static void HandleMgmtResponse(const otIp6Address *aAddress, otLinkMetricsStatus aStatus, void *aContext);
@@ -211,6 +232,8 @@ private:
     Pool<Subject, kMaximumSubjectToTrack> mPool;
     LinkedList<Subject>                   mSubjectList;
     LinkMetricsMgrTimer                   mTimer;
+    uint16_t                              mConfigBatchBudget;
+    bool                                  mHasPendingConfigs;
     bool                                  mEnabled;
 };
 
@@ -50,8 +50,6 @@ RegisterLogModule("MeshDiag");
 MeshDiag::MeshDiag(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mState(kStateIdle)
-    , mExpectedQueryId(0)
-    , mExpectedAnswerIndex(0)
     , mResponseTimeout(kResponseTimeout)
     , mTimer(aInstance)
 {
@@ -71,7 +69,7 @@ Error MeshDiag::DiscoverTopology(const DiscoverConfig &aConfig, DiscoverCallback
     uint8_t tlvsLength = 0;
 
     VerifyOrExit(Get<Mle::Mle>().IsAttached(), error = kErrorInvalidState);
-    VerifyOrExit(mState == kStateIdle, error = kErrorBusy);
+    VerifyOrExit((mState == kStateIdle) && !HasActiveQuery(), error = kErrorBusy);
 
     tlvs[tlvsLength++] = Address16Tlv::kType;
     tlvs[tlvsLength++] = ExtMacAddressTlv::kType;
@@ -155,25 +153,45 @@ exit:
     return;
 }
 
-Error MeshDiag::SendQuery(uint16_t aRloc16, const uint8_t *aTlvs, uint8_t aTlvsLength)
+Error MeshDiag::SendQuery(uint16_t aRloc16, const uint8_t *aTlvs, uint8_t aTlvsLength, QuerySlot *&aSlot)
 {
     Error        error = kErrorNone;
     Ip6::Address destination;
 
+    aSlot = nullptr;
+
     VerifyOrExit(Get<Mle::Mle>().IsAttached(), error = kErrorInvalidState);
     VerifyOrExit(mState == kStateIdle, error = kErrorBusy);
     VerifyOrExit(Mle::IsRouterRloc16(aRloc16), error = kErrorInvalidArgs);
     VerifyOrExit(Get<RouterTable>().IsAllocated(Mle::RouterIdFromRloc16(aRloc16)), error = kErrorNotFound);
 
+    // Pace queries per destination: at most one outstanding query
+    // towards a given destination at any time.
+
+    VerifyOrExit(FindQuerySlot(aRloc16) == nullptr, error = kErrorBusy);
+
+    for (QuerySlot &slot : mQuerySlots)
+    {
+        if (!slot.IsInUse())
+        {
+            aSlot = &slot;
+            break;
+        }
+    }
+
+    VerifyOrExit(aSlot != nullptr, error = kErrorBusy);
+
     destination.SetToRoutingLocator(Get<Mle::Mle>().GetMeshLocalPrefix(), aRloc16);
 
     SuccessOrExit(error = Get<Client>().SendCommand(kUriDiagnosticGetQuery, Message::kPriorityNormal, destination,
                                                     aTlvs, aTlvsLength));
 
-    mExpectedQueryId     = Get<Client>().GetLastQueryId();
-    mExpectedAnswerIndex = 0;
+    aSlot->mRloc16      = aRloc16;
+    aSlot->mQueryId     = Get<Client>().GetLastQueryId();
+    aSlot->mAnswerIndex = 0;
+    aSlot->mExpireTime  = TimerMilli::GetNow() + mResponseTimeout;
 
-    mTimer.Start(mResponseTimeout);
+    mTimer.FireAtIfEarlier(aSlot->mExpireTime);
 
 exit:
     return error;
@@ -183,13 +201,13 @@ Error MeshDiag::QueryChildTable(uint16_t aRloc16, QueryChildTableCallback aCallb
 {
     static const uint8_t kTlvTypes[] = {ChildTlv::kType};
 
-    Error error;
+    Error      error;
+    QuerySlot *slot;
 
-    SuccessOrExit(error = SendQuery(aRloc16, kTlvTypes, sizeof(kTlvTypes)));
+    SuccessOrExit(error = SendQuery(aRloc16, kTlvTypes, sizeof(kTlvTypes), slot));
 
-    mQueryChildTable.mCallback.Set(aCallback, aContext);
-    mQueryChildTable.mRouterRloc16 = aRloc16;
-    mState                         = kStateQueryChildTable;
+    slot->mChildTableCallback.Set(aCallback, aContext);
+    slot->mType = QuerySlot::kTypeChildTable;
 
 exit:
     return error;
@@ -199,13 +217,13 @@ Error MeshDiag::QueryChildrenIp6Addrs(uint16_t aRloc16, ChildIp6AddrsCallback aC
 {
     static const uint8_t kTlvTypes[] = {ChildIp6AddressListTlv::kType};
 
-    Error error;
+    Error      error;
+    QuerySlot *slot;
 
-    SuccessOrExit(error = SendQuery(aRloc16, kTlvTypes, sizeof(kTlvTypes)));
+    SuccessOrExit(error = SendQuery(aRloc16, kTlvTypes, sizeof(kTlvTypes), slot));
 
-    mQueryChildrenIp6Addrs.mCallback.Set(aCallback, aContext);
-    mQueryChildrenIp6Addrs.mParentRloc16 = aRloc16;
-    mState                               = kStateQueryChildrenIp6Addrs;
+    slot->mChildIp6AddrsCallback.Set(aCallback, aContext);
+    slot->mType = QuerySlot::kTypeChildrenIp6Addrs;
 
 exit:
     return error;
@@ -215,83 +233,119 @@ Error MeshDiag::QueryRouterNeighborTable(uint16_t aRloc16, RouterNeighborTableCa
 {
     static const uint8_t kTlvTypes[] = {RouterNeighborTlv::kType};
 
-    Error error;
+    Error      error;
+    QuerySlot *slot;
 
-    SuccessOrExit(error = SendQuery(aRloc16, kTlvTypes, sizeof(kTlvTypes)));
+    SuccessOrExit(error = SendQuery(aRloc16, kTlvTypes, sizeof(kTlvTypes), slot));
 
-    mQueryRouterNeighborTable.mCallback.Set(aCallback, aContext);
-    mQueryRouterNeighborTable.mRouterRloc16 = aRloc16;
-    mState                                  = kStateQueryRouterNeighborTable;
+    slot->mNeighborTableCallback.Set(aCallback, aContext);
+    slot->mType = QuerySlot::kTypeRouterNeighborTable;
 
 exit:
     return error;
 }
 
+MeshDiag::QuerySlot *MeshDiag::FindQuerySlot(uint16_t aRloc16)
+{
+    QuerySlot *match = nullptr;
+
+    for (QuerySlot &slot : mQuerySlots)
+    {
+        if (slot.IsInUse() && (slot.mRloc16 == aRloc16))
+        {
+            match = &slot;
+            break;
+        }
+    }
+
+    return match;
+}
+
+bool MeshDiag::HasActiveQuery(void) const
+{
+    bool hasActive = false;
+
+    for (const QuerySlot &slot : mQuerySlots)
+    {
+        if (slot.IsInUse())
+        {
+            hasActive = true;
+            break;
+        }
+    }
+
+    return hasActive;
+}
+
 bool MeshDiag::HandleDiagnosticGetAnswer(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    bool didProcess = false;
+    bool       didProcess = false;
+    QuerySlot *slot;
 
-    switch (mState)
+    slot = MatchQuerySlot(aMessage, aMessageInfo);
+    VerifyOrExit(slot != nullptr);
+
+    switch (slot->mType)
     {
-    case kStateQueryChildTable:
-        didProcess = ProcessChildTableAnswer(aMessage, aMessageInfo);
+    case QuerySlot::kTypeChildTable:
+        didProcess = ProcessChildTableAnswer(*slot, aMessage);
         break;
 
-    case kStateQueryChildrenIp6Addrs:
-        didProcess = ProcessChildrenIp6AddrsAnswer(aMessage, aMessageInfo);
+    case QuerySlot::kTypeChildrenIp6Addrs:
+        didProcess = ProcessChildrenIp6AddrsAnswer(*slot, aMessage);
         break;
 
-    case kStateQueryRouterNeighborTable:
-        didProcess = ProcessRouterNeighborTableAnswer(aMessage, aMessageInfo);
+    case QuerySlot::kTypeRouterNeighborTable:
+        didProcess = ProcessRouterNeighborTableAnswer(*slot, aMessage);
         break;
 
-    default:
+    case QuerySlot::kTypeNone:
         break;
     }
 
+exit:
     return didProcess;
 }
 
-Error MeshDiag::ProcessMessage(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo, uint16_t aSenderRloc16)
+MeshDiag::QuerySlot *MeshDiag::MatchQuerySlot(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    // This method processes the received answer message to
-    // check whether it is from the intended sender and matches
-    // the expected query ID and answer index.
+    // This method checks whether the received answer message is from
+    // the intended sender of an outstanding query and matches its
+    // expected query ID and answer index, returning the matched query
+    // slot (or `nullptr` if there is no match).
 
-    Error          error = kErrorFailed;
+    QuerySlot     *slot = nullptr;
     AnswerTlvValue answerTlvValue;
     uint16_t       queryId;
 
     VerifyOrExit(Get<Mle::Mle>().IsRoutingLocator(aMessageInfo.GetPeerAddr()));
-    VerifyOrExit(aMessageInfo.GetPeerAddr().GetIid().GetLocator() == aSenderRloc16);
 
     SuccessOrExit(Tlv::Find<QueryIdTlv>(aMessage, queryId));
-    VerifyOrExit(queryId == mExpectedQueryId);
-
     SuccessOrExit(Tlv::Find<AnswerTlv>(aMessage, answerTlvValue));
 
-    if (answerTlvValue.GetIndex() != mExpectedAnswerIndex)
+    slot = FindQuerySlot(aMessageInfo.GetPeerAddr().GetIid().GetLocator());
+    VerifyOrExit(slot != nullptr);
+    VerifyOrExit(slot->mQueryId == queryId, slot = nullptr);
+
+    if (answerTlvValue.GetIndex() != slot->mAnswerIndex)
     {
-        Finalize(kErrorResponseTimeout);
-        ExitNow();
+        FinalizeQuery(*slot, kErrorResponseTimeout);
+        ExitNow(slot = nullptr);
     }
 
-    mExpectedAnswerIndex++;
-    error = kErrorNone;
+    slot->mAnswerIndex++;
 
 exit:
-    return error;
+    return slot;
 }
 
-bool MeshDiag::ProcessChildTableAnswer(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+bool MeshDiag::ProcessChildTableAnswer(QuerySlot &aSlot, Coap::Message &aMessage)
 {
     bool          didProcess = false;
     Tlv::Info     tlvInfo;
     ChildTlvValue childTlvValue;
     ChildEntry    entry;
 
-    SuccessOrExit(ProcessMessage(aMessage, aMessageInfo, mQueryChildTable.mRouterRloc16));
-
     while (true)
     {
         SuccessOrExit(tlvInfo.FindIn(aMessage, ChildTlv::kType));
@@ -301,20 +355,18 @@ bool MeshDiag::ProcessChildTableAnswer(Coap::Message &aMessage, const Ip6::Messa
         if (tlvInfo.GetLength() == 0)
         {
             // We reached end of the list.
-            mState = kStateIdle;
-            mTimer.Stop();
-            mQueryChildTable.mCallback.InvokeIfSet(kErrorNone, nullptr);
+            FinalizeQuery(aSlot, kErrorNone);
             ExitNow();
         }
 
         SuccessOrExit(tlvInfo.Read<ChildTlv>(aMessage, childTlvValue));
 
         entry.SetFrom(childTlvValue);
-        mQueryChildTable.mCallback.InvokeIfSet(kErrorPending, &entry);
+        aSlot.mChildTableCallback.InvokeIfSet(kErrorPending, &entry);
 
         // Make sure query operation is not canceled from the
         // callback.
-        VerifyOrExit(mState == kStateQueryChildTable);
+        VerifyOrExit(aSlot.mType == QuerySlot::kTypeChildTable);
 
         aMessage.SetOffset(tlvInfo.GetTlvOffsetRange().GetEndOffset());
     }
@@ -323,15 +375,13 @@ exit:
     return didProcess;
 }
 
-bool MeshDiag::ProcessRouterNeighborTableAnswer(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+bool MeshDiag::ProcessRouterNeighborTableAnswer(QuerySlot &aSlot, Coap::Message &aMessage)
 {
     bool                   didProcess = false;
     Tlv::Info              tlvInfo;
     RouterNeighborTlvValue neighborTlvValue;
     RouterNeighborEntry    entry;
 
-    SuccessOrExit(ProcessMessage(aMessage, aMessageInfo, mQueryRouterNeighborTable.mRouterRloc16));
-
     while (true)
     {
         SuccessOrExit(tlvInfo.FindIn(aMessage, RouterNeighborTlv::kType));
@@ -341,20 +391,18 @@ bool MeshDiag::ProcessRouterNeighborTableAnswer(Coap::Message &aMessage, const I
         if (tlvInfo.GetLength() == 0)
         {
             // We reached end of the list.
-            mState = kStateIdle;
-            mTimer.Stop();
-            mQueryRouterNeighborTable.mCallback.InvokeIfSet(kErrorNone, nullptr);
+            FinalizeQuery(aSlot, kErrorNone);
             ExitNow();
         }
 
         SuccessOrExit(tlvInfo.Read<RouterNeighborTlv>(aMessage, neighborTlvValue));
 
         entry.SetFrom(neighborTlvValue);
-        mQueryRouterNeighborTable.mCallback.InvokeIfSet(kErrorPending, &entry);
+        aSlot.mNeighborTableCallback.InvokeIfSet(kErrorPending, &entry);
 
         // Make sure query operation is not canceled from the
         // callback.
-        VerifyOrExit(mState == kStateQueryRouterNeighborTable);
+        VerifyOrExit(aSlot.mType == QuerySlot::kTypeRouterNeighborTable);
 
         aMessage.SetOffset(tlvInfo.GetTlvOffsetRange().GetEndOffset());
     }
@@ -363,15 +411,13 @@ exit:
     return didProcess;
 }
 
-bool MeshDiag::ProcessChildrenIp6AddrsAnswer(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+bool MeshDiag::ProcessChildrenIp6AddrsAnswer(QuerySlot &aSlot, Coap::Message &aMessage)
 {
     bool                        didProcess = false;
     OffsetRange                 offsetRange;
     ChildIp6AddressListTlvValue tlvValue;
     Ip6AddrIterator             ip6AddrIterator;
 
-    SuccessOrExit(ProcessMessage(aMessage, aMessageInfo, mQueryChildrenIp6Addrs.mParentRloc16));
-
     while (true)
     {
         SuccessOrExit(Tlv::FindTlvValueOffsetRange(aMessage, ChildIp6AddressListTlv::kType, offsetRange));
@@ -381,9 +427,7 @@ bool MeshDiag::ProcessChildrenIp6AddrsAnswer(Coap::Message &aMessage, const Ip6:
         if (offsetRange.IsEmpty())
         {
             // We reached end of the list
-            mState = kStateIdle;
-            mTimer.Stop();
-            mQueryChildrenIp6Addrs.mCallback.InvokeIfSet(kErrorNone, Mle::kInvalidRloc16, nullptr);
+            FinalizeQuery(aSlot, kErrorNone);
             ExitNow();
         }
 
@@ -396,11 +440,11 @@ bool MeshDiag::ProcessChildrenIp6AddrsAnswer(Coap::Message &aMessage, const Ip6:
         ip6AddrIterator.mMessage     = &aMessage;
         ip6AddrIterator.mOffsetRange = offsetRange;
 
-        mQueryChildrenIp6Addrs.mCallback.InvokeIfSet(kErrorPending, tlvValue.GetRloc16(), &ip6AddrIterator);
+        aSlot.mChildIp6AddrsCallback.InvokeIfSet(kErrorPending, tlvValue.GetRloc16(), &ip6AddrIterator);
 
         // Make sure query operation is not canceled from the
         // callback.
-        VerifyOrExit(mState == kStateQueryChildrenIp6Addrs);
+        VerifyOrExit(aSlot.mType == QuerySlot::kTypeChildrenIp6Addrs);
 
         aMessage.SetOffset(offsetRange.GetEndOffset());
     }
@@ -414,9 +458,6 @@ void MeshDiag::Cancel(void)
     switch (mState)
     {
     case kStateIdle:
-    case kStateQueryChildTable:
-    case kStateQueryChildrenIp6Addrs:
-    case kStateQueryRouterNeighborTable:
         break;
 
     case kStateDiscoverTopology:
@@ -424,14 +465,53 @@ void MeshDiag::Cancel(void)
         break;
     }
 
+    for (QuerySlot &slot : mQuerySlots)
+    {
+        slot.mType = QuerySlot::kTypeNone;
+    }
+
     mState = kStateIdle;
     mTimer.Stop();
 }
 
+void MeshDiag::FinalizeQuery(QuerySlot &aSlot, Error aError)
+{
+    // Finalize the query in `aSlot` invoking its callback with
+    // `aError`. If this was the last outstanding query, signal the
+    // "queries done" callback (if set).
+
+    QuerySlot::Type type = aSlot.mType;
+
+    aSlot.mType = QuerySlot::kTypeNone;
+
+    switch (type)
+    {
+    case QuerySlot::kTypeNone:
+        break;
+
+    case QuerySlot::kTypeChildTable:
+        aSlot.mChildTableCallback.InvokeIfSet(aError, nullptr);
+        break;
+
+    case QuerySlot::kTypeChildrenIp6Addrs:
+        aSlot.mChildIp6AddrsCallback.InvokeIfSet(aError, Mle::kInvalidRloc16, nullptr);
+        break;
+
+    case QuerySlot::kTypeRouterNeighborTable:
+        aSlot.mNeighborTableCallback.InvokeIfSet(aError, nullptr);
+        break;
+    }
+
+    if (!HasActiveQuery())
+    {
+        mQueriesDoneCallback.InvokeIfSet();
+    }
+}
+
 void MeshDiag::Finalize(Error aError)
 {
-    // Finalize an ongoing query operation (if any) invoking
-    // the corresponding callback with `aError`.
+    // Finalize an ongoing discovery operation (if any) invoking
+    // its callback with `aError`.
 
     State oldState = mState;
 
@@ -445,22 +525,41 @@ void MeshDiag::Finalize(Error aError)
     case kStateDiscoverTopology:
         mDiscover.mCallback.InvokeIfSet(aError, nullptr);
         break;
+    }
+}
 
-    case kStateQueryChildTable:
-        mQueryChildTable.mCallback.InvokeIfSet(aError, nullptr);
-        break;
+void MeshDiag::HandleTimer(void)
+{
+    NextFireTime nextTime;
 
-    case kStateQueryChildrenIp6Addrs:
-        mQueryChildrenIp6Addrs.mCallback.InvokeIfSet(aError, Mle::kInvalidRloc16, nullptr);
-        break;
+    if (mState == kStateDiscoverTopology)
+    {
+        Finalize(kErrorResponseTimeout);
+        ExitNow();
+    }
 
-    case kStateQueryRouterNeighborTable:
-        mQueryRouterNeighborTable.mCallback.InvokeIfSet(aError, nullptr);
-        break;
+    for (QuerySlot &slot : mQuerySlots)
+    {
+        if (!slot.IsInUse())
+        {
+            continue;
+        }
+
+        if (slot.mExpireTime <= nextTime.GetNow())
+        {
+            FinalizeQuery(slot, kErrorResponseTimeout);
+        }
+        else
+        {
+            nextTime.UpdateIfEarlier(slot.mExpireTime);
+        }
     }
-}
 
-void MeshDiag::HandleTimer(void) { Finalize(kErrorResponseTimeout); }
+    mTimer.FireAt(nextTime);
+
+exit:
+    return;
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 // MeshDiag::RouterInfo
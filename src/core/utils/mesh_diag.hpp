@@ -79,6 +79,7 @@ public:
     typedef otMeshDiagQueryChildTableCallback          QueryChildTableCallback;     ///< Query Child Table callback.
     typedef otMeshDiagChildIp6AddrsCallback            ChildIp6AddrsCallback;       ///< Child IPv6 addresses callback.
     typedef otMeshDiagQueryRouterNeighborTableCallback RouterNeighborTableCallback; ///< Neighbor table callback.
+    typedef otMeshDiagQueriesDoneCallback              QueriesDoneCallback;         ///< Queries done callback.
 
     /**
      * Represents an iterator to go over list of IPv6 addresses of a router or an MTD child.
@@ -191,12 +192,16 @@ public:
     /**
      * Starts query for child table for a given router.
      *
+     * Up to `OPENTHREAD_CONFIG_MESH_DIAG_MAX_CONCURRENT_QUERIES` queries can be outstanding concurrently, with at
+     * most one outstanding query towards a given destination.
+     *
      * @param[in] aRloc16          The RLOC16 of router to query.
      * @param[in] aCallback        The callback to report the queried child table.
      * @param[in] aContext         A context to pass in @p aCallback.
      *
      * @retval kErrorNone          The query started successfully.
-     * @retval kErrorBusy          A previous discovery or query request is still ongoing.
+     * @retval kErrorBusy          A discovery is ongoing, a query towards @p aRloc16 is still outstanding, or no more
+     *                             concurrent queries can be accepted.
      * @retval kErrorInvalidArgs   The @p aRloc16 is not a valid router RLOC16.
      * @retval kErrorInvalidState  Device is not attached.
      * @retval kErrorNoBufs        Could not allocate buffer to send query messages.
@@ -206,12 +211,16 @@ public:
     /**
      * Sends a query to a parent to retrieve the IPv6 addresses of all its MTD children.
      *
+     * Up to `OPENTHREAD_CONFIG_MESH_DIAG_MAX_CONCURRENT_QUERIES` queries can be outstanding concurrently, with at
+     * most one outstanding query towards a given destination.
+     *
      * @param[in] aRloc16          The RLOC16 of parent to query.
      * @param[in] aCallback        The callback to report the queried child IPv6 address list.
      * @param[in] aContext         A context to pass in @p aCallback.
      *
      * @retval kErrorNone          The query started successfully.
-     * @retval kErrorBusy          A previous discovery or query request is still ongoing.
+     * @retval kErrorBusy          A discovery is ongoing, a query towards @p aRloc16 is still outstanding, or no more
+     *                             concurrent queries can be accepted.
      * @retval kErrorInvalidArgs   The @p aRloc16 is not a valid  RLOC16.
      * @retval kErrorInvalidState  Device is not attached.
      * @retval kErrorNoBufs        Could not allocate buffer to send query messages.
@@ -221,12 +230,16 @@ public:
     /**
      * Starts query for router neighbor table for a given router.
      *
+     * Up to `OPENTHREAD_CONFIG_MESH_DIAG_MAX_CONCURRENT_QUERIES` queries can be outstanding concurrently, with at
+     * most one outstanding query towards a given destination.
+     *
      * @param[in] aRloc16          The RLOC16 of router to query.
      * @param[in] aCallback        The callback to report the queried table.
      * @param[in] aContext         A context to pass in @p aCallback.
      *
      * @retval kErrorNone          The query started successfully.
-     * @retval kErrorBusy          A previous discovery or query request is still ongoing.
+     * @retval kErrorBusy          A discovery is ongoing, a query towards @p aRloc16 is still outstanding, or no more
+     *                             concurrent queries can be accepted.
      * @retval kErrorInvalidArgs   The @p aRloc16 is not a valid router RLOC16.
      * @retval kErrorInvalidState  Device is not attached.
      * @retval kErrorNoBufs        Could not allocate buffer to send query messages.
@@ -234,10 +247,24 @@ public:
     Error QueryRouterNeighborTable(uint16_t aRloc16, RouterNeighborTableCallback aCallback, void *aContext);
 
     /**
-     * Cancels an ongoing discovery or query operation if there one, otherwise no action.
+     * Sets the callback to notify when all outstanding queries have finished.
+     *
+     * The callback is invoked when the last outstanding query completes or times out (after the per-query callback
+     * is invoked). It is not invoked when queries are stopped by `Cancel()`.
+     *
+     * @param[in] aCallback        The callback to notify that no more queries are outstanding.
+     * @param[in] aContext         A context to pass in @p aCallback.
+     */
+    void SetQueriesDoneCallback(QueriesDoneCallback aCallback, void *aContext)
+    {
+        mQueriesDoneCallback.Set(aCallback, aContext);
+    }
+
+    /**
+     * Cancels any ongoing discovery or query operations, otherwise no action.
      *
-     * When ongoing discovery is cancelled, the callback from `DiscoverTopology()` or  `QueryChildTable()` will not be
-     * called anymore.
+     * When an ongoing operation is cancelled, the callback from `DiscoverTopology()` or  `QueryChildTable()` will not
+     * be called anymore.
      */
     void Cancel(void);
 
@@ -248,13 +275,14 @@ private:
     static constexpr uint32_t kMinResponseTimeout = 50;
     static constexpr uint32_t kMaxResponseTimeout = 10 * Time::kOneMinuteInMsec;
 
+    static constexpr uint16_t kMaxConcurrentQueries = OPENTHREAD_CONFIG_MESH_DIAG_MAX_CONCURRENT_QUERIES;
+
+    static_assert(kMaxConcurrentQueries >= 1, "OPENTHREAD_CONFIG_MESH_DIAG_MAX_CONCURRENT_QUERIES must be >= 1");
+
     enum State : uint8_t
     {
         kStateIdle,
         kStateDiscoverTopology,
-        kStateQueryChildTable,
-        kStateQueryChildrenIp6Addrs,
-        kStateQueryRouterNeighborTable,
     };
 
     struct DiscoverInfo
@@ -263,22 +291,35 @@ private:
         Mle::RouterIdMask          mExpectedRouterIds;
     };
 
-    struct QueryChildTableInfo
-    {
-        Callback<QueryChildTableCallback> mCallback;
-        uint16_t                          mRouterRloc16;
-    };
-
-    struct QueryChildrenIp6AddrsInfo
+    struct QuerySlot
     {
-        Callback<ChildIp6AddrsCallback> mCallback;
-        uint16_t                        mParentRloc16;
-    };
-
-    struct QueryRouterNeighborTableInfo
-    {
-        Callback<RouterNeighborTableCallback> mCallback;
-        uint16_t                              mRouterRloc16;
+        enum Type : uint8_t
+        {
+            kTypeNone,                // Slot is unused.
+            kTypeChildTable,          // Query from `QueryChildTable()`.
+            kTypeChildrenIp6Addrs,    // Query from `QueryChildrenIp6Addrs()`.
+            kTypeRouterNeighborTable, // Query from `QueryRouterNeighborTable()`.
+        };
+
+        QuerySlot(void)
+            : mType(kTypeNone)
+        {
+        }
+
+        bool IsInUse(void) const { return mType != kTypeNone; }
+
+        Type      mType;
+        uint16_t  mRloc16;
+        uint16_t  mQueryId;
+        uint16_t  mAnswerIndex;
+        TimeMilli mExpireTime;
+
+        union
+        {
+            Callback<QueryChildTableCallback>     mChildTableCallback;
+            Callback<ChildIp6AddrsCallback>       mChildIp6AddrsCallback;
+            Callback<RouterNeighborTableCallback> mNeighborTableCallback;
+        };
     };
 
     class ChildEntry : public otMeshDiagChildEntry
@@ -297,32 +338,28 @@ private:
         void SetFrom(const NetworkDiagnostic::RouterNeighborTlvValue &aTlvValue);
     };
 
-    Error SendQuery(uint16_t aRloc16, const uint8_t *aTlvs, uint8_t aTlvsLength);
-    void  Finalize(Error aError);
-    void  HandleTimer(void);
-    bool  HandleDiagnosticGetAnswer(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
-    Error ProcessMessage(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo, uint16_t aSenderRloc16);
-    bool  ProcessChildTableAnswer(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
-    bool  ProcessChildrenIp6AddrsAnswer(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
-    bool  ProcessRouterNeighborTableAnswer(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    Error      SendQuery(uint16_t aRloc16, const uint8_t *aTlvs, uint8_t aTlvsLength, QuerySlot *&aSlot);
+    QuerySlot *FindQuerySlot(uint16_t aRloc16);
+    QuerySlot *MatchQuerySlot(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    bool       HasActiveQuery(void) const;
+    void       FinalizeQuery(QuerySlot &aSlot, Error aError);
+    void       Finalize(Error aError);
+    void       HandleTimer(void);
+    bool       HandleDiagnosticGetAnswer(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    bool       ProcessChildTableAnswer(QuerySlot &aSlot, Coap::Message &aMessage);
+    bool       ProcessChildrenIp6AddrsAnswer(QuerySlot &aSlot, Coap::Message &aMessage);
+    bool       ProcessRouterNeighborTableAnswer(QuerySlot &aSlot, Coap::Message &aMessage);
 
     DeclareTmfResponseHandlerIn(MeshDiag, HandleDiagGetResponse);
 
     using TimeoutTimer = TimerMilliIn<MeshDiag, &MeshDiag::HandleTimer>;
 
-    State        mState;
-    uint16_t     mExpectedQueryId;
-    uint16_t     mExpectedAnswerIndex;
-    uint32_t     mResponseTimeout;
-    TimeoutTimer mTimer;
-
-    union
-    {
-        DiscoverInfo                 mDiscover;
-        QueryChildTableInfo          mQueryChildTable;
-        QueryChildrenIp6AddrsInfo    mQueryChildrenIp6Addrs;
-        QueryRouterNeighborTableInfo mQueryRouterNeighborTable;
-    };
+    State                         mState;
+    uint32_t                      mResponseTimeout;
+    TimeoutTimer                  mTimer;
+    DiscoverInfo                  mDiscover;
+    Callback<QueriesDoneCallback> mQueriesDoneCallback;
+    QuerySlot                     mQuerySlots[kMaxConcurrentQueries];
 };
 
 } // namespace Utils
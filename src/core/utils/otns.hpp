@@ -180,6 +180,8 @@ private:
                         const Coap::Message    &aMessage,
                         const Ip6::MessageInfo &aMessageInfo,
                         Error                  *aError = nullptr) const;
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadPartitionIdChanged | kEventJoinerStateChanged;
+
     void HandleNotifierEvents(Events aEvents) const;
 #endif
 };
@@ -81,10 +81,37 @@ exit:
     return;
 }
 
+void PingSender::Statistics::UpdateOnReply(uint16_t aRoundTripTime)
+{
+    uint8_t bin = 0;
+
+    mReceivedCount++;
+    mTotalRoundTripTime += aRoundTripTime;
+    mMaxRoundTripTime = Max(mMaxRoundTripTime, aRoundTripTime);
+    mMinRoundTripTime = Min(mMinRoundTripTime, aRoundTripTime);
+
+    // Bin `i` counts round trip times in `[2^i, 2^(i+1))` msec, with
+    // the last bin counting all larger values. Bin counters saturate
+    // at their max so long-running probes cannot overflow them.
+
+    while (((aRoundTripTime >> bin) > 1) && (bin < OT_PING_SENDER_RTT_HISTOGRAM_NUM_BINS - 1))
+    {
+        bin++;
+    }
+
+    if (mRttHistogram[bin] < NumericLimits<uint16_t>::kMax)
+    {
+        mRttHistogram[bin]++;
+    }
+}
+
 PingSender::PingSender(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mProbePeriod(0)
     , mIdentifier(0)
     , mTargetEchoSequence(0)
+    , mIsProbing(false)
+    , mWaitingNextTrain(false)
     , mTimer(aInstance)
     , mIcmpHandler(PingSender::HandleIcmpReceive, this)
 {
@@ -112,10 +139,57 @@ exit:
     return error;
 }
 
+Error PingSender::StartProbing(const Config &aConfig, uint32_t aProbePeriod)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(!mTimer.IsRunning(), error = kErrorBusy);
+
+    VerifyOrExit((aProbePeriod > 0) && (aProbePeriod <= Timer::kMaxDelay), error = kErrorInvalidArgs);
+
+    mProbeConfig = aConfig;
+    mProbeConfig.SetUnspecifiedToDefault();
+
+    VerifyOrExit(mProbeConfig.mInterval <= Timer::kMaxDelay, error = kErrorInvalidArgs);
+
+    mIsProbing   = true;
+    mProbePeriod = aProbePeriod;
+
+    mStatistics.Clear();
+    mStatistics.mIsMulticast = mProbeConfig.GetDestination().IsMulticast();
+
+    StartNextTrain();
+
+exit:
+    return error;
+}
+
+void PingSender::StartNextTrain(void)
+{
+    mWaitingNextTrain = false;
+    mConfig           = mProbeConfig;
+    mIdentifier++;
+    SendPing();
+}
+
+void PingSender::FinishTrain(void)
+{
+    mTimer.Stop();
+    mConfig.InvokeStatisticsCallback(mStatistics);
+
+    if (mIsProbing)
+    {
+        mWaitingNextTrain = true;
+        mTimer.Start(mProbePeriod);
+    }
+}
+
 void PingSender::Stop(void)
 {
     mTimer.Stop();
     mIdentifier++;
+    mIsProbing        = false;
+    mWaitingNextTrain = false;
 }
 
 void PingSender::SendPing(void)
@@ -166,13 +240,17 @@ exit:
 
 void PingSender::HandleTimer(void)
 {
-    if (mConfig.mCount > 0)
+    if (mWaitingNextTrain)
+    {
+        StartNextTrain();
+    }
+    else if (mConfig.mCount > 0)
     {
         SendPing();
     }
-    else // The last reply times out, triggering the callback to print statistics in CLI.
+    else // The last reply times out, triggering the callback to report statistics.
     {
-        mConfig.InvokeStatisticsCallback(mStatistics);
+        FinishTrain();
     }
 }
 
@@ -192,7 +270,7 @@ void PingSender::HandleIcmpReceive(const Message           &aMessage,
     Reply    reply;
     uint32_t timestamp;
 
-    VerifyOrExit(mTimer.IsRunning());
+    VerifyOrExit(mTimer.IsRunning() && !mWaitingNextTrain);
     VerifyOrExit(aIcmpHeader.GetType() == Ip6::Icmp::Header::kTypeEchoReply);
     VerifyOrExit(aIcmpHeader.GetId() == mIdentifier);
 
@@ -205,10 +283,23 @@ void PingSender::HandleIcmpReceive(const Message           &aMessage,
     reply.mSequenceNumber = aIcmpHeader.GetSequence();
     reply.mHopLimit       = aMessageInfo.GetHopLimit();
 
-    mStatistics.mReceivedCount++;
-    mStatistics.mTotalRoundTripTime += reply.mRoundTripTime;
-    mStatistics.mMaxRoundTripTime = Max(mStatistics.mMaxRoundTripTime, reply.mRoundTripTime);
-    mStatistics.mMinRoundTripTime = Min(mStatistics.mMinRoundTripTime, reply.mRoundTripTime);
+#if OPENTHREAD_CONFIG_RADIO_RX_TIMESTAMP_ENABLE
+    if (aMessage.IsOriginThreadNetif())
+    {
+        // Exclude the host-side delay between the radio reception of
+        // the reply and its processing here, so that the measured
+        // round trip time tracks the on-air latency more closely.
+
+        uint64_t delayMsec = (Get<Radio>().GetNow() - aMessage.GetRadioRxTimestamp()) / Time::kOneMsecInUsec;
+
+        if (delayMsec < reply.mRoundTripTime)
+        {
+            reply.mRoundTripTime -= static_cast<uint16_t>(delayMsec);
+        }
+    }
+#endif
+
+    mStatistics.UpdateOnReply(reply.mRoundTripTime);
 
 #if OPENTHREAD_CONFIG_OTNS_ENABLE
     Get<Utils::Otns>().EmitPingReply(aMessageInfo.GetPeerAddr(), reply.mSize, timestamp, reply.mHopLimit);
@@ -222,7 +313,7 @@ void PingSender::HandleIcmpReceive(const Message           &aMessage,
     // Received all ping replies, no need to wait longer.
     if (!mStatistics.mIsMulticast && mConfig.mCount == 0 && aIcmpHeader.GetSequence() == mTargetEchoSequence)
     {
-        mConfig.InvokeStatisticsCallback(mStatistics);
+        FinishTrain();
     }
 
 exit:
@@ -80,7 +80,10 @@ public:
             mMaxRoundTripTime   = 0;
             mIsMulticast        = false;
             SetToUintMax(mMinRoundTripTime);
+            ClearAllBytes(mRttHistogram);
         }
+
+        void UpdateOnReply(uint16_t aRoundTripTime);
     };
 
     /**
@@ -149,12 +152,30 @@ public:
     Error Ping(const Config &aConfig);
 
     /**
-     * Stops an ongoing ping.
+     * Starts background probing, sending probe trains of pings periodically.
+     *
+     * Each probe train sends pings as configured in @p aConfig. After a train finishes, the next train starts
+     * @p aProbePeriod milliseconds later, until `Stop()` is called. Statistics accumulate across trains and the
+     * statistics callback in @p aConfig is invoked at the end of every train.
+     *
+     * @param[in] aConfig          The ping config to use for every probe train.
+     * @param[in] aProbePeriod     Time in msec between the end of a probe train and the start of the next.
+     *
+     * @retval kErrorNone          The probing started successfully.
+     * @retval kErrorBusy          Could not start since busy with a previous ongoing ping request.
+     * @retval kErrorInvalidArgs   @p aConfig or @p aProbePeriod contains invalid parameters.
+     */
+    Error StartProbing(const Config &aConfig, uint32_t aProbePeriod);
+
+    /**
+     * Stops an ongoing ping or background probing.
      */
     void Stop(void);
 
 private:
     void        SendPing(void);
+    void        StartNextTrain(void);
+    void        FinishTrain(void);
     void        HandleTimer(void);
     static void HandleIcmpReceive(void                *aContext,
                                   otMessage           *aMessage,
@@ -167,9 +188,13 @@ private:
     using PingTimer = TimerMilliIn<PingSender, &PingSender::HandleTimer>;
 
     Config             mConfig;
+    Config             mProbeConfig;
     Statistics         mStatistics;
+    uint32_t           mProbePeriod;
     uint16_t           mIdentifier;
     uint16_t           mTargetEchoSequence;
+    bool               mIsProbing : 1;
+    bool               mWaitingNextTrain : 1;
     PingTimer          mTimer;
     Ip6::Icmp::Handler mIcmpHandler;
 };
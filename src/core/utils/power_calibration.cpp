@@ -38,13 +38,16 @@ namespace Utils {
 
 PowerCalibration::PowerCalibration(Instance &aInstance)
     : InstanceLocator(aInstance)
-    , mLastChannel(0)
-    , mCalibratedPowerIndex(kInvalidIndex)
 {
     for (int16_t &targetPower : mTargetPowerTable)
     {
         targetPower = kInvalidPower;
     }
+
+    for (uint8_t &powerIndex : mCalibratedPowerIndexes)
+    {
+        powerIndex = kInvalidIndex;
+    }
 }
 
 void PowerCalibration::CalibratedPowerEntry::Init(int16_t        aActualPower,
@@ -75,29 +78,71 @@ exit:
     return error;
 }
 
+Error PowerCalibration::InsertCalibratedPower(uint8_t        aChIndex,
+                                              int16_t        aActualPower,
+                                              const uint8_t *aRawPowerSetting,
+                                              uint16_t       aRawPowerSettingLength)
+{
+    Error                 error = kErrorNone;
+    CalibratedPowerTable &table = mCalibratedPowerTables[aChIndex];
+    CalibratedPowerEntry  entry;
+
+    AssertPointerIsNotNull(aRawPowerSetting);
+    VerifyOrExit(aRawPowerSettingLength <= CalibratedPowerEntry::kMaxRawPowerSettingSize, error = kErrorInvalidArgs);
+    VerifyOrExit(!table.ContainsMatching(aActualPower), error = kErrorInvalidArgs);
+    VerifyOrExit(!table.IsFull(), error = kErrorNoBufs);
+
+    entry.Init(aActualPower, aRawPowerSetting, aRawPowerSettingLength);
+    SuccessOrExit(error = table.PushBack(entry));
+
+    // Keep the table sorted in ascending order of actual power, so that
+    // `FindPowerIndex()` can binary search it.
+    for (uint8_t i = table.GetLength() - 1; i > 0 && table[i - 1].GetActualPower() > table[i].GetActualPower(); i--)
+    {
+        CalibratedPowerEntry temp = table[i - 1];
+
+        table[i - 1] = table[i];
+        table[i]     = temp;
+    }
+
+    mCalibratedPowerIndexes[aChIndex] = kInvalidIndex;
+
+exit:
+    return error;
+}
+
 Error PowerCalibration::AddCalibratedPower(uint8_t        aChannel,
                                            int16_t        aActualPower,
                                            const uint8_t *aRawPowerSetting,
                                            uint16_t       aRawPowerSettingLength)
 {
-    Error                error = kErrorNone;
-    CalibratedPowerEntry entry;
-    uint8_t              chIndex;
+    Error error = kErrorNone;
 
-    AssertPointerIsNotNull(aRawPowerSetting);
-    VerifyOrExit(IsChannelValid(aChannel) && aRawPowerSettingLength <= CalibratedPowerEntry::kMaxRawPowerSettingSize,
-                 error = kErrorInvalidArgs);
+    VerifyOrExit(IsChannelValid(aChannel), error = kErrorInvalidArgs);
+    error = InsertCalibratedPower(aChannel - Radio::kChannelMin, aActualPower, aRawPowerSetting,
+                                  aRawPowerSettingLength);
 
-    chIndex = aChannel - Radio::kChannelMin;
-    VerifyOrExit(!mCalibratedPowerTables[chIndex].ContainsMatching(aActualPower), error = kErrorInvalidArgs);
-    VerifyOrExit(!mCalibratedPowerTables[chIndex].IsFull(), error = kErrorNoBufs);
+exit:
+    return error;
+}
 
-    entry.Init(aActualPower, aRawPowerSetting, aRawPowerSettingLength);
-    SuccessOrExit(error = mCalibratedPowerTables[chIndex].PushBack(entry));
+Error PowerCalibration::SetCalibratedPowers(uint8_t aChannel, const otCalibratedPowerEntry *aEntries, uint16_t aNumEntries)
+{
+    Error   error = kErrorNone;
+    uint8_t chIndex;
 
-    if (aChannel == mLastChannel)
+    AssertPointerIsNotNull(aEntries);
+    VerifyOrExit(IsChannelValid(aChannel), error = kErrorInvalidArgs);
+    VerifyOrExit(aNumEntries <= kMaxNumCalibratedPowers, error = kErrorNoBufs);
+
+    chIndex = aChannel - Radio::kChannelMin;
+    mCalibratedPowerTables[chIndex].Clear();
+    mCalibratedPowerIndexes[chIndex] = kInvalidIndex;
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
     {
-        mCalibratedPowerIndex = kInvalidIndex;
+        SuccessOrExit(error = InsertCalibratedPower(chIndex, aEntries[i].mActualPower, aEntries[i].mRawPowerSetting,
+                                                    aEntries[i].mRawPowerSettingLength));
     }
 
 exit:
@@ -111,7 +156,10 @@ void PowerCalibration::ClearCalibratedPowers(void)
         table.Clear();
     }
 
-    mCalibratedPowerIndex = kInvalidIndex;
+    for (uint8_t &powerIndex : mCalibratedPowerIndexes)
+    {
+        powerIndex = kInvalidIndex;
+    }
 }
 
 Error PowerCalibration::SetChannelTargetPower(uint8_t aChannel, int16_t aTargetPower)
@@ -119,15 +167,37 @@ Error PowerCalibration::SetChannelTargetPower(uint8_t aChannel, int16_t aTargetP
     Error error = kErrorNone;
 
     VerifyOrExit(IsChannelValid(aChannel), error = kErrorInvalidArgs);
-    mTargetPowerTable[aChannel - Radio::kChannelMin] = aTargetPower;
+    mTargetPowerTable[aChannel - Radio::kChannelMin]       = aTargetPower;
+    mCalibratedPowerIndexes[aChannel - Radio::kChannelMin] = kInvalidIndex;
+
+exit:
+    return error;
+}
 
-    if (aChannel == mLastChannel)
+uint8_t PowerCalibration::FindPowerIndex(const CalibratedPowerTable &aTable, int16_t aTargetPower)
+{
+    uint8_t low  = 0;
+    uint8_t high = static_cast<uint8_t>(aTable.GetLength());
+
+    // Binary search (the table is sorted in ascending order of actual
+    // power) for the first entry with actual power above the target.
+    while (low < high)
     {
-        mCalibratedPowerIndex = kInvalidIndex;
+        uint8_t mid = (low + high) / 2;
+
+        if (aTable[mid].GetActualPower() <= aTargetPower)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
     }
 
-exit:
-    return error;
+    // Select the highest actual power not exceeding the target, or the
+    // lowest calibrated power when all entries exceed the target.
+    return (low > 0) ? static_cast<uint8_t>(low - 1) : 0;
 }
 
 Error PowerCalibration::GetPowerSettings(uint8_t   aChannel,
@@ -138,44 +208,27 @@ Error PowerCalibration::GetPowerSettings(uint8_t   aChannel,
 {
     Error   error = kErrorNone;
     uint8_t chIndex;
-    uint8_t powerIndex = kInvalidIndex;
-    int16_t foundPower = kInvalidPower;
     int16_t targetPower;
-    int16_t actualPower;
-    int16_t minPower      = NumericLimits<int16_t>::kMax;
-    uint8_t minPowerIndex = kInvalidIndex;
 
     VerifyOrExit(IsChannelValid(aChannel), error = kErrorInvalidArgs);
-    VerifyOrExit((mLastChannel != aChannel) || IsPowerUpdated());
 
     chIndex     = aChannel - Radio::kChannelMin;
     targetPower = mTargetPowerTable[chIndex];
     VerifyOrExit(targetPower != kInvalidPower, error = kErrorNotFound);
     VerifyOrExit(mCalibratedPowerTables[chIndex].GetLength() > 0, error = kErrorNotFound);
 
-    for (uint8_t i = 0; i < mCalibratedPowerTables[chIndex].GetLength(); i++)
+    // The resolved power index is cached per channel and invalidated when
+    // the channel's calibrated powers or target power change, so repeated
+    // lookups on channel hops avoid rescanning the table.
+    if (mCalibratedPowerIndexes[chIndex] == kInvalidIndex)
     {
-        actualPower = mCalibratedPowerTables[chIndex][i].GetActualPower();
-
-        if ((actualPower <= targetPower) && ((foundPower == kInvalidPower) || (foundPower <= actualPower)))
-        {
-            foundPower = actualPower;
-            powerIndex = i;
-        }
-        else if (actualPower < minPower)
-        {
-            minPower      = actualPower;
-            minPowerIndex = i;
-        }
+        mCalibratedPowerIndexes[chIndex] = FindPowerIndex(mCalibratedPowerTables[chIndex], targetPower);
     }
 
-    mCalibratedPowerIndex = (powerIndex != kInvalidIndex) ? powerIndex : minPowerIndex;
-    mLastChannel          = aChannel;
-
 exit:
     if (error == kErrorNone)
     {
-        chIndex = mLastChannel - Radio::kChannelMin;
+        uint8_t powerIndex = mCalibratedPowerIndexes[chIndex];
 
         if (aTargetPower != nullptr)
         {
@@ -184,11 +237,11 @@ exit:
 
         if (aActualPower != nullptr)
         {
-            *aActualPower = mCalibratedPowerTables[chIndex][mCalibratedPowerIndex].GetActualPower();
+            *aActualPower = mCalibratedPowerTables[chIndex][powerIndex].GetActualPower();
         }
 
-        error = mCalibratedPowerTables[chIndex][mCalibratedPowerIndex].GetRawPowerSetting(aRawPowerSetting,
-                                                                                          aRawPowerSettingLength);
+        error = mCalibratedPowerTables[chIndex][powerIndex].GetRawPowerSetting(aRawPowerSetting,
+                                                                               aRawPowerSettingLength);
     }
 
     return error;
@@ -208,6 +261,14 @@ otError otPlatRadioAddCalibratedPower(otInstance    *aInstance,
         aChannel, aActualPower, aRawPowerSetting, aRawPowerSettingLength);
 }
 
+otError otPlatRadioSetCalibratedPowers(otInstance                   *aInstance,
+                                       uint8_t                       aChannel,
+                                       const otCalibratedPowerEntry *aEntries,
+                                       uint16_t                      aNumEntries)
+{
+    return AsCoreType(aInstance).Get<Utils::PowerCalibration>().SetCalibratedPowers(aChannel, aEntries, aNumEntries);
+}
+
 otError otPlatRadioClearCalibratedPowers(otInstance *aInstance)
 {
     AsCoreType(aInstance).Get<Utils::PowerCalibration>().ClearCalibratedPowers();
@@ -77,6 +77,22 @@ public:
                              const uint8_t *aRawPowerSetting,
                              uint16_t       aRawPowerSettingLength);
 
+    /**
+     * Set all calibrated powers of the specified channel in the power calibration table.
+     *
+     * Any calibrated powers previously added for @p aChannel are replaced.
+     *
+     * @param[in] aChannel     The radio channel.
+     * @param[in] aEntries     A pointer to an array of calibrated power entries.
+     * @param[in] aNumEntries  The number of entries in @p aEntries.
+     *
+     * @retval kErrorNone         Successfully set the calibrated powers of the channel.
+     * @retval kErrorNoBufs       @p aNumEntries exceeds the size of the power calibration table.
+     * @retval kErrorInvalidArgs  The @p aChannel or an entry in @p aEntries is invalid, or two entries share the
+     *                            same actual power.
+     */
+    Error SetCalibratedPowers(uint8_t aChannel, const otCalibratedPowerEntry *aEntries, uint16_t aNumEntries);
+
     /**
      * Clear all calibrated powers from the power calibration table.
      */
@@ -142,7 +158,6 @@ private:
         uint16_t mLength;
     };
 
-    bool IsPowerUpdated(void) const { return mCalibratedPowerIndex == kInvalidIndex; }
     bool IsChannelValid(uint8_t aChannel) const
     {
         return ((aChannel >= Radio::kChannelMin) && (aChannel <= Radio::kChannelMax));
@@ -159,9 +174,14 @@ private:
 
     typedef Array<CalibratedPowerEntry, kMaxNumCalibratedPowers> CalibratedPowerTable;
 
-    uint8_t              mLastChannel;
+    Error          InsertCalibratedPower(uint8_t        aChIndex,
+                                         int16_t        aActualPower,
+                                         const uint8_t *aRawPowerSetting,
+                                         uint16_t       aRawPowerSettingLength);
+    static uint8_t FindPowerIndex(const CalibratedPowerTable &aTable, int16_t aTargetPower);
+
     int16_t              mTargetPowerTable[kNumChannels];
-    uint8_t              mCalibratedPowerIndex;
+    uint8_t              mCalibratedPowerIndexes[kNumChannels];
     CalibratedPowerTable mCalibratedPowerTables[kNumChannels];
 };
 } // namespace Utils
@@ -0,0 +1,118 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the telemetry emitter.
+ */
+
+#include "telemetry_emitter.hpp"
+
+#if OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE
+
+#include <openthread/platform/telemetry.h>
+
+#include "common/frame_builder.hpp"
+#include "instance/instance.hpp"
+
+namespace ot {
+namespace Utils {
+
+TelemetryEmitter::TelemetryEmitter(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mNumDecisions(0)
+    , mLastParentRloc16(Mle::kInvalidRloc16)
+{
+}
+
+void TelemetryEmitter::EmitForwardingDecision(uint16_t aDestRloc16, Error aError)
+{
+    uint8_t             buffer[kMaxEventSize];
+    FrameBuilder        frameBuilder;
+    PriorityQueue::Info sendQueueInfo;
+    MessageQueue::Info  reassemblyQueueInfo;
+
+    mNumDecisions++;
+    VerifyOrExit((mNumDecisions % kSampleInterval) == 0);
+
+    ClearAllBytes(sendQueueInfo);
+    ClearAllBytes(reassemblyQueueInfo);
+    Get<MeshForwarder>().GetQueueInfo(sendQueueInfo, reassemblyQueueInfo);
+
+    frameBuilder.Init(buffer, sizeof(buffer));
+    IgnoreError(frameBuilder.AppendUint8(kEventForwardingDecision));
+    IgnoreError(frameBuilder.AppendLittleEndianUint32(TimerMilli::GetNow().GetValue()));
+    IgnoreError(frameBuilder.AppendLittleEndianUint32(mNumDecisions));
+    IgnoreError(frameBuilder.AppendLittleEndianUint16(aDestRloc16));
+    IgnoreError(frameBuilder.AppendUint8(static_cast<uint8_t>(aError)));
+    IgnoreError(frameBuilder.AppendLittleEndianUint16(sendQueueInfo.mNumMessages));
+    IgnoreError(frameBuilder.AppendLittleEndianUint16(reassemblyQueueInfo.mNumMessages));
+
+    otPlatTelemetryEmit(frameBuilder.GetBytes(), frameBuilder.GetLength());
+
+exit:
+    return;
+}
+
+void TelemetryEmitter::HandleNotifierEvents(Events aEvents)
+{
+    // A parent switch while remaining a child changes the device
+    // RLOC16 (the child is re-addressed by its new parent), so
+    // together with role changes the events below cover all parent
+    // changes.
+
+    if (aEvents.ContainsAny(kEventThreadRoleChanged | kEventThreadRlocAdded | kEventThreadRlocRemoved))
+    {
+        uint16_t parentRloc16 = Get<Mle::Mle>().GetParentRloc16();
+
+        if ((parentRloc16 != mLastParentRloc16) || aEvents.Contains(kEventThreadRoleChanged))
+        {
+            mLastParentRloc16 = parentRloc16;
+            EmitParentChange();
+        }
+    }
+}
+
+void TelemetryEmitter::EmitParentChange(void)
+{
+    uint8_t      buffer[kMaxEventSize];
+    FrameBuilder frameBuilder;
+
+    frameBuilder.Init(buffer, sizeof(buffer));
+    IgnoreError(frameBuilder.AppendUint8(kEventParentChange));
+    IgnoreError(frameBuilder.AppendLittleEndianUint32(TimerMilli::GetNow().GetValue()));
+    IgnoreError(frameBuilder.AppendUint8(static_cast<uint8_t>(Get<Mle::Mle>().GetRole())));
+    IgnoreError(frameBuilder.AppendLittleEndianUint16(mLastParentRloc16));
+
+    otPlatTelemetryEmit(frameBuilder.GetBytes(), frameBuilder.GetLength());
+}
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE
@@ -0,0 +1,110 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the telemetry emitter.
+ */
+
+#ifndef OT_CORE_UTILS_TELEMETRY_EMITTER_HPP_
+#define OT_CORE_UTILS_TELEMETRY_EMITTER_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE
+
+#if !(OPENTHREAD_MTD || OPENTHREAD_FTD)
+#error "OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE requires OPENTHREAD_MTD or OPENTHREAD_FTD"
+#endif
+
+#include "common/error.hpp"
+#include "common/locator.hpp"
+#include "common/non_copyable.hpp"
+#include "common/notifier.hpp"
+
+namespace ot {
+namespace Utils {
+
+/**
+ * Implements the telemetry emitter.
+ *
+ * The emitter reports sampled forwarding decisions (with queue depths) and parent changes as compact binary
+ * events through the `otPlatTelemetryEmit()` platform stream, providing simulator-grade visibility on real
+ * deployments without the full logging cost.
+ */
+class TelemetryEmitter : public InstanceLocator, private NonCopyable
+{
+    friend class ot::Notifier;
+
+public:
+    /**
+     * Initializes the `TelemetryEmitter` object.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     */
+    explicit TelemetryEmitter(Instance &aInstance);
+
+    /**
+     * Reports a forwarding decision (a finished frame transmission).
+     *
+     * Only every `OPENTHREAD_CONFIG_TELEMETRY_EMITTER_SAMPLE_INTERVAL`-th call emits an event; the event carries
+     * the total decision count along with the current send and reassembly queue depths, so the receiver can scale
+     * the sampled data.
+     *
+     * @param[in] aDestRloc16  The RLOC16 of the frame destination (`Mle::kInvalidRloc16` if not a short address).
+     * @param[in] aError       The frame transmission error.
+     */
+    void EmitForwardingDecision(uint16_t aDestRloc16, Error aError);
+
+private:
+    static constexpr uint32_t kSampleInterval = OPENTHREAD_CONFIG_TELEMETRY_EMITTER_SAMPLE_INTERVAL;
+    static constexpr uint16_t kMaxEventSize   = 16;
+
+    static_assert(kSampleInterval > 0, "OPENTHREAD_CONFIG_TELEMETRY_EMITTER_SAMPLE_INTERVAL must be larger than 0");
+
+    enum EventType : uint8_t
+    {
+        kEventForwardingDecision = 1, // Sampled decision with queue depths.
+        kEventParentChange       = 2, // Role or parent change (always emitted).
+    };
+
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadRlocAdded | kEventThreadRlocRemoved;
+
+    void HandleNotifierEvents(Events aEvents);
+    void EmitParentChange(void);
+
+    uint32_t mNumDecisions;
+    uint16_t mLastParentRloc16;
+};
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_TELEMETRY_EMITTER_ENABLE
+
+#endif // OT_CORE_UTILS_TELEMETRY_EMITTER_HPP_
@@ -34,6 +34,8 @@
 
 #include <stdlib.h>
 
+#include <openthread/platform/toolchain.h>
+
 #include "common/code_utils.hpp"
 
 namespace ot {
@@ -93,6 +95,16 @@ uint16_t UpdateFcs(uint16_t aFcs, uint8_t aByte)
     return (aFcs >> 8) ^ sFcsTable[(aFcs ^ aByte) & 0xff];
 }
 
+OT_TOOL_WEAK uint16_t UpdateFcs(uint16_t aFcs, const uint8_t *aData, uint16_t aLength)
+{
+    while (aLength--)
+    {
+        aFcs = UpdateFcs(aFcs, *aData++);
+    }
+
+    return aFcs;
+}
+
 static bool HdlcByteNeedsEscape(uint8_t aByte)
 {
     bool rval;
@@ -156,9 +168,31 @@ otError Encoder::Encode(const uint8_t *aData, uint16_t aLength)
     uint16_t                  oldFcs     = mFcs;
     Spinel::FrameWritePointer oldPointer = mWritePointer;
 
-    while (aLength--)
+    while (aLength > 0)
     {
-        SuccessOrExit(error = Encode(*aData++));
+        uint16_t runLength = 0;
+
+        // Scan ahead for a run of bytes that need no escaping, so that the
+        // run can be copied in bulk with the FCS updated over it in one pass.
+
+        while ((runLength < aLength) && !HdlcByteNeedsEscape(aData[runLength]))
+        {
+            runLength++;
+        }
+
+        if (runLength > 0)
+        {
+            SuccessOrExit(error = mWritePointer.WriteBytes(aData, runLength));
+            mFcs = UpdateFcs(mFcs, aData, runLength);
+            aData += runLength;
+            aLength -= runLength;
+        }
+
+        if (aLength > 0)
+        {
+            SuccessOrExit(error = Encode(*aData++));
+            aLength--;
+        }
     }
 
 exit:
@@ -51,6 +51,20 @@ namespace ot {
  */
 namespace Hdlc {
 
+/**
+ * Updates an FCS over a buffer of bytes.
+ *
+ * Is defined as a weak symbol with a table-driven implementation, allowing platforms with hardware CRC16-CCITT
+ * support to override it.
+ *
+ * @param[in] aFcs     The FCS to update.
+ * @param[in] aData    A pointer to the input data buffer.
+ * @param[in] aLength  Number of bytes in @p aData.
+ *
+ * @returns The updated FCS.
+ */
+uint16_t UpdateFcs(uint16_t aFcs, const uint8_t *aData, uint16_t aLength);
+
 /**
  * Implements the HDLC-lite encoder.
  */
@@ -37,6 +37,7 @@
 #include <openthread/error.h>
 #include <openthread/logging.h>
 #include <openthread/platform/radio.h>
+#include <openthread/platform/time.h>
 
 #include "common/code_utils.hpp"
 #include "lib/spinel/spinel.h"
@@ -134,6 +135,10 @@ void Logger::LogSpinelFrame(const uint8_t *aFrame, uint16_t aLength, bool aTx)
     char             *start  = buf;
     char             *end    = buf + sizeof(buf);
 
+#if OPENTHREAD_SPINEL_CONFIG_TRACE_ENABLE
+    TraceSpinelFrame(aFrame, aLength, aTx);
+#endif
+
     VerifyOrExit(otLoggingGetLevel() >= OT_LOG_LEVEL_DEBG);
 
     prefix   = aTx ? "Sent spinel frame" : "Received spinel frame";
@@ -765,5 +770,63 @@ exit:
     }
 }
 
+#if OPENTHREAD_SPINEL_CONFIG_TRACE_ENABLE
+
+otSpinelFrameTraceEntry Logger::sTraceBuffer[Logger::kTraceBufferSize];
+uint16_t                Logger::sTraceHead  = 0;
+uint16_t                Logger::sTraceCount = 0;
+
+void Logger::TraceSpinelFrame(const uint8_t *aFrame, uint16_t aLength, bool aTx)
+{
+    uint8_t                  header;
+    unsigned int             cmd;
+    unsigned int             key = 0;
+    spinel_ssize_t           unpacked;
+    otSpinelFrameTraceEntry &entry = sTraceBuffer[sTraceHead];
+
+    unpacked = spinel_datatype_unpack(aFrame, aLength, "Ci", &header, &cmd);
+    VerifyOrExit(unpacked > 0);
+
+    if ((cmd >= SPINEL_CMD_PROP_VALUE_GET) && (cmd <= SPINEL_CMD_PROP_VALUE_REMOVED))
+    {
+        unpacked = spinel_datatype_unpack(aFrame, aLength, "Cii", &header, &cmd, &key);
+        VerifyOrExit(unpacked > 0);
+    }
+
+    entry.mTimestamp = otPlatTimeGet();
+    entry.mCommand   = cmd;
+    entry.mPropKey   = key;
+    entry.mLength    = aLength;
+    entry.mTid       = SPINEL_HEADER_GET_TID(header);
+    entry.mDirection = aTx ? OT_SPINEL_TRACE_DIR_TX : OT_SPINEL_TRACE_DIR_RX;
+
+    sTraceHead = static_cast<uint16_t>((sTraceHead + 1) % kTraceBufferSize);
+
+    if (sTraceCount < kTraceBufferSize)
+    {
+        sTraceCount++;
+    }
+
+exit:
+    return;
+}
+
+uint16_t Logger::ReadTrace(otSpinelFrameTraceEntry *aEntries, uint16_t aMaxEntries)
+{
+    uint16_t count = 0;
+
+    while ((count < aMaxEntries) && (sTraceCount > 0))
+    {
+        uint16_t tail = static_cast<uint16_t>((sTraceHead + kTraceBufferSize - sTraceCount) % kTraceBufferSize);
+
+        aEntries[count++] = sTraceBuffer[tail];
+        sTraceCount--;
+    }
+
+    return count;
+}
+
+#endif // OPENTHREAD_SPINEL_CONFIG_TRACE_ENABLE
+
 } // namespace Spinel
 } // namespace ot
@@ -29,16 +29,35 @@
 #ifndef OT_LIB_SPINEL_LOGGER_HPP_
 #define OT_LIB_SPINEL_LOGGER_HPP_
 
+#include "openthread-spinel-config.h"
+
 #include <stdint.h>
 
 #include <openthread/error.h>
 #include <openthread/platform/toolchain.h>
 
+#if OPENTHREAD_SPINEL_CONFIG_TRACE_ENABLE
+#include "lib/spinel/spinel_trace.h"
+#endif
+
 namespace ot {
 namespace Spinel {
 
 class Logger
 {
+#if OPENTHREAD_SPINEL_CONFIG_TRACE_ENABLE
+public:
+    /**
+     * Drains the oldest entries from the spinel frame trace ring buffer.
+     *
+     * @param[out] aEntries     A pointer to the buffer to copy the trace entries into.
+     * @param[in]  aMaxEntries  The maximum number of entries to copy.
+     *
+     * @returns The number of entries copied into @p aEntries.
+     */
+    static uint16_t ReadTrace(otSpinelFrameTraceEntry *aEntries, uint16_t aMaxEntries);
+#endif
+
 protected:
     explicit Logger(const char *aModuleName);
 
@@ -60,6 +79,17 @@ protected:
     };
 
     const char *mModuleName;
+
+#if OPENTHREAD_SPINEL_CONFIG_TRACE_ENABLE
+private:
+    static void TraceSpinelFrame(const uint8_t *aFrame, uint16_t aLength, bool aTx);
+
+    static constexpr uint16_t kTraceBufferSize = OPENTHREAD_SPINEL_CONFIG_TRACE_BUFFER_SIZE;
+
+    static otSpinelFrameTraceEntry sTraceBuffer[kTraceBufferSize];
+    static uint16_t                sTraceHead;  ///< Index of the next entry to write.
+    static uint16_t                sTraceCount; ///< Number of undrained entries in the buffer.
+#endif
 };
 
 } // namespace Spinel
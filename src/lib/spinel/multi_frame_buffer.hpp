@@ -85,6 +85,32 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * Writes a given number of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * If there is not enough space to write all of the bytes, the buffer and write pointer remain unchanged.
+     *
+     * @param[in]  aBuffer       A pointer to a data buffer to write.
+     * @param[in]  aWriteLength  Number of bytes in @p aBuffer to write.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes.
+     */
+    otError WriteBytes(const uint8_t *aBuffer, uint16_t aWriteLength)
+    {
+        otError error = OT_ERROR_NO_BUFS;
+
+        if (CanWrite(aWriteLength))
+        {
+            memcpy(mWritePointer, aBuffer, aWriteLength);
+            mWritePointer += aWriteLength;
+            mRemainingLength -= aWriteLength;
+            error = OT_ERROR_NONE;
+        }
+
+        return error;
+    }
+
     /**
      * Undoes the last @p aUndoLength writes, removing them from frame.
      *
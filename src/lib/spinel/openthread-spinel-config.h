@@ -98,6 +98,99 @@
 #define OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
 #endif
 
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_RX_FRAME_ZERO_COPY_ENABLE
+ *
+ * Define 1 to let received radio frames reference the PSDU bytes directly inside the spinel rx frame buffer,
+ * instead of copying the PSDU into a separate buffer.
+ *
+ * The spinel frame (and therefore the PSDU) remains valid while the receive done callback runs and is released only
+ * after the callback returns (deferred release), so this requires the receive done callback to fully consume the
+ * frame before returning, which is the case when the OpenThread stack processes received frames synchronously. Acks
+ * of transmitted frames are still copied, since they may be consumed after the spinel frame is released.
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_RX_FRAME_ZERO_COPY_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_RX_FRAME_ZERO_COPY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+ *
+ * Define 1 to pipeline the property queries issued during `RadioSpinel` initialization.
+ *
+ * When enabled, the init-time property GET commands are sent in one burst, each with its own transaction id, and
+ * the (possibly out-of-order) responses are collected in a single wait loop, instead of blocking on a full round
+ * trip per property. This shortens the RCP attach time on high-latency links.
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+ *
+ * Define 1 to let `RadioSpinel` batch property sets into `CMD_PROP_VALUE_MULTI_SET` frames when restoring
+ * properties after an RCP reset.
+ *
+ * A batch sets multiple properties with a single frame exchange instead of one round trip per property, which
+ * shortens the RCP recovery time. Batching is used only when the RCP advertises `SPINEL_CAP_CMD_MULTI`; otherwise
+ * the properties are restored with individual set commands.
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+ *
+ * Define 1 to post the radio state set commands (channel, raw stream enable) without blocking on the response.
+ *
+ * When enabled, `Receive()` and `Sleep()` send their property set commands and return immediately; the response
+ * is matched by transaction id and checked when it arrives through normal frame processing. This keeps a slow or
+ * retrying RCP from stalling the host mainloop (and the unrelated I/O it serves). The trade-off is that a failed
+ * set is only logged instead of being reported to the caller.
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_FLOW_CONTROL_ENABLE
+ *
+ * Define 1 to let `RadioSpinel` track the transmit frame buffer credits advertised by the RCP.
+ *
+ * When enabled and the RCP advertises `SPINEL_CAP_RCP_FLOW_CONTROL`, a transmit attempted while the RCP has no
+ * credit left fails immediately with a busy error, instead of occupying the radio until the RCP reports the
+ * dropped frame. Credits are replenished by the unsolicited `SPINEL_PROP_RCP_FRAME_BUFFER_CREDITS` updates the
+ * RCP sends as its buffer drains.
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_FLOW_CONTROL_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_FLOW_CONTROL_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_TRACE_ENABLE
+ *
+ * Define 1 to record every exchanged spinel frame in a binary trace ring buffer.
+ *
+ * Each entry holds the frame direction, transaction id, command, property key, length and a monotonic timestamp,
+ * captured without any text formatting so that tracing does not perturb the timing being measured. The buffer can
+ * be drained with `Spinel::Logger::ReadTrace()` (exposed on posix hosts as `otSysSpinelTraceRead()`).
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_TRACE_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_TRACE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_TRACE_BUFFER_SIZE
+ *
+ * The number of entries in the spinel frame trace ring buffer. When the buffer is full, the oldest entry is
+ * overwritten.
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_TRACE_BUFFER_SIZE
+#define OPENTHREAD_SPINEL_CONFIG_TRACE_BUFFER_SIZE 256
+#endif
+
 /**
  * @def OPENTHREAD_SPINEL_CONFIG_ABORT_ON_UNEXPECTED_RCP_RESET_ENABLE
  *
@@ -72,6 +72,22 @@ RadioSpinel::RadioSpinel(void)
     , mTxRadioTid(0)
     , mWaitingTid(0)
     , mWaitingKey(SPINEL_PROP_LAST_STATUS)
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+    , mPendingQueries(nullptr)
+    , mNumPendingQueries(0)
+#endif
+#if OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+    , mBatchActive(false)
+    , mBatchLength(0)
+#endif
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+    , mAsyncSetTid(0)
+    , mAsyncSetKey(SPINEL_PROP_LAST_STATUS)
+#endif
+#if OPENTHREAD_SPINEL_CONFIG_FLOW_CONTROL_ENABLE
+    , mFlowControlEnabled(false)
+    , mTxCredits(0)
+#endif
     , mPropertyFormat(nullptr)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
@@ -151,6 +167,54 @@ void RadioSpinel::Init(bool          aSkipRcpVersionCheck,
     mTxRadioFrame.mInfo.mTxInfo.mIeInfo = &mTxIeInfo;
 #endif
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+    {
+        PropertyQuery queries[4];
+        uint8_t       numQueries           = 0;
+        unsigned int  radioCaps            = 0;
+        unsigned int  rcpApiVersion        = 0;
+        unsigned int  minHostRcpApiVersion = 0;
+
+        InitializeCaps(supportsRcpApiVersion, supportsRcpMinHostApiVersion);
+
+        // Issue all init-time property queries in one burst and collect the responses together, rather than
+        // blocking on a full round trip per property.
+
+        queries[numQueries++].SetUp(SPINEL_PROP_HWADDR, SPINEL_DATATYPE_EUI64_S, sIeeeEui64.m8);
+        queries[numQueries++].SetUp(SPINEL_PROP_RADIO_CAPS, SPINEL_DATATYPE_UINT_PACKED_S, &radioCaps);
+
+        if (!aSkipRcpVersionCheck && supportsRcpApiVersion)
+        {
+            queries[numQueries++].SetUp(SPINEL_PROP_RCP_API_VERSION, SPINEL_DATATYPE_UINT_PACKED_S, &rcpApiVersion);
+        }
+
+        if (!aSkipRcpVersionCheck && supportsRcpMinHostApiVersion)
+        {
+            queries[numQueries++].SetUp(SPINEL_PROP_RCP_MIN_HOST_API_VERSION, SPINEL_DATATYPE_UINT_PACKED_S,
+                                        &minHostRcpApiVersion);
+        }
+
+        SuccessOrDie(GetProperties(queries, numQueries));
+
+        if (sSupportsLogCrashDump)
+        {
+            LogDebg("RCP supports crash dump logging. Requesting crash dump.");
+            SuccessOrExit(error = Set(SPINEL_PROP_RCP_LOG_CRASH_DUMP, nullptr));
+        }
+
+        if (!aSkipRcpVersionCheck && supportsRcpApiVersion)
+        {
+            ValidateRcpApiVersion(rcpApiVersion);
+        }
+
+        if (!aSkipRcpVersionCheck && supportsRcpMinHostApiVersion)
+        {
+            ValidateRcpMinHostApiVersion(minHostRcpApiVersion);
+        }
+
+        ValidateRadioCaps(static_cast<otRadioCaps>(radioCaps), aRequiredRadioCaps);
+    }
+#else
     SuccessOrExit(error = Get(SPINEL_PROP_HWADDR, SPINEL_DATATYPE_EUI64_S, sIeeeEui64.m8));
     InitializeCaps(supportsRcpApiVersion, supportsRcpMinHostApiVersion);
 
@@ -166,6 +230,7 @@ void RadioSpinel::Init(bool          aSkipRcpVersionCheck,
     }
 
     SuccessOrDie(CheckRadioCapabilities(aRequiredRadioCaps));
+#endif // OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
 
     mRxRadioFrame.mPsdu  = mRxPsdu;
     mTxRadioFrame.mPsdu  = mTxPsdu;
@@ -228,19 +293,35 @@ void RadioSpinel::InitializeCaps(bool &aSupportsRcpApiVersion, bool &aSupportsRc
     sSupportsResetToBootloader    = GetSpinelDriver().CoprocessorHasCap(SPINEL_CAP_RCP_RESET_TO_BOOTLOADER);
     aSupportsRcpMinHostApiVersion = GetSpinelDriver().CoprocessorHasCap(SPINEL_CAP_RCP_MIN_HOST_API_VERSION);
     sSupportsLogCrashDump         = GetSpinelDriver().CoprocessorHasCap(SPINEL_CAP_RCP_LOG_CRASH_DUMP);
+#if OPENTHREAD_SPINEL_CONFIG_FLOW_CONTROL_ENABLE
+    mFlowControlEnabled           = GetSpinelDriver().CoprocessorHasCap(SPINEL_CAP_RCP_FLOW_CONTROL);
+
+    if (mFlowControlEnabled)
+    {
+        SuccessOrDie(Get(SPINEL_PROP_RCP_FRAME_BUFFER_CREDITS, SPINEL_DATATYPE_UINT8_S, &mTxCredits));
+    }
+#endif
 }
 
 otError RadioSpinel::CheckRadioCapabilities(otRadioCaps aRequiredRadioCaps)
 {
-    static const char *const kAllRadioCapsStr[] = {"ack-timeout",     "energy-scan",   "tx-retries", "CSMA-backoff",
-                                                   "sleep-to-tx",     "tx-security",   "tx-timing",  "rx-timing",
-                                                   "rx-on-when-idle", "tx-frame-power"};
-
     otError      error = OT_ERROR_NONE;
     unsigned int radioCaps;
 
     SuccessOrExit(error = Get(SPINEL_PROP_RADIO_CAPS, SPINEL_DATATYPE_UINT_PACKED_S, &radioCaps));
-    sRadioCaps = static_cast<otRadioCaps>(radioCaps);
+    ValidateRadioCaps(static_cast<otRadioCaps>(radioCaps), aRequiredRadioCaps);
+
+exit:
+    return error;
+}
+
+void RadioSpinel::ValidateRadioCaps(otRadioCaps aRadioCaps, otRadioCaps aRequiredRadioCaps)
+{
+    static const char *const kAllRadioCapsStr[] = {"ack-timeout",     "energy-scan",   "tx-retries", "CSMA-backoff",
+                                                   "sleep-to-tx",     "tx-security",   "tx-timing",  "rx-timing",
+                                                   "rx-on-when-idle", "tx-frame-power"};
+
+    sRadioCaps = aRadioCaps;
 
     if ((sRadioCaps & aRequiredRadioCaps) != aRequiredRadioCaps)
     {
@@ -257,9 +338,6 @@ otError RadioSpinel::CheckRadioCapabilities(otRadioCaps aRequiredRadioCaps)
 
         HandleCompatibilityError();
     }
-
-exit:
-    return error;
 }
 
 otError RadioSpinel::CheckRcpApiVersion(bool aSupportsRcpApiVersion, bool aSupportsRcpMinHostApiVersion)
@@ -271,46 +349,184 @@ otError RadioSpinel::CheckRcpApiVersion(bool aSupportsRcpApiVersion, bool aSuppo
 
     if (aSupportsRcpApiVersion)
     {
-        // Make sure RCP is not too old and its version is within the
-        // range host supports.
-
         unsigned int rcpApiVersion;
 
         SuccessOrExit(error = Get(SPINEL_PROP_RCP_API_VERSION, SPINEL_DATATYPE_UINT_PACKED_S, &rcpApiVersion));
-
-        if (rcpApiVersion < SPINEL_MIN_HOST_SUPPORTED_RCP_API_VERSION)
-        {
-            LogCrit("RCP and host are using incompatible API versions");
-            LogCrit("RCP API Version %u is older than min required by host %u", rcpApiVersion,
-                    SPINEL_MIN_HOST_SUPPORTED_RCP_API_VERSION);
-            HandleCompatibilityError();
-        }
+        ValidateRcpApiVersion(rcpApiVersion);
     }
 
     if (aSupportsRcpMinHostApiVersion)
     {
-        // Check with RCP about min host API version it can work with,
-        // and make sure on host side our version is within the supported
-        // range.
-
         unsigned int minHostRcpApiVersion;
 
         SuccessOrExit(
             error = Get(SPINEL_PROP_RCP_MIN_HOST_API_VERSION, SPINEL_DATATYPE_UINT_PACKED_S, &minHostRcpApiVersion));
+        ValidateRcpMinHostApiVersion(minHostRcpApiVersion);
+    }
+
+exit:
+    return error;
+}
+
+void RadioSpinel::ValidateRcpApiVersion(unsigned int aRcpApiVersion)
+{
+    // Make sure RCP is not too old and its version is within the
+    // range host supports.
+
+    if (aRcpApiVersion < SPINEL_MIN_HOST_SUPPORTED_RCP_API_VERSION)
+    {
+        LogCrit("RCP and host are using incompatible API versions");
+        LogCrit("RCP API Version %u is older than min required by host %u", aRcpApiVersion,
+                SPINEL_MIN_HOST_SUPPORTED_RCP_API_VERSION);
+        HandleCompatibilityError();
+    }
+}
+
+void RadioSpinel::ValidateRcpMinHostApiVersion(unsigned int aMinHostRcpApiVersion)
+{
+    // Check with RCP about min host API version it can work with,
+    // and make sure on host side our version is within the supported
+    // range.
+
+    if (SPINEL_RCP_API_VERSION < aMinHostRcpApiVersion)
+    {
+        LogCrit("RCP and host are using incompatible API versions");
+        LogCrit("RCP requires min host API version %u but host is older and at version %u", aMinHostRcpApiVersion,
+                SPINEL_RCP_API_VERSION);
+        HandleCompatibilityError();
+    }
+}
+
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+
+void RadioSpinel::PropertyQuery::SetUp(spinel_prop_key_t aKey, const char *aFormat, void *aOutput)
+{
+    mKey    = aKey;
+    mFormat = aFormat;
+    mOutput = aOutput;
+    mError  = OT_ERROR_RESPONSE_TIMEOUT;
+    mTid    = 0;
+}
+
+otError RadioSpinel::GetProperties(PropertyQuery *aQueries, uint8_t aNumQueries)
+{
+    otError  error = OT_ERROR_NONE;
+    uint64_t end   = otPlatTimeGet() + kMaxWaitTime * kUsPerMs;
+
+    assert(mWaitingTid == 0);
+
+    mPendingQueries    = aQueries;
+    mNumPendingQueries = aNumQueries;
 
-        if (SPINEL_RCP_API_VERSION < minHostRcpApiVersion)
+    // Send all GET commands in one burst, each tracked by its own transaction id.
+
+    for (uint8_t i = 0; i < aNumQueries; i++)
+    {
+        spinel_tid_t tid = GetNextTid();
+
+        VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+        aQueries[i].mTid = tid;
+        SuccessOrExit(error = GetSpinelDriver().SendCommand(SPINEL_CMD_PROP_VALUE_GET, aQueries[i].mKey, tid));
+    }
+
+    // Collect the responses, which may arrive in any order (see `HandleQueryResponse()`).
+
+    while (HasPendingQuery())
+    {
+        uint64_t now = otPlatTimeGet();
+
+        if ((end <= now) || (GetSpinelDriver().GetSpinelInterface()->WaitForFrame(end - now) != OT_ERROR_NONE))
         {
-            LogCrit("RCP and host are using incompatible API versions");
-            LogCrit("RCP requires min host API version %u but host is older and at version %u", minHostRcpApiVersion,
-                    SPINEL_RCP_API_VERSION);
-            HandleCompatibilityError();
+            LogWarn("Wait for response timeout");
+            HandleRcpTimeout();
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
         }
     }
 
+    for (uint8_t i = 0; i < aNumQueries; i++)
+    {
+        SuccessOrExit(error = aQueries[i].mError);
+    }
+
 exit:
+    for (uint8_t i = 0; i < aNumQueries; i++)
+    {
+        if (aQueries[i].mTid != 0)
+        {
+            FreeTid(aQueries[i].mTid);
+            aQueries[i].mTid = 0;
+        }
+    }
+
+    mPendingQueries    = nullptr;
+    mNumPendingQueries = 0;
+
+    LogIfFail("Error processing query burst", error);
     return error;
 }
 
+RadioSpinel::PropertyQuery *RadioSpinel::FindPendingQuery(spinel_tid_t aTid)
+{
+    PropertyQuery *query = nullptr;
+
+    VerifyOrExit(aTid != 0);
+
+    for (uint8_t i = 0; i < mNumPendingQueries; i++)
+    {
+        if (mPendingQueries[i].mTid == aTid)
+        {
+            query = &mPendingQueries[i];
+            break;
+        }
+    }
+
+exit:
+    return query;
+}
+
+bool RadioSpinel::HasPendingQuery(void) const
+{
+    bool hasPending = false;
+
+    for (uint8_t i = 0; i < mNumPendingQueries; i++)
+    {
+        if (mPendingQueries[i].mTid != 0)
+        {
+            hasPending = true;
+            break;
+        }
+    }
+
+    return hasPending;
+}
+
+void RadioSpinel::HandleQueryResponse(PropertyQuery    &aQuery,
+                                      uint32_t          aCommand,
+                                      spinel_prop_key_t aKey,
+                                      const uint8_t    *aBuffer,
+                                      uint16_t          aLength)
+{
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        aQuery.mError = (unpacked > 0) ? SpinelStatusToOtError(status) : OT_ERROR_PARSE;
+    }
+    else if ((aCommand == SPINEL_CMD_PROP_VALUE_IS) && (aKey == aQuery.mKey))
+    {
+        spinel_ssize_t unpacked = spinel_datatype_unpack_in_place(aBuffer, aLength, aQuery.mFormat, aQuery.mOutput);
+
+        aQuery.mError = (unpacked > 0) ? OT_ERROR_NONE : OT_ERROR_PARSE;
+    }
+    else
+    {
+        aQuery.mError = OT_ERROR_DROP;
+    }
+}
+
+#endif // OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+
 void RadioSpinel::Deinit(void)
 {
     // This allows implementing pseudo reset.
@@ -395,6 +611,30 @@ void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
     spinel_ssize_t    rval   = 0;
     otError           error  = OT_ERROR_NONE;
 
+#if OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+    rval = spinel_datatype_unpack(aBuffer, aLength, "Ci", &header, &cmd);
+    VerifyOrExit(rval > 0, error = OT_ERROR_PARSE);
+
+    if (cmd == SPINEL_CMD_PROP_VALUES_ARE)
+    {
+        // A `VALUES_ARE` response (to a `MULTI_SET` command) carries no property key.
+
+        if (mWaitingTid == SPINEL_HEADER_GET_TID(header))
+        {
+            HandleMultiSetResponse(aBuffer + rval, aLength - static_cast<uint16_t>(rval));
+            FreeTid(mWaitingTid);
+            mWaitingTid = 0;
+        }
+        else
+        {
+            LogWarn("Unexpected Spinel transaction message: %u", SPINEL_HEADER_GET_TID(header));
+            error = OT_ERROR_DROP;
+        }
+
+        ExitNow();
+    }
+#endif
+
     rval = spinel_datatype_unpack(aBuffer, aLength, "CiiD", &header, &cmd, &key, &data, &len);
     VerifyOrExit(rval > 0 && cmd >= SPINEL_CMD_PROP_VALUE_IS && cmd <= SPINEL_CMD_PROP_VALUE_REMOVED,
                  error = OT_ERROR_PARSE);
@@ -415,6 +655,22 @@ void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
         FreeTid(mTxRadioTid);
         mTxRadioTid = 0;
     }
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+    else if (mAsyncSetTid == SPINEL_HEADER_GET_TID(header))
+    {
+        HandleAsyncSetResponse(cmd, key, data, static_cast<uint16_t>(len));
+        FreeTid(mAsyncSetTid);
+        mAsyncSetTid = 0;
+    }
+#endif
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+    else if (PropertyQuery *query = FindPendingQuery(SPINEL_HEADER_GET_TID(header)))
+    {
+        HandleQueryResponse(*query, cmd, key, data, static_cast<uint16_t>(len));
+        FreeTid(query->mTid);
+        query->mTid = 0;
+    }
+#endif
     else
     {
         LogWarn("Unexpected Spinel transaction message: %u", SPINEL_HEADER_GET_TID(header));
@@ -495,6 +751,37 @@ exit:
     LogIfFail("Error processing result", mError);
 }
 
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+void RadioSpinel::HandleAsyncSetResponse(uint32_t          aCommand,
+                                         spinel_prop_key_t aKey,
+                                         const uint8_t    *aBuffer,
+                                         uint16_t          aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        error = SpinelStatusToOtError(status);
+    }
+    else if ((aCommand != SPINEL_CMD_PROP_VALUE_IS) || (aKey != mAsyncSetKey))
+    {
+        error = OT_ERROR_DROP;
+    }
+
+exit:
+    UpdateParseErrorCount(error);
+
+    if (error != OT_ERROR_NONE)
+    {
+        LogWarn("Async set spinel property %u failed: %s", mAsyncSetKey, otThreadErrorToString(error));
+    }
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+
 void RadioSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
 {
     otError        error = OT_ERROR_NONE;
@@ -502,7 +789,7 @@ void RadioSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer,
 
     if (aKey == SPINEL_PROP_STREAM_RAW)
     {
-        SuccessOrExit(error = ParseRadioFrame(mRxRadioFrame, aBuffer, aLength, unpacked));
+        SuccessOrExit(error = ParseRadioFrame(mRxRadioFrame, aBuffer, aLength, unpacked, /* aZeroCopyPsdu */ true));
         RadioReceive();
     }
     else if (aKey == SPINEL_PROP_LAST_STATUS)
@@ -538,6 +825,34 @@ void RadioSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer,
             LogInfo("RCP last status: %s", spinel_status_to_cstr(status));
         }
     }
+#if OPENTHREAD_SPINEL_CONFIG_FLOW_CONTROL_ENABLE
+    else if (aKey == SPINEL_PROP_RCP_FRAME_BUFFER_CREDITS)
+    {
+        unpacked = spinel_datatype_unpack(aBuffer, aLength, SPINEL_DATATYPE_UINT8_S, &mTxCredits);
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+    }
+#endif
+    else if (aKey == SPINEL_PROP_RCP_TIME_STATS)
+    {
+        otRadioTimeStats durations;
+        uint32_t         txTime;
+        uint32_t         rxTime;
+        uint32_t         sleepTime;
+        uint32_t         disabledTime;
+
+        unpacked = spinel_datatype_unpack(aBuffer, aLength, "LLLL", &txTime, &rxTime, &sleepTime, &disabledTime);
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+
+        if (mCallbacks.mTimeStatsSample != nullptr)
+        {
+            durations.mTxTime       = txTime;
+            durations.mRxTime       = rxTime;
+            durations.mSleepTime    = sleepTime;
+            durations.mDisabledTime = disabledTime;
+
+            mCallbacks.mTimeStatsSample(mInstance, &durations);
+        }
+    }
     else if (aKey == SPINEL_PROP_MAC_ENERGY_SCAN_RESULT)
     {
         uint8_t scanChannel;
@@ -659,7 +974,8 @@ exit:
 otError RadioSpinel::ParseRadioFrame(otRadioFrame   &aFrame,
                                      const uint8_t  *aBuffer,
                                      uint16_t        aLength,
-                                     spinel_ssize_t &aUnpacked)
+                                     spinel_ssize_t &aUnpacked,
+                                     bool            aZeroCopyPsdu)
 {
     otError        error        = OT_ERROR_NONE;
     uint16_t       flags        = 0;
@@ -668,25 +984,62 @@ otError RadioSpinel::ParseRadioFrame(otRadioFrame   &aFrame,
     unsigned int   receiveError = 0;
     spinel_ssize_t unpacked;
 
+#if !OPENTHREAD_SPINEL_CONFIG_RX_FRAME_ZERO_COPY_ENABLE
+    OT_UNUSED_VARIABLE(aZeroCopyPsdu);
+#endif
+
     VerifyOrExit(aLength > 0, aFrame.mLength = 0);
 
-    unpacked = spinel_datatype_unpack_in_place(aBuffer, aLength,
-                                               SPINEL_DATATYPE_DATA_WLEN_S                          // Frame
-                                                   SPINEL_DATATYPE_INT8_S                           // RSSI
-                                                       SPINEL_DATATYPE_INT8_S                       // Noise Floor
-                                                           SPINEL_DATATYPE_UINT16_S                 // Flags
-                                                               SPINEL_DATATYPE_STRUCT_S(            // PHY-data
-                                                                   SPINEL_DATATYPE_UINT8_S          // 802.15.4 channel
-                                                                       SPINEL_DATATYPE_UINT8_S      // 802.15.4 LQI
-                                                                           SPINEL_DATATYPE_UINT64_S // Timestamp (us).
-                                                                   ) SPINEL_DATATYPE_STRUCT_S(      // Vendor-data
-                                                                   SPINEL_DATATYPE_UINT_PACKED_S    // Receive error
-                                                                   ),
-                                               aFrame.mPsdu, &size, &aFrame.mInfo.mRxInfo.mRssi, &noiseFloor, &flags,
-                                               &aFrame.mChannel, &aFrame.mInfo.mRxInfo.mLqi,
-                                               &aFrame.mInfo.mRxInfo.mTimestamp, &receiveError);
+#if OPENTHREAD_SPINEL_CONFIG_RX_FRAME_ZERO_COPY_ENABLE
+    if (aZeroCopyPsdu)
+    {
+        const uint8_t *psdu = nullptr;
+
+        unpacked = spinel_datatype_unpack(aBuffer, aLength,
+                                          SPINEL_DATATYPE_DATA_WLEN_S                          // Frame
+                                              SPINEL_DATATYPE_INT8_S                           // RSSI
+                                                  SPINEL_DATATYPE_INT8_S                       // Noise Floor
+                                                      SPINEL_DATATYPE_UINT16_S                 // Flags
+                                                          SPINEL_DATATYPE_STRUCT_S(            // PHY-data
+                                                              SPINEL_DATATYPE_UINT8_S          // 802.15.4 channel
+                                                                  SPINEL_DATATYPE_UINT8_S      // 802.15.4 LQI
+                                                                      SPINEL_DATATYPE_UINT64_S // Timestamp (us).
+                                                              ) SPINEL_DATATYPE_STRUCT_S(      // Vendor-data
+                                                              SPINEL_DATATYPE_UINT_PACKED_S    // Receive error
+                                                              ),
+                                          &psdu, &size, &aFrame.mInfo.mRxInfo.mRssi, &noiseFloor, &flags,
+                                          &aFrame.mChannel, &aFrame.mInfo.mRxInfo.mLqi,
+                                          &aFrame.mInfo.mRxInfo.mTimestamp, &receiveError);
 
-    VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        VerifyOrExit(size <= OT_RADIO_FRAME_MAX_SIZE, error = OT_ERROR_PARSE);
+
+        // The PSDU points into the spinel rx frame buffer, which remains valid (deferred release) while the frame
+        // is processed by the receive done callback. The cast is needed as the frame may be decrypted in place.
+        aFrame.mPsdu = const_cast<uint8_t *>(psdu);
+    }
+    else
+#endif // OPENTHREAD_SPINEL_CONFIG_RX_FRAME_ZERO_COPY_ENABLE
+    {
+        unpacked =
+            spinel_datatype_unpack_in_place(aBuffer, aLength,
+                                            SPINEL_DATATYPE_DATA_WLEN_S                          // Frame
+                                                SPINEL_DATATYPE_INT8_S                           // RSSI
+                                                    SPINEL_DATATYPE_INT8_S                       // Noise Floor
+                                                        SPINEL_DATATYPE_UINT16_S                 // Flags
+                                                            SPINEL_DATATYPE_STRUCT_S(            // PHY-data
+                                                                SPINEL_DATATYPE_UINT8_S          // 802.15.4 channel
+                                                                    SPINEL_DATATYPE_UINT8_S      // 802.15.4 LQI
+                                                                        SPINEL_DATATYPE_UINT64_S // Timestamp (us).
+                                                                ) SPINEL_DATATYPE_STRUCT_S(      // Vendor-data
+                                                                SPINEL_DATATYPE_UINT_PACKED_S    // Receive error
+                                                                ),
+                                            aFrame.mPsdu, &size, &aFrame.mInfo.mRxInfo.mRssi, &noiseFloor, &flags,
+                                            &aFrame.mChannel, &aFrame.mInfo.mRxInfo.mLqi,
+                                            &aFrame.mInfo.mRxInfo.mTimestamp, &receiveError);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+    }
     aUnpacked = unpacked;
 
     aBuffer += unpacked;
@@ -1103,6 +1456,61 @@ exit:
     return error;
 }
 
+otError RadioSpinel::SetSrcMatchShortEntries(const uint16_t *aShortAddresses, uint16_t aNumEntries)
+{
+    otError error;
+    uint8_t buffer[OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES * sizeof(uint16_t)];
+
+    VerifyOrExit(aNumEntries <= OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES, error = OT_ERROR_NO_BUFS);
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        buffer[i * sizeof(uint16_t)]     = (aShortAddresses[i] >> 0) & 0xff;
+        buffer[i * sizeof(uint16_t) + 1] = (aShortAddresses[i] >> 8) & 0xff;
+    }
+
+    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_DATA_S, buffer,
+                              static_cast<uint32_t>(aNumEntries * sizeof(uint16_t))));
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    memcpy(mSrcMatchShortEntries, aShortAddresses, aNumEntries * sizeof(uint16_t));
+    mSrcMatchShortEntryCount = aNumEntries;
+#endif
+
+exit:
+    return error;
+}
+
+otError RadioSpinel::SetSrcMatchExtEntries(const otExtAddress *aExtAddresses, uint16_t aNumEntries)
+{
+    otError error;
+    uint8_t buffer[OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES * sizeof(otExtAddress)];
+
+    VerifyOrExit(aNumEntries <= OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES, error = OT_ERROR_NO_BUFS);
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        memcpy(&buffer[i * sizeof(otExtAddress)], aExtAddresses[i].m8, sizeof(otExtAddress));
+    }
+
+    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_DATA_S, buffer,
+                              static_cast<uint32_t>(aNumEntries * sizeof(otExtAddress))));
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    memcpy(mSrcMatchExtEntries, aExtAddresses, aNumEntries * sizeof(otExtAddress));
+    mSrcMatchExtEntryCount = aNumEntries;
+#endif
+
+exit:
+    return error;
+}
+
+otError RadioSpinel::SetSrcMatchPendingFilter(const uint8_t *aFilter, uint16_t aLength)
+{
+    return Set(SPINEL_PROP_MAC_SRC_MATCH_PENDING_FILTER, SPINEL_DATATYPE_DATA_S, aFilter,
+               static_cast<uint32_t>(aLength));
+}
+
 otError RadioSpinel::GetTransmitPower(int8_t &aPower)
 {
     otError error = Get(SPINEL_PROP_PHY_TX_POWER, SPINEL_DATATYPE_INT8_S, &aPower);
@@ -1325,6 +1733,17 @@ otError RadioSpinel::Set(spinel_prop_key_t aKey, const char *aFormat, ...)
 
     assert(mWaitingTid == 0);
 
+#if OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+    if (mBatchActive)
+    {
+        va_start(mPropertyArgs, aFormat);
+        error = BatchSetV(aKey, aFormat, mPropertyArgs);
+        va_end(mPropertyArgs);
+
+        return error;
+    }
+#endif
+
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     do
     {
@@ -1341,12 +1760,58 @@ otError RadioSpinel::Set(spinel_prop_key_t aKey, const char *aFormat, ...)
     return error;
 }
 
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+otError RadioSpinel::SetAsync(spinel_prop_key_t aKey, const char *aFormat, ...)
+{
+    otError      error = OT_ERROR_NONE;
+    spinel_tid_t tid;
+    va_list      args;
+
+    // Fall back to a blocking set while a previous asynchronous set is still outstanding, so that updates are
+    // applied in order.
+    if (mAsyncSetTid != 0)
+    {
+        va_start(args, aFormat);
+        error = RequestWithExpectedCommandV(SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_SET, aKey, aFormat, args);
+        va_end(args);
+        ExitNow();
+    }
+
+    tid = GetNextTid();
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    va_start(args, aFormat);
+    error = GetSpinelDriver().SendCommand(SPINEL_CMD_PROP_VALUE_SET, aKey, tid, aFormat, args);
+    va_end(args);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    mAsyncSetTid = tid;
+    mAsyncSetKey = aKey;
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+
 otError RadioSpinel::Insert(spinel_prop_key_t aKey, const char *aFormat, ...)
 {
     otError error;
 
     assert(mWaitingTid == 0);
 
+#if OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+    // Flush any batched sets first, so that this update is applied after them.
+    if (mBatchActive && ((error = FlushPropSetBatch()) != OT_ERROR_NONE))
+    {
+        return error;
+    }
+#endif
+
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     do
     {
@@ -1369,6 +1834,14 @@ otError RadioSpinel::Remove(spinel_prop_key_t aKey, const char *aFormat, ...)
 
     assert(mWaitingTid == 0);
 
+#if OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+    // Flush any batched sets first, so that this update is applied after them.
+    if (mBatchActive && ((error = FlushPropSetBatch()) != OT_ERROR_NONE))
+    {
+        return error;
+    }
+#endif
+
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     do
     {
@@ -1385,6 +1858,137 @@ otError RadioSpinel::Remove(spinel_prop_key_t aKey, const char *aFormat, ...)
     return error;
 }
 
+#if OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+
+void RadioSpinel::BatchSetBegin(void)
+{
+    // Batch only when the RCP supports `CMD_MULTI`; otherwise `Set()` keeps
+    // issuing individual commands.
+    mBatchActive = GetSpinelDriver().CoprocessorHasCap(SPINEL_CAP_CMD_MULTI);
+    mBatchLength = 0;
+}
+
+otError RadioSpinel::BatchSetEnd(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mBatchActive);
+
+    error        = FlushPropSetBatch();
+    mBatchActive = false;
+
+exit:
+    return error;
+}
+
+otError RadioSpinel::BatchSetV(spinel_prop_key_t aKey, const char *aFormat, va_list aArgs)
+{
+    otError error = AppendBatchEntry(aKey, aFormat, aArgs);
+
+    if (error == OT_ERROR_NO_BUFS)
+    {
+        // The entry does not fit in the remaining buffer space. Flush the
+        // collected batch and retry with an empty buffer.
+
+        SuccessOrExit(error = FlushPropSetBatch());
+        error = AppendBatchEntry(aKey, aFormat, aArgs);
+    }
+
+exit:
+    return error;
+}
+
+otError RadioSpinel::AppendBatchEntry(spinel_prop_key_t aKey, const char *aFormat, va_list aArgs)
+{
+    otError        error  = OT_ERROR_NONE;
+    uint16_t       offset = mBatchLength + sizeof(uint16_t); // Reserve room for the struct length.
+    uint16_t       structLen;
+    spinel_ssize_t packed;
+
+    VerifyOrExit(offset <= kBatchBufferSize, error = OT_ERROR_NO_BUFS);
+
+    packed = spinel_datatype_pack(mBatchBuffer + offset, kBatchBufferSize - offset, SPINEL_DATATYPE_UINT_PACKED_S,
+                                  aKey);
+    VerifyOrExit(packed > 0 && packed <= kBatchBufferSize - offset, error = OT_ERROR_NO_BUFS);
+    offset += static_cast<uint16_t>(packed);
+
+    if (aFormat)
+    {
+        va_list args;
+
+        va_copy(args, aArgs);
+        packed = spinel_datatype_vpack(mBatchBuffer + offset, kBatchBufferSize - offset, aFormat, args);
+        va_end(args);
+
+        VerifyOrExit(packed >= 0 && packed <= kBatchBufferSize - offset, error = OT_ERROR_NO_BUFS);
+        offset += static_cast<uint16_t>(packed);
+    }
+
+    structLen                      = offset - mBatchLength - sizeof(uint16_t);
+    mBatchBuffer[mBatchLength]     = structLen & 0xff;
+    mBatchBuffer[mBatchLength + 1] = (structLen >> 8) & 0xff;
+    mBatchLength                   = offset;
+
+exit:
+    return error;
+}
+
+otError RadioSpinel::FlushPropSetBatch(void)
+{
+    otError      error = OT_ERROR_NONE;
+    spinel_tid_t tid;
+
+    VerifyOrExit(mBatchLength > 0);
+
+    tid = GetNextTid();
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    SuccessOrExit(error =
+                      GetSpinelDriver().SendCommand(SPINEL_CMD_PROP_VALUE_MULTI_SET, tid, mBatchBuffer, mBatchLength));
+
+    mWaitingKey = SPINEL_PROP_LAST_STATUS;
+    mWaitingTid = tid;
+    error       = WaitResponse();
+
+exit:
+    mBatchLength = 0;
+    return error;
+}
+
+void RadioSpinel::HandleMultiSetResponse(const uint8_t *aBuffer, uint16_t aLength)
+{
+    mError = OT_ERROR_NONE;
+
+    // Each struct carries the property key followed by its set status.
+
+    while (aLength > 0)
+    {
+        unsigned int   key;
+        unsigned int   status;
+        spinel_ssize_t unpacked = spinel_datatype_unpack(aBuffer, aLength, "t(ii)", &key, &status);
+
+        VerifyOrExit(unpacked > 0, mError = OT_ERROR_PARSE);
+
+        if (status != SPINEL_STATUS_OK)
+        {
+            LogWarn("Batched set of property %lu failed with status %u", ToUlong(key), status);
+
+            if (mError == OT_ERROR_NONE)
+            {
+                mError = SpinelStatusToOtError(static_cast<spinel_status_t>(status));
+            }
+        }
+
+        aBuffer += unpacked;
+        aLength -= static_cast<uint16_t>(unpacked);
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+
 otError RadioSpinel::WaitResponse(bool aHandleRcpTimeout)
 {
     uint64_t end = otPlatTimeGet() + kMaxWaitTime * kUsPerMs;
@@ -1555,7 +2159,9 @@ void RadioSpinel::HandleTransmitDone(uint32_t          aCommand,
 
     if (status == SPINEL_STATUS_OK)
     {
-        SuccessOrExit(error = ParseRadioFrame(mAckRadioFrame, aBuffer, aLength, unpacked));
+        // The ack frame is always copied as it may be consumed from `ProcessRadioStateMachine()` after the spinel
+        // frame holding it has already been released.
+        SuccessOrExit(error = ParseRadioFrame(mAckRadioFrame, aBuffer, aLength, unpacked, /* aZeroCopyPsdu */ false));
         aBuffer += unpacked;
         aLength -= static_cast<uint16_t>(unpacked);
     }
@@ -1607,6 +2213,12 @@ otError RadioSpinel::Transmit(otRadioFrame &aFrame)
 
     VerifyOrExit(mState == kStateReceive || (mState == kStateSleep && (sRadioCaps & OT_RADIO_CAPS_SLEEP_TO_TX)));
 
+#if OPENTHREAD_SPINEL_CONFIG_FLOW_CONTROL_ENABLE
+    // Apply backpressure while the RCP has no transmit credit left, instead of occupying the radio with a frame
+    // the RCP is going to drop.
+    VerifyOrExit(!mFlowControlEnabled || (mTxCredits > 0), error = OT_ERROR_BUSY);
+#endif
+
     mTransmitFrame = &aFrame;
 
 #if OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT && OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
@@ -1674,6 +2286,13 @@ otError RadioSpinel::Transmit(otRadioFrame &aFrame)
 
     if (error == OT_ERROR_NONE)
     {
+#if OPENTHREAD_SPINEL_CONFIG_FLOW_CONTROL_ENABLE
+        if (mFlowControlEnabled && (mTxCredits > 0))
+        {
+            mTxCredits--;
+        }
+#endif
+
         // Waiting for `TransmitDone` event.
         mState        = kStateTransmitting;
         mTxRadioEndUs = otPlatTimeGet() + kTxWaitUs;
@@ -1692,14 +2311,22 @@ otError RadioSpinel::Receive(uint8_t aChannel)
 
     if (mChannel != aChannel)
     {
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+        error = SetAsync(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, aChannel);
+#else
         error = Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, aChannel);
+#endif
         SuccessOrExit(error);
         mChannel = aChannel;
     }
 
     if (mState == kStateSleep)
     {
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+        error = SetAsync(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
+#else
         error = Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
+#endif
         SuccessOrExit(error);
     }
 
@@ -1736,7 +2363,11 @@ otError RadioSpinel::Sleep(void)
     switch (mState)
     {
     case kStateReceive:
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+        error = SetAsync(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, false);
+#else
         error = Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, false);
+#endif
         SuccessOrExit(error);
 
         mState = kStateSleep;
@@ -2062,6 +2693,12 @@ void RadioSpinel::RecoverFromRcpFailure(void)
     mCmdNextTid   = 1;
     mTxRadioTid   = 0;
     mWaitingTid   = 0;
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+    mAsyncSetTid = 0;
+#endif
+#if OPENTHREAD_SPINEL_CONFIG_FLOW_CONTROL_ENABLE
+    mTxCredits = 1;
+#endif
     mError        = OT_ERROR_NONE;
     mIsTimeSynced = false;
 
@@ -2151,6 +2788,12 @@ void RadioSpinel::HandleSavedFrame(const uint8_t *aFrame, uint16_t aLength) { Ha
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 void RadioSpinel::RestoreProperties(void)
 {
+#if OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+    // Collect the property sets below into multi-set batches (one frame
+    // exchange per batch) when the RCP supports it.
+    BatchSetBegin();
+#endif
+
     SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId));
     SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress));
     SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, mExtendedAddress.m8));
@@ -2229,6 +2872,12 @@ void RadioSpinel::RestoreProperties(void)
         SuccessOrDie(Set(SPINEL_PROP_PHY_FEM_LNA_GAIN, SPINEL_DATATYPE_INT8_S, mFemLnaGain));
     }
 
+#if OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+    // End batching here: the properties below tolerate individual failures
+    // (e.g., older RCPs without max transmit power support).
+    SuccessOrDie(BatchSetEnd());
+#endif
+
 #if OPENTHREAD_POSIX_CONFIG_MAX_POWER_TABLE_ENABLE
     for (uint8_t channel = Radio::kChannelMin; channel <= Radio::kChannelMax; channel++)
     {
@@ -107,6 +107,14 @@ struct RadioSpinelCallbacks
      */
     void (*mSwitchoverDone)(otInstance *aInstance, bool aSuccess);
 
+    /**
+     * This callback notifies user of `RadioSpinel` of a radio time statistics sample reported by the RCP.
+     *
+     * @param[in]  aInstance   A pointer to the OpenThread instance structure.
+     * @param[in]  aDurations  The durations (in microseconds) spent in each radio state since the previous sample.
+     */
+    void (*mTimeStatsSample)(otInstance *aInstance, const otRadioTimeStats *aDurations);
+
     /**
      * This method saves the radio spinel metrics to the temporary storage.
      *
@@ -529,6 +537,46 @@ public:
      */
     otError ClearSrcMatchExtEntries(void);
 
+    /**
+     * Sets the short addresses in the source address match table, replacing all existing short address entries.
+     *
+     * @param[in]  aShortAddresses  A pointer to an array of short addresses.
+     * @param[in]  aNumEntries      Number of entries in @p aShortAddresses.
+     *
+     * @retval  OT_ERROR_NONE               Successfully set the short address entries in the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_BUFS            Not enough entries available in the source match table.
+     */
+    otError SetSrcMatchShortEntries(const uint16_t *aShortAddresses, uint16_t aNumEntries);
+
+    /**
+     * Sets the extended addresses in the source address match table, replacing all existing extended address
+     * entries.
+     *
+     * @param[in]  aExtAddresses  A pointer to an array of extended addresses stored in little-endian byte order.
+     * @param[in]  aNumEntries    Number of entries in @p aExtAddresses.
+     *
+     * @retval  OT_ERROR_NONE               Successfully set the extended address entries in the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_BUFS            Not enough entries available in the source match table.
+     */
+    otError SetSrcMatchExtEntries(const otExtAddress *aExtAddresses, uint16_t aNumEntries);
+
+    /**
+     * Sets the source match pending filter, a compact bitmap the radio consults while source matching is disabled.
+     *
+     * @param[in]  aFilter   A pointer to the filter bitmap.
+     * @param[in]  aLength   The filter length in bytes, or zero to remove the filter.
+     *
+     * @retval  OT_ERROR_NONE               Successfully set the source match pending filter.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NOT_IMPLEMENTED    The transceiver does not support the source match pending filter.
+     */
+    otError SetSrcMatchPendingFilter(const uint8_t *aFilter, uint16_t aLength);
+
     /**
      * Begins the energy scan sequence on the radio.
      *
@@ -936,6 +984,25 @@ public:
      */
     otError Remove(spinel_prop_key_t aKey, const char *aFormat, ...);
 
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+    /**
+     * Tries to update a property of OpenThread transceiver without blocking on the response.
+     *
+     * The response is matched by transaction id and checked when it arrives through normal frame processing. A
+     * failure reported in the response is only logged. While a previous asynchronous set is still outstanding,
+     * this method falls back to a blocking set so that updates are applied in order.
+     *
+     * @param[in]   aKey        Spinel property key.
+     * @param[in]   aFormat     Spinel formatter to pack the value.
+     * @param[in]   ...         Variable arguments list.
+     *
+     * @retval  OT_ERROR_NONE               Successfully posted the set command.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     */
+    otError SetAsync(spinel_prop_key_t aKey, const char *aFormat, ...);
+#endif
+
     /**
      * Sends a reset command to the RCP.
      *
@@ -1114,6 +1181,45 @@ private:
     otError CheckRadioCapabilities(otRadioCaps aRequiredRadioCaps);
     otError CheckRcpApiVersion(bool aSupportsRcpApiVersion, bool aSupportsRcpMinHostApiVersion);
     void    InitializeCaps(bool &aSupportsRcpApiVersion, bool &aSupportsRcpMinHostApiVersion);
+    void    ValidateRadioCaps(otRadioCaps aRadioCaps, otRadioCaps aRequiredRadioCaps);
+    void    ValidateRcpApiVersion(unsigned int aRcpApiVersion);
+    void    ValidateRcpMinHostApiVersion(unsigned int aMinHostRcpApiVersion);
+
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+    // Represents a single property GET within a pipelined query burst (see `GetProperties()`).
+    struct PropertyQuery
+    {
+        void SetUp(spinel_prop_key_t aKey, const char *aFormat, void *aOutput);
+
+        spinel_prop_key_t mKey;    ///< The property key to query.
+        const char       *mFormat; ///< The spinel format to unpack the response value (single output argument).
+        void             *mOutput; ///< A pointer to where to store the unpacked response value.
+        otError           mError;  ///< The result of the query.
+        spinel_tid_t      mTid;    ///< The transaction id of the query (zero once its response is handled).
+    };
+
+    otError        GetProperties(PropertyQuery *aQueries, uint8_t aNumQueries);
+    PropertyQuery *FindPendingQuery(spinel_tid_t aTid);
+    bool           HasPendingQuery(void) const;
+    void           HandleQueryResponse(PropertyQuery    &aQuery,
+                                       uint32_t          aCommand,
+                                       spinel_prop_key_t aKey,
+                                       const uint8_t    *aBuffer,
+                                       uint16_t          aLength);
+#endif
+
+#if OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+    void    BatchSetBegin(void);
+    otError BatchSetEnd(void);
+    otError BatchSetV(spinel_prop_key_t aKey, const char *aFormat, va_list aArgs);
+    otError AppendBatchEntry(spinel_prop_key_t aKey, const char *aFormat, va_list aArgs);
+    otError FlushPropSetBatch(void);
+    void    HandleMultiSetResponse(const uint8_t *aBuffer, uint16_t aLength);
+#endif
+
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+    void HandleAsyncSetResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+#endif
 
     /**
      * Triggers a state transfer of the state machine.
@@ -1146,7 +1252,13 @@ private:
                                         const char       *aFormat,
                                         va_list           aArgs);
     otError WaitResponse(bool aHandleRcpTimeout = true);
-    otError ParseRadioFrame(otRadioFrame &aFrame, const uint8_t *aBuffer, uint16_t aLength, spinel_ssize_t &aUnpacked);
+    // When `aZeroCopyPsdu` is `true` (and `OPENTHREAD_SPINEL_CONFIG_RX_FRAME_ZERO_COPY_ENABLE` is used), `aFrame`
+    // is parsed with its PSDU pointing directly into `aBuffer`, which then must stay valid while `aFrame` is in use.
+    otError ParseRadioFrame(otRadioFrame   &aFrame,
+                            const uint8_t  *aBuffer,
+                            uint16_t        aLength,
+                            spinel_ssize_t &aUnpacked,
+                            bool            aZeroCopyPsdu);
 
     /**
      * Returns if the property changed event is safe to be handled now.
@@ -1258,6 +1370,25 @@ private:
     spinel_tid_t      mTxRadioTid;      ///< The transaction id used to send a radio frame.
     spinel_tid_t      mWaitingTid;      ///< The transaction id of current transaction.
     spinel_prop_key_t mWaitingKey;      ///< The property key of current transaction.
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+    PropertyQuery *mPendingQueries;    ///< In-flight queries of current pipelined burst (`nullptr` if none).
+    uint8_t        mNumPendingQueries; ///< Number of queries in current pipelined burst.
+#endif
+#if OPENTHREAD_SPINEL_CONFIG_MULTI_SET_ENABLE
+    static constexpr uint16_t kBatchBufferSize = 1024; ///< Size of buffer collecting batched property set entries.
+
+    bool     mBatchActive;                   ///< Whether a multi-set batch is being collected.
+    uint16_t mBatchLength;                   ///< Number of packed bytes in `mBatchBuffer`.
+    uint8_t  mBatchBuffer[kBatchBufferSize]; ///< Buffer collecting packed property set entries.
+#endif
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_STATE_SET_ENABLE
+    spinel_tid_t      mAsyncSetTid; ///< The transaction id of outstanding asynchronous set (zero if none).
+    spinel_prop_key_t mAsyncSetKey; ///< The property key of outstanding asynchronous set.
+#endif
+#if OPENTHREAD_SPINEL_CONFIG_FLOW_CONTROL_ENABLE
+    bool    mFlowControlEnabled; ///< Whether the RCP advertised `SPINEL_CAP_RCP_FLOW_CONTROL`.
+    uint8_t mTxCredits;          ///< Latest transmit frame buffer credit count reported by the RCP.
+#endif
     const char       *mPropertyFormat;  ///< The spinel property format of current transaction.
     va_list           mPropertyArgs;    ///< The arguments pack or unpack spinel property of current transaction.
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
@@ -1276,6 +1276,7 @@ enum
     SPINEL_CAP_RCP_MIN_HOST_API_VERSION = (SPINEL_CAP_RCP__BEGIN + 1),
     SPINEL_CAP_RCP_RESET_TO_BOOTLOADER  = (SPINEL_CAP_RCP__BEGIN + 2),
     SPINEL_CAP_RCP_LOG_CRASH_DUMP       = (SPINEL_CAP_RCP__BEGIN + 3),
+    SPINEL_CAP_RCP_FLOW_CONTROL         = (SPINEL_CAP_RCP__BEGIN + 4),
     SPINEL_CAP_RCP__END                 = 80,
 
     SPINEL_CAP_OPENTHREAD__BEGIN       = 512,
@@ -1296,6 +1297,7 @@ enum
     SPINEL_CAP_SRP_CLIENT              = (SPINEL_CAP_OPENTHREAD__BEGIN + 14),
     SPINEL_CAP_DUA                     = (SPINEL_CAP_OPENTHREAD__BEGIN + 15),
     SPINEL_CAP_REFERENCE_DEVICE        = (SPINEL_CAP_OPENTHREAD__BEGIN + 16),
+    SPINEL_CAP_PROP_STREAMING          = (SPINEL_CAP_OPENTHREAD__BEGIN + 17),
     SPINEL_CAP_OPENTHREAD__END         = 640,
 
     SPINEL_CAP_THREAD__BEGIN          = 1024,
@@ -2217,6 +2219,20 @@ enum
      */
     SPINEL_PROP_MAC_MAX_RETRY_NUMBER_INDIRECT = SPINEL_PROP_MAC_EXT__BEGIN + 11,
 
+    /// MAC Source Match Pending Filter
+    /** Format: `D`
+     *  Required Capability: SPINEL_CAP_MAC_RAW or SPINEL_CAP_CONFIG_RADIO
+     *
+     * A compact bitmap the radio consults while source matching is disabled
+     * (e.g., after the source match table overflows). The bit index for a
+     * data poll's source address is the sum of the address bytes modulo
+     * the number of bits in the filter. The radio sets the "frame pending"
+     * bit in the ack only when the corresponding bit is set in the filter,
+     * instead of setting it on all acks. Zero-length data removes the
+     * filter.
+     */
+    SPINEL_PROP_MAC_SRC_MATCH_PENDING_FILTER = SPINEL_PROP_MAC_EXT__BEGIN + 12,
+
     SPINEL_PROP_MAC_EXT__END = 0x1400,
 
     SPINEL_PROP_NET__BEGIN = 0x40,
@@ -4211,6 +4227,23 @@ enum
      */
     SPINEL_PROP_SRP_CLIENT_SERVICE_KEY_ENABLED = SPINEL_PROP_OPENTHREAD__BEGIN + 27,
 
+    /// Property Streaming Configuration
+    /** Format: `L` followed by zero or more packed property keys (`i`) : Read-Write
+     * Required capability: `SPINEL_CAP_PROP_STREAMING`
+     *
+     * The `L` value is the streaming interval in milliseconds (zero stops streaming and clears the
+     * registered set). The property keys that follow select the set of properties to stream. Setting
+     * this property replaces any previous subscription.
+     *
+     * On every interval the NCP pushes a single unsolicited `CMD_PROP_VALUES_ARE` frame (TID zero)
+     * containing one struct per registered property. Each struct holds the packed property key (`i`)
+     * followed by the current property value in the property's own format.
+     *
+     * Only properties supporting a "get" operation can be registered; registering an unsupported
+     * property key fails the whole set operation.
+     */
+    SPINEL_PROP_PROP_STREAM_CONFIG = SPINEL_PROP_OPENTHREAD__BEGIN + 28,
+
     SPINEL_PROP_OPENTHREAD__END = 0x2000,
 
     SPINEL_PROP_SERVER__BEGIN = 0xA0,
@@ -4293,6 +4326,30 @@ enum
      */
     SPINEL_PROP_RCP_LOG_CRASH_DUMP = SPINEL_PROP_RCP__BEGIN + 2,
 
+    /// RCP Frame Buffer Credits
+    /** Format: `C` - Read only
+     *
+     * Required capability: SPINEL_CAP_RADIO and SPINEL_CAP_RCP_FLOW_CONTROL.
+     *
+     * The number of `SPINEL_PROP_STREAM_RAW` transmit frames the RCP can accept at this moment. The RCP emits an
+     * unsolicited `CMD_PROP_VALUE_IS` update for this property whenever the count becomes non-zero again, allowing
+     * the host to apply backpressure while the RCP is busy instead of discovering a full buffer through a failed
+     * transmit.
+     */
+    SPINEL_PROP_RCP_FRAME_BUFFER_CREDITS = SPINEL_PROP_RCP__BEGIN + 3,
+
+    /// RCP Radio Time Statistics Sample
+    /** Format: `LLLL` - Unsolicited notifications only
+     *
+     * Required capability: SPINEL_CAP_RADIO.
+     *
+     * The RCP emits unsolicited `CMD_PROP_VALUE_IS` updates for this property carrying the durations (in
+     * microseconds) the radio spent in the transmit, receive, sleep, and disabled states since the previous
+     * update, as measured by the co-processor. The host merges the samples into its radio time statistics,
+     * superseding the host-side inference which cannot observe offloaded retries or CSL sampling.
+     */
+    SPINEL_PROP_RCP_TIME_STATS = SPINEL_PROP_RCP__BEGIN + 4,
+
     SPINEL_PROP_RCP__END = 0xFF,
 
     SPINEL_PROP_INTERFACE__BEGIN = 0x100,
@@ -4676,6 +4733,31 @@ enum
      */
     SPINEL_PROP_CNTR_MAC_RETRY_HISTOGRAM = SPINEL_PROP_CNTR__BEGIN + 404,
 
+    /// All counter groups captured with a single uptime stamp.
+    /** Format: `Xt(LL...)t(LL...)SSSSSSSSSt(LL)t(LL)` (read-only)
+     *
+     * The contents include:
+     *   'X': Timestamp (uptime in milliseconds at which the snapshot was captured).
+     * followed by the content of `SPINEL_PROP_CNTR_ALL_MAC_COUNTERS`, `SPINEL_PROP_CNTR_MLE_COUNTERS`, and
+     * `SPINEL_PROP_CNTR_ALL_IP_COUNTERS` (in that order).
+     *
+     * All counter groups are read within a single property get (with no event processing interleaved), so the
+     * reported values are mutually consistent and can be diffed safely against a previous snapshot.
+     */
+    SPINEL_PROP_CNTR_ALL_COUNTERS_SNAPSHOT = SPINEL_PROP_CNTR__BEGIN + 405,
+
+    /// Windowed rates of key MAC counters.
+    /** Format: `LLLLL` (read-only)
+     *
+     * The contents include (each an exponentially weighted moving average, in events per minute):
+     *   'L': TxTotal  (rate of transmissions).
+     *   'L': RxTotal  (rate of receptions).
+     *   'L': TxRetry  (rate of retransmissions).
+     *   'L': TxErrCca (rate of CCA failures).
+     *   'L': RxErrFcs (rate of FCS errors).
+     */
+    SPINEL_PROP_CNTR_COUNTER_RATES = SPINEL_PROP_CNTR__BEGIN + 406,
+
     SPINEL_PROP_CNTR__END = 0x800,
 
     SPINEL_PROP_RCP_EXT__BEGIN = 0x800,
@@ -5142,6 +5224,23 @@ enum
      */
     SPINEL_PROP_DEBUG_TREL_TEST_MODE_ENABLE = SPINEL_PROP_DEBUG__BEGIN + 4,
 
+    /// Per-property inbound frame counters
+    /** Format: `A(t(iL))` (read-only)
+     *
+     * An array of structs, one per property key seen in an inbound property command (get/set/insert/remove), each
+     * containing:
+     *
+     *   `i` : The property key.
+     *   `L` : The number of inbound property command frames received for this key.
+     *
+     * The NCP tracks a bounded number of distinct keys (first come, first served); commands for keys beyond the
+     * table capacity are not reported. The counters are cleared alongside the other NCP counters (i.e., when
+     * `SPINEL_PROP_CNTR_RESET` is set).
+     *
+     * This property is only available when `OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE` is enabled.
+     */
+    SPINEL_PROP_DEBUG_PROP_FRAME_COUNTERS = SPINEL_PROP_DEBUG__BEGIN + 5,
+
     SPINEL_PROP_DEBUG__END = 0x4400,
 
     SPINEL_PROP_EXPERIMENTAL__BEGIN = 2000000,
@@ -48,6 +48,9 @@ SpinelDriver::SpinelDriver(void)
     , mSpinelInterface(nullptr)
     , mWaitingKey(SPINEL_PROP_LAST_STATUS)
     , mIsWaitingForResponse(false)
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+    , mReceivedInitialKeys(0)
+#endif
     , mIid(SPINEL_HEADER_INVALID_IID)
     , mSpinelVersionMajor(-1)
     , mSpinelVersionMinor(-1)
@@ -84,9 +87,13 @@ CoprocessorType SpinelDriver::Init(SpinelInterface    &aSpinelInterface,
     mIid = aIidList[0];
 
     ResetCoprocessor(aSoftwareReset);
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+    SuccessOrDie(RetrieveInitialProperties());
+#else
     SuccessOrDie(CheckSpinelVersion());
     SuccessOrDie(GetCoprocessorVersion());
     SuccessOrDie(GetCoprocessorCaps());
+#endif
 
     coprocessorType = GetCoprocessorType();
     if (coprocessorType == OT_COPROCESSOR_UNKNOWN)
@@ -225,6 +232,32 @@ exit:
     return error;
 }
 
+otError SpinelDriver::SendCommand(uint32_t aCommand, spinel_tid_t aTid, const uint8_t *aPayload, uint16_t aPayloadLength)
+{
+    otError        error = OT_ERROR_NONE;
+    uint8_t        buffer[kMaxSpinelFrame];
+    spinel_ssize_t packed;
+    uint16_t       offset;
+
+    // Pack the header and command (no property key)
+    packed =
+        spinel_datatype_pack(buffer, sizeof(buffer), "Ci", SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid) | aTid, aCommand);
+
+    VerifyOrExit(packed > 0 && static_cast<size_t>(packed) <= sizeof(buffer), error = OT_ERROR_NO_BUFS);
+
+    offset = static_cast<uint16_t>(packed);
+    VerifyOrExit(static_cast<size_t>(offset) + aPayloadLength <= sizeof(buffer), error = OT_ERROR_NO_BUFS);
+
+    memcpy(buffer + offset, aPayload, aPayloadLength);
+    offset += aPayloadLength;
+
+    SuccessOrExit(error = mSpinelInterface->SendFrame(buffer, offset));
+    LogSpinelFrame(buffer, offset, true /* aTx */);
+
+exit:
+    return error;
+}
+
 otError SpinelDriver::SendCommand(uint32_t          aCommand,
                                   spinel_prop_key_t aKey,
                                   spinel_tid_t      aTid,
@@ -389,8 +422,15 @@ void SpinelDriver::HandleInitialFrame(const uint8_t *aFrame, uint16_t aLength, u
     }
     else
     {
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+        // Responses to the initial query burst can arrive ahead of their turn
+        // (a single interface read may deliver several frames); accept and
+        // record any of them. See `RetrieveInitialProperties()`.
+        VerifyOrExit(InitialKeyBit(key) != 0, error = OT_ERROR_DROP);
+#else
         // Drop other frames when the key isn't waiting key.
         VerifyOrExit(mWaitingKey == key, error = OT_ERROR_DROP);
+#endif
 
         if (key == SPINEL_PROP_PROTOCOL_VERSION)
         {
@@ -429,7 +469,16 @@ void SpinelDriver::HandleInitialFrame(const uint8_t *aFrame, uint16_t aLength, u
             }
         }
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+        mReceivedInitialKeys |= InitialKeyBit(key);
+
+        if (key == mWaitingKey)
+        {
+            mIsWaitingForResponse = false;
+        }
+#else
         mIsWaitingForResponse = false;
+#endif
     }
 
 exit:
@@ -485,6 +534,71 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+otError SpinelDriver::RetrieveInitialProperties(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    static const spinel_prop_key_t kKeys[] = {SPINEL_PROP_PROTOCOL_VERSION, SPINEL_PROP_NCP_VERSION, SPINEL_PROP_CAPS};
+
+    mReceivedInitialKeys = 0;
+
+    // Send all property GET commands in one burst and collect the responses
+    // together, so the probing costs a single link round trip instead of one
+    // blocking round trip per property.
+    for (spinel_prop_key_t key : kKeys)
+    {
+        SuccessOrExit(error = SendCommand(SPINEL_CMD_PROP_VALUE_GET, key, sTid));
+    }
+
+    for (spinel_prop_key_t key : kKeys)
+    {
+        if (mReceivedInitialKeys & InitialKeyBit(key))
+        {
+            continue;
+        }
+
+        mIsWaitingForResponse = true;
+        mWaitingKey           = key;
+
+        SuccessOrExit(error = WaitResponse());
+    }
+
+    if ((mSpinelVersionMajor != SPINEL_PROTOCOL_VERSION_THREAD_MAJOR) ||
+        (mSpinelVersionMinor != SPINEL_PROTOCOL_VERSION_THREAD_MINOR))
+    {
+        LogCrit("Spinel version mismatch - Posix:%d.%d, co-processor:%d.%d", SPINEL_PROTOCOL_VERSION_THREAD_MAJOR,
+                SPINEL_PROTOCOL_VERSION_THREAD_MINOR, mSpinelVersionMajor, mSpinelVersionMinor);
+        DieNow(OT_EXIT_RADIO_SPINEL_INCOMPATIBLE);
+    }
+
+exit:
+    return error;
+}
+
+uint8_t SpinelDriver::InitialKeyBit(spinel_prop_key_t aKey)
+{
+    uint8_t bit = 0;
+
+    switch (aKey)
+    {
+    case SPINEL_PROP_PROTOCOL_VERSION:
+        bit = 1 << 0;
+        break;
+    case SPINEL_PROP_NCP_VERSION:
+        bit = 1 << 1;
+        break;
+    case SPINEL_PROP_CAPS:
+        bit = 1 << 2;
+        break;
+    default:
+        break;
+    }
+
+    return bit;
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+
 CoprocessorType SpinelDriver::GetCoprocessorType(void)
 {
     CoprocessorType type = OT_COPROCESSOR_UNKNOWN;
@@ -178,6 +178,20 @@ public:
      */
     otError SendCommand(uint32_t aCommand, spinel_prop_key_t aKey, spinel_tid_t aTid);
 
+    /*
+     * Sends a spinel command with a pre-packed payload (and no property key) to the co-processor.
+     *
+     * @param[in] aCommand        The spinel command.
+     * @param[in] aTid            The spinel transaction id.
+     * @param[in] aPayload        A pointer to the packed command payload.
+     * @param[in] aPayloadLength  The command payload length (number of bytes).
+     *
+     * @retval  OT_ERROR_NONE           Successfully sent the command through spinel interface.
+     * @retval  OT_ERROR_INVALID_STATE  The spinel interface is in an invalid state.
+     * @retval  OT_ERROR_NO_BUFS        The spinel interface doesn't have enough buffer.
+     */
+    otError SendCommand(uint32_t aCommand, spinel_tid_t aTid, const uint8_t *aPayload, uint16_t aPayloadLength);
+
     /*
      * Sets the handler to process the received spinel frame.
      *
@@ -308,6 +322,10 @@ private:
     otError         CheckSpinelVersion(void);
     otError         GetCoprocessorVersion(void);
     otError         GetCoprocessorCaps(void);
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+    otError        RetrieveInitialProperties(void);
+    static uint8_t InitialKeyBit(spinel_prop_key_t aKey);
+#endif
     CoprocessorType GetCoprocessorType(void);
 
     void ProcessFrameQueue(void);
@@ -317,6 +335,9 @@ private:
 
     spinel_prop_key_t mWaitingKey; ///< The property key of current transaction.
     bool              mIsWaitingForResponse;
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_QUERY_ENABLE
+    uint8_t mReceivedInitialKeys; ///< Bitmask of initial burst properties already received.
+#endif
 
     spinel_iid_t                                mIid;
     Array<spinel_iid_t, kSpinelHeaderMaxNumIid> mIidList;
@@ -148,6 +148,7 @@ protected:
         kSpinelInterfaceTypeHdlc   = 1, ///< The type of Spinel HDLC interface.
         kSpinelInterfaceTypeSpi    = 2, ///< The type of Spinel SPI interface.
         kSpinelInterfaceTypeVendor = 3, ///< The type of Spinel Vendor interface.
+        kSpinelInterfaceTypeShmem  = 4, ///< The type of Spinel shared-memory interface.
     };
 
     /**
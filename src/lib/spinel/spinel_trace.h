@@ -0,0 +1,67 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the definitions of the spinel frame trace entry.
+ */
+
+#ifndef OT_LIB_SPINEL_SPINEL_TRACE_H_
+#define OT_LIB_SPINEL_SPINEL_TRACE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum
+{
+    OT_SPINEL_TRACE_DIR_RX = 0, ///< The frame was received from the co-processor.
+    OT_SPINEL_TRACE_DIR_TX = 1, ///< The frame was sent to the co-processor.
+};
+
+/**
+ * Represents one traced spinel frame.
+ */
+typedef struct otSpinelFrameTraceEntry
+{
+    uint64_t mTimestamp; ///< Monotonic timestamp when the frame was traced, in microseconds.
+    uint32_t mCommand;   ///< The spinel command.
+    uint32_t mPropKey;   ///< The spinel property key (zero when the command carries none).
+    uint16_t mLength;    ///< The frame length in bytes.
+    uint8_t  mTid;       ///< The spinel transaction id.
+    uint8_t  mDirection; ///< The frame direction (`OT_SPINEL_TRACE_DIR_*`).
+} otSpinelFrameTraceEntry;
+
+#ifdef __cplusplus
+} // end of extern "C"
+#endif
+
+#endif // OT_LIB_SPINEL_SPINEL_TRACE_H_
@@ -312,11 +312,19 @@ NcpBase::NcpBase(Instance *aInstance)
 #if OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
     , mSrpClientCallbackEnabled(false)
 #endif
+#if OPENTHREAD_CONFIG_NCP_PROP_STREAMING_ENABLE
+    , mPropStreamKeyCount(0)
+    , mPropStreamInterval(0)
+    , mPropStreamTimer(*aInstance, HandlePropStreamTimer, this)
+#endif
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
     , mFramingErrorCounter(0)
     , mRxSpinelFrameCounter(0)
     , mRxSpinelOutOfOrderTidCounter(0)
     , mTxSpinelFrameCounter(0)
+#if OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+    , mPropFrameKeyCount(0)
+#endif
     , mDidInitialUpdates(false)
     , mDatasetSendMgmtPendingSetResult(SPINEL_STATUS_OK)
     , mLogTimestampBase(0)
@@ -405,6 +413,10 @@ void NcpBase::ResetCounters(void)
     mRxSpinelOutOfOrderTidCounter = 0;
     mTxSpinelFrameCounter         = 0;
 
+#if OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+    mPropFrameKeyCount = 0;
+#endif
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     mInboundSecureIpFrameCounter    = 0;
     mInboundInsecureIpFrameCounter  = 0;
@@ -415,6 +427,31 @@ void NcpBase::ResetCounters(void)
 #endif
 }
 
+#if OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+void NcpBase::CountPropertyCommand(unsigned int aPropKey)
+{
+    uint8_t index;
+
+    for (index = 0; index < mPropFrameKeyCount; index++)
+    {
+        VerifyOrExit(mPropFrameKeys[index] != aPropKey);
+    }
+
+    // Keys beyond the table capacity are not tracked.
+    VerifyOrExit(index < kPropFrameCounterTableSize);
+
+    mPropFrameKeys[index]     = aPropKey;
+    mPropFrameCounters[index] = 0;
+    mPropFrameKeyCount++;
+
+exit:
+    if (index < mPropFrameKeyCount)
+    {
+        mPropFrameCounters[index]++;
+    }
+}
+#endif // OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+
 // ----------------------------------------------------------------------------
 // MARK: Serial Traffic Glue
 // ----------------------------------------------------------------------------
@@ -1009,6 +1046,12 @@ otError NcpBase::HandleCommand(uint8_t aHeader)
         error = CommandHandler_PROP_VALUE_update(aHeader, command);
         break;
 
+#if OPENTHREAD_CONFIG_NCP_MULTI_SET_ENABLE
+    case SPINEL_CMD_PROP_VALUE_MULTI_SET:
+        error = CommandHandler_PROP_VALUE_MULTI_SET(aHeader);
+        break;
+#endif
+
 #if OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
     case SPINEL_CMD_PEEK:
         error = CommandHandler_PEEK(aHeader);
@@ -1146,6 +1189,63 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_NCP_MULTI_SET_ENABLE
+otError NcpBase::CommandHandler_PROP_VALUE_MULTI_SET(uint8_t aHeader)
+{
+    otError error = OT_ERROR_NONE;
+
+    // The command payload is a sequence of structs, each containing a
+    // property key followed by the property value. The properties are
+    // applied in order, and the response (`CMD_PROP_VALUES_ARE`) carries
+    // one struct per property with the key and the resulting status.
+
+    SuccessOrExit(error = mEncoder.BeginFrame(aHeader, SPINEL_CMD_PROP_VALUES_ARE));
+
+    while (!mDecoder.IsAllReadInStruct())
+    {
+        unsigned int    propKey;
+        spinel_status_t status;
+        PropertyHandler handler;
+
+        SuccessOrExit(error = mDecoder.OpenStruct());
+        SuccessOrExit(error = mDecoder.ReadUintPacked(propKey));
+
+#if OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+        CountPropertyCommand(propKey);
+#endif
+
+        handler = FindSetPropertyHandler(static_cast<spinel_prop_key_t>(propKey));
+
+        if (handler != nullptr)
+        {
+            mDisableStreamWrite = false;
+            status              = ThreadErrorToSpinelStatus((this->*handler)());
+            mDisableStreamWrite = true;
+        }
+        else
+        {
+            // Properties that require special treatment (i.e., write their
+            // own response from the set handler) are not supported in a
+            // multi-set command.
+
+            status = SPINEL_STATUS_PROP_NOT_FOUND;
+        }
+
+        SuccessOrExit(error = mDecoder.CloseStruct());
+
+        SuccessOrExit(error = mEncoder.OpenStruct());
+        SuccessOrExit(error = mEncoder.WriteUintPacked(propKey));
+        SuccessOrExit(error = mEncoder.WriteUintPacked(status));
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
+
+    SuccessOrExit(error = mEncoder.EndFrame());
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_NCP_MULTI_SET_ENABLE
+
 otError NcpBase::HandleCommandPropertyInsertRemove(uint8_t aHeader, spinel_prop_key_t aKey, unsigned int aCommand)
 {
     otError         error           = OT_ERROR_NONE;
@@ -1360,6 +1460,10 @@ otError NcpBase::CommandHandler_PROP_VALUE_update(uint8_t aHeader, unsigned int
 
     VerifyOrExit(error == OT_ERROR_NONE, error = PrepareLastStatusResponse(aHeader, ThreadErrorToSpinelStatus(error)));
 
+#if OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+    CountPropertyCommand(propKey);
+#endif
+
     switch (aCommand)
     {
     case SPINEL_CMD_PROP_VALUE_GET:
@@ -2010,6 +2114,14 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CAPS>(void)
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_COUNTERS));
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_UNSOL_UPDATE_FILTER));
 
+#if OPENTHREAD_CONFIG_NCP_MULTI_SET_ENABLE
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_CMD_MULTI));
+#endif
+
+#if (OPENTHREAD_MTD || OPENTHREAD_FTD) && OPENTHREAD_CONFIG_NCP_PROP_STREAMING_ENABLE
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_PROP_STREAMING));
+#endif
+
 #if OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_MCU_POWER_STATE));
 #endif
@@ -2037,6 +2149,9 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CAPS>(void)
 #if OPENTHREAD_RADIO
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_RCP_API_VERSION));
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_RCP_MIN_HOST_API_VERSION));
+#if OPENTHREAD_CONFIG_NCP_RCP_FLOW_CONTROL_ENABLE
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_RCP_FLOW_CONTROL));
+#endif
 #endif
 
 #if OPENTHREAD_CONFIG_PLATFORM_BOOTLOADER_MODE_ENABLE
@@ -2660,6 +2775,24 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_DEBUG_LOG_TIMESTAMP_B
     return mEncoder.WriteUint64(mLogTimestampBase);
 }
 
+#if OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_DEBUG_PROP_FRAME_COUNTERS>(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (uint8_t index = 0; index < mPropFrameKeyCount; index++)
+    {
+        SuccessOrExit(error = mEncoder.OpenStruct());
+        SuccessOrExit(error = mEncoder.WriteUintPacked(mPropFrameKeys[index]));
+        SuccessOrExit(error = mEncoder.WriteUint32(mPropFrameCounters[index]));
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_PHY_CHAN_SUPPORTED>(void)
 {
 #if OPENTHREAD_RADIO
@@ -57,6 +57,7 @@
 
 #include "changed_props_set.hpp"
 #include "common/tasklet.hpp"
+#include "common/timer.hpp"
 #include "instance/instance.hpp"
 #include "lib/spinel/spinel.h"
 #include "lib/spinel/spinel_buffer.hpp"
@@ -151,6 +152,15 @@ public:
     void NotifySwitchoverDone(otInstance *aInstance, bool aSuccess);
 #endif
 
+#if OPENTHREAD_RADIO
+    /**
+     * Called to forward a platform-reported radio time statistics sample to the host.
+     *
+     * @param[in] aDurations  The durations spent in each radio state since the previous sample.
+     */
+    void RadioTimeStatsSample(const otRadioTimeStats &aDurations);
+#endif
+
     /**
      * This method returns the IID of the current spinel command.
      *
@@ -457,6 +467,10 @@ protected:
     static void LinkRawEnergyScanDone(otInstance *aInstance, int8_t aEnergyScanMaxRssi);
     void        LinkRawEnergyScanDone(uint8_t aIid, int8_t aEnergyScanMaxRssi);
 
+#if OPENTHREAD_RADIO && OPENTHREAD_CONFIG_NCP_RCP_FLOW_CONTROL_ENABLE
+    uint8_t GetTxFrameBufferCredits(void) const;
+#endif
+
     static inline uint8_t GetNcpBaseIid(otInstance *aInstance)
     {
         return sNcpInstance->InstanceToIid(static_cast<Instance *>(aInstance));
@@ -600,6 +614,9 @@ protected:
     otError CommandHandler_PEEK(uint8_t aHeader);
     otError CommandHandler_POKE(uint8_t aHeader);
 #endif
+#if OPENTHREAD_CONFIG_NCP_MULTI_SET_ENABLE
+    otError CommandHandler_PROP_VALUE_MULTI_SET(uint8_t aHeader);
+#endif
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     otError CommandHandler_NET_CLEAR(uint8_t aHeader);
 #endif
@@ -671,6 +688,10 @@ protected:
 
     void ResetCounters(void);
 
+#if OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+    void CountPropertyCommand(unsigned int aPropKey);
+#endif
+
     static uint8_t      ConvertLogLevel(otLogLevel aLogLevel);
     static unsigned int ConvertLogRegion(otLogRegion aLogRegion);
 
@@ -855,6 +876,21 @@ protected:
     bool mSrpClientCallbackEnabled;
 #endif // OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
 
+#if OPENTHREAD_CONFIG_NCP_PROP_STREAMING_ENABLE
+    static constexpr uint8_t  kPropStreamMaxProps    = 16;  // Max number of registered streamed properties.
+    static constexpr uint32_t kPropStreamMinInterval = 100; // Minimum streaming interval (in msec).
+
+    otError WritePropStreamFrame(void);
+
+    static void HandlePropStreamTimer(Timer &aTimer);
+    void        HandlePropStreamTimer(void);
+
+    spinel_prop_key_t mPropStreamKeys[kPropStreamMaxProps]; // Registered streamed property keys.
+    uint8_t           mPropStreamKeyCount;                  // Number of entries in use in `mPropStreamKeys`.
+    uint32_t          mPropStreamInterval;                  // Streaming interval (in msec), zero when disabled.
+    TimerMilliContext mPropStreamTimer;
+#endif
+
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 
     uint32_t mFramingErrorCounter;          // Number of improperly formed received spinel frames.
@@ -862,6 +898,14 @@ protected:
     uint32_t mRxSpinelOutOfOrderTidCounter; // Number of out of order received spinel frames (tid increase > 1).
     uint32_t mTxSpinelFrameCounter;         // Number of sent (outbound) spinel frames.
 
+#if OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+    static constexpr uint8_t kPropFrameCounterTableSize = 32;
+
+    unsigned int mPropFrameKeys[kPropFrameCounterTableSize];     // Property keys seen in inbound property commands.
+    uint32_t     mPropFrameCounters[kPropFrameCounterTableSize]; // Inbound property command count per tracked key.
+    uint8_t      mPropFrameKeyCount;                             // Number of entries in use in the arrays above.
+#endif
+
     bool mDidInitialUpdates;
 
     spinel_status_t mDatasetSendMgmtPendingSetResult;
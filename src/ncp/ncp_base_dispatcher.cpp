@@ -152,6 +152,9 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
 #if OPENTHREAD_RADIO
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_RCP_API_VERSION),
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_RCP_MIN_HOST_API_VERSION),
+#if OPENTHREAD_CONFIG_NCP_RCP_FLOW_CONTROL_ENABLE
+        OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_RCP_FRAME_BUFFER_CREDITS),
+#endif
 #endif
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_TOTAL),
@@ -205,6 +208,12 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
 #if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_MAC_RETRY_HISTOGRAM),
 #endif
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+        OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_ALL_COUNTERS_SNAPSHOT),
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE
+        OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_COUNTER_RATES),
+#endif
+#endif
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 #if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_RCP_TIMESTAMP),
@@ -390,6 +399,9 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_SRP_CLIENT_SERVICE_KEY_ENABLED),
 #endif
 #endif
+#if OPENTHREAD_CONFIG_NCP_PROP_STREAMING_ENABLE
+        OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_PROP_STREAM_CONFIG),
+#endif
 
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_DEBUG_TEST_ASSERT),
@@ -398,6 +410,9 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_DEBUG_LOG_TIMESTAMP_BASE),
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE && (OPENTHREAD_FTD || OPENTHREAD_MTD)
         OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_DEBUG_TREL_TEST_MODE_ENABLE),
+#endif
+#if OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+        OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_DEBUG_PROP_FRAME_COUNTERS),
 #endif
     };
 
@@ -599,6 +614,13 @@ NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
 #if OPENTHREAD_FTD
         OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_MAX_RETRY_NUMBER_INDIRECT),
 #endif
+#endif // OPENTHREAD_MTD || OPENTHREAD_FTD
+
+#if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
+        OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_SRC_MATCH_PENDING_FILTER),
+#endif
+
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
         OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_CHILD_TIMEOUT),
 #if OPENTHREAD_FTD
         OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ROUTER_UPGRADE_THRESHOLD),
@@ -703,6 +725,9 @@ NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
         OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_SRP_CLIENT_SERVICE_KEY_ENABLED),
 #endif
 #endif
+#if OPENTHREAD_CONFIG_NCP_PROP_STREAMING_ENABLE
+        OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_PROP_STREAM_CONFIG),
+#endif
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
         OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_DEBUG_NCP_LOG_LEVEL),
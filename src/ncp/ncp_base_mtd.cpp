@@ -42,6 +42,9 @@
 #endif
 #include <openthread/child_supervision.h>
 #include <openthread/cli.h>
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+#include <openthread/counters.h>
+#endif
 #include <openthread/diag.h>
 #include <openthread/icmp6.h>
 #if OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE
@@ -2977,6 +2980,46 @@ template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_ALL_IP_COUNTERS>
     return OT_ERROR_NONE;
 }
 
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_ALL_COUNTERS_SNAPSHOT>(void)
+{
+    otError           error = OT_ERROR_NONE;
+    otCounterSnapshot snapshot;
+
+    otCountersGetSnapshot(mInstance, &snapshot);
+
+    // The counter groups are encoded by delegating to the individual
+    // property getters. Since no event processing can interleave
+    // within this property get, the encoded values match the captured
+    // snapshot and are mutually consistent.
+
+    SuccessOrExit(error = mEncoder.WriteUint64(snapshot.mTimestamp));
+    SuccessOrExit(error = HandlePropertyGet<SPINEL_PROP_CNTR_ALL_MAC_COUNTERS>());
+    SuccessOrExit(error = HandlePropertyGet<SPINEL_PROP_CNTR_MLE_COUNTERS>());
+    SuccessOrExit(error = HandlePropertyGet<SPINEL_PROP_CNTR_ALL_IP_COUNTERS>());
+
+exit:
+    return error;
+}
+
+#if OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_COUNTER_RATES>(void)
+{
+    otError               error = OT_ERROR_NONE;
+    const otCounterRates *rates = otCountersGetRates(mInstance);
+
+    SuccessOrExit(error = mEncoder.WriteUint32(rates->mTxTotal));
+    SuccessOrExit(error = mEncoder.WriteUint32(rates->mRxTotal));
+    SuccessOrExit(error = mEncoder.WriteUint32(rates->mTxRetry));
+    SuccessOrExit(error = mEncoder.WriteUint32(rates->mTxErrCca));
+    SuccessOrExit(error = mEncoder.WriteUint32(rates->mRxErrFcs));
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_COUNTER_REGISTRY_RATES_ENABLE
+#endif // OPENTHREAD_CONFIG_COUNTER_REGISTRY_ENABLE
+
 #if OPENTHREAD_CONFIG_NCP_CLI_STREAM_ENABLE
 template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_STREAM_CLI>(void)
 {
@@ -4169,6 +4212,120 @@ exit:
 
 #endif // OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
 
+#if OPENTHREAD_CONFIG_NCP_PROP_STREAMING_ENABLE
+
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_PROP_STREAM_CONFIG>(void)
+{
+    otError error;
+
+    SuccessOrExit(error = mEncoder.WriteUint32(mPropStreamInterval));
+
+    for (uint8_t index = 0; index < mPropStreamKeyCount; index++)
+    {
+        SuccessOrExit(error = mEncoder.WriteUintPacked(mPropStreamKeys[index]));
+    }
+
+exit:
+    return error;
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_PROP_STREAM_CONFIG>(void)
+{
+    otError           error = OT_ERROR_NONE;
+    uint32_t          interval;
+    uint8_t           count = 0;
+    spinel_prop_key_t keys[kPropStreamMaxProps];
+
+    SuccessOrExit(error = mDecoder.ReadUint32(interval));
+
+    while (!mDecoder.IsAllReadInStruct())
+    {
+        unsigned int propKey;
+
+        SuccessOrExit(error = mDecoder.ReadUintPacked(propKey));
+
+        // Only properties with a "get" handler can be streamed.
+
+        VerifyOrExit(FindGetPropertyHandler(static_cast<spinel_prop_key_t>(propKey)) != nullptr,
+                     error = OT_ERROR_INVALID_ARGS);
+        VerifyOrExit(count < kPropStreamMaxProps, error = OT_ERROR_NO_BUFS);
+
+        keys[count++] = static_cast<spinel_prop_key_t>(propKey);
+    }
+
+    VerifyOrExit((interval == 0) || (count != 0), error = OT_ERROR_INVALID_ARGS);
+
+    // The new subscription replaces any previous one.
+
+    memcpy(mPropStreamKeys, keys, count * sizeof(keys[0]));
+    mPropStreamKeyCount = count;
+    mPropStreamInterval = (interval == 0) ? 0 : Max(interval, kPropStreamMinInterval);
+
+    if (mPropStreamInterval != 0)
+    {
+        mPropStreamTimer.Start(mPropStreamInterval);
+    }
+    else
+    {
+        mPropStreamTimer.Stop();
+        mPropStreamKeyCount = 0;
+    }
+
+exit:
+    return error;
+}
+
+otError NcpBase::WritePropStreamFrame(void)
+{
+    otError error  = OT_ERROR_NONE;
+    uint8_t header = SPINEL_HEADER_FLAG | SPINEL_HEADER_TX_NOTIFICATION_IID;
+
+    SuccessOrExit(error = mEncoder.BeginFrame(header, SPINEL_CMD_PROP_VALUES_ARE));
+
+    for (uint8_t index = 0; index < mPropStreamKeyCount; index++)
+    {
+        PropertyHandler handler = FindGetPropertyHandler(mPropStreamKeys[index]);
+
+        if (handler == nullptr)
+        {
+            continue;
+        }
+
+        SuccessOrExit(error = mEncoder.OpenStruct());
+        SuccessOrExit(error = mEncoder.WriteUintPacked(mPropStreamKeys[index]));
+        SuccessOrExit(error = (this->*handler)());
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
+
+    error = mEncoder.EndFrame();
+
+exit:
+    return error;
+}
+
+void NcpBase::HandlePropStreamTimer(Timer &aTimer)
+{
+    static_cast<NcpBase *>(static_cast<TimerMilliContext &>(aTimer).GetContext())->HandlePropStreamTimer();
+}
+
+void NcpBase::HandlePropStreamTimer(void)
+{
+    VerifyOrExit(mPropStreamInterval != 0);
+
+    // If the consolidated frame cannot be written (e.g., the NCP
+    // buffer is momentarily full), this interval's sample is dropped
+    // and streaming resumes on the next interval.
+
+    IgnoreError(WritePropStreamFrame());
+
+    mPropStreamTimer.Start(mPropStreamInterval);
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_NCP_PROP_STREAMING_ENABLE
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_DEBUG_TREL_TEST_MODE_ENABLE>(void)
 {
@@ -60,6 +60,30 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_RCP_MIN_HOST_API_VERS
 {
     return mEncoder.WriteUintPacked(SPINEL_MIN_HOST_SUPPORTED_RCP_API_VERSION);
 }
+
+#if OPENTHREAD_CONFIG_NCP_RCP_FLOW_CONTROL_ENABLE
+uint8_t NcpBase::GetTxFrameBufferCredits(void) const
+{
+    uint8_t credits = 1;
+
+    // The radio provides a single transmit slot, shared across the spinel interfaces.
+    for (uint8_t iid = 0; iid < kSpinelInterfaceCount; iid++)
+    {
+        if (mCurTransmitTID[iid] != 0)
+        {
+            credits = 0;
+            break;
+        }
+    }
+
+    return credits;
+}
+
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_RCP_FRAME_BUFFER_CREDITS>(void)
+{
+    return mEncoder.WriteUint8(GetTxFrameBufferCredits());
+}
+#endif // OPENTHREAD_CONFIG_NCP_RCP_FLOW_CONTROL_ENABLE
 #endif
 
 // ----------------------------------------------------------------------------
@@ -206,10 +230,47 @@ void NcpBase::LinkRawTransmitDone(uint8_t aIid, otRadioFrame *aFrame, otRadioFra
         SuccessOrExit(mEncoder.EndFrame());
     }
 
+#if OPENTHREAD_RADIO && OPENTHREAD_CONFIG_NCP_RCP_FLOW_CONTROL_ENABLE
+    // Announce the freed transmit slot, so that a host holding back frames due to backpressure can resume
+    // immediately.
+    SuccessOrExit(mEncoder.BeginFrame(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(aIid), SPINEL_CMD_PROP_VALUE_IS,
+                                      SPINEL_PROP_RCP_FRAME_BUFFER_CREDITS));
+    SuccessOrExit(mEncoder.WriteUint8(GetTxFrameBufferCredits()));
+    SuccessOrExit(mEncoder.EndFrame());
+#endif
+
 exit:
     return;
 }
 
+#if OPENTHREAD_RADIO
+extern "C" void otPlatRadioTimeStatsSample(otInstance *aInstance, const otRadioTimeStats *aDurations)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    NcpBase *ncpBase = NcpBase::GetNcpInstance();
+
+    if (ncpBase != nullptr)
+    {
+        ncpBase->RadioTimeStatsSample(*aDurations);
+    }
+}
+
+void NcpBase::RadioTimeStatsSample(const otRadioTimeStats &aDurations)
+{
+    SuccessOrExit(mEncoder.BeginFrame(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0, SPINEL_CMD_PROP_VALUE_IS,
+                                      SPINEL_PROP_RCP_TIME_STATS));
+    SuccessOrExit(mEncoder.WriteUint32(static_cast<uint32_t>(aDurations.mTxTime)));
+    SuccessOrExit(mEncoder.WriteUint32(static_cast<uint32_t>(aDurations.mRxTime)));
+    SuccessOrExit(mEncoder.WriteUint32(static_cast<uint32_t>(aDurations.mSleepTime)));
+    SuccessOrExit(mEncoder.WriteUint32(static_cast<uint32_t>(aDurations.mDisabledTime)));
+    SuccessOrExit(mEncoder.EndFrame());
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_RADIO
+
 void NcpBase::LinkRawEnergyScanDone(otInstance *aInstance, int8_t aEnergyScanMaxRssi)
 {
     sNcpInstance->LinkRawEnergyScanDone(GetNcpBaseIid(aInstance), aEnergyScanMaxRssi);
@@ -321,6 +382,20 @@ exit:
     return error;
 }
 
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SRC_MATCH_PENDING_FILTER>(void)
+{
+    otError        error = OT_ERROR_NONE;
+    const uint8_t *filter;
+    uint16_t       length;
+
+    SuccessOrExit(error = mDecoder.ReadData(filter, length));
+
+    error = otLinkRawSrcMatchSetPendingFilter(mInstance, filter, length);
+
+exit:
+    return error;
+}
+
 template <> otError NcpBase::HandlePropertyRemove<SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES>(void)
 {
     otError  error = OT_ERROR_NONE;
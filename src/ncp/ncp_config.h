@@ -130,6 +130,59 @@
 #define OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_MULTI_SET_ENABLE
+ *
+ * Define as 1 to enable the `CMD_PROP_VALUE_MULTI_SET` command on NCP.
+ *
+ * The command sets multiple properties with a single frame exchange, which reduces the number of round trips when
+ * the host replays its configuration (e.g., after a co-processor reset). When enabled, `SPINEL_CAP_CMD_MULTI` is
+ * included in the capability list.
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_MULTI_SET_ENABLE
+#define OPENTHREAD_CONFIG_NCP_MULTI_SET_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+ *
+ * Define as 1 to enable per-property frame counters on NCP.
+ *
+ * The NCP tracks how many inbound property commands (get/set/insert/remove) it has received for each property key.
+ * The counters can be read through the `SPINEL_PROP_DEBUG_PROP_FRAME_COUNTERS` property and are intended for
+ * identifying which properties dominate the host-NCP traffic. This is intended for debugging.
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE
+#define OPENTHREAD_CONFIG_NCP_PROP_FRAME_COUNTERS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_PROP_STREAMING_ENABLE
+ *
+ * Define as 1 to enable periodic property streaming on NCP.
+ *
+ * The host registers a set of property keys and an interval through the `SPINEL_PROP_PROP_STREAM_CONFIG` property,
+ * and the NCP pushes a single consolidated unsolicited `CMD_PROP_VALUES_ARE` frame per interval instead of the host
+ * polling each property with its own round trip. When enabled, `SPINEL_CAP_PROP_STREAMING` is included in the
+ * capability list. Applicable to MTD/FTD builds only.
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_PROP_STREAMING_ENABLE
+#define OPENTHREAD_CONFIG_NCP_PROP_STREAMING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_RCP_FLOW_CONTROL_ENABLE
+ *
+ * Define as 1 to enable transmit flow control on RCP.
+ *
+ * The RCP exposes the number of `SPINEL_PROP_STREAM_RAW` transmit frames it can accept through the
+ * `SPINEL_PROP_RCP_FRAME_BUFFER_CREDITS` property and announces the freed transmit slot with an unsolicited update
+ * when a transmit completes. When enabled, `SPINEL_CAP_RCP_FLOW_CONTROL` is included in the capability list.
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_RCP_FLOW_CONTROL_ENABLE
+#define OPENTHREAD_CONFIG_NCP_RCP_FLOW_CONTROL_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE
  *
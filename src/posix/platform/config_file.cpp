@@ -45,12 +45,15 @@ namespace Posix {
 
 ConfigFile::ConfigFile(const char *aFilePath) { SetFilePath(aFilePath); }
 
+ConfigFile::~ConfigFile(void) { ClearCache(); }
+
 void ConfigFile::SetFilePath(const char *aFilePath)
 {
     assert(aFilePath != nullptr);
     VerifyOrDie(strlen(aFilePath) + strlen(kSwapSuffix) < kFilePathMaxSize, OT_EXIT_FAILURE);
     strncpy(mFilePath, aFilePath, kFilePathMaxSize - 1);
     mFilePath[kFilePathMaxSize - 1] = '\0';
+    mCacheValid                     = false;
 }
 
 bool ConfigFile::HasKey(const char *aKey) const
@@ -64,19 +67,83 @@ bool ConfigFile::DoesExist(void) const { return (access(mFilePath, 0) == 0); }
 
 otError ConfigFile::Get(const char *aKey, int &aIterator, char *aValue, int aValueLength) const
 {
-    otError  error = OT_ERROR_NONE;
-    char     line[kLineMaxSize + 1];
-    FILE    *fp = nullptr;
-    char    *ret;
-    char    *psave;
-    long int pos;
+    otError error = OT_ERROR_NOT_FOUND;
 
     VerifyOrExit(aKey != nullptr, error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit((fp = fopen(mFilePath, "r")) != nullptr, error = OT_ERROR_NOT_FOUND);
-    VerifyOrDie(fseek(fp, aIterator, SEEK_SET) == 0, OT_EXIT_ERROR_ERRNO);
+    VerifyOrExit(aIterator >= 0);
+
+    RefreshCache();
+
+    {
+        int index = 0;
+
+        for (const Entry *entry = mEntries; entry != nullptr; entry = entry->mNext, index++)
+        {
+            if ((index < aIterator) || (strcmp(aKey, entry->mKey) != 0))
+            {
+                continue;
+            }
+
+            if (aValue != nullptr)
+            {
+                aValueLength = OT_MIN(static_cast<int>(strlen(entry->mValue)), (aValueLength - 1));
+                memcpy(aValue, entry->mValue, static_cast<size_t>(aValueLength));
+                aValue[aValueLength] = '\0';
+            }
 
-    while ((ret = fgets(line, sizeof(line), fp)) != nullptr)
+            aIterator = index + 1;
+            error     = OT_ERROR_NONE;
+            break;
+        }
+    }
+
+exit:
+    return error;
+}
+
+void ConfigFile::ClearCache(void) const
+{
+    Entry *entry = mEntries;
+
+    while (entry != nullptr)
     {
+        Entry *next = entry->mNext;
+
+        free(entry->mKey);
+        free(entry->mValue);
+        free(entry);
+        entry = next;
+    }
+
+    mEntries    = nullptr;
+    mCacheValid = false;
+}
+
+void ConfigFile::RefreshCache(void) const
+{
+    char        line[kLineMaxSize + 1];
+    FILE       *fp   = nullptr;
+    Entry     **tail = &mEntries;
+    struct stat st;
+    bool        exists = (stat(mFilePath, &st) == 0);
+
+    // Reparse only when the file identity changed since the cache was built.
+    if (mCacheValid && ((exists && st.st_mtime == mCacheMTime && st.st_size == mCacheSize) ||
+                        (!exists && mCacheSize == -1)))
+    {
+        ExitNow();
+    }
+
+    ClearCache();
+    mCacheValid = true;
+    mCacheMTime = exists ? st.st_mtime : 0;
+    mCacheSize  = exists ? st.st_size : -1;
+
+    VerifyOrExit(exists && ((fp = fopen(mFilePath, "r")) != nullptr));
+
+    while (fgets(line, sizeof(line), fp) != nullptr)
+    {
+        char *psave;
         char *str;
         char *key;
         char *value;
@@ -97,36 +164,28 @@ otError ConfigFile::Get(const char *aKey, int &aIterator, char *aValue, int aVal
             continue;
         }
 
-        *str = '\0';
-        key  = line;
+        *str  = '\0';
+        key   = line;
+        value = str + 1;
 
         Strip(key);
+        Strip(value);
 
-        if (strcmp(aKey, key) == 0)
-        {
-            if (aValue != nullptr)
-            {
-                value = str + 1;
-                Strip(value);
-                aValueLength = OT_MIN(static_cast<int>(strlen(value)), (aValueLength - 1));
-                memcpy(aValue, value, static_cast<size_t>(aValueLength));
-                aValue[aValueLength] = '\0';
-            }
-            break;
-        }
-    }
+        Entry *entry;
+
+        VerifyOrDie((entry = static_cast<Entry *>(calloc(1, sizeof(Entry)))) != nullptr, OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie((entry->mKey = strdup(key)) != nullptr, OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie((entry->mValue = strdup(value)) != nullptr, OT_EXIT_ERROR_ERRNO);
 
-    VerifyOrExit(ret != nullptr, error = OT_ERROR_NOT_FOUND);
-    VerifyOrDie((pos = ftell(fp)) >= 0, OT_EXIT_ERROR_ERRNO);
-    aIterator = static_cast<int>(pos);
+        *tail = entry;
+        tail  = &entry->mNext;
+    }
 
 exit:
     if (fp != nullptr)
     {
         fclose(fp);
     }
-
-    return error;
 }
 
 otError ConfigFile::Add(const char *aKey, const char *aValue)
@@ -149,6 +208,8 @@ otError ConfigFile::Add(const char *aKey, const char *aValue)
     VerifyOrDie((fp = fopen(mFilePath, "at")) != NULL, OT_EXIT_ERROR_ERRNO);
     VerifyOrDie(fprintf(fp, "%s=%s\n", aKey, aValue) > 0, OT_EXIT_ERROR_ERRNO);
 
+    mCacheValid = false;
+
 exit:
     if (fp != nullptr)
     {
@@ -208,6 +269,7 @@ exit:
     if (error == OT_ERROR_NONE)
     {
         VerifyOrDie(rename(swapFile, mFilePath) == 0, OT_EXIT_ERROR_ERRNO);
+        mCacheValid = false;
     }
 
     return error;
@@ -32,6 +32,7 @@
 #include <assert.h>
 #include <limits.h>
 #include <stdint.h>
+#include <sys/types.h>
 #include <openthread/error.h>
 
 namespace ot {
@@ -50,6 +51,11 @@ public:
      */
     explicit ConfigFile(const char *aFilePath);
 
+    /**
+     * Frees the cached configuration entries.
+     */
+    ~ConfigFile(void);
+
     /**
      * Sets the configuration file path.
      *
@@ -125,9 +131,26 @@ private:
     static constexpr uint16_t kLineMaxSize      = 512;
     static constexpr uint16_t kFilePathMaxSize  = PATH_MAX;
 
+    struct Entry
+    {
+        char  *mKey;
+        char  *mValue;
+        Entry *mNext;
+    };
+
     void Strip(char *aString) const;
+    void RefreshCache(void) const;
+    void ClearCache(void) const;
 
     char mFilePath[kFilePathMaxSize];
+
+    // The file is parsed once into the `mEntries` list (heap-allocated, kept in file order) and subsequent
+    // lookups are served from memory. The cache is invalidated by `Add()`/`Clear()`/`SetFilePath()` and
+    // re-validated against the file mtime/size so that external modifications are still picked up.
+    mutable Entry *mEntries    = nullptr;
+    mutable bool   mCacheValid = false;
+    mutable time_t mCacheMTime = 0;
+    mutable off_t  mCacheSize  = -1;
 };
 
 } // namespace Posix
@@ -73,6 +73,13 @@ typedef char(Filename)[sizeof(sockaddr_un::sun_path)];
 
 const char Daemon::kLogModuleName[] = "Daemon";
 
+#if OPENTHREAD_POSIX_CONFIG_DAEMON_FRAMED_OUTPUT_ENABLE
+// A client opts in to framed output by sending this sequence as its first bytes after connecting. The leading
+// control byte ensures the sequence can never be produced by a text CLI client.
+static const uint8_t kFramedModeRequest[] = {0x01, 'O', 'T', 'F', '1'};
+static const uint8_t kFramedModeAck[]     = {'O', 'T', 'F', '1'};
+#endif
+
 int Daemon::OutputFormat(const char *aFormat, ...)
 {
     int     ret;
@@ -105,6 +112,14 @@ int Daemon::OutputFormatV(const char *aFormat, va_list aArguments)
 
     VerifyOrExit(mSessionSocket != -1);
 
+#if OPENTHREAD_POSIX_CONFIG_DAEMON_FRAMED_OUTPUT_ENABLE
+    if (mFramedOutput)
+    {
+        AppendFrame(reinterpret_cast<uint8_t *>(buf), static_cast<uint16_t>(rval));
+        ExitNow();
+    }
+#endif
+
 #ifdef __linux__
     // Don't die on SIGPIPE
     rval = send(mSessionSocket, buf, static_cast<size_t>(rval), MSG_NOSIGNAL);
@@ -123,6 +138,57 @@ exit:
     return rval;
 }
 
+#if OPENTHREAD_POSIX_CONFIG_DAEMON_FRAMED_OUTPUT_ENABLE
+
+void Daemon::AppendFrame(const uint8_t *aData, uint16_t aLength)
+{
+    static_assert(OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH + kFrameHeaderSize <= kFrameBufferSize,
+                  "kFrameBufferSize cannot hold a full CLI output line!");
+
+    if (static_cast<uint32_t>(mFrameBufferLength) + kFrameHeaderSize + aLength > kFrameBufferSize)
+    {
+        FlushFrames();
+    }
+
+    VerifyOrExit(mSessionSocket != -1);
+
+    mFrameBuffer[mFrameBufferLength++] = static_cast<uint8_t>(aLength & 0xff);
+    mFrameBuffer[mFrameBufferLength++] = static_cast<uint8_t>(aLength >> 8);
+    memcpy(&mFrameBuffer[mFrameBufferLength], aData, aLength);
+    mFrameBufferLength += aLength;
+
+exit:
+    return;
+}
+
+void Daemon::FlushFrames(void)
+{
+    ssize_t rval;
+
+    VerifyOrExit((mFrameBufferLength > 0) && (mSessionSocket != -1));
+
+#ifdef __linux__
+    // Don't die on SIGPIPE
+    rval = send(mSessionSocket, mFrameBuffer, mFrameBufferLength, MSG_NOSIGNAL);
+#else
+    rval = write(mSessionSocket, mFrameBuffer, mFrameBufferLength);
+#endif
+
+    if (rval < 0)
+    {
+        LogWarn("Failed to write framed CLI output: %s", strerror(errno));
+        close(mSessionSocket);
+        mSessionSocket = -1;
+    }
+
+    mFrameBufferLength = 0;
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_DAEMON_FRAMED_OUTPUT_ENABLE
+
 void Daemon::InitializeSessionSocket(void)
 {
     int newSessionSocket;
@@ -155,6 +221,11 @@ void Daemon::InitializeSessionSocket(void)
     }
     mSessionSocket = newSessionSocket;
 
+#if OPENTHREAD_POSIX_CONFIG_DAEMON_FRAMED_OUTPUT_ENABLE
+    mFramedOutput      = false;
+    mFrameBufferLength = 0;
+#endif
+
 exit:
     if (rval == -1)
     {
@@ -331,6 +402,12 @@ void Daemon::TearDown(void)
 
 void Daemon::Update(Mainloop::Context &aContext)
 {
+#if OPENTHREAD_POSIX_CONFIG_DAEMON_FRAMED_OUTPUT_ENABLE
+    // `Update()` runs after all event processing and right before the mainloop blocks, so flushing here batches
+    // every record accumulated during the iteration into a single write.
+    FlushFrames();
+#endif
+
     Mainloop::AddToReadFdSet(mListenSocket, aContext);
     Mainloop::AddToErrorFdSet(mListenSocket, aContext);
 
@@ -369,6 +446,19 @@ void Daemon::Process(const Mainloop::Context &aContext)
 
         if (rval > 0)
         {
+#if OPENTHREAD_POSIX_CONFIG_DAEMON_FRAMED_OUTPUT_ENABLE
+            if (!mFramedOutput && (static_cast<size_t>(rval) >= sizeof(kFramedModeRequest)) &&
+                (memcmp(buffer, kFramedModeRequest, sizeof(kFramedModeRequest)) == 0))
+            {
+                mFramedOutput = true;
+                AppendFrame(kFramedModeAck, sizeof(kFramedModeAck));
+
+                rval -= static_cast<ssize_t>(sizeof(kFramedModeRequest));
+                memmove(buffer, &buffer[sizeof(kFramedModeRequest)], static_cast<size_t>(rval));
+                VerifyOrExit(rval > 0);
+            }
+#endif
+
             buffer[rval] = '\0';
 #if OPENTHREAD_POSIX_CONFIG_DAEMON_CLI_ENABLE
             otCliInputLine(reinterpret_cast<char *>(buffer));
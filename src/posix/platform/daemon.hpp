@@ -31,6 +31,7 @@
 #include "openthread-posix-config.h"
 
 #include <stdarg.h>
+#include <stdint.h>
 
 #include <openthread/platform/toolchain.h>
 
@@ -60,9 +61,23 @@ private:
     void createListenSocketOrDie(void);
     void InitializeSessionSocket(void);
 
+#if OPENTHREAD_POSIX_CONFIG_DAEMON_FRAMED_OUTPUT_ENABLE
+    static constexpr uint16_t kFrameHeaderSize = 2;
+    static constexpr uint16_t kFrameBufferSize = 2048;
+
+    void AppendFrame(const uint8_t *aData, uint16_t aLength);
+    void FlushFrames(void);
+#endif
+
     int mListenSocket  = -1;
     int mDaemonLock    = -1;
     int mSessionSocket = -1;
+
+#if OPENTHREAD_POSIX_CONFIG_DAEMON_FRAMED_OUTPUT_ENABLE
+    bool     mFramedOutput      = false;
+    uint16_t mFrameBufferLength = 0;
+    uint8_t  mFrameBuffer[kFrameBufferSize];
+#endif
 };
 
 } // namespace Posix
@@ -48,6 +48,7 @@
 
 #include "lib/spinel/coprocessor_type.h"
 #include "lib/spinel/radio_spinel_metrics.h"
+#include "lib/spinel/spinel_trace.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -242,6 +243,18 @@ const otRadioSpinelMetrics *otSysGetRadioSpinelMetrics(void);
  */
 const otRcpInterfaceMetrics *otSysGetRcpInterfaceMetrics(void);
 
+/**
+ * Drains the oldest entries from the spinel frame trace ring buffer.
+ *
+ * Frames are traced only when `OPENTHREAD_SPINEL_CONFIG_TRACE_ENABLE` is set; otherwise this function returns zero.
+ *
+ * @param[out] aEntries     A pointer to the buffer to copy the trace entries into.
+ * @param[in]  aMaxEntries  The maximum number of entries to copy.
+ *
+ * @returns The number of entries copied into @p aEntries.
+ */
+uint16_t otSysSpinelTraceRead(otSpinelFrameTraceEntry *aEntries, uint16_t aMaxEntries);
+
 /**
  * Returns the ifr_flags of the infrastructure network interface.
  *
@@ -104,9 +104,11 @@ void MulticastRoutingManager::HandleBackboneMulticastListenerEvent(otBackboneRou
     switch (aEvent)
     {
     case OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ADDED:
+        AddListenerToCache(aAddress);
         Add(aAddress);
         break;
     case OT_BACKBONE_ROUTER_MULTICAST_LISTENER_REMOVED:
+        RemoveListenerFromCache(aAddress);
         Remove(aAddress);
         break;
     }
@@ -179,6 +181,16 @@ bool MulticastRoutingManager::HasMulticastListener(const Ip6::Address &aAddress)
     otBackboneRouterMulticastListenerIterator iter  = OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ITERATOR_INIT;
     otBackboneRouterMulticastListenerInfo     listenerInfo;
 
+    if (mListenerCacheValid)
+    {
+        for (uint16_t i = 0; i < mListenedGroupCount; i++)
+        {
+            VerifyOrExit(mListenedGroups[i] != aAddress, found = true);
+        }
+
+        ExitNow();
+    }
+
     while (otBackboneRouterMulticastListenerGetNext(gInstance, &iter, &listenerInfo) == OT_ERROR_NONE)
     {
         VerifyOrExit(static_cast<const Ip6::Address &>(listenerInfo.mAddress) != aAddress, found = true);
@@ -188,6 +200,45 @@ exit:
     return found;
 }
 
+void MulticastRoutingManager::AddListenerToCache(const Ip6::Address &aAddress)
+{
+    VerifyOrExit(mListenerCacheValid);
+
+    for (uint16_t i = 0; i < mListenedGroupCount; i++)
+    {
+        VerifyOrExit(mListenedGroups[i] != aAddress);
+    }
+
+    if (mListenedGroupCount < kMulticastListenerCacheSize)
+    {
+        mListenedGroups[mListenedGroupCount++] = aAddress;
+    }
+    else
+    {
+        mListenerCacheValid = false;
+    }
+
+exit:
+    return;
+}
+
+void MulticastRoutingManager::RemoveListenerFromCache(const Ip6::Address &aAddress)
+{
+    VerifyOrExit(mListenerCacheValid);
+
+    for (uint16_t i = 0; i < mListenedGroupCount; i++)
+    {
+        if (mListenedGroups[i] == aAddress)
+        {
+            mListenedGroups[i] = mListenedGroups[--mListenedGroupCount];
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
 void MulticastRoutingManager::Update(Mainloop::Context &aContext)
 {
     VerifyOrExit(IsEnabled());
@@ -410,13 +461,21 @@ void MulticastRoutingManager::ExpireMulticastForwardingCache(void)
 
     for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
     {
-        if (mfc.IsValid() && mfc.mLastUseTime + kMulticastForwardingCacheExpireTimeout * OT_US_PER_S < now)
+        bool updated;
+
+        if (!mfc.IsValid())
         {
-            if (!UpdateMulticastRouteInfo(mfc))
-            {
-                // The multicast route is expired
-                RemoveMulticastForwardingCache(mfc);
-            }
+            continue;
+        }
+
+        // Refresh the kernel packet/byte counters for every valid entry so the
+        // dump below reflects which groups actually carry traffic.
+        updated = UpdateMulticastRouteInfo(mfc);
+
+        if (!updated && (mfc.mLastUseTime + kMulticastForwardingCacheExpireTimeout * OT_US_PER_S < now))
+        {
+            // The multicast route is expired
+            RemoveMulticastForwardingCache(mfc);
         }
     }
 
@@ -444,6 +503,8 @@ bool MulticastRoutingManager::UpdateMulticastRouteInfo(MulticastForwardingCache
                 aMfc.mSrcAddr.ToString().AsCString(), aMfc.mGroupAddr.ToString().AsCString(), sioc_sg_req6.bytecnt,
                 sioc_sg_req6.pktcnt, sioc_sg_req6.wrong_if);
 
+        aMfc.mByteCnt = sioc_sg_req6.bytecnt;
+
         validPktCnt = sioc_sg_req6.pktcnt - sioc_sg_req6.wrong_if;
         if (validPktCnt != aMfc.mValidPktCnt)
         {
@@ -490,8 +551,9 @@ void MulticastRoutingManager::DumpMulticastForwardingCache(void) const
     {
         if (mfc.IsValid())
         {
-            LogDebg("%s %s => %s %s", MifIndexToString(mfc.mIif), mfc.mSrcAddr.ToString().AsCString(),
-                    mfc.mGroupAddr.ToString().AsCString(), MifIndexToString(mfc.mOif));
+            LogDebg("%s %s => %s %s (pktcnt=%lu, bytecnt=%lu)", MifIndexToString(mfc.mIif),
+                    mfc.mSrcAddr.ToString().AsCString(), mfc.mGroupAddr.ToString().AsCString(),
+                    MifIndexToString(mfc.mOif), mfc.mValidPktCnt, mfc.mByteCnt);
         }
     }
 
@@ -524,6 +586,7 @@ void MulticastRoutingManager::MulticastForwardingCache::Set(MulticastRoutingMana
     mIif         = aIif;
     mOif         = aOif;
     mValidPktCnt = 0;
+    mByteCnt     = 0;
     mLastUseTime = otPlatTimeGet();
 }
 
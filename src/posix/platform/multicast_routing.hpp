@@ -58,6 +58,8 @@ public:
 
         : mLastExpireTime(0)
         , mMulticastRouterSock(-1)
+        , mListenedGroupCount(0)
+        , mListenerCacheValid(true)
     {
     }
 
@@ -73,6 +75,7 @@ private:
     static constexpr uint16_t kMulticastForwardingCacheExpiringInterval = 60;  //< Expire interval (in seconds)
     static constexpr uint16_t kMulticastForwardingCacheTableSize =
         OPENTHREAD_POSIX_CONFIG_MAX_MULTICAST_FORWARDING_CACHE_TABLE;
+    static constexpr uint16_t kMulticastListenerCacheSize = 75; //< Matches the core BBR listener table default size.
 
     enum MifIndex : uint8_t
     {
@@ -101,6 +104,7 @@ private:
         Ip6::Address  mGroupAddr;
         uint64_t      mLastUseTime;
         unsigned long mValidPktCnt;
+        unsigned long mByteCnt;
         MifIndex      mIif;
         MifIndex      mOif;
     };
@@ -111,6 +115,8 @@ private:
     void    Remove(const Ip6::Address &aAddress);
     void    UpdateMldReport(const Ip6::Address &aAddress, bool isAdd);
     bool    HasMulticastListener(const Ip6::Address &aAddress) const;
+    void    AddListenerToCache(const Ip6::Address &aAddress);
+    void    RemoveListenerFromCache(const Ip6::Address &aAddress);
     void    InitMulticastRouterSock(void);
     void    FinalizeMulticastRouterSock(void);
     void    ProcessMulticastRouterMessages(void);
@@ -135,6 +141,13 @@ private:
     MulticastForwardingCache mMulticastForwardingCacheTable[kMulticastForwardingCacheTableSize];
     uint64_t                 mLastExpireTime;
     int                      mMulticastRouterSock;
+
+    // Local mirror of the multicast listener groups, maintained from the BBR listener events so that `NOCACHE`
+    // upcalls need not iterate the core listener table. If the mirror ever overflows it is marked invalid and
+    // `HasMulticastListener()` falls back to the core table walk.
+    Ip6::Address mListenedGroups[kMulticastListenerCacheSize];
+    uint16_t     mListenedGroupCount;
+    bool         mListenerCacheValid;
 };
 
 } // namespace Posix
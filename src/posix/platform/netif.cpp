@@ -287,7 +287,8 @@ enum
 };
 #endif
 
-static constexpr size_t kMaxIp6Size = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr size_t  kMaxIp6Size     = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr uint8_t kTunTxBatchSize = OPENTHREAD_POSIX_CONFIG_NETIF_TUN_TX_BATCH_SIZE;
 #if defined(RTM_NEWLINK) && defined(RTM_DELLINK)
 static bool sIsSyncingState = false;
 #endif
@@ -1229,34 +1230,27 @@ exit:
 }
 #endif // __linux__
 
-static void processTransmit(otInstance *aInstance)
+static void processTransmitPacket(otInstance *aInstance, char *aPacket, size_t aLength)
 {
     otMessage *message = nullptr;
-    ssize_t    rval;
-    char       packet[kMaxIp6Size];
-    otError    error  = OT_ERROR_NONE;
-    size_t     offset = 0;
+    otError    error   = OT_ERROR_NONE;
+    size_t     offset  = 0;
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE && OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     bool isIp4 = false;
 #endif
 
-    assert(gInstance == aInstance);
-
-    rval = read(sTunFd, packet, sizeof(packet));
-    VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
-
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers have (for legacy reasons), may have a 4-byte header on them
-    if ((rval >= 4) && (packet[0] == 0) && (packet[1] == 0))
+    if ((aLength >= 4) && (aPacket[0] == 0) && (aPacket[1] == 0))
     {
-        rval -= 4;
+        aLength -= 4;
         offset = 4;
     }
 #endif
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE && OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE && \
     !OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_CLIENT_ENABLE
-    if (tryProcessIcmp6RaMessage(aInstance, reinterpret_cast<uint8_t *>(&packet[offset]), rval) == OT_ERROR_NONE)
+    if (tryProcessIcmp6RaMessage(aInstance, reinterpret_cast<uint8_t *>(&aPacket[offset]), aLength) == OT_ERROR_NONE)
     {
         ExitNow();
     }
@@ -1268,7 +1262,7 @@ static void processTransmit(otInstance *aInstance)
         settings.mLinkSecurityEnabled = (otThreadGetDeviceRole(aInstance) != OT_DEVICE_ROLE_DISABLED);
         settings.mPriority            = OT_MESSAGE_PRIORITY_LOW;
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
-        isIp4   = (getIpVersion(reinterpret_cast<uint8_t *>(&packet[offset])) == kIpVersion4);
+        isIp4   = (getIpVersion(reinterpret_cast<uint8_t *>(&aPacket[offset])) == kIpVersion4);
         message = isIp4 ? otIp4NewMessage(aInstance, &settings) : otIp6NewMessage(aInstance, &settings);
 #else
         message = otIp6NewMessage(aInstance, &settings);
@@ -1278,11 +1272,11 @@ static void processTransmit(otInstance *aInstance)
     }
 
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
-    LogInfo("Packet to NCP (%hu bytes)", static_cast<uint16_t>(rval));
-    otDumpInfoPlat("", &packet[offset], static_cast<size_t>(rval));
+    LogInfo("Packet to NCP (%hu bytes)", static_cast<uint16_t>(aLength));
+    otDumpInfoPlat("", &aPacket[offset], aLength);
 #endif
 
-    SuccessOrExit(error = otMessageAppend(message, &packet[offset], static_cast<uint16_t>(rval)));
+    SuccessOrExit(error = otMessageAppend(message, &aPacket[offset], static_cast<uint16_t>(aLength)));
 
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     error = isIp4 ? otNat64Send(aInstance, message) : otIp6Send(aInstance, message);
@@ -1310,6 +1304,32 @@ exit:
     }
 }
 
+static void processTransmit(otInstance *aInstance)
+{
+    char packet[kMaxIp6Size];
+
+    assert(gInstance == aInstance);
+
+    // Drain up to `kTunTxBatchSize` packets per mainloop wakeup to amortize the poll/select round trip across a
+    // batch. The tun fd is non-blocking, so the loop ends as soon as its queue empties.
+    for (uint8_t count = 0; count < kTunTxBatchSize; count++)
+    {
+        ssize_t rval = read(sTunFd, packet, sizeof(packet));
+
+        if (rval <= 0)
+        {
+            if ((rval < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+            {
+                LogWarn("Failed to read from tun, error:%s", strerror(errno));
+            }
+
+            break;
+        }
+
+        processTransmitPacket(aInstance, packet, static_cast<size_t>(rval));
+    }
+}
+
 static void logAddrEvent(bool isAdd, const otIp6Address &aAddress, otError error)
 {
     OT_UNUSED_VARIABLE(aAddress);
@@ -78,6 +78,15 @@
 #define OPENTHREAD_POSIX_CONFIG_SPINEL_SPI_INTERFACE_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SPINEL_SHMEM_INTERFACE_ENABLE
+ *
+ * Define as 1 to enable the spinel shared-memory ring interface.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SPINEL_SHMEM_INTERFACE_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_SPINEL_SHMEM_INTERFACE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_SPINEL_VENDOR_INTERFACE_ENABLE
  *
@@ -87,6 +96,19 @@
 #define OPENTHREAD_POSIX_CONFIG_SPINEL_VENDOR_INTERFACE_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SPINEL_INSTANCE_COUNT
+ *
+ * The number of spinel instances (driver and interface pairs) `SpinelManager` can drive.
+ *
+ * Instance zero is the co-processor driving the OpenThread stack. Additional instances, initialized with
+ * `SpinelManager::InitInstance()`, get their own spinel pipeline and mainloop integration and can be used by
+ * vendor code to drive further co-processors (e.g. a second RCP on another channel) from the same process.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SPINEL_INSTANCE_COUNT
+#define OPENTHREAD_POSIX_CONFIG_SPINEL_INSTANCE_COUNT 1
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_SPINEL_VENDOR_INTERFACE_URL_PROTOCOL_NAME
  *
@@ -164,6 +186,41 @@
 #define OPENTHREAD_POSIX_CONFIG_NETIF_PREFIX_ROUTE_METRIC 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_TUN_TX_BATCH_SIZE
+ *
+ * This setting configures the maximum number of packets drained from the tun interface per mainloop wakeup.
+ *
+ * Draining multiple packets per wakeup amortizes the poll/select round trip across a batch, which matters at high
+ * forwarding rates. Define as 1 to read a single packet per wakeup.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_TUN_TX_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_TUN_TX_BATCH_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define as 1 to back `otSysMainloopPoll()` with a persistent epoll instance instead of `select()` (Linux only).
+ *
+ * The epoll interest set is kept registered across mainloop iterations and is re-synced only when the fd sets
+ * produced by `otSysMainloopUpdate()` change, replacing the per-iteration kernel fd_set scan with a single
+ * `epoll_wait()`. `select()` remains the fallback on other platforms and when the epoll instance cannot be created.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_STALL_THRESHOLD_MS
+ *
+ * Specifies the mainloop dispatch duration, in milliseconds, above which a warning is logged listing the file
+ * descriptors that were ready when the slow dispatch started. Define as 0 to disable stall detection.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_STALL_THRESHOLD_MS
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_STALL_THRESHOLD_MS 0
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_INSTALL_OMR_ROUTES_ENABLE
  *
@@ -66,4 +66,18 @@
 #define OPENTHREAD_POSIX_CONFIG_DAEMON_CLI_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_DAEMON_FRAMED_OUTPUT_ENABLE
+ *
+ * Define to 1 to let daemon clients opt in to framed CLI output.
+ *
+ * A client enables the mode by sending the `\x01OTF1` request as its first bytes after connecting; the daemon
+ * acknowledges with a frame carrying `OTF1`. In framed mode each CLI output chunk is sent as a length-prefixed
+ * record (2-byte little-endian length followed by the payload), and records are accumulated and written with a
+ * single syscall per mainloop iteration instead of one write per output line. Text clients are unaffected.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_DAEMON_FRAMED_OUTPUT_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_DAEMON_FRAMED_OUTPUT_ENABLE 0
+#endif
+
 #endif // OT_POSIX_PLATFORM_OPENTHREAD_POSIX_DAEMON_CONFIG_H_
@@ -98,6 +98,7 @@ void Radio::Init(const char *aUrl)
     callbacks.mReceiveDone       = otPlatRadioReceiveDone;
     callbacks.mTransmitDone      = otPlatRadioTxDone;
     callbacks.mTxStarted         = otPlatRadioTxStarted;
+    callbacks.mTimeStatsSample   = otPlatRadioTimeStatsSample;
 #if OPENTHREAD_POSIX_CONFIG_TMP_STORAGE_ENABLE
     callbacks.mSaveRadioSpinelMetrics    = SaveRadioSpinelMetrics;
     callbacks.mRestoreRadioSpinelMetrics = RestoreRadioSpinelMetrics;
@@ -484,6 +485,42 @@ void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
     SuccessOrDie(GetRadioSpinel().ClearSrcMatchExtEntries());
 }
 
+otError otPlatRadioSetSrcMatchShortEntries(otInstance           *aInstance,
+                                           const otShortAddress *aShortAddresses,
+                                           uint16_t              aNumEntries)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return GetRadioSpinel().SetSrcMatchShortEntries(aShortAddresses, aNumEntries);
+}
+
+otError otPlatRadioSetSrcMatchExtEntries(otInstance *aInstance, const otExtAddress *aExtAddresses, uint16_t aNumEntries)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    otError      error = OT_ERROR_NO_BUFS;
+    otExtAddress addrs[OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES];
+
+    VerifyOrExit(aNumEntries <= OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES);
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        for (size_t j = 0; j < sizeof(otExtAddress); j++)
+        {
+            addrs[i].m8[j] = aExtAddresses[i].m8[sizeof(otExtAddress) - 1 - j];
+        }
+    }
+
+    error = GetRadioSpinel().SetSrcMatchExtEntries(addrs, aNumEntries);
+
+exit:
+    return error;
+}
+
+otError otPlatRadioSetSrcMatchPendingFilter(otInstance *aInstance, const uint8_t *aFilter, uint16_t aLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return GetRadioSpinel().SetSrcMatchPendingFilter(aFilter, aLength);
+}
+
 otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint16_t aScanDuration)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -1113,6 +1150,18 @@ const otRcpInterfaceMetrics *otSysGetRcpInterfaceMetrics(void)
     return sRadio.GetSpinelInterface().GetRcpInterfaceMetrics();
 }
 
+uint16_t otSysSpinelTraceRead(otSpinelFrameTraceEntry *aEntries, uint16_t aMaxEntries)
+{
+#if OPENTHREAD_SPINEL_CONFIG_TRACE_ENABLE
+    return ot::Spinel::Logger::ReadTrace(aEntries, aMaxEntries);
+#else
+    OT_UNUSED_VARIABLE(aEntries);
+    OT_UNUSED_VARIABLE(aMaxEntries);
+
+    return 0;
+#endif
+}
+
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 void otSysSetRcpRestorationEnabled(bool aEnabled) { return GetRadioSpinel().SetRcpRestorationEnabled(aEnabled); }
 #endif
@@ -33,6 +33,7 @@
 #include "logger.hpp"
 #include "radio_url.hpp"
 #include "rcp_caps_diag.hpp"
+#include "shmem_interface.hpp"
 #include "spi_interface.hpp"
 #include "spinel_manager.hpp"
 #include "tmp_storage.hpp"
@@ -128,6 +129,8 @@ private:
     static constexpr size_t kSpinelInterfaceRawSize = sizeof(ot::Posix::HdlcInterface);
 #elif OPENTHREAD_POSIX_CONFIG_SPINEL_SPI_INTERFACE_ENABLE
     static constexpr size_t kSpinelInterfaceRawSize = sizeof(ot::Posix::SpiInterface);
+#elif OPENTHREAD_POSIX_CONFIG_SPINEL_SHMEM_INTERFACE_ENABLE
+    static constexpr size_t kSpinelInterfaceRawSize = sizeof(ot::Posix::ShmemInterface);
 #elif OPENTHREAD_POSIX_CONFIG_SPINEL_VENDOR_INTERFACE_ENABLE
     static constexpr size_t kSpinelInterfaceRawSize = sizeof(ot::Posix::VendorInterface);
 #else
@@ -74,6 +74,7 @@ const char Resolver::kLogModuleName[] = "Resolver";
 void Resolver::Init(void)
 {
     memset(mUpstreamTransaction, 0, sizeof(mUpstreamTransaction));
+    memset(mServerStats, 0, sizeof(mServerStats));
     LoadDnsServerListFromConf();
 }
 
@@ -269,10 +270,10 @@ exit:
 void Resolver::Query(otPlatDnsUpstreamQuery *aTxn, const otMessage *aQuery)
 {
     char         packet[kMaxDnsMessageSize];
-    otError      error       = OT_ERROR_NONE;
-    uint16_t     length      = otMessageGetLength(aQuery);
-    uint32_t     serverCount = 0;
-    Transaction *txn         = nullptr;
+    otError      error  = OT_ERROR_NONE;
+    uint16_t     length = otMessageGetLength(aQuery);
+    bool         sent   = false;
+    Transaction *txn    = nullptr;
 
     VerifyOrExit(length <= kMaxDnsMessageSize, error = OT_ERROR_NO_BUFS);
     VerifyOrExit(otMessageRead(aQuery, 0, &packet, sizeof(packet)) == length, error = OT_ERROR_NO_BUFS);
@@ -281,25 +282,41 @@ void Resolver::Query(otPlatDnsUpstreamQuery *aTxn, const otMessage *aQuery)
     VerifyOrExit(txn != nullptr, error = OT_ERROR_NO_BUFS);
     TryRefreshDnsServerList();
 
-    for (uint32_t i = 0; i < mRecursiveDnsServerCount; i++)
+    for (uint32_t i = 0; i < mRecursiveDnsServerCount && txn->mServerCount < kMaxServersPerQuery; i++)
     {
-        if (SendQueryToServer(txn, mRecursiveDnsServerList[i], packet, length) == OT_ERROR_NONE)
-        {
-            serverCount++;
-        }
+        txn->mServers[txn->mServerCount++] = mRecursiveDnsServerList[i];
     }
 
-    for (uint32_t i = 0; i < mUpstreamDnsServerCount; i++)
+    for (uint32_t i = 0; i < mUpstreamDnsServerCount && txn->mServerCount < kMaxServersPerQuery; i++)
+    {
+        txn->mServers[txn->mServerCount++] = mUpstreamDnsServerList[i];
+    }
+
+    RankServers(*txn);
+
+    memcpy(txn->mQueryPacket, packet, length);
+    txn->mQueryLength = length;
+
+    // Send to the best-ranked server only and fan the query out to the
+    // remaining servers after a short stagger delay, so that a healthy
+    // primary server answers without the cost of querying every server.
+    for (uint8_t i = 0; i < txn->mServerCount && !sent; i++)
     {
-        if (SendQueryToServer(txn, mUpstreamDnsServerList[i], packet, length) == OT_ERROR_NONE)
+        if (SendQueryToServer(txn, txn->mServers[i], packet, length) == OT_ERROR_NONE)
         {
-            serverCount++;
+            txn->mSendTimes[i] = otPlatTimeGet();
+            sent               = true;
         }
     }
 
-    VerifyOrExit(serverCount > 0, error = OT_ERROR_NO_ROUTE);
+    VerifyOrExit(sent, error = OT_ERROR_NO_ROUTE);
 
-    LogInfo("Forwarded DNS query %p to %u server(s).", static_cast<void *>(aTxn), serverCount);
+    if (txn->mServerCount > 1)
+    {
+        txn->mFanOutTime = otPlatTimeGet() + kFanOutStaggerDelayUs;
+    }
+
+    LogInfo("Forwarded DNS query %p to best of %u server(s).", static_cast<void *>(aTxn), txn->mServerCount);
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -349,10 +366,14 @@ Resolver::Transaction *Resolver::AllocateTransaction(otPlatDnsUpstreamQuery *aTh
                 break;
             }
 
-            ret             = &txn;
-            ret->mUdpFd4    = fd4OrError;
-            ret->mUdpFd6    = fd6OrError;
-            ret->mThreadTxn = aThreadTxn;
+            ret              = &txn;
+            ret->mUdpFd4     = fd4OrError;
+            ret->mUdpFd6     = fd6OrError;
+            ret->mThreadTxn  = aThreadTxn;
+            ret->mFanOutTime = 0;
+            ret->mServerCount = 0;
+            ret->mQueryLength = 0;
+            memset(ret->mSendTimes, 0, sizeof(ret->mSendTimes));
             break;
         }
     }
@@ -360,20 +381,25 @@ Resolver::Transaction *Resolver::AllocateTransaction(otPlatDnsUpstreamQuery *aTh
     return ret;
 }
 
-void Resolver::ForwardResponse(otPlatDnsUpstreamQuery *aThreadTxn, int aFd)
+void Resolver::ForwardResponse(Transaction &aTxn, int aFd)
 {
-    char       response[kMaxDnsMessageSize];
-    ssize_t    readSize;
-    otError    error   = OT_ERROR_NONE;
-    otMessage *message = nullptr;
+    char                    response[kMaxDnsMessageSize];
+    struct sockaddr_storage peerAddr;
+    socklen_t               peerAddrLen = sizeof(peerAddr);
+    ssize_t                 readSize;
+    otError                 error   = OT_ERROR_NONE;
+    otMessage              *message = nullptr;
+
+    VerifyOrExit((readSize = recvfrom(aFd, response, sizeof(response), 0, reinterpret_cast<sockaddr *>(&peerAddr),
+                                      &peerAddrLen)) > 0);
 
-    VerifyOrExit((readSize = read(aFd, response, sizeof(response))) > 0);
+    RecordServerResponse(aTxn, peerAddr);
 
     message = otUdpNewMessage(gInstance, nullptr);
     VerifyOrExit(message != nullptr, error = OT_ERROR_NO_BUFS);
     SuccessOrExit(error = otMessageAppend(message, response, readSize));
 
-    otPlatDnsUpstreamQueryDone(gInstance, aThreadTxn, message);
+    otPlatDnsUpstreamQueryDone(gInstance, aTxn.mThreadTxn, message);
     message = nullptr;
 
 exit:
@@ -409,6 +435,20 @@ Resolver::Transaction *Resolver::GetTransaction(otPlatDnsUpstreamQuery *aThreadT
 
 void Resolver::CloseTransaction(Transaction *aTxn)
 {
+    // Count a loss against every server that was sent the query but had not
+    // answered by the time the transaction closed.
+    for (uint8_t i = 0; i < aTxn->mServerCount; i++)
+    {
+        if (aTxn->mSendTimes[i] != 0)
+        {
+            RecordServerResult(aTxn->mServers[i], /* aSuccess */ false, 0);
+            aTxn->mSendTimes[i] = 0;
+        }
+    }
+
+    aTxn->mServerCount = 0;
+    aTxn->mFanOutTime  = 0;
+
     if (aTxn->mUdpFd4 >= 0)
     {
         close(aTxn->mUdpFd4);
@@ -432,6 +472,13 @@ void Resolver::UpdateFdSet(Mainloop::Context &aContext)
             Mainloop::AddToErrorFdSet(txn.mUdpFd4, aContext);
             Mainloop::AddToReadFdSet(txn.mUdpFd6, aContext);
             Mainloop::AddToErrorFdSet(txn.mUdpFd6, aContext);
+
+            if (txn.mFanOutTime != 0)
+            {
+                uint64_t now = otPlatTimeGet();
+
+                Mainloop::SetTimeoutIfEarlier((txn.mFanOutTime > now) ? (txn.mFanOutTime - now) : 0, aContext);
+            }
         }
     }
 }
@@ -445,14 +492,18 @@ void Resolver::Process(const Mainloop::Context &aContext)
             // Note: On Linux, we can only get the error via read, so they should share the same logic.
             if (Mainloop::HasFdErrored(txn.mUdpFd4, aContext) || Mainloop::IsFdReadable(txn.mUdpFd4, aContext))
             {
-                ForwardResponse(txn.mThreadTxn, txn.mUdpFd4);
+                ForwardResponse(txn, txn.mUdpFd4);
                 CloseTransaction(&txn);
             }
             else if (Mainloop::HasFdErrored(txn.mUdpFd6, aContext) || Mainloop::IsFdReadable(txn.mUdpFd6, aContext))
             {
-                ForwardResponse(txn.mThreadTxn, txn.mUdpFd6);
+                ForwardResponse(txn, txn.mUdpFd6);
                 CloseTransaction(&txn);
             }
+            else if (txn.mFanOutTime != 0 && otPlatTimeGet() >= txn.mFanOutTime)
+            {
+                FanOut(txn);
+            }
         }
     }
 }
@@ -494,6 +545,153 @@ exit:
     return fd;
 }
 
+Resolver::ServerStats *Resolver::FindOrAddServerStats(const otIp6Address &aAddress)
+{
+    ServerStats *found    = nullptr;
+    ServerStats *freeSlot = nullptr;
+
+    for (ServerStats &stats : mServerStats)
+    {
+        if (stats.mInUse)
+        {
+            if (otIp6IsAddressEqual(&stats.mAddress, &aAddress))
+            {
+                found = &stats;
+                break;
+            }
+        }
+        else if (freeSlot == nullptr)
+        {
+            freeSlot = &stats;
+        }
+    }
+
+    if (found == nullptr && freeSlot != nullptr)
+    {
+        memset(freeSlot, 0, sizeof(*freeSlot));
+        freeSlot->mAddress = aAddress;
+        freeSlot->mInUse   = true;
+        found              = freeSlot;
+    }
+
+    return found;
+}
+
+uint64_t Resolver::GetServerScore(const otIp6Address &aAddress)
+{
+    // Lower is better. A server without any RTT sample yet is scored with the
+    // default RTT so that new servers get a chance to be measured.
+    uint64_t score = kDefaultServerRttUs;
+
+    for (const ServerStats &stats : mServerStats)
+    {
+        if (stats.mInUse && otIp6IsAddressEqual(&stats.mAddress, &aAddress))
+        {
+            uint64_t rtt = (stats.mRttEwmaUs != 0) ? stats.mRttEwmaUs : kDefaultServerRttUs;
+
+            score = rtt + (rtt * stats.mLossEwma * kLossRttPenaltyFactor) / kLossEwmaUnit;
+            break;
+        }
+    }
+
+    return score;
+}
+
+void Resolver::RecordServerResult(const otIp6Address &aAddress, bool aSuccess, uint64_t aRttUs)
+{
+    ServerStats *stats = FindOrAddServerStats(aAddress);
+
+    VerifyOrExit(stats != nullptr);
+
+    if (aSuccess)
+    {
+        stats->mRttEwmaUs =
+            (stats->mRttEwmaUs == 0) ? aRttUs : stats->mRttEwmaUs - stats->mRttEwmaUs / kEwmaWeight + aRttUs / kEwmaWeight;
+        stats->mLossEwma -= stats->mLossEwma / kEwmaWeight;
+    }
+    else
+    {
+        stats->mLossEwma += (kLossEwmaUnit - stats->mLossEwma) / kEwmaWeight;
+    }
+
+    LogDebg("Server %s: rtt-ewma=%lluus, loss-ewma=%lu/%lu", Ip6AddressString(&aAddress).AsCString(),
+            static_cast<unsigned long long>(stats->mRttEwmaUs), static_cast<unsigned long>(stats->mLossEwma),
+            static_cast<unsigned long>(kLossEwmaUnit));
+
+exit:
+    return;
+}
+
+void Resolver::RecordServerResponse(Transaction &aTxn, const struct sockaddr_storage &aPeerAddr)
+{
+    otIp6Address serverAddress;
+
+    if (aPeerAddr.ss_family == AF_INET)
+    {
+        otIp4Address ip4Address;
+
+        memcpy(&ip4Address, &reinterpret_cast<const sockaddr_in *>(&aPeerAddr)->sin_addr, sizeof(ip4Address));
+        otIp4ToIp4MappedIp6Address(&ip4Address, &serverAddress);
+    }
+    else if (aPeerAddr.ss_family == AF_INET6)
+    {
+        memcpy(&serverAddress, &reinterpret_cast<const sockaddr_in6 *>(&aPeerAddr)->sin6_addr, sizeof(serverAddress));
+    }
+    else
+    {
+        ExitNow();
+    }
+
+    for (uint8_t i = 0; i < aTxn.mServerCount; i++)
+    {
+        if (aTxn.mSendTimes[i] != 0 && otIp6IsAddressEqual(&aTxn.mServers[i], &serverAddress))
+        {
+            RecordServerResult(serverAddress, /* aSuccess */ true, otPlatTimeGet() - aTxn.mSendTimes[i]);
+            aTxn.mSendTimes[i] = 0;
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
+void Resolver::RankServers(Transaction &aTxn)
+{
+    // Insertion sort by score, best (lowest) first. The list is at most
+    // `kMaxServersPerQuery` entries so the repeated score lookups are cheap.
+    for (uint8_t i = 1; i < aTxn.mServerCount; i++)
+    {
+        otIp6Address address = aTxn.mServers[i];
+        uint64_t     score   = GetServerScore(address);
+        uint8_t      j       = i;
+
+        while (j > 0 && GetServerScore(aTxn.mServers[j - 1]) > score)
+        {
+            aTxn.mServers[j] = aTxn.mServers[j - 1];
+            j--;
+        }
+
+        aTxn.mServers[j] = address;
+    }
+}
+
+void Resolver::FanOut(Transaction &aTxn)
+{
+    uint64_t now = otPlatTimeGet();
+
+    for (uint8_t i = 0; i < aTxn.mServerCount; i++)
+    {
+        if (aTxn.mSendTimes[i] == 0 &&
+            SendQueryToServer(&aTxn, aTxn.mServers[i], aTxn.mQueryPacket, aTxn.mQueryLength) == OT_ERROR_NONE)
+        {
+            aTxn.mSendTimes[i] = now;
+        }
+    }
+
+    aTxn.mFanOutTime = 0;
+}
+
 } // namespace Posix
 } // namespace ot
 
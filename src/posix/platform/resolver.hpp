@@ -129,12 +129,33 @@ public:
 private:
     static constexpr uint64_t kDnsServerListNullCacheTimeoutMs = 1 * 60 * 1000;  // 1 minute
     static constexpr uint64_t kDnsServerListCacheTimeoutMs     = 10 * 60 * 1000; // 10 minutes
+    static constexpr uint64_t kFanOutStaggerDelayUs            = 250 * 1000;     // 250 milliseconds
+    static constexpr uint64_t kDefaultServerRttUs              = 50 * 1000;      // Assumed RTT before first sample.
+    static constexpr uint32_t kEwmaWeight                      = 8;   // EWMA weight factor (1/8 for a new sample).
+    static constexpr uint32_t kLossEwmaUnit                    = 256; // Fixed-point unit of the loss EWMA.
+    static constexpr uint32_t kLossRttPenaltyFactor            = 4;   // Ranking penalty of a fully lossy server.
+    static constexpr uint8_t  kMaxServersPerQuery = kMaxUpstreamServerCount + kMaxRecursiveServerCount;
+    static constexpr uint8_t  kMaxServerStatsCount = kMaxServersPerQuery + 2; // Extra room for server list churn.
 
     struct Transaction
     {
         otPlatDnsUpstreamQuery *mThreadTxn;
         int                     mUdpFd4;
         int                     mUdpFd6;
+        uint64_t                mFanOutTime; // Time (us) to fan out to the remaining servers, 0 if none pending.
+        uint16_t                mQueryLength;
+        uint8_t                 mServerCount;
+        otIp6Address            mServers[kMaxServersPerQuery];   // Candidate servers, best-ranked first.
+        uint64_t                mSendTimes[kMaxServersPerQuery]; // Send time (us) per server, 0 if not sent/answered.
+        char                    mQueryPacket[kMaxDnsMessageSize];
+    };
+
+    struct ServerStats
+    {
+        otIp6Address mAddress;
+        uint64_t     mRttEwmaUs; // EWMA of the response RTT, 0 when no sample yet.
+        uint32_t     mLossEwma;  // EWMA of the loss rate, fixed-point with `kLossEwmaUnit` as 100%.
+        bool         mInUse;
     };
 
     static int CreateUdpSocket(sa_family_t aFamily);
@@ -146,11 +167,18 @@ private:
                               const otIp6Address &aServerAddress,
                               const char         *aPacket,
                               uint16_t            aLength);
-    void    ForwardResponse(otPlatDnsUpstreamQuery *aThreadTxn, int aFd);
+    void    ForwardResponse(Transaction &aTxn, int aFd);
     void    CloseTransaction(Transaction *aTxn);
     void    TryRefreshDnsServerList(void);
     void    LoadDnsServerListFromConf(void);
 
+    ServerStats *FindOrAddServerStats(const otIp6Address &aAddress);
+    uint64_t     GetServerScore(const otIp6Address &aAddress);
+    void         RecordServerResult(const otIp6Address &aAddress, bool aSuccess, uint64_t aRttUs);
+    void         RecordServerResponse(Transaction &aTxn, const struct sockaddr_storage &aPeerAddr);
+    void         RankServers(Transaction &aTxn);
+    void         FanOut(Transaction &aTxn);
+
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     static void BorderRoutingRdnssCallback(void *aResolver);
     void        BorderRoutingRdnssCallback(void);
@@ -165,6 +193,7 @@ private:
     otIp6Address mRecursiveDnsServerList[kMaxRecursiveServerCount];
 
     Transaction mUpstreamTransaction[kMaxUpstreamTransactionCount];
+    ServerStats mServerStats[kMaxServerStatsCount];
 };
 
 } // namespace Posix
@@ -130,6 +130,8 @@ exit:
         VerifyOrDie(ftruncate(mSettingsFd, 0) == 0, OT_EXIT_ERROR_ERRNO);
     }
 
+    BuildIndex();
+
     return error;
 }
 
@@ -151,6 +153,45 @@ otError SettingsFile::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *
 
     OT_ASSERT(mSettingsFd >= 0);
 
+    if (mIndexValid)
+    {
+        for (uint16_t i = 0; i < mIndexLength; i++)
+        {
+            const IndexEntry &entry = mIndex[i];
+
+            if (entry.mKey != aKey)
+            {
+                continue;
+            }
+
+            if (aIndex > 0)
+            {
+                --aIndex;
+                continue;
+            }
+
+            error = OT_ERROR_NONE;
+
+            if (aValueLength)
+            {
+                if (aValue)
+                {
+                    uint16_t readLength = (entry.mLength <= *aValueLength ? entry.mLength : *aValueLength);
+
+                    VerifyOrExit(pread(mSettingsFd, aValue, readLength, static_cast<off_t>(entry.mOffset)) ==
+                                     readLength,
+                                 error = OT_ERROR_PARSE);
+                }
+
+                *aValueLength = entry.mLength;
+            }
+
+            break;
+        }
+
+        ExitNow();
+    }
+
     size   = lseek(mSettingsFd, 0, SEEK_END);
     offset = lseek(mSettingsFd, 0, SEEK_SET);
     VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
@@ -335,7 +376,48 @@ exit:
     return error;
 }
 
-void SettingsFile::Wipe(void) { VerifyOrDie(0 == ftruncate(mSettingsFd, 0), OT_EXIT_ERROR_ERRNO); }
+void SettingsFile::Wipe(void)
+{
+    VerifyOrDie(0 == ftruncate(mSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+    BuildIndex();
+}
+
+void SettingsFile::BuildIndex(void)
+{
+    off_t size;
+    off_t offset = 0;
+
+    mIndexValid  = false;
+    mIndexLength = 0;
+
+    size = lseek(mSettingsFd, 0, SEEK_END);
+    VerifyOrExit(size >= 0);
+
+    while (offset < size)
+    {
+        uint16_t key;
+        uint16_t length;
+
+        VerifyOrExit(pread(mSettingsFd, &key, sizeof(key), offset) == sizeof(key));
+        VerifyOrExit(pread(mSettingsFd, &length, sizeof(length), offset + static_cast<off_t>(sizeof(key))) ==
+                     sizeof(length));
+        VerifyOrExit(mIndexLength < kMaxIndexEntries);
+
+        mIndex[mIndexLength].mKey    = key;
+        mIndex[mIndexLength].mLength = length;
+        mIndex[mIndexLength].mOffset = static_cast<uint32_t>(offset) + sizeof(key) + sizeof(length);
+        mIndexLength++;
+
+        offset += static_cast<off_t>(sizeof(key) + sizeof(length) + length);
+    }
+
+    VerifyOrExit(offset == size);
+
+    mIndexValid = true;
+
+exit:
+    return;
+}
 
 void SettingsFile::GetSettingsFilePath(char aFileName[kMaxFilePathSize], bool aSwap)
 {
@@ -390,6 +472,8 @@ void SettingsFile::SwapPersist(int aFd)
     VerifyOrDie(0 == rename(swapFile, dataFile), OT_EXIT_ERROR_ERRNO);
 
     mSettingsFd = aFd;
+
+    BuildIndex();
 }
 
 void SettingsFile::SwapDiscard(int aFd)
@@ -72,6 +72,8 @@ public:
 
     SettingsFile(void)
         : mSettingsFd(-1)
+        , mIndexValid(false)
+        , mIndexLength(0)
     {
     }
 
@@ -145,17 +147,34 @@ private:
     static constexpr size_t kMaxFileBasePathNameSize = kMaxFileFullPathNameSize - kSlashLength - kMaxFileBaseNameSize;
     static constexpr size_t kMaxFilePathSize         = PATH_MAX;
 
+    static constexpr uint16_t kMaxIndexEntries = 1024;
+
+    // In-memory index of the records in the settings file, rebuilt on init and after every mutation (which
+    // rewrites the file). When valid, `Get()` locates a record with a single `pread()` instead of scanning
+    // the file record by record. If the file holds more than `kMaxIndexEntries` records, the index is marked
+    // invalid and `Get()` falls back to the linear scan.
+    struct IndexEntry
+    {
+        uint16_t mKey;    ///< The record key.
+        uint16_t mLength; ///< The record value length (in bytes).
+        uint32_t mOffset; ///< The file offset of the record value.
+    };
+
     otError Delete(uint16_t aKey, int aIndex, int *aSwapFd);
     void    GetSettingsFilePath(char aFileName[kMaxFilePathSize], bool aSwap);
     int     SwapOpen(void);
     void    SwapWrite(int aFd, uint16_t aLength);
     void    SwapPersist(int aFd);
     void    SwapDiscard(int aFd);
+    void    BuildIndex(void);
 
     static char sSettingsPath[kMaxFileBasePathNameSize];
     static char sSettingsFileName[kMaxFileBaseNameSize];
     char        mSettingsFileFullPathName[kMaxFileFullPathNameSize];
     int         mSettingsFd;
+    bool        mIndexValid;
+    uint16_t    mIndexLength;
+    IndexEntry  mIndex[kMaxIndexEntries];
 };
 
 } // namespace Posix
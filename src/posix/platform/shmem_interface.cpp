@@ -0,0 +1,364 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the implementation for the shared-memory ring interface to radio (RCP).
+ */
+
+#include "shmem_interface.hpp"
+
+#include "platform-posix.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/select.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "common/code_utils.hpp"
+
+#if OPENTHREAD_POSIX_CONFIG_SPINEL_SHMEM_INTERFACE_ENABLE
+
+namespace ot {
+namespace Posix {
+
+const char ShmemInterface::kLogModuleName[] = "ShmIntface";
+
+ShmemInterface::ShmemInterface(const Url::Url &aRadioUrl)
+    : mReceiveFrameCallback(nullptr)
+    , mReceiveFrameContext(nullptr)
+    , mRxFrameBuffer(nullptr)
+    , mRadioUrl(aRadioUrl)
+    , mShmem(nullptr)
+    , mShmemFd(-1)
+    , mTxDoorbellFd(-1)
+    , mRxDoorbellFd(-1)
+{
+    memset(&mInterfaceMetrics, 0, sizeof(mInterfaceMetrics));
+    mInterfaceMetrics.mRcpInterfaceType = kSpinelInterfaceTypeShmem;
+}
+
+ShmemInterface::~ShmemInterface(void) { Deinit(); }
+
+otError ShmemInterface::Init(ReceiveFrameCallback aCallback, void *aCallbackContext, RxFrameBuffer &aFrameBuffer)
+{
+    otError     error = OT_ERROR_NONE;
+    const char *txDoorbell;
+    const char *rxDoorbell;
+    void       *region;
+
+    VerifyOrExit(mShmem == nullptr, error = OT_ERROR_ALREADY);
+
+    // The doorbell eventfds are created by the process that launches the host and the co-processor, and are
+    // handed over as inherited file descriptor numbers on the radio URL.
+    txDoorbell = mRadioUrl.GetValue("tx-doorbell");
+    rxDoorbell = mRadioUrl.GetValue("rx-doorbell");
+    VerifyOrDie((txDoorbell != nullptr) && (rxDoorbell != nullptr), OT_EXIT_INVALID_ARGUMENTS);
+
+    mTxDoorbellFd = atoi(txDoorbell);
+    mRxDoorbellFd = atoi(rxDoorbell);
+    VerifyOrDie((mTxDoorbellFd >= 0) && (mRxDoorbellFd >= 0), OT_EXIT_INVALID_ARGUMENTS);
+
+    mShmemFd = open(mRadioUrl.GetPath(), O_RDWR | O_CLOEXEC);
+    VerifyOrDie(mShmemFd >= 0, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(ftruncate(mShmemFd, sizeof(ShmemLayout)) == 0, OT_EXIT_ERROR_ERRNO);
+
+    region = mmap(nullptr, sizeof(ShmemLayout), PROT_READ | PROT_WRITE, MAP_SHARED, mShmemFd, 0);
+    VerifyOrDie(region != MAP_FAILED, OT_EXIT_ERROR_ERRNO);
+
+    mShmem = reinterpret_cast<ShmemLayout *>(region);
+
+    if (mShmem->mMagic == 0)
+    {
+        // A fresh region: the host publishes the layout for the co-processor to validate.
+        mShmem->mVersion = kShmemVersion;
+        __sync_synchronize();
+        mShmem->mMagic = kShmemMagic;
+    }
+    else if ((mShmem->mMagic != kShmemMagic) || (mShmem->mVersion != kShmemVersion))
+    {
+        LogCrit("Shared memory region '%s' has unexpected magic/version", mRadioUrl.GetPath());
+        ExitNow(error = OT_ERROR_FAILED);
+    }
+
+    mReceiveFrameCallback = aCallback;
+    mReceiveFrameContext  = aCallbackContext;
+    mRxFrameBuffer        = &aFrameBuffer;
+
+exit:
+    return error;
+}
+
+void ShmemInterface::Deinit(void)
+{
+    if (mShmem != nullptr)
+    {
+        munmap(mShmem, sizeof(ShmemLayout));
+        mShmem = nullptr;
+    }
+
+    if (mShmemFd >= 0)
+    {
+        close(mShmemFd);
+        mShmemFd = -1;
+    }
+
+    mTxDoorbellFd = -1;
+    mRxDoorbellFd = -1;
+
+    mReceiveFrameCallback = nullptr;
+    mReceiveFrameContext  = nullptr;
+    mRxFrameBuffer        = nullptr;
+}
+
+uint32_t ShmemInterface::GetUsedSize(const RingBuffer &aRing)
+{
+    uint32_t writeIndex = aRing.mWriteIndex;
+    uint32_t readIndex  = aRing.mReadIndex;
+
+    return (writeIndex >= readIndex) ? (writeIndex - readIndex) : (kRingBufferSize - readIndex + writeIndex);
+}
+
+void ShmemInterface::WriteRing(RingBuffer &aRing, const uint8_t *aBuffer, uint16_t aLength)
+{
+    uint32_t writeIndex = aRing.mWriteIndex;
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aRing.mBuffer[writeIndex] = aBuffer[i];
+        writeIndex                = (writeIndex + 1) % kRingBufferSize;
+    }
+
+    // Make the frame bytes visible to the consumer before publishing the new write index.
+    __sync_synchronize();
+    aRing.mWriteIndex = writeIndex;
+}
+
+void ShmemInterface::ReadRing(const RingBuffer &aRing, uint32_t aOffset, uint8_t *aBuffer, uint16_t aLength)
+{
+    uint32_t readIndex = (aRing.mReadIndex + aOffset) % kRingBufferSize;
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aBuffer[i] = aRing.mBuffer[readIndex];
+        readIndex  = (readIndex + 1) % kRingBufferSize;
+    }
+}
+
+otError ShmemInterface::RingDoorbell(void)
+{
+    otError  error = OT_ERROR_NONE;
+    uint64_t one   = 1;
+    ssize_t  rval;
+
+    do
+    {
+        rval = write(mTxDoorbellFd, &one, sizeof(one));
+    } while ((rval < 0) && (errno == EINTR));
+
+    VerifyOrExit(rval == sizeof(one), error = OT_ERROR_FAILED);
+
+exit:
+    return error;
+}
+
+otError ShmemInterface::SendFrame(const uint8_t *aFrame, uint16_t aLength)
+{
+    otError error = OT_ERROR_NONE;
+    uint8_t length[kFrameLengthSize];
+
+    assert(mShmem != nullptr);
+
+    // The ring holds at most `kRingBufferSize - 1` bytes, so a full ring is distinguishable from an empty one.
+    VerifyOrExit(GetUsedSize(mShmem->mTxRing) + kFrameLengthSize + aLength < kRingBufferSize,
+                 error = OT_ERROR_NO_BUFS);
+
+    length[0] = static_cast<uint8_t>(aLength & 0xff);
+    length[1] = static_cast<uint8_t>(aLength >> 8);
+
+    WriteRing(mShmem->mTxRing, length, sizeof(length));
+    WriteRing(mShmem->mTxRing, aFrame, aLength);
+
+    error = RingDoorbell();
+
+exit:
+    mInterfaceMetrics.mTransferredFrameCount++;
+    if (error == OT_ERROR_NONE)
+    {
+        mInterfaceMetrics.mTxFrameCount++;
+        mInterfaceMetrics.mTxFrameByteCount += aLength;
+        mInterfaceMetrics.mTransferredValidFrameCount++;
+    }
+    else
+    {
+        mInterfaceMetrics.mTransferredGarbageFrameCount++;
+    }
+
+    return error;
+}
+
+otError ShmemInterface::PopRxFrame(void)
+{
+    otError     error = OT_ERROR_NONE;
+    RingBuffer &ring  = mShmem->mRxRing;
+    uint8_t     length[kFrameLengthSize];
+    uint16_t    frameLength;
+    uint32_t    usedSize;
+
+    usedSize = GetUsedSize(ring);
+    VerifyOrExit(usedSize >= kFrameLengthSize, error = OT_ERROR_NOT_FOUND);
+
+    // Make sure the frame bytes published by the producer are read no earlier than its write index.
+    __sync_synchronize();
+
+    ReadRing(ring, 0, length, sizeof(length));
+    frameLength = static_cast<uint16_t>(length[0] | (length[1] << 8));
+
+    VerifyOrExit(usedSize >= static_cast<uint32_t>(kFrameLengthSize + frameLength), error = OT_ERROR_NOT_FOUND);
+
+    if ((frameLength == 0) || (frameLength > mRxFrameBuffer->GetFrameMaxLength()))
+    {
+        // The producer only publishes whole frames, so a nonsensical length means the rings are out of
+        // sync and nothing later in the ring can be trusted either.
+        mInterfaceMetrics.mTransferredFrameCount++;
+        mInterfaceMetrics.mTransferredGarbageFrameCount++;
+        DieNowWithMessage("corrupted shmem rx ring", OT_EXIT_FAILURE);
+    }
+
+    ReadRing(ring, kFrameLengthSize, mRxFrameBuffer->GetFrame(), frameLength);
+    ring.mReadIndex = (ring.mReadIndex + kFrameLengthSize + frameLength) % kRingBufferSize;
+
+    SuccessOrExit(error = mRxFrameBuffer->SetLength(frameLength));
+
+    mInterfaceMetrics.mTransferredFrameCount++;
+    mInterfaceMetrics.mTransferredValidFrameCount++;
+    mInterfaceMetrics.mRxFrameCount++;
+    mInterfaceMetrics.mRxFrameByteCount += frameLength;
+
+    mReceiveFrameCallback(mReceiveFrameContext);
+
+exit:
+    if (error == OT_ERROR_NO_BUFS)
+    {
+        mRxFrameBuffer->DiscardFrame();
+    }
+
+    return error;
+}
+
+void ShmemInterface::Read(void)
+{
+    uint64_t counter;
+    ssize_t  rval;
+
+    // Drain the doorbell; the rings themselves carry the data.
+    do
+    {
+        rval = read(mRxDoorbellFd, &counter, sizeof(counter));
+    } while ((rval < 0) && (errno == EINTR));
+
+    if ((rval < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK))
+    {
+        DieNow(OT_EXIT_ERROR_ERRNO);
+    }
+
+    while (PopRxFrame() == OT_ERROR_NONE)
+    {
+    }
+}
+
+otError ShmemInterface::WaitForFrame(uint64_t aTimeoutUs)
+{
+    otError        error = OT_ERROR_NONE;
+    struct timeval timeout;
+    fd_set         readFds;
+    int            rval;
+
+    timeout.tv_sec  = static_cast<time_t>(aTimeoutUs / OT_US_PER_S);
+    timeout.tv_usec = static_cast<suseconds_t>(aTimeoutUs % OT_US_PER_S);
+
+    FD_ZERO(&readFds);
+    FD_SET(mRxDoorbellFd, &readFds);
+
+    rval = select(mRxDoorbellFd + 1, &readFds, nullptr, nullptr, &timeout);
+
+    if (rval > 0)
+    {
+        Read();
+    }
+    else if (rval == 0)
+    {
+        ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+    }
+    else if (errno != EINTR)
+    {
+        DieNowWithMessage("wait response", OT_EXIT_FAILURE);
+    }
+
+exit:
+    return error;
+}
+
+void ShmemInterface::UpdateFdSet(void *aMainloopContext)
+{
+    otSysMainloopContext *context = reinterpret_cast<otSysMainloopContext *>(aMainloopContext);
+
+    assert(context != nullptr);
+
+    FD_SET(mRxDoorbellFd, &context->mReadFdSet);
+
+    if (context->mMaxFd < mRxDoorbellFd)
+    {
+        context->mMaxFd = mRxDoorbellFd;
+    }
+}
+
+void ShmemInterface::Process(const void *aMainloopContext)
+{
+    const otSysMainloopContext *context = reinterpret_cast<const otSysMainloopContext *>(aMainloopContext);
+
+    assert(context != nullptr);
+
+    if (FD_ISSET(mRxDoorbellFd, &context->mReadFdSet))
+    {
+        Read();
+    }
+}
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_POSIX_CONFIG_SPINEL_SHMEM_INTERFACE_ENABLE
@@ -0,0 +1,228 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the shared-memory ring interface to radio (RCP).
+ */
+
+#ifndef OT_POSIX_PLATFORM_SHMEM_INTERFACE_HPP_
+#define OT_POSIX_PLATFORM_SHMEM_INTERFACE_HPP_
+
+#include "openthread-posix-config.h"
+
+#include "logger.hpp"
+#include "platform-posix.h"
+#include "lib/spinel/spinel_interface.hpp"
+
+#include <openthread/openthread-system.h>
+
+namespace ot {
+namespace Posix {
+
+/**
+ * Defines a shared-memory ring interface to the Radio Co-processor (RCP).
+ *
+ * The host and the co-processor share a memory region containing two single-producer single-consumer byte rings
+ * (one per direction). Spinel frames are placed in the rings verbatim, prefixed by a two byte little-endian
+ * length - there is no HDLC encoding, byte stuffing or checksum. Each side signals the other through an eventfd
+ * doorbell after publishing frames, so no polling is needed.
+ */
+class ShmemInterface : public ot::Spinel::SpinelInterface, public Logger<ShmemInterface>
+{
+public:
+    static const char kLogModuleName[]; ///< Module name used for logging.
+
+    /**
+     * Initializes the object.
+     *
+     * @param[in] aRadioUrl  RadioUrl parsed from radio url.
+     */
+    ShmemInterface(const Url::Url &aRadioUrl);
+
+    /**
+     * This destructor deinitializes the object.
+     */
+    ~ShmemInterface(void);
+
+    /**
+     * Initializes the interface to the Radio Co-processor (RCP).
+     *
+     * @note This method should be called before reading and sending spinel frames to the interface.
+     *
+     * @param[in] aCallback         Callback on frame received
+     * @param[in] aCallbackContext  Callback context
+     * @param[in] aFrameBuffer      A reference to a `RxFrameBuffer` object.
+     *
+     * @retval OT_ERROR_NONE       The interface is initialized successfully
+     * @retval OT_ERROR_ALREADY    The interface is already initialized.
+     * @retval OT_ERROR_FAILED     Failed to initialize the interface.
+     */
+    otError Init(ReceiveFrameCallback aCallback, void *aCallbackContext, RxFrameBuffer &aFrameBuffer);
+
+    /**
+     * Deinitializes the interface to the RCP.
+     */
+    void Deinit(void);
+
+    /**
+     * Sends a spinel frame to Radio Co-processor (RCP) over the shared-memory ring.
+     *
+     * @param[in] aFrame     A pointer to buffer containing the spinel frame to send.
+     * @param[in] aLength    The length (number of bytes) in the frame.
+     *
+     * @retval OT_ERROR_NONE     Successfully sent the spinel frame.
+     * @retval OT_ERROR_NO_BUFS  Insufficient ring space available to hold the frame.
+     * @retval OT_ERROR_FAILED   Failed to ring the transmit doorbell.
+     */
+    otError SendFrame(const uint8_t *aFrame, uint16_t aLength);
+
+    /**
+     * Waits for receiving part or all of spinel frame within specified interval.
+     *
+     * @param[in]  aTimeout  The timeout value in microseconds.
+     *
+     * @retval OT_ERROR_NONE             Part or all of spinel frame is received.
+     * @retval OT_ERROR_RESPONSE_TIMEOUT No spinel frame is received within @p aTimeout.
+     */
+    otError WaitForFrame(uint64_t aTimeoutUs);
+
+    /**
+     * Updates the file descriptor sets with file descriptors used by the radio driver.
+     *
+     * @param[in,out]   aMainloopContext  A pointer to the mainloop context containing fd_sets.
+     */
+    void UpdateFdSet(void *aMainloopContext);
+
+    /**
+     * Performs radio driver processing.
+     *
+     * @param[in]   aMainloopContext  A pointer to the mainloop context containing fd_sets.
+     */
+    void Process(const void *aMainloopContext);
+
+    /**
+     * Returns the bus speed between the host and the radio.
+     *
+     * @returns   Bus speed in bits/second.
+     */
+    uint32_t GetBusSpeed(void) const { return ((mShmem != nullptr) ? kNominalBusSpeed : 0); }
+
+    /**
+     * Hardware resets the RCP.
+     *
+     * @retval OT_ERROR_NONE            Successfully reset the RCP.
+     * @retval OT_ERROR_NOT_IMPLEMENT   The hardware reset is not implemented.
+     */
+    otError HardwareReset(void) { return OT_ERROR_NOT_IMPLEMENTED; }
+
+    /**
+     * Returns the RCP interface metrics.
+     *
+     * @returns The RCP interface metrics.
+     */
+    const otRcpInterfaceMetrics *GetRcpInterfaceMetrics(void) const { return &mInterfaceMetrics; }
+
+    /**
+     * Indicates whether or not the given interface matches this interface name.
+     *
+     * @param[in] aInterfaceName A pointer to the interface name.
+     *
+     * @retval TRUE   The given interface name matches this interface name.
+     * @retval FALSE  The given interface name doesn't match this interface name.
+     */
+    static bool IsInterfaceNameMatch(const char *aInterfaceName)
+    {
+        static const char kInterfaceName[] = "spinel+shmem";
+        return (strncmp(aInterfaceName, kInterfaceName, strlen(kInterfaceName)) == 0);
+    }
+
+private:
+    enum
+    {
+        kShmemMagic      = 0x53504e4c, ///< Magic word marking an initialized region ("SPNL").
+        kShmemVersion    = 1,          ///< Shared-memory layout version.
+        kFrameLengthSize = sizeof(uint16_t),
+        kRingBufferSize  = kMaxFrameSize * 2,
+        kNominalBusSpeed = 1000000000,
+    };
+
+    /**
+     * Represents a single-producer single-consumer byte ring.
+     *
+     * The producer advances `mWriteIndex` after copying bytes in, the consumer advances `mReadIndex` after
+     * copying bytes out; both indexes stay in `[0, kRingBufferSize)`. The ring is empty when the indexes are
+     * equal, so at most `kRingBufferSize - 1` bytes can be in flight.
+     */
+    struct RingBuffer
+    {
+        volatile uint32_t mWriteIndex;
+        volatile uint32_t mReadIndex;
+        uint8_t           mBuffer[kRingBufferSize];
+    };
+
+    /**
+     * Represents the layout of the shared-memory region.
+     */
+    struct ShmemLayout
+    {
+        uint32_t   mMagic;
+        uint32_t   mVersion;
+        RingBuffer mTxRing; ///< Host to RCP.
+        RingBuffer mRxRing; ///< RCP to host.
+    };
+
+    static uint32_t GetUsedSize(const RingBuffer &aRing);
+
+    void    WriteRing(RingBuffer &aRing, const uint8_t *aBuffer, uint16_t aLength);
+    void    ReadRing(const RingBuffer &aRing, uint32_t aOffset, uint8_t *aBuffer, uint16_t aLength);
+    otError RingDoorbell(void);
+    void    Read(void);
+    otError PopRxFrame(void);
+
+    ReceiveFrameCallback mReceiveFrameCallback;
+    void                *mReceiveFrameContext;
+    RxFrameBuffer       *mRxFrameBuffer;
+    const Url::Url      &mRadioUrl;
+
+    ShmemLayout *mShmem;
+    int          mShmemFd;
+    int          mTxDoorbellFd;
+    int          mRxDoorbellFd;
+
+    otRcpInterfaceMetrics mInterfaceMetrics;
+
+    // Non-copyable, intentionally not implemented.
+    ShmemInterface(const ShmemInterface &);
+    ShmemInterface &operator=(const ShmemInterface &);
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OT_POSIX_PLATFORM_SHMEM_INTERFACE_HPP_
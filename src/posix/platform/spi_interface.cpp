@@ -82,17 +82,21 @@ SpiInterface::SpiInterface(const Url::Url &aRadioUrl)
     , mSpiTxPayloadSize(0)
     , mDidPrintRateLimitLog(false)
     , mSpiSlaveDataLen(0)
+    , mSpiRxFrameSizeHistoryIndex(0)
     , mDidRxFrame(false)
 {
+    memset(mSpiRxFrameSizeHistory, 0, sizeof(mSpiRxFrameSizeHistory));
 }
 
 void SpiInterface::ResetStates(void)
 {
-    mSpiTxIsReady         = false;
-    mSpiTxRefusedCount    = 0;
-    mSpiTxPayloadSize     = 0;
-    mDidPrintRateLimitLog = false;
-    mSpiSlaveDataLen      = 0;
+    mSpiTxIsReady               = false;
+    mSpiTxRefusedCount          = 0;
+    mSpiTxPayloadSize           = 0;
+    mDidPrintRateLimitLog       = false;
+    mSpiSlaveDataLen            = 0;
+    mSpiRxFrameSizeHistoryIndex = 0;
+    memset(mSpiRxFrameSizeHistory, 0, sizeof(mSpiRxFrameSizeHistory));
     memset(mSpiTxFrameBuffer, 0, sizeof(mSpiTxFrameBuffer));
     memset(&mInterfaceMetrics, 0, sizeof(mInterfaceMetrics));
     mInterfaceMetrics.mRcpInterfaceType = kSpinelInterfaceTypeSpi;
@@ -434,9 +438,10 @@ otError SpiInterface::PushPullSpi(void)
     }
     else
     {
-        // Set up a minimum transfer size to allow small frames the slave wants to send us to be handled in a
-        // single transaction.
-        spiTransferBytes = OT_MAX(spiTransferBytes, mSpiSmallPacketSize);
+        // Set up a speculative transfer size, based on the sizes of recently received frames, to allow frames
+        // the slave wants to send us to be handled in a single transaction instead of a length-discovery
+        // transfer followed by a second transfer for the data.
+        spiTransferBytes = OT_MAX(spiTransferBytes, GetSpeculativeAcceptLen());
     }
 
     txFrame.SetHeaderAcceptLen(spiTransferBytes);
@@ -549,6 +554,8 @@ otError SpiInterface::PushPullSpi(void)
             mInterfaceMetrics.mRxFrameCount++;
             successfulExchanges++;
 
+            RecordRxFrameSize(rxFrame.GetHeaderDataLen());
+
             // Set the skip length to skip align bytes and SPI frame header.
             SuccessOrExit(error = mRxFrameBuffer->SetSkipLength(skipAlignAllowanceLength + kSpiFrameHeaderSize));
             // Set the received frame length.
@@ -607,6 +614,24 @@ exit:
     return error;
 }
 
+uint16_t SpiInterface::GetSpeculativeAcceptLen(void) const
+{
+    uint16_t len = mSpiSmallPacketSize;
+
+    for (uint16_t size : mSpiRxFrameSizeHistory)
+    {
+        len = OT_MAX(len, size);
+    }
+
+    return len;
+}
+
+void SpiInterface::RecordRxFrameSize(uint16_t aSize)
+{
+    mSpiRxFrameSizeHistory[mSpiRxFrameSizeHistoryIndex] = aSize;
+    mSpiRxFrameSizeHistoryIndex = static_cast<uint8_t>((mSpiRxFrameSizeHistoryIndex + 1) % kSpiFrameSizeHistorySize);
+}
+
 bool SpiInterface::CheckInterrupt(void) { return (GetGpioValue(mIntGpioValueFd) == kGpioIntAssertState); }
 
 void SpiInterface::UpdateFdSet(void *aMainloopContext)
@@ -177,6 +177,9 @@ private:
     otError  DoSpiTransfer(uint8_t *aSpiRxFrameBuffer, uint32_t aTransferLength);
     otError  PushPullSpi(void);
 
+    uint16_t GetSpeculativeAcceptLen(void) const;
+    void     RecordRxFrameSize(uint16_t aSize);
+
     bool CheckInterrupt(void);
     void LogStats(void);
     void LogError(const char *aString);
@@ -195,6 +198,8 @@ private:
         kDebugBytesPerLine    = 16,
         kGpioIntAssertState   = 0,
         kGpioResetAssertState = 0,
+
+        kSpiFrameSizeHistorySize = 8, ///< Number of recent rx frame sizes tracked for speculative transfer sizing.
     };
 
     enum
@@ -236,6 +241,9 @@ private:
     bool     mDidPrintRateLimitLog;
     uint16_t mSpiSlaveDataLen;
 
+    uint16_t mSpiRxFrameSizeHistory[kSpiFrameSizeHistorySize];
+    uint8_t  mSpiRxFrameSizeHistoryIndex;
+
     bool mDidRxFrame;
 
     otRcpInterfaceMetrics mInterfaceMetrics;
@@ -35,6 +35,7 @@
 #include "lib/spinel/spinel_driver.hpp"
 #include "posix/platform/hdlc_interface.hpp"
 #include "posix/platform/radio_url.hpp"
+#include "posix/platform/shmem_interface.hpp"
 #include "posix/platform/spi_interface.hpp"
 #include "posix/platform/spinel_driver_getter.hpp"
 #include "posix/platform/vendor_interface.hpp"
@@ -49,54 +50,57 @@ Spinel::SpinelDriver &GetSpinelDriver(void) { return sSpinelManager.GetSpinelDri
 
 SpinelManager &SpinelManager::GetSpinelManager(void) { return sSpinelManager; }
 
-SpinelManager::SpinelManager(void)
-    : mUrl(nullptr)
-    , mSpinelDriver()
-    , mSpinelInterface(nullptr)
-{
-}
+SpinelManager::SpinelManager(void) {}
 
 SpinelManager::~SpinelManager(void) { Deinit(); }
 
-CoprocessorType SpinelManager::Init(const char *aUrl)
+CoprocessorType SpinelManager::InitInstance(uint8_t aInstanceIndex, const char *aUrl)
 {
     bool            swReset;
     spinel_iid_t    iidList[Spinel::kSpinelHeaderMaxNumIid];
     CoprocessorType mode;
+    SpinelInstance &instance = mInstances[aInstanceIndex];
 
-    mUrl.Init(aUrl);
-    VerifyOrDie(mUrl.GetPath() != nullptr, OT_EXIT_INVALID_ARGUMENTS);
+    assert(aInstanceIndex < kMaxSpinelInstances);
 
-    GetIidListFromUrl(iidList);
+    instance.mUrl.Init(aUrl);
+    VerifyOrDie(instance.mUrl.GetPath() != nullptr, OT_EXIT_INVALID_ARGUMENTS);
+
+    GetIidListFromUrl(instance.mUrl, iidList);
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
-    VirtualTimeInit();
+    VirtualTimeInit(instance);
 #endif
 
-    mSpinelInterface = CreateSpinelInterface(mUrl.GetProtocol());
-    VerifyOrDie(mSpinelInterface != nullptr, OT_EXIT_FAILURE);
+    instance.mSpinelInterface = CreateSpinelInterface(instance, instance.mUrl.GetProtocol());
+    VerifyOrDie(instance.mSpinelInterface != nullptr, OT_EXIT_FAILURE);
 
-    swReset = !mUrl.HasParam("no-reset");
+    swReset = !instance.mUrl.HasParam("no-reset");
 
-    mode = mSpinelDriver.Init(*mSpinelInterface, swReset, iidList, OT_ARRAY_LENGTH(iidList));
+    mode = instance.mSpinelDriver.Init(*instance.mSpinelInterface, swReset, iidList, OT_ARRAY_LENGTH(iidList));
 
-    otLogDebgPlat("instance init:%p - iid = %d", (void *)&mSpinelDriver, iidList[0]);
+    otLogDebgPlat("instance init:%p - iid = %d", (void *)&instance.mSpinelDriver, iidList[0]);
 
     return mode;
 }
 
 void SpinelManager::Deinit(void)
 {
-    if (mSpinelInterface != nullptr)
+    for (uint8_t i = 0; i < kMaxSpinelInstances; i++)
     {
-        mSpinelInterface->Deinit();
-        mSpinelInterface = nullptr;
-    }
+        SpinelInstance &instance = mInstances[i];
+
+        if (instance.mSpinelInterface != nullptr)
+        {
+            instance.mSpinelInterface->Deinit();
+            instance.mSpinelInterface = nullptr;
+        }
 
-    mSpinelDriver.Deinit();
+        instance.mSpinelDriver.Deinit();
+    }
 }
 
-Spinel::SpinelInterface *SpinelManager::CreateSpinelInterface(const char *aInterfaceName)
+Spinel::SpinelInterface *SpinelManager::CreateSpinelInterface(SpinelInstance &aInstance, const char *aInterfaceName)
 {
     Spinel::SpinelInterface *interface;
 
@@ -107,19 +111,25 @@ Spinel::SpinelInterface *SpinelManager::CreateSpinelInterface(const char *aInter
 #if OPENTHREAD_POSIX_CONFIG_SPINEL_HDLC_INTERFACE_ENABLE
     else if (HdlcInterface::IsInterfaceNameMatch(aInterfaceName))
     {
-        interface = new (&mSpinelInterfaceRaw) HdlcInterface(mUrl);
+        interface = new (&aInstance.mSpinelInterfaceRaw) HdlcInterface(aInstance.mUrl);
     }
 #endif
 #if OPENTHREAD_POSIX_CONFIG_SPINEL_SPI_INTERFACE_ENABLE
     else if (Posix::SpiInterface::IsInterfaceNameMatch(aInterfaceName))
     {
-        interface = new (&mSpinelInterfaceRaw) SpiInterface(mUrl);
+        interface = new (&aInstance.mSpinelInterfaceRaw) SpiInterface(aInstance.mUrl);
+    }
+#endif
+#if OPENTHREAD_POSIX_CONFIG_SPINEL_SHMEM_INTERFACE_ENABLE
+    else if (ShmemInterface::IsInterfaceNameMatch(aInterfaceName))
+    {
+        interface = new (&aInstance.mSpinelInterfaceRaw) ShmemInterface(aInstance.mUrl);
     }
 #endif
 #if OPENTHREAD_POSIX_CONFIG_SPINEL_VENDOR_INTERFACE_ENABLE
     else if (VendorInterface::IsInterfaceNameMatch(aInterfaceName))
     {
-        interface = new (&mSpinelInterfaceRaw) VendorInterface(mUrl);
+        interface = new (&aInstance.mSpinelInterfaceRaw) VendorInterface(aInstance.mUrl);
     }
 #endif
     else
@@ -131,15 +141,15 @@ Spinel::SpinelInterface *SpinelManager::CreateSpinelInterface(const char *aInter
     return interface;
 }
 
-void SpinelManager::GetIidListFromUrl(spinel_iid_t (&aIidList)[Spinel::kSpinelHeaderMaxNumIid])
+void SpinelManager::GetIidListFromUrl(const RadioUrl &aUrl, spinel_iid_t (&aIidList)[Spinel::kSpinelHeaderMaxNumIid])
 {
     const char *iidString;
     const char *iidListString;
 
     memset(aIidList, SPINEL_HEADER_INVALID_IID, sizeof(aIidList));
 
-    iidString     = mUrl.GetValue("iid");
-    iidListString = mUrl.GetValue("iid-list");
+    iidString     = aUrl.GetValue("iid");
+    iidListString = aUrl.GetValue("iid-list");
 
 #if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
     // First entry to the aIidList must be the IID of the host application.
@@ -179,12 +189,12 @@ void SpinelManager::GetIidListFromUrl(spinel_iid_t (&aIidList)[Spinel::kSpinelHe
 }
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
-void SpinelManager::VirtualTimeInit(void)
+void SpinelManager::VirtualTimeInit(const SpinelInstance &aInstance)
 {
     // The last argument must be the node id
     const char *nodeId = nullptr;
 
-    for (const char *arg = nullptr; (arg = mUrl.GetValue("forkpty-arg", arg)) != nullptr; nodeId = arg)
+    for (const char *arg = nullptr; (arg = aInstance.mUrl.GetValue("forkpty-arg", arg)) != nullptr; nodeId = arg)
     {
     }
 
@@ -203,24 +213,45 @@ void platformSpinelManagerDeinit(void) { return sSpinelManager.Deinit(); }
 void virtualTimeSpinelProcess(otInstance *aInstance, const struct VirtualTimeEvent *aEvent)
 {
     OT_UNUSED_VARIABLE(aInstance);
-    ot::Posix::GetSpinelDriver().Process(aEvent);
+
+    for (uint8_t i = 0; i < ot::Posix::SpinelManager::kMaxSpinelInstances; i++)
+    {
+        if (sSpinelManager.IsInstanceInitialized(i))
+        {
+            sSpinelManager.GetSpinelDriver(i).Process(aEvent);
+        }
+    }
 }
 #else
 void platformSpinelManagerProcess(otInstance *aInstance, const otSysMainloopContext *aContext)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    ot::Posix::GetSpinelDriver().Process(aContext);
+    for (uint8_t i = 0; i < ot::Posix::SpinelManager::kMaxSpinelInstances; i++)
+    {
+        if (sSpinelManager.IsInstanceInitialized(i))
+        {
+            sSpinelManager.GetSpinelDriver(i).Process(aContext);
+        }
+    }
 }
 #endif // OPENTHREAD_POSIX_VIRTUAL_TIME
 
 void platformSpinelManagerUpdateFdSet(otSysMainloopContext *aContext)
 {
-    sSpinelManager.GetSpinelInterface().UpdateFdSet(aContext);
-
-    if (ot::Posix::GetSpinelDriver().HasPendingFrame())
+    for (uint8_t i = 0; i < ot::Posix::SpinelManager::kMaxSpinelInstances; i++)
     {
-        aContext->mTimeout.tv_sec  = 0;
-        aContext->mTimeout.tv_usec = 0;
+        if (!sSpinelManager.IsInstanceInitialized(i))
+        {
+            continue;
+        }
+
+        sSpinelManager.GetSpinelInterface(i).UpdateFdSet(aContext);
+
+        if (sSpinelManager.GetSpinelDriver(i).HasPendingFrame())
+        {
+            aContext->mTimeout.tv_sec  = 0;
+            aContext->mTimeout.tv_usec = 0;
+        }
     }
 }
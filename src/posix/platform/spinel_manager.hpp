@@ -29,12 +29,15 @@
 #ifndef OT_POSIX_PLATFORM_SPINEL_MANAGER_HPP_
 #define OT_POSIX_PLATFORM_SPINEL_MANAGER_HPP_
 
+#include "openthread-posix-config.h"
+
 #include <assert.h>
 
 #include "common/code_utils.hpp"
 #include "lib/spinel/spinel_driver.hpp"
 #include "posix/platform/hdlc_interface.hpp"
 #include "posix/platform/radio_url.hpp"
+#include "posix/platform/shmem_interface.hpp"
 #include "posix/platform/spi_interface.hpp"
 #include "posix/platform/vendor_interface.hpp"
 
@@ -44,6 +47,11 @@ namespace Posix {
 class SpinelManager
 {
 public:
+    /**
+     * Maximum number of spinel instances (driver and interface pairs) the manager can drive.
+     */
+    static constexpr uint8_t kMaxSpinelInstances = OPENTHREAD_POSIX_CONFIG_SPINEL_INSTANCE_COUNT;
+
     /**
      * Returns the static instance of the SpinelManager.
      */
@@ -52,7 +60,20 @@ public:
     /**
      * Returns the static instance of the SpinelDriver.
      */
-    Spinel::SpinelDriver &GetSpinelDriver(void) { return mSpinelDriver; }
+    Spinel::SpinelDriver &GetSpinelDriver(void) { return GetSpinelDriver(0); }
+
+    /**
+     * Returns the SpinelDriver of a given spinel instance.
+     *
+     * @param[in]   aInstanceIndex  The spinel instance index.
+     *
+     * @returns The SpinelDriver of the given spinel instance.
+     */
+    Spinel::SpinelDriver &GetSpinelDriver(uint8_t aInstanceIndex)
+    {
+        assert(aInstanceIndex < kMaxSpinelInstances);
+        return mInstances[aInstanceIndex].mSpinelDriver;
+    }
 
     /**
      * Constructor of the SpinelManager
@@ -73,7 +94,21 @@ public:
      * @retval  OT_COPROCESSOR_RCP      The Co-processor is a RCP.
      * @retval  OT_COPROCESSOR_NCP      The Co-processor is a NCP.
      */
-    CoprocessorType Init(const char *aUrl);
+    CoprocessorType Init(const char *aUrl) { return InitInstance(0, aUrl); }
+
+    /**
+     * Initializes a given spinel instance.
+     *
+     * Instance zero drives the OpenThread stack co-processor; additional instances are available to vendor code.
+     *
+     * @param[in]   aInstanceIndex  The spinel instance index.
+     * @param[in]   aUrl            A pointer to the null-terminated spinel URL.
+     *
+     * @retval  OT_COPROCESSOR_UNKNOWN  The initialization fails.
+     * @retval  OT_COPROCESSOR_RCP      The Co-processor is a RCP.
+     * @retval  OT_COPROCESSOR_NCP      The Co-processor is a NCP.
+     */
+    CoprocessorType InitInstance(uint8_t aInstanceIndex, const char *aUrl);
 
     /**
      * Deinitializes the SpinelManager.
@@ -85,20 +120,36 @@ public:
      *
      * @returns The spinel interface.
      */
-    Spinel::SpinelInterface &GetSpinelInterface(void)
+    Spinel::SpinelInterface &GetSpinelInterface(void) { return GetSpinelInterface(0); }
+
+    /**
+     * Returns the spinel interface of a given spinel instance.
+     *
+     * @param[in]   aInstanceIndex  The spinel instance index.
+     *
+     * @returns The spinel interface of the given spinel instance.
+     */
+    Spinel::SpinelInterface &GetSpinelInterface(uint8_t aInstanceIndex)
     {
-        assert(mSpinelInterface != nullptr);
-        return *mSpinelInterface;
+        assert(aInstanceIndex < kMaxSpinelInstances);
+        assert(mInstances[aInstanceIndex].mSpinelInterface != nullptr);
+        return *mInstances[aInstanceIndex].mSpinelInterface;
     }
 
-private:
-#if OPENTHREAD_POSIX_VIRTUAL_TIME
-    void VirtualTimeInit(void);
-#endif
-    void GetIidListFromUrl(spinel_iid_t (&aIidList)[Spinel::kSpinelHeaderMaxNumIid]);
-
-    Spinel::SpinelInterface *CreateSpinelInterface(const char *aInterfaceName);
+    /**
+     * Indicates whether a given spinel instance has been initialized.
+     *
+     * @param[in]   aInstanceIndex  The spinel instance index.
+     *
+     * @retval TRUE   The spinel instance is initialized.
+     * @retval FALSE  The spinel instance is not initialized.
+     */
+    bool IsInstanceInitialized(uint8_t aInstanceIndex) const
+    {
+        return (aInstanceIndex < kMaxSpinelInstances) && (mInstances[aInstanceIndex].mSpinelInterface != nullptr);
+    }
 
+private:
 #if OPENTHREAD_POSIX_CONFIG_SPINEL_HDLC_INTERFACE_ENABLE && OPENTHREAD_POSIX_CONFIG_SPINEL_SPI_INTERFACE_ENABLE
     static constexpr size_t kSpinelInterfaceRawSize = sizeof(Posix::SpiInterface) > sizeof(Posix::HdlcInterface)
                                                           ? sizeof(Posix::SpiInterface)
@@ -107,17 +158,38 @@ private:
     static constexpr size_t kSpinelInterfaceRawSize = sizeof(Posix::HdlcInterface);
 #elif OPENTHREAD_POSIX_CONFIG_SPINEL_SPI_INTERFACE_ENABLE
     static constexpr size_t kSpinelInterfaceRawSize = sizeof(Posix::SpiInterface);
+#elif OPENTHREAD_POSIX_CONFIG_SPINEL_SHMEM_INTERFACE_ENABLE
+    static constexpr size_t kSpinelInterfaceRawSize = sizeof(Posix::ShmemInterface);
 #elif OPENTHREAD_POSIX_CONFIG_SPINEL_VENDOR_INTERFACE_ENABLE
     static constexpr size_t kSpinelInterfaceRawSize = sizeof(Posix::VendorInterface);
 #else
 #error "No Spinel interface is specified!"
 #endif
 
-    RadioUrl                 mUrl;
-    Spinel::SpinelDriver     mSpinelDriver;
-    Spinel::SpinelInterface *mSpinelInterface;
+    struct SpinelInstance
+    {
+        SpinelInstance(void)
+            : mUrl(nullptr)
+            , mSpinelDriver()
+            , mSpinelInterface(nullptr)
+        {
+        }
+
+        RadioUrl                 mUrl;
+        Spinel::SpinelDriver     mSpinelDriver;
+        Spinel::SpinelInterface *mSpinelInterface;
+
+        OT_DEFINE_ALIGNED_VAR(mSpinelInterfaceRaw, kSpinelInterfaceRawSize, uint64_t);
+    };
+
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+    void VirtualTimeInit(const SpinelInstance &aInstance);
+#endif
+    void GetIidListFromUrl(const RadioUrl &aUrl, spinel_iid_t (&aIidList)[Spinel::kSpinelHeaderMaxNumIid]);
+
+    Spinel::SpinelInterface *CreateSpinelInterface(SpinelInstance &aInstance, const char *aInterfaceName);
 
-    OT_DEFINE_ALIGNED_VAR(mSpinelInterfaceRaw, kSpinelInterfaceRawSize, uint64_t);
+    SpinelInstance mInstances[kMaxSpinelInstances];
 };
 
 } // namespace Posix
@@ -37,6 +37,11 @@
 
 #include <assert.h>
 #include <inttypes.h>
+#include <stdarg.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
 
 #include <openthread-core-config.h>
 #include <openthread/border_router.h>
@@ -429,6 +434,193 @@ void otSysMainloopUpdate(otInstance *aInstance, otSysMainloopContext *aMainloop)
     }
 }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_STALL_THRESHOLD_MS
+
+static void LogWarn(const char *aFormat, ...) OT_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(1, 2);
+
+static void LogWarn(const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    otLogPlatArgs(OT_LOG_LEVEL_WARN, "System", aFormat, args);
+    va_end(args);
+}
+
+static void logDispatchStall(uint64_t aDuration, const otSysMainloopContext *aMainloop)
+{
+    char   fdListString[64];
+    size_t length = 0;
+
+    fdListString[0] = '\0';
+
+    for (int fd = 0; (fd <= aMainloop->mMaxFd) && (length < sizeof(fdListString) - 8); fd++)
+    {
+        if (FD_ISSET(fd, &aMainloop->mReadFdSet) || FD_ISSET(fd, &aMainloop->mWriteFdSet))
+        {
+            length += static_cast<size_t>(snprintf(&fdListString[length], sizeof(fdListString) - length, " %d", fd));
+        }
+    }
+
+    LogWarn("Mainloop dispatch took %lu ms, ready fds:%s", static_cast<unsigned long>(aDuration / OT_US_PER_MS),
+            fdListString);
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_STALL_THRESHOLD_MS
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && defined(__linux__) && !OPENTHREAD_POSIX_VIRTUAL_TIME
+
+static constexpr int      kEpollMaxEvents    = 64; ///< Maximum events retrieved per `epoll_wait()` call.
+static constexpr uint32_t kEpollResyncPeriod = 64; ///< Full re-registration period (in mainloop iterations).
+
+static int      sEpollFd         = -1;
+static bool     sEpollFailed     = false;
+static int      sEpollMaxFd      = -1;
+static uint32_t sEpollIterations = 0;
+static fd_set   sEpollReadFdSet;
+static fd_set   sEpollWriteFdSet;
+static fd_set   sEpollErrorFdSet;
+
+static bool epollCtl(int aOperation, int aFd, uint32_t aEvents)
+{
+    struct epoll_event event;
+
+    memset(&event, 0, sizeof(event));
+    event.events  = aEvents;
+    event.data.fd = aFd;
+
+    return epoll_ctl(sEpollFd, aOperation, aFd, &event) == 0;
+}
+
+static bool epollSyncFd(int aFd, const otSysMainloopContext &aMainloop)
+{
+    bool ok            = true;
+    bool wantRead      = FD_ISSET(aFd, &aMainloop.mReadFdSet);
+    bool wantWrite     = FD_ISSET(aFd, &aMainloop.mWriteFdSet);
+    bool want          = wantRead || wantWrite || FD_ISSET(aFd, &aMainloop.mErrorFdSet);
+    bool wasRegistered = FD_ISSET(aFd, &sEpollReadFdSet) || FD_ISSET(aFd, &sEpollWriteFdSet) ||
+                         FD_ISSET(aFd, &sEpollErrorFdSet);
+    // `EPOLLERR` is always reported for registered fds and needs no bit in the event mask.
+    uint32_t events =
+        (wantRead ? static_cast<uint32_t>(EPOLLIN) : 0) | (wantWrite ? static_cast<uint32_t>(EPOLLOUT) : 0);
+
+    if (want)
+    {
+        if (wasRegistered)
+        {
+            // `ENOENT` indicates the fd was closed (which removes it from the epoll instance) and its
+            // number reused since the last sync.
+            ok = epollCtl(EPOLL_CTL_MOD, aFd, events) || ((errno == ENOENT) && epollCtl(EPOLL_CTL_ADD, aFd, events));
+        }
+        else
+        {
+            ok = epollCtl(EPOLL_CTL_ADD, aFd, events) || ((errno == EEXIST) && epollCtl(EPOLL_CTL_MOD, aFd, events));
+        }
+    }
+    else if (wasRegistered)
+    {
+        // Failure (e.g. the fd is already closed) leaves no kernel state behind and is not an error.
+        epollCtl(EPOLL_CTL_DEL, aFd, 0);
+    }
+
+    return ok;
+}
+
+static bool epollSyncInterest(const otSysMainloopContext &aMainloop)
+{
+    bool ok = true;
+    bool changed;
+
+    changed = (aMainloop.mMaxFd != sEpollMaxFd) ||
+              (memcmp(&aMainloop.mReadFdSet, &sEpollReadFdSet, sizeof(fd_set)) != 0) ||
+              (memcmp(&aMainloop.mWriteFdSet, &sEpollWriteFdSet, sizeof(fd_set)) != 0) ||
+              (memcmp(&aMainloop.mErrorFdSet, &sEpollErrorFdSet, sizeof(fd_set)) != 0);
+
+    // A closed fd is removed from the epoll instance by the kernel. If its number is reused while the fd
+    // sets stay bit-identical, the comparison above cannot detect it, so periodically force a full
+    // re-registration as a backstop.
+    if ((++sEpollIterations % kEpollResyncPeriod) == 0)
+    {
+        changed = true;
+    }
+
+    VerifyOrExit(changed);
+
+    for (int fd = 0; fd <= OT_MAX(aMainloop.mMaxFd, sEpollMaxFd); fd++)
+    {
+        ok = epollSyncFd(fd, aMainloop) && ok;
+    }
+
+    sEpollReadFdSet  = aMainloop.mReadFdSet;
+    sEpollWriteFdSet = aMainloop.mWriteFdSet;
+    sEpollErrorFdSet = aMainloop.mErrorFdSet;
+    sEpollMaxFd      = aMainloop.mMaxFd;
+
+exit:
+    return ok;
+}
+
+static int epollPoll(otSysMainloopContext &aMainloop)
+{
+    int                rval = -1;
+    uint64_t           timeout;
+    int                timeoutMs;
+    struct epoll_event events[kEpollMaxEvents];
+
+    if (sEpollFd < 0)
+    {
+        FD_ZERO(&sEpollReadFdSet);
+        FD_ZERO(&sEpollWriteFdSet);
+        FD_ZERO(&sEpollErrorFdSet);
+        sEpollMaxFd = -1;
+        sEpollFd    = epoll_create1(EPOLL_CLOEXEC);
+        VerifyOrExit(sEpollFd >= 0, sEpollFailed = true);
+    }
+
+    if (!epollSyncInterest(aMainloop))
+    {
+        close(sEpollFd);
+        sEpollFd     = -1;
+        sEpollFailed = true;
+        ExitNow();
+    }
+
+    timeout   = (ot::Posix::Mainloop::GetTimeout(aMainloop) + OT_US_PER_MS - 1) / OT_US_PER_MS;
+    timeoutMs = (timeout > INT32_MAX) ? INT32_MAX : static_cast<int>(timeout);
+
+    rval = epoll_wait(sEpollFd, events, kEpollMaxEvents, timeoutMs);
+    VerifyOrExit(rval >= 0);
+
+    FD_ZERO(&aMainloop.mReadFdSet);
+    FD_ZERO(&aMainloop.mWriteFdSet);
+    FD_ZERO(&aMainloop.mErrorFdSet);
+
+    for (int i = 0; i < rval; i++)
+    {
+        int fd = events[i].data.fd;
+
+        if (events[i].events & (EPOLLIN | EPOLLHUP))
+        {
+            FD_SET(fd, &aMainloop.mReadFdSet);
+        }
+
+        if (events[i].events & EPOLLOUT)
+        {
+            FD_SET(fd, &aMainloop.mWriteFdSet);
+        }
+
+        if (events[i].events & EPOLLERR)
+        {
+            FD_SET(fd, &aMainloop.mErrorFdSet);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && defined(__linux__) && !OPENTHREAD_POSIX_VIRTUAL_TIME
+
 int otSysMainloopPoll(otSysMainloopContext *aMainloop)
 {
     int rval;
@@ -465,8 +657,18 @@ int otSysMainloopPoll(otSysMainloopContext *aMainloop)
     else
 #endif
     {
-        rval = select(aMainloop->mMaxFd + 1, &aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
-                      &aMainloop->mTimeout);
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && defined(__linux__) && !OPENTHREAD_POSIX_VIRTUAL_TIME
+        if (!sEpollFailed)
+        {
+            rval = epollPoll(*aMainloop);
+        }
+
+        if (sEpollFailed)
+#endif
+        {
+            rval = select(aMainloop->mMaxFd + 1, &aMainloop->mReadFdSet, &aMainloop->mWriteFdSet,
+                          &aMainloop->mErrorFdSet, &aMainloop->mTimeout);
+        }
     }
 
     return rval;
@@ -474,6 +676,10 @@ int otSysMainloopPoll(otSysMainloopContext *aMainloop)
 
 void otSysMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMainloop)
 {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_STALL_THRESHOLD_MS
+    uint64_t dispatchStart = otPlatTimeGet();
+#endif
+
     ot::Posix::Mainloop::Manager::Get().Process(*aMainloop);
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
@@ -492,6 +698,17 @@ void otSysMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMa
 #if OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE
     platformResolverProcess(aMainloop);
 #endif
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_STALL_THRESHOLD_MS
+    {
+        uint64_t duration = otPlatTimeGet() - dispatchStart;
+
+        if (duration >= (OPENTHREAD_POSIX_CONFIG_MAINLOOP_STALL_THRESHOLD_MS * OT_US_PER_MS))
+        {
+            logDispatchStall(duration, aMainloop);
+        }
+    }
+#endif
 }
 
 bool IsSystemDryRun(void) { return gDryRun; }
@@ -274,6 +274,65 @@ exit:
     return error;
 }
 
+#ifdef __linux__
+
+static uint16_t SendPacketBatch(const otPlatTrelPacketInfo *aPackets, uint16_t aNumPackets)
+{
+    // Sends a batch of packets with a single `sendmmsg()` syscall,
+    // mapping the header and payload segments of each packet to a
+    // pair of `iovec` entries. Returns the number of packets accepted
+    // by the kernel. Returns zero when the send fails or would block,
+    // leaving it to the caller to retry/enqueue the remaining packets
+    // one by one.
+
+    static constexpr uint16_t kMaxBatch = 16;
+
+    struct mmsghdr      msgVec[kMaxBatch];
+    struct iovec        iovVec[kMaxBatch][2];
+    struct sockaddr_in6 sockAddrs[kMaxBatch];
+    uint16_t            num = (aNumPackets < kMaxBatch) ? aNumPackets : kMaxBatch;
+    int                 ret;
+
+    for (uint16_t index = 0; index < num; index++)
+    {
+        const otPlatTrelPacketInfo *info = &aPackets[index];
+
+        memset(&sockAddrs[index], 0, sizeof(sockAddrs[index]));
+        sockAddrs[index].sin6_family = AF_INET6;
+        sockAddrs[index].sin6_port   = htons(info->mDestSockAddr->mPort);
+        memcpy(&sockAddrs[index].sin6_addr, &info->mDestSockAddr->mAddress, sizeof(otIp6Address));
+
+        iovVec[index][0].iov_base = const_cast<uint8_t *>(info->mHeader);
+        iovVec[index][0].iov_len  = info->mHeaderLength;
+        iovVec[index][1].iov_base = const_cast<uint8_t *>(info->mPayload);
+        iovVec[index][1].iov_len  = info->mPayloadLength;
+
+        memset(&msgVec[index], 0, sizeof(msgVec[index]));
+        msgVec[index].msg_hdr.msg_name    = &sockAddrs[index];
+        msgVec[index].msg_hdr.msg_namelen = sizeof(sockAddrs[index]);
+        msgVec[index].msg_hdr.msg_iov     = iovVec[index];
+        msgVec[index].msg_hdr.msg_iovlen  = (info->mPayloadLength != 0) ? 2 : 1;
+    }
+
+    ret = sendmmsg(sSocket, msgVec, num, 0);
+
+    if (ret < 0)
+    {
+        LogDebg("SendPacketBatch() -- sendmmsg() failed errno %d", errno);
+        ret = 0;
+    }
+
+    for (int index = 0; index < ret; index++)
+    {
+        ++sCounters.mTxPackets;
+        sCounters.mTxBytes += msgVec[index].msg_len;
+    }
+
+    return static_cast<uint16_t>(ret);
+}
+
+#endif // __linux__
+
 static void ReceivePacket(int aSocket, otInstance *aInstance)
 {
     struct sockaddr_in6 sockAddr;
@@ -580,6 +639,60 @@ exit:
     return;
 }
 
+void otPlatTrelSendBatch(otInstance *aInstance, const otPlatTrelPacketInfo *aPackets, uint16_t aNumPackets)
+{
+    uint16_t index = 0;
+
+    OT_UNUSED_VARIABLE(aInstance);
+
+    VerifyOrExit(!IsSystemDryRun());
+
+    VerifyOrExit(sEnabled);
+
+#ifdef __linux__
+    while ((index < aNumPackets) && (sTxPacketQueueTail == NULL) && (sSocket >= 0))
+    {
+        uint16_t numSent = SendPacketBatch(&aPackets[index], aNumPackets - index);
+
+        if (numSent == 0)
+        {
+            break;
+        }
+
+        index += numSent;
+    }
+#endif
+
+    // Send any remaining packets one by one, merging the header and
+    // payload segments of each into a single buffer (enqueuing the
+    // packet to send later when the socket would block).
+
+    for (; index < aNumPackets; index++)
+    {
+        const otPlatTrelPacketInfo *info = &aPackets[index];
+        uint8_t                     buffer[kMaxPacketSize];
+        uint16_t                    length = info->mHeaderLength + info->mPayloadLength;
+
+        assert(length <= kMaxPacketSize);
+
+        memcpy(buffer, info->mHeader, info->mHeaderLength);
+
+        if (info->mPayloadLength != 0)
+        {
+            memcpy(buffer + info->mHeaderLength, info->mPayload, info->mPayloadLength);
+        }
+
+        if ((sTxPacketQueueTail != NULL) ||
+            (SendPacket(buffer, length, info->mDestSockAddr) == OT_ERROR_INVALID_STATE))
+        {
+            EnqueuePacket(buffer, length, info->mDestSockAddr);
+        }
+    }
+
+exit:
+    return;
+}
+
 void otPlatTrelNotifyPeerSocketAddressDifference(otInstance       *aInstance,
                                                  const otSockAddr *aPeerSockAddr,
                                                  const otSockAddr *aRxSockAddr)
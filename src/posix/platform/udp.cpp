@@ -174,30 +174,9 @@ exit:
     return error;
 }
 
-otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageInfo &aMessageInfo)
+void parseMessageInfo(struct msghdr &aMsg, const struct sockaddr_in6 &aPeerAddr, otMessageInfo &aMessageInfo)
 {
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kMaxUdpSize];
-    struct iovec        iov;
-    struct msghdr       msg;
-    ssize_t             rval;
-
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
-
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = sizeof(control);
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
-
-    rval = recvmsg(aFd, &msg, 0);
-    VerifyOrExit(rval > 0, perror("recvmsg"));
-    aLength = static_cast<uint16_t>(rval);
-
-    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&aMsg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&aMsg, cmsg))
     {
         if (cmsg->cmsg_level == IPPROTO_IPV6)
         {
@@ -220,13 +199,97 @@ otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageIn
         }
     }
 
-    aMessageInfo.mPeerPort = ntohs(peerAddr.sin6_port);
-    ReadIp6AddressFrom(&peerAddr.sin6_addr, aMessageInfo.mPeerAddr);
+    aMessageInfo.mPeerPort = ntohs(aPeerAddr.sin6_port);
+    ReadIp6AddressFrom(&aPeerAddr.sin6_addr, aMessageInfo.mPeerAddr);
+}
+
+#ifdef __linux__
+
+constexpr size_t kRxBatchSize   = 8;   ///< Maximum datagrams drained per `recvmmsg()` call.
+constexpr size_t kRxControlSize = 128; ///< Per-datagram ancillary data buffer size.
+
+// Reusable receive arena for `recvmmsg()` batches.
+struct RxBatch
+{
+    struct mmsghdr      mHeaders[kRxBatchSize];
+    struct iovec        mIovs[kRxBatchSize];
+    struct sockaddr_in6 mPeerAddrs[kRxBatchSize];
+    uint8_t             mControls[kRxBatchSize][kRxControlSize];
+    uint8_t             mPayloads[kRxBatchSize][kMaxUdpSize];
+};
+
+RxBatch sRxBatch;
+
+int receiveBatch(int aFd)
+{
+    for (size_t i = 0; i < kRxBatchSize; i++)
+    {
+        struct msghdr &msg = sRxBatch.mHeaders[i].msg_hdr;
+
+        sRxBatch.mIovs[i].iov_base = sRxBatch.mPayloads[i];
+        sRxBatch.mIovs[i].iov_len  = kMaxUdpSize;
+
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name       = &sRxBatch.mPeerAddrs[i];
+        msg.msg_namelen    = sizeof(sRxBatch.mPeerAddrs[i]);
+        msg.msg_control    = sRxBatch.mControls[i];
+        msg.msg_controllen = sizeof(sRxBatch.mControls[i]);
+        msg.msg_iov        = &sRxBatch.mIovs[i];
+        msg.msg_iovlen     = 1;
+    }
+
+    return recvmmsg(aFd, sRxBatch.mHeaders, kRxBatchSize, MSG_DONTWAIT, nullptr);
+}
+
+bool isSocketOpen(const otUdpSocket *aSocket, int aFd)
+{
+    bool open = false;
+
+    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
+    {
+        if ((socket == aSocket) && (socket->mHandle != nullptr) && (FdFromHandle(socket->mHandle) == aFd))
+        {
+            ExitNow(open = true);
+        }
+    }
+
+exit:
+    return open;
+}
+
+#else // __linux__
+
+otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageInfo &aMessageInfo)
+{
+    struct sockaddr_in6 peerAddr;
+    uint8_t             control[kMaxUdpSize];
+    struct iovec        iov;
+    struct msghdr       msg;
+    ssize_t             rval;
+
+    iov.iov_base = aPayload;
+    iov.iov_len  = aLength;
+
+    msg.msg_name       = &peerAddr;
+    msg.msg_namelen    = sizeof(peerAddr);
+    msg.msg_control    = control;
+    msg.msg_controllen = sizeof(control);
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_flags      = 0;
+
+    rval = recvmsg(aFd, &msg, 0);
+    VerifyOrExit(rval > 0, perror("recvmsg"));
+    aLength = static_cast<uint16_t>(rval);
+
+    parseMessageInfo(msg, peerAddr, aMessageInfo);
 
 exit:
     return rval > 0 ? OT_ERROR_NONE : OT_ERROR_FAILED;
 }
 
+#endif // __linux__
+
 } // namespace
 
 otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
@@ -631,6 +694,52 @@ void Udp::Process(const Mainloop::Context &aContext)
 
         if (fd > 0 && Mainloop::IsFdReadable(fd, aContext))
         {
+#ifdef __linux__
+            int count = receiveBatch(fd);
+
+            if (count < 0)
+            {
+                if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+                {
+                    perror("recvmmsg");
+                }
+
+                continue;
+            }
+
+            for (int i = 0; i < count; i++)
+            {
+                otMessageInfo messageInfo;
+                otMessage    *message = nullptr;
+                uint16_t      length  = static_cast<uint16_t>(sRxBatch.mHeaders[i].msg_len);
+
+                // The handler may close the socket while processing an earlier datagram in the batch.
+                if ((i > 0) && !isSocketOpen(socket, fd))
+                {
+                    break;
+                }
+
+                memset(&messageInfo, 0, sizeof(messageInfo));
+                messageInfo.mSockPort = socket->mSockName.mPort;
+                parseMessageInfo(sRxBatch.mHeaders[i].msg_hdr, sRxBatch.mPeerAddrs[i], messageInfo);
+
+                message = otUdpNewMessage(gInstance, &msgSettings);
+
+                if (message == nullptr)
+                {
+                    break;
+                }
+
+                if (otMessageAppend(message, sRxBatch.mPayloads[i], length) != OT_ERROR_NONE)
+                {
+                    otMessageFree(message);
+                    continue;
+                }
+
+                socket->mHandler(socket->mContext, message, &messageInfo);
+                otMessageFree(message);
+            }
+#else
             otMessageInfo messageInfo;
             otMessage    *message = nullptr;
             uint8_t       payload[kMaxUdpSize];
@@ -659,6 +768,7 @@ void Udp::Process(const Mainloop::Context &aContext)
 
             socket->mHandler(socket->mContext, message, &messageInfo);
             otMessageFree(message);
+#endif
             // only process one socket a time
             break;
         }
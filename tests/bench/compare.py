@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2026, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Compare `ot-bench` JSON results against a baseline.
+
+Usage:
+    compare.py <baseline.json> <current.json> [--threshold PERCENT]
+
+Prints a per-benchmark delta table. Exits non-zero if any benchmark with a
+captured (non-null) baseline value regressed by more than the threshold
+(default 10%). Benchmarks with null baseline values are reported but not
+gated, so an unfilled baseline never fails a build.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_results(filename):
+    with open(filename) as f:
+        data = json.load(f)
+    return {entry["name"]: entry for entry in data["benchmarks"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline", help="baseline results JSON file")
+    parser.add_argument("current", help="current results JSON file")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=10.0,
+        help="max allowed regression in percent (default: 10)",
+    )
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    current = load_results(args.current)
+
+    regressions = []
+
+    print(f"{'benchmark':<24} {'baseline':>12} {'current':>12} {'delta':>9}")
+
+    for name, entry in current.items():
+        cur_ns = entry["ns_per_op"]
+        base = baseline.get(name)
+        base_ns = base["ns_per_op"] if base else None
+
+        if base_ns is None:
+            print(f"{name:<24} {'-':>12} {cur_ns:>12} {'n/a':>9}  (no baseline, not gated)")
+            continue
+
+        delta = 100.0 * (cur_ns - base_ns) / base_ns
+        marker = ""
+
+        if delta > args.threshold:
+            regressions.append((name, delta))
+            marker = "  REGRESSION"
+
+        print(f"{name:<24} {base_ns:>12} {cur_ns:>12} {delta:>+8.1f}%{marker}")
+
+    for name in baseline:
+        if name not in current:
+            print(f"{name:<24} missing from current results")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) regressed beyond {args.threshold}%")
+        return 1
+
+    print("\nNo regressions beyond threshold")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
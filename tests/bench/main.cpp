@@ -0,0 +1,389 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   Micro-benchmark harness (`ot-bench`) for the core data-path primitives
+ *   that dominate production profiles: `Message` append/read,
+ *   `Lowpan::Compress()`, `Crypto::AesCcm`, `Hdlc::Encoder`, and `Checksum`.
+ *
+ *   Each benchmark runs its operation in a tight loop over representative
+ *   inputs, repeats the loop several times, and reports the best repetition
+ *   as ns/op and (where the target provides a cycle counter) cycles/op.
+ *   Results are printed as a table and optionally written as JSON (first
+ *   command-line argument) for use with `compare.py`.
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "common/frame_builder.hpp"
+#include "common/message.hpp"
+#include "common/random.hpp"
+#include "crypto/aes_ccm.hpp"
+#include "instance/instance.hpp"
+#include "lib/hdlc/hdlc.hpp"
+#include "lib/spinel/multi_frame_buffer.hpp"
+#include "net/checksum.hpp"
+#include "net/ip6_headers.hpp"
+#include "net/udp6.hpp"
+#include "thread/lowpan.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+namespace Bench {
+
+static constexpr uint32_t kNumOps        = 10000; // Operations per repetition.
+static constexpr uint32_t kNumReps       = 5;     // Repetitions (best one is reported).
+static constexpr uint16_t kMaxBenchmarks = 16;
+
+static constexpr uint16_t kPayloadSize  = 64;  // Representative UDP payload size.
+static constexpr uint16_t kFrameSize    = 128; // Representative spinel frame size.
+static constexpr uint16_t kAesAadSize   = 29;  // MAC header size used as AAD.
+static constexpr uint8_t  kAesTagSize   = 4;   // MIC-32, as used for MAC frames.
+static constexpr uint16_t kMessageSize  = 3 * 128;
+
+struct Result
+{
+    const char *mName;
+    uint64_t    mNsPerOp;
+    uint64_t    mCyclesPerOp;
+};
+
+static Instance *sInstance;
+static Result    sResults[kMaxBenchmarks];
+static uint16_t  sNumResults;
+
+static uint64_t GetTimeNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (static_cast<uint64_t>(now.tv_sec) * 1000000000u) + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static uint64_t GetCycleCount(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t count;
+
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(count));
+
+    return count;
+#else
+    return 0; // No portable cycle counter; `cycles_per_op` is reported as zero.
+#endif
+}
+
+static void Measure(const char *aName, void (*aOperation)(void))
+{
+    Result  &result  = sResults[sNumResults++];
+    uint64_t bestNs  = 0;
+    uint64_t bestCyc = 0;
+
+    VerifyOrQuit(sNumResults <= kMaxBenchmarks);
+
+    // Warm-up repetition (not measured).
+
+    for (uint32_t op = 0; op < kNumOps; op++)
+    {
+        aOperation();
+    }
+
+    for (uint32_t rep = 0; rep < kNumReps; rep++)
+    {
+        uint64_t startNs  = GetTimeNs();
+        uint64_t startCyc = GetCycleCount();
+        uint64_t elapsedNs;
+        uint64_t elapsedCyc;
+
+        for (uint32_t op = 0; op < kNumOps; op++)
+        {
+            aOperation();
+        }
+
+        elapsedCyc = GetCycleCount() - startCyc;
+        elapsedNs  = GetTimeNs() - startNs;
+
+        if ((rep == 0) || (elapsedNs < bestNs))
+        {
+            bestNs  = elapsedNs;
+            bestCyc = elapsedCyc;
+        }
+    }
+
+    result.mName        = aName;
+    result.mNsPerOp     = bestNs / kNumOps;
+    result.mCyclesPerOp = bestCyc / kNumOps;
+
+    printf("%-24s %10" PRIu64 " ns/op %12" PRIu64 " cycles/op\n", aName, result.mNsPerOp, result.mCyclesPerOp);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// `Message` append/read
+
+static uint8_t  sScratch[kMessageSize];
+static Message *sMessage;
+
+static void MessageAppendOp(void)
+{
+    IgnoreError(sMessage->SetLength(0));
+
+    for (uint16_t offset = 0; offset < kMessageSize; offset += kPayloadSize)
+    {
+        SuccessOrQuit(sMessage->AppendBytes(&sScratch[offset], kPayloadSize));
+    }
+}
+
+static void MessageReadOp(void)
+{
+    for (uint16_t offset = 0; offset < kMessageSize; offset += kPayloadSize)
+    {
+        SuccessOrQuit(sMessage->Read(offset, &sScratch[offset], kPayloadSize));
+    }
+}
+
+static void BenchMessage(void)
+{
+    Random::NonCrypto::FillBuffer(sScratch, sizeof(sScratch));
+
+    sMessage = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(sMessage != nullptr);
+
+    Measure("message_append", MessageAppendOp);
+
+    SuccessOrQuit(sMessage->SetLength(kMessageSize));
+    Measure("message_read", MessageReadOp);
+
+    sMessage->Free();
+    sMessage = nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// `Lowpan::Compress()`
+
+static Message       *sLowpanMessage;
+static Mac::Addresses sMacAddrs;
+
+static void LowpanCompressOp(void)
+{
+    uint8_t      frame[127];
+    FrameBuilder frameBuilder;
+
+    frameBuilder.Init(frame, sizeof(frame));
+    sLowpanMessage->SetOffset(0);
+
+    SuccessOrQuit(sInstance->Get<Lowpan::Lowpan>().Compress(*sLowpanMessage, sMacAddrs, frameBuilder));
+}
+
+static void BenchLowpan(void)
+{
+    // Fully compressible link-local UDP packet using short MAC
+    // addresses (the common shape for in-mesh forwarded traffic).
+
+    Ip6::Header      ip6Header;
+    Ip6::Udp::Header udpHeader;
+
+    sMacAddrs.mSource.SetShort(0x0000);
+    sMacAddrs.mDestination.SetShort(0xc003);
+
+    ip6Header.InitVersionTrafficClassFlow();
+    ip6Header.SetPayloadLength(sizeof(udpHeader) + kPayloadSize);
+    ip6Header.SetNextHeader(Ip6::kProtoUdp);
+    ip6Header.SetHopLimit(64);
+    SuccessOrQuit(ip6Header.GetSource().FromString("fe80::ff:fe00:0"));
+    SuccessOrQuit(ip6Header.GetDestination().FromString("fe80::ff:fe00:c003"));
+
+    udpHeader.SetSourcePort(0xf0bf);
+    udpHeader.SetDestinationPort(0xf0bf);
+    udpHeader.SetLength(sizeof(udpHeader) + kPayloadSize);
+    udpHeader.SetChecksum(0x1234);
+
+    sLowpanMessage = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(sLowpanMessage != nullptr);
+    SuccessOrQuit(sLowpanMessage->Append(ip6Header));
+    SuccessOrQuit(sLowpanMessage->Append(udpHeader));
+    SuccessOrQuit(sLowpanMessage->AppendBytes(sScratch, kPayloadSize));
+
+    Measure("lowpan_compress", LowpanCompressOp);
+
+    sLowpanMessage->Free();
+    sLowpanMessage = nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// `Crypto::AesCcm`
+
+static Crypto::AesCcm sAesCcm;
+static uint8_t        sAesNonce[13];
+static uint8_t        sAesBuffer[kAesAadSize + kPayloadSize + kAesTagSize];
+
+static void AesCcmEncryptOp(void)
+{
+    sAesCcm.Init(kAesAadSize, kPayloadSize, kAesTagSize, sAesNonce, sizeof(sAesNonce));
+    sAesCcm.Header(sAesBuffer, kAesAadSize);
+    sAesCcm.Payload(&sAesBuffer[kAesAadSize], &sAesBuffer[kAesAadSize], kPayloadSize, Crypto::AesCcm::kEncrypt);
+    sAesCcm.Finalize(&sAesBuffer[kAesAadSize + kPayloadSize]);
+}
+
+static void BenchAesCcm(void)
+{
+    uint8_t key[16];
+
+    Random::NonCrypto::FillBuffer(key, sizeof(key));
+    Random::NonCrypto::FillBuffer(sAesNonce, sizeof(sAesNonce));
+    Random::NonCrypto::FillBuffer(sAesBuffer, sizeof(sAesBuffer));
+
+    sAesCcm.SetKey(key, sizeof(key));
+
+    Measure("aes_ccm_encrypt", AesCcmEncryptOp);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// `Hdlc::Encoder`
+
+static uint8_t sHdlcFrame[kFrameSize];
+
+static void HdlcEncodeOp(void)
+{
+    Spinel::FrameBuffer<2 * kFrameSize + 4> frameBuffer;
+    Hdlc::Encoder                           encoder(frameBuffer);
+
+    SuccessOrQuit(encoder.BeginFrame());
+    SuccessOrQuit(encoder.Encode(sHdlcFrame, sizeof(sHdlcFrame)));
+    SuccessOrQuit(encoder.EndFrame());
+}
+
+static void BenchHdlc(void)
+{
+    // Random content gives a representative mix of escaped bytes.
+
+    Random::NonCrypto::FillBuffer(sHdlcFrame, sizeof(sHdlcFrame));
+
+    Measure("hdlc_encode", HdlcEncodeOp);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// `Checksum`
+
+static Message         *sChecksumMessage;
+static Ip6::MessageInfo sChecksumMessageInfo;
+
+static void ChecksumVerifyOp(void)
+{
+    IgnoreError(Checksum::VerifyMessageChecksum(*sChecksumMessage, sChecksumMessageInfo, Ip6::kProtoUdp));
+}
+
+static void BenchChecksum(void)
+{
+    Ip6::Udp::Header udpHeader;
+
+    SuccessOrQuit(sChecksumMessageInfo.GetSockAddr().FromString("fd00:1234::100"));
+    SuccessOrQuit(sChecksumMessageInfo.GetPeerAddr().FromString("fd00:1234::200"));
+
+    udpHeader.SetSourcePort(0xf0bf);
+    udpHeader.SetDestinationPort(0xf0bf);
+    udpHeader.SetLength(sizeof(udpHeader) + kPayloadSize);
+    udpHeader.SetChecksum(0);
+
+    sChecksumMessage = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(sChecksumMessage != nullptr);
+    SuccessOrQuit(sChecksumMessage->Append(udpHeader));
+    SuccessOrQuit(sChecksumMessage->AppendBytes(sScratch, kPayloadSize));
+
+    Checksum::UpdateMessageChecksum(*sChecksumMessage, sChecksumMessageInfo.GetSockAddr(),
+                                    sChecksumMessageInfo.GetPeerAddr(), Ip6::kProtoUdp);
+
+    Measure("checksum_verify_udp", ChecksumVerifyOp);
+
+    sChecksumMessage->Free();
+    sChecksumMessage = nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+static void SaveResults(const char *aFilename)
+{
+    FILE *file = fopen(aFilename, "w");
+
+    VerifyOrQuit(file != nullptr);
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"benchmarks\": [\n");
+
+    for (uint16_t index = 0; index < sNumResults; index++)
+    {
+        fprintf(file, "    {\"name\": \"%s\", \"ns_per_op\": %" PRIu64 ", \"cycles_per_op\": %" PRIu64 "}%s\n",
+                sResults[index].mName, sResults[index].mNsPerOp, sResults[index].mCyclesPerOp,
+                (index + 1 < sNumResults) ? "," : "");
+    }
+
+    fprintf(file, "  ]\n");
+    fprintf(file, "}\n");
+
+    fclose(file);
+}
+
+void RunBenchmarks(const char *aJsonFileName)
+{
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    printf("ot-bench: %u ops/rep, best of %u reps\n\n", kNumOps, kNumReps);
+
+    BenchMessage();
+    BenchLowpan();
+    BenchAesCcm();
+    BenchHdlc();
+    BenchChecksum();
+
+    if (aJsonFileName != nullptr)
+    {
+        SaveResults(aJsonFileName);
+        printf("\nSaved results to %s\n", aJsonFileName);
+    }
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace Bench
+} // namespace ot
+
+int main(int argc, char *argv[])
+{
+    ot::Bench::RunBenchmarks((argc > 1) ? argv[1] : nullptr);
+    return 0;
+}
@@ -34,6 +34,7 @@
 
 #include "mac_frame.h"
 #include "nexus_node.hpp"
+#include "nexus_profiler.hpp"
 #include "nexus_radio_model.hpp"
 #include "thread/child_table.hpp"
 #include "thread/mle.hpp"
@@ -338,6 +339,8 @@ void Core::AddOmrPrefixTestVar(const char *aName, Node &aNode)
 
 Core::~Core(void)
 {
+    Profiler::Dump();
+
     while (!mNodes.IsEmpty())
     {
         Node *node = mNodes.GetHead();
@@ -659,6 +662,7 @@ bool Core::IsUiConnected(void) const
 void Core::Reset(void)
 {
     mNodes.Clear();
+    RadioModel::ClearLossConfigs();
     mCurNodeId     = 0;
     mNow           = 0;
     mNextAlarmTime = NumericLimits<uint64_t>::kMax;
@@ -696,19 +700,36 @@ void Core::AdvanceTime(uint32_t aDuration)
 
 void Core::Process(Node &aNode)
 {
-    otTaskletsProcess(&aNode.GetInstance());
+    {
+        Profiler::Scope scope(Profiler::kCategoryTasklets);
 
-    ProcessRadio(aNode);
-    ProcessInfraIf(aNode);
+        otTaskletsProcess(&aNode.GetInstance());
+    }
+
+    {
+        Profiler::Scope scope(Profiler::kCategoryRadio);
+
+        ProcessRadio(aNode);
+    }
+
+    {
+        Profiler::Scope scope(Profiler::kCategoryInfraIf);
+
+        ProcessInfraIf(aNode);
+    }
 
     if (aNode.mAlarmMilli.mScheduled && (GetNow() >= aNode.mAlarmMilli.mAlarmTime))
     {
+        Profiler::Scope scope(Profiler::kCategoryAlarmMilli);
+
         aNode.mAlarmMilli.mScheduled = false;
         otPlatAlarmMilliFired(&aNode.GetInstance());
     }
 
     if (aNode.mAlarmMicro.mScheduled && (GetNowMicro() >= aNode.mAlarmMicro.mAlarmTime))
     {
+        Profiler::Scope scope(Profiler::kCategoryAlarmMicro);
+
         aNode.mAlarmMicro.mScheduled = false;
         otPlatAlarmMicroFired(&aNode.GetInstance());
     }
@@ -805,6 +826,12 @@ void Core::ProcessRadio(Node &aNode)
                 continue;
             }
 
+            // Apply the configured frame loss model (if any).
+            if (RadioModel::ShouldDropFrame(aNode, rxNode))
+            {
+                continue;
+            }
+
             rxFrame.mInfo.mRxInfo.mRssi = ClampToInt8(localRssi);
 
             rxFrame.mInfo.mRxInfo.mLqi = kDefaultRxLqi;
@@ -899,7 +926,7 @@ void Core::ProcessRadio(Node &aNode)
 
             mPcap.WriteFrame(ackFrame, mNow);
 
-            if (RadioModel::ShouldDropPacket(ackRssi))
+            if (RadioModel::ShouldDropPacket(ackRssi) || RadioModel::ShouldDropFrame(*ackNode, aNode))
             {
                 otPlatRadioTxDone(&aNode.GetInstance(), &aNode.mRadio.mTxFrame, nullptr, kErrorNoAck);
             }
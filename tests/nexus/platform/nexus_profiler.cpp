@@ -0,0 +1,141 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "nexus_profiler.hpp"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "nexus_logging.hpp"
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace Nexus {
+
+bool                     Profiler::sDidInit        = false;
+bool                     Profiler::sEnabled        = false;
+const char              *Profiler::sOutputFileName = nullptr;
+Profiler::CategoryStats  Profiler::sStats[Profiler::kNumCategories];
+
+Profiler::Scope::Scope(Category aCategory)
+    : mCategory(aCategory)
+    , mStartTime(0)
+{
+    if (IsEnabled())
+    {
+        mStartTime = GetCpuTime();
+    }
+}
+
+Profiler::Scope::~Scope(void)
+{
+    if (IsEnabled())
+    {
+        sStats[mCategory].mTotalTime += (GetCpuTime() - mStartTime);
+        sStats[mCategory].mNumCalls++;
+    }
+}
+
+bool Profiler::IsEnabled(void)
+{
+    if (!sDidInit)
+    {
+        Init();
+    }
+
+    return sEnabled;
+}
+
+void Profiler::Init(void)
+{
+    const char *fileName = getenv("OT_NEXUS_PROFILE_FILE");
+
+    sDidInit = true;
+
+    if ((fileName != nullptr) && (fileName[0] != '\0'))
+    {
+        sOutputFileName = fileName;
+        sEnabled        = true;
+    }
+}
+
+void Profiler::Dump(void)
+{
+    FILE *file;
+
+    VerifyOrExit(IsEnabled());
+
+    file = fopen(sOutputFileName, "w");
+    VerifyOrExit(file != nullptr);
+
+    Log("Profiler: dispatch CPU census (host usec)");
+
+    for (uint8_t category = 0; category < kNumCategories; category++)
+    {
+        const CategoryStats &stats = sStats[category];
+
+        fprintf(file, "nexus;%s %" PRIu64 "\n", CategoryToString(static_cast<Category>(category)), stats.mTotalTime);
+
+        Log("Profiler: %-12s %10" PRIu64 " usec over %" PRIu64 " calls",
+            CategoryToString(static_cast<Category>(category)), stats.mTotalTime, stats.mNumCalls);
+    }
+
+    fclose(file);
+
+    Log("Profiler: saved folded stacks to %s (feed into flamegraph.pl)", sOutputFileName);
+
+exit:
+    return;
+}
+
+const char *Profiler::CategoryToString(Category aCategory)
+{
+    static const char *const kCategoryStrings[kNumCategories] = {
+        "tasklets",    // (0) kCategoryTasklets
+        "alarm_milli", // (1) kCategoryAlarmMilli
+        "alarm_micro", // (2) kCategoryAlarmMicro
+        "radio",       // (3) kCategoryRadio
+        "infra_if",    // (4) kCategoryInfraIf
+    };
+
+    return kCategoryStrings[aCategory];
+}
+
+uint64_t Profiler::GetCpuTime(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+
+    return (static_cast<uint64_t>(now.tv_sec) * 1000000u) + (static_cast<uint64_t>(now.tv_nsec) / 1000u);
+}
+
+} // namespace Nexus
+} // namespace ot
@@ -0,0 +1,111 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OT_NEXUS_PLATFORM_NEXUS_PROFILER_HPP_
+#define OT_NEXUS_PLATFORM_NEXUS_PROFILER_HPP_
+
+#include <stdint.h>
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * This class implements host-CPU profiling of the simulation dispatch paths.
+ *
+ * When enabled (by setting the `OT_NEXUS_PROFILE_FILE` environment variable to an output file name), the core
+ * wraps every platform event dispatch - tasklets, milli/micro alarms, radio, and infrastructure interface - in a
+ * `Profiler::Scope`, accumulating host CPU time and call counts per category. `Dump()` (invoked at the end of the
+ * simulation) writes the totals as folded stack lines (`nexus;<category> <microseconds>`) which feed directly
+ * into `flamegraph.pl`, so any simulation run doubles as a dispatch-level performance census.
+ *
+ */
+class Profiler
+{
+public:
+    Profiler(void) = delete;
+
+    enum Category : uint8_t
+    {
+        kCategoryTasklets,   ///< `otTaskletsProcess()` dispatch.
+        kCategoryAlarmMilli, ///< Milli alarm (`otPlatAlarmMilliFired()`) dispatch.
+        kCategoryAlarmMicro, ///< Micro alarm (`otPlatAlarmMicroFired()`) dispatch.
+        kCategoryRadio,      ///< Radio frame processing and delivery.
+        kCategoryInfraIf,    ///< Infrastructure interface packet delivery.
+
+        kNumCategories,
+    };
+
+    /**
+     * This class tracks (as RAII scope) the host CPU time spent in a profiled category.
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(Category aCategory);
+        ~Scope(void);
+
+    private:
+        Category mCategory;
+        uint64_t mStartTime;
+    };
+
+    /**
+     * This static method indicates whether profiling is enabled (`OT_NEXUS_PROFILE_FILE` is set).
+     *
+     * @retval true if profiling is enabled.
+     * @retval false otherwise.
+     */
+    static bool IsEnabled(void);
+
+    /**
+     * This static method writes the accumulated per-category totals to the configured output file in folded
+     * flamegraph format and logs a summary. It is a no-op when profiling is not enabled.
+     */
+    static void Dump(void);
+
+private:
+    struct CategoryStats
+    {
+        uint64_t mTotalTime; // In usec (host CPU).
+        uint64_t mNumCalls;
+    };
+
+    static const char *CategoryToString(Category aCategory);
+    static uint64_t    GetCpuTime(void);
+    static void        Init(void);
+
+    static bool          sDidInit;
+    static bool          sEnabled;
+    static const char   *sOutputFileName;
+    static CategoryStats sStats[kNumCategories];
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // OT_NEXUS_PLATFORM_NEXUS_PROFILER_HPP_
@@ -61,5 +61,139 @@ int16_t RadioModel::CalculateRssi(const Node &aTxNode, const Node &aRxNode)
 
 bool RadioModel::ShouldDropPacket(int16_t aRssi) { return aRssi < Radio::kRadioSensitivity; }
 
+uint32_t               RadioModel::sRandState = 1;
+RadioModel::LossConfig RadioModel::sDefaultConfig;
+RadioModel::LinkEntry  RadioModel::sLinkEntries[RadioModel::kMaxLinkEntries];
+uint16_t               RadioModel::sNumLinkEntries = 0;
+
+void RadioModel::SetSeed(uint32_t aSeed) { sRandState = (aSeed != 0) ? aSeed : 1; }
+
+void RadioModel::SetDefaultLossConfig(const LossConfig &aConfig) { sDefaultConfig = aConfig; }
+
+void RadioModel::SetLinkLossConfig(const Node &aFirstNode, const Node &aSecondNode, const LossConfig &aConfig)
+{
+    uint32_t   firstId  = aFirstNode.GetId();
+    uint32_t   secondId = aSecondNode.GetId();
+    LinkEntry *entry;
+
+    if (firstId > secondId)
+    {
+        uint32_t temp = firstId;
+
+        firstId  = secondId;
+        secondId = temp;
+    }
+
+    entry = FindLinkEntry(firstId, secondId);
+
+    if (entry == nullptr)
+    {
+        VerifyOrQuit(sNumLinkEntries < kMaxLinkEntries, "too many per-link loss configs");
+        entry                = &sLinkEntries[sNumLinkEntries++];
+        entry->mFirstNodeId  = firstId;
+        entry->mSecondNodeId = secondId;
+        entry->mInBadState   = false;
+    }
+
+    entry->mConfig = aConfig;
+}
+
+void RadioModel::ClearLossConfigs(void)
+{
+    sDefaultConfig  = LossConfig();
+    sNumLinkEntries = 0;
+}
+
+bool RadioModel::ShouldDropFrame(const Node &aTxNode, const Node &aRxNode)
+{
+    uint32_t   firstId  = aTxNode.GetId();
+    uint32_t   secondId = aRxNode.GetId();
+    LinkEntry *entry;
+    uint8_t    lossPercent;
+
+    if (firstId > secondId)
+    {
+        uint32_t temp = firstId;
+
+        firstId  = secondId;
+        secondId = temp;
+    }
+
+    entry = FindLinkEntry(firstId, secondId);
+
+    if (entry == nullptr)
+    {
+        lossPercent = sDefaultConfig.mLossPercent;
+    }
+    else
+    {
+        if (entry->mConfig.mGoodToBadPercent > 0)
+        {
+            // Gilbert-Elliott state transition, evaluated per frame.
+
+            if (entry->mInBadState)
+            {
+                entry->mInBadState = !RandomPercentCheck(entry->mConfig.mBadToGoodPercent);
+            }
+            else
+            {
+                entry->mInBadState = RandomPercentCheck(entry->mConfig.mGoodToBadPercent);
+            }
+        }
+
+        lossPercent = entry->mInBadState ? entry->mConfig.mBadLossPercent : entry->mConfig.mLossPercent;
+    }
+
+    return RandomPercentCheck(lossPercent);
+}
+
+RadioModel::LinkEntry *RadioModel::FindLinkEntry(uint32_t aFirstNodeId, uint32_t aSecondNodeId)
+{
+    LinkEntry *match = nullptr;
+
+    for (uint16_t index = 0; index < sNumLinkEntries; index++)
+    {
+        if ((sLinkEntries[index].mFirstNodeId == aFirstNodeId) && (sLinkEntries[index].mSecondNodeId == aSecondNodeId))
+        {
+            match = &sLinkEntries[index];
+            break;
+        }
+    }
+
+    return match;
+}
+
+uint32_t RadioModel::NextRandom(void)
+{
+    // xorshift32 - deterministic for a given seed across hosts.
+
+    sRandState ^= (sRandState << 13);
+    sRandState ^= (sRandState >> 17);
+    sRandState ^= (sRandState << 5);
+
+    return sRandState;
+}
+
+bool RadioModel::RandomPercentCheck(uint8_t aPercent)
+{
+    bool check = false;
+
+    switch (aPercent)
+    {
+    case 0:
+        break;
+
+    case 100:
+        check = true;
+        break;
+
+    default:
+        check = ((NextRandom() % 100) < aPercent);
+        break;
+    }
+
+    return check;
+}
+
 } // namespace Nexus
 } // namespace ot
@@ -37,7 +37,7 @@ namespace Nexus {
 class Node;
 
 /**
- * This class implements a radio model for RSSI calculation.
+ * This class implements a radio model for RSSI calculation and frame loss.
  *
  */
 class RadioModel
@@ -45,6 +45,31 @@ class RadioModel
 public:
     RadioModel(void) = delete;
 
+    /**
+     * This structure represents a frame loss configuration.
+     *
+     * With default `mGoodToBadPercent` of zero, losses are uniform with probability `mLossPercent`. A non-zero
+     * `mGoodToBadPercent` enables a two-state Gilbert-Elliott model: the link transitions between a good state
+     * (loss probability `mLossPercent`) and a bad/burst state (loss probability `mBadLossPercent`) with the given
+     * per-frame transition probabilities.
+     *
+     */
+    struct LossConfig
+    {
+        LossConfig(void)
+            : mLossPercent(0)
+            , mGoodToBadPercent(0)
+            , mBadToGoodPercent(100)
+            , mBadLossPercent(0)
+        {
+        }
+
+        uint8_t mLossPercent;      ///< Loss probability in percent (good state).
+        uint8_t mGoodToBadPercent; ///< Good-to-bad transition probability in percent (zero disables bursty model).
+        uint8_t mBadToGoodPercent; ///< Bad-to-good transition probability in percent.
+        uint8_t mBadLossPercent;   ///< Loss probability in percent while in bad state.
+    };
+
     /**
      * This static method calculates the RSSI between two nodes based on their distance.
      *
@@ -64,6 +89,70 @@ public:
      * @retval false if the packet should not be dropped.
      */
     static bool ShouldDropPacket(int16_t aRssi);
+
+    /**
+     * This static method sets the seed of the random generator used by the loss models.
+     *
+     * The same seed always produces the same loss pattern, making lossy simulations reproducible.
+     *
+     * @param[in] aSeed  The seed value (zero is mapped to one).
+     */
+    static void SetSeed(uint32_t aSeed);
+
+    /**
+     * This static method sets the loss configuration applied to all links without a per-link configuration.
+     *
+     * The bursty (Gilbert-Elliott) model needs per-link state and is therefore only honored in per-link
+     * configurations; for the default configuration only the uniform `mLossPercent` is used.
+     *
+     * @param[in] aConfig  The loss configuration.
+     */
+    static void SetDefaultLossConfig(const LossConfig &aConfig);
+
+    /**
+     * This static method sets the loss configuration of the link between two nodes (in both directions).
+     *
+     * @param[in] aFirstNode   The first node.
+     * @param[in] aSecondNode  The second node.
+     * @param[in] aConfig      The loss configuration.
+     */
+    static void SetLinkLossConfig(const Node &aFirstNode, const Node &aSecondNode, const LossConfig &aConfig);
+
+    /**
+     * This static method clears all loss configurations (default and per-link), restoring ideal delivery.
+     */
+    static void ClearLossConfigs(void);
+
+    /**
+     * This static method determines if a frame from one node to another should be dropped by the loss model.
+     *
+     * @param[in] aTxNode  The transmitter node.
+     * @param[in] aRxNode  The receiver node.
+     *
+     * @retval true if the frame should be dropped.
+     * @retval false if the frame should be delivered.
+     */
+    static bool ShouldDropFrame(const Node &aTxNode, const Node &aRxNode);
+
+private:
+    static constexpr uint16_t kMaxLinkEntries = 32;
+
+    struct LinkEntry
+    {
+        uint32_t   mFirstNodeId;
+        uint32_t   mSecondNodeId;
+        LossConfig mConfig;
+        bool       mInBadState;
+    };
+
+    static LinkEntry *FindLinkEntry(uint32_t aFirstNodeId, uint32_t aSecondNodeId);
+    static uint32_t   NextRandom(void);
+    static bool       RandomPercentCheck(uint8_t aPercent);
+
+    static uint32_t   sRandState;
+    static LossConfig sDefaultConfig;
+    static LinkEntry  sLinkEntries[kMaxLinkEntries];
+    static uint16_t   sNumLinkEntries;
 };
 
 } // namespace Nexus
@@ -0,0 +1,168 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "nexus_topology.hpp"
+
+namespace ot {
+namespace Nexus {
+
+uint32_t Topology::NextRandom(uint32_t &aState)
+{
+    // xorshift32 - deterministic across hosts so a seed identifies a topology.
+
+    aState ^= (aState << 13);
+    aState ^= (aState >> 17);
+    aState ^= (aState << 5);
+
+    return aState;
+}
+
+void Topology::CreateGrid(Core &aCore, uint16_t aNumRows, uint16_t aNumCols, Node *aNodes[], bool aDiagonalLinks)
+{
+    for (uint16_t row = 0; row < aNumRows; row++)
+    {
+        for (uint16_t col = 0; col < aNumCols; col++)
+        {
+            Node &node = aCore.CreateNode();
+
+            node.SetName("grid", row * aNumCols + col);
+            node.SetPosition(static_cast<float>(col), static_cast<float>(row));
+            aNodes[row * aNumCols + col] = &node;
+        }
+    }
+
+    for (uint16_t row = 0; row < aNumRows; row++)
+    {
+        for (uint16_t col = 0; col < aNumCols; col++)
+        {
+            Node &node = *aNodes[row * aNumCols + col];
+
+            // Link towards higher row/column only, so every pair is
+            // linked exactly once.
+
+            if (col + 1 < aNumCols)
+            {
+                AllowLinkBetween(node, *aNodes[row * aNumCols + (col + 1)]);
+            }
+
+            if (row + 1 < aNumRows)
+            {
+                AllowLinkBetween(node, *aNodes[(row + 1) * aNumCols + col]);
+
+                if (aDiagonalLinks)
+                {
+                    if (col + 1 < aNumCols)
+                    {
+                        AllowLinkBetween(node, *aNodes[(row + 1) * aNumCols + (col + 1)]);
+                    }
+
+                    if (col > 0)
+                    {
+                        AllowLinkBetween(node, *aNodes[(row + 1) * aNumCols + (col - 1)]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void Topology::CreateRandomMesh(Core &aCore, uint16_t aNumNodes, uint8_t aAvgDegree, uint32_t aSeed, Node *aNodes[])
+{
+    static constexpr uint32_t kMaxAttemptFactor = 50;
+
+    uint32_t randState = (aSeed != 0) ? aSeed : 1;
+    uint32_t numLinks  = 0;
+    uint32_t targetNumLinks;
+    uint32_t maxAttempts;
+    bool    *linked;
+    uint8_t *degrees;
+
+    VerifyOrQuit(aNumNodes >= 2);
+
+    linked  = new bool[static_cast<uint32_t>(aNumNodes) * aNumNodes]();
+    degrees = new uint8_t[aNumNodes]();
+
+    for (uint16_t index = 0; index < aNumNodes; index++)
+    {
+        Node &node = aCore.CreateNode();
+
+        node.SetName("mesh", index);
+        node.SetPosition(static_cast<float>(NextRandom(randState) % 100), static_cast<float>(NextRandom(randState) % 100));
+        aNodes[index] = &node;
+    }
+
+    // Random spanning tree first (guarantees a connected mesh), then
+    // extra random links up to the target average degree. Per-node
+    // degree is capped at `kMaxDegree` to stay within the MAC filter
+    // allow-list capacity.
+
+    for (uint16_t index = 1; index < aNumNodes; index++)
+    {
+        uint16_t peer = static_cast<uint16_t>(NextRandom(randState) % index);
+
+        while (degrees[peer] >= kMaxDegree)
+        {
+            peer = static_cast<uint16_t>(NextRandom(randState) % index);
+        }
+
+        AllowLinkBetween(*aNodes[index], *aNodes[peer]);
+        linked[index * aNumNodes + peer] = true;
+        linked[peer * aNumNodes + index] = true;
+        degrees[index]++;
+        degrees[peer]++;
+        numLinks++;
+    }
+
+    targetNumLinks = (static_cast<uint32_t>(aNumNodes) * aAvgDegree) / 2;
+    maxAttempts    = kMaxAttemptFactor * targetNumLinks;
+
+    while ((numLinks < targetNumLinks) && (maxAttempts-- > 0))
+    {
+        uint16_t first  = static_cast<uint16_t>(NextRandom(randState) % aNumNodes);
+        uint16_t second = static_cast<uint16_t>(NextRandom(randState) % aNumNodes);
+
+        if ((first == second) || linked[first * aNumNodes + second] || (degrees[first] >= kMaxDegree) ||
+            (degrees[second] >= kMaxDegree))
+        {
+            continue;
+        }
+
+        AllowLinkBetween(*aNodes[first], *aNodes[second]);
+        linked[first * aNumNodes + second] = true;
+        linked[second * aNumNodes + first] = true;
+        degrees[first]++;
+        degrees[second]++;
+        numLinks++;
+    }
+
+    delete[] linked;
+    delete[] degrees;
+}
+
+} // namespace Nexus
+} // namespace ot
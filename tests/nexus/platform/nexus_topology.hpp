@@ -0,0 +1,90 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OT_NEXUS_PLATFORM_NEXUS_TOPOLOGY_HPP_
+#define OT_NEXUS_PLATFORM_NEXUS_TOPOLOGY_HPP_
+
+#include "nexus_core.hpp"
+#include "nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+class Topology
+{
+    // Generators for multi-hop scale topologies. Nodes are created on
+    // the given `Core` with their positions set (for the UI/pcap
+    // tooling) and radio links restricted to the generated adjacency
+    // using the MAC filter allow-lists. The created nodes are returned
+    // in a caller-provided array indexed by creation order, so tests
+    // can address nodes (e.g., to cut links for a partition) without
+    // walking the core node list.
+
+public:
+    Topology(void) = delete;
+
+    // Max links per node, kept below the MAC filter capacity
+    // (`OPENTHREAD_CONFIG_MAC_FILTER_SIZE`).
+    static constexpr uint8_t kMaxDegree = 16;
+
+    /**
+     * Creates a `aNumRows x aNumCols` grid of nodes, linking each node to its
+     * horizontal/vertical (and optionally diagonal) grid neighbors.
+     *
+     * @param[in]  aCore           The nexus core.
+     * @param[in]  aNumRows        Number of grid rows.
+     * @param[in]  aNumCols        Number of grid columns.
+     * @param[out] aNodes          Caller array of `aNumRows * aNumCols` entries, filled with the created nodes
+     *                             in row-major order (node at row `r`, column `c` is `aNodes[r * aNumCols + c]`).
+     * @param[in]  aDiagonalLinks  Whether to also link diagonal grid neighbors.
+     */
+    static void CreateGrid(Core &aCore, uint16_t aNumRows, uint16_t aNumCols, Node *aNodes[], bool aDiagonalLinks);
+
+    /**
+     * Creates `aNumNodes` nodes linked as a connected random mesh.
+     *
+     * A random spanning tree guarantees connectivity; extra random links are then added until the average node
+     * degree reaches `aAvgDegree` (per-node degree is capped at `kMaxDegree`). The same seed always generates the
+     * same topology.
+     *
+     * @param[in]  aCore       The nexus core.
+     * @param[in]  aNumNodes   Number of nodes to create.
+     * @param[in]  aAvgDegree  Target average number of links per node.
+     * @param[in]  aSeed       Seed for the topology random generator.
+     * @param[out] aNodes      Caller array of `aNumNodes` entries, filled with the created nodes in creation order.
+     */
+    static void CreateRandomMesh(Core &aCore, uint16_t aNumNodes, uint8_t aAvgDegree, uint32_t aSeed, Node *aNodes[]);
+
+private:
+    static uint32_t NextRandom(uint32_t &aState);
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // OT_NEXUS_PLATFORM_NEXUS_TOPOLOGY_HPP_
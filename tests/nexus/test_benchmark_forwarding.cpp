@@ -0,0 +1,277 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * Forwarding performance benchmark (in virtual time).
+ *
+ * Topology:
+ *   R1 (Leader) -- R2 -- R3 -- R4
+ *
+ * Measures, over a sustained UDP flow from R1 to R4 (three hops):
+ *
+ * - Attach time: virtual time until all routers have attached.
+ * - End-to-end and per-hop forwarding latency (min/avg/max).
+ * - Delivery ratio of the flow.
+ * - Peak message buffer occupancy on the forwarding routers.
+ *
+ * Each metric is checked against a regression-gate threshold and all results are
+ * emitted as JSON (file name given as the second command-line argument), so CI
+ * runs can archive and trend them. The thresholds are intentionally loose upper
+ * bounds; they exist to catch order-of-magnitude forwarding regressions, not to
+ * track small variations.
+ */
+
+static constexpr uint32_t kFormNetworkTime    = 13 * 1000; // msec
+static constexpr uint32_t kMaxAttachWaitTime  = 300 * 1000;
+static constexpr uint32_t kAttachPollInterval = 500;
+
+static constexpr uint16_t kNumHops        = 3;
+static constexpr uint16_t kUdpPort        = 12345;
+static constexpr uint16_t kNumFlowPackets = 200;
+static constexpr uint16_t kPayloadSize    = 64;
+static constexpr uint32_t kPacketInterval = 100; // msec between packets
+static constexpr uint32_t kFlowDrainTime  = 5 * 1000;
+
+// Regression-gate thresholds.
+static constexpr uint32_t kMaxAttachTime       = 200 * 1000; // msec
+static constexpr uint32_t kMaxAvgLatency       = 50 * 1000;  // usec, end-to-end
+static constexpr uint32_t kMaxMaxLatency       = 500 * 1000; // usec, end-to-end
+static constexpr uint16_t kMinDeliveredPackets = kNumFlowPackets;
+static constexpr uint16_t kMaxBufferOccupancy  = 40; // buffers, per forwarding router
+
+struct FlowStats
+{
+    FlowStats(void) { ClearAllBytes(*this); }
+
+    uint16_t mNumReceived;
+    uint64_t mTotalLatency; // usec
+    uint64_t mMinLatency;
+    uint64_t mMaxLatency;
+};
+
+struct FlowPayload
+{
+    uint64_t mSendTime; // usec (virtual time)
+    uint16_t mSequence;
+    uint8_t  mPadding[kPayloadSize - sizeof(uint64_t) - sizeof(uint16_t)];
+};
+
+static void HandleFlowPacket(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    FlowStats  &stats = *static_cast<FlowStats *>(aContext);
+    FlowPayload payload;
+    uint64_t    latency;
+
+    SuccessOrQuit(AsCoreType(aMessage).Read(AsCoreType(aMessage).GetOffset(), payload));
+
+    latency = Core::Get().GetNowMicro64() - payload.mSendTime;
+
+    if ((stats.mNumReceived == 0) || (latency < stats.mMinLatency))
+    {
+        stats.mMinLatency = latency;
+    }
+
+    if (latency > stats.mMaxLatency)
+    {
+        stats.mMaxLatency = latency;
+    }
+
+    stats.mTotalLatency += latency;
+    stats.mNumReceived++;
+}
+
+static void SendFlowPacket(Core &aNexus, Ip6::Udp::Socket &aSocket, const Ip6::Address &aDest, uint16_t aSequence)
+{
+    Message         *message = aSocket.NewMessage();
+    FlowPayload      payload;
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrQuit(message != nullptr);
+
+    ClearAllBytes(payload);
+    payload.mSendTime = aNexus.GetNowMicro64();
+    payload.mSequence = aSequence;
+    SuccessOrQuit(message->Append(payload));
+
+    messageInfo.SetPeerAddr(aDest);
+    messageInfo.SetPeerPort(kUdpPort);
+
+    SuccessOrQuit(aSocket.SendTo(*message, messageInfo));
+}
+
+static void SaveBenchmarkResults(const char      *aFilename,
+                                 uint32_t         aAttachTime,
+                                 const FlowStats &aStats,
+                                 uint64_t         aAvgLatency,
+                                 uint16_t         aPeakBufferOccupancy)
+{
+    FILE *file = fopen(aFilename, "w");
+
+    VerifyOrQuit(file != nullptr);
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"benchmark\": \"forwarding\",\n");
+    fprintf(file, "  \"num_hops\": %u,\n", kNumHops);
+    fprintf(file, "  \"metrics\": [\n");
+    fprintf(file, "    {\"name\": \"attach_time\", \"unit\": \"ms\", \"value\": %lu, \"threshold\": %lu},\n",
+            ToUlong(aAttachTime), ToUlong(kMaxAttachTime));
+    fprintf(file, "    {\"name\": \"delivered_packets\", \"unit\": \"packets\", \"value\": %u, \"threshold\": %u},\n",
+            aStats.mNumReceived, kMinDeliveredPackets);
+    fprintf(file, "    {\"name\": \"latency_min\", \"unit\": \"us\", \"value\": %lu},\n",
+            ToUlong(static_cast<uint32_t>(aStats.mMinLatency)));
+    fprintf(file, "    {\"name\": \"latency_avg\", \"unit\": \"us\", \"value\": %lu, \"threshold\": %lu},\n",
+            ToUlong(static_cast<uint32_t>(aAvgLatency)), ToUlong(kMaxAvgLatency));
+    fprintf(file, "    {\"name\": \"latency_max\", \"unit\": \"us\", \"value\": %lu, \"threshold\": %lu},\n",
+            ToUlong(static_cast<uint32_t>(aStats.mMaxLatency)), ToUlong(kMaxMaxLatency));
+    fprintf(file, "    {\"name\": \"latency_avg_per_hop\", \"unit\": \"us\", \"value\": %lu},\n",
+            ToUlong(static_cast<uint32_t>(aAvgLatency / kNumHops)));
+    fprintf(file, "    {\"name\": \"peak_buffer_occupancy\", \"unit\": \"buffers\", \"value\": %u, \"threshold\": %u}\n",
+            aPeakBufferOccupancy, kMaxBufferOccupancy);
+    fprintf(file, "  ]\n");
+    fprintf(file, "}\n");
+
+    fclose(file);
+}
+
+void TestBenchmarkForwarding(const char *aJsonFileName)
+{
+    Core      nexus;
+    uint32_t  attachTime;
+    FlowStats stats;
+    uint64_t  avgLatency;
+    uint16_t  peakBufferOccupancy;
+
+    Node &r1 = nexus.CreateNode();
+    Node &r2 = nexus.CreateNode();
+    Node &r3 = nexus.CreateNode();
+    Node &r4 = nexus.CreateNode();
+
+    r1.SetName("R1");
+    r2.SetName("R2");
+    r3.SetName("R3");
+    r4.SetName("R4");
+
+    AllowLinkBetween(r1, r2);
+    AllowLinkBetween(r2, r3);
+    AllowLinkBetween(r3, r4);
+
+    nexus.AdvanceTime(0);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Benchmark: attach time for %u-hop line topology", kNumHops);
+
+    r1.Form();
+    nexus.AdvanceTime(kFormNetworkTime);
+    VerifyOrQuit(r1.Get<Mle::Mle>().IsLeader());
+
+    r2.Join(r1);
+    r3.Join(r1);
+    r4.Join(r1);
+
+    while (!(r2.Get<Mle::Mle>().IsRouter() && r3.Get<Mle::Mle>().IsRouter() && r4.Get<Mle::Mle>().IsRouter()))
+    {
+        VerifyOrQuit(nexus.GetNow().GetValue() < kMaxAttachWaitTime, "Routers failed to attach in time");
+        nexus.AdvanceTime(kAttachPollInterval);
+    }
+
+    attachTime = nexus.GetNow().GetValue();
+    Log("All routers attached after %lu ms", ToUlong(attachTime));
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Benchmark: sustained UDP flow R1 -> R4, %u packets of %u bytes every %lu ms", kNumFlowPackets, kPayloadSize,
+        ToUlong(kPacketInterval));
+
+    {
+        Ip6::Udp::Socket rxSocket(r4, HandleFlowPacket, &stats);
+        Ip6::Udp::Socket txSocket(r1, nullptr, nullptr);
+        Ip6::Address     dest = r4.Get<Mle::Mle>().GetMeshLocalEid();
+
+        SuccessOrQuit(rxSocket.Open(Ip6::kNetifThreadInternal));
+        SuccessOrQuit(rxSocket.Bind(kUdpPort));
+        SuccessOrQuit(txSocket.Open(Ip6::kNetifThreadInternal));
+
+        r2.Get<MessagePool>().ResetMaxUsedBufferCount();
+        r3.Get<MessagePool>().ResetMaxUsedBufferCount();
+
+        for (uint16_t sequence = 0; sequence < kNumFlowPackets; sequence++)
+        {
+            SendFlowPacket(nexus, txSocket, dest, sequence);
+            nexus.AdvanceTime(kPacketInterval);
+        }
+
+        nexus.AdvanceTime(kFlowDrainTime);
+
+        SuccessOrQuit(rxSocket.Close());
+        SuccessOrQuit(txSocket.Close());
+    }
+
+    VerifyOrQuit(stats.mNumReceived > 0, "No flow packets were delivered");
+
+    avgLatency          = stats.mTotalLatency / stats.mNumReceived;
+    peakBufferOccupancy = Max(r2.Get<MessagePool>().GetMaxUsedBufferCount(), r3.Get<MessagePool>().GetMaxUsedBufferCount());
+
+    Log("Delivered %u of %u packets", stats.mNumReceived, kNumFlowPackets);
+    Log("End-to-end latency (us): min %lu / avg %lu / max %lu", ToUlong(static_cast<uint32_t>(stats.mMinLatency)),
+        ToUlong(static_cast<uint32_t>(avgLatency)), ToUlong(static_cast<uint32_t>(stats.mMaxLatency)));
+    Log("Average per-hop latency: %lu us", ToUlong(static_cast<uint32_t>(avgLatency / kNumHops)));
+    Log("Peak buffer occupancy on forwarding routers: %u", peakBufferOccupancy);
+
+    SaveBenchmarkResults(aJsonFileName, attachTime, stats, avgLatency, peakBufferOccupancy);
+    Log("Saved benchmark results to %s", aJsonFileName);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Checking regression gates");
+
+    VerifyOrQuit(attachTime <= kMaxAttachTime, "Attach time exceeds threshold");
+    VerifyOrQuit(stats.mNumReceived >= kMinDeliveredPackets, "Delivered packet count below threshold");
+    VerifyOrQuit(avgLatency <= kMaxAvgLatency, "Average forwarding latency exceeds threshold");
+    VerifyOrQuit(stats.mMaxLatency <= kMaxMaxLatency, "Maximum forwarding latency exceeds threshold");
+    VerifyOrQuit(peakBufferOccupancy <= kMaxBufferOccupancy, "Peak buffer occupancy exceeds threshold");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(int argc, char *argv[])
+{
+    ot::Nexus::TestBenchmarkForwarding((argc > 2) ? argv[2] : "benchmark_forwarding.json");
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+#include "platform/nexus_radio_model.hpp"
+
+namespace ot {
+namespace Nexus {
+
+void TestRadioLossModel(void)
+{
+    // Validate the seedable frame loss models: MAC retransmissions
+    // recover from moderate uniform and bursty (Gilbert-Elliott) loss,
+    // a fully lossy link detaches the child, and clearing the configs
+    // restores ideal delivery and lets it reattach.
+
+    static constexpr uint16_t kNumEchoRequests = 10;
+
+    Core nexus;
+
+    Node &leader = nexus.CreateNode();
+    Node &child  = nexus.CreateNode();
+
+    RadioModel::LossConfig lossConfig;
+
+    RadioModel::SetSeed(0x1234);
+
+    nexus.AdvanceTime(0);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Form network");
+
+    leader.Form();
+    nexus.AdvanceTime(13 * 1000);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    child.Join(leader, Node::kAsFed);
+    nexus.AdvanceTime(2 * 1000);
+    VerifyOrQuit(child.Get<Mle::Mle>().IsChild());
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Verify connectivity over an ideal link");
+
+    nexus.SendAndVerifyEchoRequest(leader, child.Get<Mle::Mle>().GetMeshLocalEid());
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Verify connectivity with 30%% uniform loss (MAC retries should recover)");
+
+    lossConfig.mLossPercent = 30;
+    RadioModel::SetLinkLossConfig(leader, child, lossConfig);
+
+    for (uint16_t iter = 0; iter < kNumEchoRequests; iter++)
+    {
+        nexus.SendAndVerifyEchoRequest(leader, child.Get<Mle::Mle>().GetMeshLocalEid());
+    }
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Verify connectivity with bursty (Gilbert-Elliott) loss");
+
+    lossConfig                   = RadioModel::LossConfig();
+    lossConfig.mLossPercent      = 5;
+    lossConfig.mGoodToBadPercent = 10;
+    lossConfig.mBadToGoodPercent = 30;
+    lossConfig.mBadLossPercent   = 90;
+    RadioModel::SetLinkLossConfig(leader, child, lossConfig);
+
+    for (uint16_t iter = 0; iter < kNumEchoRequests; iter++)
+    {
+        nexus.SendAndVerifyEchoRequest(leader, child.Get<Mle::Mle>().GetMeshLocalEid(), 0, Ip6::kDefaultHopLimit,
+                                       /* aResponseTimeout */ 5 * 1000);
+    }
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Verify that a fully lossy link detaches the child");
+
+    lossConfig                 = RadioModel::LossConfig();
+    lossConfig.mLossPercent    = 100;
+    lossConfig.mBadLossPercent = 100;
+    RadioModel::SetLinkLossConfig(leader, child, lossConfig);
+
+    nexus.AdvanceTime(300 * 1000);
+    VerifyOrQuit(!child.Get<Mle::Mle>().IsChild());
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Clear loss configs and verify the child reattaches");
+
+    RadioModel::ClearLossConfigs();
+
+    nexus.AdvanceTime(300 * 1000);
+    VerifyOrQuit(child.Get<Mle::Mle>().IsAttached());
+    nexus.SendAndVerifyEchoRequest(leader, child.Get<Mle::Mle>().GetMeshLocalEid());
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestRadioLossModel();
+    printf("All tests passed\n");
+    return 0;
+}
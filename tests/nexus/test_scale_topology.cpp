@@ -0,0 +1,186 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+#include "platform/nexus_topology.hpp"
+
+namespace ot {
+namespace Nexus {
+
+// Multi-hop scale test using the `Topology` grid generator: forms a
+// `kNumRows x kNumCols` grid mesh, cuts it down the middle column
+// boundary into two halves, waits for both halves to elect their own
+// leader, then restores the cut links and verifies the partitions merge
+// back into one. Scale up `kNumRows`/`kNumCols` when reproducing
+// larger-network partition/merge dynamics locally.
+
+static constexpr uint16_t kNumRows  = 6;
+static constexpr uint16_t kNumCols  = 6;
+static constexpr uint16_t kNumNodes = kNumRows * kNumCols;
+static constexpr uint16_t kCutCol   = kNumCols / 2;
+
+static Node *sNodes[kNumNodes];
+
+static uint16_t CountLeaders(Core &aNexus)
+{
+    uint16_t numLeaders = 0;
+
+    for (Node &node : aNexus.GetNodes())
+    {
+        if (node.Get<Mle::Mle>().IsLeader())
+        {
+            numLeaders++;
+        }
+    }
+
+    return numLeaders;
+}
+
+static uint16_t CountDetachedOrDisabled(Core &aNexus)
+{
+    uint16_t numDetached = 0;
+
+    for (Node &node : aNexus.GetNodes())
+    {
+        Mle::DeviceRole role = node.Get<Mle::Mle>().GetRole();
+
+        if ((role == Mle::kRoleDetached) || (role == Mle::kRoleDisabled))
+        {
+            numDetached++;
+        }
+    }
+
+    return numDetached;
+}
+
+static void WaitForLeaderCount(Core &aNexus, uint16_t aNumLeaders, uint32_t aMaxWaitTime)
+{
+    static constexpr uint32_t kPollInterval = 1 * Time::kOneSecondInMsec;
+
+    for (uint32_t waitTime = 0; waitTime < aMaxWaitTime; waitTime += kPollInterval)
+    {
+        aNexus.AdvanceTime(kPollInterval);
+
+        if ((CountLeaders(aNexus) == aNumLeaders) && (CountDetachedOrDisabled(aNexus) == 0))
+        {
+            break;
+        }
+    }
+
+    VerifyOrQuit(CountLeaders(aNexus) == aNumLeaders);
+    VerifyOrQuit(CountDetachedOrDisabled(aNexus) == 0);
+}
+
+static void SetCutLinksEnabled(bool aEnabled)
+{
+    // Adds or removes all grid links (including diagonals) crossing the
+    // boundary between columns `kCutCol - 1` and `kCutCol`.
+
+    for (uint16_t row = 0; row < kNumRows; row++)
+    {
+        Node &left = *sNodes[row * kNumCols + (kCutCol - 1)];
+
+        for (uint16_t peerRow = (row > 0) ? (row - 1) : 0; (peerRow <= row + 1) && (peerRow < kNumRows); peerRow++)
+        {
+            Node &right = *sNodes[peerRow * kNumCols + kCutCol];
+
+            if (aEnabled)
+            {
+                AllowLinkBetween(left, right);
+            }
+            else
+            {
+                UnallowLinkBetween(left, right);
+            }
+        }
+    }
+}
+
+void Test(void)
+{
+    static constexpr uint32_t kMaxFormTime      = 20 * Time::kOneMinuteInMsec;
+    static constexpr uint32_t kMaxPartitionTime = 10 * Time::kOneMinuteInMsec;
+    static constexpr uint32_t kMaxMergeTime     = 10 * Time::kOneMinuteInMsec;
+
+    Core  nexus;
+    Node *firstNode;
+
+    Topology::CreateGrid(nexus, kNumRows, kNumCols, sNodes, /* aDiagonalLinks */ true);
+
+    nexus.AdvanceTime(0);
+
+    Log("Forming a %ux%u grid mesh (%u nodes)", kNumRows, kNumCols, kNumNodes);
+
+    firstNode = sNodes[0];
+    firstNode->Form();
+
+    for (uint16_t index = 1; index < kNumNodes; index++)
+    {
+        sNodes[index]->Join(*firstNode);
+    }
+
+    WaitForLeaderCount(nexus, 1, kMaxFormTime);
+
+    Log("Grid stabilized as a single partition after %lu sec",
+        ToUlong(nexus.GetNow().GetValue() / Time::kOneSecondInMsec));
+
+    Log("Cutting all links crossing the column %u/%u boundary", kCutCol - 1, kCutCol);
+
+    SetCutLinksEnabled(false);
+
+    WaitForLeaderCount(nexus, 2, kMaxPartitionTime);
+
+    Log("Both halves elected a leader, restoring the cut links");
+
+    SetCutLinksEnabled(true);
+
+    WaitForLeaderCount(nexus, 1, kMaxMergeTime);
+
+    for (uint16_t index = 1; index < kNumNodes; index++)
+    {
+        VerifyOrQuit(sNodes[index]->Get<Mle::Mle>().GetLeaderData().GetPartitionId() ==
+                     firstNode->Get<Mle::Mle>().GetLeaderData().GetPartitionId());
+    }
+
+    Log("Partitions merged back into one after %lu sec", ToUlong(nexus.GetNow().GetValue() / Time::kOneSecondInMsec));
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::Test();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -525,6 +525,171 @@ void TestVerhoeffChecksum(void)
 
 #endif // OPENTHREAD_CONFIG_VERHOEFF_CHECKSUM_ENABLE
 
+void TestChecksumAdjuster(void)
+{
+    constexpr uint32_t kNumRandomCases = 10000;
+    constexpr uint16_t kMinSize        = sizeof(Ip6::Udp::Header);
+    constexpr uint16_t kMaxSize        = Buffer::kSize + 24;
+    constexpr uint16_t kChecksumOffset = Ip6::Udp::Header::kChecksumFieldOffset;
+
+    Instance *instance = static_cast<Instance *>(testInitInstance());
+
+    VerifyOrQuit(instance != nullptr);
+
+    // Verify `Checksum::Adjuster` (RFC 1624 incremental update, as
+    // used by the NAT64 translator) against full checksum
+    // recomputation over randomized headers and payloads. Each case
+    // rewrites the pseudo-header addresses and the source port of a
+    // UDP message carrying a valid checksum, applies the collected
+    // adjustment, and checks that the result still verifies as a
+    // freshly computed checksum would.
+
+    for (uint32_t iteration = 0; iteration < kNumRandomCases; iteration++)
+    {
+        Message         *message = instance->Get<Ip6::Ip6>().NewMessage();
+        Ip6::Udp::Header udpHeader;
+        Ip6::MessageInfo messageInfo;
+        Ip6::Address     oldSource;
+        Ip6::Address     oldDest;
+        Ip6::Address     newSource;
+        Ip6::Address     newDest;
+        uint16_t         newSourcePort = Random::NonCrypto::GetUint16();
+        uint16_t         size          = Random::NonCrypto::GetUint16InRange(kMinSize, kMaxSize + 1);
+        uint16_t         checksum;
+
+        Checksum::Adjuster adjuster;
+
+        VerifyOrQuit(message != nullptr, "Ip6::NewMesssage() failed");
+        SuccessOrQuit(message->SetLength(size));
+
+        Random::NonCrypto::Fill(oldSource);
+        Random::NonCrypto::Fill(oldDest);
+        Random::NonCrypto::Fill(newSource);
+        Random::NonCrypto::Fill(newDest);
+
+        // Write UDP header with a random payload.
+
+        Random::NonCrypto::Fill(udpHeader);
+        udpHeader.SetChecksum(0);
+        message->Write(0, udpHeader);
+
+        if (size > sizeof(udpHeader))
+        {
+            uint8_t  buffer[kMaxSize];
+            uint16_t payloadSize = size - sizeof(udpHeader);
+
+            Random::NonCrypto::FillBuffer(buffer, payloadSize);
+            message->WriteBytes(sizeof(udpHeader), &buffer[0], payloadSize);
+        }
+
+        Checksum::UpdateMessageChecksum(*message, oldSource, oldDest, Ip6::kProtoUdp);
+
+        // Rewrite the addresses and the source port, collecting the
+        // old and new values in the `Adjuster`.
+
+        adjuster.RemoveData(oldSource.GetBytes(), sizeof(Ip6::Address));
+        adjuster.RemoveData(oldDest.GetBytes(), sizeof(Ip6::Address));
+        adjuster.AddData(newSource.GetBytes(), sizeof(Ip6::Address));
+        adjuster.AddData(newDest.GetBytes(), sizeof(Ip6::Address));
+
+        SuccessOrQuit(message->Read(0, udpHeader));
+        adjuster.RemoveUint16(udpHeader.GetSourcePort());
+        adjuster.AddUint16(newSourcePort);
+        udpHeader.SetSourcePort(newSourcePort);
+        message->Write(0, udpHeader);
+
+        adjuster.ApplyTo(*message, kChecksumOffset);
+
+        // The adjusted checksum must never be the omitted zero UDP
+        // checksum and must verify exactly as a recomputed one.
+
+        SuccessOrQuit(message->Read(kChecksumOffset, checksum));
+        VerifyOrQuit(checksum != 0);
+
+        VerifyOrQuit(CalculateChecksum(newSource, newDest, Ip6::kProtoUdp, *message) == 0xffff,
+                     "Adjusted checksum does not match full recomputation");
+
+        messageInfo.SetSockAddr(newSource);
+        messageInfo.SetPeerAddr(newDest);
+        SuccessOrQuit(Checksum::VerifyMessageChecksum(*message, messageInfo, Ip6::kProtoUdp));
+
+        message->Free();
+    }
+
+    // Sweep the source port over all values on a fixed message,
+    // chaining one adjustment to the next, and compare every adjusted
+    // checksum with a full recomputation. The sweep is guaranteed to
+    // hit the case where the checksum folds to zero and must be
+    // emitted as `0xffff` (zero is reserved for "no checksum" in
+    // UDP), and the steps following it verify that later incremental
+    // updates remain correct with the `0xffff` normalization stored
+    // in the message (both one's complement representations of zero).
+
+    {
+        Message         *message = instance->Get<Ip6::Ip6>().NewMessage();
+        Ip6::Udp::Header udpHeader;
+        Ip6::Address     source;
+        Ip6::Address     dest;
+        uint16_t         prevPort;
+        bool             sawZeroFold = false;
+
+        VerifyOrQuit(message != nullptr, "Ip6::NewMesssage() failed");
+
+        SuccessOrQuit(source.FromString("fd00:1122:3344:5566:7788:99aa:bbcc:ddee"));
+        SuccessOrQuit(dest.FromString("fd01:2345:6789:abcd:ef01:2345:6789:abcd"));
+
+        SuccessOrQuit(message->SetLength(sizeof(udpHeader)));
+        Random::NonCrypto::Fill(udpHeader);
+        udpHeader.SetChecksum(0);
+        message->Write(0, udpHeader);
+
+        Checksum::UpdateMessageChecksum(*message, source, dest, Ip6::kProtoUdp);
+
+        prevPort = udpHeader.GetSourcePort();
+
+        for (uint32_t port = 0; port <= 0xffff; port++)
+        {
+            Checksum::Adjuster adjuster;
+            uint16_t           adjusted;
+            uint16_t           expected;
+
+            adjuster.RemoveUint16(prevPort);
+            adjuster.AddUint16(static_cast<uint16_t>(port));
+
+            SuccessOrQuit(message->Read(0, udpHeader));
+            udpHeader.SetSourcePort(static_cast<uint16_t>(port));
+            message->Write(0, udpHeader);
+
+            adjuster.ApplyTo(*message, kChecksumOffset);
+            SuccessOrQuit(message->Read(kChecksumOffset, adjusted));
+
+            // Full recomputation reference (checksum field zeroed),
+            // normalizing a zero result to `0xffff`.
+
+            message->Write(kChecksumOffset, static_cast<uint16_t>(0));
+            expected = static_cast<uint16_t>(~CalculateChecksum(source, dest, Ip6::kProtoUdp, *message));
+
+            if (expected == 0)
+            {
+                expected    = 0xffff;
+                sawZeroFold = true;
+            }
+
+            VerifyOrQuit(adjusted == BigEndian::HostSwap16(expected),
+                         "Adjusted checksum does not match full recomputation");
+
+            message->Write(kChecksumOffset, adjusted);
+            prevPort = static_cast<uint16_t>(port);
+        }
+
+        VerifyOrQuit(sawZeroFold, "Port sweep did not cover the zero-checksum normalization");
+
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
@@ -535,6 +700,7 @@ int main(void)
     ot::TestTcp4MessageChecksum();
     ot::TestUdp4MessageChecksum();
     ot::TestIcmp4MessageChecksum();
+    ot::TestChecksumAdjuster();
 #if OPENTHREAD_CONFIG_VERHOEFF_CHECKSUM_ENABLE
     ot::TestVerhoeffChecksum();
 #endif
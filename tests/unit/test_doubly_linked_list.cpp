@@ -0,0 +1,235 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdarg.h>
+#include <string.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/array.hpp"
+#include "common/debug.hpp"
+#include "common/doubly_linked_list.hpp"
+#include "instance/instance.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+
+struct Entry : public DoublyLinkedListEntry<Entry>
+{
+public:
+    explicit Entry(const char *aName)
+        : mName(aName)
+        , mNext(nullptr)
+        , mPrev(nullptr)
+    {
+    }
+
+    const char *GetName(void) const { return mName; }
+
+    const char *mName;
+    Entry      *mNext;
+    Entry      *mPrev;
+};
+
+// This function verifies the content of the doubly linked list matches a given list of entries, checking the forward
+// iteration order along with the previous pointer on every entry.
+void VerifyDoublyLinkedListContent(const DoublyLinkedList<Entry> *aList, ...)
+{
+    va_list      args;
+    Entry       *argEntry;
+    Entry       *argPrev = nullptr;
+    const Entry  unlisted("unlisted");
+
+    va_start(args, aList);
+
+    for (const Entry &entry : *aList)
+    {
+        argEntry = va_arg(args, Entry *);
+        VerifyOrQuit(argEntry != nullptr, "List contains more entries than expected");
+        VerifyOrQuit(argEntry == &entry, "List does not contain the same entry");
+        VerifyOrQuit(entry.GetPrev() == argPrev, "Entry previous pointer is incorrect");
+        VerifyOrQuit(aList->Contains(*argEntry));
+
+        argPrev = argEntry;
+    }
+
+    argEntry = va_arg(args, Entry *);
+    VerifyOrQuit(argEntry == nullptr, "List contains less entries than expected");
+
+    va_end(args);
+
+    VerifyOrQuit((argPrev == nullptr) || (argPrev->GetNext() == nullptr), "Tail next pointer is incorrect");
+
+    VerifyOrQuit(aList->IsEmpty() == (aList->GetHead() == nullptr));
+    VerifyOrQuit(!aList->Contains(unlisted), "succeeded for a missing entry");
+}
+
+void TestDoublyLinkedList(void)
+{
+    Entry                   a("a"), b("b"), c("c"), d("d"), e("e"), f("f");
+    DoublyLinkedList<Entry> list;
+    DoublyLinkedList<Entry> otherList;
+
+    printf("TestDoublyLinkedList\n");
+
+    VerifyOrQuit(list.IsEmpty(), "failed after init");
+    VerifyOrQuit(list.GetHead() == nullptr, "failed after init");
+    VerifyOrQuit(list.Pop() == nullptr, "failed when empty");
+
+    VerifyDoublyLinkedListContent(&list, nullptr);
+
+    // Push at head
+
+    list.Push(a);
+    VerifyOrQuit(!list.IsEmpty());
+    VerifyOrQuit(list.GetHead() == &a);
+    VerifyDoublyLinkedListContent(&list, &a, nullptr);
+
+    list.Push(b);
+    VerifyDoublyLinkedListContent(&list, &b, &a, nullptr);
+
+    list.Push(c);
+    VerifyDoublyLinkedListContent(&list, &c, &b, &a, nullptr);
+
+    // Push at tail (`PushAfter()` the current tail entry)
+
+    list.PushAfter(d, a);
+    VerifyDoublyLinkedListContent(&list, &c, &b, &a, &d, nullptr);
+
+    list.PushAfter(e, d);
+    VerifyDoublyLinkedListContent(&list, &c, &b, &a, &d, &e, nullptr);
+
+    // Push in the middle
+
+    list.PushAfter(f, b);
+    VerifyDoublyLinkedListContent(&list, &c, &b, &f, &a, &d, &e, nullptr);
+
+    // Pop from head
+
+    VerifyOrQuit(list.Pop() == &c);
+    VerifyDoublyLinkedListContent(&list, &b, &f, &a, &d, &e, nullptr);
+
+    // Pop from tail (O(1) `Remove()` of the tail entry)
+
+    list.Remove(e);
+    VerifyDoublyLinkedListContent(&list, &b, &f, &a, &d, nullptr);
+
+    // Remove head, middle, and tail entries
+
+    list.Remove(b);
+    VerifyDoublyLinkedListContent(&list, &f, &a, &d, nullptr);
+
+    list.Remove(a);
+    VerifyDoublyLinkedListContent(&list, &f, &d, nullptr);
+
+    list.Remove(d);
+    VerifyDoublyLinkedListContent(&list, &f, nullptr);
+
+    // Remove the last remaining entry
+
+    list.Remove(f);
+    VerifyOrQuit(list.IsEmpty());
+    VerifyDoublyLinkedListContent(&list, nullptr);
+
+    // Re-add the entries and iterate over the list
+
+    list.Push(c);
+    list.Push(b);
+    list.Push(a);
+    VerifyDoublyLinkedListContent(&list, &a, &b, &c, nullptr);
+
+    {
+        const Entry *expected[] = {&a, &b, &c};
+        uint16_t     index      = 0;
+
+        for (Entry &entry : list)
+        {
+            VerifyOrQuit(index < GetArrayLength(expected));
+            VerifyOrQuit(&entry == expected[index]);
+            index++;
+        }
+
+        VerifyOrQuit(index == GetArrayLength(expected));
+
+        index = 0;
+
+        for (const Entry &entry : static_cast<const DoublyLinkedList<Entry> &>(list))
+        {
+            VerifyOrQuit(&entry == expected[index]);
+            index++;
+        }
+
+        VerifyOrQuit(index == GetArrayLength(expected));
+    }
+
+    // Containment checks
+
+    VerifyOrQuit(list.Contains(a));
+    VerifyOrQuit(list.Contains(b));
+    VerifyOrQuit(list.Contains(c));
+    VerifyOrQuit(!list.Contains(d), "succeeded for a missing entry");
+    VerifyOrQuit(!otherList.Contains(a), "succeeded when empty");
+
+    // `TakeAllFrom()`
+
+    otherList.Push(e);
+    otherList.Push(d);
+    VerifyDoublyLinkedListContent(&otherList, &d, &e, nullptr);
+
+    list.TakeAllFrom(otherList);
+    VerifyOrQuit(otherList.IsEmpty());
+    VerifyDoublyLinkedListContent(&otherList, nullptr);
+    VerifyDoublyLinkedListContent(&list, &d, &e, &a, &b, &c, nullptr);
+
+    list.TakeAllFrom(otherList);
+    VerifyDoublyLinkedListContent(&list, &d, &e, &a, &b, &c, nullptr);
+
+    otherList.TakeAllFrom(list);
+    VerifyOrQuit(list.IsEmpty());
+    VerifyDoublyLinkedListContent(&list, nullptr);
+    VerifyDoublyLinkedListContent(&otherList, &d, &e, &a, &b, &c, nullptr);
+
+    // `Clear()`
+
+    otherList.Clear();
+    VerifyOrQuit(otherList.IsEmpty(), "failed after Clear()");
+    VerifyOrQuit(otherList.Pop() == nullptr);
+    VerifyDoublyLinkedListContent(&otherList, nullptr);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestDoublyLinkedList();
+    printf("All tests passed\n");
+    return 0;
+}
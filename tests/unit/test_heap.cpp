@@ -167,10 +167,67 @@ void TestAllocateMultiple(void)
     }
 }
 
+/**
+ * Verifies the heap statistics.
+ */
+void TestHeapStats(void)
+{
+    ot::Utils::Heap heap;
+    otHeapStats     stats;
+    uint16_t        numBlocks = 0;
+
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mCapacity == heap.GetCapacity(), "TestHeapStats bad capacity!");
+    VerifyOrQuit(stats.mFreeSize == heap.GetFreeSize(), "TestHeapStats bad free size!");
+    VerifyOrQuit(stats.mNumFreeBlocks == 1, "TestHeapStats expected a single free block!");
+    VerifyOrQuit(stats.mLargestFreeBlockSize == heap.GetCapacity(), "TestHeapStats bad largest free block!");
+    VerifyOrQuit(stats.mNumAllocations == 0 && stats.mNumFrees == 0 && stats.mNumFailedAllocations == 0,
+                 "TestHeapStats counters not zero initially!");
+
+    {
+        void *p1 = heap.CAlloc(1, 100);
+        void *p2 = heap.CAlloc(1, 200);
+        void *p3 = heap.CAlloc(1, 50);
+
+        VerifyOrQuit(p1 != nullptr && p2 != nullptr && p3 != nullptr, "TestHeapStats allocation failed!");
+
+        // Freeing the middle allocation creates a hole, so there must
+        // be two free blocks with the larger one still at the end.
+        heap.Free(p2);
+
+        heap.GetStats(stats);
+        VerifyOrQuit(stats.mNumAllocations == 3, "TestHeapStats bad allocation count!");
+        VerifyOrQuit(stats.mNumFrees == 1, "TestHeapStats bad free count!");
+        VerifyOrQuit(stats.mNumFreeBlocks == 2, "TestHeapStats expected two free blocks!");
+        VerifyOrQuit(stats.mLargestFreeBlockSize >= 200, "TestHeapStats bad largest free block!");
+
+        for (uint8_t bin = 0; bin < OT_HEAP_NUM_SIZE_BINS; bin++)
+        {
+            numBlocks += stats.mNumFreeBlocksInBin[bin];
+        }
+
+        VerifyOrQuit(numBlocks == stats.mNumFreeBlocks, "TestHeapStats bin counts do not sum to total!");
+
+        VerifyOrQuit(heap.CAlloc(1, heap.GetCapacity() * 2) == nullptr, "TestHeapStats oversized alloc succeeded!");
+        heap.GetStats(stats);
+        VerifyOrQuit(stats.mNumFailedAllocations == 1, "TestHeapStats bad failed allocation count!");
+
+        heap.Free(p1);
+        heap.Free(p3);
+    }
+
+    VerifyOrQuit(heap.IsClean(), "TestHeapStats heap not clean after freeing all!");
+
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mNumFreeBlocks == 1 && stats.mLargestFreeBlockSize == heap.GetCapacity(),
+                 "TestHeapStats heap did not coalesce back to a single block!");
+}
+
 void RunTimerTests(void)
 {
     TestAllocateSingle();
     TestAllocateMultiple();
+    TestHeapStats();
 }
 
 #endif // !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
@@ -446,6 +446,114 @@ public:
         message->Free();
         testFreeInstance(instance);
     }
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+    static void TestSharedBufferCloning(void)
+    {
+        static constexpr uint16_t kLength = (Buffer::kSize * 3 + 24);
+
+        Instance    *instance;
+        MessagePool *messagePool;
+        Message     *message;
+        Message     *clone;
+        Message     *secondClone;
+        uint8_t      writeBuffer[kLength];
+        uint16_t     freeBufferCount;
+
+        printf("TestSharedBufferCloning()\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+
+        messagePool = &instance->Get<MessagePool>();
+
+        freeBufferCount = messagePool->GetFreeBufferCount();
+
+        message = messagePool->Allocate(Message::kTypeIp6, /* aReserveHeader */ 20);
+        VerifyOrQuit(message != nullptr);
+
+        Random::NonCrypto::FillBuffer(writeBuffer, sizeof(writeBuffer));
+        SuccessOrQuit(message->AppendBytes(writeBuffer, kLength));
+        message->SetOffset(10);
+
+        // Clone sharing the buffers. Both messages should now report a
+        // shared chain and point to the very same tail buffers.
+
+        clone = message->CloneWithSharedBuffers();
+        VerifyOrQuit(clone != nullptr);
+
+        VerifyOrQuit(message->AreBuffersShared());
+        VerifyOrQuit(clone->AreBuffersShared());
+        VerifyOrQuit(clone->GetNextBuffer() == message->GetNextBuffer());
+
+        VerifyOrQuit(clone->GetLength() == kLength);
+        VerifyOrQuit(clone->GetReserved() == message->GetReserved());
+        VerifyOrQuit(clone->GetOffset() == 10);
+        VerifyOrQuit(clone->GetType() == Message::kTypeIp6);
+        VerifyOrQuit(clone->CompareBytes(0, writeBuffer, kLength));
+
+        // Shrinking a shared message must not copy or free the shared
+        // buffers.
+
+        clone->RemoveFooter(24);
+        VerifyOrQuit(clone->GetLength() == kLength - 24);
+        VerifyOrQuit(clone->AreBuffersShared());
+        VerifyOrQuit(clone->GetNextBuffer() == message->GetNextBuffer());
+        VerifyOrQuit(clone->CompareBytes(0, writeBuffer, kLength - 24));
+        VerifyOrQuit(message->GetLength() == kLength);
+
+        // Writing into the payload beyond the head buffer must trigger
+        // copy-on-write, leaving the original message unchanged.
+
+        secondClone = message->CloneWithSharedBuffers();
+        VerifyOrQuit(secondClone != nullptr);
+        VerifyOrQuit(secondClone->GetNextBuffer() == message->GetNextBuffer());
+
+        writeBuffer[kLength - 10] ^= 0xff;
+        secondClone->WriteBytes(kLength - 10, &writeBuffer[kLength - 10], 1);
+
+        VerifyOrQuit(!secondClone->AreBuffersShared());
+        VerifyOrQuit(secondClone->GetNextBuffer() != message->GetNextBuffer());
+        VerifyOrQuit(secondClone->CompareBytes(0, writeBuffer, kLength));
+
+        writeBuffer[kLength - 10] ^= 0xff;
+        VerifyOrQuit(message->CompareBytes(0, writeBuffer, kLength));
+        VerifyOrQuit(message->AreBuffersShared());
+
+        secondClone->Free();
+
+        // Growing a shared message must also trigger copy-on-write.
+
+        SuccessOrQuit(clone->AppendBytes(writeBuffer, 64));
+        VerifyOrQuit(!clone->AreBuffersShared());
+        VerifyOrQuit(clone->GetNextBuffer() != message->GetNextBuffer());
+        VerifyOrQuit(!message->AreBuffersShared());
+        VerifyOrQuit(clone->CompareBytes(0, writeBuffer, kLength - 24));
+        VerifyOrQuit(clone->CompareBytes(kLength - 24, writeBuffer, 64));
+        VerifyOrQuit(message->CompareBytes(0, writeBuffer, kLength));
+
+        clone->Free();
+
+        // Freeing the original first must keep the shared buffers
+        // alive for the remaining clone.
+
+        clone = message->CloneWithSharedBuffers();
+        VerifyOrQuit(clone != nullptr);
+
+        message->Free();
+        VerifyOrQuit(!clone->AreBuffersShared());
+        VerifyOrQuit(clone->CompareBytes(0, writeBuffer, kLength));
+
+        clone->Free();
+
+        // All buffers (including the shared ones) should be back in
+        // the pool.
+
+        VerifyOrQuit(messagePool->GetFreeBufferCount() == freeBufferCount);
+
+        testFreeInstance(instance);
+    }
+#endif // OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
 };
 
 void TestAppender(void)
@@ -537,6 +645,75 @@ void TestAppender(void)
     testFreeInstance(instance);
 }
 
+void TestAppenderReserve(void)
+{
+    const uint8_t kValue[]  = {0x11, 0x22, 0x33, 0x44, 0x55};
+    const uint8_t kHeader[] = {0xa0, sizeof(kValue)};
+
+    static constexpr uint16_t kMaxBufferSize = sizeof(kHeader) + sizeof(kValue) + 2;
+
+    Instance *instance;
+    Message  *message;
+    uint8_t   buffer[kMaxBufferSize];
+    uint8_t   expected[kMaxBufferSize];
+    uint16_t  offset;
+    Appender  bufAppender(buffer, sizeof(buffer));
+
+    printf("TestAppenderReserve\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    memcpy(expected, kHeader, sizeof(kHeader));
+    memcpy(expected + sizeof(kHeader), kValue, sizeof(kValue));
+
+    // Reserve and commit a header in a buffer `Appender`, appending
+    // the value in between.
+
+    memset(buffer, 0xff, sizeof(buffer));
+
+    SuccessOrQuit(bufAppender.ReserveBytes(sizeof(kHeader), offset));
+    VerifyOrQuit(offset == 0);
+    VerifyOrQuit(bufAppender.GetAppendedLength() == sizeof(kHeader));
+    VerifyOrQuit(memcmp(buffer, "\0\0", sizeof(kHeader)) == 0);
+
+    SuccessOrQuit(bufAppender.AppendBytes(kValue, sizeof(kValue)));
+    bufAppender.WriteBytes(offset, kHeader, sizeof(kHeader));
+
+    VerifyOrQuit(memcmp(buffer, expected, sizeof(kHeader) + sizeof(kValue)) == 0);
+
+    // A failed reservation must remove any partially appended
+    // placeholder bytes.
+
+    VerifyOrQuit(bufAppender.ReserveBytes(kMaxBufferSize, offset) == kErrorNoBufs);
+    VerifyOrQuit(bufAppender.GetAppendedLength() == sizeof(kHeader) + sizeof(kValue));
+
+    // Repeat with a message `Appender` on a message with existing
+    // content, verifying offsets are relative to the appended content.
+
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->Append(kValue));
+
+    {
+        Appender msgAppender(*message);
+
+        SuccessOrQuit(msgAppender.ReserveBytes(sizeof(kHeader), offset));
+        VerifyOrQuit(offset == 0);
+        SuccessOrQuit(msgAppender.AppendBytes(kValue, sizeof(kValue)));
+        msgAppender.Write(offset, kHeader);
+
+        VerifyOrQuit(msgAppender.GetAppendedLength() == sizeof(kHeader) + sizeof(kValue));
+        VerifyOrQuit(message->GetLength() == sizeof(kValue) + sizeof(kHeader) + sizeof(kValue));
+        VerifyOrQuit(message->Compare(0, kValue));
+        VerifyOrQuit(message->Compare(sizeof(kValue), kHeader));
+        VerifyOrQuit(message->Compare(sizeof(kValue) + sizeof(kHeader), kValue));
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
@@ -549,7 +726,11 @@ int main(void)
     }
 
     ot::UnitTester::TestCloning();
+#if OPENTHREAD_CONFIG_MESSAGE_SHARED_BUFFER_CLONE_ENABLE
+    ot::UnitTester::TestSharedBufferCloning();
+#endif
     ot::TestAppender();
+    ot::TestAppenderReserve();
 
     printf("All tests passed\n");
     return 0;
@@ -51,6 +51,8 @@ void VerifyPriorityQueueContent(PriorityQueue &aPriorityQueue, int aExpectedLeng
     memset(&info, 0, sizeof(info));
     aPriorityQueue.GetInfo(info);
     VerifyOrQuit(info.mNumMessages == aExpectedLength, "GetInfo() result does not match expected len.");
+    VerifyOrQuit(aPriorityQueue.GetNumMessages() == aExpectedLength, "GetNumMessages() does not match expected len.");
+    VerifyOrQuit(info.mMaxNumMessages >= info.mNumMessages, "Queue-depth watermark is below current queue depth.");
 
     va_start(args, aExpectedLength);
 
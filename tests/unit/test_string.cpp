@@ -31,7 +31,9 @@
 #include <openthread/config.h>
 
 #include "test_util.h"
+#include "common/array.hpp"
 #include "common/code_utils.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/string.hpp"
 
 namespace ot {
@@ -456,6 +458,201 @@ void TestStringCopy(void)
     printf(" -- PASS\n");
 }
 
+#if OPENTHREAD_CONFIG_LIGHTWEIGHT_STRING_FORMATTER_ENABLE
+
+static uint32_t sRandState = 0x1234abcd;
+
+uint32_t GetPseudoRandom(uint32_t aMax)
+{
+    // Simple xorshift generator with a fixed seed, so failing cases
+    // are reproducible.
+
+    sRandState ^= sRandState << 13;
+    sRandState ^= sRandState >> 17;
+    sRandState ^= sRandState << 5;
+
+    return sRandState % aMax;
+}
+
+void VerifyFormat(uint16_t aBufferSize, const char *aFormat, ...)
+{
+    static constexpr uint16_t kMaxSize = 256;
+
+    char    expected[kMaxSize];
+    char    buffer[kMaxSize];
+    int     expectedLength;
+    va_list args;
+
+    VerifyOrQuit((aBufferSize > 0) && (aBufferSize <= kMaxSize));
+
+    va_start(args, aFormat);
+    expectedLength = vsnprintf(expected, aBufferSize, aFormat, args);
+    va_end(args);
+
+    VerifyOrQuit(expectedLength >= 0);
+
+    {
+        StringWriter writer(buffer, aBufferSize);
+
+        va_start(args, aFormat);
+        writer.AppendVarArgs(aFormat, args);
+        va_end(args);
+
+        VerifyOrQuit(writer.GetLength() == static_cast<uint16_t>(expectedLength),
+                     "Formatted length does not match vsnprintf()");
+        VerifyOrQuit(writer.IsTruncated() == (expectedLength + 1 > aBufferSize));
+    }
+
+    VerifyOrQuit(memcmp(buffer, expected, strlen(expected) + 1) == 0, "Formatted output does not match vsnprintf()");
+}
+
+void TestLightweightFormatter(void)
+{
+    static constexpr uint16_t kNumRandomCases = 10000;
+
+    static const char *const kStrings[] = {"", "a", "hello", "(null)", "a somewhat longer string value"};
+
+    printf("\nTest 12: Lightweight formatter differential verification against vsnprintf()\n");
+
+    // Directed edge cases.
+
+    VerifyFormat(64, "no conversions");
+    VerifyFormat(64, "%%");
+    VerifyFormat(64, "%d%u%x", 0, 0U, 0U);
+    VerifyFormat(64, "%d", -1);
+    VerifyFormat(64, "%08d", -42);
+    VerifyFormat(64, "%-8d|", -42);
+    VerifyFormat(64, "%d", NumericLimits<int32_t>::kMin);
+    VerifyFormat(64, "%lld", NumericLimits<int64_t>::kMin);
+    VerifyFormat(64, "%llu", NumericLimits<uint64_t>::kMax);
+    VerifyFormat(64, "%llx", NumericLimits<uint64_t>::kMax);
+    VerifyFormat(64, "%030lld", NumericLimits<int64_t>::kMin);
+    VerifyFormat(64, "%5c|%-5c|", 'a', 'b');
+    VerifyFormat(64, "%10s|%-10s|", "abc", "xyz");
+
+    // Unsupported conversions must fall back to `vsnprintf()` and
+    // still produce identical output.
+
+    VerifyFormat(64, "%+d", 42);
+    VerifyFormat(64, "%5.2f", 1.5);
+    VerifyFormat(64, "%.3s", "abcdef");
+    VerifyFormat(64, "%hu", static_cast<unsigned short>(12));
+
+    // Truncation at every buffer size, including reported lengths.
+
+    for (uint16_t size = 1; size <= 40; size++)
+    {
+        VerifyFormat(size, "value: %-12lld and %04x!", static_cast<long long>(-1234567890123LL), 0xbeefU);
+    }
+
+    // Randomized cases covering the supported conversions with random
+    // flags, widths, length modifiers, values, and buffer sizes.
+
+    for (uint16_t iteration = 0; iteration < kNumRandomCases; iteration++)
+    {
+        static const char kConversions[] = {'d', 'i', 'u', 'x', 'X'};
+
+        char     format[32];
+        char     widthString[4] = "";
+        uint64_t value          = (static_cast<uint64_t>(GetPseudoRandom(0xffffffff)) << 32) +
+                         GetPseudoRandom(0xffffffff);
+        const char *lengthMod   = "";
+        uint8_t     numLongs    = static_cast<uint8_t>(GetPseudoRandom(3));
+        char        conversion  = kConversions[GetPseudoRandom(sizeof(kConversions))];
+        uint16_t    bufferSize  = static_cast<uint16_t>(1 + GetPseudoRandom(80));
+
+        switch (numLongs)
+        {
+        case 1:
+            lengthMod = "l";
+            break;
+        case 2:
+            lengthMod = "ll";
+            break;
+        default:
+            break;
+        }
+
+        if (GetPseudoRandom(2) != 0)
+        {
+            snprintf(widthString, sizeof(widthString), "%u", static_cast<unsigned>(1 + GetPseudoRandom(30)));
+        }
+
+        switch (GetPseudoRandom(6))
+        {
+        case 0:
+            // Small values exercise width padding.
+            value %= 10;
+            break;
+        case 1:
+            value %= 1000;
+            break;
+        default:
+            break;
+        }
+
+        snprintf(format, sizeof(format), ">%%%s%s%s%s%c<", (GetPseudoRandom(2) != 0) ? "-" : "",
+                 (GetPseudoRandom(2) != 0) ? "0" : "", widthString, lengthMod, conversion);
+
+        switch (numLongs)
+        {
+        case 0:
+            if ((conversion == 'd') || (conversion == 'i'))
+            {
+                VerifyFormat(bufferSize, format, static_cast<int>(value));
+            }
+            else
+            {
+                VerifyFormat(bufferSize, format, static_cast<unsigned int>(value));
+            }
+            break;
+
+        case 1:
+            if ((conversion == 'd') || (conversion == 'i'))
+            {
+                VerifyFormat(bufferSize, format, static_cast<long>(value));
+            }
+            else
+            {
+                VerifyFormat(bufferSize, format, static_cast<unsigned long>(value));
+            }
+            break;
+
+        default:
+            if ((conversion == 'd') || (conversion == 'i'))
+            {
+                VerifyFormat(bufferSize, format, static_cast<long long>(value));
+            }
+            else
+            {
+                VerifyFormat(bufferSize, format, static_cast<unsigned long long>(value));
+            }
+            break;
+        }
+    }
+
+    // Randomized `%c` and `%s` cases.
+
+    for (uint16_t iteration = 0; iteration < kNumRandomCases / 10; iteration++)
+    {
+        char        format[32];
+        char        c          = static_cast<char>(' ' + GetPseudoRandom(94));
+        const char *string     = kStrings[GetPseudoRandom(GetArrayLength(kStrings))];
+        uint16_t    bufferSize = static_cast<uint16_t>(1 + GetPseudoRandom(40));
+        unsigned    width      = static_cast<unsigned>(GetPseudoRandom(15));
+
+        snprintf(format, sizeof(format), "[%%%s%uc]", (GetPseudoRandom(2) != 0) ? "-" : "", width);
+        VerifyFormat(bufferSize, format, c);
+
+        snprintf(format, sizeof(format), "[%%%s%us]", (GetPseudoRandom(2) != 0) ? "-" : "", width);
+        VerifyFormat(bufferSize, format, string);
+    }
+
+    printf(" -- PASS\n");
+}
+
+#endif // OPENTHREAD_CONFIG_LIGHTWEIGHT_STRING_FORMATTER_ENABLE
+
 // gcc-4 does not support constexpr function
 #if __GNUC__ > 4
 static_assert(ot::AreStringsInOrder("a", "b"), "AreStringsInOrder() failed");
@@ -489,6 +686,9 @@ int main(void)
     ot::TestStringToLowercase();
     ot::TestStringParseUint8();
     ot::TestStringCopy();
+#if OPENTHREAD_CONFIG_LIGHTWEIGHT_STRING_FORMATTER_ENABLE
+    ot::TestLightweightFormatter();
+#endif
     printf("\nAll tests passed.\n");
     return 0;
 }
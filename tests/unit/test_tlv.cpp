@@ -487,12 +487,103 @@ void TestTlvInfo(void)
     testFreeInstance(instance);
 }
 
+void TestTlvIndex(void)
+{
+    static constexpr uint8_t kNumTlvs = 20; // More than the `Tlv::Index` capacity.
+
+    Instance   *instance;
+    Message    *message;
+    Tlv         tlv;
+    ExtendedTlv extTlv;
+    Tlv::Info   info;
+    OffsetRange offsetRange;
+    uint8_t     u8;
+    uint16_t    u16;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeOther);
+    VerifyOrQuit(message != nullptr);
+
+    // Append TLVs with types 1 to `kNumTlvs`, each with a one-byte
+    // value equal to its type. Make every fourth TLV extended.
+
+    for (uint8_t type = 1; type <= kNumTlvs; type++)
+    {
+        if ((type % 4) == 0)
+        {
+            extTlv.SetType(type);
+            extTlv.SetLength(1);
+            SuccessOrQuit(message->Append(extTlv));
+        }
+        else
+        {
+            tlv.SetType(type);
+            tlv.SetLength(1);
+            SuccessOrQuit(message->Append(tlv));
+        }
+
+        SuccessOrQuit(message->Append<uint8_t>(type));
+    }
+
+    {
+        Tlv::Index index(*message);
+
+        // Look up every TLV, including ones beyond the index capacity
+        // (which should be found through the fallback message scan).
+
+        for (uint8_t type = 1; type <= kNumTlvs; type++)
+        {
+            SuccessOrQuit(index.Find(type, info));
+            VerifyOrQuit(info.GetType() == type);
+            VerifyOrQuit(info.GetLength() == 1);
+            VerifyOrQuit(info.IsExtended() == ((type % 4) == 0));
+
+            SuccessOrQuit(index.FindTlvValueOffsetRange(type, offsetRange));
+            VerifyOrQuit(offsetRange.GetOffset() == info.GetValueOffset());
+            VerifyOrQuit(offsetRange.GetLength() == info.GetValueOffsetRange().GetLength());
+
+            u8 = 0;
+            SuccessOrQuit(index.FindTlv(type, &u8, sizeof(u8)));
+            VerifyOrQuit(u8 == type);
+        }
+
+        VerifyOrQuit(index.Find(kNumTlvs + 1, info) == kErrorNotFound);
+
+        // Read a TLV back as a `Tlv` and verify its header.
+
+        SuccessOrQuit(index.FindTlv(1, sizeof(tlv), tlv));
+        VerifyOrQuit(tlv.GetType() == 1);
+        VerifyOrQuit(tlv.GetLength() == 1);
+
+        // Reading a one-byte value as `uint16_t` should fail to parse.
+
+        VerifyOrQuit(index.FindTlv(1, &u16, sizeof(u16)) == kErrorParse);
+    }
+
+    // Rebuild the index from a truncated message (last TLV becomes
+    // malformed) and verify the earlier TLVs are still found.
+
+    message->SetLength(message->GetLength() - 1);
+
+    {
+        Tlv::Index index(*message);
+
+        SuccessOrQuit(index.Find(1, info));
+        VerifyOrQuit(index.Find(kNumTlvs, info) == kErrorNotFound);
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestTlv();
     ot::TestTlvInfo();
+    ot::TestTlvIndex();
     printf("All tests passed\n");
     return 0;
 }
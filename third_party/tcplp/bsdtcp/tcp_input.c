@@ -1428,7 +1428,17 @@ tcp_do_segment(struct ip6_hdr* ip6, struct tcphdr *th, otMessage* msg,
 			 */
 
 			if (!tpiscantrcv(tp)) {
-				cbuf_write(&tp->recvbuf, msg, otMessageGetOffset(msg) + drop_hdrlen, tlen, cbuf_copy_from_message);
+				/*
+				 * If the host captures the segment for zero-copy receive, the
+				 * payload stays in the message; reserve the corresponding
+				 * space in the receive buffer so that the window accounting
+				 * is unchanged.
+				 */
+				if (tp->recvzerocopy && tlen > 0 && tcplp_sys_capture_segment(tp, msg, otMessageGetOffset(msg) + drop_hdrlen, tlen)) {
+					cbuf_write(&tp->recvbuf, NULL, 0, tlen, cbuf_copy_nothing);
+				} else {
+					cbuf_write(&tp->recvbuf, msg, otMessageGetOffset(msg) + drop_hdrlen, tlen, cbuf_copy_from_message);
+				}
 				if (tlen > 0) {
 					sig->recvbuf_added = true;
 				}
@@ -2158,6 +2168,7 @@ tcp_do_segment(struct ip6_hdr* ip6, struct tcphdr *th, otMessage* msg,
 					cc_ack_received(tp, th, CC_DUPACK);
 					tcp_timer_activate(tp, TT_REXMT, 0);
 					tp->t_rtttime = 0;
+					tp->t_rexmtcnt++;
 
 #ifdef INSTRUMENT_TCP
 					tcplp_sys_log("TCP DUPACK_THRESH");
@@ -2584,7 +2595,17 @@ step6:
 			 * sbappendstream_locked(&so->so_rcv, m, 0);).
 			 */
 			if (!tpiscantrcv(tp)) {
-				cbuf_write(&tp->recvbuf, msg, otMessageGetOffset(msg) + drop_hdrlen, tlen, cbuf_copy_from_message);
+				/*
+				 * If the host captures the segment for zero-copy receive, the
+				 * payload stays in the message; reserve the corresponding
+				 * space in the receive buffer so that the window accounting
+				 * is unchanged.
+				 */
+				if (tp->recvzerocopy && tlen > 0 && tcplp_sys_capture_segment(tp, msg, otMessageGetOffset(msg) + drop_hdrlen, tlen)) {
+					cbuf_write(&tp->recvbuf, NULL, 0, tlen, cbuf_copy_nothing);
+				} else {
+					cbuf_write(&tp->recvbuf, msg, otMessageGetOffset(msg) + drop_hdrlen, tlen, cbuf_copy_from_message);
+				}
 				if (tlen > 0) {
 					sig->recvbuf_added = true;
 				}
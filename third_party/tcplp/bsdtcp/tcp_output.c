@@ -121,6 +121,8 @@ tcplp_output(struct tcpcb *tp)
 	struct tcpopt to;
 	unsigned int wanted_cookie = 0;
 	unsigned int dont_sendalot = 0;
+	uint32_t burst = 0;
+	uint32_t maxburst = tcplp_sys_get_max_burst(tp);
 	uint8_t opt[TCP_MAXOLEN];
 	uint32_t ticks = tcplp_sys_get_ticks();
 
@@ -409,6 +411,7 @@ after_sack_rexmit:
 			tp->t_rxtshift = 0;
 			tp->snd_nxt = tp->snd_una;
 			if (!tcp_timer_active(tp, TT_PERSIST)) {
+				tp->t_zerowincnt++;
 				tcp_setpersist(tp);
 			}
 		}
@@ -688,6 +691,7 @@ dontupdate:
 	if (lbuf_used_space(&tp->sendbuf) && !tcp_timer_active(tp, TT_REXMT) &&
 	    !tcp_timer_active(tp, TT_PERSIST)) {
 		tp->t_rxtshift = 0;
+		tp->t_zerowincnt++;
 		tcp_setpersist(tp);
 	}
 
@@ -1408,8 +1412,18 @@ timer:
 	if (sendalot && --maxburst)
 		goto again;
 #endif
-	if (sendalot)
+	if (sendalot) {
+		/*
+		 * Optional pacing: the host can bound the number of segments sent
+		 * back-to-back by one invocation of this function. Any remaining
+		 * data is transmitted as acknowledgments arrive or when a timer
+		 * fires, spreading the window across link wakeups instead of
+		 * sending it as a single burst.
+		 */
+		if (maxburst != 0 && ++burst >= maxburst)
+			return (0);
 		goto again;
+	}
 	return (0);
 }
 
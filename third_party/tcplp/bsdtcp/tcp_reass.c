@@ -68,6 +68,16 @@ tcp_reass(struct tcpcb* tp, struct tcphdr* th, int* tlenp, otMessage* data, off_
 	if (th == NULL)
 		goto present;
 
+	/*
+	 * In the zero-copy receive mode, out-of-order segments are not buffered;
+	 * they are dropped and the peer retransmits them once the gap is filled.
+	 * Set *tlenp to 0 so that the dropped data is not SACKed.
+	 */
+	if (tp->recvzerocopy) {
+		*tlenp = 0;
+		return (0);
+	}
+
 	tlen = *tlenp;
 
 	/* Insert the new segment queue entry into place. */
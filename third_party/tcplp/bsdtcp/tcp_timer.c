@@ -363,6 +363,7 @@ tcp_timer_rexmt(struct tcpcb *tp)
 		dropped = 1;
 		goto out;
 	}
+	tp->t_rexmtcnt++;
 	if (tp->t_state == TCPS_SYN_SENT) {
 		/*
 		 * If the SYN was retransmitted, indicate CWND to be
@@ -189,8 +189,13 @@ struct tcpcb {
 
 	struct lbufhead sendbuf;
 	struct cbufhead recvbuf;
+	otMessageQueue recvmsgq; // messages retained for zero-copy receive
 	uint8_t* reassbmp;
 	int32_t reass_fin_index;
+	uint32_t recvmsgoff; // consumed bytes within the head message of recvmsgq
+	uint32_t recvzerocopy; // nonzero if the zero-copy receive mode is in use
+	uint32_t t_rexmtcnt; // number of retransmission events (timeouts and fast retransmits)
+	uint32_t t_zerowincnt; // number of times the peer's receive window closed to zero
 
 	struct in6_addr laddr; // local IP address
 	struct in6_addr faddr; // foreign IP address
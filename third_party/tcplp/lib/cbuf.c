@@ -67,6 +67,14 @@ void cbuf_copy_from_message(void* arr, size_t arr_offset, const void* buffer, si
     otMessageRead(message, (uint16_t) buffer_offset, arrptr + arr_offset, (uint16_t) num_bytes);
 }
 
+void cbuf_copy_nothing(void* buffer, size_t buffer_offset, const void* arr, size_t arr_offset, size_t num_bytes) {
+    (void) buffer;
+    (void) buffer_offset;
+    (void) arr;
+    (void) arr_offset;
+    (void) num_bytes;
+}
+
 /*
  * Cbuf implementation.
  */
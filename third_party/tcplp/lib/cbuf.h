@@ -61,6 +61,9 @@ void cbuf_copy_from_buffer(void* arr, size_t arr_offset, const void* buffer, siz
 void cbuf_copy_into_message(void* buffer, size_t buffer_offset, const void* arr, size_t arr_offset, size_t num_bytes);
 void cbuf_copy_from_message(void* arr, size_t arr_offset, const void* buffer, size_t buffer_offset, size_t num_bytes);
 
+/* Instantiation of cbuf_copier_t that copies nothing, for reserving space in a circular buffer. */
+void cbuf_copy_nothing(void* buffer, size_t buffer_offset, const void* arr, size_t arr_offset, size_t num_bytes);
+
 /* Writes data to the back of the circular buffer using the specified copier. */
 size_t cbuf_write(struct cbufhead* chdr, const void* data, size_t data_offset, size_t data_len, cbuf_copier_t copy_from);
 
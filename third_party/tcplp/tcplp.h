@@ -70,6 +70,8 @@ struct tcplp_signals
 otMessage *   tcplp_sys_new_message(otInstance *aInstance);
 void          tcplp_sys_free_message(otInstance *aInstance, otMessage *aMessage);
 void          tcplp_sys_send_message(otInstance *aInstance, otMessage *aMessage, otMessageInfo *aMessageInfo);
+bool          tcplp_sys_capture_segment(struct tcpcb *aTcb, otMessage *aMessage, size_t aOffset, size_t aLength);
+uint32_t      tcplp_sys_get_max_burst(struct tcpcb *aTcb);
 uint32_t      tcplp_sys_get_ticks();
 uint32_t      tcplp_sys_get_millis();
 void          tcplp_sys_set_timer(struct tcpcb *aTcb, uint8_t aTimerFlag, uint32_t aDelay);